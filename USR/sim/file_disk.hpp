@@ -0,0 +1,58 @@
+#ifndef _SIM_FILE_DISK_
+#define _SIM_FILE_DISK_
+
+#include <stdio.h>
+
+#include "../src/drivers/device/blk.hpp"
+
+namespace Sim
+{
+	using Driver::Device::BlkDev_t;
+
+	// Disk image used directly as a block device, no card model in between
+	struct FileDisk_t
+	{
+		static constexpr auto SECTOR_SIZE = 512;
+
+		FILE* img;
+		uint32_t sectors;
+
+		inline bool seek(uint32_t sector, uint32_t count) const
+		{
+			return sector < sectors && count <= sectors - sector &&
+			       !fseek(img, (long) sector * SECTOR_SIZE, SEEK_SET);
+		}
+	};
+
+	inline constexpr BlkDev_t::Ops_t file_disk_ops {
+	    .init = [](void*) { return BlkDev_t::OK; },
+
+	    .read = [](void* ctx, uint8_t* buf, uint32_t sector, uint32_t count) {
+		    auto& disk = *(FileDisk_t*) ctx;
+		    if (!disk.seek(sector, count)) return BlkDev_t::PARERR;
+		    const auto n = fread(buf, FileDisk_t::SECTOR_SIZE, count, disk.img);
+		    return n == count ? BlkDev_t::OK : BlkDev_t::ERROR;
+	    },
+
+	    .write = [](void* ctx, const uint8_t* buf, uint32_t sector, uint32_t count) {
+		    auto& disk = *(FileDisk_t*) ctx;
+		    if (!disk.seek(sector, count)) return BlkDev_t::PARERR;
+		    const auto n = fwrite(buf, FileDisk_t::SECTOR_SIZE, count, disk.img);
+		    return n == count ? BlkDev_t::OK : BlkDev_t::ERROR;
+	    },
+
+	    .ioctl = [](void* ctx, BlkDev_t::Ctrl cmd, uint32_t* arg) {
+		    auto& disk = *(FileDisk_t*) ctx;
+		    switch (cmd) {
+			    case BlkDev_t::SYNC: return fflush(disk.img) ? BlkDev_t::ERROR : BlkDev_t::OK;
+			    case BlkDev_t::SECTOR_COUNT: *arg = disk.sectors; return BlkDev_t::OK;
+			    case BlkDev_t::SECTOR_SIZE: *arg = FileDisk_t::SECTOR_SIZE; return BlkDev_t::OK;
+			    case BlkDev_t::BLOCK_SIZE: *arg = 1; return BlkDev_t::OK;
+			    case BlkDev_t::TRIM: return BlkDev_t::OK; // the image stays as it is
+			    default: return BlkDev_t::PARERR;
+		    }
+	    },
+	};
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef _SIM_STM32F4XX_
+#define _SIM_STM32F4XX_
+
+// Host stand-in for the CMSIS device header: just the register blocks and
+// constants the HAL wrappers in src/drivers/stm32f4xx touch.
+// Peripherals are plain objects, SPI DR clocks bytes through the simulated bus.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define __IO   volatile
+#define __WEAK __attribute__((weak))
+
+typedef enum { RESET = 0, SET = !RESET } FlagStatus, ITStatus;
+typedef enum { DISABLE = 0, ENABLE = !DISABLE } FunctionalState;
+typedef enum { Bit_RESET = 0, Bit_SET } BitAction;
+
+// SPI data register, a write exchanges one frame with the device selected on the bus
+struct SimDR_t
+{
+	uint16_t rx;
+
+	SimDR_t& operator=(uint16_t tx);
+	operator uint16_t() const { return rx; }
+};
+
+typedef struct
+{
+	__IO uint16_t CR1;
+	__IO uint16_t CR2;
+	__IO uint16_t SR;
+	SimDR_t DR;
+	__IO uint16_t CRCPR;
+	__IO uint16_t RXCRCR;
+	__IO uint16_t TXCRCR;
+	__IO uint16_t I2SCFGR;
+	__IO uint16_t I2SPR;
+} SPI_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t MODER;
+	__IO uint32_t OTYPER;
+	__IO uint32_t OSPEEDR;
+	__IO uint32_t PUPDR;
+	__IO uint32_t IDR;
+	__IO uint32_t ODR;
+	__IO uint16_t BSRRL;
+	__IO uint16_t BSRRH;
+	__IO uint32_t LCKR;
+	__IO uint32_t AFR[2];
+} GPIO_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t CR;
+	__IO uint32_t NDTR;
+	__IO uint32_t PAR;
+	__IO uint32_t M0AR;
+	__IO uint32_t M1AR;
+	__IO uint32_t FCR;
+} DMA_Stream_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t LISR;
+	__IO uint32_t HISR;
+	__IO uint32_t LIFCR;
+	__IO uint32_t HIFCR;
+} DMA_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t CR;
+	__IO uint32_t PLLCFGR;
+	__IO uint32_t CFGR;
+} RCC_TypeDef;
+
+// Only the APB1/APB2 split matters (SPI_t::get_pclk), the simulated peripherals live in host memory
+#define PERIPH_BASE     ((uintptr_t) 0)
+#define APB2PERIPH_BASE (PERIPH_BASE)
+
+extern SPI_TypeDef sim_spi5;
+extern GPIO_TypeDef sim_gpioe, sim_gpiof;
+
+#define SPI5  (&sim_spi5)
+#define GPIOE (&sim_gpioe)
+#define GPIOF (&sim_gpiof)
+
+#define SPI_CR1_BR  ((uint16_t) 0x0038)
+#define SPI_CR1_SPE ((uint16_t) 0x0040)
+#define SPI_CR1_DFF ((uint16_t) 0x0800)
+
+#define DMA_SxCR_EN    ((uint32_t) 0x00000001)
+#define DMA_SxCR_MINC  ((uint32_t) 0x00000400)
+#define DMA_SxCR_PSIZE ((uint32_t) 0x00001800)
+#define DMA_SxCR_MSIZE ((uint32_t) 0x00006000)
+
+#include "stm32f4xx_rcc.h"
+#include "stm32f4xx_gpio.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_spi.h"
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef _SIM_STM32F4XX_DMA_
+#define _SIM_STM32F4XX_DMA_
+
+#include "stm32f4xx.h"
+
+// Declarations only, the simulator runs the SD card without DMA
+
+typedef struct
+{
+	uint32_t DMA_Channel;
+	uint32_t DMA_PeripheralBaseAddr;
+	uint32_t DMA_Memory0BaseAddr;
+	uint32_t DMA_DIR;
+	uint32_t DMA_BufferSize;
+	uint32_t DMA_PeripheralInc;
+	uint32_t DMA_MemoryInc;
+	uint32_t DMA_PeripheralDataSize;
+	uint32_t DMA_MemoryDataSize;
+	uint32_t DMA_Mode;
+	uint32_t DMA_Priority;
+	uint32_t DMA_FIFOMode;
+	uint32_t DMA_FIFOThreshold;
+	uint32_t DMA_MemoryBurst;
+	uint32_t DMA_PeripheralBurst;
+} DMA_InitTypeDef;
+
+#define DMA_DIR_PeripheralToMemory      ((uint32_t) 0x00000000)
+#define DMA_DIR_MemoryToPeripheral      ((uint32_t) 0x00000040)
+#define DMA_PeripheralInc_Disable       ((uint32_t) 0x00000000)
+#define DMA_MemoryInc_Enable            ((uint32_t) 0x00000400)
+#define DMA_PeripheralDataSize_Byte     ((uint32_t) 0x00000000)
+#define DMA_PeripheralDataSize_HalfWord ((uint32_t) 0x00000800)
+#define DMA_MemoryDataSize_Byte         ((uint32_t) 0x00000000)
+#define DMA_MemoryDataSize_HalfWord     ((uint32_t) 0x00002000)
+#define DMA_Mode_Normal                 ((uint32_t) 0x00000000)
+#define DMA_Priority_High               ((uint32_t) 0x00020000)
+#define DMA_FIFOMode_Disable            ((uint32_t) 0x00000000)
+#define DMA_FIFOThreshold_Full          ((uint32_t) 0x00000003)
+#define DMA_MemoryBurst_Single          ((uint32_t) 0x00000000)
+#define DMA_PeripheralBurst_Single      ((uint32_t) 0x00000000)
+#define DMA_IT_TC                       ((uint32_t) 0x00000010)
+#define DMA_IT_TE                       ((uint32_t) 0x00000004)
+
+void DMA_DeInit(DMA_Stream_TypeDef* DMAy_Streamx);
+void DMA_Init(DMA_Stream_TypeDef* DMAy_Streamx, DMA_InitTypeDef* DMA_InitStruct);
+void DMA_Cmd(DMA_Stream_TypeDef* DMAy_Streamx, FunctionalState NewState);
+FunctionalState DMA_GetCmdStatus(DMA_Stream_TypeDef* DMAy_Streamx);
+uint16_t DMA_GetCurrDataCounter(DMA_Stream_TypeDef* DMAy_Streamx);
+FlagStatus DMA_GetFlagStatus(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_FLAG);
+void DMA_ClearFlag(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_FLAG);
+void DMA_ITConfig(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_IT, FunctionalState NewState);
+ITStatus DMA_GetITStatus(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_IT);
+void DMA_ClearITPendingBit(DMA_Stream_TypeDef* DMAy_Streamx, uint32_t DMA_IT);
+
+#endif
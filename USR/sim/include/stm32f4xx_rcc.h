@@ -0,0 +1,27 @@
+#ifndef _SIM_STM32F4XX_RCC_
+#define _SIM_STM32F4XX_RCC_
+
+#include "stm32f4xx.h"
+
+typedef struct
+{
+	uint32_t SYSCLK_Frequency;
+	uint32_t HCLK_Frequency;
+	uint32_t PCLK1_Frequency;
+	uint32_t PCLK2_Frequency;
+} RCC_ClocksTypeDef;
+
+#define RCC_APB2Periph_SPI5 ((uint32_t) 0x00100000)
+
+void RCC_GetClocksFreq(RCC_ClocksTypeDef* RCC_Clocks);
+void RCC_LSEConfig(uint8_t RCC_LSE);
+FlagStatus RCC_GetFlagStatus(uint8_t RCC_FLAG);
+void RCC_RTCCLKConfig(uint32_t RCC_RTCCLKSource);
+void RCC_RTCCLKCmd(FunctionalState NewState);
+void RCC_AHB1PeriphClockCmd(uint32_t RCC_AHB1Periph, FunctionalState NewState);
+void RCC_AHB2PeriphClockCmd(uint32_t RCC_AHB2Periph, FunctionalState NewState);
+void RCC_AHB3PeriphClockCmd(uint32_t RCC_AHB3Periph, FunctionalState NewState);
+void RCC_APB1PeriphClockCmd(uint32_t RCC_APB1Periph, FunctionalState NewState);
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState);
+
+#endif
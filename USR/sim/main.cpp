@@ -0,0 +1,816 @@
+// Host build of SD_t + diskio + FatFs against a simulated SD card
+//
+// Drive "0:" is backed by one of
+//   sd:   SD_t talking to the card model, timed in virtual time: bus bytes at
+//         the SCK rate plus the card's delays and the driver's sleeps
+//   file: the image itself, timed in host time
+//   ram:  host memory, timed in host time
+// Drive "1:" is a 128 sector RAM disk as on the board.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <chrono>
+#include <semaphore>
+#include <thread>
+
+#include "sd_card.hpp"
+#include "file_disk.hpp"
+#include "../src/drivers/device/sd.hpp"
+#include "../src/user/FatFS/ff.h"
+#include "../src/user/FatFS/diskio.h"
+#include "../src/user/file.hpp"
+#include "../src/user/log_file.hpp"
+
+using Driver::Device::SD_t;
+using Driver::Device::BlkDev_t;
+using Driver::Device::RamDisk_t;
+using Driver::Device::ReadAhead_t;
+using Driver::Device::Cache_t;
+using MOS::FileSys::File_t;
+using MOS::FileSys::LogFile_t;
+
+namespace MOS::User::Global
+{
+	// Same wiring as src/user/global.hpp
+	SD_t sd {
+	    SPI5,
+	    {GPIOF, GPIO_Pin_7}, // PF7 -> SCLK
+	    {GPIOF, GPIO_Pin_8}, // PF8 -> MISO
+	    {GPIOF, GPIO_Pin_9}, // PF9 -> MOSI
+	    {GPIOE, GPIO_Pin_3}, // PE3 -> CS
+	};
+
+	// Sleeping only moves virtual time on
+	SD_t::Os_t sd_os {
+	    [](uint32_t ms) { Sim::vtime.advance_us(ms * 1000); },
+	    [] { return Sim::vtime.ms(); },
+	};
+}
+
+// FatFs volume locks on host threads, a token per volume as on the board
+namespace Vol
+{
+	struct Grant_t
+	{
+		std::binary_semaphore sem {0};
+	} grant[_VOLUMES];
+
+	const FsLock_t::Os_t os {
+	    [](BYTE vol, UINT ticks) { return grant[vol].sem.try_acquire_for(std::chrono::milliseconds(ticks)); },
+	    [](BYTE vol) { grant[vol].sem.release(); },
+	    [] {
+		    using namespace std::chrono;
+		    return (UINT) duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+	    },
+	};
+}
+
+// No worker, requests run in the caller; the clock dates cache lines and times TRIMs
+const BlkDev_t::Os_t blk_os {
+    nullptr,
+    [] { return Sim::vtime.ms(); },
+};
+
+using MOS::User::Global::sd;
+using Sim::vtime;
+
+static constexpr auto BLOCK_SIZE = SD_t::BLOCK_SIZE;
+
+static bool virt = true; // virtual time, only the SD model has a notion of it
+
+// In 0.01 MB/s
+static uint32_t mb_s(uint64_t bytes, uint64_t us)
+{
+	return us ? bytes * 100 * 1'000'000 / us >> 20 : 0;
+}
+
+template <typename Fn>
+static uint64_t measure(Fn&& fn)
+{
+	using namespace std::chrono;
+
+	const auto t0 = vtime.us();
+	const auto h0 = steady_clock::now();
+	fn();
+	return virt ? vtime.us() - t0 : duration_cast<microseconds>(steady_clock::now() - h0).count();
+}
+
+// Raw block I/O, reads sectors 0..63 and writes the same data back
+static bool bench_raw()
+{
+	static constexpr auto TOTAL = 256 * 1024;
+	static constexpr uint32_t SIZES[] = {1, 8, 64};
+	static uint8_t buf[64 * BLOCK_SIZE];
+
+	if (disk_read(0, buf, 0, 64) != RES_OK) {
+		printf("raw: read failed\n");
+		return false;
+	}
+
+	bool ok = true;
+	for (auto n: SIZES) {
+		const uint32_t rounds = TOTAL / (n * BLOCK_SIZE);
+
+		const auto rd = measure([&] {
+			for (uint32_t i = 0; i < rounds; i++) ok &= disk_read(0, buf, 0, n) == RES_OK;
+		});
+		const auto wr = measure([&] {
+			for (uint32_t i = 0; i < rounds; i++) ok &= disk_write(0, buf, 0, n) == RES_OK;
+		});
+
+		const auto r = mb_s(TOTAL, rd), w = mb_s(TOTAL, wr);
+		printf("raw %2u sectors: read %3u.%02u MB/s (%5llu us/op), write %3u.%02u MB/s (%5llu us/op)\n",
+		       n, r / 100, r % 100, (unsigned long long) rd / rounds,
+		       w / 100, w % 100, (unsigned long long) wr / rounds);
+	}
+	return ok;
+}
+
+// A file through FatFs, written in `chunk` bytes, read back and compared
+static bool bench_file(const char* path, uint32_t size, uint32_t chunk)
+{
+	static uint8_t buf[32 * 1024];
+
+	auto fill = [](uint8_t* p, uint32_t len, uint32_t pos) {
+		for (uint32_t i = 0; i < len; i++) p[i] = (pos + i) * 131 >> 3;
+	};
+
+	FIL fil;
+	UINT bw, br;
+	FRESULT res;
+
+	const auto wr = measure([&] {
+		res = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+		for (uint32_t pos = 0; res == FR_OK && pos < size; pos += chunk) {
+			fill(buf, chunk, pos);
+			res = f_write(&fil, buf, chunk, &bw);
+			if (bw != chunk) res = FR_DISK_ERR;
+		}
+		if (res == FR_OK) res = f_close(&fil);
+	});
+	if (res != FR_OK) {
+		printf("file: write failed (%d)\n", res);
+		return false;
+	}
+
+	uint32_t bad = 0;
+	const auto rd = measure([&] {
+		static uint8_t ref[sizeof(buf)];
+		res = f_open(&fil, path, FA_OPEN_EXISTING | FA_READ);
+		for (uint32_t pos = 0; res == FR_OK && pos < size; pos += chunk) {
+			res = f_read(&fil, buf, chunk, &br);
+			fill(ref, chunk, pos);
+			if (br != chunk || memcmp(buf, ref, chunk)) bad++;
+		}
+		if (res == FR_OK) res = f_close(&fil);
+	});
+	if (res != FR_OK) {
+		printf("file: read failed (%d)\n", res);
+		return false;
+	}
+
+	const auto r = mb_s(size, rd), w = mb_s(size, wr);
+	printf("%s %4u KB by %5u B: write %3u.%02u MB/s, read %3u.%02u MB/s, %s\n",
+	       path, size / 1024, chunk, w / 100, w % 100, r / 100, r % 100,
+	       bad ? "MISMATCH" : "verified");
+
+	f_unlink(path);
+	return !bad;
+}
+
+// Appends as App::lgw_cmd does them: open, seek to the end, write, close
+static bool bench_log(const Sim::SdCard_t& card, uint32_t appends)
+{
+	static const char line[] = "[00:00:00] sys: a log line of about 48 bytes\n";
+
+	f_unlink("0:sim.log");
+
+	const auto rd0 = card.stat.rd_blocks, wr0 = card.stat.wr_blocks;
+	FRESULT res    = FR_OK;
+
+	const auto us = measure([&] {
+		FIL fil;
+		UINT bw;
+		for (uint32_t i = 0; res == FR_OK && i < appends; i++) {
+			res = f_open(&fil, "0:sim.log", FA_OPEN_ALWAYS | FA_WRITE);
+			if (res == FR_OK) res = f_lseek(&fil, f_size(&fil));
+			if (res == FR_OK) res = f_write(&fil, line, sizeof(line) - 1, &bw);
+			if (res == FR_OK) res = f_close(&fil);
+		}
+	});
+	if (res != FR_OK) {
+		printf("log: append failed (%d)\n", res);
+		return false;
+	}
+
+	printf("0:sim.log %u appends: %llu us each", appends, (unsigned long long) us / appends);
+	if (virt) {
+		printf(", card %u.%02u blocks read, %u.%02u written per append",
+		       (card.stat.rd_blocks - rd0) / appends, (card.stat.rd_blocks - rd0) * 100 / appends % 100,
+		       (card.stat.wr_blocks - wr0) / appends, (card.stat.wr_blocks - wr0) * 100 / appends % 100);
+	}
+	printf("\n");
+
+	f_unlink("0:sim.log");
+	return true;
+}
+
+// The same kind of lines through LogFile_t as the 'log' task runs it: put and
+// poll per line, rotated at 128 KB, then both files read back in order
+static bool bench_appender(const Sim::SdCard_t& card, uint32_t lines)
+{
+	static uint8_t buf[8 * LogFile_t::SECTOR];
+	static constexpr LogFile_t::Cfg_t CFG {"0:app.log", 128 * 1024, 1, 16 * 1024, 1000};
+	static constexpr auto LINE = 43; // "[000000] sys: a log line of about 48 bytes\n"
+
+	auto now = [] { return (uint32_t) (virt ? vtime.ms() : vtime.us() / 1000); };
+
+	f_unlink("0:app.log");
+	f_unlink("0:app.log.1");
+
+	LogFile_t log {CFG, buf, sizeof(buf)};
+	FRESULT res = log.open();
+
+	const auto wr0 = card.stat.wr_blocks;
+	uint64_t worst = 0;
+	char line[64];
+
+	const auto us = measure([&] {
+		for (uint32_t i = 0; res == FR_OK && i < lines; i++) {
+			snprintf(line, sizeof(line), "[%06u] sys: a log line of about 48 bytes", i);
+			const auto t = measure([&] {
+				if (!log.put(line, strlen(line), now())) res = FR_DENIED;
+				if (res == FR_OK) res = log.poll(now());
+			});
+			if (t > worst) worst = t;
+		}
+		if (res == FR_OK) res = log.close();
+	});
+	if (res != FR_OK) {
+		printf("appender: failed (%d)\n", res);
+		return false;
+	}
+
+	// Oldest first: app.log.1 then app.log, every line once and in order
+	uint32_t next = 0, bad = 0;
+	for (auto path: {"0:app.log.1", "0:app.log"}) {
+		FIL fil;
+		UINT br;
+		char got[LINE + 1];
+		if (f_open(&fil, path, FA_OPEN_EXISTING | FA_READ) != FR_OK) continue;
+		while (f_read(&fil, got, LINE, &br) == FR_OK && br == LINE) {
+			snprintf(line, sizeof(line), "[%06u] sys: a log line of about 48 bytes\n", next++);
+			if (memcmp(got, line, LINE)) bad++;
+		}
+		f_close(&fil);
+		f_unlink(path);
+	}
+	if (next != lines) bad++;
+
+	const auto& st = log.stat;
+	printf("0:app.log %u lines: %llu lines/s, worst %llu us, %u sectors in %u writes, %u syncs, %u rotations",
+	       lines, us ? (unsigned long long) lines * 1'000'000 / us : 0, (unsigned long long) worst,
+	       st.sectors, st.writes, st.syncs, st.rotations);
+	if (virt) {
+		const auto wr = card.stat.wr_blocks - wr0;
+		printf(", card %u.%02u blocks written per line", wr / lines, wr * 100 / lines % 100);
+	}
+	printf(", %s\n", bad ? "MISMATCH" : "verified");
+	return !bad;
+}
+
+// A preallocated contiguous file streamed as raw sectors through File_t,
+// `chunk` sectors per write_sectors, checked with read_sectors, then trimmed
+// to its size by finish() and read back through FatFs
+static bool bench_contig(const char* path, uint32_t size, uint32_t chunk)
+{
+	static uint8_t buf[64 * BLOCK_SIZE], ref[sizeof(buf)];
+	static constexpr auto SPARE = 64 * 1024; // allocated and given back
+
+	auto fill = [](uint8_t* p, uint32_t len, uint32_t pos) {
+		for (uint32_t i = 0; i < len; i++) p[i] = (pos + i) * 131 >> 3;
+	};
+
+	FATFS* fs;
+	DWORD free0 = 0, free1 = 0;
+	f_getfree("0:", &free0, &fs);
+
+	FIL fil;
+	File_t file {fil};
+	FRESULT res = file.open(path, File_t::OpenMode::Write);
+	if (res == FR_OK) res = file.preallocate(size + SPARE);
+	if (res != FR_OK) {
+		printf("contig: preallocation failed (%d)\n", res);
+		return false;
+	}
+
+	const auto bytes = chunk * BLOCK_SIZE;
+	const auto wr    = measure([&] {
+		for (uint32_t pos = 0; res == FR_OK && pos < size; pos += bytes) {
+			fill(buf, bytes, pos);
+			res = file.write_sectors(buf, pos / BLOCK_SIZE, chunk);
+		}
+	});
+
+	uint32_t bad = 0;
+	for (uint32_t pos = 0; res == FR_OK && pos < size; pos += bytes) {
+		res = file.read_sectors(buf, pos / BLOCK_SIZE, chunk);
+		fill(ref, bytes, pos);
+		if (memcmp(buf, ref, bytes)) bad++;
+	}
+	if (file.write_sectors(buf, (size + SPARE) / BLOCK_SIZE, 1) != FR_INVALID_PARAMETER) bad++; // past the run
+
+	if (res == FR_OK) res = file.finish(size);
+	if (res == FR_OK) res = file.close();
+	f_getfree("0:", &free1, &fs);
+	if (res != FR_OK) {
+		printf("contig: write failed (%d)\n", res);
+		return false;
+	}
+
+	// Through FatFs: the chain and the directory entry have to agree
+	const auto rd = measure([&] {
+		res = file.open(path, File_t::OpenMode::Read);
+		if (res == FR_OK && file.size() != size) bad++;
+		for (uint32_t pos = 0; res == FR_OK && pos < size; pos += bytes) {
+			const auto [fres, n] = file.read(buf, bytes);
+			res                  = fres;
+			fill(ref, bytes, pos);
+			if (n != bytes || memcmp(buf, ref, bytes)) bad++;
+		}
+		if (res == FR_OK) res = file.close();
+	});
+
+	const DWORD used = (free0 - free1) * fs->csize * BLOCK_SIZE;
+	if (used < size || used - size >= (DWORD) fs->csize * BLOCK_SIZE) bad++; // SPARE given back
+
+	const auto r = mb_s(size, rd), w = mb_s(size, wr);
+	printf("%s %4u KB contiguous, %u sectors per write: write %3u.%02u MB/s, read %3u.%02u MB/s, %s\n",
+	       path, size / 1024, chunk, w / 100, w % 100, r / 100, r % 100,
+	       res != FR_OK || bad ? "MISMATCH" : "verified");
+
+	f_unlink(path);
+	return res == FR_OK && !bad;
+}
+
+// Random 512 B reads across a fragmented file, first following the FAT
+// chain from the top on every seek, then through a cluster link map
+static bool bench_seek(const char* path, uint32_t size, uint32_t reads)
+{
+	static constexpr auto PIECE = 32 * 1024;
+	static uint8_t buf[PIECE];
+	static DWORD clmt[1024];
+
+	auto fill = [](uint8_t* p, uint32_t len, uint32_t pos) {
+		for (uint32_t i = 0; i < len; i++) p[i] = (pos + i) * 131 >> 3;
+	};
+
+	// Written in turns with a second file, which then goes: one fragment per piece
+	FIL fil, gap;
+	UINT n;
+	FRESULT res = f_open(&fil, path, FA_CREATE_ALWAYS | FA_WRITE);
+	if (res == FR_OK) res = f_open(&gap, "0:gap.bin", FA_CREATE_ALWAYS | FA_WRITE);
+	for (uint32_t pos = 0; res == FR_OK && pos < size; pos += PIECE) {
+		fill(buf, PIECE, pos);
+		res = f_write(&fil, buf, PIECE, &n);
+		if (res == FR_OK) res = f_write(&gap, buf, PIECE, &n);
+	}
+	f_close(&gap);
+	f_unlink("0:gap.bin");
+	if (res == FR_OK) res = f_close(&fil);
+
+	File_t file {fil};
+	if (res == FR_OK) res = file.open(path, File_t::OpenMode::Read);
+	if (res != FR_OK) {
+		printf("seek: setup failed (%d)\n", res);
+		return false;
+	}
+
+	const auto& st = disk_device(0)->stat;
+	uint32_t bad   = 0;
+
+	auto run = [&](const char* mode) {
+		uint32_t seed = 1, ofs;
+		const auto rd0 = st.rd_sectors;
+		const auto us  = measure([&] {
+			static uint8_t ref[BLOCK_SIZE];
+			for (uint32_t i = 0; res == FR_OK && i < reads; i++) {
+				seed = seed * 1103515245 + 12345;
+				ofs  = (seed >> 8) % (size / BLOCK_SIZE) * BLOCK_SIZE;
+				res  = file.seek(ofs);
+				n    = 0;
+				if (res == FR_OK) {
+					const auto r = file.read(buf, BLOCK_SIZE);
+					res          = r.fres;
+					n            = r.fnum;
+				}
+				fill(ref, BLOCK_SIZE, ofs);
+				if (n != BLOCK_SIZE || memcmp(buf, ref, BLOCK_SIZE)) bad++;
+			}
+		});
+		const auto sec = st.rd_sectors - rd0;
+		printf("   %s: %llu us, %u.%02u sectors per read\n", mode,
+		       (unsigned long long) us / reads, sec / reads, sec * 100 / reads % 100);
+	};
+
+	printf("%s %u KB, %u random %u B reads\n", path, size / 1024, reads, BLOCK_SIZE);
+	run("FAT walk ");
+
+	if (res == FR_OK) res = file.enable_fast_seek(clmt);
+	if (res == FR_OK) run("fast seek");
+	if (res == FR_OK) printf("   %u fragments, %u B link map\n", (unsigned) (clmt[0] - 2) / 2, (unsigned) clmt[0] * 4);
+	file.disable_fast_seek();
+
+	file.close();
+	f_unlink(path);
+
+	if (res != FR_OK || bad) {
+		printf("seek: failed (%d), %u bad reads\n", res, bad);
+		return false;
+	}
+	return true;
+}
+
+// 32 KB transfers through File_t: written and read with the direct variants
+// at sector aligned offsets, straight between the buffer and the device,
+// then read at a misaligned offset, which goes through the sector window
+static bool bench_direct(const char* path, uint32_t size)
+{
+	static constexpr auto CHUNK = 32 * 1024;
+	alignas(4) static uint8_t buf[CHUNK], ref[CHUNK];
+
+	auto fill = [](uint8_t* p, uint32_t len, uint32_t pos) {
+		for (uint32_t i = 0; i < len; i++) p[i] = (pos + i) * 131 >> 3;
+	};
+
+	FIL fil;
+	File_t file {fil};
+	FRESULT res = file.open(path, File_t::OpenMode::Write);
+	for (uint32_t pos = 0; res == FR_OK && pos < size; pos += CHUNK) {
+		fill(buf, CHUNK, pos);
+		res = file.write_direct(buf, CHUNK).fres;
+	}
+	const DWORD wr_bounce = file.bounced();
+	if (res == FR_OK) res = file.close();
+	if (res == FR_OK) res = file.open(path, File_t::OpenMode::Read);
+	if (res != FR_OK) {
+		printf("direct: setup failed (%d)\n", res);
+		return false;
+	}
+
+	const auto& st = disk_device(0)->stat;
+	uint32_t bad   = 0;
+
+	printf("%s %u KB by %u B, %u B bounced writing\n", path, size / 1024, CHUNK, (unsigned) wr_bounce);
+	auto run = [&](const char* mode, uint32_t skew) {
+		const auto ops0   = st.rd_ops;
+		const DWORD b0    = file.bounced();
+		const uint32_t nr = (size - skew) / CHUNK;
+		const auto us     = measure([&] {
+			res = file.seek(skew);
+			for (uint32_t i = 0; res == FR_OK && i < nr; i++) {
+				const auto r = skew ? file.read(buf, CHUNK) : file.read_direct(buf, CHUNK);
+				res          = r.fres;
+				fill(ref, CHUNK, skew + i * CHUNK);
+				if (r.fnum != CHUNK || memcmp(buf, ref, CHUNK)) bad++;
+			}
+		});
+		const auto ops = st.rd_ops - ops0;
+		const auto r   = mb_s(nr * CHUNK, us);
+		printf("   %s: read %3u.%02u MB/s, %u.%02u device reads and %u B bounced per read\n", mode,
+		       r / 100, r % 100, ops / nr, ops * 100 / nr % 100, (unsigned) (file.bounced() - b0) / nr);
+	};
+	run("aligned   ", 0);
+	if (res == FR_OK) run("misaligned", 100);
+
+	// Refused where they'd have to bounce: a misaligned position, buffer or length
+	if (file.read_direct(buf, CHUNK).fres != FR_INVALID_PARAMETER) bad++;
+	if (res == FR_OK) res = file.seek(0);
+	if (file.read_direct(buf + 1, BLOCK_SIZE).fres != FR_INVALID_PARAMETER) bad++;
+	if (file.read_direct(buf, BLOCK_SIZE + 1).fres != FR_INVALID_PARAMETER) bad++;
+
+	file.close();
+	f_unlink(path);
+
+	if (res != FR_OK || bad || wr_bounce) {
+		printf("direct: failed (%d), %u bad reads, %u B bounced writing\n", res, bad, (unsigned) wr_bounce);
+		return false;
+	}
+	return true;
+}
+
+// Threads as tasks: three files on drive 0: and one on 1: at once, each
+// written, read back and compared, FatFs serializes them per volume
+static bool bench_tasks()
+{
+	struct Job_t
+	{
+		const char* path;
+		uint32_t size;
+		FRESULT res;
+		uint32_t bad;
+	} jobs[] = {
+	    {"0:task0.bin", 256 * 1024},
+	    {"0:task1.bin", 256 * 1024},
+	    {"0:task2.bin", 256 * 1024},
+	    { "1:task.bin",  32 * 1024},
+	};
+
+	auto run = [](Job_t& job) {
+		static constexpr auto CHUNK = 4096;
+		uint8_t buf[CHUNK], ref[CHUNK];
+		const uint8_t seed = job.path[5];
+
+		auto fill = [&](uint8_t* p, uint32_t pos) {
+			for (uint32_t i = 0; i < CHUNK; i++) p[i] = (pos + i) * 131 >> 3 ^ seed;
+		};
+
+		FIL fil;
+		UINT n;
+		FRESULT& res = job.res;
+
+		res = f_open(&fil, job.path, FA_CREATE_ALWAYS | FA_WRITE);
+		for (uint32_t pos = 0; res == FR_OK && pos < job.size; pos += CHUNK) {
+			fill(buf, pos);
+			res = f_write(&fil, buf, CHUNK, &n);
+		}
+		if (res == FR_OK) res = f_close(&fil);
+
+		if (res == FR_OK) res = f_open(&fil, job.path, FA_OPEN_EXISTING | FA_READ);
+		for (uint32_t pos = 0; res == FR_OK && pos < job.size; pos += CHUNK) {
+			res = f_read(&fil, buf, CHUNK, &n);
+			fill(ref, pos);
+			if (n != CHUNK || memcmp(buf, ref, CHUNK)) job.bad++;
+		}
+		if (res == FR_OK) res = f_close(&fil);
+	};
+
+	std::thread tasks[sizeof(jobs) / sizeof(jobs[0])];
+	for (uint32_t i = 0; auto& job: jobs) tasks[i++] = std::thread {run, std::ref(job)};
+	for (auto& t: tasks) t.join();
+
+	bool ok = true;
+	for (auto& job: jobs) {
+		if (job.res != FR_OK || job.bad) {
+			printf("%s: task failed (%d), %u bad chunks\n", job.path, job.res, job.bad);
+			ok = false;
+		}
+	}
+
+	// _FS_LOCK: a file open for writing can't be opened again
+	FIL a, b;
+	FRESULT res = f_open(&a, jobs[0].path, FA_OPEN_EXISTING | FA_WRITE);
+	if (res == FR_OK) {
+		if (f_open(&b, jobs[0].path, FA_OPEN_EXISTING | FA_READ) != FR_LOCKED) {
+			printf("%s: opened twice while written\n", jobs[0].path);
+			ok = false;
+		}
+		f_close(&a);
+	}
+
+	for (auto& job: jobs) f_unlink(job.path);
+
+	printf("tasks: 3 files on 0:, 1 on 1: at once, %s\n", ok ? "verified" : "FAILED");
+	return ok;
+}
+
+static void show_stats(const Sim::SdCard_t& card)
+{
+	for (uint8_t drv = 0; drv < _VOLUMES; drv++) {
+		const auto dev = disk_device(drv);
+		if (!dev) continue;
+		const auto& st = dev->stat;
+		printf("%s%u: %s, rd %u/%u, wr %u/%u (ops/sectors), %u syncs, %u trims (%u cut), %u errors\n",
+		       drv ? "" : "\n", drv, dev->name, st.rd_ops, st.rd_sectors,
+		       st.wr_ops, st.wr_sectors, st.syncs, st.trims, st.trim_cut, st.errors);
+		if (const auto ra = dev->ra) {
+			printf("   read-ahead %u x %u sectors, %u hits, %u misses, %u fills (%u late, %u wasted)\n",
+			       ra->SLOTS, ra->len, ra->stat.hits, ra->stat.misses,
+			       ra->stat.fills, ra->stat.late, ra->stat.wasted);
+		}
+		if (const auto c = dev->cache) {
+			const auto looked = c->stat.hits + c->stat.misses;
+			printf("   cache %u lines, hit %u%% (%u/%u), %u writes absorbed, %u written back, %u dirty\n",
+			       c->n, looked ? c->stat.hits * 100 / looked : 0, c->stat.hits, looked,
+			       c->stat.absorbed, c->stat.write_backs, c->stat.dirty);
+		}
+		if (const auto lk = ff_lock(drv)) {
+			const unsigned waits = lk->stat.waits;
+			printf("   volume lock %u grants, %u waits (avg %u max %u ms, host time), %u timeouts\n",
+			       (unsigned) lk->stat.grants, waits, waits ? (unsigned) lk->stat.wait_sum / waits : 0,
+			       (unsigned) lk->stat.wait_max, (unsigned) lk->stat.timeouts);
+		}
+	}
+
+	if (disk_device(0)->ctx != &sd) return;
+
+	printf("driver: clk %u Hz, step downs %u, crc %s, crc errs %u, retries %u\n",
+	       sd.clk, sd.step_cnt, sd.crc_on ? "on" : "off", sd.crc_errs, sd.retry_cnt);
+	printf("erase: %u commands, %u blocks, %u failed\n",
+	       sd.erase_stat.cnt, sd.erase_stat.blocks, sd.erase_stat.fails);
+	printf("busy: %u waits, avg %u ms, max %u ms, timeouts %u, hist",
+	       sd.busy.cnt, sd.busy.cnt ? sd.busy.sum / sd.busy.cnt : 0, sd.busy.max, sd.busy.timeouts);
+	for (auto n: sd.busy.hist) printf(" %u", n);
+
+	const auto& st = card.stat;
+	printf("\ncard: %u cmds, %u blocks read, %u written (%u pre-erased, %u onto erased), busy %llu ms\n",
+	       st.cmds, st.rd_blocks, st.wr_blocks, st.pre_erased, st.wr_erased, (unsigned long long) st.busy_us / 1000);
+	printf("faults: %u blocks corrupted, %u writes rejected, %u bad CRC7, %u commands dropped, %u stalls\n",
+	       st.flips, st.wr_rejects, st.crc7_errs, st.timeouts, st.stalls);
+	printf("bus: %llu bytes, virtual time %llu ms\n",
+	       (unsigned long long) Sim::bus.bytes, (unsigned long long) vtime.us() / 1000);
+}
+
+static void usage(const char* name)
+{
+	printf("usage: %s [options]\n"
+	       "  -i, --image PATH     disk image, created if missing (sd.img)\n"
+	       "  -b, --backend DEV    sd, file or ram behind drive 0: (sd)\n"
+	       "  -s, --size MB        size of a new image (64)\n"
+	       "  -n, --no-crc         run without CMD59 CRC mode\n"
+	       "  -m, --mkfs           format even if a file system is found\n"
+	       "  -r, --read-ahead N   sectors per read-ahead buffer of drive 0:, 0 for none (8)\n"
+	       "  -c, --cache N        write-back cache lines of drive 0:, 0 for none (16)\n"
+	       "      --fault-crc N    corrupt every Nth data block on the wire\n"
+	       "      --fault-drop N   leave every Nth command unanswered\n"
+	       "      --fault-stall N  every Nth programmed block stalls\n"
+	       "      --stall-ms MS    length of a stall (300)\n",
+	       name);
+}
+
+int main(int argc, char* argv[])
+{
+	const char* image = "sd.img";
+	uint32_t size_mb  = 64;
+	bool crc          = true;
+	bool mkfs         = false;
+	const char* back  = "sd";
+	uint32_t ra_len   = 8;
+	uint32_t lines    = 16;
+	Sim::Faults_t faults;
+
+	enum { FAULT_CRC = 0x100, FAULT_DROP, FAULT_STALL, STALL_MS };
+
+	static const option opts[] = {
+	    {"image", required_argument, nullptr, 'i'},
+	    {"backend", required_argument, nullptr, 'b'},
+	    {"size", required_argument, nullptr, 's'},
+	    {"no-crc", no_argument, nullptr, 'n'},
+	    {"mkfs", no_argument, nullptr, 'm'},
+	    {"read-ahead", required_argument, nullptr, 'r'},
+	    {"cache", required_argument, nullptr, 'c'},
+	    {"fault-crc", required_argument, nullptr, FAULT_CRC},
+	    {"fault-drop", required_argument, nullptr, FAULT_DROP},
+	    {"fault-stall", required_argument, nullptr, FAULT_STALL},
+	    {"stall-ms", required_argument, nullptr, STALL_MS},
+	    {"help", no_argument, nullptr, 'h'},
+	    {},
+	};
+
+	for (int c; (c = getopt_long(argc, argv, "i:b:s:nmr:c:h", opts, nullptr)) != -1;) {
+		switch (c) {
+			case 'i': image = optarg; break;
+			case 'b': back = optarg; break;
+			case 's': size_mb = atoi(optarg); break;
+			case 'n': crc = false; break;
+			case 'm': mkfs = true; break;
+			case 'r': ra_len = atoi(optarg); break;
+			case 'c': lines = atoi(optarg); break;
+			case FAULT_CRC: faults.crc = atoi(optarg); break;
+			case FAULT_DROP: faults.timeout = atoi(optarg); break;
+			case FAULT_STALL: faults.stall = atoi(optarg); break;
+			case STALL_MS: faults.stall_us = atoi(optarg) * 1000; break;
+			default: usage(argv[0]); return c == 'h' ? 0 : 2;
+		}
+	}
+
+	FILE* img = fopen(image, "r+b");
+	if (!img) {
+		img = fopen(image, "w+b");
+		if (!img || fseek(img, (long) size_mb * 1024 * 1024 - 1, SEEK_SET) || fputc(0, img) == EOF) {
+			perror(image);
+			return 1;
+		}
+		mkfs = true;
+	}
+	fseek(img, 0, SEEK_END);
+	const uint32_t sectors = ftell(img) / BLOCK_SIZE;
+
+	Sim::SdCard_t card {img, sectors};
+	Sim::bus.card = &card;
+
+	sd.crc_mode = crc;
+	sd.attach_os(MOS::User::Global::sd_os);
+
+	// Backends of drive "0:", all on the same image
+	Sim::FileDisk_t file_disk {img, sectors};
+	RamDisk_t ram_img {calloc(sectors, BLOCK_SIZE), sectors * BLOCK_SIZE};
+	if (!strcmp(back, "ram")) {
+		fseek(img, 0, SEEK_SET);
+		if (fread(ram_img.buf, BLOCK_SIZE, sectors, img) != sectors) mkfs = true;
+	}
+
+	// TRIMs split as on the board, timed in virtual time
+	BlkDev_t::attach_os(blk_os);
+	BlkDev_t sd_blk {"sd", Driver::Device::sd_blk_ops, &sd};
+	sd_blk.split_trim(SD_t::ERASE_AU_BLOCKS, _FS_TIMEOUT - (SD_t::BUSY_TIMEOUT + SD_t::ERASE_AU_MS));
+	BlkDev_t file_blk {"file", Sim::file_disk_ops, &file_disk};
+	BlkDev_t ram_img_blk {"ram", Driver::Device::ram_disk_ops, &ram_img};
+
+	if (!strcmp(back, "sd")) {
+		disk_attach(0, &sd_blk);
+	}
+	else if (!strcmp(back, "file")) {
+		disk_attach(0, &file_blk);
+		virt = false;
+	}
+	else if (!strcmp(back, "ram")) {
+		disk_attach(0, &ram_img_blk);
+		virt = false;
+	}
+	else {
+		usage(argv[0]);
+		return 2;
+	}
+
+	// No worker here, fills run inline: what shows is the saving in commands
+	static uint8_t ra_buf[ReadAhead_t::SLOTS * 128 * BLOCK_SIZE];
+	ReadAhead_t ra {ra_buf, ReadAhead_t::SLOTS * (ra_len < 128 ? ra_len : 128) * BLOCK_SIZE};
+	if (ra.len) disk_device(0)->attach_read_ahead(ra);
+
+	// Nothing flushes on a timer here, FatFs' CTRL_SYNC does it
+	static Cache_t::Line_t cache_line[256];
+	static uint8_t cache_buf[256 * BLOCK_SIZE];
+	Cache_t cache {cache_line, cache_buf, lines < 256 ? lines : 256};
+	if (cache.n) disk_device(0)->attach_cache(cache);
+
+	// Scratch RAM disk, as on the board
+	static uint8_t ram_disk_buf[128 * RamDisk_t::SECTOR_SIZE];
+	RamDisk_t ram_disk {ram_disk_buf, sizeof(ram_disk_buf)};
+	BlkDev_t ram_blk {"ram", Driver::Device::ram_disk_ops, &ram_disk};
+	disk_attach(1, &ram_blk);
+
+	ff_attach_os(Vol::os);
+
+	static FATFS fs, ram_fs;
+	FRESULT res = f_mount(&fs, "0:", 1);
+	if (res == FR_NO_FILESYSTEM || (res == FR_OK && mkfs)) {
+		printf("formatting %s (%u MB)\n", image, sectors / 2048);
+		res = f_mkfs("0:", 0, 0);
+		if (res == FR_OK) res = f_mount(&fs, "0:", 1);
+	}
+	if (res != FR_OK) {
+		printf("mount failed (%d)\n", res);
+		return 1;
+	}
+
+	f_mount(&ram_fs, "1:", 0);
+	if (f_mkfs("1:", 1, 0) != FR_OK || f_mount(&ram_fs, "1:", 1) != FR_OK) {
+		printf("RAM disk mount failed\n");
+		return 1;
+	}
+
+	if (virt) {
+		printf("card: %llu MB, clk %u Hz, crc %s\n",
+		       (unsigned long long) (sd.info.capacity >> 20), sd.clk, sd.crc_on ? "on" : "off");
+	}
+	else {
+		printf("%s: %u MB, host time\n", back, sectors / 2048);
+	}
+
+	// Faults start after mounting, init and mkfs are not what's being measured
+	card.faults = faults;
+
+	bool ok = bench_raw();
+	ok &= bench_file("0:sim.bin", 1024 * 1024, 512);
+	ok &= bench_file("0:sim.bin", 1024 * 1024, 4096);
+	ok &= bench_file("0:sim.bin", 1024 * 1024, 32768);
+	ok &= bench_contig("0:contig.bin", 1024 * 1024, 64);
+	ok &= bench_log(card, 256);
+	ok &= bench_appender(card, 4096);
+	ok &= bench_seek("0:seek.bin", 4 * 1024 * 1024, 256);
+	ok &= bench_direct("0:direct.bin", 512 * 1024);
+	ok &= bench_tasks();
+
+	const bool sd_virt = virt;
+	virt               = false;
+	ok &= bench_file("1:sim.bin", 32 * 1024, 4096);
+	virt = sd_virt;
+
+	show_stats(card);
+
+	f_mount(nullptr, "0:", 0);
+	f_mount(nullptr, "1:", 0);
+
+	if (!strcmp(back, "ram")) { // keep what the run did
+		fseek(img, 0, SEEK_SET);
+		fwrite(ram_img.buf, BLOCK_SIZE, sectors, img);
+	}
+	free(ram_img.buf);
+	fclose(img);
+
+	printf("%s\n", ok ? "PASS" : "FAIL");
+	return ok ? 0 : 1;
+}
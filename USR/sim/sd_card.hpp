@@ -0,0 +1,492 @@
+#ifndef _SIM_SD_CARD_
+#define _SIM_SD_CARD_
+
+#include <stdio.h>
+#include <string.h>
+#include <deque>
+#include <vector>
+
+#include "../src/drivers/device/crc.hpp"
+
+namespace Sim
+{
+	// Virtual time in ps, advanced by every byte on the bus and by driver sleeps
+	struct Clock_t
+	{
+		uint64_t ps = 0;
+
+		inline uint64_t us() const { return ps / 1'000'000; }
+		inline uint32_t ms() const { return ps / 1'000'000'000; }
+		inline void advance_us(uint64_t us) { ps += us * 1'000'000; }
+	};
+
+	inline Clock_t vtime;
+
+	// Card side timing, in us
+	struct Timing_t
+	{
+		uint32_t access  = 50;  // CMD17/CMD18 -> first data token
+		uint32_t gap     = 5;   // between blocks of CMD18
+		uint32_t prog    = 300; // programming a block of CMD24
+		uint32_t multi   = 120; // programming a block inside CMD25
+		uint32_t erased  = 40;  // a block erased by CMD38 or pre-erased by ACMD23
+		uint32_t stop    = 20;  // CMD12 and the stop token
+		uint32_t erase   = 2000; // CMD38, per 4 MB allocation unit touched
+	};
+
+	// Every Nth event misbehaves, 0 turns a fault off
+	struct Faults_t
+	{
+		uint32_t crc      = 0; // data block corrupted on the wire (both directions)
+		uint32_t timeout  = 0; // command left unanswered
+		uint32_t stall    = 0; // programming takes stall_us instead
+		uint32_t stall_us = 300'000;
+	};
+
+	// SDHC card in SPI mode on top of a disk image
+	//
+	// Commands: CMD0/8/9/10/12/13/16/17/18/24/25/32/33/38/55/58/59, ACMD23/41.
+	// Blocks erased by CMD38 read back as zeros and program fast, the rest
+	// costs the card an internal copy (timing.prog / timing.multi).
+	// Data goes out with a valid CRC16 (unless a fault flips a byte),
+	// CRC7/CRC16 of the host are only checked after CMD59, as on real cards.
+	struct SdCard_t
+	{
+		static constexpr auto BLOCK_SIZE = 512;
+		static constexpr auto AU_BLOCKS  = 8192; // 4 MB
+
+		enum State
+		{
+			IDLE,        // waiting for a command
+			READ_MULT,   // streaming blocks until CMD12
+			WRITE_TOKEN, // CMD24 accepted, waiting for 0xFE
+			WRITE_MULT,  // CMD25 accepted, waiting for 0xFC / 0xFD
+			WRITE_DATA,  // receiving a block
+		};
+
+		FILE* img;
+		uint32_t sectors;
+
+		Timing_t timing;
+		Faults_t faults;
+
+		struct
+		{
+			uint32_t cmds, crc7_errs, timeouts;
+			uint32_t rd_blocks, wr_blocks, wr_rejects;
+			uint32_t pre_erased, stalls, flips;
+			uint32_t erases, erased_blocks, wr_erased; // CMD38s, blocks, writes onto them
+			uint64_t busy_us;
+		} stat = {};
+
+		State state    = IDLE;
+		bool selected  = false;
+		bool idle      = true; // in idle state until ACMD41 completes
+		bool app       = false;
+		bool crc_on    = false;
+		uint32_t polls = 0; // ACMD41 until ready
+
+		uint8_t frame[6];
+		uint32_t frame_len = 0;
+
+		uint8_t block[BLOCK_SIZE + 2];
+		uint32_t block_len = 0;
+		bool multi         = false;
+
+		uint32_t lba       = 0; // next block of the current transfer
+		uint32_t pre_erase = 0; // ACMD23 count left
+		uint32_t erase_start = 0, erase_end = 0;
+		std::vector<bool> erased; // by CMD38, cleared when written
+		uint32_t fault_cnt[3] = {};
+
+		static constexpr uint16_t WAIT = 0x100; // in `out`: 0xFF until data_at
+
+		std::deque<uint16_t> out; // bytes to clock out on MISO
+		uint64_t data_at  = 0;    // next data token not before (ps)
+		uint64_t busy_end = 0;    // MISO low until then (ps)
+
+		SdCard_t(FILE* img, uint32_t sectors)
+		    : img(img), sectors(sectors), erased(sectors) {}
+
+		// Every Nth call returns true
+		inline bool fault(uint32_t idx, uint32_t every)
+		{
+			return every && ++fault_cnt[idx] % every == 0;
+		}
+
+		void select(bool cs_low)
+		{
+			if (selected && !cs_low) { // deselect aborts what's in flight, not programming
+				out.clear();
+				frame_len = 0;
+				state = IDLE;
+			}
+			selected = cs_low;
+		}
+
+		// One byte in each direction
+		uint8_t xfer(uint8_t mosi)
+		{
+			if (!selected) return 0xFF;
+
+			const uint8_t miso = shift_out();
+			shift_in(mosi);
+			return miso;
+		}
+
+		uint8_t shift_out()
+		{
+			const auto now = vtime.ps;
+
+			if (out.empty() && state == READ_MULT && now >= busy_end) {
+				queue_block(timing.gap);
+			}
+
+			if (!out.empty() && out.front() == WAIT) {
+				if (now < data_at) return 0xFF; // still fetching the data
+				out.pop_front();
+			}
+
+			if (!out.empty()) {
+				const auto byte = out.front();
+				out.pop_front();
+				return byte;
+			}
+
+			return (now < busy_end) ? 0x00 : 0xFF;
+		}
+
+		void shift_in(uint8_t mosi)
+		{
+			switch (state) {
+				case WRITE_TOKEN:
+				case WRITE_MULT:
+					if (mosi == (state == WRITE_TOKEN ? 0xFE : 0xFC)) {
+						multi     = (state == WRITE_MULT);
+						state     = WRITE_DATA;
+						block_len = 0;
+					}
+					else if (state == WRITE_MULT && mosi == 0xFD) {
+						state     = IDLE;
+						pre_erase = 0;
+						out.push_back(0xFF); // one byte, then busy
+						busy(timing.stop);
+					}
+					return;
+
+				case WRITE_DATA:
+					block[block_len++] = mosi;
+					if (block_len == sizeof(block)) {
+						recv_block();
+					}
+					return;
+
+				default: // IDLE and READ_MULT parse commands
+					if (frame_len == 0 && (mosi & 0xC0) != 0x40) return;
+					frame[frame_len++] = mosi;
+					if (frame_len == sizeof(frame)) {
+						frame_len = 0;
+						exec();
+					}
+					return;
+			}
+		}
+
+		void busy(uint64_t us)
+		{
+			const auto end = vtime.ps + us * 1'000'000;
+			if (end > busy_end) {
+				stat.busy_us += (end - (busy_end > vtime.ps ? busy_end : vtime.ps)) / 1'000'000;
+				busy_end = end;
+			}
+		}
+
+		void r1(uint8_t res)
+		{
+			out.push_back(0xFF); // Ncr
+			out.push_back(res | (idle ? 0x01 : 0x00));
+		}
+
+		// Token + data + CRC16, available after `delay_us`
+		void queue_data(const uint8_t* data, uint32_t len, uint32_t delay_us, bool count = false)
+		{
+			uint8_t buf[BLOCK_SIZE];
+			memcpy(buf, data, len);
+
+			const auto crc = Driver::Device::CRC::crc16(buf, len);
+			if (count && fault(0, faults.crc)) {
+				stat.flips++;
+				buf[len / 2] ^= 0x10; // flipped on the wire, after the card computed the CRC
+			}
+
+			out.push_back(WAIT);
+			out.push_back(0xFE);
+			out.insert(out.end(), buf, buf + len);
+			out.push_back(crc >> 8);
+			out.push_back(crc & 0xFF);
+
+			data_at = vtime.ps + (uint64_t) delay_us * 1'000'000;
+		}
+
+		bool read_sector(uint32_t sector, uint8_t* buf)
+		{
+			if (sector >= sectors) return false;
+			fseek(img, (long) sector * BLOCK_SIZE, SEEK_SET);
+			if (fread(buf, 1, BLOCK_SIZE, img) != BLOCK_SIZE) memset(buf, 0, BLOCK_SIZE);
+			return true;
+		}
+
+		void queue_block(uint32_t delay_us)
+		{
+			uint8_t buf[BLOCK_SIZE];
+			if (!read_sector(lba, buf)) { // out of range, the host times out
+				state = IDLE;
+				return;
+			}
+			lba++;
+			stat.rd_blocks++;
+			queue_data(buf, BLOCK_SIZE, delay_us, true);
+		}
+
+		void recv_block()
+		{
+			state = multi ? WRITE_MULT : IDLE;
+
+			if (fault(0, faults.crc)) {
+				stat.flips++;
+				block[BLOCK_SIZE / 2] ^= 0x10; // flipped on the wire
+			}
+
+			const uint16_t crc = (block[BLOCK_SIZE] << 8) | block[BLOCK_SIZE + 1];
+			if (crc_on && crc != Driver::Device::CRC::crc16(block, BLOCK_SIZE)) {
+				stat.wr_rejects++;
+				out.push_back(0xEB); // CRC error, the host aborts CMD25 with the stop token
+				return;
+			}
+
+			if (lba >= sectors) {
+				out.push_back(0xED); // write error
+				state = IDLE;
+				return;
+			}
+
+			fseek(img, (long) lba * BLOCK_SIZE, SEEK_SET);
+			fwrite(block, 1, BLOCK_SIZE, img);
+			lba++;
+			stat.wr_blocks++;
+
+			out.push_back(0xE5); // accepted
+
+			uint32_t us = multi ? timing.multi : timing.prog;
+			if (multi && pre_erase) {
+				pre_erase--;
+				stat.pre_erased++;
+				us = timing.erased;
+			}
+			if (erased[lba - 1]) {
+				erased[lba - 1] = false;
+				stat.wr_erased++;
+				us = timing.erased;
+			}
+			if (fault(2, faults.stall)) {
+				stat.stalls++;
+				us = faults.stall_us;
+			}
+			busy(us);
+		}
+
+		// Zeros over the range, busy for each allocation unit it touches
+		void erase()
+		{
+			if (erase_start > erase_end || erase_end >= sectors) {
+				r1(0x10); // ERASE_SEQUENCE_ERROR
+				return;
+			}
+			r1(0x00);
+
+			static const uint8_t zero[BLOCK_SIZE] = {};
+			fseek(img, (long) erase_start * BLOCK_SIZE, SEEK_SET);
+			for (uint32_t b = erase_start; b <= erase_end; b++) {
+				fwrite(zero, 1, BLOCK_SIZE, img);
+				erased[b] = true;
+			}
+
+			stat.erases++;
+			stat.erased_blocks += erase_end - erase_start + 1;
+			busy((uint64_t) timing.erase * (erase_end / AU_BLOCKS - erase_start / AU_BLOCKS + 1));
+		}
+
+		void csd(uint8_t* reg) const
+		{
+			const uint32_t c_size = sectors / 1024 - 1; // 512 KB units
+
+			const uint8_t val[16] = {
+			    0x40, 0x0E, 0x00, 0x32, // CSD v2.0, TAAC, NSAC, TRAN_SPEED = 25 MHz
+			    0x5B, 0x59, 0x00,       // CCC, READ_BL_LEN = 9
+			    (uint8_t) ((c_size >> 16) & 0x3F), (uint8_t) (c_size >> 8), (uint8_t) c_size,
+			    0x7F, 0x80, 0x0A, 0x40, 0x00, 0x00,
+			};
+			memcpy(reg, val, 16);
+			reg[15] = Driver::Device::CRC::crc7(reg, 15);
+		}
+
+		void cid(uint8_t* reg) const
+		{
+			const uint8_t val[16] = {
+			    0x03, 'S', 'D', 'S', 'I', 'M', '0', '1', // MID, OID, PNM
+			    0x10, 0x12, 0x34, 0x56, 0x78,           // PRV, PSN
+			    0x01, 0x8A, 0x00,                       // MDT
+			};
+			memcpy(reg, val, 16);
+			reg[15] = Driver::Device::CRC::crc7(reg, 15);
+		}
+
+		void exec()
+		{
+			const uint8_t cmd  = frame[0] & 0x3F;
+			const uint32_t arg = (frame[1] << 24) | (frame[2] << 16) | (frame[3] << 8) | frame[4];
+
+			const bool is_app = app;
+			app               = false;
+			stat.cmds++;
+
+			if (fault(1, faults.timeout)) {
+				stat.timeouts++;
+				return;
+			}
+
+			// CMD0 and CMD8 are always checked, the rest only in CRC mode
+			if ((crc_on || cmd == 0 || cmd == 8) && Driver::Device::CRC::crc7(frame, 5) != frame[5]) {
+				stat.crc7_errs++;
+				r1(0x08);
+				return;
+			}
+
+			if (state == READ_MULT && cmd != 12) {
+				return; // only CMD12 ends the stream
+			}
+
+			uint8_t reg[16];
+
+			switch (is_app ? cmd | 0x80 : cmd) {
+				case 0: // GO_IDLE_STATE
+					idle   = true;
+					crc_on = false;
+					polls  = 0;
+					state  = IDLE;
+					r1(0x00);
+					break;
+
+				case 8: { // SEND_IF_COND
+					r1(0x00);
+					const uint8_t r7[] = {0x00, 0x00, (uint8_t) ((arg >> 8) & 0x0F), (uint8_t) arg};
+					out.insert(out.end(), r7, r7 + 4);
+					break;
+				}
+
+				case 9: // SEND_CSD
+				case 10: // SEND_CID
+					r1(0x00);
+					cmd == 9 ? csd(reg) : cid(reg);
+					queue_data(reg, 16, timing.access);
+					break;
+
+				case 12: // STOP_TRANSMISSION
+					if (state == READ_MULT) {
+						out.clear();
+						state = IDLE;
+						out.push_back(0xFF); // stuff byte
+					}
+					r1(0x00);
+					busy(timing.stop);
+					break;
+
+				case 13: // SEND_STATUS
+					r1(0x00);
+					out.push_back(0x00);
+					break;
+
+				case 16: // SET_BLOCKLEN, fixed at 512 for SDHC
+					r1(arg == BLOCK_SIZE ? 0x00 : 0x40);
+					break;
+
+				case 17: // READ_SINGLE_BLOCK
+				case 18: // READ_MULT_BLOCK
+					if (arg >= sectors) {
+						r1(0x20); // ADDRESS_ERROR
+						break;
+					}
+					r1(0x00);
+					lba = arg;
+					queue_block(timing.access);
+					if (cmd == 18) state = READ_MULT;
+					break;
+
+				case 24: // WRITE_SINGLE_BLOCK
+				case 25: // WRITE_MULT_BLOCK
+					if (arg >= sectors) {
+						r1(0x20);
+						break;
+					}
+					r1(0x00);
+					lba   = arg;
+					state = (cmd == 24) ? WRITE_TOKEN : WRITE_MULT;
+					if (cmd == 24) pre_erase = 0;
+					break;
+
+				case 32: // ERASE_WR_BLK_START_ADDR
+				case 33: // ERASE_WR_BLK_END_ADDR
+					(cmd == 32 ? erase_start : erase_end) = arg;
+					r1(arg < sectors ? 0x00 : 0x20);
+					break;
+
+				case 38: // ERASE, R1b
+					erase();
+					break;
+
+				case 55: // APP_CMD
+					app = true;
+					r1(0x00);
+					break;
+
+				case 58: { // READ_OCR, powered up + CCS (SDHC)
+					r1(0x00);
+					const uint8_t ocr[] = {(uint8_t) (idle ? 0x40 : 0xC0), 0xFF, 0x80, 0x00};
+					out.insert(out.end(), ocr, ocr + 4);
+					break;
+				}
+
+				case 59: // CRC_ON_OFF
+					crc_on = arg & 1;
+					r1(0x00);
+					break;
+
+				case 0x80 | 23: // ACMD23 SET_WR_BLK_ERASE_COUNT
+					pre_erase = arg & 0x7FFFFF;
+					r1(0x00);
+					break;
+
+				case 0x80 | 41: // ACMD41 SD_SEND_OP_COND
+					if (++polls >= 3) idle = false;
+					r1(0x00);
+					break;
+
+				default:
+					r1(0x04); // ILLEGAL_COMMAND
+					break;
+			}
+		}
+	};
+
+	// SPI5 with CS on PE3, as wired on the board, one card on the bus
+	struct Bus_t
+	{
+		SdCard_t* card = nullptr;
+		uint32_t pclk  = 90'000'000; // PCLK2
+		uint64_t bytes = 0;
+	};
+
+	inline Bus_t bus;
+}
+
+#endif
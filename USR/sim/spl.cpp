@@ -0,0 +1,101 @@
+// Host implementation of the StdPeriph calls the HAL wrappers make,
+// SPI5 frames are clocked through the simulated card and advance virtual time
+
+#include "stm32f4xx.h"
+#include "sd_card.hpp"
+
+SPI_TypeDef sim_spi5;
+GPIO_TypeDef sim_gpioe, sim_gpiof;
+
+using Sim::bus;
+using Sim::vtime;
+
+static constexpr uint16_t CS_PIN = GPIO_Pin_3; // PE3
+
+SimDR_t& SimDR_t::operator=(uint16_t tx)
+{
+	auto spi = (SPI_TypeDef*) ((uintptr_t) this - offsetof(SPI_TypeDef, DR));
+
+	rx = 0xFF;
+	if (!(spi->CR1 & SPI_CR1_SPE)) return *this;
+
+	const uint32_t sck = bus.pclk >> (((spi->CR1 & SPI_CR1_BR) >> 3) + 1);
+	vtime.ps += 8 * 1'000'000'000'000ull / sck;
+	bus.bytes++;
+
+	if (spi == SPI5 && bus.card) {
+		rx = bus.card->xfer(tx);
+	}
+	return *this;
+}
+
+void SPI_Init(SPI_TypeDef* SPIx, SPI_InitTypeDef* cfg)
+{
+	SPIx->CR1 = cfg->SPI_Direction | cfg->SPI_Mode | cfg->SPI_DataSize | cfg->SPI_CPOL |
+	            cfg->SPI_CPHA | cfg->SPI_NSS | cfg->SPI_BaudRatePrescaler | cfg->SPI_FirstBit;
+}
+
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState NewState)
+{
+	SPIx->CR1 = NewState ? (SPIx->CR1 | SPI_CR1_SPE) : (SPIx->CR1 & ~SPI_CR1_SPE);
+}
+
+void SPI_DataSizeConfig(SPI_TypeDef* SPIx, uint16_t SPI_DataSize)
+{
+	SPIx->CR1 = (SPIx->CR1 & ~SPI_CR1_DFF) | SPI_DataSize;
+}
+
+void SPI_I2S_SendData(SPI_TypeDef* SPIx, uint16_t Data) { SPIx->DR = Data; }
+uint16_t SPI_I2S_ReceiveData(SPI_TypeDef* SPIx) { return SPIx->DR; }
+void SPI_I2S_DMACmd(SPI_TypeDef*, uint16_t, FunctionalState) {}
+
+// Frames complete within the DR write: TX empty, RX full, never busy
+FlagStatus SPI_I2S_GetFlagStatus(SPI_TypeDef*, uint16_t SPI_I2S_FLAG)
+{
+	return (SPI_I2S_FLAG & (SPI_I2S_FLAG_TXE | SPI_I2S_FLAG_RXNE)) ? SET : RESET;
+}
+
+void GPIO_Init(GPIO_TypeDef*, GPIO_InitTypeDef*) {}
+void GPIO_PinLockConfig(GPIO_TypeDef*, uint16_t) {}
+void GPIO_PinAFConfig(GPIO_TypeDef*, uint16_t, uint8_t) {}
+
+static void gpio_update(GPIO_TypeDef* GPIOx, uint16_t odr)
+{
+	GPIOx->ODR = odr;
+	GPIOx->IDR = odr;
+	if (GPIOx == GPIOE && bus.card) {
+		bus.card->select(!(odr & CS_PIN));
+	}
+}
+
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) { gpio_update(GPIOx, GPIOx->ODR | GPIO_Pin); }
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) { gpio_update(GPIOx, GPIOx->ODR & ~GPIO_Pin); }
+void GPIO_ToggleBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) { gpio_update(GPIOx, GPIOx->ODR ^ GPIO_Pin); }
+void GPIO_Write(GPIO_TypeDef* GPIOx, uint16_t PortVal) { gpio_update(GPIOx, PortVal); }
+
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal)
+{
+	BitVal ? GPIO_SetBits(GPIOx, GPIO_Pin) : GPIO_ResetBits(GPIOx, GPIO_Pin);
+}
+
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) { return (GPIOx->IDR & GPIO_Pin) != 0; }
+uint16_t GPIO_ReadInputData(GPIO_TypeDef* GPIOx) { return GPIOx->IDR; }
+uint8_t GPIO_ReadOutputDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) { return (GPIOx->ODR & GPIO_Pin) != 0; }
+uint16_t GPIO_ReadOutputData(GPIO_TypeDef* GPIOx) { return GPIOx->ODR; }
+
+// 180 MHz SYSCLK as configured by the board
+void RCC_GetClocksFreq(RCC_ClocksTypeDef* RCC_Clocks)
+{
+	RCC_Clocks->SYSCLK_Frequency = 180'000'000;
+	RCC_Clocks->HCLK_Frequency   = 180'000'000;
+	RCC_Clocks->PCLK1_Frequency  = 45'000'000;
+	RCC_Clocks->PCLK2_Frequency  = bus.pclk;
+}
+
+void RCC_AHB1PeriphClockCmd(uint32_t, FunctionalState) {}
+void RCC_APB2PeriphClockCmd(uint32_t, FunctionalState) {}
+
+// SD_t runs polled here, DMA is never attached
+void DMA_Cmd(DMA_Stream_TypeDef*, FunctionalState) {}
+FunctionalState DMA_GetCmdStatus(DMA_Stream_TypeDef*) { return DISABLE; }
+void DMA_ITConfig(DMA_Stream_TypeDef*, uint32_t, FunctionalState) {}
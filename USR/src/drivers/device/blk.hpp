@@ -0,0 +1,722 @@
+#ifndef _DEVICE_BLK_
+#define _DEVICE_BLK_
+
+#include <stdint.h>
+#include <string.h>
+
+namespace Driver::Device
+{
+	struct ReadAhead_t;
+	struct Cache_t;
+
+	// Block device behind a FatFs physical drive: a table of functions on a
+	// backend object, 512 B sectors, stats for the 'blk' command
+	struct BlkDev_t
+	{
+		// Same values as DRESULT, diskio.cpp passes them through
+		enum Res : uint8_t
+		{
+			OK = 0,
+			ERROR,
+			WRPRT,
+			NOTRDY,
+			PARERR,
+		};
+
+		// Same values as the FatFs ioctl codes
+		enum Ctrl : uint8_t
+		{
+			SYNC = 0,     // flush what the backend holds back
+			SECTOR_COUNT, // arg[0] <- sectors
+			SECTOR_SIZE,  // arg[0] <- bytes
+			BLOCK_SIZE,   // arg[0] <- erase block in sectors
+			TRIM,         // arg[0..1]: first and last sector no longer in use
+		};
+
+		static constexpr auto SECTOR_SIZE_MAX = 512;
+
+		struct Ops_t
+		{
+			using Ctx_t = void*;
+
+			Res (*init)(Ctx_t ctx);
+			Res (*read)(Ctx_t ctx, uint8_t* buf, uint32_t sector, uint32_t count);
+			Res (*write)(Ctx_t ctx, const uint8_t* buf, uint32_t sector, uint32_t count);
+			Res (*ioctl)(Ctx_t ctx, Ctrl cmd, uint32_t* arg);
+		};
+
+		// One read/write/sync, run now or handed to a worker by `submit`
+		struct Req_t
+		{
+			enum Op : uint8_t
+			{
+				READ,
+				WRITE,
+				FLUSH,
+				FILL, // read-ahead of the slot in `arg`
+			};
+
+			using Done_t = void (*)(Req_t& req);
+
+			BlkDev_t* dev;
+			Op op;
+			uint8_t* buf;
+			uint32_t sector, count;
+			Done_t done; // called by whoever ran the request, may be nullptr
+			void* arg;
+			Res res;
+		};
+
+		// Kernel hooks, all optional: the request queue of the async worker, and
+		// a ms clock to date the oldest line held back by the cache
+		struct Os_t
+		{
+			using Submit_t = bool (*)(Req_t& req); // false if the queue is full
+			using Now_t    = uint32_t (*)();
+
+			Submit_t submit;
+			Now_t now;
+		};
+
+		// Lock of the bus behind one device, taken by sync callers and the
+		// worker alike. Devices on other buses, or on none like a RAM disk
+		// (FatFs' volume lock is enough there), never wait for it
+		struct Lock_t
+		{
+			using Fn_t = void (*)();
+
+			Fn_t take, give;
+		};
+
+		static inline const Os_t* os = nullptr;
+
+		const char* name;
+		const Ops_t& ops;
+		void* ctx;
+
+		const Lock_t* lock = nullptr; // unlocked until attached
+
+		ReadAhead_t* ra = nullptr; // sequential reads are prefetched once attached
+		Cache_t* cache  = nullptr; // single sector writes are held back once attached
+
+		// TRIM in pieces of `trim_unit` sectors on its boundaries, the lock is
+		// given back between them. No piece starts once `trim_ms` have passed:
+		// a range left untrimmed only costs speed, the FatFs volume lock held
+		// through all of them makes other tasks time out. 0: no split, no limit
+		uint32_t trim_unit = 0;
+		uint32_t trim_ms   = 0;
+
+		struct
+		{
+			uint32_t rd_ops, rd_sectors;
+			uint32_t wr_ops, wr_sectors;
+			uint32_t syncs, errors;
+			uint32_t trims;    // ranges FatFs freed
+			uint32_t trim_cut; // of them, left partly untrimmed by trim_ms
+			uint32_t async; // requests that went through the worker
+		} stat = {};
+
+		BlkDev_t(const char* name, const Ops_t& ops, void* ctx)
+		    : name(name), ops(ops), ctx(ctx) {}
+
+		static inline void
+		attach_os(const Os_t& os) { BlkDev_t::os = &os; }
+
+		inline auto&
+		attach_lock(const Lock_t& lock)
+		{
+			this->lock = &lock;
+			return *this;
+		}
+
+		inline auto&
+		split_trim(uint32_t unit, uint32_t ms)
+		{
+			trim_unit = unit;
+			trim_ms   = ms;
+			return *this;
+		}
+
+		inline auto&
+		attach_read_ahead(ReadAhead_t& ra)
+		{
+			this->ra = &ra;
+			return *this;
+		}
+
+		inline auto&
+		attach_cache(Cache_t& cache)
+		{
+			this->cache = &cache;
+			return *this;
+		}
+
+		// Runs `fn` under the device lock and counts its failure
+		inline Res guard(auto&& fn)
+		{
+			if (lock) lock->take();
+			const Res res = fn();
+			if (lock) lock->give();
+
+			if (res != OK) stat.errors++;
+			return res;
+		}
+
+		inline Res init();
+		inline Res ra_read(uint8_t* buf, uint32_t sector, uint32_t count);
+		inline Res ra_fill(uint32_t idx);
+		inline void ra_drop(uint32_t sector, uint32_t count);
+		inline bool cache_read(uint8_t* buf, uint32_t sector, uint32_t count);
+		inline void cache_fill(uint8_t* buf, uint32_t sector, uint32_t count);
+		inline Res cache_write(const uint8_t* buf, uint32_t sector, uint32_t count);
+		inline Res cache_flush();
+		inline void cache_drop(uint32_t sector, uint32_t count);
+
+		inline Res read(uint8_t* buf, uint32_t sector, uint32_t count)
+		{
+			stat.rd_ops += 1;
+			stat.rd_sectors += count;
+
+			if (cache && cache_read(buf, sector, count)) return OK;
+
+			const Res res = ra ? ra_read(buf, sector, count)
+			                   : guard([&] { return ops.read(ctx, buf, sector, count); });
+
+			if (res == OK && cache) cache_fill(buf, sector, count);
+			return res;
+		}
+
+		inline Res write(const uint8_t* buf, uint32_t sector, uint32_t count)
+		{
+			stat.wr_ops += 1;
+			stat.wr_sectors += count;
+			return guard([&] {
+				if (cache) return cache_write(buf, sector, count);
+				ra_drop(sector, count);
+				return ops.write(ctx, buf, sector, count);
+			});
+		}
+
+		inline Res ioctl(Ctrl cmd, uint32_t* arg)
+		{
+			if (cmd == TRIM) return trim(arg[0], arg[1]);
+			if (cmd == SYNC) stat.syncs++;
+			return guard([&] {
+				if (cmd == SYNC && cache) {
+					if (const Res res = cache_flush(); res != OK) return res;
+				}
+				return ops.ioctl(ctx, cmd, arg);
+			});
+		}
+
+		// Sectors `first` to `last` are free, see trim_unit and trim_ms
+		inline Res trim(uint32_t first, uint32_t last)
+		{
+			stat.trims++;
+			guard([&] { // nothing held for them is worth keeping
+				ra_drop(first, last - first + 1);
+				cache_drop(first, last - first + 1);
+				return OK;
+			});
+
+			const bool timed  = trim_ms && os && os->now;
+			const uint32_t t0 = timed ? os->now() : 0;
+
+			Res res = OK;
+			for (uint32_t s = first; res == OK;) {
+				uint32_t range[2] = {s, last};
+				if (trim_unit && last - s >= trim_unit - s % trim_unit) {
+					range[1] = s + (trim_unit - s % trim_unit) - 1;
+				}
+
+				res = guard([&] { return ops.ioctl(ctx, TRIM, range); });
+				if (range[1] == last) break;
+
+				s = range[1] + 1;
+				if (timed && os->now() - t0 >= trim_ms) {
+					stat.trim_cut++;
+					break;
+				}
+			}
+			return res;
+		}
+
+		// Write back what the cache holds, without a backend SYNC
+		inline Res flush()
+		{
+			return guard([&] { return cache ? cache_flush() : OK; });
+		}
+
+		inline uint32_t sectors()
+		{
+			uint32_t n = 0;
+			return ioctl(SECTOR_COUNT, &n) == OK ? n : 0;
+		}
+
+		// Run a request in the calling task and complete it
+		static Res exec(Req_t& req)
+		{
+			auto& dev = *req.dev;
+
+			switch (req.op) {
+				case Req_t::READ:
+					req.res = dev.read(req.buf, req.sector, req.count);
+					break;
+				case Req_t::WRITE:
+					req.res = dev.write(req.buf, req.sector, req.count);
+					break;
+				case Req_t::FLUSH:
+					req.res = dev.ioctl(SYNC, nullptr);
+					break;
+				case Req_t::FILL:
+					req.res = dev.ra_fill((uintptr_t) req.arg);
+					break;
+				default:
+					req.res = PARERR;
+					break;
+			}
+
+			if (req.done) req.done(req);
+			return req.res;
+		}
+
+		// Hand a request to the worker, or run it right here without one.
+		// `req` and its buffer must stay alive until `done`
+		inline Res submit(Req_t& req)
+		{
+			req.dev = this;
+			if (os && os->submit && os->submit(req)) {
+				stat.async++;
+				return OK;
+			}
+			return exec(req);
+		}
+	};
+
+	// Sequential read-ahead, two buffers: while one serves reads, the run after
+	// it is read into the other by the worker (or right away without one)
+	struct ReadAhead_t
+	{
+		static constexpr auto SLOTS = 2;
+		static constexpr auto SECTOR_SIZE = 512;
+
+		enum State : uint8_t
+		{
+			EMPTY,
+			QUEUED, // fill submitted, not run yet
+			DONE,
+		};
+
+		struct Slot_t
+		{
+			uint8_t* buf;
+			uint32_t start, count;
+			State state;
+			bool used; // served a read since the fill
+
+			inline bool covers(uint32_t sector, uint32_t n) const
+			{
+				return sector >= start && sector - start + n <= count;
+			}
+
+			inline bool overlaps(uint32_t sector, uint32_t n) const
+			{
+				return sector < start + count && start < sector + n;
+			}
+		};
+
+		Slot_t slot[SLOTS];
+		BlkDev_t::Req_t req[SLOTS];
+		uint32_t len;      // sectors per slot
+		uint32_t next = 0; // where a sequential read starts
+
+		struct
+		{
+			uint32_t hits, misses;
+			uint32_t fills, late; // late: the reader got there before the worker
+			uint32_t wasted;      // fills dropped without serving a read
+		} stat = {};
+
+		// `buf` is split between the slots, keep it DMA reachable
+		ReadAhead_t(void* buf, uint32_t size)
+		    : len(size / SLOTS / SECTOR_SIZE)
+		{
+			for (uint32_t i = 0; i < SLOTS; i++) {
+				slot[i] = {(uint8_t*) buf + i * len * SECTOR_SIZE, 0, 0, EMPTY, false};
+			}
+		}
+
+		inline Slot_t* find(uint32_t sector, uint32_t n)
+		{
+			for (auto& s: slot) {
+				if (s.state == DONE && s.covers(sector, n)) return &s;
+			}
+			return nullptr;
+		}
+
+		inline bool pending(uint32_t start) const
+		{
+			for (auto& s: slot) {
+				if (s.state != EMPTY && s.start == start) return true;
+			}
+			return false;
+		}
+
+		inline void reset()
+		{
+			for (auto& s: slot) s.state = EMPTY;
+		}
+	};
+
+	// Write-back LRU cache of single sectors: FatFs moves its window between
+	// FAT, directory and partial data sectors one sector at a time, rewrites of
+	// the same sector meet here and go out once on SYNC, `flush` or eviction
+	struct Cache_t
+	{
+		static constexpr auto SECTOR_SIZE = 512;
+
+		struct Line_t
+		{
+			uint32_t sector;
+			uint32_t used; // LRU stamp
+			bool valid, dirty;
+		};
+
+		Line_t* line;
+		uint8_t* data; // `n` sectors, DMA reachable for the write back
+		uint32_t n;
+		uint32_t tick  = 0;
+		uint32_t since = 0; // Os_t::now() when the first of the dirty lines came
+
+		struct
+		{
+			uint32_t hits, misses;  // single sector reads
+			uint32_t absorbed;      // single sector writes taken in
+			uint32_t write_backs;   // sectors sent to the backend
+			uint32_t dirty;         // lines waiting for a write back
+		} stat = {};
+
+		Cache_t(Line_t* line, void* data, uint32_t n)
+		    : line(line), data((uint8_t*) data), n(n)
+		{
+			reset();
+		}
+
+		inline uint8_t* at(const Line_t& l) const
+		{
+			return data + (&l - line) * SECTOR_SIZE;
+		}
+
+		inline Line_t* find(uint32_t sector)
+		{
+			for (uint32_t i = 0; i < n; i++) {
+				auto& l = line[i];
+				if (l.valid && l.sector == sector) {
+					l.used = ++tick;
+					return &l;
+				}
+			}
+			return nullptr;
+		}
+
+		// An unused line, or the least recently used one
+		inline Line_t& victim()
+		{
+			Line_t* v = &line[0];
+			for (uint32_t i = 0; i < n; i++) {
+				auto& l = line[i];
+				if (!l.valid) return l;
+				if (l.used < v->used) v = &l;
+			}
+			return *v;
+		}
+
+		inline void reset()
+		{
+			for (uint32_t i = 0; i < n; i++) line[i] = {};
+			stat.dirty = 0;
+		}
+	};
+
+	inline BlkDev_t::Res BlkDev_t::init()
+	{
+		return guard([&] {
+			// May be another card, what was held back is dropped
+			if (ra) ra->reset();
+			if (cache) cache->reset();
+			return ops.init(ctx);
+		});
+	}
+
+	// Single sector hit, served without the backend
+	inline bool BlkDev_t::cache_read(uint8_t* buf, uint32_t sector, uint32_t count)
+	{
+		if (count != 1) return false;
+
+		bool hit = false;
+		guard([&] {
+			if (auto l = cache->find(sector)) {
+				memcpy(buf, cache->at(*l), Cache_t::SECTOR_SIZE);
+				cache->stat.hits++;
+				hit = true;
+			}
+			else {
+				cache->stat.misses++;
+			}
+			return OK;
+		});
+		return hit;
+	}
+
+	// Caller holds the lock
+	inline BlkDev_t::Res BlkDev_t::cache_flush()
+	{
+		while (cache->stat.dirty) {
+			// In sector order, the card sees the runs it would have seen
+			Cache_t::Line_t* first = nullptr;
+			for (uint32_t i = 0; i < cache->n; i++) {
+				auto& l = cache->line[i];
+				if (l.valid && l.dirty && (!first || l.sector < first->sector)) first = &l;
+			}
+
+			const Res res = ops.write(ctx, cache->at(*first), first->sector, 1);
+			if (res != OK) return res;
+
+			ra_drop(first->sector, 1);
+			first->dirty = false;
+			cache->stat.dirty--;
+			cache->stat.write_backs++;
+		}
+		return OK;
+	}
+
+	// Caller holds the lock. A free line, written back first if dirty
+	static inline Cache_t::Line_t* cache_take(BlkDev_t& dev, uint32_t sector)
+	{
+		auto& cache = *dev.cache;
+		auto& l     = cache.victim();
+
+		if (l.valid && l.dirty) {
+			if (dev.ops.write(dev.ctx, cache.at(l), l.sector, 1) != BlkDev_t::OK) return nullptr;
+			dev.ra_drop(l.sector, 1);
+			cache.stat.dirty--;
+			cache.stat.write_backs++;
+		}
+
+		l = {sector, ++cache.tick, true, false};
+		return &l;
+	}
+
+	// Newer data held back wins over what the backend returned, single
+	// sectors are kept for the next time
+	inline void BlkDev_t::cache_fill(uint8_t* buf, uint32_t sector, uint32_t count)
+	{
+		guard([&] {
+			for (uint32_t i = 0; i < cache->n; i++) {
+				auto& l = cache->line[i];
+				if (l.valid && l.dirty && l.sector - sector < count) {
+					memcpy(buf + (l.sector - sector) * Cache_t::SECTOR_SIZE, cache->at(l), Cache_t::SECTOR_SIZE);
+				}
+			}
+
+			if (count == 1 && !cache->find(sector)) {
+				if (auto l = cache_take(*this, sector)) {
+					memcpy(cache->at(*l), buf, Cache_t::SECTOR_SIZE);
+				}
+			}
+			return OK;
+		});
+	}
+
+	// Caller holds the lock
+	inline void BlkDev_t::cache_drop(uint32_t sector, uint32_t count)
+	{
+		if (!cache) return;
+		for (uint32_t i = 0; i < cache->n; i++) {
+			auto& l = cache->line[i];
+			if (!l.valid || l.sector - sector >= count) continue;
+			if (l.dirty) cache->stat.dirty--;
+			l = {};
+		}
+	}
+
+	// Caller holds the lock
+	inline BlkDev_t::Res BlkDev_t::cache_write(const uint8_t* buf, uint32_t sector, uint32_t count)
+	{
+		if (count == 1) {
+			auto l = cache->find(sector);
+			if (!l && !(l = cache_take(*this, sector))) return ERROR;
+
+			memcpy(cache->at(*l), buf, Cache_t::SECTOR_SIZE);
+			if (!l->dirty) {
+				if (!cache->stat.dirty && os && os->now) cache->since = os->now();
+				l->dirty = true;
+				cache->stat.dirty++;
+			}
+			cache->stat.absorbed++;
+			return OK;
+		}
+
+		// Runs go straight through, lines inside take the new data
+		ra_drop(sector, count);
+		const Res res = ops.write(ctx, buf, sector, count);
+		if (res != OK) return res;
+
+		for (uint32_t i = 0; i < cache->n; i++) {
+			auto& l = cache->line[i];
+			if (!l.valid || l.sector - sector >= count) continue;
+
+			memcpy(cache->at(l), buf + (l.sector - sector) * Cache_t::SECTOR_SIZE, Cache_t::SECTOR_SIZE);
+			if (l.dirty) {
+				l.dirty = false;
+				cache->stat.dirty--;
+			}
+		}
+		return OK;
+	}
+
+	// Caller holds the lock
+	inline void BlkDev_t::ra_drop(uint32_t sector, uint32_t count)
+	{
+		if (!ra) return;
+		for (auto& s: ra->slot) {
+			if (s.state != ReadAhead_t::EMPTY && s.overlaps(sector, count)) s.state = ReadAhead_t::EMPTY;
+		}
+	}
+
+	// Runs a queued fill, skipped if the reader or a write got there first
+	inline BlkDev_t::Res BlkDev_t::ra_fill(uint32_t idx)
+	{
+		return guard([&] {
+			auto& s = ra->slot[idx];
+			if (s.state != ReadAhead_t::QUEUED) return OK;
+
+			const Res res = ops.read(ctx, s.buf, s.start, s.count);
+			s.state       = (res == OK) ? ReadAhead_t::DONE : ReadAhead_t::EMPTY;
+			ra->stat.fills++;
+			return res;
+		});
+	}
+
+	inline BlkDev_t::Res BlkDev_t::ra_read(uint8_t* buf, uint32_t sector, uint32_t count)
+	{
+		using Slot_t = ReadAhead_t::Slot_t;
+
+		int32_t fill = -1;
+
+		const Res res = guard([&] {
+			auto& ra = *this->ra;
+
+			// A fill of these sectors is still in the queue, do it now
+			for (auto& s: ra.slot) {
+				if (s.state == ReadAhead_t::QUEUED && s.overlaps(sector, count)) {
+					s.state = (ops.read(ctx, s.buf, s.start, s.count) == OK) ? ReadAhead_t::DONE : ReadAhead_t::EMPTY;
+					ra.stat.fills++;
+					ra.stat.late++;
+				}
+			}
+
+			Res res      = OK;
+			Slot_t* hit  = ra.find(sector, count);
+			Slot_t* head = hit ? nullptr : ra.find(sector, 1);
+			if (hit) {
+				memcpy(buf, hit->buf + (sector - hit->start) * ReadAhead_t::SECTOR_SIZE, count * ReadAhead_t::SECTOR_SIZE);
+				hit->used = true;
+				ra.stat.hits++;
+			}
+			else if (head) { // a longer read starting in a slot: its sectors, then the rest
+				const uint32_t n = head->start + head->count - sector;
+				memcpy(buf, head->buf + (sector - head->start) * ReadAhead_t::SECTOR_SIZE, n * ReadAhead_t::SECTOR_SIZE);
+				head->used = true;
+				res        = ops.read(ctx, buf + n * ReadAhead_t::SECTOR_SIZE, sector + n, count - n);
+				ra.stat.hits++;
+			}
+			else {
+				res = ops.read(ctx, buf, sector, count);
+				ra.stat.misses++;
+			}
+
+			const bool seq = hit || head || sector == ra.next;
+			ra.next        = sector + count;
+			if (res != OK || !seq) return res;
+
+			// Keep the run after the slot being served (or after this read) coming
+			const uint32_t target = hit ? hit->start + hit->count : sector + count;
+			uint32_t total        = 0;
+			if (ra.pending(target) || ops.ioctl(ctx, SECTOR_COUNT, &total) != OK || target >= total) {
+				return res;
+			}
+
+			for (uint32_t i = 0; i < ReadAhead_t::SLOTS; i++) {
+				auto& s = ra.slot[i];
+				if (&s == hit || s.state == ReadAhead_t::QUEUED) continue;
+				if (s.state == ReadAhead_t::DONE && !s.used) ra.stat.wasted++;
+
+				s.start = target;
+				s.count = (total - target < ra.len) ? total - target : ra.len;
+				s.state = ReadAhead_t::QUEUED;
+				s.used  = false;
+				fill    = i;
+				break;
+			}
+			return res;
+		});
+
+		// Outside the lock, the worker needs it
+		if (fill >= 0) {
+			auto& req = ra->req[fill];
+			req       = {.op = Req_t::FILL, .arg = (void*) (uintptr_t) fill};
+			submit(req);
+		}
+		return res;
+	}
+
+	// RAM disk: sectors in SRAM or CCMRAM, accessed by the CPU only
+	struct RamDisk_t
+	{
+		static constexpr auto SECTOR_SIZE = 512;
+
+		uint8_t* buf;
+		uint32_t sectors;
+
+		RamDisk_t(void* buf, uint32_t size)
+		    : buf((uint8_t*) buf), sectors(size / SECTOR_SIZE) {}
+
+		inline bool in_range(uint32_t sector, uint32_t count) const
+		{
+			return sector < sectors && count <= sectors - sector;
+		}
+	};
+
+	inline constexpr BlkDev_t::Ops_t ram_disk_ops {
+	    .init = [](void*) { return BlkDev_t::OK; },
+
+	    .read = [](void* ctx, uint8_t* buf, uint32_t sector, uint32_t count) {
+		    auto& ram = *(RamDisk_t*) ctx;
+		    if (!ram.in_range(sector, count)) return BlkDev_t::PARERR;
+		    memcpy(buf, ram.buf + sector * RamDisk_t::SECTOR_SIZE, count * RamDisk_t::SECTOR_SIZE);
+		    return BlkDev_t::OK;
+	    },
+
+	    .write = [](void* ctx, const uint8_t* buf, uint32_t sector, uint32_t count) {
+		    auto& ram = *(RamDisk_t*) ctx;
+		    if (!ram.in_range(sector, count)) return BlkDev_t::PARERR;
+		    memcpy(ram.buf + sector * RamDisk_t::SECTOR_SIZE, buf, count * RamDisk_t::SECTOR_SIZE);
+		    return BlkDev_t::OK;
+	    },
+
+	    .ioctl = [](void* ctx, BlkDev_t::Ctrl cmd, uint32_t* arg) {
+		    auto& ram = *(RamDisk_t*) ctx;
+		    switch (cmd) {
+			    case BlkDev_t::SYNC: return BlkDev_t::OK;
+			    case BlkDev_t::SECTOR_COUNT: *arg = ram.sectors; return BlkDev_t::OK;
+			    case BlkDev_t::SECTOR_SIZE: *arg = RamDisk_t::SECTOR_SIZE; return BlkDev_t::OK;
+			    case BlkDev_t::BLOCK_SIZE: *arg = 1; return BlkDev_t::OK;
+			    case BlkDev_t::TRIM: return BlkDev_t::OK; // nothing to give back
+			    default: return BlkDev_t::PARERR;
+		    }
+	    },
+	};
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef _DEVICE_CRC_
+#define _DEVICE_CRC_
+
+#include <stdint.h>
+
+// Table-driven CRCs of the SD protocol, tables are built at compile time
+namespace Driver::Device::CRC
+{
+	// CRC7, x^7 + x^3 + 1, kept left-aligned in a byte (crc7 << 1) so one lookup eats one byte
+	inline constexpr struct Crc7Table_t
+	{
+		uint8_t val[256];
+
+		constexpr Crc7Table_t(): val()
+		{
+			for (uint32_t i = 0; i < 256; i++) {
+				uint8_t crc = i;
+				for (uint32_t bit = 0; bit < 8; bit++) {
+					crc = (crc & 0x80) ? (crc << 1) ^ (0x09 << 1) : (crc << 1);
+				}
+				val[i] = crc;
+			}
+		}
+	} crc7_table;
+
+	// CRC16-CCITT, x^16 + x^12 + x^5 + 1, initial value 0 (XMODEM)
+	inline constexpr struct Crc16Table_t
+	{
+		uint16_t val[256];
+
+		constexpr Crc16Table_t(): val()
+		{
+			for (uint32_t i = 0; i < 256; i++) {
+				uint16_t crc = i << 8;
+				for (uint32_t bit = 0; bit < 8; bit++) {
+					crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+				}
+				val[i] = crc;
+			}
+		}
+	} crc16_table;
+
+	// Command frame CRC byte: crc7 in bits 7:1, end bit 1
+	inline constexpr uint8_t
+	crc7(const uint8_t* data, uint32_t len)
+	{
+		uint8_t crc = 0;
+		while (len--) {
+			crc = crc7_table.val[crc ^ *data++];
+		}
+		return crc | 0x01;
+	}
+
+	inline uint16_t
+	crc16(const uint8_t* data, uint32_t len)
+	{
+		uint16_t crc = 0;
+
+		// 4 bytes per round, the data block is always a multiple of 4
+		for (; len >= 4; len -= 4, data += 4) {
+			crc = (crc << 8) ^ crc16_table.val[(crc >> 8) ^ data[0]];
+			crc = (crc << 8) ^ crc16_table.val[(crc >> 8) ^ data[1]];
+			crc = (crc << 8) ^ crc16_table.val[(crc >> 8) ^ data[2]];
+			crc = (crc << 8) ^ crc16_table.val[(crc >> 8) ^ data[3]];
+		}
+		while (len--) {
+			crc = (crc << 8) ^ crc16_table.val[(crc >> 8) ^ *data++];
+		}
+		return crc;
+	}
+}
+
+#endif
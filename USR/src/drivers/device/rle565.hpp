@@ -0,0 +1,52 @@
+#ifndef _DEVICE_RLE565_
+#define _DEVICE_RLE565_
+
+#include <stdint.h>
+
+namespace Driver::Device
+{
+	// Palette + run-length coded RGB565 image, generated by tools/gif_rle.py
+	//
+	// Every row is coded on its own, so any row can be decoded without
+	// touching the rows above it. A row is a sequence of ops:
+	//   0x00 ~ 0x7F: literal, (op + 1) palette indices follow
+	//   0x80 ~ 0xFF: run, one palette index follows, repeated (op - 0x7F) times
+	struct Rle565_t
+	{
+		using Pixel_t = uint16_t;
+
+		uint16_t w, h;
+		const Pixel_t* palette; // 调色板, 至多256色
+		const uint16_t* rows;   // 每行在code中的偏移
+		const uint8_t* code;
+
+		// Decode the first n pixels of row y into line
+		inline void decode_row(uint16_t y, Pixel_t* line, uint16_t n) const
+		{
+			auto src = &code[rows[y]];
+
+			for (uint16_t x = 0; x < n;) {
+				const uint8_t op = *src++;
+
+				if (op & 0x80) { // run
+					const auto px = palette[*src++];
+					for (uint16_t k = op - 0x7F; k && x < n; k--) {
+						line[x++] = px;
+					}
+				}
+				else { // literal
+					for (uint16_t k = op + 1; k && x < n; k--) {
+						line[x++] = palette[*src++];
+					}
+				}
+			}
+		}
+
+		inline void decode_row(uint16_t y, Pixel_t* line) const
+		{
+			decode_row(y, line, w);
+		}
+	};
+}
+
+#endif
@@ -2,11 +2,14 @@
 #define _DEVICE_SD_
 
 #include "../stm32f4xx/spi.hpp"
+#include "crc.hpp"
+#include "blk.hpp"
 
 namespace Driver::Device
 {
 	using HAL::STM32F4xx::SPI_t;
 	using HAL::STM32F4xx::GPIO_t;
+	using HAL::STM32F4xx::DMA_Stream_t;
 
 	struct SD_t
 	{
@@ -107,7 +110,7 @@ namespace Driver::Device
 			START_DATA_SINGLE_BLOCK_READ    = 0xFE, /* Data token start byte, Start Single Block Read */
 			START_DATA_MULTIPLE_BLOCK_READ  = 0xFE, /* Data token start byte, Start Multiple Block Read */
 			START_DATA_SINGLE_BLOCK_WRITE   = 0xFE, /* Data token start byte, Start Single Block Write */
-			START_DATA_MULTIPLE_BLOCK_WRITE = 0xFD, /* Data token start byte, Start Multiple Block Write */
+			START_DATA_MULTIPLE_BLOCK_WRITE = 0xFC, /* Data token start byte, Start Multiple Block Write */
 			STOP_DATA_MULTIPLE_BLOCK_WRITE  = 0xFD, /* Data toke stop byte, Stop Multiple Block Write */
 		};
 
@@ -138,8 +141,11 @@ namespace Driver::Device
 			UNTAG_ERASE_GROUP  = 37, /* CMD37 = 0x65 */
 			ERASE              = 38, /* CMD38 = 0x66 */
 			READ_OCR           = 58, /* CMD58 */
+			CRC_ON_OFF         = 59, /* CMD59 */
 			APP_CMD            = 55, /* CMD55 返回0x01*/
 			SD_SEND_OP_COND    = 41, /* ACMD41  返回0x00*/
+
+			SET_WR_BLK_ERASE_COUNT = 23, /* ACMD23, pre-erase before CMD25 */
 		};
 
 		enum class Type
@@ -177,6 +183,63 @@ namespace Driver::Device
 		Type type = Type::Err;
 		Info info;
 
+		// Block data phases go through DMA once attached, polled otherwise
+		const SPI_t::Dma_t* dma = nullptr;
+
+		// Bus clock: identification runs at <= 400 kHz, data transfer at the
+		// CSD rate capped by the SPI, halved after repeated errors
+		static constexpr uint32_t INIT_CLK    = 400'000;
+		static constexpr uint32_t SPI_MAX_CLK = 45'000'000; // STM32F429 SPI1/4/5/6
+		static constexpr uint32_t ERR_LIMIT   = 3;          // consecutive errors per step down
+
+		uint32_t clk      = 0; // current SCK in Hz
+		uint32_t err_cnt  = 0;
+		uint32_t step_cnt = 0; // step downs so far
+
+		// CMD59 CRC mode: CRC7 on commands, CRC16 on data blocks, failed blocks are retried
+		static constexpr uint32_t RETRY = 3; // attempts per block command
+
+		bool crc_mode      = false; // requested, applied by init
+		bool crc_on        = false; // CRC checking active on the card
+		uint32_t crc_errs  = 0;     // data blocks with a bad CRC16
+		uint32_t retry_cnt = 0;
+		uint32_t dma_errs  = 0;     // data phases stopped by a DMA transfer error
+
+		// Busy wait after writes: ms clock and sleep hooks from the kernel, spins if unset
+		struct Os_t
+		{
+			using Sleep_t = void (*)(uint32_t ms);
+			using Now_t   = uint32_t (*)();
+
+			Sleep_t sleep;
+			Now_t now;
+		};
+
+		static constexpr uint32_t BUSY_SPIN_US = 250; // polled before the first nap
+		static constexpr uint32_t BUSY_NAP_MAX = 4;   // ms
+		static constexpr uint32_t BUSY_TIMEOUT = 500; // ms, SDXC write timeout
+		static constexpr uint32_t BUSY_BINS    = 6;   // <1, <4, <16, <64, <256, >=256 ms
+
+		// CMD38 busy allowance: 250 ms per 4 MB allocation unit started, the
+		// spec's fallback when the SD status erase timeout isn't read
+		static constexpr uint32_t ERASE_AU_BLOCKS = 8192;
+		static constexpr uint32_t ERASE_AU_MS     = 250;
+		static constexpr uint16_t CCC_ERASE       = 1 << 5; // command class 5
+
+		const Os_t* os = nullptr;
+
+		struct
+		{
+			uint32_t cnt, sum, max; // per programmed block, in ms
+			uint32_t timeouts;
+			uint32_t hist[BUSY_BINS];
+		} busy = {};
+
+		struct
+		{
+			uint32_t cnt, blocks, fails;
+		} erase_stat = {};
+
 		SD_t(
 		    SPI_t::Raw_t spi, PortPin_t sclk,
 		    PortPin_t miso, PortPin_t mosi, PortPin_t cs
@@ -186,6 +249,20 @@ namespace Driver::Device
 		   mosi(mosi),
 		   cs(cs) {}
 
+		inline auto&
+		attach_dma(const SPI_t::Dma_t& dma)
+		{
+			this->dma = &dma;
+			return *this;
+		}
+
+		inline auto&
+		attach_os(const Os_t& os)
+		{
+			this->os = &os;
+			return *this;
+		}
+
 		uint8_t
 		write_byte(uint8_t data)
 		{
@@ -221,8 +298,60 @@ namespace Driver::Device
 			return (uint8_t) spi.recv_data();
 		}
 
+		// Receive a data block, 0xFF is clocked out while the card answers
+		// `crc` gets the CRC16 of the block in CRC mode, false if the DMA failed
+		bool recv_data(uint8_t* buf, uint32_t len, uint16_t& crc)
+		{
+			if (dma && DMA_Stream_t::reachable(buf)) {
+				if (!spi.transfer(*dma, nullptr, buf, len)) {
+					dma_errs++;
+					return false;
+				}
+			}
+			else {
+				spi.transfer(nullptr, buf, len);
+			}
+			crc = crc_on ? CRC::crc16(buf, len) : 0;
+			return true;
+		}
+
+		// Send a data block, what the card echoes back is dropped
+		// `crc` gets the CRC16 to append, or 0xFFFF (dummy bytes) outside CRC mode,
+		// false if the DMA failed and the card got part of the block only
+		bool send_data(const uint8_t* buf, uint32_t len, uint16_t& crc)
+		{
+			bool ok = true;
+			crc     = 0xFFFF;
+
+			if (dma && DMA_Stream_t::reachable(buf)) {
+				spi.write_start(*dma, buf, len);
+				if (crc_on) crc = CRC::crc16(buf, len); // 与DMA发送重叠
+				ok = spi.write_wait(*dma);
+				if (!ok) dma_errs++;
+			}
+			else {
+				if (crc_on) crc = CRC::crc16(buf, len);
+				spi.write(buf, len);
+			}
+			spi.flush_rx();
+			return ok;
+		}
+
+		// Read the two CRC bytes after a data block, compared in CRC mode only
+		bool check_crc(uint16_t crc)
+		{
+			uint16_t trailer = read_byte() << 8;
+			trailer |= read_byte();
+
+			if (crc_on && trailer != crc) {
+				crc_errs++;
+				return false;
+			}
+			return true;
+		}
+
 		void
-		send_cmd(Cmd cmd, uint32_t arg, uint8_t crc)
+		send_cmd(Cmd cmd, uint32_t arg)
 		{
 			uint8_t frame[] = {
 			    (uint8_t) (cmd | 0x40), /* Byte 1 */
@@ -230,9 +359,11 @@ namespace Driver::Device
 			    (uint8_t) (arg >> 16),  /* Byte 3 */
 			    (uint8_t) (arg >> 8),   /* Byte 4 */
 			    (uint8_t) (arg),        /* Byte 5 */
-			    (crc),                  /* Byte 6 */
+			    0,                      /* Byte 6: CRC7 + end bit */
 			};
 
+			frame[5] = CRC::crc7(frame, 5);
+
 			for (auto byte: frame) {
 				write_byte(byte); /* Send the Cmd bytes */
 			}
@@ -265,14 +396,75 @@ namespace Driver::Device
 					break;
 			}
 
-			while (read_byte() == 0) {
-				/*!< Wait null data */
+			if (!wait_busy()) {
+				return Error::DATA_OTHER_ERROR;
 			}
 
 			/*!< Return response */
 			return res;
 		}
 
+		// The card holds MISO low while it is programming, which may take hundreds of ms.
+		// Spin for a quarter tick, as long as a block inside CMD25 usually takes to
+		// program (100 ~ 250 us), then sleep the caller with a growing back-off
+		// until the timeout: a nap costs at least a tick, more than the spin
+		bool wait_busy(uint32_t timeout = BUSY_TIMEOUT)
+		{
+			uint32_t spin = clk / 8 / 1000 * BUSY_SPIN_US / 1000;
+
+			while (spin--) {
+				if (read_byte() != 0) {
+					busy_record(0);
+					return true;
+				}
+			}
+
+			if (!os) { // no kernel, bound the spin by bytes at the current clock
+				for (uint32_t n = clk / 8 / 1000 * timeout; n; n--) {
+					if (read_byte() != 0) {
+						busy_record(0);
+						return true;
+					}
+				}
+				busy.timeouts++;
+				return false;
+			}
+
+			const uint32_t t0 = os->now();
+			uint32_t nap      = 1;
+
+			while (true) {
+				os->sleep(nap);
+
+				const uint32_t dt = os->now() - t0;
+				if (read_byte() != 0) {
+					busy_record(dt);
+					return true;
+				}
+				if (dt >= timeout) {
+					busy_record(dt);
+					busy.timeouts++;
+					return false;
+				}
+				if (nap < BUSY_NAP_MAX) {
+					nap <<= 1;
+				}
+			}
+		}
+
+		void busy_record(uint32_t ms)
+		{
+			uint32_t bin = 0;
+			while (bin < BUSY_BINS - 1 && ms >= (1u << (2 * bin))) {
+				bin++;
+			}
+
+			busy.cnt += 1;
+			busy.sum += ms;
+			busy.hist[bin] += 1;
+			if (ms > busy.max) busy.max = ms;
+		}
+
 		Error get_resp(uint8_t Response)
 		{
 			uint32_t Count = 0xFFF;
@@ -299,7 +491,7 @@ namespace Driver::Device
 			cs.set_low();
 
 			/*!< Send CMD13 (SD_SEND_STATUS) to get SD status */
-			send_cmd(Cmd::SEND_STATUS, 0, 0xFF);
+			send_cmd(Cmd::SEND_STATUS, 0);
 
 			status = read_byte();
 			status |= (uint16_t) (read_byte() << 8);
@@ -329,7 +521,7 @@ namespace Driver::Device
 			cs.set_low();
 
 			/*!< Send CMD8 */
-			send_cmd(Cmd::SEND_IF_COND, 0x1AA, 0x87);
+			send_cmd(Cmd::SEND_IF_COND, 0x1AA);
 
 			/*!< Check if response is got or a timeout is happen */
 			while (((R1_Resp = read_byte()) == 0xFF) && Count) {
@@ -354,7 +546,7 @@ namespace Driver::Device
 					cs.set_low();
 
 					/*!< 发送CMD1完成V1 版本卡的初始化 */
-					send_cmd(Cmd::SEND_OP_COND, 0, 0xFF);
+					send_cmd(Cmd::SEND_OP_COND, 0);
 					/*!< Wait for no error Response (R1 Format) equal to 0x00 */
 				} while (get_resp(Error::RESPONSE_NO_ERROR));
 
@@ -386,12 +578,12 @@ namespace Driver::Device
 					//发卡初始化指令CMD55+ACMD41
 					do {
 						//CMD55，以强调下面的是ACMD命令
-						send_cmd(Cmd::APP_CMD, 0, 0xFF);
+						send_cmd(Cmd::APP_CMD, 0);
 						if (!get_resp(Error::RESPONSE_NO_ERROR)) // SD_IN_IDLE_STATE
 							return Error::RESPONSE_FAILURE;      //超时返回
 
 						//ACMD41命令带HCS检查位
-						send_cmd(Cmd::SD_SEND_OP_COND, 0x40000000, 0xFF);
+						send_cmd(Cmd::SD_SEND_OP_COND, 0x40000000);
 
 						if (Count-- == 0)
 							return Error::RESPONSE_FAILURE; //重试次数超时
@@ -413,7 +605,7 @@ namespace Driver::Device
 						cs.set_low();
 
 						/*!< 发送CMD58 读取OCR寄存器 */
-						send_cmd(Cmd::READ_OCR, 0, 0xFF);
+						send_cmd(Cmd::READ_OCR, 0);
 					} while (get_resp(Error::RESPONSE_NO_ERROR) || Count-- == 0);
 
 					if (Count == 0) {
@@ -455,7 +647,7 @@ namespace Driver::Device
 			cs.set_low();
 
 			/*!< Send CMD0 (SD_CMD_GO_IDLE_STATE) to put SD in SPI mode */
-			send_cmd(Cmd::GO_IDLE_STATE, 0, 0x95);
+			send_cmd(Cmd::GO_IDLE_STATE, 0);
 
 			/*!< Wait for In Idle State Response (R1 Format) equal to 0x01 */
 			if (get_resp(Error::IN_IDLE_STATE)) {
@@ -472,6 +664,19 @@ namespace Driver::Device
 			return Error::RESPONSE_NO_ERROR;
 		}
 
+		// Run a block command up to RETRY times, every failed attempt counts towards a clock step down
+		Error retry(auto&& fn)
+		{
+			Error err = RESPONSE_FAILURE;
+
+			for (uint32_t i = 0; i < RETRY; i++) {
+				if (i) retry_cnt++;
+				err = track(fn());
+				if (err == RESPONSE_NO_ERROR) break;
+			}
+			return err;
+		}
+
 		Error
 		read_block(
 		    uint8_t* buf,
@@ -479,48 +684,45 @@ namespace Driver::Device
 		    uint16_t blc_sz
 		)
 		{
-			Error err = RESPONSE_FAILURE;
-
 			//SDHC卡块大小固定为512，且读命令中的地址的单位是sector
 			if (type == Type::V2HC) {
 				blc_sz = 512;
 				r_addr /= 512;
 			}
 
-			/*!< SD chip select low */
-			cs.set_low();
+			return retry([&] {
+				Error err = RESPONSE_FAILURE;
 
-			/*!< Send CMD17 (SD_CMD_READ_SINGLE_BLOCK) to read one block */
-			send_cmd(READ_SINGLE_BLOCK, r_addr, 0xFF);
+				/*!< SD chip select low */
+				cs.set_low();
 
-			/*!< Check if the SD acknowledged the read block command: R1 response (0x00: no errors) */
-			if (!get_resp(RESPONSE_NO_ERROR)) {
-				/*!< Now look for the data token to signify the start of the data */
-				if (!get_resp(START_DATA_SINGLE_BLOCK_READ)) {
-					/*!< Read the SD block data : read NumByteToRead data */
-					for (uint32_t i = 0; i < blc_sz; i++) {
-						/*!< Save the received data */
-						*buf = read_byte();
-
-						/*!< Point to the next location where the byte read will be saved */
-						buf++;
-					}
-					/*!< Get CRC bytes (not really needed by us, but required by SD) */
-					read_byte();
-					read_byte();
+				/*!< Send CMD17 (SD_CMD_READ_SINGLE_BLOCK) to read one block */
+				send_cmd(READ_SINGLE_BLOCK, r_addr);
 
-					/*!< Set response value to success */
-					err = RESPONSE_NO_ERROR;
+				/*!< Check if the SD acknowledged the read block command: R1 response (0x00: no errors) */
+				if (!get_resp(RESPONSE_NO_ERROR)) {
+					/*!< Now look for the data token to signify the start of the data */
+					if (!get_resp(START_DATA_SINGLE_BLOCK_READ)) {
+						/*!< Read the SD block data : read NumByteToRead data */
+						uint16_t crc;
+						if (!recv_data(buf, blc_sz, crc)) {
+							err = RESPONSE_FAILURE;
+						}
+						/*!< Get CRC bytes, checked in CRC mode */
+						else {
+							err = check_crc(crc) ? RESPONSE_NO_ERROR : DATA_CRC_ERROR;
+						}
+					}
 				}
-			}
-			/*!< SD chip select high */
-			cs.set_high();
+				/*!< SD chip select high */
+				cs.set_high();
 
-			/*!< Send dummy byte: 8 Clock pulses of delay */
-			write_byte(DUMMY_BYTE);
+				/*!< Send dummy byte: 8 Clock pulses of delay */
+				write_byte(DUMMY_BYTE);
 
-			/*!< Returns the reponse */
-			return err;
+				/*!< Returns the reponse */
+				return err;
+			});
 		}
 
 		Error
@@ -531,58 +733,75 @@ namespace Driver::Device
 		    uint32_t num_of_blc
 		)
 		{
-			uint32_t offset = 0;
-			Error err       = RESPONSE_FAILURE;
-
 			//SDHC卡块大小固定为512，且读命令中的地址的单位是sector
 			if (type == Type::V2HC) {
 				blc_sz = 512;
 				r_addr /= 512;
 			}
 
-			/*!< SD chip select low */
-			cs.set_low();
+			const uint32_t step = (type == Type::V2HC) ? 1 : blc_sz;
+
+			// A retry resumes from the first block that failed
+			return retry([&] {
+				Error err = RESPONSE_FAILURE;
+
+				/*!< SD chip select low */
+				cs.set_low();
+
+				/*!< Send CMD18 (SD_CMD_READ_MULT_BLOCK), the card streams blocks until CMD12 */
+				send_cmd(READ_MULT_BLOCK, r_addr);
 
-			/*!< Data transfer */
-			while (num_of_blc--) {
-				/*!< Send CMD17 (SD_CMD_READ_SINGLE_BLOCK) to read one block */
-				send_cmd(READ_SINGLE_BLOCK, r_addr + offset, 0xFF);
 				/*!< Check if the SD acknowledged the read block command: R1 response (0x00: no errors) */
-				if (get_resp(RESPONSE_NO_ERROR)) {
-					return RESPONSE_FAILURE;
-				}
-				/*!< Now look for the data token to signify the start of the data */
-				if (!get_resp(START_DATA_SINGLE_BLOCK_READ)) {
-					/*!< Read the SD block data : read NumByteToRead data */
-					for (uint32_t i = 0; i < blc_sz; i++) {
-						*buf = read_byte(); /*!< Read the pointed data */
-						/*!< Point to the next location where the byte read will be saved */
-						buf++;
+				if (!get_resp(RESPONSE_NO_ERROR)) {
+					err = RESPONSE_NO_ERROR;
+
+					/*!< Data transfer */
+					while (num_of_blc) {
+						/*!< Now look for the data token to signify the start of the data */
+						if (get_resp(START_DATA_MULTIPLE_BLOCK_READ)) {
+							err = RESPONSE_FAILURE;
+							break;
+						}
+
+						/*!< Read the SD block data, its CRC is checked while the card fetches the next one */
+						uint16_t crc;
+						if (!recv_data(buf, blc_sz, crc)) {
+							err = RESPONSE_FAILURE;
+							break;
+						}
+
+						if (!check_crc(crc)) {
+							err = DATA_CRC_ERROR;
+							break;
+						}
+
+						buf += blc_sz;
+						r_addr += step;
+						num_of_blc--;
 					}
 
-					offset += 512; /*!< Set next read address*/
-					/*!< get CRC bytes (not really needed by us, but required by SD) */
-					read_byte();
+					/*!< Send CMD12 (SD_CMD_STOP_TRANSMISSION), the byte after it is a stuff byte */
+					send_cmd(STOP_TRANSMISSION, 0);
 					read_byte();
-					/*!< Set response value to success */
-					err = RESPONSE_NO_ERROR;
-				}
-				else {
-					/*!< Set response value to failure */
-					err = RESPONSE_FAILURE;
+
+					if (get_resp(RESPONSE_NO_ERROR)) {
+						err = RESPONSE_FAILURE;
+					}
+
+					/*!< The card may hold the line low (busy) after CMD12 */
+					if (!wait_busy()) {
+						err = RESPONSE_FAILURE;
+					}
 				}
+				/*!< SD chip select high */
+				cs.set_high();
 
-				/* 添加 Send dummy byte 防止读操作失败 */
+				/*!< Send dummy byte: 8 Clock pulses of delay */
 				write_byte(DUMMY_BYTE);
-			}
-			/*!< SD chip select high */
-			cs.set_high();
-
-			/*!< Send dummy byte: 8 Clock pulses of delay */
-			write_byte(DUMMY_BYTE);
 
-			/*!< Returns the reponse */
-			return err;
+				/*!< Returns the reponse */
+				return err;
+			});
 		}
 
 		Error
@@ -592,41 +811,65 @@ namespace Driver::Device
 		    uint16_t blc_sz
 		)
 		{
-			Error err = RESPONSE_FAILURE;
-
 			//SDHC卡块大小固定为512，且写命令中的地址的单位是sector
 			if (type == Type::V2HC) {
 				blc_sz = 512;
 				w_addr /= 512;
 			}
 
-			/*!< SD chip select low */
-			cs.set_low();
+			return retry([&] {
+				Error err = RESPONSE_FAILURE;
 
-			/*!< Send CMD24 (SD_CMD_WRITE_SINGLE_BLOCK) to write multiple block */
-			send_cmd(WRITE_SINGLE_BLOCK, w_addr, 0xFF);
+				/*!< SD chip select low */
+				cs.set_low();
 
-			/*!< Check if the SD acknowledged the write block command: R1 response (0x00: no errors) */
-			if (!get_resp(RESPONSE_NO_ERROR)) {
-				/*!< Send a dummy byte */
-				write_byte(DUMMY_BYTE);
+				/*!< Send CMD24 (SD_CMD_WRITE_SINGLE_BLOCK) to write one block */
+				send_cmd(WRITE_SINGLE_BLOCK, w_addr);
+
+				/*!< Check if the SD acknowledged the write block command: R1 response (0x00: no errors) */
+				if (!get_resp(RESPONSE_NO_ERROR)) {
+					/*!< Send a dummy byte */
+					write_byte(DUMMY_BYTE);
+
+					/*!< Send the data token to signify the start of the data */
+					write_byte(START_DATA_SINGLE_BLOCK_WRITE);
 
-				/*!< Send the data token to signify the start of the data */
-				write_byte(0xFE);
+					/*!< Write the block data to SD : write count data by block */
+					uint16_t crc;
+					const bool sent = send_data(buf, blc_sz, crc);
 
-				/*!< Write the block data to SD : write count data by block */
-				for (uint32_t i = 0; i < blc_sz; i++) {
-					/*!< Send the pointed byte */
-					write_byte(*buf);
-					/*!< Point to the next location where the byte read will be saved */
-					buf++;
+					/*!< Put CRC bytes, the card only checks them in CRC mode */
+					write_byte(crc >> 8);
+					write_byte(crc);
+
+					/*!< Read data response, a block cut short by the DMA fails anyway */
+					if (get_data_resp() == DATA_OK && sent) {
+						err = RESPONSE_NO_ERROR;
+					}
 				}
-				/*!< Put CRC bytes (not really needed by us, but required by SD) */
-				read_byte();
-				read_byte();
+				/*!< SD chip select high */
+				cs.set_high();
+
+				/*!< Send dummy byte: 8 Clock pulses of delay */
+				write_byte(DUMMY_BYTE);
+
+				/*!< Returns the reponse */
+				return err;
+			});
+		}
+
+		// ACMD23: number of blocks to pre-erase before the next multi-block write
+		Error set_wr_blk_erase_count(uint32_t num_of_blc)
+		{
+			Error err = RESPONSE_FAILURE;
+
+			/*!< SD chip select low */
+			cs.set_low();
 
-				/*!< Read data response */
-				if (get_data_resp() == DATA_OK) {
+			send_cmd(APP_CMD, 0);
+			if (!get_resp(RESPONSE_NO_ERROR)) {
+				send_cmd(SET_WR_BLK_ERASE_COUNT, num_of_blc & 0x7FFFFF);
+				if (!get_resp(RESPONSE_NO_ERROR)) {
 					err = RESPONSE_NO_ERROR;
 				}
 			}
@@ -636,7 +879,53 @@ namespace Driver::Device
 			/*!< Send dummy byte: 8 Clock pulses of delay */
 			write_byte(DUMMY_BYTE);
 
-			/*!< Returns the reponse */
+			return err;
+		}
+
+		// CMD32/33/38: erase the blocks from s_addr to e_addr (inclusive, byte
+		// addresses), a freed range no longer costs the card an internal copy
+		Error erase(uint64_t s_addr, uint64_t e_addr)
+		{
+			if (!(info.csd.CardComdClasses & CCC_ERASE) || e_addr < s_addr) {
+				return PARAMETER_ERROR;
+			}
+
+			const uint32_t blocks  = (e_addr - s_addr) / BLOCK_SIZE + 1;
+			const uint32_t timeout = BUSY_TIMEOUT + ERASE_AU_MS * ((blocks + ERASE_AU_BLOCKS - 1) / ERASE_AU_BLOCKS);
+
+			//SDHC卡擦除命令中的地址的单位是sector
+			if (type == Type::V2HC) {
+				s_addr /= 512;
+				e_addr /= 512;
+			}
+
+			Error err = RESPONSE_FAILURE;
+
+			/*!< SD chip select low */
+			cs.set_low();
+
+			send_cmd(SD_ERASE_GRP_START, s_addr);
+			if (!get_resp(RESPONSE_NO_ERROR)) {
+				send_cmd(SD_ERASE_GRP_END, e_addr);
+				if (!get_resp(RESPONSE_NO_ERROR)) {
+					/*!< R1b: the card stays busy until the range is erased */
+					send_cmd(ERASE, 0);
+					if (!get_resp(RESPONSE_NO_ERROR) && wait_busy(timeout)) {
+						err = RESPONSE_NO_ERROR;
+					}
+				}
+			}
+			/*!< SD chip select high */
+			cs.set_high();
+
+			/*!< Send dummy byte: 8 Clock pulses of delay */
+			write_byte(DUMMY_BYTE);
+
+			erase_stat.cnt += 1;
+			if (err == RESPONSE_NO_ERROR)
+				erase_stat.blocks += blocks;
+			else
+				erase_stat.fails += 1;
 			return err;
 		}
 
@@ -648,8 +937,13 @@ namespace Driver::Device
 		    uint32_t num_of_blc
 		)
 		{
-			uint32_t offset = 0;
-			Error err       = RESPONSE_FAILURE;
+			if (!num_of_blc) {
+				return RESPONSE_NO_ERROR;
+			}
+
+			if (num_of_blc == 1) {
+				return write_block(buf, w_addr, blc_sz);
+			}
 
 			//SDHC卡块大小固定为512，且写命令中的地址的单位是sector
 			if (type == Type::V2HC) {
@@ -657,48 +951,92 @@ namespace Driver::Device
 				w_addr /= 512;
 			}
 
-			/*!< SD chip select low */
-			cs.set_low();
+			const uint32_t step = (type == Type::V2HC) ? 1 : blc_sz;
 
-			/*!< Data transfer */
-			while (num_of_blc--) {
-				/*!< Send CMD24 (SD_CMD_WRITE_SINGLE_BLOCK) to write blocks */
-				send_cmd(WRITE_SINGLE_BLOCK, w_addr + offset, 0xFF);
-				/*!< Check if the SD acknowledged the write block command: R1 response (0x00: no errors) */
-				if (get_resp(RESPONSE_NO_ERROR)) {
-					return RESPONSE_FAILURE;
+			// A retry resumes from the first block the card rejected
+			return retry([&] {
+				Error err = RESPONSE_FAILURE;
+
+				/*!< Every block was accepted and only the busy wait after the stop token
+				     failed: wait again, then ask CMD13 whether programming went through */
+				if (!num_of_blc) {
+					cs.set_low();
+					const bool idle = wait_busy();
+					cs.set_high();
+					write_byte(DUMMY_BYTE);
+					return (idle && !get_status()) ? RESPONSE_NO_ERROR : RESPONSE_FAILURE;
 				}
 
-				/*!< Send dummy byte */
-				write_byte(DUMMY_BYTE);
+				/*!< Only a hint for the card, a rejected ACMD23 doesn't fail the write */
+				set_wr_blk_erase_count(num_of_blc);
 
-				/*!< Send the data token to signify the start of the data */
-				write_byte(START_DATA_SINGLE_BLOCK_WRITE);
+				/*!< SD chip select low */
+				cs.set_low();
 
-				/*!< Write the block data to SD : write count data by block */
-				for (uint32_t i = 0; i < blc_sz; i++) {
-					/*!< Send the pointed byte */
-					write_byte(*buf);
-					/*!< Point to the next location where the byte read will be saved */
-					buf++;
-				}
+				/*!< Send CMD25 (SD_CMD_WRITE_MULT_BLOCK), blocks follow until the stop token */
+				send_cmd(WRITE_MULT_BLOCK, w_addr);
 
-				/*!< Set next write address */
-				offset += 512;
+				/*!< Check if the SD acknowledged the write block command: R1 response (0x00: no errors) */
+				if (!get_resp(RESPONSE_NO_ERROR)) {
+					err = RESPONSE_NO_ERROR;
 
-				/*!< Put CRC bytes (not really needed by us, but required by SD) */
-				read_byte();
-				read_byte();
+					/*!< Send dummy byte */
+					write_byte(DUMMY_BYTE);
 
-				/*!< Read data response */
-				if (get_data_resp() == DATA_OK) {
-					/*!< Set response value to success */
-					err = RESPONSE_NO_ERROR;
-				}
-				else {
-					/*!< Set response value to failure */
-					err = RESPONSE_FAILURE;
+					/*!< Data transfer */
+					while (num_of_blc) {
+						/*!< Send the data token to signify the start of the data */
+						write_byte(START_DATA_MULTIPLE_BLOCK_WRITE);
+
+						/*!< Write the block data to SD : write count data by block */
+						uint16_t crc;
+						const bool sent = send_data(buf, blc_sz, crc);
+
+						/*!< Put CRC bytes, the card only checks them in CRC mode */
+						write_byte(crc >> 8);
+						write_byte(crc);
+
+						/*!< Read data response, then wait for the block to be programmed */
+						if (get_data_resp() != DATA_OK || !sent) {
+							err = RESPONSE_FAILURE;
+							break;
+						}
+
+						buf += blc_sz;
+						w_addr += step;
+						num_of_blc--;
+					}
+
+					/*!< Stop token, the card goes busy while programming the last block */
+					write_byte(STOP_DATA_MULTIPLE_BLOCK_WRITE);
+					read_byte();
+					if (!wait_busy()) {
+						err = RESPONSE_FAILURE;
+					}
 				}
+				/*!< SD chip select high */
+				cs.set_high();
+
+				/*!< Send dummy byte: 8 Clock pulses of delay */
+				write_byte(DUMMY_BYTE);
+
+				/*!< Returns the reponse */
+				return err;
+			});
+		}
+
+		// CMD59: turn CRC checking on the card on or off
+		Error set_crc(bool on)
+		{
+			Error err = RESPONSE_FAILURE;
+
+			/*!< SD chip select low */
+			cs.set_low();
+
+			send_cmd(CRC_ON_OFF, on);
+			if (!get_resp(RESPONSE_NO_ERROR)) {
+				crc_on = on;
+				err    = RESPONSE_NO_ERROR;
 			}
 			/*!< SD chip select high */
 			cs.set_high();
@@ -706,7 +1044,6 @@ namespace Driver::Device
 			/*!< Send dummy byte: 8 Clock pulses of delay */
 			write_byte(DUMMY_BYTE);
 
-			/*!< Returns the reponse */
 			return err;
 		}
 
@@ -719,7 +1056,7 @@ namespace Driver::Device
 			cs.set_low();
 
 			/*!< Send CMD9 (CSD register) or CMD10(CSD register) */
-			send_cmd(Cmd::SEND_CSD, 0, 0xFF);
+			send_cmd(Cmd::SEND_CSD, 0);
 
 			/*!< Wait for response in the R1 format (0x00 is no errors) */
 			if (!get_resp(Error::RESPONSE_NO_ERROR)) {
@@ -841,7 +1178,7 @@ namespace Driver::Device
 			cs.set_low();
 
 			/*!< Send CMD10 (CID register) */
-			send_cmd(Cmd::SEND_CID, 0, 0xFF);
+			send_cmd(Cmd::SEND_CID, 0);
 
 			/*!< Wait for response in the R1 format (0x00 is no errors) */
 			if (!get_resp(Error::RESPONSE_NO_ERROR))
@@ -940,6 +1277,40 @@ namespace Driver::Device
 			return status;
 		}
 
+		// TRAN_SPEED in CSD: bits 2:0 rate unit, bits 6:3 time value
+		uint32_t get_max_clk() const
+		{
+			static constexpr uint32_t unit[] = {100'000, 1'000'000, 10'000'000, 100'000'000};
+			static constexpr uint8_t value[] = {0, 10, 12, 13, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 70, 80}; // x10
+
+			const uint8_t tran_speed = info.csd.MaxBusClkFrec;
+			const uint32_t hz        = (tran_speed & 0x04) ? 0 : unit[tran_speed & 0x03] / 10 * value[(tran_speed >> 3) & 0x0F];
+			return hz ? hz : 25'000'000; // 非法值按默认速率处理
+		}
+
+		void set_clk(uint32_t hz)
+		{
+			const auto pclk = spi.get_pclk();
+			spi.set_baud_rate_prescaler(SPI_t::get_prescaler(pclk, hz));
+			clk = spi.get_baud_rate();
+		}
+
+		// Count consecutive failures of block commands and step the clock down
+		Error track(Error err)
+		{
+			if (err == RESPONSE_NO_ERROR) {
+				err_cnt = 0;
+			}
+			else if (++err_cnt >= ERR_LIMIT) {
+				err_cnt = 0;
+				if (clk / 2 >= INIT_CLK) {
+					set_clk(clk / 2);
+					step_cnt++;
+				}
+			}
+			return err;
+		}
+
 		Error init()
 		{
 			spi.init({
@@ -949,7 +1320,7 @@ namespace Driver::Device
 			    .SPI_CPOL              = SPI_CPOL_High,
 			    .SPI_CPHA              = SPI_CPHA_2Edge,
 			    .SPI_NSS               = SPI_NSS_Soft,
-			    .SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_16,
+			    .SPI_BaudRatePrescaler = SPI_t::get_prescaler(spi.get_pclk(), INIT_CLK),
 			    .SPI_FirstBit          = SPI_FirstBit_MSB,
 			    .SPI_CRCPolynomial     = 7,
 			});
@@ -957,6 +1328,10 @@ namespace Driver::Device
 			spi.enable();
 			cs.as_output();
 
+			clk     = spi.get_baud_rate();
+			err_cnt = 0;
+			crc_on  = false; // CMD0 turns it off on the card
+
 			/*!< SD chip select high */
 			cs.set_high();
 
@@ -980,9 +1355,60 @@ namespace Driver::Device
 				return Error::RESPONSE_FAILURE;
 			}
 
-			return get_info();
+			// 在提速之前打开CRC校验
+			if (crc_mode) {
+				set_crc(true);
+			}
+
+			const auto err = get_info();
+			if (err == Error::RESPONSE_NO_ERROR) {
+				const auto max_clk = get_max_clk();
+				set_clk(max_clk < SPI_MAX_CLK ? max_clk : SPI_MAX_CLK);
+			}
+			return err;
 		}
 	};
+
+	// SD_t as a block device, count > 1 streams with CMD18 / CMD25
+	inline constexpr BlkDev_t::Ops_t sd_blk_ops {
+	    .init = [](void* ctx) {
+		    auto& sd = *(SD_t*) ctx;
+		    return sd.init() == SD_t::RESPONSE_NO_ERROR ? BlkDev_t::OK : BlkDev_t::NOTRDY;
+	    },
+
+	    .read = [](void* ctx, uint8_t* buf, uint32_t sector, uint32_t count) {
+		    auto& sd         = *(SD_t*) ctx;
+		    const auto addr  = (uint64_t) sector * SD_t::BLOCK_SIZE; // >4 GB cards
+		    const auto state = (count == 1)
+		                           ? sd.read_block(buf, addr, SD_t::BLOCK_SIZE)
+		                           : sd.read_multi_block(buf, addr, SD_t::BLOCK_SIZE, count);
+		    return state == SD_t::RESPONSE_NO_ERROR ? BlkDev_t::OK : BlkDev_t::ERROR;
+	    },
+
+	    .write = [](void* ctx, const uint8_t* buf, uint32_t sector, uint32_t count) {
+		    auto& sd         = *(SD_t*) ctx;
+		    const auto addr  = (uint64_t) sector * SD_t::BLOCK_SIZE;
+		    const auto state = (count == 1)
+		                           ? sd.write_block((uint8_t*) buf, addr, SD_t::BLOCK_SIZE)
+		                           : sd.write_multi_block((uint8_t*) buf, addr, SD_t::BLOCK_SIZE, count);
+		    return state == SD_t::RESPONSE_NO_ERROR ? BlkDev_t::OK : BlkDev_t::ERROR;
+	    },
+
+	    .ioctl = [](void* ctx, BlkDev_t::Ctrl cmd, uint32_t* arg) {
+		    auto& sd = *(SD_t*) ctx;
+		    switch (cmd) {
+			    case BlkDev_t::SYNC: return BlkDev_t::OK; // writes complete before returning
+			    case BlkDev_t::SECTOR_COUNT: *arg = sd.info.capacity / sd.info.block_size; return BlkDev_t::OK;
+			    case BlkDev_t::SECTOR_SIZE: *arg = SD_t::BLOCK_SIZE; return BlkDev_t::OK;
+			    case BlkDev_t::BLOCK_SIZE: *arg = 1; return BlkDev_t::OK;
+			    case BlkDev_t::TRIM:
+				    return sd.erase((uint64_t) arg[0] * SD_t::BLOCK_SIZE, (uint64_t) arg[1] * SD_t::BLOCK_SIZE)
+				               ? BlkDev_t::ERROR
+				               : BlkDev_t::OK;
+			    default: return BlkDev_t::PARERR;
+		    }
+	    },
+	};
 }
 
 #endif
@@ -2,6 +2,9 @@
 #define _DEVICE_ST7735S_
 
 #include "../stm32f4xx/spi.hpp"
+#include "rle565.hpp"
+
+#include <string.h>
 
 namespace Driver::Device
 {
@@ -164,6 +167,30 @@ namespace Driver::Device
 		const Pixel_t width = 128, height = 160;
 		const uint8_t direction = 1;
 
+		// Optional DMA link for pixel streaming
+		const SPI_t::Dma_t* dma = nullptr;
+
+		// Bytes sent to the panel, commands included
+		uint32_t tx_bytes = 0;
+
+		// Line buffer for decoded images, kept out of task stacks for DMA
+		Pixel_t line_buf[128];
+
+		// Second line of the ping-pong pipeline in stream_lines
+		Pixel_t back_buf[128];
+
+		// A DMA write from stream_async is still running
+		bool dma_busy = false;
+
+		// Source of DMA fills, read over and over without incrementing
+		Pixel_t fill_px;
+
+		// Optional off-screen framebuffer of width * height, see attach_fb
+		Pixel_t* fb = nullptr;
+
+		// Dirty span of each framebuffer row, clean if x0 > x1
+		uint8_t dirty_x0[160], dirty_x1[160];
+
 		ST7735S_t(
 		    SPI_t::Raw_t spi, PortPin_t sclk, PortPin_t mosi,
 		    PortPin_t cs, PortPin_t rst, PortPin_t dc
@@ -200,6 +227,7 @@ namespace Driver::Device
 			dc.set(); //写数据
 			spi.write_bus(data);
 			cs.set();
+			tx_bytes += 1;
 		}
 
 		inline void write_16bit_data(uint16_t data)
@@ -209,6 +237,175 @@ namespace Driver::Device
 			spi.write_bus(data >> 8);
 			spi.write_bus(data);
 			cs.set();
+			tx_bytes += 2;
+		}
+
+		// Open a pixel stream into the current window, one CS assertion
+		inline void stream_begin()
+		{
+			cs.clr();
+			dc.set(); //写数据
+			spi.set_data_size(SPI_DataSize_16b);
+		}
+
+		inline void stream(const Pixel_t* px, uint32_t n)
+		{
+			if (dma) {
+				spi.write(*dma, px, n);
+			}
+			else {
+				spi.write(px, n);
+			}
+			tx_bytes += n * 2;
+		}
+
+		// Start sending n (< 0x10000) pixels, px stays untouched until stream_wait
+		inline void stream_async(const Pixel_t* px, uint32_t n)
+		{
+			if (dma && HAL::STM32F4xx::DMA_Stream_t::reachable(px)) {
+				spi.write_start(*dma, px, n);
+				dma_busy = true;
+			}
+			else {
+				spi.write(px, n);
+			}
+			tx_bytes += n * 2;
+		}
+
+		inline void stream_wait()
+		{
+			if (dma_busy) {
+				spi.write_wait(*dma);
+				dma_busy = false;
+			}
+		}
+
+		// Ping-pong pipeline: DMA pushes line N while the CPU produces line N + 1
+		//
+		// `source(row, buf)` returns the w pixels of `row` (0 ~ h-1), either
+		// produced into buf (line_buf or back_buf in turn) or from anywhere else
+		// that stays put, e.g. an image in flash
+		template <typename Source_t>
+		inline void stream_lines(
+		    Pixel_t x, Pixel_t y,
+		    Pixel_t w, Pixel_t h,
+		    Source_t&& source
+		)
+		{
+			Pixel_t* buf[] = {line_buf, back_buf};
+
+			address_set(x, y, x + w - 1, y + h - 1);
+			stream_begin();
+
+			const Pixel_t* line = source(0, buf[0]);
+			for (Pixel_t row = 0; row < h; row++) {
+				stream_async(line, w);
+				if (row + 1 < h) {
+					line = source(row + 1, buf[(row + 1) & 1]);
+				}
+				stream_wait();
+			}
+
+			stream_end();
+		}
+
+		// Send the same pixel n times into the current window
+		inline void stream_fill(Pixel_t color, uint32_t n)
+		{
+			fill_px = color;
+			if (dma) {
+				spi.fill(*dma, &fill_px, n);
+			}
+			else {
+				spi.fill(&fill_px, n);
+			}
+			tx_bytes += n * 2;
+		}
+
+		inline void stream_end()
+		{
+			spi.set_data_size(SPI_DataSize_8b);
+			cs.set();
+		}
+
+		// Stream RGB565 pixels into the current window
+		inline void write_pixels(const Pixel_t* px, uint32_t n)
+		{
+			stream_begin();
+			stream(px, n);
+			stream_end();
+		}
+
+		inline void attach_dma(const SPI_t::Dma_t& link) { dma = &link; }
+
+		// Draw into RAM from now on, the panel only changes on flush()
+		inline void attach_fb(Pixel_t* buf)
+		{
+			fb = buf;
+			for (uint32_t i = 0; i < width * height; i++) {
+				fb[i] = bkgd; // 与init()清屏后的面板一致
+			}
+			for (Pixel_t y = 0; y < height; y++) {
+				dirty_x0[y] = 0xFF;
+				dirty_x1[y] = 0;
+			}
+		}
+
+		inline Pixel_t* fb_at(Pixel_t x, Pixel_t y) { return &fb[y * width + x]; }
+
+		inline void mark_dirty(Pixel_t x0, Pixel_t y0, Pixel_t x1, Pixel_t y1)
+		{
+			for (Pixel_t y = y0; y <= y1; y++) {
+				if (x0 < dirty_x0[y]) dirty_x0[y] = x0;
+				if (x1 > dirty_x1[y]) dirty_x1[y] = x1;
+			}
+		}
+
+		// Push the dirty rows, consecutive ones share one window as long as
+		// the clean pixels sent along cost less than opening another window
+		inline void flush()
+		{
+			constexpr uint32_t WINDOW_PX = 8; // CASET/RASET/RAMWR ~ 15 bytes
+
+			if (!fb) return;
+
+			auto is_dirty = [&](Pixel_t y) { return dirty_x0[y] <= dirty_x1[y]; };
+			auto span     = [&](Pixel_t y) { return dirty_x1[y] - dirty_x0[y] + 1; };
+
+			for (Pixel_t y0 = 0; y0 < height;) {
+				if (!is_dirty(y0)) {
+					y0++;
+					continue;
+				}
+
+				Pixel_t x0 = dirty_x0[y0], x1 = dirty_x1[y0], y1 = y0;
+				uint32_t px = span(y0);
+
+				while (y1 + 1 < height && is_dirty(y1 + 1)) {
+					const Pixel_t nx0 = dirty_x0[y1 + 1] < x0 ? dirty_x0[y1 + 1] : x0;
+					const Pixel_t nx1 = dirty_x1[y1 + 1] > x1 ? dirty_x1[y1 + 1] : x1;
+					const uint32_t area = (nx1 - nx0 + 1) * (y1 - y0 + 2);
+					if (area - (px + span(y1 + 1)) > WINDOW_PX) break;
+					x0 = nx0, x1 = nx1;
+					px += span(++y1);
+				}
+
+				if (x1 - x0 + 1 == width) { // 整行连续，一次写完
+					address_set(x0, y0, x1, y1);
+					write_pixels(fb_at(0, y0), width * (y1 - y0 + 1));
+				}
+				else {
+					stream_lines(x0, y0, x1 - x0 + 1, y1 - y0 + 1, [&](Pixel_t row, Pixel_t*) {
+						return fb_at(x0, y0 + row);
+					});
+				}
+
+				for (Pixel_t row = y0; row <= y1; row++) {
+					dirty_x0[row] = 0xFF;
+					dirty_x1[row] = 0;
+				}
+				y0 = y1 + 1;
+			}
 		}
 
 		inline void write_cmd(uint8_t cmd)
@@ -217,6 +414,7 @@ namespace Driver::Device
 			dc.clr(); //写命令
 			spi.write_bus(cmd);
 			cs.set();
+			tx_bytes += 1;
 		}
 
 		inline void address_set(Pixel_t x1, Pixel_t y1, Pixel_t x2, Pixel_t y2)
@@ -230,14 +428,32 @@ namespace Driver::Device
 			write_cmd(0x2c); //储存器写
 		}
 
-		inline void clear(Color color)
+		// Fill a rectangle with one color, a single window and one DMA burst
+		inline void fill_rect(
+		    Pixel_t x0, Pixel_t y0,
+		    Pixel_t x1, Pixel_t y1,
+		    Color color
+		)
 		{
-			address_set(0, 0, width - 1, height - 1);
-			for (uint16_t i = 0; i < width; i++) {
-				for (uint16_t j = 0; j < height; j++) {
-					write_16bit_data(bkgd);
+			if (fb) {
+				for (Pixel_t y = y0; y <= y1; y++) {
+					auto dst = fb_at(x0, y);
+					for (Pixel_t x = x0; x <= x1; x++) {
+						*dst++ = color;
+					}
 				}
+				return mark_dirty(x0, y0, x1, y1);
 			}
+
+			address_set(x0, y0, x1, y1);
+			stream_begin();
+			stream_fill(color, (x1 - x0 + 1) * (y1 - y0 + 1));
+			stream_end();
+		}
+
+		inline void clear(Color color)
+		{
+			fill_rect(0, 0, width - 1, height - 1, color);
 		}
 
 		inline void draw_point(
@@ -246,6 +462,11 @@ namespace Driver::Device
 		    Color color = WHITE
 		)
 		{
+			if (fb) {
+				*fb_at(x, y) = color;
+				return mark_dirty(x, y, x, y);
+			}
+
 			address_set(x, y, x, y); //设置光标位置
 			write_16bit_data(color);
 		}
@@ -256,17 +477,101 @@ namespace Driver::Device
 		    const uint16_t* img
 		)
 		{
+			if (fb) {
+				for (Pixel_t row = 0; row < h; row++) {
+					memcpy(fb_at(x, y + row), &img[row * w], w * sizeof(Pixel_t));
+				}
+				return mark_dirty(x, y, x + w - 1, y + h - 1);
+			}
+
 			// 设置绘图区域
 			address_set(x, y, x + w - 1, y + h - 1);
 
-			// 遍历图片数据并绘制
-			for (uint16_t i = 0; i < h; i++) {
-				for (uint16_t j = 0; j < w; j++) {
-					// 从图片数据中获取颜色并绘制
-					uint16_t color = img[i * w + j];
-					write_16bit_data(color);
+			// 整帧一次性写入
+			write_pixels(img, w * h);
+		}
+
+		// Redraw only the dirty rectangles {x0, y0, x1, y1} of an image
+		inline void draw_rects(
+		    Pixel_t x, Pixel_t y, Pixel_t w,
+		    const uint16_t* img,
+		    const uint8_t (*rects)[4], uint32_t cnt
+		)
+		{
+			for (uint32_t i = 0; i < cnt; i++) {
+				auto [x0, y0, x1, y1] = rects[i];
+
+				if (fb) {
+					for (Pixel_t row = y0; row <= y1; row++) {
+						memcpy(fb_at(x + x0, y + row), &img[row * w + x0], (x1 - x0 + 1) * sizeof(Pixel_t));
+					}
+					mark_dirty(x + x0, y + y0, x + x1, y + y1);
+					continue;
+				}
+
+				if (x1 - x0 + 1 == w) { // 整行连续，一次写完
+					address_set(x + x0, y + y0, x + x1, y + y1);
+					write_pixels(&img[y0 * w], w * (y1 - y0 + 1));
+					continue;
+				}
+
+				// Rows come straight from the image, one window for the rect
+				stream_lines(x + x0, y + y0, x1 - x0 + 1, y1 - y0 + 1, [&](Pixel_t row, Pixel_t*) {
+					return &img[(y0 + row) * w + x0];
+				});
+			}
+		}
+
+		// Decode a compressed image row by row while the previous row goes out
+		inline void draw_rle(Pixel_t x, Pixel_t y, const Rle565_t& img)
+		{
+			if (fb) {
+				for (Pixel_t row = 0; row < img.h; row++) {
+					img.decode_row(row, fb_at(x, y + row));
+				}
+				return mark_dirty(x, y, x + img.w - 1, y + img.h - 1);
+			}
+
+			stream_lines(x, y, img.w, img.h, [&](Pixel_t row, Pixel_t* line) {
+				img.decode_row(row, line);
+				return line;
+			});
+		}
+
+		// Same as draw_rects, but from a compressed image
+		inline void draw_rle_rects(
+		    Pixel_t x, Pixel_t y,
+		    const Rle565_t& img,
+		    const uint8_t (*rects)[4], uint32_t cnt
+		)
+		{
+			for (uint32_t i = 0; i < cnt; i++) {
+				auto [x0, y0, x1, y1] = rects[i];
+
+				if (fb) {
+					for (Pixel_t row = y0; row <= y1; row++) {
+						img.decode_row(row, line_buf, x1 + 1);
+						memcpy(fb_at(x + x0, y + row), &line_buf[x0], (x1 - x0 + 1) * sizeof(Pixel_t));
+					}
+					mark_dirty(x + x0, y + y0, x + x1, y + y1);
+					continue;
 				}
+
+				const Pixel_t w = x1 - x0 + 1, h = y1 - y0 + 1;
+				stream_lines(x + x0, y + y0, w, h, [&](Pixel_t row, Pixel_t* line) {
+					img.decode_row(y0 + row, line, x1 + 1);
+					return &line[x0];
+				});
+			}
+		}
+
+		// Expand one 8-pixel row of a glyph, LSB is the leftmost pixel
+		inline Pixel_t* expand_glyph_row(Pixel_t* dst, uint8_t bits, Color color)
+		{
+			for (uint8_t t = 0; t < 8; t++, bits >>= 1) {
+				*dst++ = (bits & 0x01) ? color : bkgd;
 			}
+			return dst;
 		}
 
 		void show_char(
@@ -276,32 +581,92 @@ namespace Driver::Device
 		    Color color = WHITE
 		)
 		{
-			uint8_t temp;
-			uint16_t x0 = x;
 			if (x > width - 16 || y > height - 16) return; //设置窗口
 			num = num - ' ';                               //得到偏移后的值
-			address_set(x, y, x + 8 - 1, y + 16 - 1);      //设置光标位置
+
+			const auto glyph = ascii_1608[(uint16_t) num]; //调用1608字体
+
+			if (fb) {
+				for (uint8_t pos = 0; pos < 16; pos++) {
+					uint8_t ch = glyph[pos];
+					auto dst   = fb_at(x, y + pos);
+					for (uint8_t t = 0; t < 8; t++, ch >>= 1) {
+						if (ch & 0x01)
+							dst[t] = color;
+						else if (!mode)
+							dst[t] = bkgd;
+					}
+				}
+				return mark_dirty(x, y, x + 8 - 1, y + 16 - 1);
+			}
+
+			if (!mode) { //非叠加方式，整个字形展开后一次写完
+				auto dst = line_buf;
+				for (uint8_t pos = 0; pos < 16; pos++) {
+					dst = expand_glyph_row(dst, glyph[pos], color);
+				}
+				address_set(x, y, x + 8 - 1, y + 16 - 1);
+				return write_pixels(line_buf, 8 * 16);
+			}
+
+			//叠加方式，每行相邻的点合成一个窗口
+			for (uint8_t t = 0; t < 8; t++) {
+				line_buf[t] = color;
+			}
 
 			for (uint8_t pos = 0; pos < 16; pos++) {
-				uint8_t ch = ascii_1608[(uint16_t) num][pos]; //调用1608字体
-				for (uint8_t t = 0; t < 8; t++) {
-					if (ch & 0x01) {
-						if (!mode) { //非叠加方式
-							write_16bit_data(color);
-						}
-						else {                                 //叠加方式
-							draw_point(x + t, y + pos, color); //画一个点
-						}
+				uint8_t ch = glyph[pos], t = 0;
+				while (ch) {
+					if (!(ch & 0x01)) {
+						ch >>= 1, t++;
+						continue;
 					}
-					else if (!mode) {
-						write_16bit_data(bkgd);
+					const uint8_t t0 = t;
+					while (ch & 0x01) {
+						ch >>= 1, t++;
 					}
-					ch >>= 1;
-					x++;
+					address_set(x + t0, y + pos, x + t - 1, y + pos);
+					write_pixels(line_buf, t - t0);
+				}
+			}
+		}
+
+		// Opaque run of n chars on one text line, sent as a single window
+		// with every glyph row of the run expanded into a line buffer.
+		// Clipped at the right edge, runs longer than the line buffer go in pieces
+		void show_line(
+		    Pixel_t x, Pixel_t y,
+		    const char* str, uint8_t n,
+		    Color color = WHITE
+		)
+		{
+			constexpr uint8_t LINE_CHARS = sizeof(line_buf) / sizeof(line_buf[0]) / 8;
+
+			const uint8_t fit = (x < width) ? (width - x) / 8 : 0;
+			if (n > fit) n = fit;
+
+			for (; n > LINE_CHARS; n -= LINE_CHARS) {
+				show_line(x, y, str, LINE_CHARS, color);
+				x += 8 * LINE_CHARS;
+				str += LINE_CHARS;
+			}
+
+			if (!n) return;
+
+			if (fb) {
+				for (uint8_t i = 0; i < n; i++) {
+					show_char(x + 8 * i, y, str[i], 0, color);
 				}
-				x = x0;
-				y++;
+				return;
 			}
+
+			stream_lines(x, y, 8 * n, 16, [&](Pixel_t pos, Pixel_t* line) {
+				auto dst = line;
+				for (uint8_t i = 0; i < n; i++) {
+					dst = expand_glyph_row(dst, ascii_1608[(uint8_t) (str[i] - ' ')][pos], color);
+				}
+				return line;
+			});
 		}
 
 		void show_str(
@@ -310,25 +675,39 @@ namespace Driver::Device
 		    Color color = WHITE
 		)
 		{
+			// Chars are collected into runs and drawn by show_line
+			const char* run = str;
+			Pixel_t run_x = x, run_y = y;
+
+			auto flush_run = [&] {
+				show_line(run_x, run_y, run, str - run, color);
+			};
+
 			while (*str != '\0') {
 				if (*str == '\n') {
+					flush_run();
 					x = 0;
 					y += 16;
+					run = ++str;
+					continue;
 				}
-				else {
-					if (x > width - 16) {
-						x = 0;
-						y += 16;
-					}
-					if (y > height - 16) {
-						y = x = 0;
-						clear(bkgd);
-					}
-					show_char(x, y, *str, 0, color);
-					x += 8;
+				if (x > width - 16) {
+					flush_run();
+					run = str;
+					x   = 0;
+					y += 16;
+				}
+				if (y > height - 16) {
+					y = x = 0;
+					clear(bkgd);
 				}
+				if (run == str) {
+					run_x = x, run_y = y;
+				}
+				x += 8;
 				str++;
 			}
+			flush_run();
 		}
 
 		void test_gray16(void)
@@ -478,8 +857,18 @@ namespace Driver::Device
 
 		inline void print(const char* str, Color color = Color::WHITE)
 		{
+			// Same runs as ST7735S_t::show_str, one window per text line
+			const char* run = str;
+			Pixel_t run_x = c_x, run_y = c_y;
+
+			auto flush_run = [&] {
+				lcd.show_line(run_x, run_y, run, str - run, color);
+			};
+
 			while (*str != '\0') {
 				if (*str == '\n' || c_x > lcd.width - 16) {
+					flush_run();
+					run = str;
 					c_x = 0;
 					c_y += 16;
 				}
@@ -488,12 +877,17 @@ namespace Driver::Device
 					c_x = 0;
 					c_y = 0;
 				}
-				if (*str != '\n') {
-					lcd.show_char(c_x, c_y, *str, 0, color);
-					c_x += 8;
+				if (*str == '\n') {
+					run = ++str;
+					continue;
+				}
+				if (run == str) {
+					run_x = c_x, run_y = c_y;
 				}
+				c_x += 8;
 				str++;
 			}
+			flush_run();
 		}
 
 		inline void println(const char* str, Color color = Color::WHITE)
@@ -11,7 +11,10 @@ namespace HAL::STM32F4xx
 		using Raw_t   = DMA_Stream_TypeDef*;
 		using Init_t  = DMA_InitTypeDef;
 		using Flag_t  = const uint32_t;
+		using IT_t    = const uint32_t;
 		using State_t = FunctionalState;
+		using Addr_t  = const volatile void*;
+		using Len_t   = const uint16_t;
 
 		DMA_Stream_t()                  = delete;
 		DMA_Stream_t(const Self_t& src) = delete;
@@ -72,6 +75,111 @@ namespace HAL::STM32F4xx
 		{
 			return cmd(DISABLE);
 		}
+
+		inline auto&
+		it_config(IT_t dma_it, State_t new_state)
+		{
+			DMA_ITConfig(this, dma_it, new_state);
+			return *this;
+		}
+
+		inline auto&
+		it_enable(IT_t dma_it)
+		{
+			return it_config(dma_it, ENABLE);
+		}
+
+		inline auto&
+		it_disable(IT_t dma_it)
+		{
+			return it_config(dma_it, DISABLE);
+		}
+
+		inline auto
+		get_it_status(IT_t it) const
+		{
+			return DMA_GetITStatus((Raw_t) this, it);
+		}
+
+		inline void
+		clear_it_pending_bit(IT_t it)
+		{
+			DMA_ClearITPendingBit(this, it);
+		}
+
+		__attribute__((always_inline)) inline bool
+		handle_it(IT_t it, auto&& fn)
+		{
+			if (get_it_status(it) != RESET) {
+				clear_it_pending_bit(it);
+				fn();
+				return true;
+			}
+			else {
+				return false;
+			}
+		}
+
+		inline uint16_t
+		get_curr_data_counter() const
+		{
+			return DMA_GetCurrDataCounter((Raw_t) this);
+		}
+
+		// Stream number (0..7) inside its DMA controller
+		inline uint32_t
+		get_index() const
+		{
+			return (((uintptr_t) this & 0xFF) - 0x10) / 0x18;
+		}
+
+		// CCM data RAM (0x1000_0000 ~ 0x1000_FFFF) sits on the D-bus only, DMA can't reach it
+		static inline bool
+		reachable(Addr_t addr)
+		{
+			return ((uintptr_t) addr >> 16) != 0x1000;
+		}
+
+		// Clear TC/HT/TE/DME/FE of this stream in LIFCR or HIFCR
+		inline void
+		clear_all_flags()
+		{
+			constexpr uint8_t shift[] = {0, 6, 16, 22};
+
+			const auto idx = get_index();
+			auto ctrl      = (DMA_TypeDef*) ((uintptr_t) this & ~(uintptr_t) 0xFF);
+			auto& ifcr     = (idx < 4) ? ctrl->LIFCR : ctrl->HIFCR;
+			ifcr           = 0x3DU << shift[idx & 3];
+		}
+
+		// Wait until a disabled stream really stops
+		inline void
+		wait_disabled() const
+		{
+			while (get_cmd_status() != DISABLE)
+				;
+		}
+
+		// Rearm a stream that was set up by `init`, without a full DMA_Init
+		inline auto&
+		start(
+		    Addr_t mem_addr, Len_t len,
+		    bool mem_inc = true,
+		    bool half_word = false
+		)
+		{
+			disable().wait_disabled();
+			clear_all_flags();
+
+			uint32_t cr = CR & ~(DMA_SxCR_MINC | DMA_SxCR_MSIZE | DMA_SxCR_PSIZE);
+			if (mem_inc) cr |= DMA_SxCR_MINC;
+			if (half_word) cr |= DMA_MemoryDataSize_HalfWord | DMA_PeripheralDataSize_HalfWord;
+
+			CR   = cr;
+			M0AR = (uint32_t) (uintptr_t) mem_addr;
+			NDTR = len;
+			return enable();
+		}
 	};
 }
 
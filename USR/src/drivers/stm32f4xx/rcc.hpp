@@ -46,6 +46,14 @@ namespace HAL::STM32F4xx
 			RCC_RTCCLKCmd(new_state);
 		}
 
+		static inline auto
+		get_clocks_freq()
+		{
+			RCC_ClocksTypeDef clocks;
+			RCC_GetClocksFreq(&clocks);
+			return clocks;
+		}
+
 		struct AHB1
 		{
 			static inline void
@@ -2,6 +2,8 @@
 #define _DRIVER_SPI_
 
 #include "gpio.hpp"
+#include "dma.hpp"
+#include "rcc.hpp"
 #include "stm32f4xx_spi.h"
 
 namespace HAL::STM32F4xx
@@ -18,6 +20,34 @@ namespace HAL::STM32F4xx
 		using AF_t      = GPIO_t::AF_t;
 		using Speed_t   = GPIO_t::Speed_t;
 		using Data_t    = const uint8_t;
+		using Len_t     = uint32_t;
+
+		// DMA streams serving one SPI, `wait` blocks the caller until the TC or
+		// TE IRQ. A TE (which stops the stream) sets `err` through fail()
+		struct Dma_t
+		{
+			using Stream_t  = DMA_Stream_t&;
+			using Channel_t = const uint32_t;
+			using Wait_t    = void (*)();
+
+			Stream_t tx;
+			Channel_t tx_ch;
+			DMA_Stream_t* rx; // nullptr if TX only
+			Channel_t rx_ch;
+			Wait_t wait;
+
+			// Cleared by the driver once both streams are stopped
+			mutable volatile bool err = false;
+
+			// From a TE IRQ, true if the waiter is to be woken: once per failed
+			// transfer, the TE of its other stream finds `err` already set
+			inline bool fail() const
+			{
+				if (err) return false;
+				err = true;
+				return true;
+			}
+		};
 
 		SPI_t()                  = delete;
 		SPI_t(const Self_t& src) = delete;
@@ -148,6 +178,336 @@ namespace HAL::STM32F4xx
 			while (!get_flag_status(SPI_I2S_FLAG_TXE))
 				;
 		}
+
+		__attribute__((always_inline)) inline void
+		wait_flag(Flag_t flag) const
+		{
+			while (get_flag_status(flag) == RESET)
+				;
+		}
+
+		// Wait until the last frame has left the shifter
+		inline void
+		wait_idle() const
+		{
+			wait_flag(SPI_I2S_FLAG_TXE);
+			while (get_flag_status(SPI_I2S_FLAG_BSY) != RESET)
+				;
+		}
+
+		// Drop stale RX data and clear OVR after TX-only bursts
+		inline void
+		flush_rx()
+		{
+			(void) DR;
+			(void) SR;
+		}
+
+		inline bool
+		is_16bit() const
+		{
+			return CR1 & SPI_CR1_DFF;
+		}
+
+		// DFF may only change while SPE = 0
+		inline auto&
+		set_data_size(const uint16_t size)
+		{
+			if ((CR1 & SPI_CR1_DFF) == size) return *this;
+			wait_idle();
+			disable();
+			SPI_DataSizeConfig(this, size);
+			return enable();
+		}
+
+		// SPI1/4/5/6 run on APB2, SPI2/3 on APB1
+		inline uint32_t
+		get_pclk() const
+		{
+			const auto clocks = RCC_t::get_clocks_freq();
+			const auto addr   = (uintptr_t) this;
+			return (addr >= APB2PERIPH_BASE) ? clocks.PCLK2_Frequency : clocks.PCLK1_Frequency;
+		}
+
+		// Smallest divider (2 ~ 256) that keeps SCK at or below `hz`
+		static inline uint16_t
+		get_prescaler(uint32_t pclk, uint32_t hz)
+		{
+			uint16_t br = 0;
+			while (br < 7 && (pclk >> (br + 1)) > hz) {
+				br++;
+			}
+			return br << 3; // SPI_BaudRatePrescaler_x
+		}
+
+		inline uint32_t
+		get_baud_rate() const
+		{
+			return get_pclk() >> (((CR1 & SPI_CR1_BR) >> 3) + 1);
+		}
+
+		// BR may only change while the bus is idle
+		inline auto&
+		set_baud_rate_prescaler(const uint16_t prescaler)
+		{
+			if ((CR1 & SPI_CR1_BR) == prescaler) return *this;
+			wait_idle();
+			disable();
+			CR1 = (CR1 & ~SPI_CR1_BR) | prescaler;
+			return enable();
+		}
+
+		inline auto&
+		dma_tx_cmd(State_t new_state)
+		{
+			SPI_I2S_DMACmd(this, SPI_I2S_DMAReq_Tx, new_state);
+			return *this;
+		}
+
+		inline auto&
+		dma_tx_enable()
+		{
+			return dma_tx_cmd(ENABLE);
+		}
+
+		inline auto&
+		dma_tx_disable()
+		{
+			return dma_tx_cmd(DISABLE);
+		}
+
+		inline auto&
+		dma_rx_cmd(State_t new_state)
+		{
+			SPI_I2S_DMACmd(this, SPI_I2S_DMAReq_Rx, new_state);
+			return *this;
+		}
+
+		inline auto&
+		dma_rx_enable()
+		{
+			return dma_rx_cmd(ENABLE);
+		}
+
+		inline auto&
+		dma_rx_disable()
+		{
+			return dma_rx_cmd(DISABLE);
+		}
+
+		// Bind DMA streams to DR, call once before any DMA transfer
+		inline auto&
+		dma_init(const Dma_t& dma)
+		{
+			auto stream_init = [&](DMA_Stream_t& stream, uint32_t ch, uint32_t dir) {
+				stream.deinit().init({
+				    .DMA_Channel            = ch,
+				    .DMA_PeripheralBaseAddr = (uint32_t) (uintptr_t) &DR,
+				    .DMA_Memory0BaseAddr    = 0,
+				    .DMA_DIR                = dir,
+				    .DMA_BufferSize         = 1,
+				    .DMA_PeripheralInc      = DMA_PeripheralInc_Disable,
+				    .DMA_MemoryInc          = DMA_MemoryInc_Enable,
+				    .DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte,
+				    .DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte,
+				    .DMA_Mode               = DMA_Mode_Normal,
+				    .DMA_Priority           = DMA_Priority_High,
+				    .DMA_FIFOMode           = DMA_FIFOMode_Disable,
+				    .DMA_FIFOThreshold      = DMA_FIFOThreshold_Full,
+				    .DMA_MemoryBurst        = DMA_MemoryBurst_Single,
+				    .DMA_PeripheralBurst    = DMA_PeripheralBurst_Single,
+				});
+			};
+
+			stream_init(dma.tx, dma.tx_ch, DMA_DIR_MemoryToPeripheral);
+			if (dma.rx) {
+				stream_init(*dma.rx, dma.rx_ch, DMA_DIR_PeripheralToMemory);
+			}
+			return *this;
+		}
+
+		// Polled bulk write, `len` counts frames of the current data size
+		void write(const void* src, Len_t len)
+		{
+			if (is_16bit()) {
+				auto ptr = (const uint16_t*) src;
+				while (len--) {
+					wait_flag(SPI_I2S_FLAG_TXE);
+					DR = *ptr++;
+				}
+			}
+			else {
+				auto ptr = (const uint8_t*) src;
+				while (len--) {
+					wait_flag(SPI_I2S_FLAG_TXE);
+					DR = *ptr++;
+				}
+			}
+			wait_idle();
+		}
+
+		// Polled fill, the same frame `*val` is sent `len` times
+		void fill(const void* val, Len_t len)
+		{
+			const uint16_t frame = is_16bit() ? *(const uint16_t*) val : *(const uint8_t*) val;
+			while (len--) {
+				wait_flag(SPI_I2S_FLAG_TXE);
+				DR = frame;
+			}
+			wait_idle();
+		}
+
+		// Polled full-duplex transfer, 0xFF is clocked out if `tx` is nullptr
+		void transfer(const void* tx, void* rx, Len_t len)
+		{
+			const bool wide = is_16bit();
+			for (Len_t i = 0; i < len; i++) {
+				uint16_t out = 0xFFFF;
+				if (tx) out = wide ? ((const uint16_t*) tx)[i] : ((const uint8_t*) tx)[i];
+
+				wait_flag(SPI_I2S_FLAG_TXE);
+				DR = out;
+				wait_flag(SPI_I2S_FLAG_RXNE);
+				const uint16_t in = DR;
+
+				if (!rx) continue;
+				if (wide)
+					((uint16_t*) rx)[i] = in;
+				else
+					((uint8_t*) rx)[i] = in;
+			}
+		}
+
+		// Sleep in `dma.wait`, false after a TE. Both streams are then stopped
+		// and their flags cleared before `err` is, so a late TE IRQ of the
+		// failed transfer can't give the semaphore again and cut the next wait short
+		bool dma_wait(const Dma_t& dma)
+		{
+			dma.wait();
+			if (!dma.err) return true;
+
+			dma.tx.disable().wait_disabled();
+			dma.tx.clear_all_flags();
+			if (dma.rx) {
+				dma.rx->disable().wait_disabled();
+				dma.rx->clear_all_flags();
+			}
+			dma.err = false;
+			return false;
+		}
+
+		// Start a DMA write of at most 0xFFFF frames and return at once,
+		// `src` must stay untouched until write_wait
+		void write_start(const Dma_t& dma, const void* src, uint16_t len)
+		{
+			dma.tx.it_enable(DMA_IT_TC | DMA_IT_TE);
+			dma_tx_enable();
+			dma.tx.start(src, len, true, is_16bit());
+		}
+
+		// Sleep in `dma.wait` until the frames of write_start are out,
+		// false if the stream failed on the way
+		bool write_wait(const Dma_t& dma)
+		{
+			const bool ok = dma_wait(dma);
+			dma_tx_disable();
+			wait_idle();
+			flush_rx();
+			return ok;
+		}
+
+		// DMA bulk write, the caller sleeps in `dma.wait` while frames go out
+		bool write(const Dma_t& dma, const void* src, Len_t len)
+		{
+			if (!DMA_Stream_t::reachable(src)) {
+				write(src, len);
+				return true;
+			}
+
+			const bool wide = is_16bit();
+			auto ptr        = (const uint8_t*) src;
+
+			while (len) { // NDTR is only 16 bits wide
+				const uint16_t n = len > 0xFFFF ? 0xFFFF : len;
+				write_start(dma, ptr, n);
+				if (!write_wait(dma)) return false;
+				ptr += n << wide;
+				len -= n;
+			}
+			return true;
+		}
+
+		// DMA fill with a non-incrementing source, `val` must outlive the transfer
+		bool fill(const Dma_t& dma, const void* val, Len_t len)
+		{
+			if (!DMA_Stream_t::reachable(val)) {
+				fill(val, len);
+				return true;
+			}
+
+			const bool wide = is_16bit();
+			bool ok         = true;
+
+			dma.tx.it_enable(DMA_IT_TC | DMA_IT_TE);
+			dma_tx_enable();
+
+			while (ok && len) {
+				const uint16_t n = len > 0xFFFF ? 0xFFFF : len;
+				dma.tx.start(val, n, false, wide);
+				ok = dma_wait(dma);
+				len -= n;
+			}
+
+			dma_tx_disable();
+			wait_idle();
+			flush_rx();
+			return ok;
+		}
+
+		// DMA full-duplex transfer, wakes up on RX TC since RX finishes last,
+		// or on TE of either stream: both are stopped and it returns false.
+		// Polled without an RX stream or with a buffer the DMA can't reach
+		bool transfer(const Dma_t& dma, const void* tx, void* rx, Len_t len)
+		{
+			static const uint16_t filler = 0xFFFF;
+			static uint16_t sink;
+
+			if (!dma.rx || (tx && !DMA_Stream_t::reachable(tx)) || (rx && !DMA_Stream_t::reachable(rx))) {
+				transfer(tx, rx, len);
+				return true;
+			}
+
+			const bool wide = is_16bit();
+			auto tx_ptr     = (const uint8_t*) tx;
+			auto rx_ptr     = (uint8_t*) rx;
+			bool ok         = true;
+
+			flush_rx();
+			dma.tx.it_disable(DMA_IT_TC);
+			dma.tx.it_enable(DMA_IT_TE);
+			dma.rx->it_enable(DMA_IT_TC | DMA_IT_TE);
+
+			while (ok && len) {
+				const uint16_t n = len > 0xFFFF ? 0xFFFF : len;
+
+				dma.rx->start(rx_ptr ? (void*) rx_ptr : &sink, n, rx_ptr, wide);
+				dma_rx_enable();
+				dma.tx.start(tx_ptr ? (const void*) tx_ptr : &filler, n, tx_ptr, wide);
+				dma_tx_enable();
+
+				ok = dma_wait(dma);
+				dma_tx_disable();
+				dma_rx_disable();
+
+				if (tx_ptr) tx_ptr += n << wide;
+				if (rx_ptr) rx_ptr += n << wide;
+				len -= n;
+			}
+
+			wait_idle();
+			if (!ok) flush_rx();
+			return ok;
+		}
 	};
 }
 
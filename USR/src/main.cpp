@@ -27,6 +27,10 @@ int main()
 	// Create FatFs on SD card
 	Task::create(FileSys::init, &fatfs, 2, "fs/init");
 
+	// Block I/O worker for async requests, above the readers so a read-ahead
+	// fill starts its DMA at once and overlaps with them
+	Task::create(FileSys::Blk::server, nullptr, 1, "blk");
+
 	// Create Log System
 	Task::create(App::log_init, &sys_log, 2, "log/init");
 	/* User Tasks */
@@ -37,6 +41,9 @@ int main()
 
 	/* Test examples */
 	// Test::MutexTest();
+	// Test::SpiDmaTest();
+	// Test::LcdFpsTest();
+	// Test::LcdTextTest();
 	Test::MsgQueueTest();
 
 	// Start scheduling, never return
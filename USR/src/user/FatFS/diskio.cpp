@@ -9,18 +9,34 @@
 
 #include "diskio.h" /* FatFs lower layer API */
 #include "ff.h"
-#include "../../drivers/device/sd.hpp"
+#include "../../drivers/device/blk.hpp"
 
-using Driver::Device::SD_t;
-namespace MOS::User::Global
+using Driver::Device::BlkDev_t;
+
+/* ÿŶӦһ豸ʱ disk_attach ӳ */
+static BlkDev_t* disk_dev[_VOLUMES];
+static bool disk_ready[_VOLUMES];
+
+/*-----------------------------------------------------------------------*/
+/* ӳ豸                                                  */
+/*-----------------------------------------------------------------------*/
+DRESULT disk_attach(
+    BYTE pdrv,     /*  */
+    BlkDev_t* dev  /* 豸nullptr ʾȡӳ */
+)
 {
-	extern SD_t sd;
+	if (pdrv >= _VOLUMES) {
+		return RES_PARERR;
+	}
+	disk_dev[pdrv]   = dev;
+	disk_ready[pdrv] = false; /* ʱ³ʼ */
+	return RES_OK;
 }
-using MOS::User::Global::sd;
 
-/* Ϊÿ豸һ */
-#define ATA       0 // ԤSDʹ
-#define SPI_FLASH 1 // ⲿSPI Flash
+BlkDev_t* disk_device(BYTE pdrv)
+{
+	return (pdrv < _VOLUMES) ? disk_dev[pdrv] : nullptr;
+}
 
 /*-----------------------------------------------------------------------*/
 /* ȡ豸״̬                                                          */
@@ -30,19 +46,10 @@ DSTATUS disk_status(
     BYTE pdrv /*  */
 )
 {
-	DSTATUS status = STA_NOINIT;
-	switch (pdrv) {
-		case ATA: /* SD CARD */
-			status &= ~STA_NOINIT;
-			break;
-
-		case SPI_FLASH: /* SPI Flash */
-			break;
-
-		default:
-			status = STA_NOINIT;
+	if (!disk_device(pdrv)) {
+		return STA_NOINIT | STA_NODISK;
 	}
-	return status;
+	return disk_ready[pdrv] ? 0 : STA_NOINIT;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -52,22 +59,13 @@ DSTATUS disk_initialize(
     BYTE pdrv /*  */
 )
 {
-	DSTATUS status = STA_NOINIT;
-	switch (pdrv) {
-		case ATA: /* SD CARD */
-			if (sd.init() == SD_t::RESPONSE_NO_ERROR)
-				status &= ~STA_NOINIT;
-			else
-				status = STA_NOINIT;
-			break;
-
-		case SPI_FLASH: /* SPI Flash */
-			break;
-
-		default:
-			status = STA_NOINIT;
+	BlkDev_t* dev = disk_device(pdrv);
+	if (!dev) {
+		return STA_NOINIT | STA_NODISK;
 	}
-	return status;
+
+	disk_ready[pdrv] = (dev->init() == BlkDev_t::OK);
+	return disk_ready[pdrv] ? 0 : STA_NOINIT;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -80,32 +78,11 @@ DRESULT disk_read(
     UINT count    /* (1..128) */
 )
 {
-	DRESULT status       = RES_PARERR;
-	SD_t::Error SD_state = SD_t::RESPONSE_NO_ERROR;
-
-	switch (pdrv) {
-		case ATA: /* SD CARD */
-
-			SD_state = sd.read_multi_block(
-			    buff,
-			    sector * SD_t::BLOCK_SIZE,
-			    SD_t::BLOCK_SIZE,
-			    count
-			);
-
-			if (SD_state != SD_t::RESPONSE_NO_ERROR)
-				status = RES_PARERR;
-			else
-				status = RES_OK;
-			break;
-
-		case SPI_FLASH:
-			break;
-
-		default:
-			status = RES_PARERR;
+	BlkDev_t* dev = disk_device(pdrv);
+	if (!dev || !count) {
+		return RES_PARERR; /* Check parameter */
 	}
-	return status;
+	return (DRESULT) dev->read(buff, sector, count);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -120,34 +97,11 @@ DRESULT disk_write(
     UINT count        /* (1..128) */
 )
 {
-	DRESULT status       = RES_PARERR;
-	SD_t::Error SD_state = SD_t::RESPONSE_NO_ERROR;
-
-	if (!count) {
+	BlkDev_t* dev = disk_device(pdrv);
+	if (!dev || !count) {
 		return RES_PARERR; /* Check parameter */
 	}
-
-	switch (pdrv) {
-		case ATA: /* SD CARD */
-			SD_state = sd.write_multi_block(
-			    (uint8_t*) buff,
-			    sector * SD_t::BLOCK_SIZE,
-			    SD_t::BLOCK_SIZE,
-			    count
-			);
-			if (SD_state != SD_t::RESPONSE_NO_ERROR)
-				status = RES_PARERR;
-			else
-				status = RES_OK;
-			break;
-
-		case SPI_FLASH:
-			break;
-
-		default:
-			status = RES_PARERR;
-	}
-	return status;
+	return (DRESULT) dev->write(buff, sector, count);
 }
 
 #endif
@@ -163,39 +117,47 @@ DRESULT disk_ioctl(
     void* buff /* д߶ȡݵַָ */
 )
 {
-	DRESULT status = RES_PARERR;
-	switch (pdrv) {
-		case ATA: /* SD CARD */
-			switch (cmd) {
-				// Get R/W sector size (WORD)
-				case GET_SECTOR_SIZE:
-					*(WORD*) buff = SD_t::BLOCK_SIZE;
-					break;
-				// Get erase block size in unit of sector (DWORD)
-				case GET_BLOCK_SIZE:
-					*(DWORD*) buff = 1;
-					break;
-
-				case GET_SECTOR_COUNT:
-					*(DWORD*) buff = sd.info.capacity / sd.info.block_size;
-					break;
-				case CTRL_SYNC:
-					break;
-			}
-			status = RES_OK;
+	BlkDev_t* dev = disk_device(pdrv);
+	if (!dev) {
+		return RES_PARERR;
+	}
+
+	uint32_t arg[2] = {0, 0}; /* DWORD  64 λ */
+	DRESULT status  = RES_PARERR;
+
+	switch (cmd) {
+		// Get R/W sector size (WORD)
+		case GET_SECTOR_SIZE:
+			status        = (DRESULT) dev->ioctl(BlkDev_t::SECTOR_SIZE, arg);
+			*(WORD*) buff = arg[0];
 			break;
 
-		case SPI_FLASH:
+		// Get erase block size in unit of sector (DWORD)
+		case GET_BLOCK_SIZE:
+			status         = (DRESULT) dev->ioctl(BlkDev_t::BLOCK_SIZE, arg);
+			*(DWORD*) buff = arg[0];
 			break;
 
-		default:
-			status = RES_PARERR;
+		case GET_SECTOR_COUNT:
+			status         = (DRESULT) dev->ioctl(BlkDev_t::SECTOR_COUNT, arg);
+			*(DWORD*) buff = arg[0];
+			break;
+
+		case CTRL_SYNC:
+			status = (DRESULT) dev->ioctl(BlkDev_t::SYNC, arg);
+			break;
+
+		case CTRL_TRIM:
+			arg[0] = ((DWORD*) buff)[0];
+			arg[1] = ((DWORD*) buff)[1];
+			status = (DRESULT) dev->ioctl(BlkDev_t::TRIM, arg);
+			break;
 	}
 	return status;
 }
 #endif
 
-__WEAK DWORD get_fattime(void)
+__attribute__((weak)) DWORD get_fattime(void)
 {
 	/* صǰʱ */
 	return ((DWORD) (2024 - 1980) << 25) /* Year 2024 */
@@ -74,6 +74,12 @@ DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 
 #ifdef __cplusplus
 }
+
+/* Block devices behind the physical drives, mapped at runtime */
+namespace Driver::Device { struct BlkDev_t; }
+
+DRESULT disk_attach (BYTE pdrv, Driver::Device::BlkDev_t* dev);	/* nullptr unmaps the drive */
+Driver::Device::BlkDev_t* disk_device (BYTE pdrv);
 #endif
 
 #endif
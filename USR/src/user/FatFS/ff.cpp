@@ -2565,6 +2565,7 @@ FRESULT f_open (
 			fp->fsize = LD_DWORD(dir + DIR_FileSize);	/* File size */
 			fp->fptr = 0;						/* File pointer */
 			fp->dsect = 0;
+			fp->bounce = 0;
 #if _USE_FASTSEEK
 			fp->cltbl = 0;						/* Normal seek mode */
 #endif
@@ -2594,6 +2595,7 @@ FRESULT f_read (
 	DWORD clst, sect, remain;
 	UINT rcnt, cc;
 	BYTE csect, *rbuff = (BYTE*)buff;
+	DWORD ncl;
 
 
 	*br = 0;	/* Clear read byte counter */
@@ -2631,8 +2633,20 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fp->fs);				/* When remaining bytes >= sector size, */
 			if (cc) {							/* Read maximum contiguous sectors directly */
-				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
+				if (csect + cc > fp->fs->csize) {	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
+					while (btr / SS(fp->fs) >= cc + fp->fs->csize) {	/* ...unless the next cluster follows on the disk */
+#if _USE_FASTSEEK
+						if (fp->cltbl)
+							ncl = clmt_clust(fp, fp->fptr + cc * SS(fp->fs));
+						else
+#endif
+							ncl = get_fat(fp->fs, fp->clust);
+						if (ncl != fp->clust + 1) break;	/* Fragment ends (or an error, met again below) */
+						fp->clust = ncl;
+						cc += fp->fs->csize;
+					}
+				}
 				if (disk_read(fp->fs->drv, rbuff, sect, cc) != RES_OK)
 					ABORT(fp->fs, FR_DISK_ERR);
 #if !_FS_READONLY && _FS_MINIMIZE <= 2			/* Replace one of the read sectors with cached data if it contains a dirty sector */
@@ -2640,8 +2654,10 @@ FRESULT f_read (
 				if (fp->fs->wflag && fp->fs->winsect - sect < cc)
 					mem_cpy(rbuff + ((fp->fs->winsect - sect) * SS(fp->fs)), fp->fs->win, SS(fp->fs));
 #else
-				if ((fp->flag & FA__DIRTY) && fp->dsect - sect < cc)
+				if ((fp->flag & FA__DIRTY) && fp->dsect - sect < cc) {
 					mem_cpy(rbuff + ((fp->dsect - sect) * SS(fp->fs)), fp->buf, SS(fp->fs));
+					fp->bounce += SS(fp->fs);
+				}
 #endif
 #endif
 				rcnt = SS(fp->fs) * cc;			/* Number of bytes transferred */
@@ -2671,6 +2687,7 @@ FRESULT f_read (
 #else
 		mem_cpy(rbuff, &fp->buf[fp->fptr % SS(fp->fs)], rcnt);	/* Pick partial sector */
 #endif
+		fp->bounce += rcnt;
 	}
 
 	LEAVE_FF(fp->fs, FR_OK);
@@ -2692,7 +2709,7 @@ FRESULT f_write (
 )
 {
 	FRESULT res;
-	DWORD clst, sect;
+	DWORD clst, sect, ncl;
 	UINT wcnt, cc;
 	const BYTE *wbuff = (const BYTE*)buff;
 	BYTE csect;
@@ -2746,8 +2763,20 @@ FRESULT f_write (
 			sect += csect;
 			cc = btw / SS(fp->fs);			/* When remaining bytes >= sector size, */
 			if (cc) {						/* Write maximum contiguous sectors directly */
-				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
+				if (csect + cc > fp->fs->csize) {	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
+					while (btw / SS(fp->fs) >= cc + fp->fs->csize) {	/* ...unless the next cluster follows on the disk */
+#if _USE_FASTSEEK
+						if (fp->cltbl)
+							ncl = clmt_clust(fp, fp->fptr + cc * SS(fp->fs));
+						else
+#endif
+							ncl = create_chain(fp->fs, fp->clust);	/* A new one stays linked when it doesn't follow */
+						if (ncl != fp->clust + 1) break;	/* Fragment ends (or an error, met again below) */
+						fp->clust = ncl;
+						cc += fp->fs->csize;
+					}
+				}
 				if (disk_write(fp->fs->drv, wbuff, sect, cc) != RES_OK)
 					ABORT(fp->fs, FR_DISK_ERR);
 #if _FS_MINIMIZE <= 2
@@ -2791,6 +2820,7 @@ FRESULT f_write (
 		mem_cpy(&fp->buf[fp->fptr % SS(fp->fs)], wbuff, wcnt);	/* Fit partial sector */
 		fp->flag |= FA__DIRTY;
 #endif
+		fp->bounce += wcnt;
 	}
 
 	if (fp->fptr > fp->fsize) fp->fsize = fp->fptr;	/* Update file size if needed */
@@ -3519,6 +3549,93 @@ FRESULT f_truncate (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Allocate a Contiguous Cluster Run to an Empty File                    */
+/*-----------------------------------------------------------------------*/
+/* The file takes fsz bytes at once, in clusters that follow each other, so
+/  its data can go to the drive as sectors from *sect on without looking at
+/  the FAT. The data is undefined until written, f_lseek() + f_truncate()
+/  gives back what was not used.
+*/
+
+FRESULT f_prealloc (
+	FIL* fp,		/* Pointer to the file object, empty and open for writing */
+	DWORD fsz,		/* Number of bytes to allocate */
+	DWORD* sect		/* Pointer to return the first sector of the run */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD csz, n, clst, scl, run, cs, i;
+
+
+	res = validate(fp);						/* Check validity of the object */
+	if (res == FR_OK) {
+		if (fp->err) {						/* Check error */
+			res = (FRESULT)fp->err;
+		} else {
+			if (!(fp->flag & FA_WRITE))		/* Check access mode */
+				res = FR_DENIED;
+			else if (fp->sclust || !fsz)	/* Only an empty file gets a run */
+				res = FR_INVALID_PARAMETER;
+		}
+	}
+	if (res == FR_OK) {
+		fs = fp->fs;
+		csz = (DWORD)fs->csize * SS(fs);
+		n = fsz / csz + (fsz % csz != 0);	/* Number of clusters needed, fsz + csz - 1 could wrap */
+		if (n > fs->n_fatent - 2) res = FR_DENIED;	/* More than the volume has */
+	}
+	if (res == FR_OK) {
+		/* Find n free clusters in a row, from the last allocated one on, once around the FAT */
+		clst = fs->last_clust + 1;
+		if (clst < 2 || clst >= fs->n_fatent) clst = 2;
+		scl = clst; run = 0;
+		for (i = 2; ; i++) {
+			cs = get_fat(fs, clst);
+			if (cs == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+			if (cs == 1) { res = FR_INT_ERR; break; }
+			if (cs == 0) {
+				if (!run) scl = clst;		/* Top of a new run */
+				if (++run == n) break;
+			} else {
+				run = 0;
+			}
+			if (++clst >= fs->n_fatent) {	/* Wrap around, a run doesn't */
+				clst = 2; run = 0;
+			}
+			if (i >= fs->n_fatent) { res = FR_DENIED; break; }	/* No run long enough */
+		}
+
+		if (res == FR_OK) {					/* Link the run from its tail, so a failure leaves a chain to free */
+			for (i = n; i && (res = put_fat(fs, scl + i - 1, (i < n) ? scl + i : 0x0FFFFFFF)) == FR_OK; i--) ;
+			if (res != FR_OK && i < n) {	/* Give back clusters i..n-1, linked already */
+				if (fs->free_clust != 0xFFFFFFFF) fs->free_clust -= n - i;
+				remove_chain(fs, scl + i);
+			}
+		}
+
+		if (res == FR_OK) {
+			fs->last_clust = scl + n - 1;	/* Update FSINFO */
+			if (fs->free_clust != 0xFFFFFFFF) {
+				fs->free_clust -= n;
+				fs->fsi_flag |= 1;
+			}
+			fp->sclust = scl;
+			fp->fsize = fsz;
+			fp->flag |= FA__WRITTEN;
+			*sect = clust2sect(fs, scl);
+		} else if (res != FR_DENIED) {
+			fp->err = (FRESULT)res;
+		}
+	}
+
+	LEAVE_FF(fp->fs, res);
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Delete a File or Directory                                            */
 /*-----------------------------------------------------------------------*/
@@ -121,6 +121,7 @@ typedef struct {
 	DWORD	sclust;			/* File start cluster (0:no cluster chain, always 0 when fsize is 0) */
 	DWORD	clust;			/* Current cluster of fpter (not valid when fprt is 0) */
 	DWORD	dsect;			/* Sector number appearing in buf[] (0:invalid) */
+	DWORD	bounce;			/* Bytes copied through buf[] instead of moved directly (Zeroed on file open) */
 #if !_FS_READONLY
 	DWORD	dir_sect;		/* Sector number containing the directory entry */
 	BYTE*	dir_ptr;		/* Pointer to the directory entry in the win[] */
@@ -216,6 +217,7 @@ FRESULT f_write (FIL* fp, const void* buff, UINT btw, UINT* bw);	/* Write data t
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
 FRESULT f_lseek (FIL* fp, DWORD ofs);								/* Move file pointer of a file object */
 FRESULT f_truncate (FIL* fp);										/* Truncate file */
+FRESULT f_prealloc (FIL* fp, DWORD fsz, DWORD* sect);				/* Allocate a contiguous cluster run to an empty file */
 FRESULT f_sync (FIL* fp);											/* Flush cached data of a writing file */
 FRESULT f_opendir (DIR* dp, const TCHAR* path);						/* Open a directory */
 FRESULT f_closedir (DIR* dp);										/* Close an open directory */
@@ -345,6 +347,34 @@ int ff_del_syncobj (_SYNC_t sobj);				/* Delete a sync object */
 
 #ifdef __cplusplus
 }
+
+#if _FS_REENTRANT
+/* Volume lock behind ff_req_grant()/ff_rel_grant(), the O/S wait is plugged in
+   with ff_attach_os() (option/syscall.cpp) */
+struct FsLock_t
+{
+	struct Os_t
+	{
+		bool (*take)(BYTE vol, UINT ticks);	/* false: timed out */
+		void (*give)(BYTE vol);
+		UINT (*ticks)(void);
+	};
+
+	BYTE	vol;
+	bool	ready;			/* The O/S object has been given its token */
+	volatile bool held;
+
+	struct
+	{
+		DWORD	grants, timeouts;
+		DWORD	waits;				/* Grants that found the volume held */
+		DWORD	wait_sum, wait_max;	/* Ticks spent in those */
+	} stat;
+};
+
+void ff_attach_os (const FsLock_t::Os_t& os);
+const FsLock_t* ff_lock (BYTE vol);	/* Lock of a volume, for its stats */
+#endif
 #endif
 
 #endif /* _FATFS */
@@ -1,5 +1,5 @@
 /*------------------------------------------------------------------------*/
-/* Sample code of OS dependent controls for FatFs                         */
+/* OS dependent controls for FatFs, on ChaN's sample                      */
 /* (C)ChaN, 2014                                                          */
 /*------------------------------------------------------------------------*/
 
@@ -9,7 +9,36 @@
 
 #if _FS_REENTRANT
 /*------------------------------------------------------------------------*/
-/* Create a Synchronization Object
+/* Volume locks on the MOS kernel                                         */
+/*------------------------------------------------------------------------*/
+/* One lock per volume, so tasks on different drives never wait for each
+/  other. The wait itself belongs to the kernel and is plugged in with
+/  ff_attach_os(), until then (and on the host) every grant succeeds.
+*/
+
+static FsLock_t Locks[_VOLUMES];
+static const FsLock_t::Os_t* Os;
+
+
+void ff_attach_os (
+	const FsLock_t::Os_t& os	/* Kernel side of the locks */
+)
+{
+	Os = &os;
+}
+
+
+const FsLock_t* ff_lock (
+	BYTE vol	/* Logical drive number */
+)
+{
+	return (vol < _VOLUMES) ? &Locks[vol] : 0;
+}
+
+
+
+/*------------------------------------------------------------------------*/
+/* Create a Synchronization Object                                        */
 /*------------------------------------------------------------------------*/
 /* This function is called in f_mount() function to create a new
 /  synchronization object, such as semaphore and mutex. When a 0 is returned,
@@ -21,22 +50,17 @@ int ff_cre_syncobj (	/* !=0:Function succeeded, ==0:Could not create due to any
 	_SYNC_t *sobj		/* Pointer to return the created sync object */
 )
 {
-	int ret;
+	FsLock_t* lock = &Locks[vol];
 
 
-	*sobj = CreateMutex(NULL, FALSE, NULL);		/* Win32 */
-	ret = (int)(*sobj != INVALID_HANDLE_VALUE);
+	lock->vol = vol;
+	if (Os && !lock->ready) {	/* The kernel object is static, it gets its token once */
+		Os->give(vol);
+		lock->ready = true;
+	}
+	*sobj = lock;				/* Stats survive a remount */
 
-//	*sobj = SyncObjects[vol];			/* uITRON (give a static created sync object) */
-//	ret = 1;							/* The initial value of the semaphore must be 1. */
-
-//	*sobj = OSMutexCreate(0, &err);		/* uC/OS-II */
-//	ret = (int)(err == OS_NO_ERR);
-
-//	*sobj = xSemaphoreCreateMutex();	/* FreeRTOS */
-//	ret = (int)(*sobj != NULL);
-
-	return ret;
+	return 1;
 }
 
 
@@ -53,20 +77,9 @@ int ff_del_syncobj (	/* !=0:Function succeeded, ==0:Could not delete due to any
 	_SYNC_t sobj		/* Sync object tied to the logical drive to be deleted */
 )
 {
-	int ret;
-
-
-	ret = CloseHandle(sobj);	/* Win32 */
-
-//	ret = 1;					/* uITRON (nothing to do) */
-
-//	OSMutexDel(sobj, OS_DEL_ALWAYS, &err);	/* uC/OS-II */
-//	ret = (int)(err == OS_NO_ERR);
-
-//  vSemaphoreDelete(sobj);		/* FreeRTOS */
-//	ret = 1;
+	(void)sobj;			/* Static, kept for the next f_mount() */
 
-	return ret;
+	return 1;
 }
 
 
@@ -82,18 +95,27 @@ int ff_req_grant (	/* 1:Got a grant to access the volume, 0:Could not get a gran
 	_SYNC_t sobj	/* Sync object to wait */
 )
 {
-	int ret;
-
-	ret = (int)(WaitForSingleObject(sobj, _FS_TIMEOUT) == WAIT_OBJECT_0);	/* Win32 */
-
-//	ret = (int)(wai_sem(sobj) == E_OK);			/* uITRON */
-
-//	OSMutexPend(sobj, _FS_TIMEOUT, &err));		/* uC/OS-II */
-//	ret = (int)(err == OS_NO_ERR);
-
-//	ret = (int)(xSemaphoreTake(sobj, _FS_TIMEOUT) == pdTRUE);	/* FreeRTOS */
-
-	return ret;
+	const bool busy = sobj->held;	/* Only a hint, it picks what gets timed */
+	UINT t0 = 0, dt;
+
+
+	if (Os && sobj->ready) {
+		if (busy) t0 = Os->ticks();
+		if (!Os->take(sobj->vol, _FS_TIMEOUT)) {
+			sobj->stat.timeouts++;
+			return 0;
+		}
+		if (busy) {					/* Under the lock from here on */
+			dt = Os->ticks() - t0;
+			sobj->stat.waits++;
+			sobj->stat.wait_sum += dt;
+			if (dt > sobj->stat.wait_max) sobj->stat.wait_max = dt;
+		}
+	}
+	sobj->held = true;
+	sobj->stat.grants++;
+
+	return 1;
 }
 
 
@@ -108,13 +130,8 @@ void ff_rel_grant (
 	_SYNC_t sobj	/* Sync object to be signaled */
 )
 {
-	ReleaseMutex(sobj);		/* Win32 */
-
-//	sig_sem(sobj);			/* uITRON */
-
-//	OSMutexPost(sobj);		/* uC/OS-II */
-
-//	xSemaphoreGive(sobj);	/* FreeRTOS */
+	sobj->held = false;
+	if (Os && sobj->ready) Os->give(sobj->vol);
 }
 
 #endif
@@ -6,12 +6,12 @@
 #include "src/core/shell.hpp"
 
 #include "src/user/global.hpp"
+#include "src/user/display.hpp"
 #include "src/user/gui/GuiLite.h"
 
 // GIFs
-#include "src/user/img/face_gif/frames.h"
-#include "src/user/img/mac_gif/frames.h"
-#include "src/user/img/cat_gif/frames.h"
+#include "src/user/img/cat_gif/rle.h"
+#include "src/user/img/cat_gif/dirty.h"
 
 namespace MOS::User::App
 {
@@ -26,7 +26,11 @@ namespace MOS::User::App
 		using Global::lcd;
 
 		extern "C" void
-		gui_delay_ms(uint32_t ms) { Task::delay(ms); }
+		gui_delay_ms(uint32_t ms)
+		{
+			lcd.flush(); // GuiLite sleeps between frames
+			Task::delay(ms);
+		}
 
 		extern "C" void
 		gfx_draw_pixel(int32_t x, int32_t y, uint32_t rgb)
@@ -34,6 +38,22 @@ namespace MOS::User::App
 			lcd.draw_point(x, y, (Color) GL_RGB_32_to_16(rgb));
 		}
 
+		extern "C" void
+		gfx_fill_rect(
+		    int32_t x0, int32_t y0,
+		    int32_t x1, int32_t y1,
+		    uint32_t rgb
+		)
+		{
+			lcd.fill_rect(x0, y0, x1, y1, (Color) GL_RGB_32_to_16(rgb));
+		}
+
+		extern "C" void
+		gfx_mark_dirty(int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+		{
+			lcd.mark_dirty(x0, y0, x1, y1);
+		}
+
 		struct EXTERNAL_GFX_OP
 		{
 			using DrawPixelFn_t = void (*)(
@@ -63,26 +83,32 @@ namespace MOS::User::App
 	void gui()
 	{
 		using namespace GUI;
-		EXTERNAL_GFX_OP gfx_op {gfx_draw_pixel, nullptr};
-		startHello3D(
-		    nullptr, lcd.width, lcd.height,
-		    1, &gfx_op
+		EXTERNAL_GFX_OP gfx_op {gfx_draw_pixel, gfx_fill_rect};
+		startHello3D( // c_surface on lcd.fb if attached, c_surface_no_fb otherwise
+		    lcd.fb, lcd.width, lcd.height,
+		    lcd.fb ? 2 : 1, &gfx_op
 		);
 	}
 
 	void lcd_init(Device::ST7735S_t& lcd)
 	{
-		// A mutex wrapper of lcd&
-		static Sync::Mutex_t lcd_mtx {lcd};
-
 		auto GIF = [] {
-			while (true) {
-				for (auto frame: cat_gif) {
-					lcd_mtx.lock().get().draw_img(
-					    0, 0, 128, 128, frame
-					);
-					Task::delay(25_ms);
-				}
+			constexpr auto N = sizeof(cat_rle) / sizeof(*cat_rle);
+
+			static Display::Pacer_t pacer {"gif", 30};
+			Display::add_pacer(pacer);
+
+			// Full first frame, then only what changed since the previous one
+			Display::blit(0, 0, cat_rle[0]);
+			pacer.start();
+
+			for (uint32_t i = 0, skip = pacer.wait();;) {
+				i = (i + 1 + skip) % N;
+				if (skip) // 跳帧后差分矩形失效，整帧重绘
+					Display::blit(0, 0, cat_rle[i]);
+				else
+					Display::blit(0, 0, cat_rle[i], cat_dirty[i], cat_dirty_cnt[i]);
+				skip = pacer.wait();
 			}
 		};
 
@@ -95,15 +121,15 @@ namespace MOS::User::App
 
 			while (true) {
 				for (auto color: rgb) {
-					lcd_mtx.lock().get().show_str(
-					    5, 132, "hello, world!", color
-					);
+					Display::text(5, 132, "hello, world!", color);
 					Task::delay(250_ms);
 				}
 			}
 		};
 
+		// The display server owns the panel from here on
 		auto pri = Task::current()->get_pri();
+		Task::create(Display::server, &lcd, pri, "disp");
 		Task::create(GIF, nullptr, pri, "gif");
 		Task::create(Slogan, nullptr, pri, "slogan");
 	}
@@ -168,7 +194,7 @@ namespace MOS::User::App
 		auto runner = [](auto rx) {
 			if (atoi(rx) % 10 == 0) {
 				kprintf("[esp32] -> %s\n", rx);
-				Global::sys_log_q.send(rx);
+				Global::sys_log_q.send(Global::LogRec_t {rx}); // rx is reused by the next line
 			}
 		};
 
@@ -177,28 +203,26 @@ namespace MOS::User::App
 		}
 	}
 
-	void log_init(Sync::Mutex_t<FileSys::File_t>& sys_log)
+	void log_init(Sync::Mutex_t<FileSys::LogFile_t>& sys_log)
 	{
 		using OpenMode = FileSys::File_t::OpenMode;
 
-		static auto& log_mtx {sys_log}; // 系统日志文件
+		static auto& log_mtx {sys_log}; // 系统日志文件, 由 'log' 任务保持打开
+
+		static struct
+		{
+			uint32_t poll_max; // ticks, longest flush/sync/rotation of the task
+		} log_stat;
 
+		// Copies the record at once, the shell reuses its line buffer
 		static auto lgw_cmd = [](auto text) {
 			auto mtx_grd = log_mtx.lock();
 			auto& log    = mtx_grd.get();
 
-			// 打开文件，如果文件不存在则创建它
-			auto res = log.open("0:log.txt", OpenMode::Write);
-
-			if (res == FR_OK) { // 将指定存储区内容写入到文件内
-				auto [_, num] = log.write((void*) text, strlen(text));
-				MOS_MSG("W(%d) <- \"%s\"", num, text);
-			}
-			else {
-				MOS_MSG("File open failed!");
-			}
-
-			log.close(); // 关闭文件
+			if (log.put(text, strlen(text), Kernel::Global::os_ticks))
+				MOS_MSG("W(%d) <- \"%s\"", strlen(text), text);
+			else
+				MOS_MSG("Log dropped!");
 		};
 
 		static auto cat_cmd = [](auto name) {
@@ -220,38 +244,147 @@ namespace MOS::User::App
 				*dest = '\0'; // 确保目标字符串以'\0'结尾
 			};
 
-			auto mtx_grd = log_mtx.lock();
-			auto& log    = mtx_grd.get();
+			// Only the shell reads, FatFs locks the volume per call, so the
+			// log writer's file lock stays out of the way
+			static FileSys::RawFile_t raw;
+			FileSys::File_t file {raw};
 
 			char dir[16] = "0:", r_buf[32] = "";
 			get_path(dir, name);
 
 			// 打开文件，如果文件不存在则创建它
-			auto res = log.open(dir, OpenMode::Read);
+			auto res = file.open(dir, OpenMode::Read);
 
 			if (res == FR_OK) { // 将文件内容读取到缓冲区
-				auto [_, num] = log.read((void*) r_buf, sizeof(r_buf));
+				auto [_, num] = file.read((void*) r_buf, sizeof(r_buf));
 				MOS_MSG("R(%d) -> \"%s\"", num, r_buf);
 			}
 			else {
-				MOS_MSG("File open failed!");
+				MOS_MSG("File open failed! (%d)", res);
 			}
+		};
+
+		// log read cmd, through the open log file (it is locked for others)
+		auto lgr_cmd = [](auto _) {
+			auto mtx_grd = log_mtx.lock();
+			auto& log    = mtx_grd.get();
 
-			log.close(); // 关闭文件
+			char r_buf[32] = "";
+			UINT num       = 0;
+
+			auto res = log.read(0, r_buf, sizeof(r_buf) - 1, &num);
+			if (res == FR_OK)
+				MOS_MSG("R(%d) -> \"%s\"", num, r_buf);
+			else
+				MOS_MSG("Bad:(%d)", res);
+		};
+
+		// log appender stats
+		auto lgs_cmd = [](auto _) {
+			auto mtx_grd   = log_mtx.lock();
+			const auto& st = mtx_grd.get().stat;
+
+			MOS_MSG(
+			    "log: %d records, %d bytes, %d dropped, %d sectors in %d writes, "
+			    "%d syncs, %d rotations, %d errors, max %d ms",
+			    st.records, st.bytes, st.dropped, st.sectors, st.writes,
+			    st.syncs, st.rotations, st.errors, log_stat.poll_max
+			);
+		};
+
+		// SD card bus and programming stats
+		auto sd_cmd = [](auto _) {
+			using Global::sd;
+
+			const auto& busy = sd.busy;
+			const auto& h    = busy.hist;
+
+			MOS_MSG(
+			    "sd: %d kHz, %d step downs, crc %s, %d bad blocks, %d retries, %d dma errors",
+			    sd.clk / 1000, sd.step_cnt, sd.crc_on ? "on" : "off", sd.crc_errs, sd.retry_cnt, sd.dma_errs
+			);
+			MOS_MSG(
+			    "  busy: %d waits, avg %d max %d ms, %d timeouts, "
+			    "<1/<4/<16/<64/<256/more ms: %d %d %d %d %d %d",
+			    busy.cnt, busy.sum / (busy.cnt ? busy.cnt : 1), busy.max, busy.timeouts,
+			    h[0], h[1], h[2], h[3], h[4], h[5]
+			);
+		};
+
+		// Block devices behind the FatFs drives
+		auto blk_cmd = [](auto _) {
+			for (uint8_t drv = 0; drv < _VOLUMES; drv++) {
+				const auto dev = disk_device(drv);
+				if (!dev) continue;
+
+				const auto& st = dev->stat;
+				MOS_MSG(
+				    "%d: %s, %d sectors, rd %d/%d, wr %d/%d (ops/sectors), %d syncs, %d trims (%d cut), %d errors, %d async",
+				    drv, dev->name, dev->sectors(),
+				    st.rd_ops, st.rd_sectors, st.wr_ops, st.wr_sectors,
+				    st.syncs, st.trims, st.trim_cut, st.errors, st.async
+				);
+
+				if (const auto ra = dev->ra) {
+					MOS_MSG(
+					    "   read-ahead %d x %d sectors, %d hits, %d misses, %d fills (%d late, %d wasted)",
+					    ra->SLOTS, ra->len, ra->stat.hits, ra->stat.misses,
+					    ra->stat.fills, ra->stat.late, ra->stat.wasted
+					);
+				}
+
+				if (const auto c = dev->cache) {
+					const auto looked = c->stat.hits + c->stat.misses;
+					MOS_MSG(
+					    "   cache %d lines, hit %d%% (%d/%d), %d writes absorbed, %d written back, %d dirty",
+					    c->n, looked ? c->stat.hits * 100 / looked : 0, c->stat.hits, looked,
+					    c->stat.absorbed, c->stat.write_backs, c->stat.dirty
+					);
+				}
+			}
+		};
+
+		// FatFs volume locks, waits are grants that found the volume held
+		auto fs_cmd = [](auto _) {
+			for (uint8_t vol = 0; vol < _VOLUMES; vol++) {
+				const auto& st = ff_lock(vol)->stat;
+				MOS_MSG(
+				    "%d: %d grants, %d waits, avg %d max %d ms, %d timeouts",
+				    vol, st.grants, st.waits, st.wait_sum / (st.waits ? st.waits : 1),
+				    st.wait_max, st.timeouts
+				);
+			}
 		};
 
-		// log read cmd
-		auto lgr_cmd = [](auto _) { cat_cmd("log.txt"); };
 		Shell::add_usr_cmd({"cat", cat_cmd});
 		Shell::add_usr_cmd({"lgr", lgr_cmd});
 		Shell::add_usr_cmd({"lgw", lgw_cmd});
+		Shell::add_usr_cmd({"lgs", lgs_cmd});
+		Shell::add_usr_cmd({"sd", sd_cmd});
+		Shell::add_usr_cmd({"blk", blk_cmd});
+		Shell::add_usr_cmd({"fs", fs_cmd});
 
+		// Drains sys_log_q into the RAM buffer, the card only sees whole sectors
+		// and the syncs of the policy, so producers wait at most one of those
 		static auto log = [] {
 			while (true) {
-				Global::sys_log_q.recv(1000_ms).ok_or(
-					[](auto msg) { lgw_cmd(msg); },
-					[] { /* oops */ }
-				);
+				auto [status, rec] = Global::sys_log_q.recv(100_ms);
+
+				auto mtx_grd = log_mtx.lock();
+				auto& log    = mtx_grd.get();
+
+				if (!log.opened) {
+					log.open(); // fails until fs/init has mounted "0:", put() counts the drops
+				}
+
+				const auto t0 = Kernel::Global::os_ticks;
+				if (status) {
+					log.put(rec.text, rec.len, t0);
+				}
+				log.poll(t0);
+
+				const auto dt = Kernel::Global::os_ticks - t0;
+				if (dt > log_stat.poll_max) log_stat.poll_max = dt;
 			}
 		};
 
@@ -141,6 +141,7 @@ namespace MOS::User::BSP
 		    );
 
 		lcd.init();
+		lcd.attach_fb(Global::lcd_fb);
 	}
 
 	static inline void
@@ -174,9 +175,50 @@ namespace MOS::User::BSP
 		        GPIO_High_Speed
 		    );
 
+		// CRC checked transfers, so the clock can go up to the SPI limit
+		sd.crc_mode = true;
+
+		// Yield to other tasks while the card is busy programming
+		sd.attach_os(Global::sd_os);
+
 		// The 'sd.init()' will be called by FatFs
 	}
 
+	static inline void
+	Disk_Config()
+	{
+		using namespace Global;
+
+		// Async worker of the block devices
+		BlkDev_t::attach_os(FileSys::Blk::os);
+
+		// Per-volume FatFs locks, given their tokens by f_mount()
+		ff_attach_os(FileSys::Vol::os);
+
+		// Erases one allocation unit at a time (750 ms busy allowance each), and
+		// starts none after 250 ms, so a TRIM stays within _FS_TIMEOUT
+		sd_blk.split_trim(SD_t::ERASE_AU_BLOCKS, _FS_TIMEOUT - (SD_t::BUSY_TIMEOUT + SD_t::ERASE_AU_MS));
+
+		// FatFs drives: "0:" SD card behind the SPI5 lock, "1:" RAM disk
+		disk_attach(0, &sd_blk.attach_lock(FileSys::Blk::sd_lock).attach_read_ahead(sd_ra).attach_cache(sd_cache));
+		disk_attach(1, &ram_blk);
+	}
+
+	static inline void
+	DMA_Config()
+	{
+		RCC_t::AHB1::enable(RCC_AHB1Periph_DMA2);
+
+		NVIC_t::init(DMA2_Stream3_IRQn, 1, 1, ENABLE);
+		NVIC_t::init(DMA2_Stream4_IRQn, 1, 1, ENABLE);
+		NVIC_t::init(DMA2_Stream5_IRQn, 1, 1, ENABLE);
+
+		Global::lcd.spi.dma_init(Global::lcd_dma);
+		Global::sd.spi.dma_init(Global::sd_dma);
+		Global::lcd.attach_dma(Global::lcd_dma);
+		Global::sd.attach_dma(Global::sd_dma);
+	}
+
 	static inline void
 	RTC_Config()
 	{
@@ -254,6 +296,8 @@ namespace MOS::User::BSP
 		K1_IRQ_Config();
 		LCD_Config();
 		SD_Config();
+		Disk_Config();
+		DMA_Config();
 		RTC_Config();
 		SysTick_Config();
 	}
@@ -290,6 +334,27 @@ namespace MOS::ISR
 			});
 		}
 
+		void DMA2_Stream3_IRQHandler() // SD SPI5_RX DMA
+		{
+			using namespace User::Global;
+			sd_dma.rx->handle_it(DMA_IT_TCIF3, [] { sd_dma_done.up_from_isr(); });
+			sd_dma.rx->handle_it(DMA_IT_TEIF3, [] { if (sd_dma.fail()) sd_dma_done.up_from_isr(); });
+		}
+
+		void DMA2_Stream4_IRQHandler() // SD SPI5_TX DMA
+		{
+			using namespace User::Global;
+			sd_dma.tx.handle_it(DMA_IT_TCIF4, [] { sd_dma_done.up_from_isr(); });
+			sd_dma.tx.handle_it(DMA_IT_TEIF4, [] { if (sd_dma.fail()) sd_dma_done.up_from_isr(); });
+		}
+
+		void DMA2_Stream5_IRQHandler() // LCD SPI1_TX DMA
+		{
+			using namespace User::Global;
+			lcd_dma.tx.handle_it(DMA_IT_TCIF5, [] { lcd_dma_done.up_from_isr(); });
+			lcd_dma.tx.handle_it(DMA_IT_TEIF5, [] { if (lcd_dma.fail()) lcd_dma_done.up_from_isr(); });
+		}
+
 		void USART2_IRQHandler() // ESP32C3 WiFi Module I/O
 		{
 			User::Global::esp32.read_line([] {});
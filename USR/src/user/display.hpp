@@ -0,0 +1,319 @@
+#ifndef _MOS_USER_DISPLAY_
+#define _MOS_USER_DISPLAY_
+
+#include "src/core/kernel.hpp"
+#include "src/core/shell.hpp"
+
+#include "src/user/global.hpp"
+
+// Display server: one task owns the panel, producers only enqueue draw commands
+namespace MOS::User::Display
+{
+	using namespace Kernel;
+	using namespace Utils;
+
+	using Driver::Device::ST7735S_t;
+	using Driver::Device::Rle565_t;
+
+	using Pixel_t = ST7735S_t::Pixel_t;
+	using Color   = ST7735S_t::Color;
+	using Rects_t = const uint8_t (*)[4];
+
+	struct Cmd_t
+	{
+		enum Op : uint8_t
+		{
+			BLIT, // raw RGB565 image
+			RLE,  // compressed image
+			FILL,
+			TEXT,
+			OP_CNT,
+		};
+
+		Op op;
+		Color color;
+		Pixel_t x, y, w, h; // 覆盖区域, w = 0 表示未知
+
+		union
+		{
+			const Pixel_t* img;
+			const Rle565_t* rle;
+			const char* str; // must outlive the command
+		};
+
+		Rects_t rects; // dirty rects of BLIT/RLE, nullptr for the whole image
+		uint16_t cnt;
+		uint32_t t_send; // os_ticks at enqueue
+
+		// Every pixel of the area gets overwritten
+		inline bool opaque() const { return w && !rects; }
+
+		inline bool covers(const Cmd_t& cmd) const
+		{
+			return cmd.w &&
+			       x <= cmd.x && cmd.x + cmd.w <= x + w &&
+			       y <= cmd.y && cmd.y + cmd.h <= y + h;
+		}
+	};
+
+	constexpr auto QUEUE_LEN = 8;
+
+	IPC::MsgQueue_t<Cmd_t, QUEUE_LEN> queue;
+
+	struct
+	{
+		uint32_t depth, depth_max; // 队列深度
+		uint32_t cmds, dropped;    // dropped: covered by a later command of the same batch
+		uint32_t batches, bytes;   // bytes sent to the panel
+
+		struct
+		{
+			uint32_t cnt, sum, max; // enqueue -> on the panel, in ticks
+		} lat[Cmd_t::OP_CNT];
+	} stat;
+
+	inline void post(Cmd_t cmd)
+	{
+		cmd.t_send = Kernel::Global::os_ticks;
+		{
+			IrqGuard_t guard;
+			if (++stat.depth > stat.depth_max)
+				stat.depth_max = stat.depth;
+		}
+		queue.send(cmd);
+	}
+
+	inline void blit(
+	    Pixel_t x, Pixel_t y,
+	    Pixel_t w, Pixel_t h,
+	    const Pixel_t* img,
+	    Rects_t rects = nullptr, uint16_t cnt = 0
+	)
+	{
+		Cmd_t cmd {.op = Cmd_t::BLIT, .x = x, .y = y, .w = w, .h = h};
+		cmd.img   = img;
+		cmd.rects = rects;
+		cmd.cnt   = cnt;
+		post(cmd);
+	}
+
+	inline void blit(
+	    Pixel_t x, Pixel_t y,
+	    const Rle565_t& rle,
+	    Rects_t rects = nullptr, uint16_t cnt = 0
+	)
+	{
+		Cmd_t cmd {.op = Cmd_t::RLE, .x = x, .y = y, .w = rle.w, .h = rle.h};
+		cmd.rle   = &rle;
+		cmd.rects = rects;
+		cmd.cnt   = cnt;
+		post(cmd);
+	}
+
+	inline void fill(
+	    Pixel_t x0, Pixel_t y0,
+	    Pixel_t x1, Pixel_t y1,
+	    Color color
+	)
+	{
+		Cmd_t cmd {
+		    .op    = Cmd_t::FILL,
+		    .color = color,
+		    .x     = x0,
+		    .y     = y0,
+		    .w     = (Pixel_t) (x1 - x0 + 1),
+		    .h     = (Pixel_t) (y1 - y0 + 1),
+		};
+		post(cmd);
+	}
+
+	// Opaque text, the area is only known if it fits on one line
+	inline void text(Pixel_t x, Pixel_t y, const char* str, Color color)
+	{
+		Cmd_t cmd {.op = Cmd_t::TEXT, .color = color, .x = x, .y = y};
+		cmd.str = str;
+
+		const Pixel_t n = strlen(str);
+		if (n && !strchr(str, '\n') &&
+		    x + 8 * (n - 1) <= Global::lcd.width - 16 &&
+		    y <= Global::lcd.height - 16) {
+			cmd.w = 8 * n;
+			cmd.h = 16;
+		}
+		post(cmd);
+	}
+
+	inline void exec(ST7735S_t& lcd, const Cmd_t& cmd)
+	{
+		switch (cmd.op) {
+			case Cmd_t::BLIT:
+				if (cmd.rects)
+					lcd.draw_rects(cmd.x, cmd.y, cmd.w, cmd.img, cmd.rects, cmd.cnt);
+				else
+					lcd.draw_img(cmd.x, cmd.y, cmd.w, cmd.h, cmd.img);
+				break;
+
+			case Cmd_t::RLE:
+				if (cmd.rects)
+					lcd.draw_rle_rects(cmd.x, cmd.y, *cmd.rle, cmd.rects, cmd.cnt);
+				else
+					lcd.draw_rle(cmd.x, cmd.y, *cmd.rle);
+				break;
+
+			case Cmd_t::FILL:
+				lcd.fill_rect(cmd.x, cmd.y, cmd.x + cmd.w - 1, cmd.y + cmd.h - 1, cmd.color);
+				break;
+
+			case Cmd_t::TEXT:
+				lcd.show_str(cmd.x, cmd.y, cmd.str, cmd.color);
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	// Paces an animation against absolute tick deadlines, late frames are skipped
+	struct Pacer_t
+	{
+		static constexpr auto BINS = 8; // frame time histogram, period / 4 per bin
+
+		const char* name;
+		uint32_t fps, period; // period in ticks
+		uint32_t next, last;  // deadline of the next frame, start of the last one
+		uint32_t frames, dropped;
+		uint32_t hist[BINS];
+
+		Pacer_t(const char* name, uint32_t fps)
+		    : name(name), fps(fps), period(Macro::SYSTICK / fps) {}
+
+		inline void start() { next = last = Kernel::Global::os_ticks; }
+
+		// Sleep until the next frame is due, returns how many frames to skip
+		inline uint32_t wait()
+		{
+			uint32_t skip = 0, now = Kernel::Global::os_ticks;
+
+			next += period;
+			if ((int32_t) (now - next) >= (int32_t) period) { // 落后一帧以上
+				skip = (now - next) / period;
+				next += skip * period;
+				dropped += skip;
+			}
+
+			if ((int32_t) (next - now) > 0) {
+				Task::delay(next - now);
+			}
+
+			now            = Kernel::Global::os_ticks;
+			const auto bin = (now - last) * 4 / period;
+			hist[bin < BINS ? bin : BINS - 1] += 1;
+			frames += 1;
+			last = now;
+
+			return skip;
+		}
+	};
+
+	// Pacers shown by the 'fps' command
+	Pacer_t* pacers[4];
+
+	inline void add_pacer(Pacer_t& pacer)
+	{
+		for (auto& slot: pacers) {
+			if (!slot) {
+				slot = &pacer;
+				return;
+			}
+		}
+	}
+
+	void server(ST7735S_t& lcd)
+	{
+		static Cmd_t batch[QUEUE_LEN];
+		static bool skip[QUEUE_LEN];
+
+		auto disp_cmd = [](auto argv) {
+			MOS_MSG(
+			    "disp: depth %d/%d, cmds %d, dropped %d, %d B/batch",
+			    stat.depth, stat.depth_max, stat.cmds, stat.dropped,
+			    stat.bytes / (stat.batches ? stat.batches : 1)
+			);
+
+			constexpr const char* name[] = {"blit", "rle", "fill", "text"};
+			for (uint32_t op = 0; op < Cmd_t::OP_CNT; op++) {
+				const auto& lat = stat.lat[op];
+				MOS_MSG(
+				    "  %s: %d cmds, latency avg %d max %d ticks",
+				    name[op], lat.cnt, lat.sum / (lat.cnt ? lat.cnt : 1), lat.max
+				);
+			}
+		};
+
+		auto fps_cmd = [](auto argv) {
+			for (auto pacer: pacers) {
+				if (!pacer) continue;
+				const auto& h = pacer->hist;
+				MOS_MSG(
+				    "%s: %d fps, %d frames, %d dropped, "
+				    "frame time (period/4 bins): %d %d %d %d %d %d %d %d",
+				    pacer->name, pacer->fps, pacer->frames, pacer->dropped,
+				    h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7]
+				);
+			}
+		};
+
+		Shell::add_usr_cmd({"disp", disp_cmd});
+		Shell::add_usr_cmd({"fps", fps_cmd});
+
+		while (true) {
+			uint32_t n = 0;
+
+			// Block for the first command, then drain what's already queued
+			do {
+				auto [status, cmd] = queue.recv(n ? 10_ms : 1000_ms);
+				if (!status) break;
+				{
+					IrqGuard_t guard;
+					stat.depth--;
+				}
+				batch[n++] = cmd;
+			} while (n < QUEUE_LEN && stat.depth > 0);
+
+			if (!n) continue;
+
+			// Coalesce, drop what a later opaque command paints over anyway
+			for (uint32_t i = 0; i < n; i++) {
+				skip[i] = false;
+				for (uint32_t j = i + 1; j < n; j++) {
+					if (batch[j].opaque() && batch[j].covers(batch[i])) {
+						skip[i] = true;
+						stat.dropped++;
+						break;
+					}
+				}
+			}
+
+			const auto sent = lcd.tx_bytes;
+			for (uint32_t i = 0; i < n; i++) {
+				if (!skip[i]) exec(lcd, batch[i]);
+			}
+			lcd.flush();
+
+			const auto now = Kernel::Global::os_ticks;
+			for (uint32_t i = 0; i < n; i++) {
+				auto& lat     = stat.lat[batch[i].op];
+				const auto dt = now - batch[i].t_send;
+				lat.cnt += 1;
+				lat.sum += dt;
+				if (dt > lat.max) lat.max = dt;
+			}
+
+			stat.cmds += n;
+			stat.batches += 1;
+			stat.bytes += lcd.tx_bytes - sent;
+		}
+	}
+}
+
+#endif
@@ -1,8 +1,12 @@
 #ifndef _MOS_FATFS_
 #define _MOS_FATFS_
 
-#include "src/core/kernel/utils.hpp"
+#include "src/core/kernel.hpp"
+#include "src/drivers/device/blk.hpp"
 #include "fatfs/ff.h"
+#include "fatfs/diskio.h"
+#include "src/user/file.hpp"
+#include "src/user/log_file.hpp"
 
 namespace MOS::FileSys
 {
@@ -24,103 +28,88 @@ namespace MOS::FileSys
 			f_mount(NULL, path, opt);
 		}
 
-		MOS_INLINE auto // 文件系统格式化
-		mkfs(Path_t path = "0:")
+		MOS_INLINE auto // 文件系统格式化, sfd = 1 不建分区表 (小容量设备)
+		mkfs(Path_t path = "0:", Opt_t sfd = 0)
 		{
-			return f_mkfs(path, 0, 0);
+			return f_mkfs(path, sfd, 0);
 		}
 
-		struct File_t
-		{
-			using Raw_t  = FIL;
-			using Path_t = const TCHAR*;
-			using Buf_t  = void*;
-			using Res_t  = FRESULT;
-			using Len_t  = UINT;
-
-			enum class OpenMode : BYTE
-			{
-				Read  = FA_OPEN_EXISTING | FA_READ,
-				Write = FA_CREATE_ALWAYS | FA_WRITE,
-			};
-
-			Raw_t& raw;
-
-			MOS_INLINE auto // 打开文件，如果文件不存在则创建它
-			open(Path_t path, OpenMode mode)
-			{
-				return f_open(&raw, path, (BYTE) mode);
-			}
-
-			MOS_INLINE auto
-			close() { return f_close(&raw); }
+		using File_t    = FileSys::File_t;
+		using RawFile_t = File_t::Raw_t;
+	};
 
-			MOS_INLINE ~File_t() { close(); }
+	using RawFile_t = FatFs::RawFile_t;
 
-			MOS_INLINE auto
-			read(const Buf_t buf, Len_t len)
-			{
-				struct ReadRes_t
-				{
-					Res_t fres;
-					Len_t fnum;
-				} res;
+	// Block devices under the FatFs drives: the SD card's SPI5 lock is shared
+	// by sync calls and the worker, the RAM disk takes none, async requests run in 'blk'
+	namespace Blk
+	{
+		using namespace Kernel;
+		using namespace Utils;
+		using Driver::Device::BlkDev_t;
+		using Req_t = BlkDev_t::Req_t;
 
-				res.fres = f_read(
-				    &raw,
-				    buf,
-				    len,
-				    &res.fnum
-				);
+		constexpr auto QUEUE_LEN = 8;
+		constexpr auto FLUSH_MS  = 1000; // longest a cached sector stays dirty
 
-				return res;
-			}
+		Sync::Sema_t spi5 {1};
+		IPC::MsgQueue_t<Req_t*, QUEUE_LEN> queue;
 
-			MOS_INLINE auto
-			write(Buf_t src, Len_t len)
-			{
-				struct WriteRes_t
-				{
-					Res_t fres;
-					Len_t fnum;
-				} res;
-
-				res.fres = f_write(
-				    &raw,
-				    src,
-				    len,
-				    &res.fnum
-				);
-
-				return res;
-			}
-
-			MOS_INLINE auto
-			append(Buf_t src, Len_t len)
-			{
-				struct WriteRes_t
-				{
-					Res_t fres;
-					Len_t fnum;
-				} res;
+		const BlkDev_t::Lock_t sd_lock {
+		    [] { spi5.down(); },
+		    [] { spi5.up(); },
+		};
 
-				res.fres = f_lseek(&raw, f_size(&raw));
+		const BlkDev_t::Os_t os {
+		    [](Req_t& req) { // blocks while the queue is full
+			    queue.send(&req);
+			    return true;
+		    },
+		    [] { return (uint32_t) Kernel::Global::os_ticks; },
+		};
 
-				if (res.fres != FR_OK) {
-					return res;
+		// Write back held back sectors once the oldest of them waited FLUSH_MS
+		void age_flush()
+		{
+			const uint32_t now = Kernel::Global::os_ticks;
+			for (uint8_t drv = 0; drv < _VOLUMES; drv++) {
+				const auto dev = disk_device(drv);
+				if (dev && dev->cache && dev->cache->stat.dirty && now - dev->cache->since >= FLUSH_MS) {
+					dev->flush();
 				}
+			}
+		}
 
-				res.fres = f_write(&raw, src, len, &res.fnum);
-				return res;
+		// Checks the age after every request too, so steady traffic (read-ahead
+		// fills keep coming while a file streams) doesn't hold the write back off
+		void server()
+		{
+			while (true) {
+				auto [ok, req] = queue.recv(FLUSH_MS);
+				if (ok) BlkDev_t::exec(*req);
+				age_flush();
 			}
-		};
+		}
+	}
 
-		using File_t    = FatFs::File_t;
-		using RawFile_t = File_t::Raw_t;
-	};
+	// FatFs volume locks (_FS_REENTRANT), one per drive so the SD card and the
+	// RAM disk never wait for each other. Sema_t::down() can't time out, a
+	// one-slot queue holding a token can: take = recv, give = send
+	namespace Vol
+	{
+		using namespace Kernel;
 
-	using File_t    = FatFs::File_t;
-	using RawFile_t = FatFs::RawFile_t;
+		IPC::MsgQueue_t<bool, 1> grant[_VOLUMES];
+
+		const FsLock_t::Os_t os {
+		    [](BYTE vol, UINT ticks) {
+			    auto [ok, _] = grant[vol].recv(ticks);
+			    return (bool) ok;
+		    },
+		    [](BYTE vol) { grant[vol].send(true); },
+		    [] { return (UINT) Kernel::Global::os_ticks; },
+		};
+	}
 
 	void init(FatFs& fs)
 	{
@@ -183,6 +172,21 @@ namespace MOS::FileSys
 			}
 		};
 
+		// Scratch volume on the RAM disk, formatted without a partition table on
+		// every boot: whatever FAT a warm reset left in the buffer is never trusted
+		auto ram_mnt = [] {
+			static FatFs ram_fs;
+
+			auto res = ram_fs.mount("1:", 0);
+			if (res == FR_OK) res = ram_fs.mkfs("1:", 1);
+			if (res == FR_OK) res = ram_fs.mount("1:", 1);
+
+			if (res == FR_OK)
+				MOS_MSG("RAM disk mnt!");
+			else
+				MOS_MSG("RAM disk bad:(%d)", res);
+		};
+
 		auto r_test = [&] {
 			static BYTE r_buf[64] = {0}; /* 读缓冲区 */
 
@@ -217,6 +221,7 @@ namespace MOS::FileSys
 		mnt_or_fmt();
 		w_test();
 		r_test();
+		ram_mnt();
 		kprintf("-------------------------------------\n\n");
 
 		// fs.umount();
@@ -0,0 +1,199 @@
+#ifndef _MOS_USER_FILE_
+#define _MOS_USER_FILE_
+
+#include "FatFS/ff.h"
+#include "FatFS/diskio.h"
+#include "../drivers/stm32f4xx/dma.hpp"
+
+namespace MOS::FileSys
+{
+	// A FIL with the calls the tasks use, no kernel calls so the host
+	// simulator builds it too. FatFs locks the volume per call
+	struct File_t
+	{
+		using Raw_t  = FIL;
+		using Path_t = const TCHAR*;
+		using Buf_t  = void*;
+		using Res_t  = FRESULT;
+		using Len_t  = UINT;
+
+		enum class OpenMode : BYTE
+		{
+			Read  = FA_OPEN_EXISTING | FA_READ,
+			Write = FA_CREATE_ALWAYS | FA_WRITE,
+		};
+
+		Raw_t& raw;
+		DWORD sect0 = 0; // first sector of a preallocated file
+
+		inline auto // 打开文件，如果文件不存在则创建它
+		open(Path_t path, OpenMode mode)
+		{
+			return f_open(&raw, path, (BYTE) mode);
+		}
+
+		inline auto
+		close() { return f_close(&raw); }
+
+		inline ~File_t() { close(); }
+
+		inline auto
+		read(const Buf_t buf, Len_t len)
+		{
+			struct ReadRes_t
+			{
+				Res_t fres;
+				Len_t fnum;
+			} res;
+
+			res.fres = f_read(
+			    &raw,
+			    buf,
+			    len,
+			    &res.fnum
+			);
+
+			return res;
+		}
+
+		inline auto
+		write(Buf_t src, Len_t len)
+		{
+			struct WriteRes_t
+			{
+				Res_t fres;
+				Len_t fnum;
+			} res;
+
+			res.fres = f_write(
+			    &raw,
+			    src,
+			    len,
+			    &res.fnum
+			);
+
+			return res;
+		}
+
+		inline auto
+		append(Buf_t src, Len_t len)
+		{
+			struct WriteRes_t
+			{
+				Res_t fres;
+				Len_t fnum;
+			} res;
+
+			res.fres = f_lseek(&raw, f_size(&raw));
+
+			if (res.fres != FR_OK) {
+				return res;
+			}
+
+			res.fres = f_write(&raw, src, len, &res.fnum);
+			return res;
+		}
+
+		// Zero-copy variants: a word aligned buffer the DMA can reach, a sector
+		// aligned file position and whole sectors, so FatFs moves all of it
+		// with multi-sector disk_read/disk_write. FR_INVALID_PARAMETER otherwise
+		inline bool
+		direct(const Buf_t buf, Len_t len) const
+		{
+			return !((uintptr_t) buf % 4) && !(len % _MIN_SS) && !(f_tell(&raw) % _MIN_SS) &&
+			       HAL::STM32F4xx::DMA_Stream_t::reachable(buf);
+		}
+
+		inline auto
+		read_direct(Buf_t buf, Len_t len)
+		{
+			return direct(buf, len) ? read(buf, len)
+			                        : decltype(read(buf, len)) {FR_INVALID_PARAMETER, 0};
+		}
+
+		inline auto
+		write_direct(Buf_t src, Len_t len)
+		{
+			return direct(src, len) ? write(src, len)
+			                        : decltype(write(src, len)) {FR_INVALID_PARAMETER, 0};
+		}
+
+		// Bytes copied through the file's sector buffer since open(),
+		// 0 as long as only the direct variants were used
+		inline auto
+		bounced() const { return raw.bounce; }
+
+		inline auto
+		seek(DWORD ofs) { return f_lseek(&raw, ofs); }
+
+		inline auto
+		size() const { return f_size(&raw); }
+
+		// Fast seek: map the cluster chain into `tbl` once, then seek()
+		// reads no FAT. Takes 2 items per fragment + 1, on FR_NOT_ENOUGH_CORE
+		// tbl[0] holds what it needed. The table stays linked until close()
+		// or disable_fast_seek(), the file can't grow meanwhile
+		inline auto
+		enable_fast_seek(DWORD* tbl, UINT len)
+		{
+			tbl[0]    = len;
+			raw.cltbl = tbl;
+
+			const auto res = f_lseek(&raw, CREATE_LINKMAP);
+			if (res != FR_OK) {
+				raw.cltbl = nullptr;
+			}
+			return res;
+		}
+
+		template <size_t N>
+		inline auto
+		enable_fast_seek(DWORD (&tbl)[N])
+		{
+			return enable_fast_seek(tbl, N);
+		}
+
+		inline void
+		disable_fast_seek() { raw.cltbl = nullptr; }
+
+		// Contiguous file: `size` bytes in one cluster run for an empty file
+		// opened for writing. The data then goes to the block device as
+		// sectors with write_sectors(), no FAT lookups on the way. finish()
+		// sets the size to what was written and frees the rest of the run
+		inline auto
+		preallocate(DWORD size) { return f_prealloc(&raw, size, &sect0); }
+
+		inline auto
+		write_sectors(const Buf_t src, DWORD ofs, UINT count)
+		{
+			if (!sect0 || !count || (ofs + count - 1) * _MIN_SS >= size()) {
+				return FR_INVALID_PARAMETER;
+			}
+			return disk_write(raw.fs->drv, (const BYTE*) src, sect0 + ofs, count) == RES_OK
+			           ? FR_OK
+			           : FR_DISK_ERR;
+		}
+
+		inline auto
+		read_sectors(Buf_t dst, DWORD ofs, UINT count)
+		{
+			if (!sect0 || !count || (ofs + count - 1) * _MIN_SS >= size()) {
+				return FR_INVALID_PARAMETER;
+			}
+			return disk_read(raw.fs->drv, (BYTE*) dst, sect0 + ofs, count) == RES_OK
+			           ? FR_OK
+			           : FR_DISK_ERR;
+		}
+
+		inline auto
+		finish(DWORD size)
+		{
+			auto res = seek(size);
+			if (res == FR_OK) res = f_truncate(&raw);
+			sect0 = 0;
+			return res;
+		}
+	};
+}
+
+#endif
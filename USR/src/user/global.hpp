@@ -29,9 +29,30 @@ namespace MOS::User::Global
 
 	// File System Components
 	FatFs fatfs;
-	RawFile_t raw_sys_log;
-	Mutex_t sys_log {File_t {raw_sys_log}};
-	MsgQueue_t<const char*, 2> sys_log_q;
+
+	// System log, kept open by the 'log' task: records gather in 4 KB of RAM,
+	// whole sectors go to the card, f_sync every 16 KB or second, rotated at 1 MB
+	uint8_t sys_log_buf[8 * LogFile_t::SECTOR];
+	Mutex_t sys_log {LogFile_t {
+	    {"0:log.txt", 1024 * 1024, 2, 16 * 1024, 1000},
+	    sys_log_buf, sizeof(sys_log_buf)
+	}};
+
+	// A record queued for the 'log' task, copied: producers reuse their line
+	// buffers long before the task gets to a deep queue. Longer text is cut
+	struct LogRec_t
+	{
+		static constexpr uint8_t LEN = 32;
+
+		char text[LEN];
+		uint8_t len;
+
+		LogRec_t() = default;
+		LogRec_t(const char* src)
+		    : len(strnlen(src, LEN)) { memcpy(text, src, len); }
+	};
+
+	MsgQueue_t<LogRec_t, 32> sys_log_q;
 
 	template <size_t N>
 	struct SyncUartDev_t
@@ -83,6 +104,13 @@ namespace MOS::User::Global
 	    {GPIOB,  GPIO_Pin_9}, // DC(RS)     -> PB9
 	};
 
+	// LCD framebuffer, 128x160 RGB565 = 40 KB
+	// Define LCD_FB_CCMRAM to move it into CCMRAM, flush() then runs without DMA
+#ifdef LCD_FB_CCMRAM
+	__attribute__((section(".ccmbss")))
+#endif
+	ST7735S_t::Pixel_t lcd_fb[128 * 160];
+
 	// SD Card with SPI Driver
 	SD_t sd {
 	    SPI5,
@@ -91,6 +119,51 @@ namespace MOS::User::Global
 	    {GPIOF, GPIO_Pin_9}, // PF9 -> MOSI
 	    {GPIOE, GPIO_Pin_3}, // PE3 -> CS
 	};
+
+	// RAM disk for scratch files, 128 sectors (the f_mkfs minimum)
+	// Kept in CCMRAM unless the LCD framebuffer took it, only the CPU touches it.
+	// Not zeroed at startup, it holds garbage or a warm reset's leftovers until formatted
+#ifndef LCD_FB_CCMRAM
+	__attribute__((section(".ccmbss")))
+#endif
+	uint8_t ram_disk_buf[128 * RamDisk_t::SECTOR_SIZE];
+	RamDisk_t ram_disk {ram_disk_buf, sizeof(ram_disk_buf)};
+
+	// SD read-ahead, 2 x 8 sectors in SRAM so the SPI5 DMA can fill them
+	uint8_t sd_ra_buf[2 * 8 * SD_t::BLOCK_SIZE];
+	ReadAhead_t sd_ra {sd_ra_buf, sizeof(sd_ra_buf)};
+
+	// SD write-back cache for FAT and directory sectors, 16 lines in SRAM
+	Cache_t::Line_t sd_cache_line[16];
+	uint8_t sd_cache_buf[16 * SD_t::BLOCK_SIZE];
+	Cache_t sd_cache {sd_cache_line, sd_cache_buf, 16};
+
+	// Block devices, mapped onto FatFs drives in bsp.hpp
+	BlkDev_t sd_blk {"sd", sd_blk_ops, &sd};
+	BlkDev_t ram_blk {"ram", ram_disk_ops, &ram_disk};
+
+	// DMA completion, signaled by TC and TE IRQs in bsp.hpp
+	Sema_t lcd_dma_done {0}, sd_dma_done {0};
+
+	// LCD SPI1 DMA
+	SPI_t::Dma_t lcd_dma {
+	    convert(DMA2_Stream5), DMA_Channel_3, // SPI1_TX -> DMA2_Stream5
+	    nullptr, 0,
+	    [] { lcd_dma_done.down(); },
+	};
+
+	// SD Card busy wait, sleeps the writer while the card programs (1 tick = 1 ms)
+	SD_t::Os_t sd_os {
+	    [](uint32_t ms) { Kernel::Task::delay(ms); },
+	    [] { return (uint32_t) Kernel::Global::os_ticks; },
+	};
+
+	// SD Card SPI5 DMA
+	SPI_t::Dma_t sd_dma {
+	    convert(DMA2_Stream4), DMA_Channel_2,  // SPI5_TX -> DMA2_Stream4
+	    &convert(DMA2_Stream3), DMA_Channel_2, // SPI5_RX -> DMA2_Stream3
+	    [] { sd_dma_done.down(); },
+	};
 }
 
 #endif
\ No newline at end of file
@@ -13,6 +13,30 @@
 static c_surface* s_surface;
 static c_display* s_display;
 
+// Tell the LCD driver which part of phy_fb changed
+extern "C" void gfx_mark_dirty(int x0, int y0, int x1, int y1);
+
+// Surface on a physical framebuffer that reports its writes
+class c_surface_fb : public c_surface
+{
+public:
+	c_surface_fb(unsigned int width, unsigned int height, unsigned int color_bytes, Z_ORDER_LEVEL max_zorder = Z_ORDER_LEVEL_0)
+	    : c_surface(width, height, color_bytes, max_zorder) {}
+
+protected:
+	virtual void draw_pixel_on_fb(int x, int y, unsigned int rgb)
+	{
+		c_surface::draw_pixel_on_fb(x, y, rgb);
+		gfx_mark_dirty(x, y, x, y);
+	}
+
+	virtual void fill_rect_on_fb(int x0, int y0, int x1, int y1, unsigned int rgb)
+	{
+		c_surface::fill_rect_on_fb(x0, y0, x1, y1, rgb);
+		gfx_mark_dirty(x0, y0, x1, y1);
+	}
+};
+
 // 3D engine
 inline void
 multiply(int m, int n, int p, float* a, float* b, float* c) // a[m][n] * b[n][p] = c[m][p]
@@ -233,7 +257,7 @@ void create_ui(
 )
 {
 	if (phy_fb) {
-		static c_surface surface(UI_WIDTH, UI_HEIGHT, color_bytes, Z_ORDER_LEVEL_0);
+		static c_surface_fb surface(UI_WIDTH, UI_HEIGHT, color_bytes, Z_ORDER_LEVEL_0);
 		static c_display display(phy_fb, screen_width, screen_height, &surface);
 		s_surface = &surface;
 		s_display = &display;
@@ -0,0 +1,26 @@
+#ifndef _CAT_GIF_DIRTY_
+#define _CAT_GIF_DIRTY_
+
+// Generated by tools/gif_dirty.py, do not edit
+// Dirty rectangles {x0, y0, x1, y1} of each frame against the previous one
+
+#include <stdint.h>
+
+// 227 rects, ~29219 bytes (full frame: 32768)
+static constexpr uint8_t cat_dirty_0[][4] = {{46, 0, 126, 0}, {1, 0, 17, 1}, {28, 0, 35, 1}, {52, 1, 54, 1}, {64, 1, 71, 1}, {84, 1, 89, 1}, {102, 1, 107, 1}, {119, 1, 127, 1}, {0, 2, 8, 2}, {18, 2, 26, 2}, {37, 2, 45, 2}, {55, 2, 66, 2}, {77, 2, 79, 2}, {92, 2, 127, 2}, {0, 3, 127, 3}, {0, 4, 89, 4}, {102, 4, 127, 4}, {1, 5, 107, 5}, {117, 5, 126, 5}, {0, 6, 127, 6}, {4, 7, 109, 7}, {120, 7, 126, 7}, {0, 8, 25, 8}, {37, 8, 44, 8}, {57, 8, 58, 8}, {72, 8, 127, 8}, {0, 9, 16, 9}, {31, 9, 34, 9}, {64, 9, 69, 9}, {80, 9, 82, 9}, {6, 10, 31, 10}, {44, 9, 53, 10}, {98, 9, 127, 10}, {0, 11, 54, 11}, {65, 10, 72, 11}, {82, 10, 90, 11}, {104, 11, 109, 11}, {120, 11, 127, 11}, {3, 12, 72, 12}, {85, 12, 126, 12}, {3, 13, 127, 13}, {1, 14, 9, 14}, {20, 14, 91, 14}, {101, 14, 106, 14}, {117, 14, 125, 14}, {0, 15, 81, 15}, {93, 15, 127, 15}, {1, 16, 9, 16}, {19, 16, 122, 16}, {1, 17, 79, 17}, {90, 17, 117, 17}, {0, 18, 36, 18}, {46, 18, 102, 18}, {0, 19, 45, 20}, {55, 19, 63, 20}, {71, 19, 81, 20}, {91, 19, 127, 20}, {1, 21, 127, 21}, {0, 22, 54, 22}, {65, 22, 108, 22}, {119, 22, 127, 22}, {0, 23, 73, 24}, {80, 23, 90, 24}, {101, 23, 127, 24}, {0, 25, 47, 25}, {57, 25, 127, 25}, {3, 26, 62, 26}, {72, 26, 80, 26}, {93, 26, 126, 26}, {0, 27, 47, 27}, {58, 27, 127, 27}, {0, 28, 68, 28}, {82, 28, 96, 28}, {115, 28, 127, 28}, {1, 29, 126, 29}, {83, 30, 88, 30}, {98, 30, 124, 30}, {0, 30, 72, 31}, {83, 31, 107, 31}, {118, 31, 127, 31}, {0, 32, 127, 34}, {1, 35, 89, 35}, {99, 35, 126, 35}, {1, 36, 21, 36}, {37, 36, 73, 36}, {1, 37, 44, 37}, {54, 37, 66, 37}, {84, 36, 127, 37}, {1, 38, 25, 38}, {35, 38, 45, 38}, {2, 39, 7, 39}, {18, 39, 42, 39}, {57, 38, 126, 39}, {0, 40, 32, 40}, {44, 40, 92, 40}, {111, 40, 127, 40}, {65, 41, 85, 41}, {16, 41, 54, 42}, {66, 42, 71, 42}, {83, 42, 90, 42}, {101, 41, 127, 42}, {0, 41, 7, 43}, {16, 43, 25, 43}, {40, 43, 127, 43}, {1, 44, 15, 44}, {31, 44, 63, 44}, {74, 44, 89, 44}, {105, 44, 109, 44}, {119, 44, 127, 44}, {13, 45, 29, 45}, {42, 45, 126, 45}, {0, 46, 127, 47}, {13, 48, 126, 48}, {22, 49, 33, 49}, {45, 49, 115, 49}, {125, 49, 125, 49}, {0, 49, 9, 50}, {35, 50, 35, 50}, {45, 50, 90, 50}, {102, 50, 126, 50}, {13, 51, 16, 51}, {27, 51, 28, 51}, {41, 51, 127, 51}, {8, 52, 90, 52}, {101, 52, 127, 52}, {15, 53, 106, 53}, {117, 53, 125, 53}, {5, 54, 16, 54}, {26, 54, 42, 54}, {52, 54, 125, 54}, {1, 55, 125, 55}, {0, 56, 91, 56}, {101, 56, 109, 56}, {123, 56, 123, 56}, {13, 57, 29, 57}, {42, 57, 127, 57}, {13, 58, 126, 58}, {34, 59, 127, 61}, {27, 62, 72, 62}, {86, 62, 127, 62}, {0, 62, 14, 63}, {27, 63, 126, 64}, {34, 65, 127, 67}, {0, 68, 16, 68}, {27, 68, 100, 68}, {110, 68, 125, 68}, {0, 69, 127, 71}, {0, 72, 126, 73}, {12, 74, 71, 74}, {85, 74, 99, 74}, {112, 74, 127, 74}, {15, 75, 28, 75}, {42, 75, 72, 76}, {39, 77, 69, 77}, {86, 75, 127, 77}, {27, 77, 29, 78}, {40, 78, 127, 78}, {10, 78, 15, 79}, {27, 79, 113, 79}, {123, 79, 126, 79}, {0, 80, 127, 87}, {54, 88, 127, 88}, {1, 88, 42, 89}, {62, 89, 126, 89}, {1, 90, 46, 90}, {56, 90, 118, 90}, {1, 91, 125, 91}, {3, 92, 22, 92}, {33, 92, 90, 92}, {102, 92, 109, 92}, {125, 92, 126, 92}, {2, 93, 55, 93}, {66, 93, 123, 93}, {0, 94, 127, 96}, {1, 97, 84, 97}, {94, 97, 127, 97}, {1, 98, 52, 98}, {62, 98, 109, 98}, {0, 99, 105, 99}, {115, 98, 127, 99}, {1, 100, 127, 100}, {100, 101, 127, 102}, {0, 101, 90, 104}, {103, 103, 114, 105}, {123, 103, 127, 105}, {21, 105, 82, 106}, {102, 106, 109, 106}, {60, 107, 85, 107}, {95, 107, 105, 107}, {0, 105, 5, 108}, {21, 107, 44, 108}, {0, 109, 42, 109}, {60, 108, 105, 109}, {67, 110, 100, 111}, {0, 110, 34, 113}, {73, 112, 87, 113}, {29, 114, 29, 114}, {74, 114, 74, 114}, {88, 115, 88, 115}, {86, 116, 104, 117}, {73, 118, 118, 118}, {0, 118, 45, 119}, {60, 119, 118, 119}, {0, 120, 127, 120}, {1, 121, 124, 122}, {2, 123, 2, 123}, {14, 123, 92, 123}, {104, 123, 109, 123}, {126, 123, 126, 123}, {7, 124, 7, 124}, {18, 124, 35, 124}, {45, 124, 54, 124}, {71, 124, 73, 124}, {91, 124, 93, 124}, {17, 125, 28, 125}, {38, 125, 39, 125}, {50, 125, 100, 125}, {116, 125, 116, 125}, {9, 126, 34, 126}, {76, 126, 76, 126}, {5, 127, 6, 127}, {17, 127, 18, 127}, {36, 127, 42, 127}, {59, 127, 63, 127}, {83, 127, 84, 127}, {95, 126, 108, 127}, {126, 127, 126, 127}};
+// 122 rects, ~28138 bytes (full frame: 32768)
+static constexpr uint8_t cat_dirty_1[][4] = {{0, 0, 127, 16}, {0, 17, 90, 17}, {100, 17, 127, 17}, {0, 18, 127, 21}, {0, 22, 15, 22}, {41, 22, 127, 22}, {0, 23, 125, 23}, {0, 24, 16, 24}, {41, 24, 126, 24}, {0, 25, 127, 27}, {0, 28, 16, 28}, {41, 28, 127, 28}, {0, 29, 127, 29}, {0, 30, 17, 30}, {41, 30, 126, 30}, {0, 31, 127, 43}, {0, 44, 3, 44}, {13, 44, 127, 44}, {80, 45, 109, 45}, {119, 45, 126, 45}, {0, 45, 49, 46}, {80, 46, 127, 46}, {1, 47, 14, 47}, {27, 47, 127, 47}, {0, 48, 49, 48}, {80, 48, 126, 48}, {0, 49, 127, 49}, {1, 50, 53, 50}, {13, 51, 28, 51}, {42, 51, 49, 51}, {74, 50, 127, 51}, {8, 52, 49, 52}, {70, 52, 124, 52}, {8, 53, 17, 53}, {28, 53, 49, 53}, {62, 53, 74, 54}, {84, 53, 127, 54}, {0, 54, 49, 56}, {12, 57, 29, 57}, {42, 57, 49, 57}, {13, 58, 49, 58}, {12, 62, 14, 63}, {27, 59, 49, 65}, {35, 66, 49, 67}, {0, 68, 14, 68}, {27, 68, 49, 68}, {0, 69, 49, 69}, {62, 55, 127, 69}, {0, 70, 126, 70}, {0, 71, 54, 72}, {64, 71, 127, 72}, {42, 73, 127, 73}, {12, 73, 31, 75}, {39, 74, 75, 75}, {85, 74, 127, 75}, {42, 76, 127, 76}, {42, 77, 47, 77}, {87, 77, 127, 77}, {12, 78, 15, 78}, {27, 78, 29, 78}, {42, 78, 127, 78}, {0, 79, 14, 79}, {26, 79, 56, 79}, {69, 79, 127, 79}, {0, 80, 127, 81}, {0, 82, 27, 82}, {41, 82, 125, 82}, {0, 83, 127, 84}, {0, 85, 36, 85}, {46, 85, 127, 85}, {0, 86, 127, 93}, {0, 94, 16, 94}, {28, 94, 126, 94}, {0, 95, 127, 100}, {0, 101, 79, 102}, {89, 101, 127, 103}, {0, 103, 69, 104}, {93, 104, 113, 104}, {124, 104, 127, 104}, {10, 105, 63, 105}, {11, 106, 33, 106}, {91, 105, 105, 106}, {10, 107, 25, 108}, {43, 106, 63, 108}, {83, 107, 105, 108}, {5, 109, 21, 110}, {53, 109, 69, 110}, {82, 109, 94, 110}, {56, 111, 99, 111}, {3, 111, 16, 112}, {0, 113, 14, 113}, {62, 112, 87, 113}, {74, 114, 75, 114}, {0, 118, 45, 118}, {0, 119, 0, 119}, {34, 119, 45, 119}, {120, 118, 127, 119}, {0, 120, 69, 120}, {107, 120, 127, 120}, {47, 121, 92, 121}, {107, 121, 118, 121}, {1, 121, 9, 122}, {28, 122, 37, 122}, {55, 122, 124, 122}, {2, 123, 2, 123}, {45, 123, 49, 123}, {61, 123, 92, 123}, {109, 123, 109, 123}, {122, 123, 122, 123}, {7, 124, 35, 124}, {9, 125, 9, 125}, {19, 125, 28, 125}, {39, 125, 39, 125}, {91, 124, 93, 125}, {116, 125, 116, 125}, {21, 126, 54, 126}, {74, 126, 74, 126}, {101, 126, 111, 126}, {6, 127, 24, 127}, {45, 127, 45, 127}, {61, 127, 62, 127}, {84, 127, 96, 127}};
+// 146 rects, ~29008 bytes (full frame: 32768)
+static constexpr uint8_t cat_dirty_2[][4] = {{0, 0, 127, 0}, {0, 1, 98, 1}, {109, 1, 125, 1}, {0, 2, 124, 2}, {0, 3, 89, 3}, {102, 3, 108, 3}, {0, 4, 106, 4}, {118, 3, 127, 4}, {0, 5, 126, 5}, {0, 6, 68, 6}, {89, 6, 122, 6}, {0, 7, 116, 7}, {127, 7, 127, 7}, {0, 8, 127, 11}, {0, 12, 13, 12}, {23, 12, 124, 12}, {0, 13, 52, 13}, {63, 13, 97, 13}, {119, 13, 127, 13}, {0, 14, 43, 14}, {53, 14, 106, 14}, {0, 15, 109, 15}, {120, 14, 127, 15}, {1, 16, 127, 16}, {0, 17, 88, 17}, {107, 17, 124, 17}, {0, 18, 127, 19}, {0, 20, 99, 20}, {111, 20, 120, 20}, {0, 21, 58, 21}, {74, 21, 121, 21}, {0, 22, 21, 22}, {39, 22, 115, 22}, {126, 22, 126, 22}, {0, 23, 72, 23}, {86, 23, 125, 23}, {0, 24, 113, 24}, {124, 24, 126, 24}, {0, 25, 127, 29}, {0, 30, 17, 30}, {41, 30, 59, 30}, {69, 30, 124, 30}, {0, 31, 118, 31}, {0, 32, 66, 32}, {76, 32, 125, 32}, {0, 33, 124, 33}, {1, 34, 94, 34}, {106, 34, 127, 34}, {0, 35, 127, 35}, {0, 36, 59, 36}, {70, 36, 127, 36}, {1, 37, 127, 37}, {0, 38, 38, 38}, {48, 38, 127, 38}, {0, 39, 52, 39}, {79, 39, 127, 39}, {0, 40, 127, 40}, {0, 41, 58, 41}, {69, 41, 127, 41}, {0, 42, 127, 43}, {1, 44, 85, 44}, {98, 44, 127, 44}, {0, 45, 109, 45}, {119, 45, 127, 45}, {0, 46, 127, 46}, {0, 47, 100, 47}, {110, 47, 127, 47}, {0, 48, 9, 48}, {19, 48, 126, 48}, {36, 49, 127, 49}, {0, 49, 1, 50}, {19, 50, 19, 50}, {29, 50, 29, 50}, {45, 50, 126, 50}, {0, 51, 127, 51}, {0, 52, 61, 52}, {72, 52, 75, 52}, {7, 53, 75, 54}, {85, 52, 127, 54}, {1, 55, 104, 55}, {116, 55, 127, 55}, {0, 56, 75, 56}, {86, 56, 127, 56}, {0, 57, 127, 58}, {27, 59, 27, 59}, {45, 59, 127, 59}, {35, 60, 127, 61}, {0, 62, 127, 63}, {32, 64, 127, 67}, {0, 68, 127, 69}, {34, 70, 127, 72}, {0, 73, 127, 74}, {9, 75, 123, 75}, {32, 76, 32, 76}, {42, 76, 127, 77}, {0, 78, 127, 81}, {0, 82, 23, 82}, {34, 82, 125, 82}, {0, 83, 127, 91}, {0, 92, 60, 92}, {70, 92, 125, 92}, {0, 93, 127, 95}, {0, 96, 119, 96}, {0, 97, 127, 100}, {0, 101, 65, 104}, {76, 101, 127, 105}, {0, 105, 53, 106}, {78, 106, 93, 106}, {0, 107, 20, 107}, {71, 107, 103, 107}, {36, 107, 53, 108}, {115, 106, 127, 109}, {40, 109, 58, 110}, {69, 108, 89, 110}, {124, 110, 127, 111}, {43, 111, 82, 112}, {0, 108, 10, 113}, {49, 113, 76, 113}, {63, 114, 63, 114}, {75, 114, 75, 114}, {122, 116, 127, 117}, {0, 118, 35, 118}, {1, 119, 2, 119}, {13, 119, 34, 119}, {107, 118, 127, 119}, {1, 120, 58, 120}, {95, 120, 120, 120}, {19, 121, 19, 121}, {35, 121, 35, 121}, {2, 121, 3, 122}, {28, 122, 28, 122}, {45, 121, 117, 122}, {47, 123, 96, 123}, {122, 123, 122, 123}, {27, 124, 27, 124}, {53, 124, 61, 124}, {7, 124, 10, 125}, {37, 126, 54, 126}, {74, 126, 74, 126}, {111, 126, 114, 126}, {1, 127, 9, 127}, {22, 127, 24, 127}, {34, 127, 34, 127}, {45, 127, 45, 127}, {61, 127, 62, 127}, {84, 127, 90, 127}};
+// 305 rects, ~21057 bytes (full frame: 32768)
+static constexpr uint8_t cat_dirty_3[][4] = {{0, 0, 9, 0}, {51, 0, 54, 0}, {64, 0, 71, 0}, {83, 0, 90, 0}, {101, 0, 107, 0}, {2, 1, 23, 1}, {64, 1, 81, 1}, {92, 1, 92, 1}, {1, 2, 1, 2}, {11, 2, 15, 2}, {34, 2, 34, 2}, {0, 3, 15, 3}, {25, 3, 35, 3}, {121, 3, 121, 3}, {0, 4, 40, 4}, {65, 2, 72, 4}, {86, 2, 88, 4}, {102, 2, 107, 4}, {0, 5, 8, 5}, {18, 5, 44, 5}, {54, 4, 56, 5}, {96, 5, 96, 5}, {112, 5, 112, 5}, {1, 6, 31, 6}, {76, 7, 76, 7}, {1, 7, 5, 8}, {15, 8, 26, 8}, {41, 6, 46, 8}, {55, 7, 60, 8}, {73, 8, 81, 8}, {91, 7, 99, 8}, {112, 8, 112, 8}, {0, 9, 30, 9}, {64, 9, 72, 9}, {106, 9, 106, 9}, {119, 9, 119, 9}, {20, 10, 22, 10}, {33, 10, 34, 10}, {64, 10, 64, 10}, {82, 9, 90, 10}, {108, 11, 108, 11}, {1, 10, 13, 12}, {23, 12, 34, 12}, {1, 13, 52, 13}, {68, 11, 72, 13}, {84, 11, 86, 13}, {121, 13, 121, 13}, {1, 14, 7, 14}, {17, 14, 41, 14}, {54, 14, 54, 14}, {0, 15, 44, 15}, {106, 14, 109, 15}, {1, 16, 51, 16}, {89, 15, 89, 16}, {55, 17, 57, 17}, {68, 16, 72, 17}, {83, 17, 83, 17}, {119, 16, 125, 17}, {0, 17, 40, 18}, {48, 18, 52, 18}, {64, 18, 81, 18}, {15, 19, 46, 19}, {74, 19, 74, 19}, {0, 19, 7, 20}, {23, 20, 44, 20}, {71, 20, 94, 20}, {114, 20, 114, 20}, {83, 21, 90, 21}, {118, 21, 118, 21}, {0, 21, 53, 22}, {68, 22, 68, 22}, {86, 22, 98, 22}, {111, 22, 111, 22}, {104, 23, 110, 23}, {0, 23, 59, 24}, {89, 24, 89, 24}, {110, 24, 113, 24}, {126, 24, 126, 24}, {1, 25, 68, 25}, {82, 25, 82, 25}, {95, 25, 126, 25}, {68, 26, 70, 26}, {94, 26, 106, 26}, {0, 26, 54, 27}, {64, 27, 76, 27}, {93, 27, 125, 27}, {1, 28, 79, 28}, {112, 28, 118, 28}, {1, 29, 68, 29}, {85, 29, 85, 29}, {109, 29, 109, 29}, {124, 29, 125, 29}, {1, 30, 59, 30}, {70, 30, 70, 30}, {80, 30, 80, 30}, {90, 30, 90, 30}, {101, 30, 108, 30}, {0, 31, 76, 31}, {118, 31, 118, 31}, {83, 31, 104, 32}, {0, 32, 69, 33}, {90, 33, 101, 33}, {31, 34, 41, 34}, {59, 34, 68, 34}, {79, 34, 87, 34}, {110, 32, 127, 34}, {1, 34, 7, 35}, {18, 35, 18, 35}, {40, 35, 45, 35}, {1, 36, 24, 36}, {55, 36, 58, 36}, {76, 35, 80, 36}, {1, 37, 15, 37}, {31, 37, 36, 37}, {46, 37, 54, 37}, {1, 38, 5, 38}, {15, 38, 22, 38}, {91, 35, 127, 38}, {1, 39, 30, 39}, {52, 39, 52, 39}, {85, 38, 85, 39}, {118, 39, 124, 39}, {46, 40, 46, 40}, {64, 40, 64, 40}, {1, 40, 4, 41}, {14, 41, 17, 41}, {27, 40, 31, 41}, {82, 41, 83, 41}, {23, 42, 33, 42}, {71, 42, 71, 42}, {106, 40, 127, 42}, {0, 42, 11, 43}, {33, 43, 38, 43}, {49, 43, 49, 43}, {67, 43, 67, 43}, {82, 43, 82, 43}, {1, 44, 17, 44}, {28, 44, 68, 44}, {0, 45, 29, 45}, {40, 45, 72, 45}, {103, 43, 127, 45}, {1, 46, 82, 46}, {99, 46, 99, 46}, {0, 47, 90, 47}, {111, 46, 127, 47}, {1, 48, 48, 48}, {80, 48, 80, 48}, {90, 48, 97, 48}, {110, 48, 117, 48}, {1, 49, 86, 49}, {98, 49, 116, 49}, {0, 50, 49, 50}, {82, 50, 111, 50}, {0, 51, 14, 51}, {27, 51, 49, 51}, {116, 51, 116, 51}, {0, 52, 49, 52}, {75, 51, 101, 52}, {111, 52, 113, 52}, {75, 53, 105, 53}, {13, 53, 29, 54}, {41, 53, 49, 54}, {74, 54, 98, 54}, {110, 54, 118, 54}, {13, 55, 49, 55}, {62, 55, 62, 55}, {73, 55, 91, 55}, {104, 55, 104, 55}, {122, 55, 125, 55}, {72, 56, 72, 56}, {82, 56, 125, 56}, {9, 56, 14, 57}, {27, 56, 31, 57}, {41, 56, 62, 57}, {75, 57, 96, 57}, {122, 57, 123, 57}, {0, 58, 14, 58}, {27, 58, 49, 58}, {82, 58, 93, 58}, {107, 57, 110, 58}, {62, 58, 72, 59}, {82, 59, 108, 59}, {45, 59, 49, 61}, {62, 60, 101, 62}, {121, 61, 124, 62}, {13, 62, 15, 63}, {25, 62, 28, 63}, {126, 63, 126, 63}, {113, 64, 118, 64}, {62, 63, 105, 65}, {42, 62, 49, 66}, {62, 66, 62, 66}, {74, 66, 94, 66}, {104, 66, 116, 66}, {62, 67, 108, 67}, {120, 67, 124, 67}, {13, 68, 30, 68}, {39, 67, 49, 68}, {106, 68, 108, 68}, {62, 68, 96, 69}, {78, 70, 82, 70}, {92, 70, 108, 70}, {0, 69, 49, 71}, {62, 70, 62, 71}, {73, 71, 97, 71}, {118, 69, 126, 71}, {0, 72, 88, 72}, {114, 72, 115, 72}, {0, 73, 15, 73}, {27, 73, 49, 73}, {74, 73, 85, 73}, {96, 73, 108, 73}, {0, 74, 58, 74}, {68, 74, 101, 74}, {119, 74, 121, 74}, {9, 75, 14, 75}, {26, 75, 49, 75}, {64, 75, 118, 75}, {29, 76, 58, 76}, {70, 76, 111, 76}, {127, 76, 127, 76}, {49, 77, 49, 77}, {71, 77, 104, 77}, {12, 78, 14, 78}, {27, 77, 29, 78}, {41, 78, 108, 78}, {127, 78, 127, 78}, {12, 79, 29, 79}, {41, 79, 47, 79}, {89, 79, 123, 79}, {12, 80, 95, 80}, {110, 80, 110, 80}, {126, 80, 126, 80}, {20, 81, 108, 81}, {119, 81, 124, 81}, {0, 81, 7, 82}, {22, 82, 23, 82}, {1, 83, 17, 83}, {34, 82, 100, 83}, {0, 84, 113, 85}, {1, 86, 99, 87}, {118, 87, 118, 87}, {1, 88, 46, 88}, {64, 88, 85, 88}, {101, 88, 101, 88}, {76, 89, 81, 89}, {92, 89, 115, 89}, {73, 90, 75, 90}, {96, 90, 96, 90}, {1, 89, 63, 91}, {86, 91, 86, 91}, {0, 92, 53, 92}, {72, 92, 72, 92}, {0, 93, 45, 93}, {55, 93, 69, 93}, {101, 92, 104, 93}, {0, 94, 71, 94}, {123, 93, 126, 94}, {72, 95, 76, 95}, {0, 95, 60, 96}, {78, 96, 83, 96}, {93, 96, 94, 96}, {0, 97, 72, 97}, {82, 97, 95, 97}, {109, 95, 117, 97}, {0, 98, 111, 98}, {1, 99, 127, 100}, {11, 101, 18, 101}, {29, 101, 31, 101}, {41, 101, 127, 101}, {3, 102, 53, 102}, {65, 102, 127, 102}, {69, 103, 120, 103}, {0, 103, 45, 105}, {69, 104, 91, 105}, {0, 106, 9, 106}, {67, 106, 78, 106}, {100, 104, 120, 106}, {0, 107, 1, 107}, {93, 107, 127, 107}, {20, 106, 40, 108}, {60, 107, 82, 108}, {29, 109, 45, 110}, {58, 109, 72, 110}, {109, 108, 127, 111}, {32, 111, 69, 112}, {38, 113, 63, 113}, {53, 114, 53, 114}, {63, 114, 63, 114}, {111, 116, 127, 117}, {0, 118, 32, 118}, {96, 118, 122, 118}, {9, 119, 22, 119}, {10, 120, 45, 120}, {83, 119, 108, 120}, {19, 121, 19, 121}, {34, 121, 96, 122}, {117, 122, 117, 122}, {36, 123, 46, 123}, {72, 123, 96, 123}, {53, 123, 62, 124}, {114, 126, 114, 126}, {1, 127, 6, 127}, {22, 127, 22, 127}, {34, 127, 34, 127}};
+// 129 rects, ~11709 bytes (full frame: 32768)
+static constexpr uint8_t cat_dirty_4[][4] = {{16, 0, 16, 0}, {56, 0, 56, 0}, {71, 0, 91, 0}, {101, 0, 109, 0}, {81, 6, 81, 6}, {88, 7, 88, 7}, {62, 8, 62, 8}, {34, 10, 34, 10}, {25, 14, 34, 17}, {54, 17, 54, 17}, {106, 17, 106, 17}, {64, 18, 64, 18}, {21, 18, 36, 22}, {83, 22, 88, 22}, {17, 23, 42, 23}, {21, 24, 21, 24}, {41, 24, 41, 24}, {54, 24, 54, 24}, {13, 25, 45, 29}, {15, 30, 16, 30}, {42, 30, 44, 30}, {16, 31, 44, 32}, {42, 33, 43, 33}, {126, 33, 126, 33}, {74, 29, 81, 34}, {97, 34, 98, 34}, {110, 34, 113, 34}, {80, 36, 80, 36}, {96, 35, 116, 36}, {107, 37, 117, 38}, {91, 40, 121, 41}, {102, 42, 107, 42}, {117, 42, 118, 42}, {91, 42, 92, 43}, {107, 43, 117, 45}, {0, 45, 62, 46}, {0, 47, 79, 47}, {96, 45, 98, 47}, {111, 46, 113, 47}, {80, 48, 80, 48}, {47, 49, 82, 49}, {47, 50, 49, 50}, {65, 51, 71, 51}, {0, 51, 49, 52}, {82, 51, 85, 52}, {127, 52, 127, 52}, {13, 53, 32, 53}, {45, 53, 49, 53}, {0, 54, 24, 55}, {34, 54, 52, 55}, {62, 54, 62, 55}, {72, 53, 82, 55}, {119, 55, 119, 55}, {0, 56, 52, 58}, {104, 59, 104, 59}, {45, 59, 52, 61}, {0, 62, 52, 63}, {62, 56, 93, 63}, {119, 63, 119, 63}, {62, 64, 71, 64}, {82, 64, 93, 64}, {32, 64, 52, 67}, {0, 68, 52, 73}, {62, 65, 95, 73}, {0, 74, 95, 74}, {13, 75, 94, 75}, {16, 76, 16, 76}, {29, 76, 93, 76}, {28, 77, 28, 77}, {39, 77, 49, 77}, {67, 77, 71, 77}, {81, 77, 91, 77}, {0, 78, 91, 78}, {0, 79, 49, 79}, {87, 79, 89, 79}, {0, 80, 89, 80}, {1, 81, 1, 81}, {14, 81, 87, 81}, {22, 82, 87, 82}, {113, 82, 113, 82}, {40, 83, 87, 84}, {17, 85, 17, 85}, {28, 85, 28, 85}, {16, 86, 30, 87}, {81, 90, 81, 90}, {44, 91, 44, 91}, {90, 91, 90, 91}, {116, 91, 116, 91}, {21, 91, 23, 93}, {93, 96, 95, 97}, {34, 98, 63, 98}, {76, 96, 78, 98}, {89, 98, 98, 98}, {34, 99, 120, 99}, {29, 100, 124, 100}, {29, 101, 42, 101}, {0, 102, 42, 102}, {0, 103, 34, 104}, {52, 101, 127, 104}, {4, 105, 29, 106}, {54, 105, 73, 106}, {87, 105, 106, 106}, {116, 105, 127, 106}, {48, 107, 68, 107}, {78, 107, 81, 107}, {12, 107, 29, 108}, {91, 107, 127, 108}, {16, 109, 34, 110}, {45, 108, 60, 110}, {20, 111, 58, 111}, {97, 109, 125, 111}, {25, 112, 52, 113}, {40, 114, 40, 114}, {53, 114, 53, 114}, {98, 116, 127, 117}, {84, 118, 127, 118}, {0, 118, 11, 119}, {23, 118, 30, 119}, {84, 119, 106, 119}, {119, 119, 127, 119}, {0, 120, 34, 120}, {71, 120, 97, 120}, {21, 121, 91, 122}, {96, 122, 96, 122}, {23, 123, 35, 123}, {70, 123, 82, 123}, {110, 123, 110, 123}, {18, 127, 18, 127}, {45, 127, 48, 127}};
+// 134 rects, ~27778 bytes (full frame: 32768)
+static constexpr uint8_t cat_dirty_5[][4] = {{0, 0, 127, 2}, {0, 3, 100, 3}, {110, 3, 124, 3}, {0, 4, 127, 8}, {1, 9, 81, 9}, {91, 9, 127, 9}, {0, 10, 127, 17}, {2, 18, 118, 18}, {0, 19, 127, 23}, {1, 24, 21, 24}, {41, 24, 123, 24}, {0, 25, 126, 25}, {0, 26, 42, 26}, {54, 26, 127, 26}, {1, 27, 127, 28}, {0, 29, 100, 29}, {110, 29, 127, 29}, {0, 30, 127, 37}, {0, 38, 100, 39}, {109, 38, 127, 39}, {0, 40, 127, 43}, {0, 44, 8, 44}, {18, 44, 126, 44}, {13, 45, 17, 45}, {27, 45, 28, 45}, {40, 45, 63, 45}, {73, 45, 117, 45}, {2, 46, 14, 46}, {26, 46, 119, 46}, {0, 47, 127, 47}, {13, 48, 43, 48}, {80, 48, 80, 48}, {90, 48, 126, 48}, {22, 49, 33, 49}, {0, 49, 9, 50}, {35, 50, 35, 50}, {47, 49, 47, 50}, {80, 49, 126, 50}, {13, 51, 16, 51}, {27, 51, 28, 51}, {41, 51, 47, 51}, {13, 52, 45, 52}, {13, 53, 41, 54}, {65, 51, 127, 54}, {0, 54, 3, 55}, {13, 55, 13, 55}, {32, 55, 45, 55}, {62, 55, 71, 55}, {82, 55, 127, 55}, {0, 56, 45, 56}, {62, 56, 127, 56}, {13, 57, 15, 57}, {27, 57, 28, 57}, {42, 57, 91, 57}, {101, 57, 127, 57}, {13, 58, 28, 58}, {42, 58, 43, 58}, {36, 60, 40, 61}, {12, 62, 14, 63}, {27, 62, 43, 63}, {32, 64, 45, 67}, {13, 68, 16, 68}, {27, 68, 45, 68}, {13, 69, 44, 69}, {16, 70, 19, 71}, {19, 72, 26, 72}, {41, 70, 45, 72}, {0, 73, 52, 73}, {12, 74, 45, 74}, {62, 58, 127, 74}, {13, 75, 29, 75}, {57, 75, 127, 75}, {16, 76, 16, 76}, {43, 76, 127, 76}, {10, 78, 14, 78}, {27, 77, 29, 78}, {41, 77, 49, 78}, {60, 77, 127, 78}, {0, 79, 14, 79}, {27, 79, 47, 79}, {80, 79, 124, 79}, {2, 80, 127, 80}, {0, 81, 47, 81}, {58, 81, 127, 81}, {0, 82, 127, 100}, {0, 101, 29, 104}, {41, 101, 127, 104}, {43, 105, 60, 106}, {80, 105, 93, 106}, {105, 105, 124, 106}, {36, 107, 55, 107}, {69, 107, 116, 107}, {0, 105, 16, 108}, {36, 108, 47, 108}, {34, 109, 56, 109}, {5, 109, 22, 110}, {34, 110, 45, 110}, {9, 111, 45, 111}, {86, 108, 114, 111}, {14, 112, 40, 113}, {29, 114, 29, 114}, {40, 114, 40, 114}, {88, 115, 88, 115}, {86, 116, 115, 117}, {73, 118, 127, 118}, {60, 119, 108, 119}, {11, 120, 21, 120}, {59, 120, 84, 120}, {97, 120, 101, 120}, {118, 119, 127, 120}, {10, 121, 71, 121}, {10, 122, 80, 122}, {90, 122, 93, 122}, {104, 122, 119, 122}, {14, 123, 76, 123}, {104, 123, 110, 123}, {126, 123, 126, 123}, {45, 124, 54, 124}, {71, 124, 73, 124}, {93, 124, 93, 124}, {17, 125, 19, 125}, {38, 125, 38, 125}, {50, 125, 84, 125}, {9, 126, 34, 126}, {76, 126, 76, 126}, {95, 125, 100, 126}, {105, 126, 105, 126}, {5, 127, 5, 127}, {17, 127, 18, 127}, {36, 127, 48, 127}, {59, 127, 63, 127}, {83, 127, 84, 127}, {99, 127, 107, 127}, {126, 127, 126, 127}};
+
+static constexpr const uint8_t (*cat_dirty[])[4] = {cat_dirty_0, cat_dirty_1, cat_dirty_2, cat_dirty_3, cat_dirty_4, cat_dirty_5};
+
+static constexpr uint16_t cat_dirty_cnt[] = {sizeof(cat_dirty_0) / 4, sizeof(cat_dirty_1) / 4, sizeof(cat_dirty_2) / 4, sizeof(cat_dirty_3) / 4, sizeof(cat_dirty_4) / 4, sizeof(cat_dirty_5) / 4};
+
+#endif
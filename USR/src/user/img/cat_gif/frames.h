@@ -1,3 +1,6 @@
+#ifndef _CAT_GIF_
+#define _CAT_GIF_
+
 #include <stdint.h>
 
 static constexpr uint16_t cat_00[16384] = {
@@ -786,4 +789,6 @@ static constexpr uint16_t cat_05[16384] = {
     0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x9dc1, 0x95c3, 0x9dc1
 };
 
-static constexpr const uint16_t* cat_gif[] = {cat_00, cat_01, cat_02, cat_03, cat_04, cat_05};
\ No newline at end of file
+static constexpr const uint16_t* cat_gif[] = {cat_00, cat_01, cat_02, cat_03, cat_04, cat_05};
+
+#endif
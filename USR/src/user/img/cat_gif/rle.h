@@ -0,0 +1,2632 @@
+#ifndef _CAT_GIF_RLE_
+#define _CAT_GIF_RLE_
+
+// Generated by tools/gif_rle.py, do not edit
+
+#include "../../../drivers/device/rle565.hpp"
+
+// 173 colors, 7226 bytes (raw: 32768)
+static constexpr uint16_t cat_pal_0[] = {
+    0x0000, 0x0861, 0x0881, 0x0901, 0x09a1, 0x09c1, 0x1061, 0x10a2, 0x11a1, 0x11e2, 0x18e3, 0x18e4,
+    0x1921, 0x1941, 0x1943, 0x1983, 0x1a23, 0x1a43, 0x2122, 0x2124, 0x2144, 0x2163, 0x2223, 0x2264,
+    0x22a4, 0x29a3, 0x29e3, 0x2a43, 0x2a65, 0x2aa4, 0x2ae5, 0x2b05, 0x3166, 0x3186, 0x31e4, 0x31e5,
+    0x32a4, 0x32e5, 0x3305, 0x3346, 0x34a6, 0x34c6, 0x39a6, 0x39c7, 0x39e4, 0x3a24, 0x3a26, 0x3a45,
+    0x3b06, 0x3b67, 0x3ba7, 0x4228, 0x4266, 0x42a6, 0x42e5, 0x4363, 0x43a4, 0x43a8, 0x43c8, 0x4407,
+    0x4926, 0x4a69, 0x4be7, 0x4be8, 0x51c8, 0x528a, 0x52e7, 0x5326, 0x5367, 0x5389, 0x53a7, 0x5428,
+    0x5ae8, 0x5aeb, 0x5b07, 0x5b29, 0x5b47, 0x5ba7, 0x5c25, 0x5c28, 0x6106, 0x632c, 0x6368, 0x63a8,
+    0x63e8, 0x6429, 0x6804, 0x6b48, 0x6b4d, 0x6be9, 0x6c6a, 0x6ca2, 0x7086, 0x71a9, 0x738e, 0x73aa,
+    0x742a, 0x742b, 0x746a, 0x74aa, 0x7805, 0x78c7, 0x7beb, 0x7bef, 0x7caa, 0x7cca, 0x7d04, 0x80c7,
+    0x8148, 0x838f, 0x8430, 0x84aa, 0x84ab, 0x84ca, 0x84eb, 0x8542, 0x8826, 0x8847, 0x8acc, 0x8c6d,
+    0x8c71, 0x8cad, 0x8ceb, 0x8d44, 0x9006, 0x93af, 0x9472, 0x94b2, 0x952b, 0x95c1, 0x95c4, 0x9b8f,
+    0x9cad, 0x9cb3, 0x9cd3, 0x9ced, 0x9d2c, 0x9d4c, 0x9d4d, 0x9dc1, 0xa514, 0xa534, 0xa58d, 0xa5ae,
+    0xab2c, 0xabd1, 0xac71, 0xac92, 0xacd3, 0xad55, 0xad8e, 0xb596, 0xb5b6, 0xb5ce, 0xb5ef, 0xbcd3,
+    0xbdaf, 0xbdb7, 0xbdf0, 0xbdf7, 0xbe10, 0xc651, 0xc672, 0xccd3, 0xce18, 0xce59, 0xce79, 0xced3,
+    0xcf55, 0xe73c, 0xef5d, 0xfcb2, 0xffff,
+};
+static constexpr uint16_t cat_row_0[] = {
+    0, 30, 74, 94, 126, 160, 204, 265, 309, 341, 385, 418, 455, 508, 564, 628,
+    679, 755, 811, 864, 934, 997, 1084, 1137, 1189, 1248, 1323, 1394, 1467, 1522, 1591, 1639,
+    1701, 1760, 1830, 1909, 1975, 2015, 2070, 2114, 2176, 2240, 2274, 2310, 2364, 2418, 2463, 2495,
+    2545, 2571, 2612, 2662, 2722, 2788, 2835, 2911, 2988, 3070, 3128, 3200, 3261, 3318, 3377, 3443,
+    3514, 3573, 3640, 3707, 3769, 3837, 3903, 3966, 4030, 4096, 4175, 4241, 4292, 4336, 4377, 4453,
+    4525, 4613, 4693, 4759, 4834, 4884, 4951, 5030, 5099, 5177, 5250, 5319, 5404, 5474, 5526, 5591,
+    5648, 5727, 5784, 5833, 5901, 5975, 6043, 6114, 6157, 6210, 6238, 6269, 6292, 6313, 6332, 6346,
+    6380, 6394, 6406, 6412, 6414, 6416, 6418, 6422, 6430, 6450, 6485, 6514, 6540, 6566, 6588, 6610,
+};
+static constexpr uint8_t cat_code_0[] = {
+    0x82, 0x71, 0x85, 0x69, 0x88, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69,
+    0x88, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71, 0x83, 0x71,
+    0x85, 0x69, 0x00, 0x71, 0x83, 0x69, 0x00, 0x71, 0x90, 0x69, 0x00, 0x71, 0xa2, 0x69, 0x03, 0x71,
+    0x69, 0x71, 0x71, 0x8a, 0x69, 0x01, 0x71, 0x69, 0x84, 0x71, 0x89, 0x69, 0x02, 0x71, 0x69, 0x69,
+    0x84, 0x71, 0x89, 0x69, 0x85, 0x71, 0x02, 0x69, 0x71, 0x71, 0x83, 0x71, 0xbd, 0x69, 0x00, 0x71,
+    0xa4, 0x69, 0x02, 0x71, 0x69, 0x71, 0x8c, 0x69, 0x82, 0x71, 0x83, 0x69, 0x00, 0x71, 0x02, 0x71,
+    0x71, 0x69, 0x85, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0x88, 0x69, 0x88, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x00, 0x69,
+    0x83, 0x71, 0x87, 0x69, 0x00, 0x71, 0x96, 0x69, 0x00, 0x71, 0x91, 0x69, 0x00, 0x71, 0x95, 0x69,
+    0x02, 0x71, 0x69, 0x71, 0x9b, 0x69, 0x00, 0x71, 0x83, 0x69, 0x02, 0x71, 0x69, 0x71, 0x89, 0x69,
+    0x01, 0x69, 0x71, 0x84, 0x69, 0x03, 0x71, 0x69, 0x69, 0x71, 0x9f, 0x69, 0x00, 0x71, 0x8b, 0x69,
+    0x07, 0x71, 0x69, 0x71, 0x69, 0x71, 0x69, 0x69, 0x71, 0x89, 0x69, 0x00, 0x71, 0x8f, 0x69, 0x02,
+    0x71, 0x69, 0x71, 0x96, 0x69, 0x01, 0x71, 0x71, 0x87, 0x69, 0x00, 0x71, 0x82, 0x69, 0x01, 0x71,
+    0x71, 0x82, 0x69, 0x00, 0x71, 0x88, 0x69, 0x83, 0x71, 0x00, 0x69, 0x83, 0x71, 0x89, 0x69, 0x01,
+    0x71, 0x71, 0x84, 0x69, 0x00, 0x71, 0x89, 0x69, 0x85, 0x71, 0x01, 0x69, 0x71, 0x8a, 0x69, 0x01,
+    0x71, 0x69, 0x82, 0x71, 0x02, 0x69, 0x71, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x03, 0x71,
+    0x69, 0x71, 0x69, 0x83, 0x71, 0x88, 0x69, 0x00, 0x71, 0x01, 0x71, 0x71, 0x86, 0x69, 0x88, 0x71,
+    0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x83, 0x71, 0x00, 0x69, 0x82, 0x71, 0x89, 0x69, 0x83, 0x71,
+    0x00, 0x69, 0x83, 0x71, 0x8a, 0x69, 0x86, 0x71, 0x8a, 0x69, 0x01, 0x71, 0x69, 0x85, 0x71, 0x88,
+    0x69, 0x87, 0x71, 0x00, 0x69, 0x04, 0x69, 0x71, 0x71, 0x69, 0x71, 0x83, 0x69, 0x88, 0x71, 0x86,
+    0x69, 0x00, 0x71, 0x92, 0x69, 0x00, 0x71, 0xb5, 0x69, 0x00, 0x71, 0x89, 0x69, 0x00, 0x71, 0x84,
+    0x69, 0x00, 0x71, 0x89, 0x69, 0x02, 0x69, 0x69, 0x71, 0x86, 0x69, 0x87, 0x71, 0x89, 0x69, 0x08,
+    0x71, 0x71, 0x69, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71, 0x88, 0x69, 0x87, 0x71, 0x89, 0x69, 0x02,
+    0x71, 0x71, 0x69, 0x85, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88,
+    0x71, 0x06, 0x69, 0x71, 0x69, 0x69, 0x71, 0x69, 0x71, 0xbb, 0x69, 0x00, 0x71, 0x8e, 0x69, 0x82,
+    0x71, 0x01, 0x69, 0x71, 0x93, 0x69, 0x00, 0x71, 0x8b, 0x69, 0x06, 0x71, 0x71, 0x69, 0x69, 0x71,
+    0x69, 0x69, 0x02, 0x69, 0x71, 0x69, 0x85, 0x71, 0x89, 0x69, 0x87, 0x71, 0x99, 0x69, 0x00, 0x71,
+    0x8c, 0x69, 0x00, 0x71, 0x93, 0x69, 0x00, 0x71, 0x90, 0x69, 0x00, 0x71, 0x8c, 0x69, 0x00, 0x71,
+    0x82, 0x69, 0x03, 0x71, 0x69, 0x71, 0x69, 0x02, 0x69, 0x69, 0x71, 0x86, 0x69, 0x84, 0x71, 0x01,
+    0x69, 0x71, 0x87, 0x69, 0x02, 0x68, 0x60, 0x5a, 0x83, 0x60, 0x03, 0x62, 0x69, 0x69, 0x71, 0x89,
+    0x69, 0x01, 0x71, 0x69, 0x83, 0x71, 0x91, 0x69, 0x82, 0x71, 0x8a, 0x69, 0x83, 0x71, 0x01, 0x69,
+    0x71, 0x8c, 0x69, 0x85, 0x71, 0x8c, 0x69, 0x83, 0x71, 0x01, 0x69, 0x71, 0x01, 0x69, 0x71, 0x82,
+    0x69, 0x05, 0x71, 0x69, 0x71, 0x71, 0x69, 0x69, 0x86, 0x71, 0x83, 0x69, 0x03, 0x71, 0x69, 0x71,
+    0x4d, 0x85, 0x13, 0x03, 0x23, 0x68, 0x69, 0x71, 0x89, 0x69, 0x01, 0x71, 0x69, 0x82, 0x71, 0x84,
+    0x69, 0x00, 0x71, 0x84, 0x69, 0x00, 0x71, 0x8b, 0x69, 0x00, 0x71, 0x91, 0x69, 0x00, 0x71, 0x9e,
+    0x69, 0x01, 0x71, 0x69, 0x01, 0x69, 0x71, 0x86, 0x69, 0x88, 0x71, 0x83, 0x69, 0x03, 0x71, 0x68,
+    0x54, 0x4c, 0x86, 0x43, 0x02, 0x54, 0x59, 0x71, 0x89, 0x69, 0x05, 0x71, 0x71, 0x69, 0x71, 0x69,
+    0x71, 0x8b, 0x69, 0x01, 0x71, 0x69, 0x82, 0x71, 0x00, 0x69, 0x82, 0x71, 0x8a, 0x69, 0x03, 0x71,
+    0x71, 0x69, 0x69, 0x82, 0x71, 0x89, 0x69, 0x05, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x82, 0x71,
+    0x88, 0x69, 0x88, 0x71, 0x01, 0x69, 0x71, 0x87, 0x69, 0x87, 0x71, 0x82, 0x69, 0x04, 0x71, 0x69,
+    0x5a, 0x15, 0x43, 0x85, 0x69, 0x04, 0x68, 0x19, 0x35, 0x71, 0x71, 0x82, 0x69, 0x00, 0x71, 0x85,
+    0x69, 0x00, 0x71, 0xa9, 0x69, 0x00, 0x71, 0x8f, 0x69, 0x02, 0x71, 0x69, 0x71, 0x88, 0x69, 0x01,
+    0x71, 0x69, 0x84, 0x71, 0x01, 0x69, 0x71, 0x02, 0x69, 0x69, 0x71, 0x82, 0x69, 0x82, 0x71, 0x89,
+    0x69, 0x06, 0x71, 0x71, 0x68, 0x4c, 0x4c, 0x4d, 0x59, 0x82, 0x69, 0x0a, 0x71, 0x69, 0x71, 0x68,
+    0x53, 0x4d, 0x4c, 0x59, 0x71, 0x69, 0x71, 0x87, 0x69, 0x82, 0x71, 0x03, 0x69, 0x69, 0x71, 0x71,
+    0x89, 0x69, 0x01, 0x71, 0x69, 0x84, 0x71, 0x89, 0x69, 0x08, 0x71, 0x71, 0x69, 0x71, 0x71, 0x69,
+    0x71, 0x69, 0x71, 0x89, 0x69, 0x02, 0x71, 0x71, 0x69, 0x83, 0x71, 0x86, 0x69, 0x00, 0x71, 0x82,
+    0x69, 0x88, 0x71, 0x08, 0x69, 0x69, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71, 0x84, 0x69, 0x00,
+    0x71, 0x83, 0x69, 0x06, 0x71, 0x71, 0x68, 0x14, 0x34, 0x71, 0x71, 0x82, 0x69, 0x08, 0x71, 0x69,
+    0x69, 0x71, 0x71, 0x60, 0x14, 0x4c, 0x69, 0x87, 0x71, 0x88, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88,
+    0x71, 0x88, 0x69, 0x88, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x07, 0x69, 0x71, 0x69, 0x69,
+    0x71, 0x71, 0x69, 0x71, 0x8a, 0x69, 0x11, 0x71, 0x71, 0x68, 0x14, 0x34, 0x71, 0x59, 0x35, 0x59,
+    0x69, 0x71, 0x69, 0x43, 0x42, 0x71, 0x55, 0x14, 0x4c, 0x88, 0x69, 0x01, 0x71, 0x69, 0x86, 0x71,
+    0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0x02, 0x69, 0x71, 0x69, 0x82, 0x71, 0x02, 0x69, 0x71, 0x71, 0x89, 0x69, 0x11, 0x71, 0x71, 0x63,
+    0x14, 0x34, 0x71, 0x4d, 0x13, 0x53, 0x69, 0x69, 0x68, 0x22, 0x23, 0x68, 0x55, 0x14, 0x4a, 0x84,
+    0x69, 0x82, 0x71, 0x8f, 0x69, 0x00, 0x71, 0x8a, 0x69, 0x00, 0x71, 0x91, 0x69, 0x00, 0x71, 0x85,
+    0x69, 0x00, 0x71, 0x84, 0x69, 0x01, 0x71, 0x71, 0x86, 0x69, 0x00, 0x71, 0x82, 0x69, 0x04, 0x71,
+    0x69, 0x69, 0x71, 0x71, 0x84, 0x69, 0x07, 0x69, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71, 0x88,
+    0x69, 0x83, 0x71, 0x10, 0x63, 0x14, 0x34, 0x71, 0x68, 0x62, 0x4c, 0x2c, 0x22, 0x2d, 0x60, 0x63,
+    0x69, 0x55, 0x14, 0x4a, 0x69, 0x83, 0x71, 0x03, 0x69, 0x69, 0x71, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x86, 0x71, 0x01, 0x69, 0x71, 0x85,
+    0x69, 0x02, 0x71, 0x69, 0x71, 0x03, 0x71, 0x71, 0x69, 0x69, 0x82, 0x71, 0x01, 0x69, 0x71, 0x85,
+    0x69, 0x17, 0x71, 0x68, 0x68, 0x63, 0x68, 0x68, 0x62, 0x14, 0x34, 0x63, 0x63, 0x68, 0x43, 0x14,
+    0x14, 0x19, 0x60, 0x68, 0x62, 0x59, 0x14, 0x43, 0x63, 0x63, 0x82, 0x68, 0x00, 0x69, 0x82, 0x71,
+    0x8f, 0x69, 0x00, 0x71, 0x8c, 0x69, 0x04, 0x71, 0x69, 0x69, 0x71, 0x71, 0x89, 0x69, 0x02, 0x71,
+    0x69, 0x71, 0x82, 0x69, 0x02, 0x71, 0x69, 0x71, 0x89, 0x69, 0x08, 0x71, 0x69, 0x69, 0x71, 0x69,
+    0x69, 0x71, 0x69, 0x71, 0x82, 0x69, 0x00, 0x71, 0x83, 0x69, 0x00, 0x71, 0x01, 0x69, 0x69, 0x83,
+    0x71, 0x01, 0x69, 0x71, 0x87, 0x69, 0x00, 0x4c, 0x83, 0x14, 0x00, 0x15, 0x90, 0x14, 0x06, 0x15,
+    0x15, 0x19, 0x68, 0x69, 0x69, 0x71, 0x9b, 0x69, 0x00, 0x71, 0x91, 0x69, 0x00, 0x71, 0x83, 0x69,
+    0x00, 0x71, 0x86, 0x69, 0x82, 0x71, 0x00, 0x69, 0x85, 0x71, 0x86, 0x69, 0x01, 0x71, 0x71, 0x82,
+    0x69, 0x03, 0x69, 0x71, 0x69, 0x71, 0x85, 0x69, 0x06, 0x71, 0x69, 0x71, 0x71, 0x68, 0x5a, 0x53,
+    0x8f, 0x48, 0x0a, 0x4b, 0x4b, 0x48, 0x48, 0x4b, 0x4b, 0x48, 0x4b, 0x48, 0x55, 0x62, 0x82, 0x69,
+    0x87, 0x71, 0x88, 0x69, 0x01, 0x71, 0x69, 0x86, 0x71, 0x88, 0x69, 0x88, 0x71, 0x89, 0x69, 0x88,
+    0x71, 0x88, 0x69, 0x88, 0x71, 0x06, 0x71, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71, 0x86, 0x69, 0x02,
+    0x54, 0x0e, 0x77, 0x97, 0x9e, 0x06, 0x9c, 0x2e, 0x2d, 0x69, 0x69, 0x71, 0x71, 0x84, 0x69, 0x00,
+    0x71, 0x9d, 0x69, 0x06, 0x71, 0x69, 0x71, 0x71, 0x69, 0x69, 0x71, 0x89, 0x69, 0x02, 0x71, 0x69,
+    0x69, 0x82, 0x71, 0x01, 0x69, 0x71, 0x8b, 0x69, 0x06, 0x71, 0x71, 0x69, 0x71, 0x71, 0x69, 0x71,
+    0x01, 0x71, 0x71, 0x83, 0x69, 0x00, 0x71, 0x84, 0x69, 0x07, 0x68, 0x4d, 0x53, 0x5f, 0x8e, 0xa2,
+    0xa0, 0x9e, 0x82, 0x79, 0x18, 0x87, 0x9e, 0xa0, 0xa2, 0xa1, 0x9e, 0x87, 0x77, 0x77, 0x79, 0x9e,
+    0xa0, 0xa2, 0xa1, 0x9e, 0x87, 0x79, 0x79, 0x77, 0x5f, 0x5f, 0x53, 0x59, 0x71, 0x71, 0x8b, 0x69,
+    0x00, 0x71, 0x93, 0x69, 0x00, 0x71, 0x96, 0x69, 0x00, 0x71, 0x85, 0x69, 0x01, 0x71, 0x71, 0x83,
+    0x69, 0x00, 0x71, 0x83, 0x69, 0x04, 0x71, 0x80, 0x89, 0x72, 0x69, 0x04, 0x69, 0x71, 0x69, 0x71,
+    0x69, 0x82, 0x71, 0x83, 0x69, 0x23, 0x60, 0x13, 0x5f, 0x9e, 0xa7, 0xa8, 0xa2, 0x9e, 0x34, 0x14,
+    0x14, 0x48, 0x9e, 0xa2, 0xa8, 0xa2, 0x9e, 0x4b, 0x14, 0x14, 0x2e, 0x9c, 0xa1, 0xa8, 0xa7, 0x9e,
+    0x5f, 0x13, 0x13, 0x14, 0x99, 0x96, 0x13, 0x35, 0x71, 0x71, 0x86, 0x69, 0x88, 0x71, 0x88, 0x69,
+    0x88, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x83, 0x69, 0x04, 0x71, 0x96, 0x9e,
+    0x80, 0x69, 0x01, 0x69, 0x71, 0x82, 0x69, 0x83, 0x71, 0x82, 0x69, 0x1a, 0x68, 0x53, 0x5f, 0x66,
+    0x96, 0xa2, 0xa0, 0x9e, 0x84, 0x79, 0x79, 0x87, 0x9e, 0xa1, 0xa2, 0xa1, 0x9e, 0x87, 0x79, 0x79,
+    0x84, 0x9e, 0xa0, 0xa2, 0xa1, 0x9e, 0x8a, 0x82, 0x79, 0x04, 0x66, 0x66, 0x53, 0x55, 0x71, 0x87,
+    0x69, 0x82, 0x71, 0x00, 0x69, 0x84, 0x71, 0x88, 0x69, 0x88, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89,
+    0x69, 0x88, 0x71, 0x83, 0x69, 0x04, 0x71, 0x96, 0x9e, 0x80, 0x71, 0x01, 0x69, 0x71, 0x82, 0x69,
+    0x00, 0x71, 0x82, 0x69, 0x82, 0x71, 0x04, 0x69, 0x69, 0x54, 0x13, 0x77, 0x97, 0x9e, 0x03, 0x9c,
+    0x2e, 0x2c, 0x71, 0x89, 0x69, 0x85, 0x71, 0x02, 0x69, 0x71, 0x71, 0x88, 0x69, 0x85, 0x71, 0x01,
+    0x69, 0x71, 0x8a, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x83, 0x69, 0x04, 0x71, 0x96, 0x9e,
+    0x80, 0x69, 0x04, 0x69, 0x69, 0x71, 0x69, 0x69, 0x83, 0x71, 0x82, 0x69, 0x04, 0x71, 0x69, 0x63,
+    0x55, 0x53, 0x98, 0x4b, 0x03, 0x59, 0x60, 0x71, 0x71, 0x8a, 0x69, 0x01, 0x71, 0x71, 0x8d, 0x69,
+    0x03, 0x71, 0x69, 0x71, 0x69, 0x84, 0x71, 0x88, 0x69, 0x00, 0x71, 0x83, 0x69, 0x82, 0x71, 0x87,
+    0x69, 0x01, 0x71, 0x71, 0x82, 0x69, 0x0f, 0x71, 0x69, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x69,
+    0x71, 0x69, 0x71, 0x7a, 0x80, 0x71, 0x69, 0x01, 0x69, 0x71, 0x87, 0x69, 0x83, 0x71, 0x02, 0x69,
+    0x69, 0x4c, 0x97, 0x14, 0x04, 0x19, 0x68, 0x71, 0x69, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0x89, 0x69, 0x87, 0x71, 0x8a, 0x69, 0x01, 0x71, 0x69, 0x84, 0x71, 0x88, 0x69, 0x82, 0x71, 0x06,
+    0x72, 0x71, 0x69, 0x71, 0x71, 0x69, 0x71, 0x02, 0x69, 0x71, 0x69, 0x82, 0x71, 0x86, 0x69, 0x04,
+    0x71, 0x69, 0x69, 0x68, 0x63, 0x83, 0x68, 0x04, 0x63, 0x63, 0x68, 0x68, 0x63, 0x83, 0x68, 0x82,
+    0x63, 0x83, 0x68, 0x83, 0x63, 0x03, 0x69, 0x69, 0x71, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x87, 0x69, 0x00, 0x7a, 0x82, 0x9a, 0x05, 0x89,
+    0x69, 0x8e, 0x9a, 0x7a, 0x69, 0x82, 0x69, 0x82, 0x71, 0x02, 0x69, 0x71, 0x71, 0x85, 0x69, 0x04,
+    0x71, 0x69, 0x69, 0x71, 0x69, 0x87, 0x71, 0x02, 0x69, 0x71, 0x69, 0x87, 0x71, 0x06, 0x69, 0x71,
+    0x71, 0x69, 0x69, 0x71, 0x71, 0x88, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71, 0x89, 0x69, 0x87,
+    0x71, 0x89, 0x69, 0x87, 0x71, 0x00, 0x7a, 0x82, 0x9a, 0x05, 0x8a, 0x71, 0x8e, 0x9c, 0x7a, 0x71,
+    0x06, 0x69, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71, 0x88, 0x69, 0x01, 0x71, 0x69, 0x88, 0x71, 0x84,
+    0x69, 0x05, 0x71, 0x69, 0x69, 0x71, 0x69, 0x69, 0x87, 0x71, 0x88, 0x69, 0x08, 0x71, 0x69, 0x71,
+    0x71, 0x69, 0x69, 0x71, 0x69, 0x71, 0x88, 0x69, 0x04, 0x71, 0x69, 0x71, 0x71, 0x69, 0x83, 0x71,
+    0x89, 0x69, 0x83, 0x71, 0x00, 0x69, 0x82, 0x71, 0x89, 0x69, 0x04, 0x71, 0x69, 0x71, 0x71, 0x69,
+    0x84, 0x71, 0x00, 0x72, 0x86, 0x71, 0x06, 0x69, 0x69, 0x71, 0x71, 0x69, 0x69, 0x71, 0x82, 0x69,
+    0x01, 0x71, 0x69, 0x82, 0x71, 0x82, 0x69, 0x83, 0x71, 0x02, 0x69, 0x71, 0x71, 0x82, 0x69, 0x87,
+    0x71, 0x83, 0x69, 0x84, 0x71, 0x00, 0x69, 0x82, 0x71, 0x88, 0x69, 0x01, 0x71, 0x71, 0x82, 0x69,
+    0x00, 0x71, 0x8a, 0x69, 0x00, 0x71, 0x84, 0x69, 0x00, 0x71, 0x90, 0x69, 0x00, 0x71, 0x85, 0x69,
+    0x00, 0x71, 0x84, 0x69, 0x0f, 0x71, 0x71, 0x69, 0x69, 0x71, 0x69, 0x71, 0x69, 0x71, 0x69, 0x69,
+    0x71, 0x7a, 0x80, 0x71, 0x69, 0x02, 0x69, 0x69, 0x71, 0x8d, 0x69, 0x01, 0x71, 0x71, 0x82, 0x69,
+    0x04, 0x71, 0x69, 0x69, 0x71, 0x71, 0x84, 0x69, 0x01, 0x71, 0x69, 0x82, 0x71, 0x82, 0x69, 0x83,
+    0x71, 0x03, 0x69, 0x71, 0x69, 0x69, 0x83, 0x71, 0x02, 0x69, 0x71, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0x89, 0x69, 0x83, 0x71, 0x00, 0x69, 0x82, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x82, 0x71,
+    0x05, 0x69, 0x69, 0x8f, 0x9e, 0x7a, 0x69, 0x84, 0x69, 0x83, 0x71, 0x89, 0x69, 0x87, 0x71, 0x89,
+    0x69, 0x01, 0x71, 0x71, 0x88, 0x69, 0x00, 0x71, 0x85, 0x69, 0x88, 0x71, 0x89, 0x69, 0x87, 0x71,
+    0x89, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x84, 0x69, 0x03, 0x96, 0x9e, 0x80, 0x69, 0x01,
+    0x71, 0x69, 0x82, 0x71, 0x00, 0x69, 0x82, 0x71, 0x89, 0x69, 0x02, 0x71, 0x71, 0x69, 0x85, 0x71,
+    0x86, 0x69, 0x00, 0x71, 0x9e, 0x69, 0x05, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71, 0x9b, 0x69, 0x02,
+    0x71, 0x69, 0x71, 0x82, 0x69, 0x82, 0x71, 0x03, 0x69, 0x69, 0x71, 0x71, 0x86, 0x69, 0x06, 0x71,
+    0x71, 0x69, 0x96, 0x9e, 0x7a, 0x69, 0x00, 0x71, 0x83, 0x69, 0x83, 0x71, 0x89, 0x69, 0x84, 0x71,
+    0xa7, 0x69, 0x01, 0x71, 0x71, 0x84, 0x69, 0x00, 0x71, 0x8c, 0x69, 0x04, 0x71, 0x71, 0x69, 0x69,
+    0x71, 0x90, 0x69, 0x01, 0x71, 0x71, 0x85, 0x69, 0x01, 0x71, 0x71, 0x86, 0x69, 0x03, 0x80, 0x89,
+    0x72, 0x69, 0x02, 0x69, 0x71, 0x71, 0x84, 0x69, 0x00, 0x71, 0x9c, 0x69, 0x00, 0x71, 0x83, 0x69,
+    0x01, 0x71, 0x71, 0x8a, 0x69, 0x07, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71, 0x71, 0x89, 0x69,
+    0x00, 0x71, 0x83, 0x69, 0x02, 0x71, 0x69, 0x71, 0x89, 0x69, 0x00, 0x71, 0x83, 0x69, 0x00, 0x71,
+    0x87, 0x69, 0x00, 0x71, 0x84, 0x69, 0x82, 0x71, 0x02, 0x69, 0x71, 0x71, 0x84, 0x69, 0x84, 0x71,
+    0x08, 0x69, 0x69, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71, 0x89, 0x69, 0x00, 0x71, 0x84, 0x69,
+    0x01, 0x71, 0x71, 0x90, 0x69, 0x00, 0x71, 0x8b, 0x69, 0x01, 0x71, 0x69, 0x82, 0x71, 0x01, 0x69,
+    0x71, 0x88, 0x69, 0x08, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71, 0x69, 0x71, 0x71, 0x89, 0x69, 0x02,
+    0x71, 0x69, 0x69, 0x84, 0x71, 0x8a, 0x69, 0x83, 0x71, 0x03, 0x69, 0x71, 0x69, 0x71, 0x88, 0x69,
+    0x82, 0x69, 0x03, 0x71, 0x69, 0x69, 0x71, 0x99, 0x69, 0x00, 0x71, 0xa1, 0x69, 0x00, 0x71, 0x8d,
+    0x69, 0x00, 0x71, 0x90, 0x69, 0x00, 0x71, 0x84, 0x69, 0x01, 0x71, 0x71, 0x8d, 0x69, 0x00, 0x71,
+    0x83, 0x69, 0x06, 0x69, 0x69, 0x71, 0x69, 0x69, 0x71, 0x71, 0x95, 0x69, 0x00, 0x71, 0x83, 0x69,
+    0x00, 0x71, 0x9c, 0x69, 0x02, 0x71, 0x69, 0x71, 0x82, 0x69, 0x00, 0x71, 0xa1, 0x69, 0x00, 0x71,
+    0x90, 0x69, 0x00, 0x71, 0x83, 0x69, 0x01, 0x71, 0x69, 0x86, 0x71, 0x89, 0x69, 0x02, 0x71, 0x71,
+    0x69, 0x84, 0x71, 0x89, 0x69, 0x85, 0x71, 0x01, 0x69, 0x71, 0x89, 0x69, 0x04, 0x71, 0x69, 0x71,
+    0x71, 0x69, 0x82, 0x71, 0x8a, 0x69, 0x82, 0x71, 0x82, 0x69, 0x00, 0x71, 0x8a, 0x69, 0x00, 0x71,
+    0x82, 0x69, 0x83, 0x71, 0x89, 0x69, 0x88, 0x71, 0x87, 0x69, 0x00, 0x71, 0x02, 0x69, 0x71, 0x69,
+    0x8b, 0x71, 0x02, 0x69, 0x71, 0x71, 0x88, 0x69, 0x04, 0x71, 0x71, 0x69, 0x69, 0x71, 0x85, 0x69,
+    0x02, 0x71, 0x69, 0x69, 0x86, 0x71, 0x83, 0x69, 0x00, 0x71, 0x9a, 0x69, 0x00, 0x71, 0x83, 0x69,
+    0x83, 0x71, 0x01, 0x69, 0x71, 0x8b, 0x69, 0x86, 0x71, 0x89, 0x69, 0x83, 0x71, 0x03, 0x69, 0x71,
+    0x71, 0x69, 0x8d, 0x68, 0x03, 0x69, 0x69, 0x71, 0x71, 0x8b, 0x69, 0x8c, 0x68, 0x02, 0x69, 0x69,
+    0x71, 0x82, 0x69, 0x00, 0x62, 0x9d, 0x59, 0x01, 0x62, 0x71, 0x89, 0x69, 0x84, 0x71, 0x02, 0x69,
+    0x71, 0x71, 0x89, 0x69, 0x88, 0x71, 0x82, 0x69, 0x05, 0x71, 0x69, 0x71, 0x69, 0x69, 0x71, 0x8d,
+    0x5a, 0x00, 0x63, 0x8d, 0x69, 0x00, 0x62, 0x8d, 0x5a, 0x05, 0x69, 0x71, 0x71, 0x69, 0x71, 0x43,
+    0x9d, 0x00, 0x02, 0x4d, 0x71, 0x71, 0x9f, 0x69, 0x03, 0x71, 0x69, 0x69, 0x71, 0x88, 0x69, 0x8d,
+    0x5a, 0x00, 0x62, 0x8d, 0x63, 0x8e, 0x5a, 0x05, 0x63, 0x68, 0x63, 0x55, 0x4d, 0x67, 0x9d, 0x78,
+    0x09, 0x61, 0x4d, 0x62, 0x71, 0x69, 0x71, 0x71, 0x69, 0x69, 0x71, 0x8d, 0x69, 0x82, 0x71, 0x83,
+    0x69, 0x03, 0x71, 0x71, 0x69, 0x71, 0x84, 0x69, 0x07, 0x71, 0x71, 0x69, 0x71, 0x69, 0x69, 0x71,
+    0x69, 0xae, 0x5a, 0x02, 0x43, 0x00, 0x8c, 0x9d, 0xa5, 0x06, 0x78, 0x00, 0x59, 0x69, 0x71, 0x69,
+    0x69, 0x83, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71, 0xac, 0x5a, 0x04, 0x54, 0x24,
+    0x5e, 0x8c, 0x78, 0x8e, 0x6e, 0x00, 0x7f, 0x84, 0xa5, 0x04, 0x94, 0x91, 0x91, 0x92, 0xa4, 0x83,
+    0xa5, 0x05, 0x98, 0x8c, 0x5f, 0x43, 0x68, 0x71, 0x85, 0x69, 0x87, 0x71, 0x89, 0x69, 0x87, 0x71,
+    0x88, 0x69, 0x00, 0x71, 0xac, 0x5a, 0x04, 0x45, 0x00, 0x78, 0xa5, 0x6e, 0x8e, 0x21, 0x00, 0x51,
+    0x84, 0xa5, 0x04, 0x83, 0x74, 0x74, 0x6c, 0xa4, 0x85, 0xa5, 0x06, 0x58, 0x00, 0x62, 0x69, 0x69,
+    0x71, 0x71, 0x8d, 0x69, 0x00, 0x71, 0x84, 0x69, 0x00, 0x71, 0x82, 0x69, 0x00, 0x71, 0x88, 0x69,
+    0x04, 0x71, 0x71, 0x69, 0x69, 0x71, 0x8d, 0x4f, 0x00, 0x55, 0x8d, 0x5a, 0x8e, 0x4f, 0x05, 0x5a,
+    0x45, 0x00, 0x78, 0xa5, 0x6e, 0x8e, 0x21, 0x00, 0x51, 0x84, 0xa5, 0x04, 0x83, 0x74, 0x74, 0x6c,
+    0xa4, 0x85, 0xa5, 0x04, 0x58, 0x00, 0x62, 0x69, 0x69, 0x83, 0x71, 0x89, 0x69, 0x04, 0x71, 0x71,
+    0x69, 0x71, 0x69, 0x82, 0x71, 0x82, 0x69, 0x00, 0x71, 0x88, 0x69, 0x05, 0x71, 0x69, 0x69, 0x71,
+    0x71, 0x69, 0x87, 0x4f, 0x00, 0x47, 0x83, 0x4f, 0x01, 0x47, 0x4f, 0x8d, 0x5a, 0x01, 0x4f, 0x47,
+    0x8c, 0x4f, 0x05, 0x5a, 0x45, 0x00, 0x78, 0xa5, 0x6e, 0x82, 0x21, 0x88, 0x23, 0x82, 0x21, 0x00,
+    0x51, 0x83, 0xa5, 0x05, 0xa6, 0x83, 0x7c, 0x75, 0x6c, 0xa4, 0x85, 0xa5, 0x04, 0x58, 0x00, 0x62,
+    0x69, 0x69, 0x83, 0x71, 0x89, 0x69, 0x02, 0x71, 0x71, 0x69, 0x84, 0x71, 0x89, 0x69, 0x83, 0x71,
+    0x00, 0x69, 0x83, 0x71, 0x8c, 0x4f, 0x84, 0x47, 0x8a, 0x4f, 0x8d, 0x47, 0x0a, 0x4f, 0x4f, 0x44,
+    0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x3b, 0x87, 0x28, 0x03, 0x1c, 0x21, 0x21, 0x51, 0x84,
+    0xa5, 0x83, 0xa4, 0x86, 0xa5, 0x02, 0x58, 0x00, 0x62, 0x8e, 0x69, 0x00, 0x71, 0x90, 0x69, 0x00,
+    0x71, 0x88, 0x69, 0x84, 0x4f, 0x02, 0x47, 0x4f, 0x47, 0x84, 0x4f, 0x83, 0x47, 0x8a, 0x4f, 0x04,
+    0x47, 0x4f, 0x47, 0x4f, 0x47, 0x82, 0x4f, 0x03, 0x47, 0x4f, 0x4f, 0x47, 0x84, 0x4f, 0x07, 0x44,
+    0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x05, 0x1c, 0x21, 0x21, 0x51, 0xa5, 0xa4,
+    0x83, 0x9f, 0x02, 0x9d, 0x9d, 0x9f, 0x86, 0xa5, 0x03, 0x58, 0x00, 0x62, 0x68, 0x82, 0x62, 0x00,
+    0x68, 0x84, 0x69, 0x00, 0x71, 0x82, 0x69, 0x00, 0x71, 0x91, 0x69, 0x00, 0x71, 0x88, 0x69, 0x83,
+    0x4f, 0x00, 0x47, 0x84, 0x4f, 0x02, 0x47, 0x4f, 0x4f, 0x86, 0x47, 0x00, 0x4f, 0x87, 0x47, 0x82,
+    0x4f, 0x04, 0x47, 0x4f, 0x47, 0x4f, 0x47, 0x82, 0x4f, 0x00, 0x47, 0x82, 0x4f, 0x08, 0x47, 0x44,
+    0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x05, 0x1c, 0x21, 0x21, 0x51, 0xa5, 0x8d,
+    0x82, 0x00, 0x04, 0x56, 0x6b, 0x6b, 0x6c, 0xa4, 0x85, 0xa5, 0x08, 0x58, 0x00, 0x62, 0x68, 0x07,
+    0x00, 0x00, 0x36, 0x69, 0x88, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x01, 0x3f, 0x47, 0x8b,
+    0x3f, 0x01, 0x47, 0x4f, 0x88, 0x47, 0x00, 0x4f, 0x82, 0x47, 0x87, 0x3f, 0x0f, 0x47, 0x3f, 0x3f,
+    0x47, 0x3f, 0x3f, 0x47, 0x47, 0x44, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x05,
+    0x1c, 0x21, 0x21, 0x41, 0x95, 0x7f, 0x82, 0x41, 0x04, 0x50, 0x5c, 0x75, 0x6c, 0xa4, 0x85, 0xa5,
+    0x03, 0x58, 0x00, 0x53, 0x54, 0x82, 0x41, 0x02, 0x4b, 0x55, 0x62, 0x89, 0x69, 0x82, 0x71, 0x01,
+    0x69, 0x71, 0x8b, 0x69, 0x00, 0x71, 0x82, 0x69, 0x04, 0x71, 0x69, 0x69, 0x71, 0x69, 0x8d, 0x39,
+    0x00, 0x3e, 0x8d, 0x47, 0x00, 0x3a, 0x8d, 0x39, 0x08, 0x47, 0x44, 0x00, 0x78, 0xa5, 0x6e, 0x21,
+    0x21, 0x23, 0x88, 0x28, 0x0d, 0x1c, 0x21, 0x21, 0x14, 0x00, 0x49, 0x7f, 0x85, 0x7f, 0x41, 0x00,
+    0x64, 0x6c, 0xa4, 0x85, 0xa5, 0x09, 0x58, 0x00, 0x00, 0x14, 0x7f, 0x85, 0x85, 0x5e, 0x00, 0x4d,
+    0x88, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71, 0x8d, 0x39, 0x05, 0x3a, 0x3f, 0x3e, 0x3f, 0x3f,
+    0x3e, 0x83, 0x3f, 0x83, 0x3e, 0x01, 0x3f, 0x3a, 0x83, 0x39, 0x00, 0x31, 0x86, 0x1d, 0x0a, 0x32,
+    0x39, 0x3f, 0x31, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x0d, 0x1c, 0x21, 0x21,
+    0x20, 0x00, 0x49, 0x7f, 0x7f, 0x85, 0x67, 0x58, 0x50, 0x50, 0xa4, 0x85, 0xa5, 0x09, 0x58, 0x00,
+    0x51, 0x58, 0x7f, 0x7f, 0x85, 0x5e, 0x00, 0x4d, 0x88, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71,
+    0xa1, 0x39, 0x00, 0x30, 0x85, 0x00, 0x0b, 0x02, 0x31, 0x32, 0x39, 0x30, 0x00, 0x78, 0xa5, 0x6e,
+    0x21, 0x21, 0x23, 0x88, 0x28, 0x07, 0x1c, 0x21, 0x21, 0x14, 0x00, 0x49, 0x85, 0x7f, 0x82, 0x85,
+    0x02, 0x21, 0x21, 0xa4, 0x85, 0xa5, 0x03, 0x58, 0x01, 0x78, 0x7f, 0x82, 0x85, 0x02, 0x5e, 0x00,
+    0x4d, 0x88, 0x69, 0x87, 0x71, 0x89, 0x69, 0x84, 0x71, 0x00, 0x69, 0x82, 0x71, 0xa1, 0x39, 0x02,
+    0x30, 0x00, 0x3d, 0x82, 0x67, 0x0c, 0x2b, 0x00, 0x16, 0x17, 0x32, 0x30, 0x00, 0x78, 0xa5, 0x6e,
+    0x21, 0x21, 0x23, 0x88, 0x28, 0x0a, 0x1c, 0x21, 0x21, 0x14, 0x00, 0x49, 0x85, 0x7f, 0x85, 0x7f,
+    0x7f, 0x8a, 0x67, 0x83, 0x7f, 0x03, 0x85, 0x5e, 0x00, 0x4d, 0x88, 0x69, 0x87, 0x71, 0x89, 0x69,
+    0x84, 0x71, 0x00, 0x69, 0x82, 0x71, 0xa1, 0x39, 0x12, 0x30, 0x00, 0x51, 0x85, 0x7f, 0x85, 0x33,
+    0x01, 0x00, 0x0c, 0x39, 0x30, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x06, 0x1c,
+    0x21, 0x21, 0x20, 0x00, 0x49, 0x7f, 0x83, 0x85, 0x02, 0x7f, 0x7f, 0x0b, 0x85, 0x01, 0x01, 0x67,
+    0x7f, 0x82, 0x85, 0x04, 0x7f, 0x7f, 0x5e, 0x00, 0x4d, 0x88, 0x69, 0x87, 0x71, 0x89, 0x69, 0x88,
+    0x71, 0x8d, 0x26, 0x00, 0x27, 0x8d, 0x39, 0x00, 0x27, 0x83, 0x26, 0x12, 0x1d, 0x00, 0x14, 0x33,
+    0x67, 0x85, 0x78, 0x6e, 0x13, 0x01, 0x0e, 0x0d, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88,
+    0x28, 0x07, 0x1c, 0x21, 0x21, 0x20, 0x00, 0x49, 0x85, 0x7f, 0x82, 0x85, 0x01, 0x7f, 0x7f, 0x86,
+    0x78, 0x02, 0x7f, 0x85, 0x85, 0x83, 0x7f, 0x02, 0x5e, 0x00, 0x4d, 0x88, 0x69, 0x88, 0x71, 0x88,
+    0x69, 0x88, 0x71, 0x8d, 0x1e, 0x00, 0x27, 0x8d, 0x39, 0x83, 0x26, 0x01, 0x1f, 0x17, 0x82, 0x00,
+    0x04, 0x5e, 0x86, 0x7f, 0x7f, 0x14, 0x83, 0x00, 0x05, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88,
+    0x28, 0x07, 0x1c, 0x21, 0x21, 0x14, 0x00, 0x49, 0x85, 0x7f, 0x84, 0x85, 0x03, 0x7f, 0x7f, 0x85,
+    0x7f, 0x82, 0x85, 0x01, 0x7f, 0x85, 0x83, 0x7f, 0x03, 0x85, 0x5e, 0x00, 0x4d, 0x88, 0x69, 0x87,
+    0x71, 0x89, 0x69, 0x84, 0x71, 0x03, 0x69, 0x71, 0x71, 0x69, 0xa2, 0x1e, 0x01, 0x25, 0x16, 0x82,
+    0x00, 0x03, 0x6e, 0x7f, 0x7f, 0x78, 0x82, 0x00, 0x05, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88,
+    0x28, 0x03, 0x1c, 0x21, 0x00, 0x33, 0x83, 0x7f, 0x0c, 0x85, 0x7f, 0x7f, 0x85, 0x7f, 0x85, 0x85,
+    0x7f, 0x85, 0x85, 0x7f, 0x85, 0x85, 0x86, 0x7f, 0x03, 0x85, 0x51, 0x00, 0x55, 0x85, 0x71, 0x89,
+    0x69, 0x88, 0x71, 0x88, 0x69, 0xa3, 0x1e, 0x10, 0x17, 0x03, 0x02, 0x00, 0x67, 0x78, 0x7f, 0x7e,
+    0x33, 0x21, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x0c, 0x1c, 0x21, 0x00, 0x33,
+    0x85, 0x85, 0x7f, 0x85, 0x7f, 0x8d, 0x97, 0x78, 0x78, 0x84, 0x7f, 0x10, 0x85, 0x7f, 0x85, 0x7f,
+    0x95, 0x95, 0x78, 0x78, 0x7f, 0x7f, 0x86, 0x51, 0x00, 0x55, 0x71, 0x69, 0x69, 0x82, 0x71, 0x89,
+    0x69, 0x01, 0x71, 0x69, 0x86, 0x71, 0x88, 0x69, 0xa5, 0x1e, 0x0e, 0x0f, 0x00, 0x01, 0x0a, 0x7e,
+    0x85, 0x7f, 0x6e, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x03, 0x1c, 0x21, 0x00,
+    0x2b, 0x84, 0x85, 0x05, 0xa9, 0xac, 0x49, 0x14, 0x7f, 0x7f, 0x83, 0x85, 0x0d, 0x7f, 0x85, 0x7f,
+    0xaa, 0xaa, 0x14, 0x33, 0x7f, 0x85, 0x85, 0x51, 0x00, 0x55, 0x71, 0x88, 0x69, 0x00, 0x71, 0x84,
+    0x69, 0x02, 0x71, 0x71, 0x69, 0x84, 0x71, 0x88, 0x69, 0x00, 0x71, 0xa5, 0x1e, 0x0e, 0x16, 0x0d,
+    0x02, 0x07, 0x5e, 0x67, 0x67, 0x58, 0x00, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28, 0x20,
+    0x1c, 0x21, 0x00, 0x33, 0x85, 0x7f, 0x85, 0x85, 0x7f, 0x9f, 0xa6, 0x3d, 0x13, 0x7f, 0x7f, 0x85,
+    0x85, 0x7f, 0x78, 0x67, 0x7e, 0x85, 0xa5, 0x9f, 0x0b, 0x33, 0x85, 0x7f, 0x85, 0x51, 0x00, 0x55,
+    0x71, 0x8f, 0x69, 0x87, 0x71, 0x87, 0x69, 0x00, 0x71, 0x8d, 0x18, 0x00, 0x1d, 0x8d, 0x1e, 0x00,
+    0x1d, 0x89, 0x18, 0x00, 0x03, 0x85, 0x00, 0x05, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x88, 0x28,
+    0x0c, 0x1c, 0x21, 0x00, 0x33, 0x85, 0x85, 0x7f, 0x85, 0x85, 0x41, 0x00, 0x00, 0x13, 0x84, 0x7f,
+    0x12, 0x51, 0x00, 0x6e, 0x7f, 0x21, 0x00, 0x00, 0x33, 0x85, 0x7f, 0x85, 0x51, 0x00, 0x55, 0x71,
+    0x69, 0x71, 0x69, 0x71, 0x8d, 0x69, 0x03, 0x71, 0x69, 0x71, 0x71, 0x8a, 0x69, 0x8d, 0x18, 0x8f,
+    0x1d, 0x89, 0x18, 0x03, 0x16, 0x09, 0x09, 0x08, 0x82, 0x00, 0x05, 0x78, 0xa5, 0x6e, 0x21, 0x21,
+    0x23, 0x88, 0x28, 0x05, 0x1c, 0x21, 0x00, 0x2b, 0x85, 0x93, 0x82, 0xa3, 0x10, 0x7d, 0x58, 0x58,
+    0x5e, 0x7f, 0x7f, 0x85, 0x85, 0x7f, 0x6e, 0x58, 0x78, 0x7f, 0x5e, 0x58, 0x58, 0x6d, 0x82, 0xa3,
+    0x03, 0x76, 0x00, 0x55, 0x71, 0x88, 0x69, 0x85, 0x71, 0x85, 0x69, 0x00, 0x71, 0x8a, 0x69, 0xaa,
+    0x18, 0x00, 0x17, 0x82, 0x00, 0x05, 0x78, 0xa5, 0x6e, 0x21, 0x21, 0x23, 0x85, 0x28, 0x08, 0x29,
+    0x28, 0x28, 0x1c, 0x21, 0x00, 0x33, 0x85, 0x9b, 0x82, 0xab, 0x01, 0x9b, 0x85, 0x82, 0x7f, 0x84,
+    0x85, 0x02, 0x7f, 0x85, 0x85, 0x82, 0x7f, 0x00, 0x93, 0x82, 0xab, 0x02, 0x90, 0x00, 0x55, 0x85,
+    0x71, 0x8b, 0x69, 0x02, 0x71, 0x69, 0x71, 0x88, 0x69, 0x03, 0x71, 0x69, 0x69, 0x71, 0xab, 0x18,
+    0x05, 0x16, 0x0f, 0x00, 0x78, 0xa5, 0x6e, 0x82, 0x21, 0x00, 0x25, 0x87, 0x1e, 0x05, 0x23, 0x21,
+    0x00, 0x33, 0x85, 0x9b, 0x82, 0xab, 0x10, 0x9b, 0x86, 0x51, 0x49, 0x7f, 0x85, 0x85, 0x6e, 0x41,
+    0x67, 0x7f, 0x85, 0x85, 0x49, 0x49, 0x7f, 0x93, 0x82, 0xab, 0x02, 0x90, 0x00, 0x55, 0x84, 0x71,
+    0x85, 0x69, 0x00, 0x71, 0x83, 0x69, 0x02, 0x71, 0x71, 0x69, 0x85, 0x71, 0x88, 0x69, 0x9b, 0x18,
+    0x00, 0x1d, 0x8f, 0x18, 0x04, 0x16, 0x00, 0x78, 0xa5, 0x6e, 0x8d, 0x21, 0x03, 0x00, 0x33, 0x85,
+    0x9b, 0x82, 0xab, 0x10, 0x9b, 0x85, 0x21, 0x13, 0x7f, 0x7f, 0x85, 0x67, 0x00, 0x5e, 0x86, 0x85,
+    0x7f, 0x21, 0x14, 0x7f, 0x93, 0x82, 0xab, 0x06, 0x90, 0x00, 0x55, 0x71, 0x69, 0x69, 0x71, 0x82,
+    0x69, 0x02, 0x71, 0x71, 0x69, 0x83, 0x71, 0x01, 0x69, 0x71, 0x88, 0x69, 0x00, 0x71, 0x87, 0x69,
+    0x8d, 0x11, 0x00, 0x17, 0x8d, 0x18, 0x82, 0x17, 0x8a, 0x11, 0x06, 0x17, 0x18, 0x16, 0x00, 0x78,
+    0xa5, 0x6e, 0x85, 0x21, 0x02, 0x3c, 0x65, 0x50, 0x83, 0x21, 0x04, 0x14, 0x9d, 0x95, 0x21, 0x58,
+    0x82, 0x93, 0x03, 0x85, 0x85, 0x21, 0x01, 0x82, 0x21, 0x02, 0x14, 0x00, 0x13, 0x82, 0x21, 0x0c,
+    0x06, 0x14, 0x7f, 0x85, 0x93, 0x7d, 0x40, 0x57, 0x62, 0x68, 0x71, 0x69, 0x69, 0x82, 0x71, 0x86,
+    0x69, 0x00, 0x71, 0x83, 0x69, 0x00, 0x71, 0x83, 0x69, 0x00, 0x71, 0x88, 0x69, 0x00, 0x71, 0x8d,
+    0x10, 0x00, 0x17, 0x8d, 0x18, 0x88, 0x11, 0x0b, 0x10, 0x11, 0x11, 0x10, 0x10, 0x11, 0x17, 0x10,
+    0x00, 0x6e, 0xa4, 0x6e, 0x85, 0x33, 0x02, 0x40, 0x6c, 0x5d, 0x84, 0x33, 0x05, 0xa5, 0x9d, 0x21,
+    0x51, 0x7e, 0x7f, 0x82, 0x85, 0x00, 0x33, 0x8a, 0x13, 0x07, 0x2a, 0x7f, 0x7f, 0x7e, 0x58, 0x0c,
+    0x53, 0x71, 0x83, 0x69, 0x01, 0x71, 0x71, 0x8e, 0x69, 0x00, 0x71, 0x89, 0x69, 0x02, 0x71, 0x69,
+    0x71, 0x8e, 0x10, 0x03, 0x11, 0x11, 0x10, 0x11, 0x88, 0x10, 0x00, 0x11, 0x8d, 0x10, 0x06, 0x16,
+    0x02, 0x01, 0x00, 0x0a, 0x14, 0x8c, 0x87, 0xa5, 0x00, 0xa4, 0x87, 0xa5, 0x04, 0x8c, 0x0a, 0x5e,
+    0x85, 0x85, 0x8e, 0x7f, 0x04, 0x6e, 0x0a, 0x42, 0x68, 0x68, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71,
+    0x87, 0x69, 0x00, 0x71, 0xa9, 0x10, 0x01, 0x09, 0x1a, 0x82, 0x2b, 0x02, 0x33, 0x33, 0x7f, 0x85,
+    0x98, 0x89, 0x97, 0x03, 0x98, 0x7f, 0x00, 0x51, 0x90, 0x6e, 0x0e, 0x67, 0x22, 0x4c, 0x71, 0x69,
+    0x69, 0x71, 0x71, 0x69, 0x71, 0x69, 0x69, 0x71, 0x69, 0x71, 0x8f, 0x69, 0x00, 0x71, 0x88, 0x69,
+    0xa9, 0x10, 0x07, 0x01, 0x21, 0x7f, 0x7f, 0x85, 0x85, 0x86, 0x49, 0xa4, 0x00, 0x00, 0x2d, 0x82,
+    0x71, 0x03, 0x69, 0x69, 0x71, 0x69, 0x83, 0x71, 0x04, 0x69, 0x69, 0x71, 0x69, 0x71, 0x85, 0x69,
+    0x87, 0x71, 0x84, 0x69, 0x01, 0x71, 0x71, 0x82, 0x69, 0x8d, 0x44, 0x01, 0x30, 0x11, 0x8c, 0x10,
+    0x00, 0x30, 0x8b, 0x44, 0x0c, 0x07, 0x21, 0x7f, 0x85, 0x85, 0x78, 0x67, 0x3d, 0x00, 0x35, 0x42,
+    0x02, 0x0b, 0x82, 0x49, 0x02, 0x33, 0x00, 0x2f, 0x87, 0x43, 0x02, 0x22, 0x00, 0x3d, 0x82, 0x49,
+    0x05, 0x06, 0x0c, 0x42, 0x2f, 0x00, 0x33, 0x82, 0x49, 0x07, 0x0a, 0x07, 0x42, 0x4c, 0x71, 0x69,
+    0x71, 0x71, 0x82, 0x69, 0x83, 0x71, 0x04, 0x69, 0x71, 0x69, 0x71, 0x71, 0x87, 0x69, 0x01, 0x71,
+    0x69, 0x82, 0x71, 0x8a, 0x69, 0x8d, 0x69, 0x00, 0x55, 0x8d, 0x10, 0x00, 0x5a, 0x8a, 0x69, 0x06,
+    0x68, 0x0d, 0x21, 0x7f, 0x85, 0x85, 0x5e, 0x82, 0x00, 0x09, 0x60, 0x6f, 0x0c, 0x2a, 0x86, 0x7f,
+    0x7f, 0x5e, 0x00, 0x59, 0x87, 0x71, 0x02, 0x4c, 0x00, 0x67, 0x82, 0x7f, 0x05, 0x0a, 0x22, 0x71,
+    0x53, 0x00, 0x5e, 0x82, 0x7f, 0x04, 0x21, 0x12, 0x6f, 0x71, 0x71, 0x83, 0x69, 0x83, 0x71, 0x03,
+    0x69, 0x69, 0x71, 0x71, 0x8a, 0x69, 0x01, 0x71, 0x71, 0x8c, 0x69, 0x00, 0x71, 0x01, 0x71, 0x69,
+    0x84, 0x71, 0x01, 0x69, 0x71, 0x84, 0x69, 0x02, 0x70, 0x70, 0x60, 0x87, 0x54, 0x06, 0x60, 0x79,
+    0x60, 0x54, 0x63, 0x71, 0x71, 0x88, 0x69, 0x02, 0x68, 0x0d, 0x0b, 0x82, 0x51, 0x07, 0x3d, 0x00,
+    0x35, 0x4d, 0x63, 0x68, 0x0c, 0x0b, 0x82, 0x51, 0x05, 0x52, 0x4d, 0x62, 0x71, 0x69, 0x71, 0x82,
+    0x69, 0x0c, 0x71, 0x71, 0x60, 0x4d, 0x51, 0x58, 0x51, 0x51, 0x07, 0x22, 0x71, 0x62, 0x4d, 0x83,
+    0x51, 0x02, 0x52, 0x4d, 0x6f, 0x83, 0x71, 0x83, 0x69, 0x02, 0x71, 0x69, 0x69, 0x82, 0x71, 0x00,
+    0x69, 0x86, 0x71, 0x92, 0x69, 0x88, 0x71, 0x84, 0x69, 0x02, 0x89, 0x9e, 0x8a, 0x87, 0x71, 0x06,
+    0x89, 0x9e, 0x89, 0x71, 0x69, 0x71, 0x71, 0x84, 0x69, 0x83, 0x71, 0x01, 0x68, 0x0d, 0x85, 0x00,
+    0x04, 0x53, 0x71, 0x69, 0x68, 0x0c, 0x83, 0x00, 0x03, 0x4c, 0x71, 0x71, 0x69, 0x85, 0x71, 0x82,
+    0x69, 0x00, 0x35, 0x83, 0x00, 0x04, 0x22, 0x69, 0x71, 0x71, 0x43, 0x82, 0x00, 0x00, 0x62, 0x85,
+    0x71, 0x85, 0x69, 0x03, 0x71, 0x71, 0x69, 0x69, 0x87, 0x71, 0x88, 0x69, 0x00, 0x71, 0x83, 0x69,
+    0x01, 0x71, 0x69, 0x82, 0x71, 0x01, 0x69, 0x71, 0x86, 0x69, 0x84, 0x71, 0x02, 0x7a, 0x80, 0x7a,
+    0x87, 0x71, 0x02, 0x72, 0x80, 0x7a, 0x8c, 0x71, 0x01, 0x69, 0x60, 0x85, 0x59, 0x00, 0x68, 0x82,
+    0x69, 0x84, 0x59, 0x00, 0x62, 0x82, 0x69, 0x86, 0x71, 0x02, 0x89, 0x99, 0x6f, 0x83, 0x59, 0x04,
+    0x60, 0x69, 0x69, 0x71, 0x62, 0x82, 0x59, 0x82, 0x69, 0x83, 0x71, 0x84, 0x69, 0x00, 0x71, 0x83,
+    0x69, 0x87, 0x71, 0x89, 0x69, 0x88, 0x71, 0x01, 0x69, 0x69, 0x85, 0x71, 0x84, 0x69, 0x00, 0x71,
+    0x83, 0x69, 0x85, 0x71, 0x01, 0x69, 0x69, 0x89, 0x71, 0x00, 0x69, 0x84, 0x71, 0x00, 0x69, 0x86,
+    0x71, 0x82, 0x69, 0x00, 0x71, 0x86, 0x69, 0x82, 0x71, 0x01, 0x69, 0x71, 0x82, 0x69, 0x02, 0x8e,
+    0x9e, 0x88, 0x83, 0x71, 0x84, 0x69, 0x05, 0x71, 0x71, 0x69, 0x71, 0x69, 0x69, 0x82, 0x71, 0x02,
+    0x69, 0x71, 0x71, 0x92, 0x69, 0x00, 0x71, 0x83, 0x69, 0x03, 0x71, 0x71, 0x69, 0x69, 0x85, 0x71,
+    0x00, 0x69, 0x83, 0x69, 0x00, 0x71, 0x83, 0x69, 0x82, 0x71, 0x85, 0x69, 0x82, 0x71, 0x00, 0x69,
+    0x84, 0x71, 0x89, 0x69, 0x87, 0x71, 0x86, 0x69, 0x82, 0x71, 0x88, 0x69, 0x82, 0x71, 0x06, 0x69,
+    0x69, 0x8e, 0x9e, 0x88, 0x69, 0x71, 0x88, 0x69, 0x82, 0x71, 0x83, 0x69, 0x00, 0x71, 0x93, 0x69,
+    0x00, 0x71, 0x8f, 0x69, 0x84, 0x69, 0x83, 0x71, 0x00, 0x69, 0x87, 0x71, 0x03, 0x69, 0x69, 0x72,
+    0x72, 0x84, 0x71, 0x89, 0x69, 0x88, 0x71, 0x88, 0x69, 0x88, 0x71, 0x01, 0x69, 0x71, 0x82, 0x72,
+    0x02, 0x8e, 0x9c, 0x88, 0x82, 0x72, 0x01, 0x71, 0x69, 0x82, 0x71, 0x01, 0x69, 0x71, 0x82, 0x69,
+    0x00, 0x71, 0x84, 0x69, 0x84, 0x71, 0x02, 0x69, 0x71, 0x71, 0x88, 0x69, 0x05, 0x71, 0x69, 0x69,
+    0x71, 0x71, 0x69, 0x84, 0x71, 0x88, 0x69, 0x84, 0x69, 0x83, 0x71, 0x82, 0x69, 0x00, 0x71, 0x84,
+    0x69, 0x05, 0x71, 0x71, 0x99, 0x9a, 0x71, 0x71, 0x82, 0x69, 0x89, 0x71, 0x88, 0x69, 0x84, 0x71,
+    0x00, 0x69, 0x82, 0x71, 0x88, 0x69, 0x01, 0x71, 0x80, 0x82, 0x9e, 0x06, 0x8e, 0x71, 0x99, 0x9e,
+    0x9e, 0x9a, 0x72, 0x82, 0x69, 0x07, 0x71, 0x69, 0x71, 0x71, 0x69, 0x71, 0x71, 0x69, 0x82, 0x71,
+    0x02, 0x69, 0x71, 0x71, 0x88, 0x69, 0x87, 0x71, 0x86, 0x69, 0x02, 0x71, 0x69, 0x69, 0x82, 0x71,
+    0x00, 0x69, 0x82, 0x71, 0x00, 0x69, 0x82, 0x69, 0x05, 0x71, 0x69, 0x69, 0x71, 0x69, 0x71, 0x88,
+    0x69, 0x03, 0x71, 0x69, 0x96, 0x96, 0x84, 0x71, 0x89, 0x69, 0x88, 0x71, 0x89, 0x69, 0x87, 0x71,
+    0x01, 0x69, 0x7a, 0x82, 0x99, 0x07, 0x8e, 0x80, 0x8e, 0x99, 0x99, 0x96, 0x71, 0x69, 0x85, 0x71,
+    0x82, 0x69, 0x02, 0x71, 0x69, 0x71, 0x82, 0x69, 0x87, 0x71, 0x85, 0x69, 0x00, 0x71, 0x86, 0x69,
+    0x00, 0x71, 0x86, 0x69, 0x00, 0x71, 0x82, 0x69, 0x01, 0x71, 0x69, 0x84, 0x69, 0x82, 0x71, 0x02,
+    0x69, 0x69, 0x71, 0x83, 0x69, 0x82, 0x71, 0x04, 0x69, 0x69, 0x71, 0x69, 0x69, 0x84, 0x71, 0x82,
+    0x69, 0x00, 0x71, 0x82, 0x69, 0x01, 0x71, 0x69, 0x88, 0x71, 0x87, 0x69, 0x00, 0x71, 0x87, 0x69,
+    0x02, 0x71, 0x69, 0x69, 0x82, 0x71, 0x02, 0x8e, 0x9e, 0x88, 0x82, 0x71, 0x00, 0x69, 0x82, 0x71,
+    0x04, 0x69, 0x71, 0x69, 0x71, 0x71, 0x83, 0x69, 0x83, 0x71, 0x89, 0x69, 0x01, 0x71, 0x71, 0x83,
+    0x69, 0x00, 0x71, 0x89, 0x69, 0x83, 0x71, 0x84, 0x69, 0x02, 0x69, 0x69, 0x71, 0x83, 0x69, 0x0b,
+    0x71, 0x69, 0x69, 0x71, 0x69, 0x69, 0x71, 0x69, 0x71, 0x69, 0x69, 0x71, 0x83, 0x69, 0x03, 0x71,
+    0x71, 0x69, 0x71, 0x89, 0x69, 0x03, 0x71, 0x69, 0x71, 0x71, 0x84, 0x69, 0x01, 0x71, 0x71, 0x8d,
+    0x69, 0x00, 0x71, 0x85, 0x69, 0x03, 0x8e, 0x9e, 0x88, 0x71, 0x82, 0x69, 0x01, 0x71, 0x71, 0x83,
+    0x69, 0x83, 0x71, 0x05, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71, 0x88, 0x69, 0x88, 0x71, 0x88, 0x69,
+    0x88, 0x71, 0x86, 0x69, 0x01, 0x71, 0x71, 0x83, 0x69, 0x07, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71,
+    0x69, 0x71, 0x83, 0x69, 0x01, 0x71, 0x69, 0x84, 0x71, 0x84, 0x69, 0x86, 0x71, 0x02, 0x69, 0x69,
+    0x71, 0x90, 0x69, 0x00, 0x71, 0x82, 0x69, 0x04, 0x71, 0x8e, 0x9e, 0x88, 0x71, 0x86, 0x69, 0x01,
+    0x71, 0x69, 0x82, 0x71, 0x00, 0x69, 0x83, 0x71, 0x02, 0x69, 0x69, 0x71, 0x87, 0x69, 0x01, 0x71,
+    0x71, 0x8e, 0x69, 0x00, 0x71, 0x88, 0x69, 0x08, 0x71, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71,
+    0x69, 0x83, 0x71, 0x00, 0x69, 0x83, 0x71, 0x84, 0x69, 0x05, 0x71, 0x71, 0x69, 0x71, 0x71, 0x69,
+    0x86, 0x71, 0x84, 0x69, 0x84, 0x71, 0x01, 0x69, 0x71, 0x86, 0x69, 0x85, 0x71, 0x01, 0x69, 0x71,
+    0x84, 0x69, 0x05, 0x71, 0x80, 0x8a, 0x7a, 0x69, 0x71, 0x88, 0x69, 0x00, 0x71, 0x84, 0x69, 0x03,
+    0x71, 0x69, 0x69, 0x71, 0x83, 0x69, 0x03, 0x71, 0x71, 0x69, 0x69, 0x84, 0x71, 0x04, 0x69, 0x71,
+    0x71, 0x69, 0x71, 0x85, 0x69, 0x01, 0x71, 0x69, 0x87, 0x71, 0x00, 0x69, 0x01, 0x69, 0x69, 0x86,
+    0x71, 0x03, 0x69, 0x71, 0x71, 0x69, 0x84, 0x71, 0x02, 0x69, 0x69, 0x71, 0x85, 0x69, 0x06, 0x71,
+    0x69, 0x71, 0x69, 0x71, 0x71, 0x69, 0x82, 0x71, 0x83, 0x69, 0x04, 0x71, 0x69, 0x71, 0x69, 0x69,
+    0x88, 0x71, 0x88, 0x69, 0x82, 0x71, 0x03, 0x69, 0x69, 0x71, 0x71, 0x82, 0x69, 0x06, 0x71, 0x69,
+    0x69, 0x71, 0x69, 0x69, 0x71, 0x82, 0x69, 0x01, 0x71, 0x69, 0x82, 0x71, 0x8b, 0x69, 0x82, 0x71,
+    0x97, 0x69, 0x00, 0x69, 0x87, 0x71, 0x88, 0x69, 0x86, 0x71, 0x01, 0x69, 0x71, 0x89, 0x69, 0x88,
+    0x71, 0x00, 0x69, 0x83, 0x71, 0x02, 0x69, 0x71, 0x71, 0x84, 0x69, 0x82, 0x71, 0x83, 0x69, 0x03,
+    0x71, 0x71, 0x69, 0x71, 0x82, 0x69, 0x00, 0x71, 0x91, 0x69, 0x87, 0x71, 0x02, 0x69, 0x69, 0x71,
+    0x86, 0x69, 0x87, 0x71, 0x89, 0x69, 0x01, 0x71, 0x71, 0x85, 0x69, 0x00, 0x71, 0x84, 0x69, 0x02,
+    0x71, 0x71, 0x69, 0x8a, 0x71, 0x82, 0x69, 0x03, 0x71, 0x71, 0x69, 0x71, 0x82, 0x69, 0x04, 0x71,
+    0x71, 0x69, 0x71, 0x69, 0x82, 0x71, 0x88, 0x69, 0x02, 0x71, 0x69, 0x69, 0x85, 0x71, 0x86, 0x69,
+    0x01, 0x71, 0x71, 0x8b, 0x69, 0x82, 0x71, 0x8a, 0x69, 0x04, 0x71, 0x69, 0x69, 0x71, 0x71, 0x8e,
+    0x69, 0x02, 0x71, 0x71, 0x69, 0x85, 0x71, 0x01, 0x69, 0x71, 0x83, 0x69, 0x82, 0x71, 0x83, 0x69,
+    0x84, 0x71, 0x86, 0x69, 0x04, 0x71, 0x69, 0x71, 0x69, 0x71, 0x87, 0x69, 0x87, 0x71, 0x88, 0x69,
+    0x86, 0x71, 0x86, 0x69, 0x83, 0x71, 0x04, 0x69, 0x69, 0x71, 0x71, 0x69, 0x83, 0x71, 0x89, 0x69,
+    0x85, 0x71, 0x8f, 0x69, 0x00, 0x71, 0x82, 0x69, 0x00, 0x71, 0x85, 0x69, 0x02, 0x71, 0x71, 0x69,
+    0x82, 0x71, 0x00, 0x69, 0x82, 0x71, 0x01, 0x69, 0x69, 0x85, 0x71, 0x04, 0x69, 0x71, 0x71, 0x69,
+    0x71, 0x83, 0x69, 0x02, 0x71, 0x69, 0x69, 0x82, 0x71, 0x00, 0x69, 0x82, 0x71, 0x02, 0x69, 0x71,
+    0x71, 0x86, 0x69, 0x03, 0x71, 0x71, 0x69, 0x71, 0x86, 0x69, 0x88, 0x71, 0x85, 0x69, 0x02, 0x71,
+    0x71, 0x69, 0x82, 0x71, 0x83, 0x69, 0x03, 0x71, 0x69, 0x71, 0x71, 0x82, 0x69, 0x00, 0x71, 0x84,
+    0x69, 0x02, 0x71, 0x69, 0x69, 0x83, 0x71, 0x89, 0x69, 0x88, 0x71, 0x87, 0x69, 0x00, 0x71, 0x8a,
+    0x71, 0x87, 0x69, 0x01, 0x71, 0x71, 0x84, 0x69, 0x86, 0x71, 0x83, 0x69, 0x01, 0x71, 0x71, 0x83,
+    0x69, 0x03, 0x71, 0x69, 0x69, 0x71, 0x8b, 0x69, 0x06, 0x71, 0x69, 0x69, 0x71, 0x71, 0x69, 0x71,
+    0x82, 0x69, 0x00, 0x71, 0x89, 0x69, 0x82, 0x71, 0x8c, 0x69, 0x01, 0x71, 0x71, 0x82, 0x69, 0x01,
+    0x71, 0x71, 0x91, 0x69, 0x00, 0x71, 0x85, 0x69, 0x01, 0x71, 0x71, 0x83, 0x69, 0x82, 0x71, 0x00,
+    0x69, 0x87, 0x71, 0x86, 0x69, 0x01, 0x71, 0x69, 0x83, 0x71, 0x00, 0x69, 0x83, 0x71, 0x02, 0x69,
+    0x71, 0x69, 0x86, 0x71, 0x91, 0x69, 0x88, 0x71, 0x86, 0x69, 0x02, 0x71, 0x69, 0x62, 0x8c, 0x55,
+    0x03, 0x5a, 0x69, 0x71, 0x71, 0x9a, 0x69, 0x00, 0x71, 0x00, 0x69, 0x83, 0x71, 0x82, 0x69, 0x00,
+    0x71, 0x84, 0x69, 0x03, 0x71, 0x71, 0x69, 0x71, 0x85, 0x69, 0x82, 0x71, 0x86, 0x69, 0x00, 0x71,
+    0x83, 0x69, 0x02, 0x71, 0x71, 0x69, 0x82, 0x71, 0x89, 0x69, 0x02, 0x71, 0x71, 0x69, 0x83, 0x71,
+    0x84, 0x69, 0x00, 0x71, 0x88, 0x69, 0x05, 0x71, 0x69, 0x69, 0x71, 0x69, 0x36, 0x8c, 0x04, 0x02,
+    0x16, 0x68, 0x71, 0x84, 0x69, 0x85, 0x71, 0x84, 0x69, 0x82, 0x71, 0x89, 0x69, 0x00, 0x69, 0x82,
+    0x71, 0x03, 0x69, 0x71, 0x69, 0x69, 0x86, 0x71, 0x05, 0x69, 0x71, 0x71, 0x69, 0x69, 0x71, 0x82,
+    0x69, 0x02, 0x71, 0x69, 0x69, 0x83, 0x71, 0x00, 0x69, 0x84, 0x71, 0x83, 0x69, 0x84, 0x71, 0x88,
+    0x69, 0x05, 0x71, 0x71, 0x69, 0x71, 0x71, 0x69, 0x82, 0x71, 0x89, 0x69, 0x02, 0x71, 0x69, 0x68,
+    0x84, 0x54, 0x00, 0x1b, 0x8c, 0x04, 0x06, 0x09, 0x4d, 0x54, 0x54, 0x5a, 0x69, 0x69, 0x85, 0x71,
+    0x85, 0x69, 0x01, 0x71, 0x69, 0x8a, 0x55, 0x84, 0x69, 0x00, 0x71, 0x82, 0x69, 0x82, 0x71, 0x83,
+    0x69, 0x01, 0x71, 0x69, 0x83, 0x71, 0x00, 0x69, 0x82, 0x71, 0x00, 0x69, 0x82, 0x71, 0x02, 0x69,
+    0x69, 0x71, 0x82, 0x69, 0x01, 0x71, 0x69, 0x85, 0x71, 0x01, 0x69, 0x71, 0x88, 0x69, 0x01, 0x71,
+    0x69, 0x83, 0x71, 0x8b, 0x69, 0x82, 0x71, 0x03, 0x5a, 0x04, 0x04, 0x08, 0x93, 0x04, 0x02, 0x44,
+    0x69, 0x69, 0x85, 0x71, 0x87, 0x69, 0x01, 0x26, 0x25, 0x88, 0x1e, 0x01, 0x69, 0x63, 0x8d, 0x43,
+    0x0c, 0x55, 0x69, 0x69, 0x71, 0x69, 0x71, 0x69, 0x71, 0x71, 0x69, 0x69, 0x71, 0x69, 0x82, 0x71,
+    0x01, 0x69, 0x69, 0x82, 0x71, 0x03, 0x69, 0x55, 0x3e, 0x46, 0x89, 0x3e, 0x03, 0x63, 0x69, 0x71,
+    0x71, 0x88, 0x69, 0x82, 0x71, 0x02, 0x69, 0x69, 0x55, 0x85, 0x43, 0x00, 0x36, 0x96, 0x04, 0x00,
+    0x1b, 0x82, 0x43, 0x01, 0x62, 0x69, 0x83, 0x71, 0x82, 0x69, 0x00, 0x55, 0x82, 0x3e, 0x00, 0x26,
+    0x89, 0x1e, 0x01, 0x71, 0x62, 0x8d, 0x04, 0x00, 0x4d, 0x85, 0x69, 0x83, 0x71, 0x83, 0x69, 0x00,
+    0x71, 0x85, 0x69, 0x00, 0x3e, 0x8a, 0x1e, 0x01, 0x1f, 0x62, 0x84, 0x69, 0x00, 0x71, 0x8a, 0x69,
+    0x00, 0x4d, 0xa1, 0x04, 0x00, 0x5a, 0x87, 0x69, 0x01, 0x3e, 0x1f, 0x8c, 0x1e, 0x02, 0x24, 0x24,
+    0x08, 0x8c, 0x04, 0x00, 0x1b, 0x83, 0x24, 0x01, 0x36, 0x68, 0x84, 0x69, 0x05, 0x71, 0x69, 0x69,
+    0x71, 0x68, 0x46, 0x83, 0x44, 0x00, 0x27, 0x8b, 0x1e, 0x03, 0x31, 0x46, 0x44, 0x46, 0x85, 0x69,
+    0x82, 0x71, 0x84, 0x24, 0x00, 0x1b, 0xa1, 0x04, 0x02, 0x24, 0x24, 0x31, 0x85, 0x44, 0x00, 0x27,
+    0x8d, 0x1e, 0x94, 0x04, 0x01, 0x16, 0x63, 0x88, 0x69, 0x01, 0x63, 0x26, 0x91, 0x1e, 0x02, 0x25,
+    0x25, 0x31, 0x87, 0x69, 0x00, 0x68, 0xa6, 0x04, 0x02, 0x05, 0x05, 0x09, 0x95, 0x1e, 0x95, 0x04,
+    0x82, 0x16, 0x00, 0x1d, 0x82, 0x26, 0x83, 0x30, 0x00, 0x1f, 0x93, 0x1e, 0x00, 0x1f, 0x82, 0x27,
+    0x05, 0x30, 0x27, 0x5a, 0x69, 0x36, 0x16, 0xa5, 0x04, 0x00, 0x17, 0x98, 0x1e, 0x95, 0x04, 0x82,
+    0x09, 0x00, 0x11, 0xa1, 0x1e, 0x03, 0x55, 0x63, 0x24, 0x09, 0x9e, 0x04, 0x86, 0x09, 0x02, 0x18,
+    0x25, 0x25, 0x96, 0x1e, 0x94, 0x04, 0x00, 0x05, 0xa5, 0x1e, 0x03, 0x1f, 0x1f, 0x1e, 0x1e, 0x9d,
+    0x04, 0x02, 0x05, 0x1d, 0x1e, 0x88, 0x1f, 0x95, 0x1e, 0x8f, 0x04, 0x00, 0x09, 0x84, 0x10, 0xa9,
+    0x1e, 0x84, 0x10, 0x00, 0x09, 0x96, 0x04, 0x01, 0x10, 0x10, 0xa0, 0x1e, 0x8f, 0x04, 0x00, 0x17,
+    0xb3, 0x1e, 0x00, 0x17, 0x96, 0x04, 0x00, 0x1d, 0xa1, 0x1e, 0x8d, 0x04, 0x02, 0x09, 0x11, 0x1d,
+    0xb1, 0x1e, 0x06, 0x1f, 0x1f, 0x1d, 0x17, 0x17, 0x11, 0x05, 0x8c, 0x04, 0x07, 0x09, 0x17, 0x17,
+    0x11, 0x17, 0x17, 0x1d, 0x1e, 0x82, 0x25, 0x01, 0x1e, 0x1f, 0x9b, 0x1e, 0x8d, 0x04, 0x00, 0x11,
+    0xb9, 0x1e, 0x00, 0x09, 0x8c, 0x04, 0x00, 0x10, 0xa7, 0x1e, 0x8d, 0x18, 0x00, 0x1d, 0xb9, 0x1e,
+    0x8d, 0x18, 0x00, 0x1d, 0xa7, 0x1e, 0xc9, 0x1e, 0x00, 0x25, 0xb4, 0x1e, 0xff, 0x1e, 0xff, 0x1e,
+    0xff, 0x1e, 0xad, 0x37, 0xd1, 0x1e, 0x82, 0x81, 0xa9, 0x8b, 0x00, 0x6a, 0xd1, 0x1e, 0x83, 0x81,
+    0xa2, 0x8b, 0x00, 0x82, 0x84, 0x8b, 0x00, 0x7b, 0x96, 0x4e, 0x00, 0x38, 0xaf, 0x1e, 0x00, 0x26,
+    0x88, 0x4e, 0x02, 0x8b, 0x8b, 0x81, 0x84, 0x8b, 0x00, 0x81, 0xae, 0x8b, 0x00, 0x81, 0x8b, 0x8b,
+    0x01, 0x5b, 0x1f, 0x87, 0x1e, 0x00, 0x1f, 0x86, 0x1e, 0x00, 0x1f, 0x83, 0x1e, 0x00, 0x1f, 0x98,
+    0x1e, 0x00, 0x37, 0x88, 0x8b, 0x01, 0x8b, 0x82, 0x86, 0x8b, 0x00, 0x81, 0x9a, 0x8b, 0x00, 0x81,
+    0x90, 0x8b, 0x00, 0x81, 0x8c, 0x8b, 0x00, 0x73, 0xb0, 0x5b, 0x00, 0x81, 0x83, 0x8b, 0x00, 0x81,
+    0x82, 0x8b, 0x02, 0x8b, 0x8b, 0x81, 0xa9, 0x8b, 0x00, 0x81, 0x82, 0x8b, 0x00, 0x81, 0x8d, 0x8b,
+    0x00, 0x82, 0x84, 0x8b, 0x96, 0x81, 0x8f, 0x8b, 0x00, 0x82, 0x91, 0x8b, 0x86, 0x8b, 0x00, 0x82,
+    0x89, 0x8b, 0x00, 0x82, 0x84, 0x8b, 0x00, 0x81, 0x82, 0x8b, 0x00, 0x82, 0x85, 0x8b, 0x00, 0x82,
+    0xb6, 0x8b, 0x00, 0x82, 0xa3, 0x8b, 0x92, 0x8b, 0x00, 0x82, 0x87, 0x8b, 0x00, 0x82, 0x89, 0x8b,
+    0x00, 0x81, 0xb4, 0x8b, 0x00, 0x82, 0x95, 0x8b, 0x00, 0x82, 0x8a, 0x8b, 0x94, 0x8b, 0x00, 0x81,
+    0x86, 0x8b, 0x00, 0x82, 0x82, 0x8b, 0x00, 0x82, 0xc2, 0x8b, 0x00, 0x81, 0x85, 0x8b, 0x00, 0x81,
+    0x92, 0x8b, 0x85, 0x8b, 0x00, 0x82, 0x8a, 0x8b, 0x00, 0x82, 0xcc, 0x8b, 0x00, 0x82, 0x9e, 0x8b,
+};
+
+// 171 colors, 10335 bytes (raw: 32768)
+static constexpr uint16_t cat_pal_1[] = {
+    0x0000, 0x0861, 0x0881, 0x09a1, 0x09c1, 0x10a2, 0x10e2, 0x11a1, 0x11e2, 0x18e3, 0x1921, 0x1924,
+    0x1941, 0x1943, 0x19c3, 0x1a23, 0x1a43, 0x2124, 0x2144, 0x2163, 0x2224, 0x2264, 0x22c5, 0x2983,
+    0x29e3, 0x2a43, 0x2a66, 0x2a83, 0x2aa4, 0x2ae5, 0x3166, 0x3186, 0x31a4, 0x31e4, 0x31e5, 0x32a4,
+    0x32a6, 0x32e5, 0x3305, 0x3346, 0x34a6, 0x34c6, 0x39c7, 0x39e4, 0x3a24, 0x3a26, 0x3a45, 0x3b06,
+    0x3b67, 0x3ba7, 0x4208, 0x4266, 0x42a6, 0x42e5, 0x4364, 0x43a5, 0x43a8, 0x43c8, 0x4407, 0x4a69,
+    0x4ba7, 0x4be8, 0x5106, 0x5126, 0x528a, 0x52e6, 0x5306, 0x5308, 0x5367, 0x5389, 0x53e7, 0x5427,
+    0x5428, 0x5ac8, 0x5aeb, 0x5b47, 0x5b87, 0x5bc7, 0x5c24, 0x5c27, 0x5c28, 0x60e6, 0x61c8, 0x632c,
+    0x6348, 0x63a9, 0x63e8, 0x6429, 0x6b4d, 0x6be9, 0x6c4a, 0x6c6a, 0x6c83, 0x6ca2, 0x71a9, 0x738e,
+    0x73aa, 0x742a, 0x742b, 0x748a, 0x74a2, 0x74aa, 0x7866, 0x7948, 0x7b4d, 0x7b8e, 0x7beb, 0x7bef,
+    0x7c0f, 0x7c6b, 0x7c8a, 0x7ce4, 0x80c7, 0x848b, 0x84ca, 0x84cb, 0x84ea, 0x84eb, 0x8826, 0x8847,
+    0x8c31, 0x8c8a, 0x8ccb, 0x8d0b, 0x8da3, 0x92ac, 0x946d, 0x9492, 0x94b2, 0x952c, 0x95c1, 0x9b8f,
+    0x9cb3, 0x9cd3, 0x9ced, 0x9d2c, 0x9d4c, 0x9dc1, 0x9de1, 0xa3f1, 0xa50e, 0xa534, 0xa56d, 0xa58e,
+    0xac92, 0xad2e, 0xad6e, 0xad75, 0xadae, 0xb5b6, 0xb5ef, 0xbdd7, 0xbdf0, 0xbe10, 0xc4d3, 0xc618,
+    0xc631, 0xc672, 0xc6b3, 0xccb3, 0xce39, 0xce59, 0xceb2, 0xcef3, 0xd735, 0xd755, 0xdcd3, 0xdedb,
+    0xef5d, 0xfcb2, 0xffff,
+};
+static constexpr uint16_t cat_row_1[] = {
+    0, 40, 144, 250, 328, 419, 518, 614, 716, 816, 917, 1029, 1140, 1243, 1320, 1404,
+    1485, 1598, 1687, 1769, 1876, 1963, 2047, 2132, 2206, 2279, 2380, 2477, 2591, 2681, 2760, 2833,
+    2933, 3013, 3112, 3200, 3297, 3396, 3507, 3609, 3684, 3781, 3879, 3963, 4056, 4147, 4199, 4287,
+    4348, 4404, 4461, 4529, 4599, 4670, 4762, 4862, 4962, 5057, 5144, 5229, 5304, 5385, 5460, 5545,
+    5638, 5709, 5798, 5886, 5967, 6045, 6131, 6214, 6295, 6366, 6458, 6546, 6611, 6668, 6719, 6806,
+    6893, 6992, 7096, 7197, 7281, 7380, 7471, 7584, 7684, 7791, 7898, 7993, 8103, 8192, 8282, 8370,
+    8473, 8586, 8669, 8749, 8835, 8931, 9015, 9096, 9164, 9221, 9272, 9303, 9333, 9356, 9378, 9398,
+    9424, 9444, 9463, 9469, 9471, 9473, 9475, 9485, 9500, 9548, 9598, 9630, 9669, 9682, 9688, 9710,
+};
+static constexpr uint8_t cat_code_1[] = {
+    0xb7, 0x74, 0x09, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x84, 0x74, 0x00,
+    0x72, 0xa1, 0x74, 0x00, 0x72, 0x83, 0x74, 0x00, 0x72, 0x83, 0x74, 0x0b, 0x72, 0x74, 0x72, 0x74,
+    0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x74, 0x86, 0x72, 0x08, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x0e, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x74,
+    0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x82, 0x74, 0x02, 0x72, 0x74, 0x74, 0x82, 0x72,
+    0x01, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x85, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74, 0x89, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x72,
+    0x07, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x84, 0x74, 0x05, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x85, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x0b, 0x74,
+    0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x82, 0x74, 0x82, 0x72, 0x83,
+    0x74, 0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x74, 0x72, 0x72, 0x82,
+    0x74, 0x02, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x87, 0x72, 0x02, 0x74, 0x72, 0x74, 0x86,
+    0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x83, 0x74, 0x06, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x01, 0x74, 0x72, 0x82, 0x74, 0x02,
+    0x72, 0x72, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x87, 0x72,
+    0x07, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x90,
+    0x72, 0x00, 0x74, 0x87, 0x72, 0x00, 0x74, 0x91, 0x72, 0x00, 0x74, 0x88, 0x72, 0x09, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x74, 0x05, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x83, 0x74, 0x82, 0x72, 0x01, 0x74, 0x72, 0x82, 0x74, 0x85, 0x72, 0x01, 0x74, 0x74, 0x82,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x86, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x88, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x84, 0x72,
+    0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x8c, 0x72, 0x03, 0x74, 0x72, 0x72,
+    0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x1f, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x0b, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x8a, 0x72, 0x02, 0x74, 0x72, 0x74, 0x85, 0x72,
+    0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x87, 0x72, 0x84,
+    0x74, 0x87, 0x72, 0x01, 0x74, 0x72, 0x05, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00,
+    0x74, 0x82, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x82,
+    0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x12, 0x74, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x82,
+    0x74, 0x84, 0x72, 0x00, 0x74, 0x93, 0x72, 0x06, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x84, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x0b, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x74, 0x87, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72,
+    0x03, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x10, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x84, 0x72, 0x82, 0x74, 0x86, 0x72, 0x0c,
+    0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0x05,
+    0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x05,
+    0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74, 0x89, 0x72, 0x00, 0x74, 0x01, 0x74, 0x74, 0x82,
+    0x72, 0x0b, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x82, 0x74,
+    0x87, 0x72, 0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x83, 0x74, 0x06, 0x72, 0x74, 0x72,
+    0x74, 0x74, 0x72, 0x74, 0x83, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72,
+    0x02, 0x74, 0x72, 0x74, 0x84, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x85, 0x72, 0x01, 0x74,
+    0x74, 0x89, 0x72, 0x00, 0x74, 0x83, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72, 0x02, 0x74, 0x72, 0x72,
+    0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x87, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x01, 0x74, 0x72, 0x83, 0x74, 0x01, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x87, 0x72,
+    0x02, 0x74, 0x74, 0x72, 0x84, 0x74, 0x03, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72,
+    0x74, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72, 0x03, 0x74, 0x74, 0x72, 0x72, 0x82, 0x74, 0x88,
+    0x72, 0x08, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x09, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x74, 0x74, 0x72, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x82, 0x74, 0x82, 0x72,
+    0x0a, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x04, 0x74,
+    0x74, 0x72, 0x74, 0x74, 0x87, 0x72, 0x00, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x14,
+    0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x08, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x82, 0x72, 0x0c, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x86, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x06, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x82, 0x72, 0x01, 0x74, 0x74, 0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72,
+    0x72, 0x74, 0x82, 0x72, 0x82, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72,
+    0x02, 0x74, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x83, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74,
+    0x82, 0x72, 0x01, 0x74, 0x74, 0x85, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x00,
+    0x74, 0x84, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x0e, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x01, 0x74, 0x72, 0x83, 0x74, 0x05, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x83, 0x74, 0x89,
+    0x72, 0x05, 0x74, 0x6e, 0x61, 0x5a, 0x61, 0x5a, 0x82, 0x61, 0x0b, 0x72, 0x72, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x83, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x84,
+    0x72, 0x0c, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x85,
+    0x72, 0x02, 0x74, 0x72, 0x72, 0x82, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72,
+    0x74, 0x84, 0x72, 0x02, 0x74, 0x72, 0x74, 0x86, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x05, 0x74,
+    0x72, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x01, 0x74, 0x74, 0x86, 0x72,
+    0x10, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x4c, 0x85, 0x11, 0x01, 0x22, 0x73, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x8a, 0x72, 0x00,
+    0x74, 0x8a, 0x72, 0x06, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82,
+    0x72, 0x00, 0x74, 0x88, 0x72, 0x03, 0x74, 0x74, 0x72, 0x72, 0x82, 0x74, 0x00, 0x72, 0x82, 0x74,
+    0x94, 0x72, 0x00, 0x74, 0x86, 0x72, 0x00, 0x74, 0x01, 0x74, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72,
+    0x72, 0x74, 0x84, 0x72, 0x00, 0x74, 0x85, 0x72, 0x04, 0x74, 0x72, 0x6e, 0x56, 0x4b, 0x85, 0x42,
+    0x03, 0x43, 0x56, 0x59, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x88, 0x72, 0x00,
+    0x74, 0x85, 0x72, 0x08, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x87, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x87, 0x72, 0x03, 0x74, 0x72,
+    0x74, 0x74, 0x85, 0x72, 0x00, 0x74, 0x8e, 0x72, 0x00, 0x74, 0x84, 0x72, 0x03, 0x74, 0x74, 0x72,
+    0x74, 0x8c, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x02, 0x61, 0x0d, 0x42, 0x82, 0x74, 0x82,
+    0x72, 0x09, 0x6e, 0x17, 0x34, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x8a, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x01, 0x74, 0x74, 0x86, 0x72, 0x00, 0x74, 0x84, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72,
+    0x74, 0x84, 0x72, 0x0c, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x74, 0x86, 0x72, 0x00, 0x74, 0x90, 0x72, 0x82, 0x74, 0x83, 0x72, 0x00, 0x74, 0x08, 0x72, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x83, 0x74, 0x03, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72,
+    0x10, 0x74, 0x72, 0x4b, 0x4b, 0x55, 0x57, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x6e, 0x55, 0x4c,
+    0x4b, 0x59, 0x82, 0x72, 0x0f, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x74, 0x74, 0x86, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x84, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x04,
+    0x74, 0x74, 0x72, 0x72, 0x74, 0x86, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x08, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72,
+    0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83, 0x72, 0x09, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x6e, 0x12, 0x33, 0x85, 0x72, 0x09, 0x74, 0x74, 0x72, 0x72, 0x57, 0x12, 0x4b, 0x74, 0x72, 0x74,
+    0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x85, 0x72, 0x0d, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x01,
+    0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x82, 0x74, 0x91, 0x72, 0x00, 0x74, 0x83, 0x72,
+    0x03, 0x74, 0x72, 0x72, 0x74, 0x8b, 0x72, 0x82, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x8b,
+    0x72, 0x10, 0x63, 0x12, 0x33, 0x72, 0x59, 0x34, 0x57, 0x72, 0x72, 0x74, 0x42, 0x41, 0x72, 0x57,
+    0x12, 0x4b, 0x74, 0x85, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x07, 0x74, 0x72, 0x72, 0x74,
+    0x74, 0x72, 0x72, 0x74, 0x8b, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x86, 0x72, 0x82, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x82, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x87, 0x72, 0x00,
+    0x74, 0x84, 0x72, 0x83, 0x74, 0x85, 0x72, 0x00, 0x74, 0x05, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x13, 0x74, 0x72, 0x74, 0x72, 0x6e,
+    0x12, 0x33, 0x72, 0x55, 0x11, 0x55, 0x72, 0x73, 0x73, 0x21, 0x22, 0x73, 0x57, 0x12, 0x4b, 0x82,
+    0x72, 0x00, 0x74, 0x87, 0x72, 0x07, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72,
+    0x82, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x03,
+    0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x86, 0x72,
+    0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x85, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x01, 0x74, 0x72, 0x02, 0x72, 0x74, 0x72, 0x85, 0x74, 0x01, 0x72, 0x74, 0x83, 0x72, 0x00,
+    0x74, 0x84, 0x72, 0x10, 0x6e, 0x12, 0x33, 0x72, 0x6e, 0x6e, 0x4b, 0x2b, 0x22, 0x2c, 0x61, 0x63,
+    0x74, 0x57, 0x12, 0x4b, 0x74, 0x83, 0x72, 0x82, 0x74, 0x04, 0x72, 0x74, 0x72, 0x72, 0x74, 0x84,
+    0x72, 0x03, 0x74, 0x72, 0x74, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x86, 0x72, 0x01, 0x74,
+    0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x86, 0x72, 0x01, 0x74, 0x72, 0x83, 0x74, 0x85, 0x72, 0x00,
+    0x74, 0x8a, 0x72, 0x00, 0x74, 0x87, 0x72, 0x00, 0x74, 0x86, 0x72, 0x83, 0x74, 0x83, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x85, 0x72, 0x1a, 0x6e, 0x6e, 0x63, 0x6e, 0x61, 0x12, 0x33, 0x6e, 0x63, 0x6e,
+    0x42, 0x12, 0x12, 0x17, 0x61, 0x6e, 0x6e, 0x56, 0x12, 0x42, 0x63, 0x63, 0x6e, 0x6e, 0x63, 0x72,
+    0x74, 0x87, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x8e, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00,
+    0x74, 0x8b, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x00,
+    0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00,
+    0x74, 0x88, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x4b, 0x83, 0x12, 0x00, 0x13, 0x90, 0x12, 0x07,
+    0x13, 0x13, 0x17, 0x6e, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74, 0x74, 0x84, 0x72, 0x01,
+    0x74, 0x74, 0x82, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x85, 0x72, 0x08, 0x74, 0x72,
+    0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x86, 0x72, 0x02, 0x74, 0x72, 0x74, 0x85, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x89,
+    0x72, 0x01, 0x74, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x05, 0x74,
+    0x74, 0x72, 0x6e, 0x61, 0x55, 0x98, 0x49, 0x01, 0x57, 0x61, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74,
+    0x85, 0x72, 0x00, 0x74, 0x83, 0x72, 0x82, 0x74, 0x08, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x8c, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x86, 0x72, 0x01, 0x74, 0x74, 0x82,
+    0x72, 0x00, 0x74, 0x8b, 0x72, 0x01, 0x74, 0x74, 0x85, 0x72, 0x02, 0x74, 0x72, 0x72, 0x83, 0x74,
+    0x01, 0x72, 0x74, 0x85, 0x72, 0x04, 0x74, 0x72, 0x56, 0x0d, 0x79, 0x98, 0x98, 0x01, 0x2d, 0x2c,
+    0x89, 0x72, 0x84, 0x74, 0x05, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84,
+    0x72, 0x83, 0x74, 0x84, 0x72, 0x12, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x82, 0x74, 0x84, 0x72, 0x02, 0x74, 0x72,
+    0x74, 0x8a, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x8a, 0x72, 0x06, 0x6e, 0x55, 0x59, 0x71,
+    0x8e, 0x98, 0x86, 0x82, 0x7e, 0x05, 0x98, 0x98, 0x9d, 0x9c, 0x98, 0x8c, 0x82, 0x7e, 0x05, 0x96,
+    0x98, 0x9d, 0x9d, 0x98, 0x92, 0x82, 0x7e, 0x05, 0x94, 0x98, 0x71, 0x6d, 0x55, 0x59, 0x86, 0x72,
+    0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x0e, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x84, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x86, 0x72, 0x00,
+    0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x74, 0x74, 0x89, 0x72, 0x08, 0x75, 0x88, 0x7b, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x02, 0x74, 0x72, 0x74,
+    0x83, 0x72, 0x83, 0x74, 0x10, 0x72, 0x61, 0x11, 0x71, 0xa4, 0x9e, 0x98, 0x54, 0x12, 0x12, 0x2d,
+    0x98, 0x9c, 0xa5, 0xa2, 0x98, 0x6a, 0x82, 0x12, 0x05, 0x94, 0x98, 0xa4, 0xa3, 0x98, 0x7e, 0x82,
+    0x11, 0x05, 0x91, 0x98, 0xa4, 0x9e, 0x11, 0x34, 0x84, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74,
+    0x83, 0x72, 0x00, 0x74, 0x8d, 0x72, 0x00, 0x74, 0x84, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x83,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x08, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x81, 0x98, 0x92, 0x74, 0x86, 0x72, 0x00, 0x74, 0x86, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x29, 0x74, 0x6e, 0x55, 0x62, 0x7a, 0x92, 0x98, 0x86,
+    0x7e, 0x7e, 0x86, 0x98, 0x98, 0x9d, 0x9c, 0x98, 0x8c, 0x7e, 0x7a, 0x7e, 0x96, 0x98, 0x9d, 0x9d,
+    0x98, 0x92, 0x7a, 0x7a, 0x7e, 0x96, 0x98, 0x86, 0x71, 0x56, 0x57, 0x72, 0x74, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x85, 0x72, 0x09, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x84,
+    0x72, 0x82, 0x74, 0x04, 0x72, 0x72, 0x74, 0x72, 0x74, 0x84, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74,
+    0x87, 0x72, 0x13, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x8e, 0x8e, 0x72, 0x7b, 0x8e, 0x7b,
+    0x72, 0x87, 0x92, 0x7b, 0x72, 0x72, 0x74, 0x83, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x10,
+    0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x56, 0x11,
+    0x7e, 0x97, 0x98, 0x02, 0x96, 0x2d, 0x2c, 0x84, 0x72, 0x00, 0x74, 0x87, 0x72, 0x08, 0x74, 0x72,
+    0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72,
+    0x02, 0x74, 0x72, 0x74, 0x85, 0x72, 0x06, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72,
+    0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x01, 0x98, 0x96, 0x84, 0x72, 0x03, 0x92, 0x98, 0x7b, 0x74,
+    0x84, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72,
+    0x01, 0x74, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x63, 0x57, 0x55, 0x98, 0x54, 0x01, 0x59, 0x61,
+    0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x87, 0x72, 0x00, 0x74, 0x84,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x8b, 0x72, 0x00, 0x74, 0x85,
+    0x72, 0x01, 0x74, 0x74, 0x85, 0x72, 0x01, 0x81, 0x81, 0x84, 0x72, 0x01, 0x7b, 0x81, 0x84, 0x72,
+    0x00, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x74, 0x89, 0x72, 0x03, 0x74, 0x74, 0x4b,
+    0x17, 0x96, 0x12, 0x03, 0x17, 0x6e, 0x72, 0x74, 0x86, 0x72, 0x02, 0x74, 0x72, 0x74, 0x8d, 0x72,
+    0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72, 0x0f, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74, 0x84, 0x72, 0x06, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x02, 0x74, 0x74, 0x75, 0x84, 0x72, 0x82, 0x74, 0x82,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72,
+    0x01, 0x65, 0x63, 0x85, 0x6e, 0x83, 0x63, 0x86, 0x6e, 0x83, 0x63, 0x82, 0x6e, 0x01, 0x74, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72, 0x03, 0x74,
+    0x74, 0x72, 0x74, 0x82, 0x72, 0x0c, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x13, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x94, 0x96, 0x75, 0x72, 0x72, 0x74, 0x84, 0x72,
+    0x01, 0x94, 0x96, 0x8a, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x82,
+    0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x72,
+    0x82, 0x74, 0x88, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x85, 0x72, 0x00,
+    0x74, 0x87, 0x72, 0x00, 0x74, 0x88, 0x72, 0x00, 0x74, 0x8d, 0x72, 0x00, 0x74, 0x88, 0x72, 0x06,
+    0x74, 0x72, 0x72, 0x94, 0x96, 0x75, 0x74, 0x83, 0x72, 0x82, 0x74, 0x02, 0x94, 0x96, 0x75, 0x85,
+    0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74,
+    0x83, 0x72, 0x82, 0x74, 0x85, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74,
+    0x83, 0x72, 0x08, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x86, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x0a, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x87, 0x72,
+    0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x02, 0x74, 0x74, 0x72, 0x82,
+    0x74, 0x06, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x82, 0x74, 0x84, 0x72, 0x83, 0x74, 0x84,
+    0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x83, 0x72, 0x08, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x07, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x09, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x8e, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72,
+    0x00, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x89, 0x72, 0x00, 0x74,
+    0x8a, 0x72, 0x01, 0x81, 0x81, 0x83, 0x72, 0x02, 0x74, 0x7b, 0x81, 0x8a, 0x72, 0x01, 0x74, 0x72,
+    0x05, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x86, 0x72, 0x00, 0x74, 0x8b, 0x72, 0x03, 0x74, 0x74,
+    0x72, 0x72, 0x82, 0x74, 0x08, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72,
+    0x0a, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x86, 0x72, 0x04, 0x74,
+    0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x82, 0x74, 0x0c,
+    0x72, 0x72, 0x96, 0x96, 0x72, 0x72, 0x74, 0x74, 0x72, 0x92, 0x98, 0x7b, 0x74, 0x89, 0x72, 0x00,
+    0x74, 0x07, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74,
+    0x88, 0x72, 0x01, 0x74, 0x74, 0x86, 0x72, 0x11, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x05, 0x74, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x89, 0x72, 0x00, 0x74, 0x87, 0x72, 0x00, 0x74, 0x87, 0x72, 0x03, 0x74, 0x72,
+    0x72, 0x74, 0x82, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x0c, 0x74, 0x72,
+    0x8f, 0x8e, 0x72, 0x7b, 0x88, 0x7b, 0x72, 0x87, 0x8f, 0x7b, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72,
+    0x74, 0x74, 0x82, 0x72, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x85, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x86,
+    0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72,
+    0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x82, 0x72, 0x10, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x74, 0x84, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x82, 0x74,
+    0x0b, 0x81, 0x98, 0x92, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x02,
+    0x74, 0x72, 0x72, 0x10, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x82, 0x74, 0x04, 0x72, 0x72, 0x74, 0x72, 0x74, 0x86,
+    0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x88, 0x72, 0x00, 0x74, 0x85, 0x72, 0x01, 0x74, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x84, 0x72, 0x02, 0x74, 0x72, 0x74,
+    0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x7b, 0x88, 0x7b, 0x82, 0x72, 0x09, 0x74, 0x72, 0x74,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x07, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72,
+    0x74, 0x74, 0x83, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83, 0x72,
+    0x03, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x86, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00,
+    0x74, 0x9a, 0x72, 0x00, 0x74, 0x89, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x82,
+    0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74, 0x74, 0x85, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74,
+    0x86, 0x72, 0x00, 0x74, 0x03, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83,
+    0x72, 0x83, 0x74, 0x02, 0x72, 0x72, 0x74, 0x85, 0x72, 0x00, 0x74, 0x86, 0x72, 0x03, 0x74, 0x72,
+    0x72, 0x74, 0x82, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84,
+    0x72, 0x01, 0x74, 0x74, 0x8a, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x01,
+    0x74, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x86, 0x72, 0x04, 0x74,
+    0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83, 0x72, 0x05, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x05, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x04, 0x74,
+    0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x09, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x74, 0x8a, 0x72, 0x0a, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x84,
+    0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x89, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82,
+    0x72, 0x00, 0x74, 0x87, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72,
+    0x06, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x88, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x74, 0x85, 0x72, 0x02, 0x74, 0x72, 0x72, 0x01, 0x72, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72,
+    0x74, 0x85, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x87, 0x72,
+    0x00, 0x74, 0x87, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72,
+    0x00, 0x74, 0x85, 0x72, 0x00, 0x74, 0x88, 0x72, 0x82, 0x74, 0x04, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x84, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x86, 0x72,
+    0x00, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x8f, 0x72, 0x82, 0x74, 0x0b, 0x72, 0x74,
+    0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x86, 0x72, 0x82, 0x74, 0x86, 0x72,
+    0x00, 0x74, 0x86, 0x72, 0x00, 0x74, 0x88, 0x72, 0x00, 0x74, 0x82, 0x72, 0x07, 0x74, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x08, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72,
+    0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x09, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x8b, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x03, 0x72, 0x74, 0x72, 0x74, 0x88, 0x72, 0x03,
+    0x74, 0x74, 0x72, 0x74, 0x87, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x88, 0x72, 0x0d, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x86, 0x74, 0x01, 0x72,
+    0x72, 0x82, 0x74, 0x06, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x82, 0x74, 0x00, 0x72, 0x84,
+    0x74, 0x05, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x8b, 0x72, 0x05, 0x74, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00,
+    0x74, 0x87, 0x72, 0x8c, 0x65, 0x82, 0x72, 0x83, 0x74, 0x02, 0x72, 0x72, 0x74, 0x83, 0x72, 0x00,
+    0x74, 0x8d, 0x65, 0x84, 0x74, 0x02, 0x72, 0x72, 0x61, 0x9d, 0x59, 0x02, 0x63, 0x72, 0x74, 0x85,
+    0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00,
+    0x74, 0x83, 0x72, 0x00, 0x74, 0x91, 0x72, 0x07, 0x5b, 0x5a, 0x5b, 0x5a, 0x5b, 0x5a, 0x5a, 0x5b,
+    0x82, 0x5a, 0x0b, 0x5b, 0x5b, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x83,
+    0x74, 0x00, 0x63, 0x83, 0x5a, 0x00, 0x5b, 0x85, 0x5a, 0x02, 0x5b, 0x5a, 0x5b, 0x84, 0x72, 0x02,
+    0x74, 0x72, 0x41, 0x9d, 0x00, 0x00, 0x4c, 0x82, 0x72, 0x05, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72,
+    0x82, 0x74, 0x87, 0x72, 0x82, 0x74, 0x0d, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x06, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x00,
+    0x5b, 0x88, 0x5a, 0x02, 0x5b, 0x5a, 0x5b, 0x8d, 0x65, 0x00, 0x5b, 0x8c, 0x5a, 0x01, 0x5b, 0x63,
+    0x83, 0x65, 0x02, 0x57, 0x4c, 0x6c, 0x9d, 0x78, 0x02, 0x5f, 0x4c, 0x63, 0x85, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x88, 0x72, 0x00, 0x74, 0x86,
+    0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x85, 0x5a, 0x03, 0x5b,
+    0x5a, 0x5a, 0x5b, 0x93, 0x5a, 0x0a, 0x5b, 0x5b, 0x5a, 0x5b, 0x5a, 0x5a, 0x5b, 0x5b, 0x5a, 0x5a,
+    0x5b, 0x85, 0x5a, 0x02, 0x42, 0x00, 0x8d, 0x9d, 0xa1, 0x04, 0x78, 0x00, 0x59, 0x72, 0x74, 0x86,
+    0x72, 0x00, 0x74, 0x87, 0x72, 0x00, 0x74, 0x8c, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x85,
+    0x72, 0x01, 0x74, 0x72, 0x01, 0x5a, 0x5b, 0xaa, 0x5a, 0x05, 0x56, 0x24, 0x5f, 0x8d, 0x78, 0x6c,
+    0x8d, 0x78, 0x01, 0x7f, 0xa0, 0x83, 0xa1, 0x00, 0x90, 0x82, 0x8b, 0x00, 0xa0, 0x83, 0xa1, 0x04,
+    0x95, 0x8d, 0x60, 0x42, 0x6e, 0x87, 0x72, 0x82, 0x74, 0x03, 0x72, 0x72, 0x74, 0x74, 0x89, 0x72,
+    0x01, 0x74, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x87, 0x72, 0x00, 0x74, 0x00, 0x5b, 0x91,
+    0x5a, 0x00, 0x5b, 0x88, 0x5a, 0x00, 0x5b, 0x8e, 0x5a, 0x04, 0x45, 0x00, 0x78, 0xa1, 0x6c, 0x82,
+    0x1f, 0x00, 0x1e, 0x8a, 0x1f, 0x00, 0x53, 0x84, 0xa1, 0x04, 0x83, 0x76, 0x76, 0x77, 0xa0, 0x85,
+    0xa1, 0x04, 0x58, 0x00, 0x63, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x88, 0x72, 0x03, 0x74, 0x72,
+    0x74, 0x74, 0x83, 0x72, 0x00, 0x74, 0x8a, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74,
+    0x72, 0x8c, 0x50, 0x00, 0x5b, 0x8c, 0x5a, 0x00, 0x57, 0x8d, 0x50, 0x82, 0x5a, 0x04, 0x45, 0x00,
+    0x78, 0xa1, 0x6c, 0x8e, 0x1f, 0x00, 0x53, 0x84, 0xa1, 0x04, 0x83, 0x76, 0x76, 0x77, 0xa0, 0x85,
+    0xa1, 0x02, 0x58, 0x00, 0x63, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74,
+    0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x89, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x8c, 0x50, 0x8d, 0x5a, 0x04, 0x50, 0x48, 0x50, 0x50,
+    0x48, 0x85, 0x50, 0x00, 0x47, 0x82, 0x50, 0x82, 0x5a, 0x04, 0x45, 0x00, 0x78, 0xa1, 0x6c, 0x82,
+    0x1f, 0x88, 0x22, 0x82, 0x1f, 0x00, 0x53, 0x84, 0xa1, 0x04, 0x83, 0x77, 0x77, 0x7d, 0xa0, 0x85,
+    0xa1, 0x02, 0x58, 0x00, 0x63, 0x84, 0x72, 0x00, 0x74, 0x8b, 0x72, 0x00, 0x74, 0x85, 0x72, 0x07,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x87, 0x50,
+    0x00, 0x47, 0x86, 0x50, 0x00, 0x48, 0x8a, 0x50, 0x07, 0x48, 0x4f, 0x4f, 0x50, 0x47, 0x4f, 0x50,
+    0x4f, 0x84, 0x47, 0x83, 0x50, 0x08, 0x44, 0x00, 0x78, 0xa1, 0x78, 0x1f, 0x1f, 0x22, 0x3a, 0x87,
+    0x28, 0x03, 0x1a, 0x1f, 0x1f, 0x53, 0x84, 0xa1, 0x00, 0xa0, 0x82, 0x9b, 0x86, 0xa1, 0x0d, 0x58,
+    0x00, 0x63, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72, 0x01,
+    0x74, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x07, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x74, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x86, 0x50, 0x00, 0x47, 0x84, 0x50,
+    0x05, 0x47, 0x47, 0x50, 0x47, 0x50, 0x47, 0x83, 0x50, 0x03, 0x47, 0x50, 0x50, 0x47, 0x85, 0x50,
+    0x04, 0x47, 0x47, 0x50, 0x50, 0x47, 0x86, 0x50, 0x07, 0x44, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f,
+    0x22, 0x88, 0x28, 0x03, 0x1a, 0x1f, 0x1f, 0x53, 0x82, 0xa1, 0x00, 0x9b, 0x84, 0x97, 0x86, 0xa1,
+    0x05, 0x58, 0x00, 0x63, 0x72, 0x72, 0x73, 0x82, 0x63, 0x05, 0x6e, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x82, 0x72, 0x05, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74, 0x05, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x74, 0x83, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74, 0x72, 0x04, 0x50,
+    0x47, 0x50, 0x50, 0x47, 0x8b, 0x50, 0x08, 0x48, 0x50, 0x50, 0x48, 0x50, 0x47, 0x50, 0x48, 0x48,
+    0x82, 0x50, 0x17, 0x47, 0x50, 0x47, 0x47, 0x50, 0x50, 0x47, 0x50, 0x50, 0x47, 0x47, 0x50, 0x47,
+    0x47, 0x50, 0x50, 0x44, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x03, 0x1a, 0x1f,
+    0x1f, 0x53, 0x82, 0xa1, 0x00, 0x7f, 0x82, 0x00, 0x03, 0x66, 0x70, 0xa0, 0xa0, 0x84, 0xa1, 0x05,
+    0x58, 0x00, 0x63, 0x74, 0x72, 0x61, 0x82, 0x00, 0x0a, 0x55, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x74, 0x8d, 0x72, 0x00, 0x74, 0x83, 0x72, 0x06, 0x74, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x8c, 0x47, 0x0d, 0x50, 0x50, 0x47, 0x48, 0x50, 0x48, 0x47, 0x47, 0x50, 0x47, 0x50,
+    0x47, 0x47, 0x50, 0x82, 0x3d, 0x01, 0x47, 0x3d, 0x89, 0x47, 0x82, 0x50, 0x07, 0x44, 0x00, 0x78,
+    0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x07, 0x1a, 0x1f, 0x1f, 0x53, 0xa1, 0x9b, 0x93, 0x78,
+    0x82, 0x40, 0x02, 0x51, 0x67, 0xa0, 0x85, 0xa1, 0x05, 0x58, 0x00, 0x63, 0x72, 0x59, 0x55, 0x82,
+    0x40, 0x02, 0x54, 0x57, 0x6e, 0x83, 0x72, 0x82, 0x74, 0x04, 0x72, 0x72, 0x74, 0x72, 0x74, 0x82,
+    0x72, 0x05, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x83, 0x74, 0x01, 0x72, 0x74, 0x83, 0x72, 0x82,
+    0x74, 0x8b, 0x38, 0x05, 0x39, 0x47, 0x48, 0x47, 0x47, 0x48, 0x87, 0x47, 0x01, 0x48, 0x3d, 0x8d,
+    0x38, 0x82, 0x47, 0x07, 0x44, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0d, 0x1a,
+    0x1f, 0x1f, 0x53, 0xa1, 0x8d, 0x00, 0x5f, 0x80, 0x84, 0x80, 0x1f, 0x1f, 0x9b, 0x85, 0xa1, 0x05,
+    0x58, 0x00, 0x6e, 0x6e, 0x06, 0x32, 0x82, 0x84, 0x02, 0x53, 0x00, 0x57, 0x83, 0x72, 0x05, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x00, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72,
+    0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x8c, 0x38, 0x8d, 0x3d, 0x00, 0x39, 0x8d, 0x38,
+    0x82, 0x3d, 0x07, 0x30, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0e, 0x1a, 0x1f,
+    0x1f, 0x53, 0xa1, 0x8d, 0x00, 0x5f, 0x84, 0x80, 0x80, 0x5f, 0x58, 0x7f, 0x85, 0x84, 0xa1, 0x0c,
+    0x58, 0x00, 0x4b, 0x4b, 0x53, 0x5f, 0x80, 0x80, 0x84, 0x53, 0x00, 0x57, 0x74, 0x83, 0x72, 0x05,
+    0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x13, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x9a, 0x38, 0x00,
+    0x39, 0x90, 0x38, 0x07, 0x2f, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x08, 0x1a,
+    0x1f, 0x1f, 0x53, 0xa1, 0x8d, 0x00, 0x58, 0x80, 0x82, 0x84, 0x02, 0x7f, 0x09, 0x40, 0x84, 0xa1,
+    0x0b, 0x58, 0x00, 0x00, 0x12, 0x80, 0x80, 0x84, 0x84, 0x80, 0x53, 0x00, 0x57, 0x82, 0x72, 0x82,
+    0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x82, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x00,
+    0x74, 0x83, 0x72, 0x01, 0x74, 0x72, 0x82, 0x74, 0xa2, 0x38, 0x01, 0x31, 0x26, 0x82, 0x14, 0x01,
+    0x30, 0x31, 0x82, 0x38, 0x07, 0x2f, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0e,
+    0x1a, 0x1f, 0x1f, 0x53, 0xa1, 0x8d, 0x00, 0x5f, 0x84, 0x80, 0x84, 0x80, 0x80, 0x6b, 0x69, 0x84,
+    0x6b, 0x05, 0x2a, 0x00, 0x5f, 0x6b, 0x80, 0x80, 0x82, 0x84, 0x03, 0x53, 0x00, 0x57, 0x74, 0x85,
+    0x72, 0x07, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x09, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x85, 0x72, 0xa3, 0x38, 0x00, 0x24, 0x82, 0x01, 0x00,
+    0x2f, 0x82, 0x38, 0x08, 0x3c, 0x2f, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0e,
+    0x1a, 0x1f, 0x1f, 0x53, 0xa1, 0x8d, 0x00, 0x5f, 0x80, 0x84, 0x84, 0x85, 0x80, 0x80, 0x78, 0x86,
+    0x01, 0x00, 0x7f, 0x84, 0x80, 0x03, 0x84, 0x53, 0x00, 0x57, 0x86, 0x72, 0x00, 0x74, 0x82, 0x72,
+    0x82, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x82, 0x74, 0x8b, 0x26, 0x00, 0x27, 0x8d, 0x38, 0x00, 0x30, 0x82, 0x26, 0x05, 0x27,
+    0x26, 0x26, 0x16, 0x0d, 0x4a, 0x82, 0x78, 0x0c, 0x3b, 0x0d, 0x31, 0x38, 0x38, 0x2f, 0x00, 0x78,
+    0xa1, 0x78, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x08, 0x1a, 0x1f, 0x1f, 0x53, 0xa1, 0x8d, 0x00, 0x5f,
+    0x80, 0x82, 0x84, 0x82, 0x80, 0x86, 0x78, 0x84, 0x80, 0x08, 0x84, 0x84, 0x53, 0x00, 0x57, 0x74,
+    0x72, 0x74, 0x74, 0x83, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72,
+    0x03, 0x74, 0x74, 0x72, 0x74, 0x86, 0x72, 0x00, 0x74, 0x8b, 0x1d, 0x00, 0x26, 0x8d, 0x38, 0x00,
+    0x27, 0x85, 0x26, 0x12, 0x1b, 0x00, 0x53, 0x80, 0x80, 0x84, 0x32, 0x02, 0x30, 0x31, 0x38, 0x2f,
+    0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0c, 0x1a, 0x1f, 0x1f, 0x53, 0xa1, 0x8d,
+    0x00, 0x5f, 0x80, 0x84, 0x80, 0x84, 0x84, 0x82, 0x80, 0x02, 0x84, 0x80, 0x80, 0x82, 0x84, 0x02,
+    0x80, 0x80, 0x84, 0x82, 0x80, 0x03, 0x84, 0x53, 0x00, 0x57, 0x82, 0x74, 0x09, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74, 0x00, 0x72, 0x83, 0x74, 0x82, 0x72, 0x01,
+    0x74, 0x72, 0x86, 0x74, 0x00, 0x72, 0xa0, 0x1d, 0x03, 0x26, 0x1c, 0x00, 0x53, 0x82, 0x84, 0x00,
+    0x32, 0x85, 0x00, 0x05, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x09, 0x1a, 0x1f, 0x1f,
+    0x1e, 0x00, 0x4a, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x86, 0x84, 0x85, 0x80, 0x05, 0x84, 0x80,
+    0x84, 0x32, 0x02, 0x63, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72, 0x82, 0x74, 0x85, 0x72, 0x00, 0x74,
+    0x83, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x9f, 0x1d, 0x08,
+    0x26, 0x26, 0x1c, 0x0a, 0x4a, 0x78, 0x7f, 0x84, 0x4a, 0x83, 0x32, 0x07, 0x1f, 0x00, 0x78, 0xa1,
+    0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0e, 0x1a, 0x1f, 0x1f, 0x1e, 0x00, 0x4a, 0x80, 0x80, 0x84,
+    0x84, 0x80, 0x93, 0x93, 0x78, 0x7f, 0x83, 0x80, 0x20, 0x84, 0x80, 0x80, 0x84, 0x85, 0x93, 0x8d,
+    0x78, 0x7f, 0x80, 0x84, 0x84, 0x32, 0x02, 0x63, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x83, 0x74, 0x82, 0x72, 0x06, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0xa2, 0x1d, 0x11, 0x25, 0x14, 0x01, 0x5f, 0x80, 0x80, 0x84,
+    0x80, 0x84, 0x80, 0x6c, 0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x05, 0x1a, 0x1f,
+    0x1f, 0x1e, 0x00, 0x4a, 0x83, 0x84, 0x2f, 0x85, 0xa8, 0xa8, 0x1f, 0x32, 0x84, 0x84, 0x80, 0x84,
+    0x80, 0x84, 0x80, 0x84, 0x8d, 0xaa, 0xa7, 0x01, 0x4a, 0x80, 0x84, 0x85, 0x32, 0x02, 0x63, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0xa3, 0x1d,
+    0x02, 0x15, 0x07, 0x4a, 0x82, 0x6b, 0x0a, 0x80, 0x80, 0x84, 0x6c, 0x00, 0x78, 0xa1, 0x6c, 0x1f,
+    0x1f, 0x22, 0x88, 0x28, 0x10, 0x1a, 0x1f, 0x1f, 0x1e, 0x00, 0x4a, 0x84, 0x80, 0x84, 0x80, 0x80,
+    0x9b, 0x9b, 0x12, 0x2a, 0x84, 0x84, 0x82, 0x80, 0x0f, 0x78, 0x6b, 0x80, 0x85, 0xa1, 0x95, 0x00,
+    0x4a, 0x84, 0x80, 0x85, 0x3b, 0x02, 0x63, 0x72, 0x74, 0x84, 0x72, 0x82, 0x74, 0x82, 0x72, 0x01,
+    0x74, 0x74, 0x84, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x82, 0x74, 0x82, 0x72, 0x8c,
+    0x1c, 0x8d, 0x1d, 0x00, 0x16, 0x89, 0x1c, 0x0e, 0x0d, 0x00, 0x00, 0x05, 0x7f, 0x80, 0x80, 0x6c,
+    0x00, 0x78, 0xa1, 0x6c, 0x1f, 0x1f, 0x22, 0x88, 0x28, 0x0e, 0x1a, 0x1f, 0x1f, 0x1e, 0x00, 0x4a,
+    0x84, 0x84, 0x80, 0x80, 0x84, 0x1f, 0x00, 0x00, 0x2a, 0x83, 0x80, 0x0e, 0x84, 0x3b, 0x00, 0x7f,
+    0x7f, 0x09, 0x00, 0x00, 0x4a, 0x84, 0x80, 0x85, 0x3b, 0x02, 0x63, 0x83, 0x72, 0x00, 0x74, 0x88,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x87, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x8c, 0x1c, 0x8d,
+    0x16, 0x8a, 0x1c, 0x0e, 0x14, 0x0e, 0x0e, 0x17, 0x53, 0x58, 0x58, 0x4a, 0x00, 0x78, 0xa1, 0x6c,
+    0x1f, 0x1f, 0x22, 0x88, 0x28, 0x17, 0x1a, 0x1f, 0x1f, 0x1e, 0x00, 0x4a, 0x84, 0x9a, 0xa6, 0x9f,
+    0x9f, 0x69, 0x58, 0x58, 0x5f, 0x80, 0x84, 0x84, 0x80, 0x80, 0x6b, 0x58, 0x80, 0x80, 0x82, 0x58,
+    0x00, 0x83, 0x82, 0x9f, 0x05, 0x52, 0x02, 0x63, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x82, 0x74, 0x03, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x07, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x74, 0xa8, 0x1c, 0x01, 0x1a, 0x02, 0x83, 0x00, 0x05, 0x78, 0xa1, 0x6c, 0x1f, 0x1f,
+    0x22, 0x84, 0x28, 0x00, 0x29, 0x82, 0x28, 0x07, 0x1a, 0x1f, 0x1f, 0x1e, 0x00, 0x4a, 0x84, 0x9f,
+    0x82, 0xa9, 0x03, 0x90, 0x80, 0x85, 0x80, 0x83, 0x84, 0x08, 0x80, 0x84, 0x80, 0x80, 0x84, 0x80,
+    0x80, 0x84, 0x9a, 0x82, 0xa9, 0x04, 0x5e, 0x02, 0x63, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74, 0x72,
+    0x82, 0x74, 0x06, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x82, 0x74, 0x04, 0x72,
+    0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0xa9, 0x1c, 0x82, 0x14, 0x04, 0x0e, 0x00, 0x78, 0xa1, 0x6c,
+    0x82, 0x1f, 0x01, 0x25, 0x25, 0x86, 0x1d, 0x07, 0x22, 0x1f, 0x1f, 0x1e, 0x00, 0x4a, 0x80, 0xa6,
+    0x82, 0xa9, 0x10, 0x90, 0x80, 0x4a, 0x53, 0x80, 0x84, 0x80, 0x6b, 0x40, 0x78, 0x84, 0x84, 0x80,
+    0x4a, 0x58, 0x84, 0x9a, 0x82, 0xa9, 0x07, 0x5e, 0x02, 0x63, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82,
+    0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x82, 0x74, 0x82, 0x72, 0x05, 0x74,
+    0x72, 0x74, 0x74, 0x72, 0x72, 0x82, 0x74, 0xac, 0x1c, 0x04, 0x14, 0x00, 0x78, 0xa1, 0x6c, 0x8e,
+    0x1f, 0x04, 0x12, 0x00, 0x4a, 0x85, 0xa6, 0x82, 0xa9, 0x10, 0x90, 0x7f, 0x09, 0x2a, 0x84, 0x80,
+    0x85, 0x53, 0x00, 0x6c, 0x85, 0x84, 0x7f, 0x05, 0x32, 0x80, 0x9a, 0x82, 0xa9, 0x05, 0x5e, 0x02,
+    0x63, 0x72, 0x72, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x72, 0x82, 0x74, 0x04, 0x72, 0x72, 0x74,
+    0x74, 0x72, 0x84, 0x74, 0x08, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x8b, 0x10,
+    0x00, 0x15, 0x8d, 0x1c, 0x00, 0x15, 0x8d, 0x10, 0x82, 0x1c, 0x04, 0x14, 0x00, 0x78, 0xa1, 0x6c,
+    0x85, 0x1f, 0x02, 0x3e, 0x66, 0x51, 0x83, 0x1f, 0x00, 0x12, 0x82, 0x97, 0x02, 0x85, 0x1f, 0x69,
+    0x82, 0x90, 0x03, 0x84, 0x7f, 0x09, 0x05, 0x82, 0x1f, 0x02, 0x0b, 0x00, 0x12, 0x82, 0x1f, 0x0a,
+    0x00, 0x32, 0x80, 0x84, 0x90, 0x68, 0x3f, 0x59, 0x63, 0x73, 0x74, 0x82, 0x72, 0x05, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x82, 0x72,
+    0x08, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x8b, 0x0f, 0x03, 0x10, 0x1c, 0x1c,
+    0x1b, 0x8a, 0x1c, 0x00, 0x15, 0x89, 0x10, 0x82, 0x0f, 0x00, 0x10, 0x82, 0x1c, 0x04, 0x14, 0x00,
+    0x78, 0x9b, 0x78, 0x85, 0x32, 0x02, 0x52, 0x77, 0x5e, 0x84, 0x32, 0x82, 0xa1, 0x08, 0x8d, 0x1f,
+    0x5f, 0x80, 0x80, 0x84, 0x84, 0x7f, 0x1e, 0x8a, 0x11, 0x08, 0x3b, 0x80, 0x80, 0x7f, 0x4a, 0x0a,
+    0x5a, 0x72, 0x72, 0x83, 0x74, 0x0a, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72,
+    0x74, 0x82, 0x72, 0x01, 0x74, 0x72, 0x82, 0x74, 0x08, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72,
+    0x74, 0x74, 0x8d, 0x0f, 0x06, 0x10, 0x0f, 0x10, 0x10, 0x0f, 0x10, 0x10, 0x94, 0x0f, 0x07, 0x10,
+    0x0f, 0x0f, 0x0e, 0x00, 0x05, 0x12, 0x8d, 0x8d, 0xa0, 0x83, 0xa1, 0x05, 0xa0, 0x7f, 0x09, 0x6c,
+    0x84, 0x84, 0x8e, 0x80, 0x06, 0x5f, 0x09, 0x55, 0x6e, 0x72, 0x72, 0x74, 0x83, 0x72, 0x03, 0x74,
+    0x72, 0x72, 0x74, 0x88, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00,
+    0x74, 0x83, 0x72, 0xab, 0x0f, 0x01, 0x0e, 0x18, 0x82, 0x32, 0x00, 0x80, 0x92, 0x95, 0x02, 0x6b,
+    0x00, 0x5f, 0x90, 0x78, 0x02, 0x58, 0x21, 0x56, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x82,
+    0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x72,
+    0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0xa9, 0x0f, 0x07, 0x10,
+    0x0f, 0x00, 0x40, 0x80, 0x80, 0x85, 0x4a, 0xa6, 0x00, 0x07, 0x42, 0x74, 0x72, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x04, 0x74, 0x74, 0x72,
+    0x72, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x8b,
+    0x44, 0x00, 0x42, 0x8d, 0x0f, 0x00, 0x2f, 0x8d, 0x44, 0x0c, 0x15, 0x0f, 0x00, 0x3b, 0x84, 0x84,
+    0x80, 0x4a, 0x00, 0x34, 0x41, 0x02, 0x09, 0x82, 0x4a, 0x02, 0x32, 0x00, 0x2e, 0x88, 0x42, 0x17,
+    0x41, 0x17, 0x00, 0x40, 0x4a, 0x4a, 0x40, 0x00, 0x20, 0x41, 0x21, 0x00, 0x3b, 0x4a, 0x4a, 0x40,
+    0x01, 0x13, 0x42, 0x56, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74,
+    0x83, 0x72, 0x84, 0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x0b, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x8b, 0x74, 0x02, 0x5b, 0x0f, 0x10, 0x8a, 0x0f, 0x01, 0x10,
+    0x56, 0x8c, 0x74, 0x13, 0x65, 0x1c, 0x0e, 0x00, 0x3b, 0x80, 0x84, 0x84, 0x4a, 0x00, 0x61, 0x72,
+    0x0c, 0x1f, 0x84, 0x84, 0x80, 0x5f, 0x00, 0x59, 0x89, 0x72, 0x13, 0x34, 0x00, 0x7f, 0x80, 0x80,
+    0x78, 0x00, 0x41, 0x72, 0x42, 0x00, 0x6c, 0x84, 0x80, 0x7f, 0x05, 0x2c, 0x72, 0x74, 0x74, 0x86,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x08, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x82,
+    0x72, 0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x84, 0x72, 0x02, 0x74, 0x72, 0x74, 0x00, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x65, 0x85, 0x4d, 0x82, 0x56, 0x84, 0x4d,
+    0x01, 0x63, 0x72, 0x8c, 0x74, 0x03, 0x56, 0x4c, 0x00, 0x1f, 0x82, 0x53, 0x05, 0x54, 0x4c, 0x6e,
+    0x73, 0x55, 0x54, 0x82, 0x53, 0x02, 0x3b, 0x00, 0x59, 0x89, 0x72, 0x01, 0x59, 0x4c, 0x82, 0x53,
+    0x10, 0x4a, 0x00, 0x41, 0x72, 0x59, 0x4c, 0x53, 0x58, 0x53, 0x53, 0x01, 0x2c, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x83, 0x72, 0x0b, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74,
+    0x72, 0x83, 0x74, 0x01, 0x72, 0x74, 0x85, 0x72, 0x06, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x07, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x8d, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x82, 0x72, 0x0b, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74,
+    0x74, 0x63, 0x84, 0x00, 0x00, 0x55, 0x83, 0x72, 0x00, 0x61, 0x84, 0x00, 0x01, 0x59, 0x74, 0x88,
+    0x72, 0x02, 0x74, 0x72, 0x17, 0x83, 0x00, 0x04, 0x41, 0x72, 0x72, 0x73, 0x33, 0x83, 0x00, 0x00,
+    0x2c, 0x83, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x82,
+    0x72, 0x08, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72,
+    0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x08, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x91,
+    0x72, 0x01, 0x74, 0x72, 0x84, 0x59, 0x00, 0x6e, 0x82, 0x74, 0x07, 0x72, 0x72, 0x86, 0x7a, 0x59,
+    0x59, 0x57, 0x6e, 0x88, 0x72, 0x03, 0x74, 0x72, 0x72, 0x61, 0x83, 0x59, 0x04, 0x63, 0x74, 0x72,
+    0x72, 0x61, 0x82, 0x59, 0x09, 0x57, 0x61, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x83,
+    0x72, 0x06, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00,
+    0x74, 0x82, 0x72, 0x08, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x04, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x86, 0x72, 0x00, 0x74, 0x88, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x8e, 0x72, 0x82, 0x74, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x7b, 0x99, 0x94, 0x84, 0x74,
+    0x87, 0x72, 0x05, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x84, 0x74, 0x00, 0x72, 0x83, 0x74, 0x04,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x86, 0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x07, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x82, 0x74, 0x00, 0x72, 0x84, 0x74, 0x02, 0x72, 0x74,
+    0x72, 0x00, 0x72, 0x82, 0x74, 0x00, 0x72, 0x83, 0x74, 0x0c, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x86, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x85,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x0d, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74,
+    0x75, 0x75, 0x74, 0x72, 0x74, 0x74, 0x87, 0x72, 0x00, 0x74, 0x8b, 0x72, 0x03, 0x74, 0x72, 0x72,
+    0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72,
+    0x72, 0x74, 0x74, 0x83, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x00, 0x74,
+    0x84, 0x72, 0x00, 0x74, 0x00, 0x74, 0x88, 0x72, 0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x8d, 0x72,
+    0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x8b, 0x72, 0x83, 0x75, 0x08, 0x72, 0x74, 0x75, 0x75, 0x72,
+    0x72, 0x7b, 0x75, 0x7b, 0x83, 0x72, 0x06, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72,
+    0x02, 0x74, 0x72, 0x72, 0x83, 0x74, 0x03, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x08, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x83, 0x74, 0x02, 0x72, 0x74, 0x72, 0x85, 0x74, 0x04,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x83, 0x74, 0x02, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x01,
+    0x74, 0x74, 0x82, 0x72, 0x03, 0x74, 0x74, 0x72, 0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x87, 0x72,
+    0x00, 0x74, 0x83, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x02, 0x74,
+    0x72, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x09, 0x8f, 0x98, 0x98, 0x96, 0x75, 0x7b,
+    0x99, 0x94, 0x72, 0x8e, 0x82, 0x98, 0x02, 0x7b, 0x72, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72,
+    0x0c, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x88, 0x72,
+    0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72,
+    0x82, 0x74, 0x02, 0x72, 0x72, 0x74, 0x82, 0x72, 0x06, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x00, 0x74, 0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x8a, 0x72, 0x00,
+    0x74, 0x89, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x74, 0x83, 0x72, 0x0c, 0x74, 0x72, 0x72, 0x8e,
+    0x96, 0x96, 0x94, 0x75, 0x75, 0x94, 0x92, 0x72, 0x87, 0x82, 0x94, 0x03, 0x7b, 0x72, 0x72, 0x74,
+    0x87, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x1a, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x85, 0x72, 0x01, 0x74, 0x74,
+    0x82, 0x72, 0x00, 0x74, 0x07, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x84, 0x74, 0x02,
+    0x72, 0x72, 0x74, 0x87, 0x72, 0x0c, 0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x85, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x82, 0x74, 0x02,
+    0x72, 0x74, 0x74, 0x83, 0x72, 0x09, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x82, 0x72, 0x82, 0x74, 0x82, 0x72, 0x07, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x86,
+    0x72, 0x06, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x83, 0x74, 0x07, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x07, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x02,
+    0x72, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x85, 0x72, 0x12, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x00,
+    0x74, 0x84, 0x72, 0x00, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x88, 0x81,
+    0x84, 0x72, 0x00, 0x74, 0x84, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x87, 0x72, 0x03, 0x74, 0x72,
+    0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72, 0x0b, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74,
+    0x82, 0x72, 0x06, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x04, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x8e, 0x72, 0x01, 0x74, 0x74, 0x86, 0x72, 0x04, 0x74, 0x72, 0x74, 0x72, 0x74, 0x89, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x83, 0x72, 0x05, 0x74, 0x72, 0x74, 0x7b, 0x98, 0x94, 0x82, 0x72, 0x01, 0x74,
+    0x74, 0x84, 0x72, 0x00, 0x74, 0x85, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74,
+    0x72, 0x82, 0x74, 0x83, 0x72, 0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72, 0x0f, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72,
+    0x03, 0x74, 0x72, 0x74, 0x72, 0x83, 0x74, 0x00, 0x72, 0x09, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74,
+    0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x01, 0x74,
+    0x74, 0x83, 0x72, 0x00, 0x74, 0x84, 0x72, 0x08, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x82, 0x72, 0x0b, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x7b, 0x98, 0x94,
+    0x84, 0x72, 0x84, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72, 0x06, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x83, 0x72, 0x17, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x83,
+    0x72, 0x84, 0x74, 0x85, 0x72, 0x00, 0x74, 0x88, 0x72, 0x00, 0x74, 0x87, 0x72, 0x00, 0x74, 0x84,
+    0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x7b, 0x98, 0x94, 0x83, 0x74, 0x88,
+    0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x85, 0x72, 0x02, 0x74, 0x72, 0x72, 0x83,
+    0x74, 0x01, 0x72, 0x74, 0x83, 0x72, 0x01, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72, 0x74, 0x85, 0x72,
+    0x02, 0x74, 0x74, 0x72, 0x82, 0x74, 0x03, 0x72, 0x74, 0x72, 0x72, 0x86, 0x74, 0x01, 0x72, 0x72,
+    0x01, 0x74, 0x74, 0x87, 0x72, 0x02, 0x74, 0x72, 0x74, 0x94, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00,
+    0x74, 0x85, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x7b, 0x7b, 0x74,
+    0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x85, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83,
+    0x72, 0x00, 0x74, 0x82, 0x72, 0x04, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x07, 0x74, 0x72,
+    0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x84, 0x74, 0x01, 0x72, 0x74, 0x85, 0x72, 0x02, 0x74, 0x72,
+    0x74, 0x83, 0x72, 0x05, 0x74, 0x74, 0x72, 0x72, 0x74, 0x74, 0x00, 0x74, 0x83, 0x72, 0x03, 0x74,
+    0x72, 0x74, 0x74, 0x99, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x00, 0x74, 0x84, 0x72,
+    0x00, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x72, 0x74, 0x74, 0x82, 0x72, 0x08, 0x74, 0x72, 0x72,
+    0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x85, 0x72, 0x00, 0x74, 0x82, 0x72, 0x08, 0x74, 0x74, 0x72,
+    0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x84, 0x74, 0x82, 0x72, 0x82, 0x74, 0x84, 0x72,
+    0x82, 0x74, 0x09, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x01,
+    0x74, 0x72, 0x01, 0x74, 0x74, 0x84, 0x72, 0x00, 0x74, 0x82, 0x72, 0x01, 0x74, 0x74, 0x85, 0x72,
+    0x00, 0x74, 0x84, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x00, 0x74,
+    0x83, 0x72, 0x00, 0x74, 0x89, 0x72, 0x00, 0x74, 0x82, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72,
+    0x0d, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82,
+    0x72, 0x00, 0x74, 0x84, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x74, 0x85, 0x72, 0x01,
+    0x74, 0x74, 0x82, 0x72, 0x83, 0x74, 0x82, 0x72, 0x07, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74,
+    0x72, 0x82, 0x74, 0x04, 0x72, 0x72, 0x74, 0x72, 0x74, 0x03, 0x72, 0x74, 0x72, 0x72, 0x82, 0x74,
+    0x01, 0x72, 0x74, 0x84, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x84,
+    0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72, 0x0e, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x72, 0x74, 0x87, 0x72,
+    0x00, 0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x83, 0x72, 0x10, 0x74, 0x72, 0x72, 0x74,
+    0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x82, 0x74, 0x00,
+    0x72, 0x82, 0x74, 0x03, 0x72, 0x74, 0x72, 0x74, 0x87, 0x72, 0x00, 0x74, 0x86, 0x72, 0x00, 0x74,
+    0x83, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x90, 0x72, 0x00, 0x74,
+    0x85, 0x72, 0x05, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x06, 0x74, 0x72, 0x72, 0x74,
+    0x72, 0x72, 0x74, 0x86, 0x72, 0x87, 0x74, 0x00, 0x72, 0x83, 0x74, 0x83, 0x72, 0x0a, 0x74, 0x72,
+    0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x83, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00,
+    0x74, 0x82, 0x72, 0x03, 0x74, 0x72, 0x74, 0x74, 0x85, 0x72, 0x01, 0x74, 0x74, 0x01, 0x72, 0x74,
+    0x83, 0x72, 0x00, 0x74, 0x84, 0x72, 0x00, 0x74, 0x8a, 0x72, 0x00, 0x74, 0x8a, 0x72, 0x00, 0x74,
+    0x86, 0x72, 0x00, 0x74, 0x85, 0x72, 0x00, 0x74, 0x86, 0x72, 0x02, 0x74, 0x72, 0x74, 0x82, 0x72,
+    0x06, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x63, 0x8e, 0x57, 0x10, 0x5a, 0x72, 0x72, 0x74, 0x74,
+    0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x82, 0x74, 0x01, 0x72,
+    0x74, 0x88, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74, 0x83, 0x72, 0x00, 0x74, 0x00, 0x74, 0x85,
+    0x72, 0x00, 0x74, 0x82, 0x72, 0x0d, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x74, 0x95, 0x72, 0x00, 0x74, 0x86, 0x72, 0x02, 0x74, 0x72, 0x74, 0x83, 0x72,
+    0x00, 0x74, 0x83, 0x72, 0x04, 0x74, 0x74, 0x72, 0x74, 0x2f, 0x8e, 0x03, 0x00, 0x23, 0x82, 0x74,
+    0x00, 0x72, 0x82, 0x74, 0x08, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x82, 0x72,
+    0x03, 0x74, 0x74, 0x72, 0x72, 0x84, 0x74, 0x82, 0x72, 0x04, 0x73, 0x74, 0x72, 0x72, 0x74, 0x82,
+    0x72, 0x00, 0x74, 0x08, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x82, 0x72, 0x03,
+    0x74, 0x72, 0x72, 0x74, 0x84, 0x72, 0x00, 0x74, 0x83, 0x72, 0x02, 0x74, 0x72, 0x72, 0x82, 0x74,
+    0x01, 0x72, 0x74, 0x86, 0x72, 0x01, 0x74, 0x74, 0x82, 0x72, 0x00, 0x74, 0x82, 0x72, 0x00, 0x74,
+    0x82, 0x72, 0x0b, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x65, 0x83,
+    0x4d, 0x01, 0x56, 0x23, 0x8e, 0x03, 0x02, 0x19, 0x4d, 0x5a, 0x84, 0x72, 0x0a, 0x74, 0x72, 0x72,
+    0x74, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x73, 0x8d, 0x57, 0x07, 0x5a, 0x74, 0x72, 0x72, 0x74,
+    0x74, 0x72, 0x74, 0x0a, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x72, 0x74, 0x72, 0x74, 0x74, 0x84,
+    0x72, 0x08, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x82, 0x74, 0x86, 0x72, 0x0c,
+    0x74, 0x74, 0x72, 0x74, 0x74, 0x72, 0x72, 0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x85, 0x72, 0x02,
+    0x74, 0x72, 0x74, 0x83, 0x72, 0x04, 0x74, 0x72, 0x72, 0x74, 0x63, 0x96, 0x03, 0x02, 0x42, 0x74,
+    0x74, 0x83, 0x72, 0x01, 0x74, 0x74, 0x83, 0x72, 0x04, 0x74, 0x74, 0x72, 0x74, 0x27, 0x8c, 0x1d,
+    0x01, 0x3c, 0x74, 0x84, 0x72, 0x00, 0x74, 0x84, 0x42, 0x09, 0x57, 0x74, 0x72, 0x74, 0x74, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x8a, 0x72, 0x01, 0x74, 0x57, 0x82, 0x46, 0x05, 0x4d, 0x46, 0x46, 0x4d,
+    0x46, 0x4d, 0x82, 0x46, 0x05, 0x65, 0x74, 0x72, 0x72, 0x74, 0x74, 0x83, 0x72, 0x08, 0x74, 0x72,
+    0x74, 0x72, 0x72, 0x74, 0x72, 0x74, 0x57, 0x85, 0x42, 0x00, 0x35, 0x96, 0x03, 0x00, 0x19, 0x82,
+    0x42, 0x00, 0x63, 0x82, 0x74, 0x84, 0x72, 0x00, 0x57, 0x82, 0x46, 0x00, 0x26, 0x8c, 0x1d, 0x00,
+    0x27, 0x82, 0x46, 0x03, 0x63, 0x74, 0x72, 0x72, 0x84, 0x03, 0x00, 0x4c, 0x84, 0x74, 0x04, 0x72,
+    0x72, 0x74, 0x72, 0x74, 0x82, 0x72, 0x04, 0x74, 0x72, 0x74, 0x74, 0x72, 0x82, 0x74, 0x02, 0x46,
+    0x1d, 0x25, 0x82, 0x1d, 0x09, 0x25, 0x1d, 0x1d, 0x25, 0x1d, 0x1d, 0x26, 0x63, 0x74, 0x74, 0x85,
+    0x72, 0x02, 0x74, 0x72, 0x72, 0x85, 0x74, 0x00, 0x4c, 0xa0, 0x03, 0x01, 0x07, 0x5a, 0x87, 0x74,
+    0x02, 0x46, 0x1d, 0x26, 0x91, 0x1d, 0x04, 0x26, 0x5a, 0x74, 0x72, 0x72, 0x84, 0x03, 0x00, 0x19,
+    0x83, 0x23, 0x00, 0x35, 0x89, 0x72, 0x07, 0x65, 0x3c, 0x30, 0x44, 0x30, 0x30, 0x2f, 0x1d, 0x88,
+    0x26, 0x08, 0x1d, 0x1d, 0x30, 0x44, 0x44, 0x3c, 0x74, 0x72, 0x74, 0x84, 0x72, 0x01, 0x73, 0x35,
+    0x83, 0x23, 0x00, 0x19, 0xa1, 0x03, 0x01, 0x23, 0x23, 0x86, 0x44, 0x02, 0x2f, 0x25, 0x26, 0x92,
+    0x1d, 0x00, 0x30, 0x82, 0x44, 0x89, 0x03, 0x00, 0x0e, 0x82, 0x65, 0x00, 0x72, 0x85, 0x74, 0x01,
+    0x65, 0x26, 0x85, 0x1d, 0x03, 0x26, 0x26, 0x1d, 0x1d, 0x84, 0x26, 0x82, 0x1d, 0x0c, 0x25, 0x25,
+    0x2f, 0x65, 0x74, 0x74, 0x73, 0x73, 0x74, 0x74, 0x73, 0x6e, 0x08, 0xa5, 0x03, 0x82, 0x04, 0x00,
+    0x16, 0x86, 0x1d, 0x01, 0x26, 0x26, 0x96, 0x1d, 0x8a, 0x03, 0x82, 0x14, 0x00, 0x1c, 0x86, 0x2f,
+    0x00, 0x26, 0x93, 0x1d, 0x09, 0x26, 0x2f, 0x27, 0x27, 0x2f, 0x2f, 0x5a, 0x74, 0x23, 0x14, 0xa5,
+    0x03, 0x02, 0x15, 0x16, 0x16, 0xa1, 0x1d, 0x8a, 0x03, 0x82, 0x08, 0x00, 0x10, 0x83, 0x1d, 0x01,
+    0x26, 0x26, 0x9b, 0x1d, 0x03, 0x57, 0x65, 0x23, 0x08, 0x9e, 0x03, 0x86, 0x08, 0x04, 0x1b, 0x1d,
+    0x25, 0x1d, 0x25, 0x9f, 0x1d, 0x89, 0x03, 0x00, 0x04, 0xa6, 0x1d, 0x03, 0x26, 0x1d, 0x1d, 0x04,
+    0x9c, 0x03, 0x01, 0x04, 0x16, 0x82, 0x1d, 0x01, 0x25, 0x25, 0xa5, 0x1d, 0x84, 0x03, 0x00, 0x08,
+    0x84, 0x0f, 0xa9, 0x1d, 0x84, 0x0f, 0x00, 0x08, 0x96, 0x03, 0x04, 0x0f, 0x0f, 0x16, 0x1d, 0x26,
+    0xa8, 0x1d, 0x84, 0x03, 0x00, 0x15, 0xb0, 0x1d, 0x03, 0x25, 0x1d, 0x1d, 0x15, 0x96, 0x03, 0x03,
+    0x1c, 0x1d, 0x1d, 0x26, 0xa9, 0x1d, 0x82, 0x03, 0x02, 0x08, 0x15, 0x1c, 0xb1, 0x1d, 0x02, 0x26,
+    0x26, 0x1c, 0x82, 0x15, 0x00, 0x08, 0x8c, 0x03, 0x00, 0x08, 0x84, 0x15, 0x00, 0x16, 0xac, 0x1d,
+    0x82, 0x03, 0x00, 0x10, 0xb9, 0x1d, 0x00, 0x08, 0x8c, 0x03, 0x06, 0x08, 0x25, 0x1d, 0x1d, 0x25,
+    0x1d, 0x25, 0xac, 0x1d, 0x82, 0x1b, 0x00, 0x1c, 0xb9, 0x1d, 0x00, 0x1c, 0x87, 0x1b, 0x05, 0x1c,
+    0x1b, 0x1c, 0x1b, 0x1b, 0x1c, 0xb2, 0x1d, 0xca, 0x1d, 0x00, 0x25, 0xb3, 0x1d, 0xff, 0x1d, 0xff,
+    0x1d, 0xff, 0x1d, 0xa2, 0x36, 0x00, 0x25, 0xd3, 0x1d, 0x00, 0x26, 0x86, 0x36, 0x02, 0x89, 0x82,
+    0x82, 0x9e, 0x89, 0x00, 0x6f, 0xd4, 0x1d, 0x01, 0x4e, 0x82, 0x85, 0x89, 0x02, 0x89, 0x82, 0x82,
+    0x84, 0x89, 0x00, 0x82, 0x82, 0x89, 0x04, 0x82, 0x89, 0x82, 0x89, 0x82, 0x82, 0x89, 0x07, 0x82,
+    0x89, 0x89, 0x82, 0x89, 0x82, 0x89, 0x82, 0x82, 0x89, 0x03, 0x82, 0x89, 0x89, 0x7c, 0x96, 0x4e,
+    0x00, 0x37, 0xaf, 0x1d, 0x00, 0x26, 0x8b, 0x4e, 0x00, 0x64, 0x86, 0x89, 0x82, 0x89, 0x00, 0x82,
+    0xaa, 0x89, 0x00, 0x82, 0x89, 0x89, 0x02, 0x64, 0x26, 0x26, 0x83, 0x1d, 0x01, 0x26, 0x1d, 0x83,
+    0x26, 0x83, 0x1d, 0x01, 0x26, 0x1d, 0x82, 0x26, 0x0c, 0x1d, 0x1d, 0x26, 0x1d, 0x1d, 0x26, 0x1d,
+    0x26, 0x1d, 0x1d, 0x26, 0x1d, 0x26, 0x8d, 0x1d, 0x00, 0x36, 0x89, 0x8a, 0x89, 0x89, 0x02, 0x89,
+    0x89, 0x82, 0x98, 0x89, 0x00, 0x82, 0x9c, 0x89, 0x01, 0x6f, 0x5d, 0x87, 0x5c, 0x00, 0x5d, 0x84,
+    0x5c, 0x00, 0x5d, 0x83, 0x5c, 0x00, 0x5d, 0x9a, 0x5c, 0x01, 0x64, 0x82, 0x92, 0x89, 0xbc, 0x89,
+    0x10, 0x82, 0x89, 0x82, 0x89, 0x89, 0x82, 0x82, 0x89, 0x82, 0x89, 0x89, 0x82, 0x82, 0x89, 0x89,
+    0x82, 0x82, 0x82, 0x89, 0x00, 0x82, 0x83, 0x89, 0x05, 0x82, 0x89, 0x82, 0x89, 0x89, 0x82, 0x9d,
+    0x89, 0x00, 0x82, 0x84, 0x89, 0x86, 0x89, 0x03, 0x82, 0x89, 0x89, 0x82, 0x8f, 0x89, 0x00, 0x82,
+    0xe3, 0x89, 0x88, 0x89, 0x00, 0x82, 0xf5, 0x89, 0xa4, 0x89, 0x00, 0x82, 0x87, 0x89, 0x00, 0x82,
+    0x86, 0x89, 0x00, 0x82, 0x92, 0x89, 0x00, 0x82, 0xa3, 0x89, 0x00, 0x82, 0x8f, 0x89, 0x88, 0x89,
+    0x00, 0x82, 0x8d, 0x89, 0x00, 0x82, 0x93, 0x89, 0x00, 0x82, 0x8e, 0x89, 0x01, 0x82, 0x82, 0x94,
+    0x89, 0x00, 0x82, 0x84, 0x89, 0x00, 0x82, 0xa4, 0x89,
+};
+
+// 178 colors, 7523 bytes (raw: 32768)
+static constexpr uint16_t cat_pal_2[] = {
+    0x0000, 0x0861, 0x0881, 0x08e1, 0x09a1, 0x09c1, 0x1062, 0x10a2, 0x10c1, 0x11e2, 0x18e3, 0x1922,
+    0x1943, 0x19a3, 0x19e3, 0x1a23, 0x1a43, 0x2124, 0x2125, 0x2144, 0x2223, 0x2264, 0x2965, 0x2986,
+    0x29a3, 0x29e3, 0x2a25, 0x2a43, 0x2a65, 0x2aa4, 0x2ae5, 0x2b05, 0x30c3, 0x3186, 0x31a4, 0x31e4,
+    0x31e5, 0x32a4, 0x32e5, 0x34a6, 0x34c6, 0x3966, 0x39c7, 0x3a26, 0x3aa6, 0x3b23, 0x3b25, 0x3b43,
+    0x3b67, 0x3c67, 0x3c87, 0x4228, 0x4265, 0x42a6, 0x42e4, 0x43a8, 0x43c8, 0x4a69, 0x4aa9, 0x4ae6,
+    0x4b06, 0x4ba7, 0x5166, 0x52aa, 0x52ca, 0x52e7, 0x5308, 0x5367, 0x53c4, 0x53e8, 0x5427, 0x5428,
+    0x5926, 0x5a6a, 0x5aeb, 0x5b48, 0x5be9, 0x5c22, 0x5c23, 0x5c28, 0x6106, 0x6328, 0x632c, 0x634c,
+    0x6389, 0x63a8, 0x63e8, 0x6422, 0x6426, 0x6482, 0x6b48, 0x6b4d, 0x6bc9, 0x6c49, 0x6c4a, 0x6c69,
+    0x6c6a, 0x6ca2, 0x738e, 0x73ae, 0x742a, 0x7449, 0x748a, 0x74aa, 0x7805, 0x78c7, 0x7bcf, 0x7beb,
+    0x7c10, 0x7c89, 0x7cca, 0x7cea, 0x80c7, 0x8430, 0x848b, 0x84c9, 0x84ca, 0x84ea, 0x8543, 0x8826,
+    0x8846, 0x89c9, 0x8c71, 0x8d83, 0x9451, 0x948c, 0x9492, 0x94b2, 0x94cd, 0x950b, 0x952c, 0x954f,
+    0x95c1, 0x9b8f, 0x9cb3, 0x9cd3, 0x9d2d, 0x9d6d, 0x9dc1, 0xa410, 0xa514, 0xa5ae, 0xac52, 0xac92,
+    0xad34, 0xad4f, 0xad6e, 0xad75, 0xadae, 0xadcf, 0xb596, 0xb5b0, 0xb610, 0xbcb3, 0xbd76, 0xbdb7,
+    0xbdf0, 0xbdf7, 0xbe10, 0xc5f0, 0xc631, 0xc638, 0xc672, 0xc6b3, 0xccd3, 0xce59, 0xced3, 0xcf34,
+    0xcf55, 0xd4f3, 0xd69a, 0xdcb3, 0xe493, 0xec93, 0xf4d4, 0xf79e, 0xfcb2, 0xffff,
+};
+static constexpr uint16_t cat_row_2[] = {
+    0, 46, 86, 116, 165, 214, 262, 296, 326, 375, 428, 460, 482, 513, 571, 612,
+    655, 721, 786, 842, 885, 943, 1006, 1058, 1094, 1154, 1242, 1310, 1406, 1478, 1533, 1590,
+    1681, 1774, 1861, 1916, 1967, 2033, 2083, 2132, 2174, 2209, 2253, 2294, 2340, 2392, 2457, 2534,
+    2593, 2636, 2678, 2718, 2787, 2854, 2918, 2997, 3065, 3148, 3226, 3281, 3335, 3384, 3441, 3507,
+    3570, 3632, 3680, 3738, 3815, 3876, 3945, 4025, 4097, 4159, 4233, 4317, 4406, 4470, 4510, 4563,
+    4620, 4695, 4782, 4855, 4930, 5024, 5127, 5212, 5305, 5371, 5453, 5511, 5574, 5634, 5707, 5767,
+    5833, 5896, 5971, 6048, 6132, 6223, 6271, 6342, 6391, 6448, 6487, 6516, 6555, 6578, 6600, 6617,
+    6639, 6653, 6659, 6665, 6667, 6676, 6682, 6701, 6721, 6746, 6790, 6846, 6876, 6886, 6888, 6894,
+};
+static constexpr uint8_t cat_code_2[] = {
+    0x02, 0x73, 0x74, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0xa8, 0x74, 0x03, 0x6e, 0x6e, 0x74, 0x6e, 0x88,
+    0x74, 0x07, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x8a, 0x74, 0x02, 0x6e, 0x6e, 0x74,
+    0x84, 0x6e, 0x89, 0x74, 0x06, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x6e, 0x93, 0x74, 0x05, 0x74,
+    0x74, 0x73, 0x6e, 0x6e, 0x74, 0x82, 0x6e, 0x86, 0x74, 0x02, 0x6e, 0x74, 0x74, 0x82, 0x6e, 0x01,
+    0x74, 0x6e, 0xa7, 0x74, 0x00, 0x6e, 0x87, 0x74, 0x01, 0x6e, 0x74, 0x84, 0x6e, 0x01, 0x74, 0x6e,
+    0x89, 0x74, 0x00, 0x6e, 0xa2, 0x74, 0x01, 0x74, 0x6e, 0x88, 0x74, 0x04, 0x6e, 0x6e, 0x74, 0x74,
+    0x6e, 0x91, 0x74, 0x00, 0x6e, 0xa0, 0x74, 0x01, 0x6e, 0x6e, 0x8f, 0x74, 0x00, 0x6e, 0x8e, 0x74,
+    0x00, 0x6e, 0x98, 0x74, 0x02, 0x73, 0x6e, 0x73, 0x82, 0x74, 0x00, 0x6e, 0x87, 0x74, 0x00, 0x6e,
+    0x88, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0xa2, 0x74, 0x01,
+    0x6e, 0x6e, 0x8c, 0x74, 0x00, 0x6e, 0x8e, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x8c,
+    0x74, 0x00, 0x6e, 0x85, 0x74, 0x07, 0x73, 0x74, 0x74, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x87, 0x74,
+    0x00, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0x87, 0x74, 0x00, 0x6e, 0x8c, 0x74,
+    0x00, 0x6e, 0x89, 0x74, 0x01, 0x6e, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x8e, 0x74, 0x01, 0x6e, 0x6e,
+    0x8d, 0x74, 0x00, 0x6e, 0x97, 0x74, 0x08, 0x73, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e,
+    0x88, 0x74, 0x04, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x00, 0x6e,
+    0x83, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0xa6, 0x74, 0x00, 0x6e,
+    0x8e, 0x74, 0x00, 0x6e, 0x8e, 0x74, 0x00, 0x74, 0x82, 0x73, 0x00, 0x6e, 0x87, 0x74, 0x03, 0x6e,
+    0x6e, 0x74, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x6e, 0x6e, 0x89, 0x74,
+    0x00, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0xd0, 0x74, 0x05, 0x74, 0x73, 0x73, 0x6e, 0x74, 0x6e, 0xa2,
+    0x74, 0x01, 0x6e, 0x6e, 0x8e, 0x74, 0x01, 0x6e, 0x6e, 0x8f, 0x74, 0x00, 0x6e, 0x8f, 0x74, 0x03,
+    0x6e, 0x74, 0x74, 0x6e, 0x9e, 0x74, 0x04, 0x74, 0x73, 0x6e, 0x73, 0x6e, 0x89, 0x74, 0x82, 0x6e,
+    0x87, 0x74, 0x00, 0x6e, 0x8d, 0x74, 0x00, 0x6e, 0x8c, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x00, 0x6e,
+    0x8b, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x01, 0x6e,
+    0x6e, 0x8b, 0x74, 0x00, 0x6e, 0x8e, 0x74, 0x08, 0x6e, 0x74, 0x73, 0x74, 0x6e, 0x6e, 0x74, 0x74,
+    0x6e, 0x86, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0xa0,
+    0x74, 0x00, 0x6e, 0x85, 0x74, 0x01, 0x6e, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x02, 0x6e,
+    0x74, 0x6e, 0x8e, 0x74, 0x00, 0x6e, 0x8b, 0x74, 0x00, 0x6e, 0x87, 0x74, 0x02, 0x74, 0x74, 0x6e,
+    0x85, 0x74, 0x01, 0x6e, 0x6e, 0x88, 0x74, 0x82, 0x6e, 0x89, 0x74, 0x01, 0x6e, 0x6e, 0x9c, 0x74,
+    0x00, 0x6e, 0x91, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0xa7, 0x74, 0x06, 0x74, 0x73, 0x6e,
+    0x73, 0x73, 0x74, 0x6e, 0xc0, 0x74, 0x00, 0x6e, 0x8c, 0x74, 0x00, 0x6e, 0x94, 0x74, 0x00, 0x6e,
+    0x92, 0x74, 0x00, 0x74, 0x83, 0x73, 0x87, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x02, 0x6e, 0x6e, 0x66,
+    0x86, 0x65, 0x01, 0x6e, 0x6e, 0xa0, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x8d, 0x74, 0x00, 0x6e, 0xa9,
+    0x74, 0x07, 0x74, 0x6e, 0x74, 0x73, 0x6e, 0x74, 0x74, 0x6e, 0x85, 0x74, 0x03, 0x6e, 0x74, 0x74,
+    0x6e, 0x84, 0x74, 0x05, 0x6e, 0x74, 0x55, 0x11, 0x11, 0x13, 0x82, 0x11, 0x07, 0x24, 0x6e, 0x6e,
+    0x74, 0x6e, 0x74, 0x74, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x90, 0x74, 0x00,
+    0x6e, 0x8c, 0x74, 0x00, 0x6e, 0xa3, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x00, 0x74, 0x83, 0x73, 0x02,
+    0x74, 0x74, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x02, 0x67, 0x5c, 0x4b, 0x85, 0x3c, 0x02,
+    0x42, 0x56, 0x5d, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x8b, 0x74, 0x00, 0x6e, 0xb2, 0x74,
+    0x00, 0x6e, 0x94, 0x74, 0x83, 0x73, 0x82, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x87, 0x74,
+    0x03, 0x6e, 0x65, 0x13, 0x3c, 0x83, 0x6e, 0x08, 0x74, 0x74, 0x6d, 0x18, 0x35, 0x74, 0x74, 0x6e,
+    0x6e, 0x82, 0x74, 0x82, 0x6e, 0xab, 0x74, 0x00, 0x6e, 0x92, 0x74, 0x00, 0x6e, 0x91, 0x74, 0x0b,
+    0x74, 0x6e, 0x73, 0x73, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x83, 0x74, 0x00, 0x6e,
+    0x83, 0x74, 0x04, 0x6e, 0x4b, 0x4b, 0x55, 0x5d, 0x82, 0x6e, 0x82, 0x74, 0x04, 0x6e, 0x55, 0x55,
+    0x4b, 0x5d, 0x82, 0x6e, 0x87, 0x74, 0x03, 0x6e, 0x74, 0x6e, 0x6e, 0x90, 0x74, 0x03, 0x6e, 0x74,
+    0x74, 0x6e, 0x8f, 0x74, 0x00, 0x6e, 0x9d, 0x74, 0x07, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x74,
+    0x74, 0x06, 0x73, 0x73, 0x6e, 0x73, 0x6e, 0x74, 0x6e, 0x85, 0x74, 0x03, 0x6e, 0x6e, 0x74, 0x6e,
+    0x83, 0x74, 0x0f, 0x6d, 0x13, 0x34, 0x74, 0x74, 0x73, 0x73, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x74,
+    0x5d, 0x13, 0x4b, 0x82, 0x74, 0x00, 0x6e, 0x8d, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x89, 0x74, 0x03,
+    0x6e, 0x6e, 0x74, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0xa2, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x00, 0x6e,
+    0x82, 0x74, 0x04, 0x73, 0x74, 0x6e, 0x74, 0x73, 0x86, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x10, 0x6e,
+    0x6d, 0x13, 0x34, 0x73, 0x5c, 0x35, 0x5d, 0x6e, 0x74, 0x6e, 0x3c, 0x41, 0x6e, 0x5d, 0x13, 0x4b,
+    0x8a, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0x87, 0x74, 0x08, 0x6e,
+    0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0xad, 0x74, 0x03, 0x74, 0x73, 0x74, 0x73, 0x8a,
+    0x74, 0x00, 0x6e, 0x84, 0x74, 0x06, 0x66, 0x13, 0x34, 0x74, 0x55, 0x11, 0x56, 0x82, 0x6e, 0x06,
+    0x24, 0x24, 0x6e, 0x5d, 0x13, 0x42, 0x74, 0x83, 0x6e, 0x04, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x9a,
+    0x74, 0x00, 0x6e, 0xb4, 0x74, 0x84, 0x73, 0x02, 0x74, 0x74, 0x6e, 0x8c, 0x74, 0x10, 0x66, 0x13,
+    0x34, 0x74, 0x6e, 0x6d, 0x4b, 0x2b, 0x24, 0x2b, 0x65, 0x66, 0x6e, 0x5d, 0x13, 0x3c, 0x6e, 0x84,
+    0x74, 0x01, 0x6e, 0x6e, 0x99, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x02, 0x6e, 0x6e, 0x74, 0x82, 0x6e,
+    0x01, 0x74, 0x6e, 0x87, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x92, 0x74, 0x00, 0x6e, 0x8c, 0x74, 0x82,
+    0x73, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x16, 0x6e, 0x6d, 0x66,
+    0x66, 0x6d, 0x65, 0x13, 0x34, 0x66, 0x6d, 0x6d, 0x3c, 0x13, 0x13, 0x18, 0x65, 0x6d, 0x66, 0x5c,
+    0x13, 0x3c, 0x67, 0x66, 0x82, 0x6d, 0x83, 0x6e, 0x01, 0x74, 0x74, 0x83, 0x6e, 0x9e, 0x74, 0x07,
+    0x6e, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x9a, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x00, 0x74,
+    0x83, 0x73, 0x84, 0x74, 0x85, 0x6e, 0x00, 0x4b, 0x97, 0x13, 0x0c, 0x18, 0x6d, 0x6e, 0x6e, 0x73,
+    0x74, 0x74, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x8d, 0x74, 0x00, 0x6e, 0x90, 0x74, 0x00, 0x6e,
+    0x82, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x04, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x8b, 0x74, 0x00, 0x6e,
+    0x8f, 0x74, 0x00, 0x74, 0x82, 0x73, 0x83, 0x6e, 0x85, 0x74, 0x02, 0x6d, 0x65, 0x54, 0x98, 0x51,
+    0x03, 0x5d, 0x65, 0x6e, 0x73, 0x88, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0xab, 0x74, 0x01, 0x6e, 0x6e,
+    0x83, 0x74, 0x00, 0x6e, 0x90, 0x74, 0x04, 0x6e, 0x74, 0x73, 0x74, 0x73, 0x83, 0x74, 0x00, 0x6e,
+    0x83, 0x74, 0x02, 0x56, 0x13, 0x7d, 0x89, 0x9e, 0x84, 0x9c, 0x03, 0x9e, 0x9c, 0x9c, 0x9e, 0x85,
+    0x9c, 0x04, 0x2b, 0x2b, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x83, 0x74,
+    0x00, 0x6e, 0x9d, 0x74, 0x00, 0x6e, 0x93, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x8b, 0x74, 0x01,
+    0x6e, 0x74, 0x04, 0x74, 0x73, 0x6e, 0x6e, 0x73, 0x86, 0x74, 0x0b, 0x66, 0x55, 0x5c, 0x72, 0x72,
+    0x7d, 0x94, 0x9e, 0xa2, 0xa2, 0x9e, 0x97, 0x82, 0x7d, 0x05, 0x91, 0x9c, 0xa2, 0xa2, 0x9e, 0x9c,
+    0x82, 0x7d, 0x09, 0x88, 0x9e, 0xa0, 0xa2, 0x9e, 0x9c, 0x2b, 0x24, 0x55, 0x5c, 0x82, 0x74, 0x00,
+    0x6e, 0x86, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x8c, 0x74,
+    0x00, 0x6e, 0x8b, 0x74, 0x01, 0x89, 0x82, 0x83, 0x74, 0x84, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0x85,
+    0x74, 0x00, 0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x6e, 0x74, 0x00, 0x74, 0x82, 0x73, 0x86, 0x74,
+    0x29, 0x6e, 0x65, 0x11, 0x72, 0xa8, 0x83, 0x11, 0x88, 0x9e, 0xa7, 0xa7, 0x9e, 0x91, 0x11, 0x13,
+    0x13, 0x7d, 0x9c, 0xa6, 0xa7, 0xa0, 0x97, 0x22, 0x11, 0x13, 0x6b, 0x9e, 0xa3, 0xa8, 0xa0, 0x9c,
+    0x2b, 0x13, 0x13, 0x35, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x8e, 0x74, 0x02, 0x6e, 0x74,
+    0x6e, 0x96, 0x74, 0x03, 0x75, 0x9c, 0x9c, 0x75, 0x85, 0x74, 0x82, 0x6e, 0x94, 0x74, 0x01, 0x73,
+    0x74, 0x82, 0x73, 0x86, 0x74, 0x0b, 0x66, 0x55, 0x64, 0x80, 0x72, 0x7d, 0x97, 0x9e, 0xa2, 0xa2,
+    0x9e, 0x97, 0x82, 0x7d, 0x05, 0x92, 0x9c, 0xa2, 0xa2, 0x9e, 0x9c, 0x82, 0x7d, 0x12, 0x88, 0x9e,
+    0xa0, 0xa2, 0x9e, 0x9c, 0x2b, 0x19, 0x56, 0x5d, 0x73, 0x74, 0x74, 0x6e, 0x6e, 0x74, 0x74, 0x6e,
+    0x6e, 0x88, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x07, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x74, 0x6e,
+    0x6e, 0x8f, 0x74, 0x05, 0x6e, 0x74, 0x82, 0x82, 0x74, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x87, 0x74,
+    0x05, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x85, 0x74, 0x03, 0x6e, 0x6e, 0x74, 0x74, 0x02, 0x74,
+    0x73, 0x73, 0x85, 0x74, 0x0f, 0x6e, 0x6e, 0x74, 0x6e, 0x6e, 0x5c, 0x13, 0x7d, 0x9f, 0x9f, 0x9e,
+    0x9e, 0x9c, 0x9e, 0x9e, 0x9c, 0x87, 0x9e, 0x82, 0x9f, 0x0d, 0x9e, 0x9c, 0x9f, 0x9f, 0x9e, 0x9c,
+    0x2b, 0x2b, 0x6e, 0x6e, 0x74, 0x73, 0x6e, 0x74, 0x83, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x83, 0x74,
+    0x00, 0x6e, 0x85, 0x74, 0x01, 0x6e, 0x6e, 0x84, 0x74, 0x01, 0x6e, 0x6e, 0x9f, 0x74, 0x00, 0x6e,
+    0x84, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x04, 0x74, 0x6e, 0x74, 0x73, 0x6e, 0x83, 0x74, 0x07, 0x6e,
+    0x74, 0x74, 0x6e, 0x74, 0x66, 0x5d, 0x54, 0x98, 0x51, 0x01, 0x5c, 0x65, 0x83, 0x73, 0x86, 0x74,
+    0x05, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x6e, 0x83, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x8f, 0x74,
+    0x00, 0x6e, 0x96, 0x74, 0x00, 0x6e, 0x8d, 0x74, 0x03, 0x6e, 0x6e, 0x74, 0x74, 0x03, 0x74, 0x73,
+    0x73, 0x6e, 0x84, 0x74, 0x08, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x73, 0x74, 0x4b, 0x18, 0x96, 0x13,
+    0x06, 0x18, 0x6d, 0x74, 0x6e, 0x73, 0x73, 0x6e, 0x86, 0x74, 0x01, 0x6e, 0x74, 0x82, 0x6e, 0x89,
+    0x74, 0x00, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x00, 0x75, 0x89, 0x74, 0x00, 0x75, 0x84,
+    0x74, 0x01, 0x6e, 0x6e, 0x92, 0x74, 0x05, 0x6e, 0x74, 0x74, 0x73, 0x6e, 0x6e, 0x86, 0x74, 0x03,
+    0x6e, 0x73, 0x74, 0x6e, 0x82, 0x66, 0x83, 0x6d, 0x0a, 0x66, 0x66, 0x6d, 0x66, 0x6d, 0x66, 0x6d,
+    0x66, 0x6d, 0x6d, 0x66, 0x82, 0x6d, 0x00, 0x66, 0x82, 0x6d, 0x06, 0x6e, 0x6e, 0x74, 0x73, 0x6e,
+    0x74, 0x73, 0x85, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x82, 0x6e, 0x04, 0x74, 0x74, 0x6e, 0x74,
+    0x6e, 0x86, 0x74, 0x01, 0x6e, 0x6e, 0x88, 0x74, 0x05, 0x6e, 0x74, 0x74, 0x82, 0x97, 0x82, 0x82,
+    0x74, 0x00, 0x6e, 0x83, 0x74, 0x04, 0x89, 0x97, 0x82, 0x74, 0x6e, 0x8c, 0x74, 0x00, 0x6e, 0x88,
+    0x74, 0x02, 0x6e, 0x74, 0x73, 0x84, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x01, 0x6e, 0x73, 0x83, 0x74,
+    0x01, 0x6e, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x06, 0x6e, 0x6e,
+    0x74, 0x6e, 0x6e, 0x73, 0x74, 0x82, 0x73, 0x05, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x83, 0x6e,
+    0x82, 0x74, 0x00, 0x6e, 0x93, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x0f, 0x6e, 0x74, 0x82, 0x9c, 0x89,
+    0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x89, 0x9c, 0x82, 0x88, 0x74, 0x06, 0x6e, 0x74,
+    0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x05, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x84, 0x73,
+    0x82, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x83, 0x74, 0x23, 0x6e, 0x74, 0x73, 0x6e, 0x74, 0x6e, 0x74,
+    0x6e, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x74,
+    0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x82, 0x6e, 0x82,
+    0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x86, 0x74, 0x01, 0x6e, 0x6e, 0x93, 0x74, 0x00, 0x75, 0x86,
+    0x74, 0x03, 0x6e, 0x74, 0x74, 0x75, 0x88, 0x74, 0x01, 0x6e, 0x6e, 0x86, 0x74, 0x04, 0x6e, 0x74,
+    0x6e, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x74, 0x82, 0x73, 0x82, 0x74, 0x00, 0x6e, 0x96, 0x74, 0x02,
+    0x6e, 0x74, 0x6e, 0x85, 0x74, 0x01, 0x6e, 0x6e, 0x90, 0x74, 0x01, 0x6e, 0x74, 0x82, 0x6e, 0x01,
+    0x74, 0x74, 0x82, 0x6e, 0x89, 0x74, 0x82, 0x6e, 0x05, 0x74, 0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x95,
+    0x74, 0x00, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x01, 0x81, 0x82, 0x06, 0x74, 0x73, 0x74,
+    0x73, 0x74, 0x6e, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0x94, 0x74, 0x05, 0x6e, 0x74, 0x6e, 0x74, 0x74,
+    0x6e, 0x9d, 0x74, 0x00, 0x6e, 0x8d, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x01, 0x6e, 0x6e, 0x89, 0x74,
+    0x02, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x03, 0x6e, 0x6e, 0x97, 0x9e, 0x02,
+    0x74, 0x6e, 0x74, 0x82, 0x6e, 0x82, 0x74, 0x03, 0x6e, 0x6e, 0x74, 0x6e, 0x84, 0x74, 0x00, 0x6e,
+    0x84, 0x74, 0x00, 0x6e, 0x9d, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x90, 0x74, 0x04, 0x6e, 0x74,
+    0x6e, 0x74, 0x6e, 0x89, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x01, 0x82, 0x82, 0x85, 0x74, 0x02, 0x6e,
+    0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x02, 0x6e, 0x6e, 0x74, 0x83, 0x6e, 0x01, 0x97,
+    0x9f, 0x01, 0x74, 0x6e, 0x82, 0x73, 0x83, 0x74, 0x06, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x6e,
+    0x8e, 0x74, 0x05, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x00,
+    0x6e, 0xa6, 0x74, 0x03, 0x75, 0x9c, 0x9c, 0x75, 0x86, 0x74, 0x82, 0x6e, 0x8f, 0x74, 0x03, 0x6e,
+    0x6e, 0x97, 0x9e, 0x05, 0x74, 0x73, 0x74, 0x73, 0x6e, 0x6e, 0x88, 0x74, 0x07, 0x6e, 0x74, 0x74,
+    0x6e, 0x6e, 0x74, 0x74, 0x6e, 0xbd, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x01, 0x82, 0x82, 0x83, 0x74,
+    0x02, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x89, 0x74, 0x01, 0x6e, 0x6e, 0x83, 0x74, 0x03,
+    0x6e, 0x6e, 0x82, 0x89, 0x03, 0x74, 0x73, 0x74, 0x73, 0x86, 0x74, 0x06, 0x6e, 0x6e, 0x74, 0x6e,
+    0x74, 0x6e, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x01, 0x6e, 0x6e, 0x94, 0x74, 0x00, 0x6e,
+    0x9f, 0x74, 0x00, 0x6e, 0x9f, 0x74, 0x82, 0x6e, 0x00, 0x74, 0x82, 0x6e, 0x82, 0x74, 0x04, 0x74,
+    0x6e, 0x73, 0x73, 0x6e, 0x95, 0x74, 0x04, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x8d, 0x74, 0x00, 0x6e,
+    0x90, 0x74, 0x00, 0x6e, 0xb4, 0x74, 0x09, 0x6e, 0x6e, 0x82, 0x94, 0x97, 0x97, 0x82, 0x74, 0x94,
+    0x94, 0x04, 0x74, 0x73, 0x73, 0x74, 0x6e, 0x88, 0x74, 0x03, 0x6e, 0x74, 0x6e, 0x6e, 0x88, 0x74,
+    0x03, 0x6e, 0x74, 0x74, 0x6e, 0xb2, 0x74, 0x01, 0x6e, 0x6e, 0x96, 0x74, 0x02, 0x6e, 0x74, 0x6e,
+    0x87, 0x74, 0x02, 0x6e, 0x6e, 0x82, 0x82, 0x9c, 0x03, 0x82, 0x74, 0x94, 0x9c, 0x04, 0x6e, 0x74,
+    0x6e, 0x6e, 0x73, 0x85, 0x74, 0x00, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x83, 0x6e, 0x01,
+    0x74, 0x6e, 0xa4, 0x74, 0x00, 0x6e, 0xa3, 0x74, 0x00, 0x6e, 0x89, 0x74, 0x01, 0x6e, 0x6f, 0x82,
+    0x75, 0x03, 0x74, 0x74, 0x75, 0x75, 0x06, 0x73, 0x6e, 0x73, 0x73, 0x74, 0x74, 0x6e, 0x99, 0x74,
+    0x00, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0x89, 0x74, 0x00, 0x6e, 0x90, 0x74, 0x00, 0x6e, 0x8d,
+    0x74, 0x00, 0x6e, 0x93, 0x74, 0x04, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x8c, 0x74, 0x82, 0x6e, 0x03,
+    0x74, 0x74, 0x75, 0x75, 0x00, 0x74, 0x83, 0x73, 0x87, 0x6e, 0x04, 0x74, 0x6e, 0x6e, 0x74, 0x6e,
+    0x89, 0x74, 0x83, 0x6e, 0x04, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x02, 0x6e, 0x74, 0x74,
+    0x91, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0xa3, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x8a, 0x74, 0x08, 0x6e,
+    0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x74, 0x95, 0x9c, 0x04, 0x73, 0x73, 0x74, 0x6e, 0x73, 0x86, 0x6e,
+    0x01, 0x74, 0x74, 0x83, 0x6e, 0x00, 0x67, 0x84, 0x6e, 0x05, 0x67, 0x6e, 0x6e, 0x67, 0x6e, 0x6e,
+    0x89, 0x74, 0x09, 0x6e, 0x74, 0x74, 0x6e, 0x67, 0x6e, 0x6e, 0x67, 0x67, 0x6e, 0x83, 0x67, 0x87,
+    0x6e, 0x85, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0xa0, 0x74, 0x00, 0x6e, 0x8b, 0x74, 0x02,
+    0x6e, 0x6e, 0x74, 0x82, 0x6e, 0x02, 0x6f, 0x97, 0x9e, 0x08, 0x74, 0x73, 0x6e, 0x73, 0x73, 0x6e,
+    0x73, 0x6e, 0x74, 0x83, 0x73, 0x01, 0x74, 0x67, 0x8d, 0x5e, 0x86, 0x6e, 0x01, 0x74, 0x74, 0x82,
+    0x6e, 0x02, 0x74, 0x74, 0x6e, 0x85, 0x5e, 0x00, 0x60, 0x86, 0x5e, 0x02, 0x67, 0x6e, 0x6e, 0x82,
+    0x74, 0x09, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x6e, 0x83, 0x74, 0x04, 0x6e,
+    0x6e, 0x74, 0x74, 0x6e, 0x8f, 0x74, 0x00, 0x6e, 0x8e, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x84,
+    0x74, 0x03, 0x6e, 0x6f, 0x97, 0x9c, 0x8d, 0x67, 0x04, 0x66, 0x60, 0x5e, 0x60, 0x5e, 0x82, 0x60,
+    0x82, 0x5e, 0x04, 0x60, 0x5e, 0x60, 0x60, 0x66, 0x8d, 0x67, 0x00, 0x60, 0x83, 0x5e, 0x01, 0x3d,
+    0x43, 0x86, 0x3c, 0x00, 0x4b, 0x94, 0x55, 0x0a, 0x65, 0x74, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x6e,
+    0x74, 0x74, 0x6e, 0x96, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x02, 0x6e, 0x89,
+    0x8d, 0x00, 0x60, 0x91, 0x5e, 0x00, 0x60, 0x84, 0x5e, 0x00, 0x60, 0x84, 0x5e, 0x00, 0x60, 0x90,
+    0x5e, 0x00, 0x35, 0x9d, 0x00, 0x00, 0x55, 0x88, 0x74, 0x07, 0x6e, 0x6e, 0x74, 0x6e, 0x74, 0x6e,
+    0x74, 0x6e, 0x8b, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x89, 0x74, 0x00, 0x60, 0xa2, 0x5e,
+    0x00, 0x60, 0x89, 0x5e, 0x02, 0x55, 0x35, 0x71, 0x9d, 0x8c, 0x06, 0x6a, 0x3c, 0x65, 0x74, 0x74,
+    0x6e, 0x6e, 0x8a, 0x74, 0x04, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x86, 0x74, 0x02, 0x6e, 0x74, 0x6e,
+    0x82, 0x74, 0x00, 0x6e, 0x8a, 0x74, 0xac, 0x5e, 0x04, 0x60, 0x5e, 0x3c, 0x00, 0x8c, 0x9d, 0xa5,
+    0x0c, 0x7a, 0x00, 0x5c, 0x74, 0x73, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x85, 0x74,
+    0x00, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0x84, 0x74, 0x01, 0x6e, 0x6e, 0x8f, 0x74, 0x01, 0x5e,
+    0x60, 0x85, 0x5e, 0x00, 0x60, 0x82, 0x5e, 0x02, 0x60, 0x60, 0x5d, 0x8d, 0x4f, 0x00, 0x5d, 0x8a,
+    0x5e, 0x08, 0x60, 0x60, 0x5e, 0x4f, 0x3d, 0x19, 0x6a, 0x96, 0x71, 0x8e, 0x4a, 0x00, 0x6a, 0x84,
+    0xa5, 0x04, 0x8e, 0x79, 0x79, 0x85, 0xa1, 0x83, 0xa5, 0x06, 0x9d, 0x96, 0x53, 0x23, 0x6d, 0x6e,
+    0x6e, 0x84, 0x74, 0x04, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x8d, 0x74, 0x00,
+    0x6e, 0x8a, 0x74, 0x8b, 0x5e, 0x82, 0x5d, 0x02, 0x4f, 0x4f, 0x47, 0x82, 0x4f, 0x01, 0x47, 0x46,
+    0x83, 0x47, 0x02, 0x46, 0x4f, 0x5d, 0x8b, 0x5e, 0x07, 0x5d, 0x5d, 0x4f, 0x43, 0x00, 0x7a, 0xa5,
+    0x6c, 0x8e, 0x21, 0x00, 0x52, 0x84, 0xa5, 0x04, 0x85, 0x78, 0x78, 0x79, 0xa1, 0x85, 0xa5, 0x04,
+    0x5b, 0x00, 0x66, 0x6e, 0x6e, 0x84, 0x74, 0x05, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x8c, 0x74,
+    0x02, 0x6e, 0x74, 0x6e, 0x8d, 0x74, 0x8e, 0x4f, 0x08, 0x46, 0x4f, 0x46, 0x47, 0x4f, 0x46, 0x47,
+    0x4f, 0x47, 0x83, 0x4f, 0x00, 0x46, 0x8e, 0x4f, 0x05, 0x47, 0x43, 0x00, 0x71, 0xa5, 0x6c, 0x8e,
+    0x21, 0x00, 0x52, 0x84, 0xa5, 0x04, 0x85, 0x77, 0x77, 0x79, 0xa1, 0x85, 0xa5, 0x04, 0x5b, 0x00,
+    0x66, 0x6e, 0x6e, 0x83, 0x74, 0x05, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e,
+    0x83, 0x74, 0x00, 0x6e, 0x95, 0x74, 0x8c, 0x4f, 0x0b, 0x46, 0x46, 0x4f, 0x47, 0x4f, 0x4f, 0x46,
+    0x47, 0x4f, 0x47, 0x46, 0x47, 0x83, 0x4f, 0x00, 0x46, 0x8a, 0x4f, 0x08, 0x46, 0x47, 0x46, 0x4f,
+    0x43, 0x00, 0x7a, 0xa5, 0x6c, 0x82, 0x21, 0x88, 0x1a, 0x82, 0x21, 0x00, 0x52, 0x84, 0xa5, 0x00,
+    0x8b, 0x82, 0x79, 0x00, 0xa1, 0x85, 0xa5, 0x04, 0x5b, 0x00, 0x66, 0x6e, 0x6e, 0x83, 0x74, 0x00,
+    0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x03, 0x6e,
+    0x74, 0x74, 0x6e, 0x88, 0x74, 0x8c, 0x4f, 0x84, 0x46, 0x01, 0x4f, 0x47, 0x82, 0x46, 0x02, 0x4f,
+    0x46, 0x46, 0x83, 0x4f, 0x01, 0x46, 0x46, 0x82, 0x4f, 0x00, 0x46, 0x87, 0x4f, 0x09, 0x46, 0x43,
+    0x00, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x03, 0x1c, 0x21, 0x21, 0x52, 0x8f,
+    0xa5, 0x09, 0x5b, 0x00, 0x66, 0x6e, 0x6e, 0x73, 0x6e, 0x74, 0x74, 0x6e, 0x8b, 0x74, 0x00, 0x6e,
+    0x90, 0x74, 0x05, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x8c, 0x4f, 0x01, 0x46, 0x46, 0x8d, 0x45,
+    0x00, 0x46, 0x8d, 0x4f, 0x0a, 0x46, 0x30, 0x00, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x27,
+    0x84, 0x28, 0x05, 0x27, 0x27, 0x1c, 0x21, 0x21, 0x52, 0x82, 0xa5, 0x05, 0x9d, 0x93, 0x93, 0x90,
+    0x9a, 0x9a, 0x86, 0xa5, 0x05, 0x5b, 0x00, 0x66, 0x74, 0x74, 0x6d, 0x82, 0x5c, 0x02, 0x66, 0x6e,
+    0x74, 0x83, 0x6e, 0x82, 0x74, 0x05, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x86, 0x74, 0x01, 0x6e,
+    0x6e, 0x83, 0x74, 0x01, 0x6e, 0x6e, 0x82, 0x74, 0x02, 0x6e, 0x74, 0x74, 0x88, 0x4f, 0x82, 0x46,
+    0x02, 0x4f, 0x46, 0x45, 0x8d, 0x37, 0x01, 0x46, 0x46, 0x8a, 0x4f, 0x0c, 0x47, 0x46, 0x38, 0x2e,
+    0x00, 0x7a, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x28, 0x86, 0x27, 0x03, 0x1c, 0x21, 0x21, 0x52,
+    0x82, 0xa5, 0x00, 0x7a, 0x82, 0x00, 0x02, 0x68, 0x79, 0xa1, 0x85, 0xa5, 0x05, 0x5b, 0x00, 0x66,
+    0x6e, 0x74, 0x5d, 0x82, 0x00, 0x05, 0x55, 0x6e, 0x6e, 0x74, 0x6e, 0x6e, 0x89, 0x74, 0x03, 0x6e,
+    0x74, 0x74, 0x6e, 0x8a, 0x74, 0x01, 0x6e, 0x6e, 0x83, 0x74, 0x8e, 0x45, 0x8d, 0x37, 0x8e, 0x45,
+    0x09, 0x37, 0x2e, 0x00, 0x71, 0xa5, 0x71, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x07, 0x1c, 0x21,
+    0x21, 0x52, 0xa5, 0x9d, 0x7f, 0x6c, 0x82, 0x5b, 0x02, 0x48, 0x50, 0xa1, 0x85, 0xa5, 0x05, 0x5b,
+    0x00, 0x6d, 0x6e, 0x4b, 0x51, 0x82, 0x5b, 0x02, 0x54, 0x4b, 0x66, 0x8c, 0x74, 0x00, 0x6e, 0x93,
+    0x74, 0xac, 0x37, 0x08, 0x1f, 0x00, 0x71, 0xa5, 0x71, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x07,
+    0x1c, 0x21, 0x21, 0x52, 0xa5, 0x8c, 0x00, 0x62, 0x82, 0x86, 0x02, 0x21, 0x21, 0xa1, 0x85, 0xa5,
+    0x05, 0x5b, 0x00, 0x6d, 0x6d, 0x08, 0x33, 0x82, 0x86, 0x02, 0x52, 0x00, 0x5d, 0x86, 0x74, 0x00,
+    0x6e, 0x85, 0x74, 0x00, 0x6e, 0x92, 0x74, 0xac, 0x37, 0x08, 0x2e, 0x00, 0x71, 0xa5, 0x71, 0x21,
+    0x21, 0x24, 0x32, 0x87, 0x27, 0x0e, 0x1c, 0x21, 0x21, 0x52, 0xa5, 0x8c, 0x00, 0x62, 0x86, 0x7f,
+    0x86, 0x6c, 0x6a, 0x6a, 0x7a, 0x84, 0xa5, 0x0d, 0x5b, 0x00, 0x35, 0x41, 0x6a, 0x71, 0x7f, 0x7f,
+    0x86, 0x52, 0x00, 0x5d, 0x6e, 0x6e, 0x9f, 0x74, 0xac, 0x37, 0x08, 0x2e, 0x00, 0x7a, 0xa5, 0x6c,
+    0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x07, 0x1c, 0x21, 0x21, 0x52, 0xa5, 0x90, 0x00, 0x62, 0x83,
+    0x86, 0x02, 0x7e, 0x0a, 0x3f, 0x84, 0xa5, 0x0e, 0x5b, 0x00, 0x01, 0x16, 0x7e, 0x86, 0x86, 0x7f,
+    0x7f, 0x52, 0x00, 0x5d, 0x6e, 0x73, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x96, 0x74, 0x00, 0x6e, 0x82,
+    0x74, 0x8d, 0x37, 0x00, 0x30, 0x8d, 0x1f, 0x8e, 0x37, 0x09, 0x1f, 0x1d, 0x00, 0x7a, 0xa5, 0x6c,
+    0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x07, 0x1c, 0x21, 0x21, 0x52, 0xa5, 0x8c, 0x00, 0x62, 0x82,
+    0x86, 0x03, 0x7f, 0x7f, 0x7a, 0x6a, 0x84, 0x4a, 0x03, 0x16, 0x00, 0x6a, 0x7a, 0x82, 0x7f, 0x0c,
+    0x86, 0x7f, 0x52, 0x00, 0x5d, 0x6e, 0x73, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x92, 0x74, 0x00,
+    0x6e, 0x85, 0x74, 0x8d, 0x37, 0x01, 0x30, 0x1f, 0x88, 0x1e, 0x83, 0x1f, 0x8e, 0x37, 0x09, 0x1f,
+    0x1d, 0x00, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x0e, 0x1c, 0x21, 0x21, 0x52,
+    0xa5, 0x90, 0x00, 0x62, 0x86, 0x86, 0x7f, 0x7f, 0x86, 0x7f, 0x71, 0x86, 0x00, 0x00, 0x7a, 0x83,
+    0x86, 0x06, 0x7f, 0x7f, 0x52, 0x00, 0x5d, 0x6e, 0x73, 0x85, 0x74, 0x83, 0x6e, 0x93, 0x74, 0x01,
+    0x6e, 0x74, 0xaa, 0x1e, 0x0a, 0x1f, 0x1e, 0x1d, 0x00, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32,
+    0x87, 0x27, 0x07, 0x1c, 0x21, 0x21, 0x52, 0xa5, 0x8c, 0x00, 0x62, 0x83, 0x86, 0x0b, 0x7f, 0x7f,
+    0x86, 0x7f, 0x7f, 0x86, 0x7f, 0x86, 0x7f, 0x86, 0x86, 0x7f, 0x84, 0x86, 0x04, 0x52, 0x00, 0x5d,
+    0x74, 0x73, 0x84, 0x74, 0x00, 0x6e, 0x8a, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x88, 0x74,
+    0xab, 0x1e, 0x09, 0x1d, 0x15, 0x00, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x07,
+    0x1c, 0x21, 0x21, 0x4a, 0x9b, 0x87, 0x33, 0x6a, 0x83, 0x86, 0x00, 0x7f, 0x82, 0x86, 0x84, 0x7f,
+    0x85, 0x86, 0x06, 0x7f, 0x86, 0x5b, 0x33, 0x5c, 0x65, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x9b, 0x74,
+    0xaa, 0x1e, 0x00, 0x1d, 0x82, 0x00, 0x06, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27,
+    0x05, 0x1c, 0x21, 0x21, 0x16, 0x01, 0x4a, 0x84, 0x86, 0x01, 0x7f, 0x7f, 0x83, 0x86, 0x02, 0x7f,
+    0x86, 0x7f, 0x87, 0x86, 0x05, 0x7f, 0x86, 0x86, 0x33, 0x08, 0x66, 0x87, 0x74, 0x00, 0x6e, 0x85,
+    0x74, 0x05, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x8a, 0x74, 0xa5, 0x1e, 0x00, 0x1d, 0x82, 0x1c,
+    0x01, 0x15, 0x14, 0x82, 0x00, 0x06, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x22,
+    0x1c, 0x21, 0x21, 0x16, 0x00, 0x4a, 0x86, 0x7f, 0x86, 0x7f, 0x7f, 0x9d, 0x9d, 0x6c, 0x6c, 0x86,
+    0x86, 0x7f, 0x86, 0x7f, 0x86, 0x7f, 0x86, 0x87, 0xa1, 0x96, 0x6a, 0x71, 0x86, 0x86, 0x87, 0x33,
+    0x02, 0x66, 0x6e, 0x84, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x8a, 0x74, 0x04,
+    0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x8e, 0x1e, 0x8d, 0x1d, 0x88, 0x1e, 0x00, 0x0d, 0x87,
+    0x00, 0x06, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27, 0x0e, 0x1c, 0x21, 0x21, 0x16,
+    0x00, 0x4a, 0x86, 0x86, 0x7f, 0x7f, 0x86, 0xaf, 0xaf, 0x21, 0x2a, 0x82, 0x7f, 0x84, 0x86, 0x04,
+    0x8c, 0xb1, 0xaa, 0x01, 0x4a, 0x82, 0x86, 0x03, 0x33, 0x02, 0x66, 0x6e, 0x88, 0x74, 0x02, 0x6e,
+    0x74, 0x6e, 0x92, 0x74, 0x8d, 0x1e, 0x8f, 0x1d, 0x83, 0x1e, 0x00, 0x1d, 0x82, 0x14, 0x00, 0x40,
+    0x83, 0x5b, 0x0a, 0x62, 0x62, 0x4a, 0x00, 0x7a, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27,
+    0x05, 0x1c, 0x21, 0x21, 0x16, 0x00, 0x4a, 0x82, 0x86, 0x12, 0x7f, 0x86, 0x93, 0x93, 0x11, 0x2a,
+    0x86, 0x86, 0x7f, 0x7f, 0x86, 0x6a, 0x5b, 0x7e, 0x86, 0x96, 0x87, 0x00, 0x4a, 0x82, 0x86, 0x02,
+    0x39, 0x02, 0x66, 0x9a, 0x74, 0x00, 0x6e, 0x83, 0x74, 0xa1, 0x1d, 0x00, 0x14, 0x82, 0x00, 0x01,
+    0x62, 0x7f, 0x84, 0x86, 0x08, 0x6c, 0x00, 0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32, 0x87, 0x27,
+    0x05, 0x1c, 0x21, 0x21, 0x16, 0x00, 0x4a, 0x83, 0x86, 0x11, 0x7f, 0x21, 0x00, 0x00, 0x33, 0x86,
+    0x86, 0x7f, 0x7f, 0x86, 0x39, 0x00, 0x7a, 0x7a, 0x07, 0x00, 0x00, 0x4a, 0x82, 0x86, 0x06, 0x39,
+    0x02, 0x66, 0x74, 0x74, 0x6e, 0x6e, 0x83, 0x74, 0x04, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x89, 0x74,
+    0x05, 0x6e, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0xa1, 0x1d, 0x13, 0x14, 0x00, 0x39, 0x6a,
+    0x7a, 0x86, 0x87, 0x7f, 0x4a, 0x3f, 0x3f, 0x33, 0x00, 0x7a, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x32,
+    0x87, 0x27, 0x0e, 0x1c, 0x21, 0x21, 0x16, 0x00, 0x4a, 0x87, 0x99, 0xac, 0xac, 0xab, 0x7c, 0x6c,
+    0x6c, 0x71, 0x83, 0x86, 0x08, 0x7f, 0x71, 0x6a, 0x7f, 0x7f, 0x6c, 0x6a, 0x6a, 0x8e, 0x82, 0xac,
+    0x04, 0x49, 0x02, 0x66, 0x74, 0x6e, 0x93, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x03, 0x6e, 0x74, 0x6e,
+    0x74, 0xa1, 0x1d, 0x08, 0x14, 0x00, 0x52, 0x7f, 0x86, 0x87, 0x86, 0x7f, 0x12, 0x83, 0x00, 0x06,
+    0x71, 0xa5, 0x6c, 0x21, 0x21, 0x24, 0x31, 0x86, 0x27, 0x08, 0x32, 0x1c, 0x21, 0x17, 0x16, 0x00,
+    0x4a, 0x7f, 0xa9, 0x82, 0xb0, 0x01, 0x8f, 0x7f, 0x83, 0x86, 0x00, 0x7f, 0x85, 0x86, 0x82, 0x7f,
+    0x00, 0x99, 0x82, 0xb0, 0x02, 0x69, 0x02, 0x66, 0x91, 0x74, 0x01, 0x6e, 0x6e, 0x8b, 0x74, 0x8d,
+    0x1d, 0x01, 0x15, 0x15, 0x8c, 0x10, 0x84, 0x1d, 0x02, 0x15, 0x15, 0x1a, 0x84, 0x21, 0x07, 0x01,
+    0x02, 0x0e, 0x0d, 0x00, 0x7a, 0xa5, 0x6c, 0x82, 0x21, 0x88, 0x1a, 0x82, 0x21, 0x04, 0x16, 0x00,
+    0x4a, 0x86, 0xa9, 0x82, 0xb0, 0x10, 0x8f, 0x7e, 0x2a, 0x39, 0x7f, 0x86, 0x86, 0x5b, 0x21, 0x71,
+    0x86, 0x86, 0x7e, 0x2a, 0x3f, 0x7f, 0x99, 0x82, 0xb0, 0x03, 0x69, 0x02, 0x66, 0x6e, 0x83, 0x74,
+    0x01, 0x6e, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x92, 0x74, 0x8d, 0x1d, 0x00, 0x15, 0x82, 0x10, 0x00,
+    0x0f, 0x82, 0x10, 0x00, 0x0f, 0x82, 0x10, 0x82, 0x0f, 0x85, 0x1d, 0x01, 0x1c, 0x0e, 0x84, 0x01,
+    0x07, 0x02, 0x03, 0x0f, 0x0e, 0x00, 0x7a, 0xa5, 0x6c, 0x86, 0x21, 0x01, 0x29, 0x29, 0x84, 0x21,
+    0x05, 0x33, 0x33, 0x21, 0x52, 0x7e, 0xa4, 0x82, 0xae, 0x03, 0x8f, 0x7e, 0x0a, 0x2a, 0x82, 0x7e,
+    0x0f, 0x52, 0x00, 0x6a, 0x7e, 0x7e, 0x7a, 0x07, 0x33, 0x7f, 0x99, 0xae, 0xad, 0xad, 0x5a, 0x0c,
+    0x66, 0x84, 0x74, 0x00, 0x6e, 0x90, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x85, 0x74, 0x88, 0x0f, 0x85,
+    0x10, 0x8b, 0x0f, 0x03, 0x14, 0x0f, 0x10, 0x10, 0x85, 0x0f, 0x03, 0x14, 0x0f, 0x0f, 0x14, 0x82,
+    0x0f, 0x05, 0x10, 0x0e, 0x00, 0x7a, 0xa5, 0x6c, 0x85, 0x21, 0x02, 0x3e, 0x70, 0x50, 0x83, 0x21,
+    0x00, 0x16, 0x82, 0xa1, 0x02, 0x8c, 0x0a, 0x62, 0x83, 0x86, 0x02, 0x7e, 0x0a, 0x01, 0x82, 0x0a,
+    0x02, 0x06, 0x00, 0x07, 0x82, 0x0a, 0x01, 0x00, 0x33, 0x82, 0x86, 0x07, 0x52, 0x20, 0x5c, 0x6e,
+    0x73, 0x73, 0x74, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x04, 0x6e, 0x6e, 0x74, 0x74, 0x6e,
+    0x82, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x9f, 0x0f, 0x00, 0x14, 0x8b, 0x0f, 0x04, 0x0e, 0x00, 0x6a,
+    0x96, 0x71, 0x85, 0x4a, 0x02, 0x5b, 0x79, 0x5b, 0x84, 0x4a, 0x82, 0xa5, 0x09, 0x93, 0x3f, 0x62,
+    0x71, 0x7e, 0x7f, 0x7f, 0x7e, 0x33, 0x2a, 0x82, 0x33, 0x84, 0x2a, 0x09, 0x33, 0x2a, 0x4a, 0x86,
+    0x7e, 0x71, 0x4a, 0x23, 0x5d, 0x74, 0x82, 0x73, 0x04, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x87, 0x74,
+    0x00, 0x6e, 0x8e, 0x74, 0x00, 0x6e, 0xac, 0x0f, 0x00, 0x0d, 0x82, 0x00, 0x00, 0x8c, 0x92, 0xa5,
+    0x02, 0x7a, 0x00, 0x6c, 0x8a, 0x86, 0x08, 0x87, 0x86, 0x86, 0x87, 0x86, 0x86, 0x62, 0x00, 0x55,
+    0x83, 0x74, 0x08, 0x73, 0x73, 0x74, 0x73, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x96, 0x74, 0x8d, 0x0f,
+    0x00, 0x2c, 0x8d, 0x43, 0x00, 0x1d, 0x8c, 0x0f, 0x06, 0x15, 0x43, 0x36, 0x00, 0x2a, 0x4a, 0x7a,
+    0x92, 0x8c, 0x02, 0x62, 0x00, 0x52, 0x89, 0x6a, 0x00, 0x63, 0x85, 0x6a, 0x06, 0x53, 0x3b, 0x5d,
+    0x73, 0x74, 0x74, 0x73, 0x84, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x91,
+    0x74, 0x00, 0x6e, 0x8d, 0x0f, 0x01, 0x43, 0x6f, 0x8a, 0x6e, 0x02, 0x6f, 0x6f, 0x2e, 0x8c, 0x0f,
+    0x06, 0x25, 0x6e, 0x5d, 0x00, 0x52, 0x86, 0x4a, 0xa6, 0x00, 0x06, 0x3b, 0x74, 0x73, 0x73, 0x74,
+    0x74, 0x73, 0x82, 0x6e, 0x0d, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e,
+    0x74, 0x74, 0x6e, 0x86, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e, 0x83, 0x74, 0x8d, 0x56, 0x02, 0x5d,
+    0x74, 0x74, 0x86, 0x6e, 0x00, 0x74, 0x83, 0x6e, 0x00, 0x5d, 0x87, 0x56, 0x12, 0x64, 0x72, 0x5c,
+    0x56, 0x56, 0x4f, 0x6e, 0x5d, 0x00, 0x52, 0x86, 0x6c, 0x62, 0x16, 0x02, 0x4b, 0x3c, 0x00, 0x2a,
+    0x82, 0x62, 0x02, 0x33, 0x00, 0x3c, 0x89, 0x55, 0x10, 0x0b, 0x0a, 0x5b, 0x62, 0x62, 0x3f, 0x00,
+    0x34, 0x55, 0x22, 0x00, 0x52, 0x62, 0x62, 0x52, 0x00, 0x3b, 0x82, 0x74, 0x82, 0x6e, 0x8d, 0x74,
+    0x00, 0x6e, 0x8e, 0x74, 0x01, 0x6e, 0x74, 0x82, 0x6e, 0x90, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x03,
+    0x6e, 0x74, 0x6e, 0x6e, 0x85, 0x74, 0x04, 0x6e, 0x74, 0x92, 0x9c, 0x82, 0x82, 0x74, 0x03, 0x6e,
+    0x5d, 0x00, 0x52, 0x82, 0x86, 0x0c, 0x33, 0x08, 0x6d, 0x65, 0x00, 0x3f, 0x87, 0x86, 0x87, 0x4a,
+    0x01, 0x65, 0x73, 0x86, 0x74, 0x03, 0x73, 0x6e, 0x18, 0x11, 0x82, 0x7f, 0x0d, 0x6a, 0x00, 0x55,
+    0x74, 0x34, 0x00, 0x7a, 0x7f, 0x86, 0x71, 0x00, 0x3b, 0x74, 0x6e, 0x85, 0x74, 0x01, 0x6e, 0x6e,
+    0x87, 0x74, 0x00, 0x6e, 0x89, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x02, 0x6e,
+    0x74, 0x73, 0x84, 0x6e, 0x99, 0x74, 0x16, 0x75, 0x94, 0x89, 0x74, 0x81, 0x82, 0x75, 0x74, 0x94,
+    0x8d, 0x74, 0x5d, 0x00, 0x21, 0x39, 0x39, 0x3f, 0x54, 0x5d, 0x6e, 0x6e, 0x5c, 0x54, 0x82, 0x39,
+    0x02, 0x16, 0x01, 0x65, 0x82, 0x6e, 0x1d, 0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x5d, 0x5c,
+    0x3a, 0x39, 0x39, 0x2a, 0x00, 0x55, 0x74, 0x65, 0x5d, 0x3a, 0x39, 0x39, 0x33, 0x00, 0x3b, 0x74,
+    0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x9f, 0x74, 0x07, 0x74, 0x6e, 0x73, 0x74, 0x73, 0x74, 0x74, 0x6e,
+    0x87, 0x74, 0x01, 0x6e, 0x6e, 0x8f, 0x74, 0x0b, 0x82, 0x9c, 0x8d, 0x74, 0x73, 0x6e, 0x6e, 0x74,
+    0x98, 0x97, 0x74, 0x5c, 0x84, 0x00, 0x00, 0x65, 0x83, 0x74, 0x00, 0x5c, 0x83, 0x00, 0x02, 0x01,
+    0x65, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x01, 0x6d, 0x08, 0x83, 0x00, 0x04, 0x55, 0x73,
+    0x73, 0x74, 0x18, 0x83, 0x00, 0x02, 0x3b, 0x6e, 0x6e, 0x84, 0x74, 0x03, 0x6e, 0x74, 0x74, 0x6e,
+    0x9a, 0x74, 0x03, 0x74, 0x6e, 0x73, 0x74, 0x82, 0x73, 0x01, 0x74, 0x6e, 0x84, 0x73, 0x04, 0x6e,
+    0x74, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x0b,
+    0x75, 0x75, 0x74, 0x73, 0x74, 0x73, 0x74, 0x75, 0x75, 0x6e, 0x6e, 0x6d, 0x83, 0x66, 0x05, 0x6e,
+    0x6e, 0x74, 0x6e, 0x74, 0x73, 0x84, 0x6d, 0x0c, 0x73, 0x74, 0x73, 0x6e, 0x74, 0x73, 0x73, 0x6e,
+    0x73, 0x6e, 0x73, 0x73, 0x6e, 0x84, 0x6d, 0x03, 0x6e, 0x6e, 0x74, 0x6e, 0x85, 0x6d, 0x06, 0x74,
+    0x74, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x85, 0x74, 0x84, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x8e, 0x74,
+    0x84, 0x73, 0x0c, 0x74, 0x73, 0x74, 0x6e, 0x74, 0x74, 0x73, 0x6e, 0x74, 0x73, 0x6e, 0x73, 0x74,
+    0x82, 0x73, 0x08, 0x74, 0x73, 0x73, 0x6e, 0x73, 0x6e, 0x6e, 0x74, 0x6e, 0x82, 0x74, 0x0d, 0x75,
+    0x75, 0x6e, 0x73, 0x6e, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74, 0x75, 0x75, 0x74, 0x84, 0x6e, 0x02,
+    0x74, 0x74, 0x6e, 0x85, 0x74, 0x06, 0x73, 0x73, 0x6e, 0x73, 0x74, 0x73, 0x74, 0x83, 0x73, 0x01,
+    0x74, 0x6e, 0x84, 0x74, 0x0c, 0x6e, 0x74, 0x74, 0x73, 0x6e, 0x6e, 0x73, 0x6e, 0x73, 0x73, 0x74,
+    0x73, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x07, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e,
+    0x6e, 0x82, 0x74, 0x00, 0x6e, 0x8d, 0x74, 0x01, 0x74, 0x6e, 0x82, 0x73, 0x02, 0x74, 0x73, 0x6e,
+    0x82, 0x73, 0x00, 0x74, 0x82, 0x73, 0x04, 0x74, 0x6e, 0x73, 0x73, 0x6e, 0x84, 0x73, 0x00, 0x74,
+    0x85, 0x73, 0x05, 0x75, 0x98, 0x94, 0x74, 0x74, 0x6e, 0x83, 0x73, 0x09, 0x74, 0x75, 0x98, 0x94,
+    0x74, 0x74, 0x6e, 0x74, 0x73, 0x6e, 0x82, 0x74, 0x02, 0x6e, 0x74, 0x74, 0x82, 0x6e, 0x00, 0x74,
+    0x8a, 0x73, 0x01, 0x74, 0x6e, 0x82, 0x74, 0x08, 0x6e, 0x74, 0x74, 0x73, 0x73, 0x6e, 0x74, 0x73,
+    0x74, 0x83, 0x73, 0x05, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x9e, 0x74, 0x02, 0x74, 0x6e, 0x74,
+    0x82, 0x73, 0x07, 0x74, 0x74, 0x6e, 0x73, 0x6e, 0x74, 0x6e, 0x6e, 0x82, 0x73, 0x00, 0x6e, 0x89,
+    0x73, 0x00, 0x74, 0x82, 0x73, 0x06, 0x75, 0x94, 0x92, 0x73, 0x73, 0x6e, 0x74, 0x82, 0x73, 0x04,
+    0x6e, 0x75, 0x95, 0x8d, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x6e, 0x74,
+    0x82, 0x73, 0x05, 0x74, 0x6e, 0x6e, 0x74, 0x73, 0x74, 0x82, 0x73, 0x09, 0x74, 0x73, 0x73, 0x74,
+    0x6e, 0x74, 0x73, 0x74, 0x73, 0x74, 0x85, 0x73, 0x04, 0x6e, 0x74, 0x6e, 0x73, 0x6e, 0x85, 0x74,
+    0x01, 0x6e, 0x6e, 0x91, 0x74, 0x00, 0x6e, 0x88, 0x74, 0x01, 0x74, 0x6e, 0x86, 0x73, 0x00, 0x74,
+    0x85, 0x73, 0x09, 0x74, 0x6e, 0x74, 0x6e, 0x73, 0x74, 0x73, 0x6e, 0x6e, 0x74, 0x83, 0x73, 0x10,
+    0x74, 0x73, 0x73, 0x74, 0x74, 0x73, 0x74, 0x74, 0x73, 0x6e, 0x73, 0x6e, 0x74, 0x73, 0x74, 0x74,
+    0x6e, 0x90, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x85, 0x74,
+    0x03, 0x6e, 0x74, 0x6e, 0x6e, 0x8e, 0x74, 0x00, 0x6e, 0x99, 0x74, 0x00, 0x74, 0x88, 0x73, 0x03,
+    0x74, 0x73, 0x73, 0x74, 0x82, 0x73, 0x0b, 0x6e, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74, 0x73, 0x74,
+    0x73, 0x74, 0x6e, 0x83, 0x73, 0x04, 0x74, 0x75, 0x89, 0x81, 0x6e, 0x82, 0x73, 0x08, 0x74, 0x89,
+    0x82, 0x6e, 0x73, 0x6e, 0x74, 0x6e, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0x91, 0x74, 0x05, 0x6e, 0x74,
+    0x6e, 0x74, 0x74, 0x6e, 0x89, 0x74, 0x01, 0x6e, 0x6e, 0x86, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x82,
+    0x74, 0x08, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x6e, 0x8b, 0x74, 0x08, 0x74, 0x73,
+    0x6e, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74, 0x89, 0x73, 0x02, 0x6e, 0x73, 0x74, 0x87, 0x73, 0x11,
+    0x6e, 0x74, 0x6e, 0x74, 0x81, 0x9e, 0x8d, 0x74, 0x74, 0x6e, 0x73, 0x75, 0x9c, 0x9c, 0x6e, 0x74,
+    0x74, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0x84, 0x74, 0x82, 0x6e, 0x8b, 0x74, 0x02, 0x6e, 0x74,
+    0x6e, 0x93, 0x74, 0x00, 0x6e, 0x9e, 0x74, 0x02, 0x74, 0x6e, 0x74, 0x82, 0x73, 0x03, 0x74, 0x74,
+    0x73, 0x6e, 0x83, 0x73, 0x04, 0x74, 0x73, 0x6e, 0x74, 0x6e, 0x84, 0x73, 0x00, 0x6e, 0x82, 0x73,
+    0x12, 0x74, 0x73, 0x74, 0x73, 0x73, 0x74, 0x75, 0x89, 0x82, 0x73, 0x82, 0x92, 0x75, 0x74, 0x89,
+    0x89, 0x6e, 0x73, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x00, 0x6e,
+    0x95, 0x74, 0x00, 0x6e, 0xa8, 0x74, 0x82, 0x73, 0x00, 0x74, 0x83, 0x73, 0x02, 0x74, 0x73, 0x6e,
+    0x85, 0x73, 0x17, 0x6e, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74, 0x73, 0x74, 0x73, 0x73, 0x6e, 0x73,
+    0x74, 0x73, 0x73, 0x74, 0x6e, 0x6f, 0x6e, 0x6e, 0x8d, 0x9c, 0x81, 0x82, 0x74, 0x02, 0x73, 0x6e,
+    0x6e, 0x82, 0x74, 0x03, 0x6e, 0x74, 0x6e, 0x6e, 0x91, 0x74, 0x00, 0x6e, 0x9b, 0x74, 0x00, 0x6e,
+    0x99, 0x74, 0x00, 0x6e, 0x82, 0x73, 0x0c, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x74, 0x73, 0x73,
+    0x74, 0x6e, 0x73, 0x74, 0x83, 0x73, 0x0d, 0x74, 0x6e, 0x73, 0x74, 0x6e, 0x74, 0x73, 0x73, 0x74,
+    0x73, 0x74, 0x73, 0x6e, 0x74, 0x82, 0x73, 0x03, 0x75, 0x82, 0x75, 0x74, 0x83, 0x73, 0x88, 0x74,
+    0x03, 0x6e, 0x74, 0x74, 0x6e, 0x84, 0x74, 0x05, 0x6e, 0x74, 0x6e, 0x6e, 0x74, 0x6e, 0x9e, 0x74,
+    0x03, 0x6e, 0x74, 0x74, 0x6e, 0x91, 0x74, 0x00, 0x6e, 0x83, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x86,
+    0x73, 0x00, 0x6e, 0x85, 0x73, 0x02, 0x6e, 0x73, 0x74, 0x82, 0x73, 0x06, 0x6e, 0x73, 0x73, 0x6e,
+    0x74, 0x73, 0x6e, 0x85, 0x73, 0x08, 0x74, 0x73, 0x73, 0x6e, 0x74, 0x74, 0x73, 0x74, 0x6e, 0x82,
+    0x74, 0x83, 0x6e, 0x82, 0x74, 0x07, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x84, 0x74,
+    0x83, 0x6e, 0xb5, 0x74, 0x01, 0x6e, 0x74, 0x03, 0x74, 0x73, 0x73, 0x74, 0x85, 0x73, 0x08, 0x6e,
+    0x74, 0x6e, 0x73, 0x73, 0x74, 0x74, 0x73, 0x6e, 0x83, 0x73, 0x00, 0x6e, 0x82, 0x73, 0x06, 0x74,
+    0x6e, 0x74, 0x73, 0x73, 0x74, 0x6e, 0x82, 0x73, 0x01, 0x6e, 0x74, 0x82, 0x73, 0x04, 0x74, 0x73,
+    0x74, 0x74, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x8e, 0x74, 0x00, 0x6e, 0x82,
+    0x74, 0x00, 0x6e, 0x9f, 0x74, 0x82, 0x6e, 0x8f, 0x74, 0x01, 0x6e, 0x74, 0x82, 0x73, 0x05, 0x74,
+    0x6e, 0x73, 0x74, 0x73, 0x74, 0x87, 0x73, 0x01, 0x74, 0x6e, 0x83, 0x73, 0x00, 0x6e, 0x8a, 0x73,
+    0x00, 0x74, 0x83, 0x73, 0x00, 0x74, 0x82, 0x73, 0x82, 0x74, 0x00, 0x6e, 0x85, 0x74, 0x00, 0x6e,
+    0x82, 0x74, 0x00, 0x6e, 0x90, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x6e, 0x99, 0x74, 0x03,
+    0x75, 0x75, 0x74, 0x74, 0x82, 0x6e, 0x8a, 0x74, 0x04, 0x6e, 0x74, 0x73, 0x73, 0x74, 0x82, 0x73,
+    0x03, 0x6e, 0x73, 0x6e, 0x74, 0x82, 0x73, 0x06, 0x74, 0x73, 0x6e, 0x74, 0x73, 0x73, 0x6e, 0x83,
+    0x73, 0x01, 0x6e, 0x74, 0x83, 0x73, 0x04, 0x74, 0x73, 0x73, 0x6e, 0x74, 0x85, 0x73, 0x05, 0x74,
+    0x73, 0x73, 0x74, 0x6e, 0x6e, 0x82, 0x74, 0x00, 0x6e, 0x86, 0x74, 0x8c, 0x6e, 0x88, 0x74, 0x00,
+    0x6e, 0x82, 0x74, 0x00, 0x6e, 0x95, 0x74, 0x08, 0x82, 0x9c, 0x8d, 0x6e, 0x74, 0x6e, 0x74, 0x74,
+    0x6e, 0x89, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x85, 0x73, 0x00, 0x74, 0x86, 0x73, 0x03, 0x74, 0x6e,
+    0x73, 0x74, 0x85, 0x73, 0x03, 0x74, 0x73, 0x73, 0x74, 0x83, 0x73, 0x00, 0x74, 0x82, 0x73, 0x03,
+    0x74, 0x73, 0x73, 0x74, 0x82, 0x73, 0x04, 0x6e, 0x6e, 0x74, 0x6e, 0x6e, 0x83, 0x74, 0x03, 0x6e,
+    0x74, 0x6e, 0x66, 0x8f, 0x5d, 0x01, 0x6e, 0x74, 0x82, 0x6e, 0x84, 0x74, 0x00, 0x6e, 0x86, 0x74,
+    0x00, 0x6e, 0x86, 0x74, 0x00, 0x6e, 0x84, 0x74, 0x04, 0x6e, 0x6e, 0x82, 0x94, 0x89, 0x8f, 0x74,
+    0x01, 0x74, 0x6e, 0x82, 0x74, 0x08, 0x6e, 0x74, 0x73, 0x74, 0x73, 0x74, 0x6e, 0x6e, 0x74, 0x86,
+    0x73, 0x01, 0x74, 0x6e, 0x86, 0x73, 0x10, 0x74, 0x73, 0x74, 0x73, 0x73, 0x74, 0x73, 0x73, 0x74,
+    0x6e, 0x74, 0x73, 0x74, 0x73, 0x73, 0x74, 0x6e, 0x86, 0x74, 0x04, 0x6e, 0x6e, 0x74, 0x74, 0x55,
+    0x8e, 0x04, 0x05, 0x0e, 0x6e, 0x6f, 0x73, 0x6e, 0x6e, 0x83, 0x74, 0x02, 0x6e, 0x74, 0x6e, 0x82,
+    0x74, 0x01, 0x6e, 0x74, 0x8f, 0x6e, 0x05, 0x74, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x89, 0x74, 0x03,
+    0x6e, 0x6f, 0x6e, 0x6f, 0x82, 0x74, 0x10, 0x6e, 0x74, 0x74, 0x73, 0x74, 0x6e, 0x74, 0x73, 0x74,
+    0x74, 0x73, 0x73, 0x74, 0x73, 0x74, 0x74, 0x6e, 0x82, 0x73, 0x0a, 0x74, 0x6e, 0x74, 0x73, 0x74,
+    0x73, 0x73, 0x74, 0x73, 0x6e, 0x74, 0x82, 0x73, 0x02, 0x74, 0x6e, 0x74, 0x82, 0x73, 0x02, 0x74,
+    0x74, 0x73, 0x85, 0x74, 0x00, 0x6e, 0x84, 0x56, 0x00, 0x36, 0x8e, 0x04, 0x07, 0x09, 0x56, 0x56,
+    0x73, 0x6e, 0x74, 0x74, 0x6e, 0x84, 0x74, 0x05, 0x6e, 0x74, 0x6e, 0x74, 0x74, 0x6e, 0x8e, 0x5d,
+    0x01, 0x6e, 0x6e, 0x87, 0x74, 0x06, 0x6e, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x5d, 0x82, 0x56, 0x8a,
+    0x74, 0x00, 0x6e, 0x85, 0x74, 0x00, 0x6e, 0x89, 0x74, 0x82, 0x6e, 0x93, 0x74, 0x01, 0x6e, 0x0e,
+    0x95, 0x04, 0x02, 0x25, 0x73, 0x6e, 0x88, 0x74, 0x00, 0x6e, 0x82, 0x74, 0x01, 0x6e, 0x37, 0x8c,
+    0x1e, 0x06, 0x2e, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x6e, 0x89, 0x74, 0x00, 0x3c, 0x82, 0x04, 0x87,
+    0x74, 0x83, 0x6e, 0x02, 0x74, 0x74, 0x5f, 0x8b, 0x45, 0x01, 0x5f, 0x6e, 0x86, 0x74, 0x00, 0x6e,
+    0x85, 0x74, 0x02, 0x6e, 0x6e, 0x5f, 0x86, 0x3c, 0x00, 0x09, 0x95, 0x04, 0x00, 0x14, 0x82, 0x3c,
+    0x09, 0x5d, 0x6e, 0x6e, 0x74, 0x74, 0x6e, 0x74, 0x6e, 0x74, 0x5f, 0x82, 0x45, 0x00, 0x2e, 0x8c,
+    0x1e, 0x00, 0x1f, 0x82, 0x45, 0x09, 0x5d, 0x74, 0x74, 0x6e, 0x89, 0x8d, 0x75, 0x6e, 0x74, 0x65,
+    0x82, 0x3c, 0x00, 0x1b, 0x82, 0x04, 0x86, 0x74, 0x02, 0x6e, 0x6e, 0x74, 0x83, 0x6e, 0x00, 0x5d,
+    0x8a, 0x1e, 0x01, 0x1f, 0x4f, 0x83, 0x6e, 0x87, 0x74, 0x84, 0x6e, 0x00, 0x5d, 0xa1, 0x04, 0x00,
+    0x55, 0x87, 0x6e, 0x03, 0x5d, 0x1e, 0x1f, 0x26, 0x91, 0x1e, 0x09, 0x45, 0x74, 0x74, 0x6e, 0x97,
+    0x9c, 0x75, 0x6e, 0x73, 0x5d, 0x86, 0x04, 0x88, 0x74, 0x00, 0x3d, 0x82, 0x30, 0x01, 0x43, 0x30,
+    0x8b, 0x1e, 0x06, 0x30, 0x43, 0x43, 0x3d, 0x67, 0x74, 0x74, 0x82, 0x6e, 0x03, 0x74, 0x74, 0x6e,
+    0x43, 0x83, 0x25, 0x00, 0x1b, 0xa1, 0x04, 0x02, 0x1b, 0x2c, 0x3c, 0x85, 0x43, 0x01, 0x2e, 0x1f,
+    0x92, 0x1e, 0x01, 0x26, 0x2e, 0x82, 0x43, 0x05, 0x74, 0x81, 0x36, 0x25, 0x25, 0x1b, 0x86, 0x04,
+    0x88, 0x6e, 0x00, 0x30, 0x91, 0x1e, 0x03, 0x26, 0x26, 0x1f, 0x67, 0x87, 0x6e, 0x00, 0x25, 0xa6,
+    0x04, 0x02, 0x05, 0x04, 0x1d, 0x86, 0x1e, 0x01, 0x1f, 0x1f, 0x92, 0x1e, 0x00, 0x26, 0x82, 0x1e,
+    0x03, 0x5f, 0x67, 0x0f, 0x05, 0x88, 0x04, 0x01, 0x14, 0x15, 0x86, 0x2e, 0x00, 0x1f, 0x94, 0x1e,
+    0x84, 0x2e, 0x04, 0x4c, 0x6f, 0x43, 0x14, 0x09, 0xa4, 0x04, 0x00, 0x0f, 0xa3, 0x1e, 0x02, 0x2e,
+    0x2e, 0x09, 0x89, 0x04, 0x01, 0x09, 0x0f, 0xa1, 0x1e, 0x03, 0x45, 0x67, 0x2e, 0x09, 0x9e, 0x04,
+    0x86, 0x09, 0x00, 0x10, 0x82, 0x1e, 0x00, 0x26, 0x87, 0x1e, 0x00, 0x1f, 0x87, 0x1e, 0x03, 0x1f,
+    0x1e, 0x1e, 0x1f, 0x8c, 0x1e, 0x82, 0x09, 0x00, 0x05, 0x86, 0x04, 0xa3, 0x1e, 0x00, 0x26, 0x82,
+    0x1f, 0x00, 0x0f, 0x9d, 0x04, 0x00, 0x1d, 0x84, 0x1e, 0x00, 0x26, 0xa8, 0x1e, 0x01, 0x1f, 0x1d,
+    0x86, 0x04, 0xa7, 0x1e, 0x00, 0x10, 0x83, 0x0f, 0x00, 0x09, 0x96, 0x04, 0x02, 0x09, 0x0f, 0x1d,
+    0xb0, 0x1e, 0x82, 0x0f, 0x00, 0x09, 0x82, 0x04, 0xac, 0x1e, 0x00, 0x1d, 0x96, 0x04, 0x03, 0x15,
+    0x1e, 0x1f, 0x1f, 0xb2, 0x1e, 0x00, 0x0f, 0x82, 0x04, 0xaa, 0x1e, 0x02, 0x1f, 0x1f, 0x1e, 0x82,
+    0x15, 0x00, 0x09, 0x8d, 0x04, 0x84, 0x15, 0x00, 0x1d, 0xb5, 0x1e, 0x00, 0x1d, 0x82, 0x15, 0xb0,
+    0x1e, 0x00, 0x0f, 0x8d, 0x04, 0x04, 0x1e, 0x1e, 0x26, 0x1e, 0x26, 0xba, 0x1e, 0xb0, 0x1e, 0x8e,
+    0x1d, 0xbf, 0x1e, 0xbe, 0x1e, 0x00, 0x26, 0xbf, 0x1e, 0xff, 0x1e, 0xf9, 0x1e, 0x05, 0x1f, 0x1f,
+    0x2e, 0x2e, 0x2d, 0x2e, 0xf9, 0x1e, 0x00, 0x59, 0x84, 0x7b, 0x95, 0x2f, 0x82, 0x1f, 0x85, 0x1e,
+    0x01, 0x1f, 0x1f, 0xc9, 0x1e, 0x00, 0x1f, 0x8d, 0x2f, 0x00, 0x61, 0x84, 0x8a, 0x8c, 0x8a, 0x00,
+    0x84, 0x84, 0x8a, 0x03, 0x84, 0x84, 0x7b, 0x2e, 0x82, 0x26, 0xd0, 0x1e, 0x01, 0x2f, 0x84, 0x92,
+    0x8a, 0x92, 0x8a, 0x03, 0x84, 0x84, 0x7b, 0x4d, 0x92, 0x4e, 0x03, 0x58, 0x4e, 0x4e, 0x44, 0xb0,
+    0x1e, 0x00, 0x44, 0x8a, 0x4e, 0x01, 0x57, 0x84, 0x92, 0x8a, 0x92, 0x8a, 0x00, 0x84, 0x8e, 0x8a,
+    0x00, 0x84, 0x88, 0x8a, 0x01, 0x76, 0x1f, 0x82, 0x1e, 0x84, 0x1f, 0x00, 0x1e, 0x8a, 0x1f, 0x01,
+    0x1e, 0x1e, 0x86, 0x1f, 0x82, 0x1e, 0x83, 0x1f, 0x00, 0x1e, 0x84, 0x1f, 0x00, 0x1e, 0x82, 0x1f,
+    0x02, 0x1e, 0x1f, 0x7b, 0x9f, 0x8a, 0xac, 0x8a, 0x03, 0x7b, 0x59, 0x61, 0x61, 0x82, 0x59, 0x05,
+    0x61, 0x59, 0x61, 0x59, 0x61, 0x61, 0x83, 0x59, 0x0c, 0x61, 0x59, 0x61, 0x59, 0x61, 0x61, 0x59,
+    0x61, 0x59, 0x61, 0x59, 0x59, 0x61, 0x85, 0x59, 0x0e, 0x61, 0x59, 0x61, 0x61, 0x59, 0x61, 0x59,
+    0x59, 0x61, 0x59, 0x61, 0x59, 0x61, 0x61, 0x7b, 0x94, 0x8a, 0x00, 0x84, 0x89, 0x8a, 0xae, 0x8a,
+    0x88, 0x84, 0x00, 0x8a, 0x84, 0x84, 0x00, 0x8a, 0x88, 0x84, 0x00, 0x8a, 0x83, 0x84, 0x82, 0x8a,
+    0x88, 0x84, 0x02, 0x8a, 0x84, 0x84, 0x83, 0x8a, 0x00, 0x84, 0x9e, 0x8a, 0xb4, 0x8a, 0x00, 0x84,
+    0x86, 0x8a, 0x00, 0x84, 0xc1, 0x8a, 0xff, 0x8a, 0xf1, 0x8a, 0x00, 0x84, 0x8c, 0x8a, 0x01, 0x8a,
+    0x84, 0x83, 0x8a, 0x00, 0x84, 0x8e, 0x8a, 0x00, 0x84, 0x8a, 0x8a, 0x00, 0x84, 0xdc, 0x8a,
+};
+
+// 182 colors, 3912 bytes (raw: 32768)
+static constexpr uint16_t cat_pal_3[] = {
+    0x0000, 0x0861, 0x0881, 0x08e1, 0x09a1, 0x09c1, 0x10a2, 0x11a1, 0x11e2, 0x18c2, 0x1923, 0x1942,
+    0x19a3, 0x19e4, 0x1a23, 0x1a43, 0x20e3, 0x2124, 0x2144, 0x2223, 0x22a4, 0x2965, 0x29a3, 0x29e3,
+    0x29e5, 0x2a25, 0x2a43, 0x2aa4, 0x2ae5, 0x2b05, 0x2b65, 0x30c3, 0x3164, 0x3166, 0x3186, 0x31e4,
+    0x31e5, 0x3265, 0x32a4, 0x32e4, 0x32e5, 0x3303, 0x34a6, 0x34c6, 0x39c7, 0x3a05, 0x3a24, 0x3a64,
+    0x3b23, 0x3b63, 0x3b67, 0x3c87, 0x4146, 0x4225, 0x4228, 0x42a6, 0x42e4, 0x4305, 0x4383, 0x43a8,
+    0x4a66, 0x4a68, 0x4aa9, 0x4ae7, 0x4be7, 0x5166, 0x5267, 0x52aa, 0x52e7, 0x5306, 0x5367, 0x53a7,
+    0x53a8, 0x53e8, 0x5428, 0x5926, 0x5ae9, 0x5aeb, 0x5b27, 0x5b28, 0x5b47, 0x5b68, 0x5b87, 0x5c25,
+    0x5c28, 0x6106, 0x632c, 0x634c, 0x63a9, 0x63c7, 0x63e8, 0x6408, 0x6425, 0x6462, 0x6b08, 0x6b49,
+    0x6b6d, 0x6ba9, 0x6be9, 0x6c2a, 0x6c6a, 0x6ca2, 0x738e, 0x742a, 0x746a, 0x748a, 0x7805, 0x78c7,
+    0x7b6e, 0x7baf, 0x7bcf, 0x7beb, 0x7c0c, 0x7caa, 0x7ceb, 0x80c7, 0x83ef, 0x8410, 0x84ab, 0x84ca,
+    0x84cb, 0x8503, 0x850b, 0x8826, 0x8846, 0x89c9, 0x8b8c, 0x8c71, 0x8d63, 0x946d, 0x94ad, 0x94b2,
+    0x94d3, 0x94ed, 0x952c, 0x954c, 0x95a1, 0x95c1, 0x9b8f, 0x9bef, 0x9cb3, 0x9cd3, 0x9cee, 0x9d6d,
+    0x9dc1, 0xa410, 0xa52e, 0xa534, 0xa5ae, 0xac52, 0xac92, 0xad6e, 0xad75, 0xadae, 0xb596, 0xb5af,
+    0xbcb3, 0xbd76, 0xbdb7, 0xbdf0, 0xbdf7, 0xbe10, 0xbe11, 0xc5f0, 0xc638, 0xc671, 0xc692, 0xccd3,
+    0xce59, 0xceb3, 0xcf34, 0xcf55, 0xd4f3, 0xd639, 0xd69a, 0xdcb3, 0xe493, 0xec93, 0xf4d4, 0xf79e,
+    0xfcb2, 0xffff,
+};
+static constexpr uint16_t cat_row_3[] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 39,
+    53, 67, 83, 101, 121, 142, 163, 184, 215, 225, 260, 294, 333, 372, 410, 424,
+    441, 462, 470, 479, 491, 506, 522, 534, 536, 551, 567, 579, 591, 607, 629, 654,
+    681, 691, 705, 719, 755, 799, 843, 897, 942, 997, 1060, 1112, 1158, 1205, 1251, 1307,
+    1361, 1404, 1453, 1504, 1562, 1628, 1719, 1791, 1875, 1959, 2036, 2111, 2173, 2229, 2255, 2295,
+    2321, 2381, 2433, 2481, 2517, 2550, 2560, 2575, 2589, 2591, 2593, 2595, 2602, 2610, 2617, 2619,
+    2621, 2628, 2636, 2663, 2693, 2738, 2780, 2837, 2867, 2912, 2939, 2969, 3003, 3023, 3050, 3071,
+    3097, 3107, 3115, 3121, 3123, 3135, 3141, 3164, 3187, 3207, 3264, 3278, 3284, 3286, 3288, 3290,
+};
+static constexpr uint8_t cat_code_3[] = {
+    0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77,
+    0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0xff, 0x77, 0x98, 0x77, 0x00, 0x68,
+    0x85, 0x5a, 0x01, 0x62, 0x71, 0xdd, 0x77, 0x98, 0x77, 0x08, 0x52, 0x11, 0x12, 0x11, 0x11, 0x12,
+    0x12, 0x24, 0x71, 0xdd, 0x77, 0x96, 0x77, 0x02, 0x69, 0x50, 0x50, 0x85, 0x58, 0x02, 0x52, 0x51,
+    0x5a, 0xdc, 0x77, 0x96, 0x77, 0x02, 0x67, 0x12, 0x45, 0x82, 0x71, 0x82, 0x72, 0x02, 0x69, 0x16,
+    0x37, 0xdc, 0x77, 0x94, 0x77, 0x04, 0x71, 0x3f, 0x45, 0x63, 0x68, 0x85, 0x77, 0x04, 0x71, 0x67,
+    0x58, 0x37, 0x58, 0xda, 0x77, 0x94, 0x77, 0x02, 0x69, 0x12, 0x3c, 0x83, 0x77, 0x08, 0x71, 0x77,
+    0x72, 0x71, 0x77, 0x77, 0x67, 0x12, 0x4e, 0xda, 0x77, 0x94, 0x77, 0x0f, 0x69, 0x12, 0x3c, 0x71,
+    0x59, 0x2d, 0x5a, 0x71, 0x77, 0x71, 0x2f, 0x2f, 0x71, 0x63, 0x11, 0x4e, 0xda, 0x77, 0x94, 0x77,
+    0x0f, 0x69, 0x12, 0x37, 0x77, 0x59, 0x24, 0x58, 0x69, 0x69, 0x68, 0x2e, 0x2f, 0x71, 0x63, 0x12,
+    0x4e, 0xda, 0x77, 0x94, 0x77, 0x0f, 0x69, 0x12, 0x3c, 0x77, 0x77, 0x71, 0x4e, 0x12, 0x12, 0x16,
+    0x68, 0x71, 0x72, 0x63, 0x12, 0x4e, 0xda, 0x77, 0x8f, 0x77, 0x01, 0x69, 0x67, 0x82, 0x68, 0x06,
+    0x63, 0x12, 0x2d, 0x64, 0x68, 0x68, 0x3f, 0x82, 0x12, 0x06, 0x62, 0x67, 0x68, 0x58, 0x12, 0x3f,
+    0x64, 0x83, 0x68, 0x00, 0x71, 0xd4, 0x77, 0x8f, 0x77, 0x00, 0x50, 0x98, 0x12, 0x00, 0x69, 0xd4,
+    0x77, 0x8d, 0x77, 0x08, 0x68, 0x58, 0x61, 0x6f, 0x6f, 0x61, 0x61, 0x6f, 0x61, 0x82, 0x6f, 0x11,
+    0x61, 0x6f, 0x6f, 0x61, 0x61, 0x6f, 0x6f, 0x61, 0x6f, 0x6f, 0x61, 0x6f, 0x6f, 0x61, 0x6f, 0x61,
+    0x58, 0x59, 0xd3, 0x77, 0x8d, 0x77, 0x05, 0x62, 0x12, 0x81, 0xa3, 0xa3, 0xa1, 0x82, 0x9f, 0x00,
+    0xa3, 0x84, 0xa1, 0x01, 0x9f, 0x9f, 0x82, 0xa1, 0x0a, 0xa3, 0xa3, 0x9f, 0x9f, 0xa3, 0xa3, 0x9f,
+    0x9f, 0x2d, 0x2d, 0x71, 0xd2, 0x77, 0x8b, 0x77, 0x1a, 0x69, 0x4e, 0x61, 0x82, 0x9b, 0xa9, 0xa2,
+    0x9f, 0x70, 0x6f, 0x6f, 0x81, 0xa1, 0xa5, 0xa9, 0xa5, 0xa3, 0x81, 0x6f, 0x6f, 0x70, 0x9f, 0xa1,
+    0xa9, 0xa5, 0x9f, 0x82, 0x82, 0x6f, 0x03, 0x81, 0x76, 0x50, 0x58, 0xd1, 0x77, 0x8b, 0x77, 0x21,
+    0x67, 0x11, 0x6f, 0xa1, 0xa6, 0xaa, 0xa5, 0x9f, 0x3c, 0x11, 0x12, 0x44, 0x9f, 0xa6, 0xab, 0xa5,
+    0x9f, 0x4f, 0x11, 0x11, 0x35, 0x9f, 0xa2, 0xaa, 0xa6, 0x9f, 0x61, 0x11, 0x11, 0x20, 0x9b, 0x97,
+    0x11, 0x37, 0xd1, 0x77, 0x8b, 0x77, 0x07, 0x71, 0x63, 0x58, 0x4f, 0x92, 0xa2, 0xa1, 0x9f, 0x83,
+    0x92, 0x05, 0x9f, 0xa1, 0xa5, 0xa1, 0xa1, 0x97, 0x82, 0x92, 0x0c, 0x9f, 0xa1, 0xa5, 0xa1, 0x9f,
+    0x97, 0x92, 0x92, 0x8e, 0x5f, 0x51, 0x63, 0x68, 0xd1, 0x77, 0x8d, 0x77, 0x02, 0x62, 0x12, 0x81,
+    0x97, 0x9f, 0x02, 0x9b, 0x35, 0x2d, 0xd3, 0x77, 0x8d, 0x77, 0x02, 0x71, 0x69, 0x51, 0x94, 0x35,
+    0x82, 0x2d, 0x03, 0x35, 0x68, 0x71, 0x72, 0xd2, 0x77, 0x8f, 0x77, 0x00, 0x58, 0x82, 0x23, 0x82,
+    0x24, 0x00, 0x23, 0x88, 0x24, 0x01, 0x23, 0x23, 0x86, 0x24, 0x00, 0x71, 0xd4, 0x77, 0x90, 0x77,
+    0x98, 0x71, 0x00, 0x72, 0xd4, 0x77, 0xed, 0x77, 0x03, 0x71, 0x78, 0x86, 0x78, 0x8d, 0x77, 0xea,
+    0x77, 0x00, 0x71, 0x82, 0x77, 0x02, 0x8f, 0x9f, 0x8f, 0x8d, 0x77, 0xea, 0x77, 0x09, 0x78, 0x8f,
+    0x86, 0x77, 0x86, 0x94, 0x86, 0x77, 0x87, 0x8f, 0x8a, 0x77, 0xea, 0x77, 0x0a, 0x78, 0x9f, 0x99,
+    0x77, 0x77, 0x72, 0x77, 0x77, 0x9b, 0x9f, 0x78, 0x89, 0x77, 0xeb, 0x77, 0x01, 0x8f, 0x86, 0x84,
+    0x77, 0x01, 0x87, 0x8f, 0x8a, 0x77, 0xff, 0x77, 0xe9, 0x77, 0x02, 0x99, 0x99, 0x72, 0x85, 0x77,
+    0x03, 0x72, 0x77, 0x99, 0x99, 0x88, 0x77, 0xe9, 0x77, 0x01, 0x9b, 0x9b, 0x87, 0x77, 0x05, 0x78,
+    0x9f, 0x99, 0x77, 0x77, 0x72, 0x85, 0x77, 0xe9, 0x77, 0x01, 0x78, 0x78, 0x88, 0x77, 0x01, 0x78,
+    0x78, 0x88, 0x77, 0xeb, 0x77, 0x01, 0x78, 0x78, 0x84, 0x77, 0x01, 0x78, 0x78, 0x8a, 0x77, 0xea,
+    0x77, 0x0a, 0x78, 0x9f, 0x99, 0x77, 0x77, 0x72, 0x77, 0x77, 0x9b, 0x9f, 0x78, 0x89, 0x77, 0x8a,
+    0x77, 0x90, 0x71, 0x8d, 0x77, 0x8e, 0x71, 0xb2, 0x77, 0x08, 0x99, 0x8f, 0x77, 0x78, 0x86, 0x78,
+    0x72, 0x94, 0x99, 0x8a, 0x77, 0x8b, 0x77, 0x00, 0x71, 0x8d, 0x64, 0x00, 0x71, 0x8c, 0x77, 0x00,
+    0x71, 0x8d, 0x64, 0x01, 0x69, 0x72, 0xb4, 0x77, 0x02, 0x8f, 0x9f, 0x87, 0x8d, 0x77, 0x8c, 0x69,
+    0x8d, 0x64, 0x8e, 0x69, 0x86, 0x64, 0x01, 0x48, 0x46, 0x84, 0x45, 0x00, 0x50, 0x96, 0x52, 0x00,
+    0x67, 0x9d, 0x77, 0x02, 0x86, 0x94, 0x86, 0x8d, 0x77, 0xb0, 0x64, 0x00, 0x37, 0x9d, 0x00, 0x00,
+    0x52, 0xae, 0x77, 0xae, 0x64, 0x02, 0x48, 0x37, 0x75, 0x9d, 0x93, 0x02, 0x6e, 0x45, 0x68, 0xac,
+    0x77, 0xae, 0x64, 0x02, 0x45, 0x00, 0x93, 0x9d, 0xa8, 0x02, 0x7f, 0x00, 0x62, 0xac, 0x77, 0x8c,
+    0x64, 0x8d, 0x54, 0x8e, 0x64, 0x82, 0x54, 0x04, 0x48, 0x17, 0x6e, 0x9a, 0x75, 0x8e, 0x4d, 0x00,
+    0x6e, 0x84, 0xa8, 0x04, 0x95, 0x7d, 0x7d, 0x8a, 0xad, 0x83, 0xa8, 0x04, 0xa0, 0x9a, 0x57, 0x23,
+    0x69, 0xaa, 0x77, 0x8c, 0x64, 0x84, 0x4a, 0x01, 0x54, 0x54, 0x85, 0x4a, 0x01, 0x54, 0x63, 0x8d,
+    0x64, 0x07, 0x4a, 0x54, 0x54, 0x46, 0x00, 0x7f, 0xa8, 0x75, 0x8e, 0x22, 0x00, 0x56, 0x84, 0xa8,
+    0x04, 0x8a, 0x7c, 0x7c, 0x7d, 0xad, 0x85, 0xa8, 0x03, 0x60, 0x00, 0x69, 0x71, 0xa9, 0x77, 0x8c,
+    0x54, 0x82, 0x4a, 0x00, 0x54, 0x82, 0x4a, 0x01, 0x54, 0x54, 0x82, 0x4a, 0x01, 0x54, 0x4a, 0x91,
+    0x54, 0x04, 0x46, 0x00, 0x7f, 0xa8, 0x75, 0x8e, 0x22, 0x00, 0x56, 0x84, 0xa8, 0x04, 0x8a, 0x7b,
+    0x7b, 0x7d, 0xad, 0x85, 0xa8, 0x02, 0x60, 0x00, 0x69, 0xaa, 0x77, 0x8c, 0x54, 0x07, 0x4a, 0x54,
+    0x4a, 0x54, 0x4a, 0x54, 0x4a, 0x54, 0x82, 0x4a, 0x03, 0x54, 0x4a, 0x54, 0x4a, 0x8c, 0x54, 0x00,
+    0x4a, 0x82, 0x54, 0x04, 0x46, 0x00, 0x7f, 0xa8, 0x75, 0x82, 0x22, 0x88, 0x19, 0x82, 0x22, 0x00,
+    0x56, 0x84, 0xa8, 0x04, 0x91, 0x7d, 0x7d, 0x7e, 0xad, 0x85, 0xa8, 0x02, 0x60, 0x00, 0x69, 0xaa,
+    0x77, 0x8c, 0x54, 0x82, 0x4a, 0x08, 0x54, 0x4a, 0x4a, 0x54, 0x4a, 0x4a, 0x54, 0x54, 0x4a, 0x93,
+    0x54, 0x08, 0x46, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x03, 0x25, 0x22,
+    0x22, 0x56, 0x86, 0xa8, 0x00, 0xad, 0x87, 0xa8, 0x02, 0x60, 0x00, 0x69, 0xaa, 0x77, 0x8b, 0x54,
+    0x00, 0x4a, 0x8d, 0x49, 0x00, 0x4a, 0x8d, 0x54, 0x82, 0x49, 0x08, 0x32, 0x00, 0x7f, 0xa8, 0x75,
+    0x22, 0x22, 0x24, 0x33, 0x85, 0x2b, 0x05, 0x2a, 0x2a, 0x25, 0x22, 0x22, 0x56, 0x82, 0xa8, 0x05,
+    0xa0, 0x98, 0x98, 0x93, 0x9d, 0x9d, 0x86, 0xa8, 0x05, 0x60, 0x00, 0x69, 0x77, 0x77, 0x71, 0x82,
+    0x62, 0x00, 0x68, 0xa3, 0x77, 0x88, 0x54, 0x03, 0x4a, 0x54, 0x54, 0x49, 0x8d, 0x3b, 0x00, 0x40,
+    0x82, 0x54, 0x00, 0x4a, 0x88, 0x54, 0x00, 0x4a, 0x82, 0x3b, 0x08, 0x39, 0x00, 0x7f, 0xa8, 0x75,
+    0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x03, 0x25, 0x22, 0x22, 0x56, 0x82, 0xa8, 0x00, 0x7f, 0x82,
+    0x00, 0x02, 0x6a, 0x7d, 0xad, 0x85, 0xa8, 0x05, 0x60, 0x00, 0x69, 0x77, 0x77, 0x63, 0x82, 0x00,
+    0x00, 0x58, 0xa3, 0x77, 0x8c, 0x40, 0x8d, 0x3b, 0x8e, 0x40, 0x82, 0x3b, 0x08, 0x1d, 0x00, 0x7f,
+    0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x07, 0x25, 0x22, 0x22, 0x56, 0xa8, 0x9e, 0x83,
+    0x74, 0x82, 0x60, 0x02, 0x4b, 0x55, 0xa4, 0x85, 0xa8, 0x05, 0x60, 0x00, 0x69, 0x71, 0x51, 0x51,
+    0x82, 0x60, 0x02, 0x51, 0x50, 0x68, 0xa1, 0x77, 0xac, 0x3b, 0x08, 0x39, 0x00, 0x7f, 0xa8, 0x75,
+    0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x0d, 0x25, 0x22, 0x22, 0x56, 0xa8, 0x93, 0x00, 0x60, 0x8c,
+    0x84, 0x8c, 0x22, 0x22, 0xa4, 0x85, 0xa8, 0x0b, 0x60, 0x00, 0x69, 0x71, 0x06, 0x36, 0x8c, 0x84,
+    0x8c, 0x56, 0x00, 0x63, 0xa1, 0x77, 0xac, 0x3b, 0x08, 0x1d, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22,
+    0x24, 0x33, 0x87, 0x2a, 0x0e, 0x25, 0x22, 0x22, 0x56, 0xa8, 0x93, 0x00, 0x60, 0x84, 0x8c, 0x8c,
+    0x75, 0x6e, 0x6e, 0x7f, 0x84, 0xa8, 0x0b, 0x60, 0x00, 0x37, 0x3f, 0x6e, 0x75, 0x84, 0x8c, 0x8c,
+    0x56, 0x00, 0x5b, 0xa1, 0x77, 0xac, 0x3b, 0x08, 0x1d, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24,
+    0x33, 0x87, 0x2a, 0x0e, 0x25, 0x22, 0x22, 0x56, 0xa8, 0x93, 0x00, 0x60, 0x84, 0x8c, 0x8c, 0x84,
+    0x83, 0x10, 0x43, 0x84, 0xa8, 0x04, 0x60, 0x00, 0x01, 0x15, 0x83, 0x83, 0x84, 0x02, 0x56, 0x00,
+    0x63, 0xa1, 0x77, 0x8c, 0x3b, 0x8d, 0x1d, 0x00, 0x32, 0x8d, 0x3b, 0x0b, 0x1e, 0x1d, 0x1d, 0x1b,
+    0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x08, 0x25, 0x22, 0x22, 0x56, 0xa8,
+    0x93, 0x00, 0x60, 0x84, 0x82, 0x8c, 0x02, 0x83, 0x7f, 0x74, 0x84, 0x4d, 0x0b, 0x15, 0x00, 0x74,
+    0x7f, 0x83, 0x84, 0x84, 0x8c, 0x8c, 0x56, 0x00, 0x5b, 0xa1, 0x77, 0x8c, 0x3b, 0x8c, 0x1c, 0x01,
+    0x1d, 0x32, 0x8d, 0x3b, 0x0b, 0x1d, 0x28, 0x1c, 0x14, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24,
+    0x33, 0x87, 0x2a, 0x09, 0x25, 0x22, 0x22, 0x56, 0xa8, 0x93, 0x00, 0x60, 0x84, 0x8c, 0x82, 0x84,
+    0x01, 0x8c, 0x75, 0x86, 0x00, 0x02, 0x7f, 0x84, 0x84, 0x83, 0x8c, 0x02, 0x56, 0x00, 0x63, 0xa1,
+    0x77, 0xac, 0x1c, 0x08, 0x1b, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x08,
+    0x25, 0x22, 0x22, 0x56, 0xa8, 0x93, 0x00, 0x60, 0x84, 0x82, 0x8c, 0x86, 0x84, 0x00, 0x8c, 0x83,
+    0x84, 0x07, 0x8c, 0x8c, 0x84, 0x8c, 0x8c, 0x56, 0x00, 0x63, 0xa1, 0x77, 0xa9, 0x1c, 0x82, 0x1b,
+    0x08, 0x13, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x08, 0x25, 0x22, 0x22,
+    0x4d, 0x9e, 0x8d, 0x36, 0x6d, 0x84, 0x84, 0x8c, 0x83, 0x84, 0x0f, 0x8c, 0x84, 0x84, 0x8c, 0x84,
+    0x84, 0x8c, 0x84, 0x84, 0x8c, 0x8c, 0x60, 0x36, 0x62, 0x68, 0x71, 0x9f, 0x77, 0xa9, 0x1c, 0x00,
+    0x02, 0x83, 0x00, 0x06, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x05, 0x25, 0x22,
+    0x22, 0x15, 0x01, 0x4d, 0x84, 0x8c, 0x04, 0x83, 0x84, 0x84, 0x8c, 0x84, 0x82, 0x8c, 0x0e, 0x84,
+    0x8c, 0x84, 0x8c, 0x8c, 0x84, 0x8d, 0x8d, 0x8c, 0x84, 0x84, 0x8d, 0x36, 0x06, 0x69, 0x9f, 0x77,
+    0xa5, 0x1c, 0x0f, 0x1b, 0x1a, 0x1a, 0x25, 0x43, 0x4d, 0x4d, 0x3d, 0x00, 0x7f, 0xa8, 0x75, 0x22,
+    0x22, 0x24, 0x33, 0x87, 0x2a, 0x21, 0x25, 0x22, 0x22, 0x15, 0x00, 0x4d, 0x84, 0x8c, 0x8c, 0x84,
+    0x84, 0xa0, 0xa0, 0x74, 0x74, 0x8c, 0x8c, 0x84, 0x8c, 0x8c, 0x84, 0x8c, 0x8c, 0x8d, 0xa4, 0x9a,
+    0x6e, 0x75, 0x8c, 0x8c, 0x8d, 0x36, 0x02, 0x69, 0x9f, 0x77, 0x8c, 0x1c, 0x8d, 0x14, 0x82, 0x1c,
+    0x00, 0x28, 0x86, 0x1c, 0x0f, 0x0c, 0x00, 0x00, 0x09, 0x7f, 0x83, 0x84, 0x75, 0x00, 0x7f, 0xa8,
+    0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x21, 0x25, 0x22, 0x22, 0x15, 0x00, 0x4d, 0x84, 0x8c,
+    0x84, 0x8c, 0x8c, 0xb3, 0xb3, 0x22, 0x2c, 0x8c, 0x84, 0x84, 0x8c, 0x8c, 0x84, 0x84, 0x8c, 0x93,
+    0xb5, 0xae, 0x01, 0x4d, 0x84, 0x84, 0x8d, 0x36, 0x02, 0x69, 0x9f, 0x77, 0x0c, 0x1c, 0x1c, 0x1b,
+    0x1c, 0x1b, 0x1c, 0x1b, 0x1c, 0x1c, 0x1b, 0x1c, 0x1c, 0x1b, 0x83, 0x14, 0x04, 0x1b, 0x14, 0x14,
+    0x1b, 0x1b, 0x82, 0x14, 0x01, 0x1b, 0x14, 0x82, 0x1b, 0x00, 0x26, 0x84, 0x1c, 0x02, 0x14, 0x13,
+    0x43, 0x82, 0x60, 0x0b, 0x83, 0x8d, 0x8d, 0x74, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33,
+    0x87, 0x2a, 0x10, 0x25, 0x22, 0x22, 0x15, 0x00, 0x4d, 0x84, 0x8c, 0x84, 0x8c, 0x8c, 0x98, 0x98,
+    0x11, 0x36, 0x84, 0x84, 0x82, 0x8c, 0x0d, 0x6e, 0x60, 0x83, 0x8d, 0x9a, 0x8d, 0x00, 0x4d, 0x84,
+    0x8c, 0x8d, 0x3d, 0x02, 0x69, 0x9f, 0x77, 0x02, 0x14, 0x1b, 0x14, 0x82, 0x1b, 0x04, 0x14, 0x14,
+    0x1b, 0x14, 0x1b, 0x97, 0x14, 0x12, 0x1b, 0x0d, 0x00, 0x66, 0x84, 0x8c, 0x8d, 0x8c, 0x8c, 0x8d,
+    0x75, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x05, 0x25, 0x22, 0x22, 0x15,
+    0x00, 0x4d, 0x83, 0x8c, 0x06, 0x83, 0x22, 0x00, 0x00, 0x36, 0x8c, 0x84, 0x82, 0x8c, 0x0d, 0x3e,
+    0x00, 0x7f, 0x7f, 0x06, 0x00, 0x00, 0x4d, 0x8c, 0x8c, 0x8d, 0x3d, 0x02, 0x69, 0x9f, 0x77, 0x88,
+    0x14, 0x07, 0x1b, 0x14, 0x1b, 0x1b, 0x14, 0x1b, 0x14, 0x14, 0x82, 0x1b, 0x01, 0x14, 0x1b, 0x84,
+    0x14, 0x0d, 0x1b, 0x14, 0x1b, 0x1b, 0x14, 0x14, 0x1b, 0x13, 0x0b, 0x43, 0x6e, 0x7f, 0x8c, 0x57,
+    0x83, 0x43, 0x08, 0x36, 0x00, 0x7f, 0xa8, 0x75, 0x22, 0x22, 0x24, 0x33, 0x87, 0x2a, 0x1b, 0x25,
+    0x22, 0x22, 0x15, 0x00, 0x4d, 0x8d, 0x9c, 0xb0, 0xb0, 0xaf, 0x8b, 0x74, 0x75, 0x75, 0x8c, 0x8c,
+    0x84, 0x8c, 0x84, 0x75, 0x74, 0x83, 0x83, 0x75, 0x6e, 0x6e, 0x95, 0x82, 0xb0, 0x02, 0x42, 0x02,
+    0x69, 0x9f, 0x77, 0x02, 0x14, 0x14, 0x1b, 0x82, 0x14, 0x82, 0x1b, 0x01, 0x14, 0x1b, 0x84, 0x14,
+    0x07, 0x1b, 0x14, 0x14, 0x1b, 0x14, 0x14, 0x1b, 0x14, 0x83, 0x1b, 0x82, 0x14, 0x09, 0x1b, 0x14,
+    0x14, 0x13, 0x00, 0x56, 0x84, 0x84, 0x83, 0x36, 0x85, 0x00, 0x06, 0x7f, 0xa8, 0x75, 0x22, 0x22,
+    0x24, 0x33, 0x87, 0x2a, 0x07, 0x25, 0x22, 0x18, 0x15, 0x00, 0x4d, 0x84, 0xac, 0x82, 0xb4, 0x03,
+    0x96, 0x8c, 0x8c, 0x84, 0x83, 0x8c, 0x00, 0x84, 0x83, 0x8c, 0x03, 0x84, 0x84, 0x8c, 0x9c, 0x82,
+    0xb4, 0x02, 0x6b, 0x02, 0x69, 0x9f, 0x77, 0x05, 0x14, 0x1b, 0x14, 0x14, 0x1b, 0x1b, 0x82, 0x14,
+    0x00, 0x1b, 0x82, 0x14, 0x8d, 0x0f, 0x01, 0x14, 0x1b, 0x84, 0x14, 0x02, 0x13, 0x00, 0x56, 0x82,
+    0x83, 0x09, 0x36, 0x00, 0x0d, 0x0e, 0x0e, 0x0c, 0x00, 0x7f, 0xa8, 0x75, 0x82, 0x22, 0x88, 0x19,
+    0x82, 0x22, 0x04, 0x15, 0x00, 0x4d, 0x8c, 0xac, 0x82, 0xb4, 0x10, 0x96, 0x83, 0x2c, 0x43, 0x84,
+    0x8c, 0x8c, 0x60, 0x22, 0x75, 0x8c, 0x8c, 0x83, 0x2c, 0x43, 0x83, 0x9c, 0x82, 0xb4, 0x02, 0x6b,
+    0x02, 0x69, 0x9f, 0x77, 0x8c, 0x14, 0x85, 0x0e, 0x02, 0x0f, 0x0e, 0x0e, 0x82, 0x0f, 0x01, 0x0e,
+    0x0e, 0x85, 0x14, 0x03, 0x1b, 0x13, 0x01, 0x4d, 0x82, 0x83, 0x09, 0x36, 0x02, 0x13, 0x0e, 0x0e,
+    0x08, 0x00, 0x7f, 0xa8, 0x75, 0x86, 0x22, 0x01, 0x34, 0x21, 0x84, 0x22, 0x05, 0x36, 0x36, 0x22,
+    0x56, 0x83, 0xa7, 0x82, 0xb2, 0x03, 0x96, 0x83, 0x09, 0x2c, 0x82, 0x83, 0x0f, 0x56, 0x00, 0x6e,
+    0x83, 0x83, 0x7f, 0x09, 0x36, 0x8c, 0x9c, 0xb2, 0xb1, 0xb1, 0x5e, 0x0b, 0x69, 0x9f, 0x77, 0x99,
+    0x0e, 0x00, 0x13, 0x87, 0x0e, 0x01, 0x13, 0x0c, 0x82, 0x09, 0x00, 0x0d, 0x83, 0x0e, 0x04, 0x08,
+    0x00, 0x7f, 0xa8, 0x75, 0x85, 0x22, 0x02, 0x41, 0x73, 0x55, 0x83, 0x22, 0x06, 0x15, 0xa8, 0xa4,
+    0xa4, 0x93, 0x09, 0x6c, 0x83, 0x8c, 0x02, 0x83, 0x09, 0x01, 0x82, 0x09, 0x01, 0x06, 0x00, 0x83,
+    0x09, 0x01, 0x00, 0x36, 0x82, 0x8c, 0x03, 0x56, 0x1f, 0x62, 0x71, 0xa0, 0x77, 0x9c, 0x0e, 0x01,
+    0x13, 0x13, 0x83, 0x0e, 0x01, 0x13, 0x07, 0x82, 0x03, 0x00, 0x0d, 0x83, 0x0e, 0x04, 0x08, 0x00,
+    0x6e, 0x9a, 0x75, 0x85, 0x4d, 0x02, 0x56, 0x7d, 0x6c, 0x84, 0x4d, 0x82, 0xa8, 0x08, 0x98, 0x43,
+    0x66, 0x75, 0x83, 0x84, 0x84, 0x83, 0x36, 0x88, 0x2c, 0x08, 0x36, 0x36, 0x4d, 0x8c, 0x83, 0x75,
+    0x4d, 0x23, 0x67, 0xa1, 0x77, 0x9b, 0x0e, 0x00, 0x13, 0x8f, 0x0e, 0x00, 0x0c, 0x82, 0x00, 0x00,
+    0x93, 0x92, 0xa8, 0x02, 0x7f, 0x00, 0x75, 0x90, 0x8d, 0x02, 0x66, 0x00, 0x58, 0xa3, 0x77, 0x8b,
+    0x0e, 0x00, 0x1a, 0x8d, 0x46, 0x00, 0x28, 0x8c, 0x0e, 0x04, 0x13, 0x46, 0x45, 0x0c, 0x24, 0x82,
+    0x4d, 0x00, 0x7f, 0x92, 0x93, 0x02, 0x66, 0x00, 0x56, 0x84, 0x6e, 0x00, 0x6d, 0x88, 0x6e, 0x04,
+    0x6d, 0x6e, 0x57, 0x3f, 0x63, 0xa3, 0x77, 0x8b, 0x0e, 0x00, 0x28, 0x8d, 0x72, 0x00, 0x48, 0x8c,
+    0x0e, 0x04, 0x0f, 0x69, 0x69, 0x00, 0x3e, 0x82, 0x8c, 0x00, 0x4d, 0xa6, 0x00, 0x00, 0x3f, 0xa5,
+    0x77, 0x8b, 0x5a, 0x01, 0x5b, 0x72, 0x87, 0x77, 0x01, 0x8f, 0x8f, 0x82, 0x77, 0x00, 0x67, 0x8d,
+    0x5a, 0x03, 0x71, 0x69, 0x00, 0x3e, 0x82, 0x8c, 0x0b, 0x4d, 0x00, 0x45, 0x51, 0x06, 0x11, 0x66,
+    0x60, 0x66, 0x43, 0x00, 0x3f, 0x89, 0x52, 0x12, 0x23, 0x00, 0x56, 0x66, 0x60, 0x56, 0x00, 0x2e,
+    0x52, 0x2f, 0x00, 0x4d, 0x66, 0x66, 0x60, 0x01, 0x16, 0x52, 0x5b, 0xa5, 0x77, 0x01, 0x77, 0x71,
+    0x92, 0x77, 0x02, 0x78, 0x9f, 0x99, 0x92, 0x77, 0x02, 0x68, 0x00, 0x3e, 0x82, 0x8c, 0x05, 0x4d,
+    0x00, 0x67, 0x71, 0x0a, 0x22, 0x82, 0x8d, 0x02, 0x66, 0x00, 0x62, 0x89, 0x77, 0x10, 0x37, 0x00,
+    0x7f, 0x83, 0x84, 0x75, 0x00, 0x3f, 0x77, 0x4e, 0x00, 0x74, 0x83, 0x8d, 0x7f, 0x06, 0x2e, 0xa7,
+    0x77, 0x95, 0x77, 0x01, 0x86, 0x86, 0x92, 0x77, 0x0b, 0x69, 0x00, 0x11, 0x3e, 0x43, 0x3e, 0x51,
+    0x62, 0x71, 0x71, 0x63, 0x61, 0x82, 0x3e, 0x02, 0x2c, 0x00, 0x62, 0x89, 0x77, 0x10, 0x68, 0x62,
+    0x3e, 0x3e, 0x43, 0x36, 0x00, 0x3f, 0x77, 0x68, 0x62, 0x4c, 0x3e, 0x3e, 0x3d, 0x01, 0x2e, 0xa7,
+    0x77, 0xaa, 0x77, 0x01, 0x69, 0x01, 0x83, 0x00, 0x00, 0x58, 0x83, 0x77, 0x01, 0x68, 0x01, 0x83,
+    0x00, 0x00, 0x62, 0x8b, 0x77, 0x00, 0x16, 0x83, 0x00, 0x00, 0x3f, 0x82, 0x77, 0x00, 0x37, 0x83,
+    0x00, 0x00, 0x2e, 0xa7, 0x77, 0xab, 0x77, 0x83, 0x69, 0x01, 0x68, 0x71, 0x84, 0x77, 0x00, 0x68,
+    0x83, 0x69, 0x00, 0x71, 0x8b, 0x77, 0x00, 0x69, 0x83, 0x68, 0x00, 0x71, 0x82, 0x77, 0x00, 0x71,
+    0x83, 0x68, 0x00, 0x69, 0xa7, 0x77, 0x90, 0x77, 0x00, 0x78, 0x89, 0x77, 0x00, 0x78, 0xe2, 0x77,
+    0x8f, 0x77, 0x02, 0x8f, 0x9f, 0x86, 0x87, 0x77, 0x03, 0x94, 0x9f, 0x86, 0x72, 0xe0, 0x77, 0x8f,
+    0x77, 0x02, 0x8f, 0x99, 0x86, 0x87, 0x77, 0x02, 0x8f, 0x99, 0x7a, 0xe1, 0x77, 0xff, 0x77, 0xff,
+    0x77, 0xff, 0x77, 0x95, 0x77, 0x01, 0x94, 0x8f, 0xe7, 0x77, 0x94, 0x77, 0x02, 0x78, 0x9f, 0x99,
+    0xe7, 0x77, 0x95, 0x77, 0x01, 0x86, 0x7a, 0xe7, 0x77, 0xff, 0x77, 0xff, 0x77, 0xdc, 0x77, 0x01,
+    0x78, 0x78, 0xa0, 0x77, 0xdc, 0x77, 0x02, 0x99, 0x9f, 0x78, 0x9f, 0x77, 0xae, 0x77, 0x00, 0x69,
+    0x85, 0x63, 0x00, 0x5b, 0x87, 0x63, 0x00, 0x5b, 0x98, 0x77, 0x09, 0x78, 0x86, 0x78, 0x77, 0x94,
+    0x99, 0x78, 0x77, 0x86, 0x86, 0x9c, 0x77, 0xae, 0x77, 0x00, 0x52, 0x8f, 0x04, 0x00, 0x72, 0x90,
+    0x77, 0x00, 0x72, 0x85, 0x77, 0x02, 0x8f, 0x9f, 0x87, 0x83, 0x77, 0x02, 0x78, 0x9f, 0x99, 0x8f,
+    0x77, 0x85, 0x72, 0x86, 0x77, 0xa8, 0x77, 0x06, 0x71, 0x5a, 0x59, 0x59, 0x5a, 0x5a, 0x39, 0x8f,
+    0x04, 0x02, 0x59, 0x5b, 0x71, 0x8e, 0x77, 0x00, 0x64, 0x85, 0x5b, 0x02, 0x68, 0x85, 0x68, 0x83,
+    0x5b, 0x02, 0x64, 0x8f, 0x8f, 0x8d, 0x77, 0x01, 0x63, 0x59, 0x86, 0x5a, 0x02, 0x59, 0x59, 0x69,
+    0x82, 0x77, 0xa8, 0x77, 0x01, 0x71, 0x13, 0x8e, 0x04, 0x00, 0x05, 0x85, 0x04, 0x01, 0x26, 0x72,
+    0x8d, 0x77, 0x01, 0x72, 0x47, 0x87, 0x1c, 0x00, 0x1d, 0x83, 0x1c, 0x01, 0x32, 0x72, 0x8a, 0x77,
+    0x00, 0x72, 0x82, 0x77, 0x00, 0x45, 0x89, 0x04, 0x00, 0x5b, 0x82, 0x77, 0x82, 0x77, 0x03, 0x69,
+    0x48, 0x48, 0x49, 0x88, 0x48, 0x00, 0x64, 0x90, 0x77, 0x00, 0x68, 0x86, 0x45, 0x00, 0x08, 0x95,
+    0x04, 0x04, 0x13, 0x46, 0x45, 0x45, 0x5b, 0x87, 0x77, 0x00, 0x68, 0x82, 0x48, 0x00, 0x32, 0x8c,
+    0x1c, 0x00, 0x1d, 0x82, 0x48, 0x00, 0x63, 0x87, 0x77, 0x00, 0x68, 0x82, 0x45, 0x00, 0x1a, 0x89,
+    0x04, 0x00, 0x38, 0x82, 0x45, 0x82, 0x77, 0x00, 0x64, 0x8b, 0x1c, 0x00, 0x5b, 0x90, 0x77, 0x00,
+    0x63, 0xa1, 0x04, 0x00, 0x52, 0x87, 0x77, 0x00, 0x63, 0x94, 0x1c, 0x00, 0x49, 0x87, 0x77, 0x00,
+    0x63, 0x91, 0x04, 0x83, 0x32, 0x8b, 0x1c, 0x04, 0x32, 0x46, 0x47, 0x47, 0x71, 0x87, 0x77, 0x00,
+    0x46, 0x83, 0x26, 0x00, 0x25, 0xa1, 0x04, 0x02, 0x1a, 0x27, 0x32, 0x85, 0x46, 0x02, 0x32, 0x28,
+    0x28, 0x92, 0x1c, 0x09, 0x39, 0x46, 0x32, 0x32, 0x69, 0x77, 0x38, 0x26, 0x26, 0x1a, 0x91, 0x04,
+    0x90, 0x1c, 0x82, 0x28, 0x00, 0x69, 0x84, 0x71, 0x03, 0x77, 0x71, 0x71, 0x26, 0xa6, 0x04, 0x02,
+    0x07, 0x05, 0x14, 0x9f, 0x1c, 0x02, 0x64, 0x69, 0x13, 0x94, 0x04, 0x93, 0x1c, 0x09, 0x39, 0x39,
+    0x32, 0x39, 0x39, 0x5a, 0x72, 0x46, 0x13, 0x05, 0xa4, 0x04, 0x00, 0x0e, 0x83, 0x1c, 0x01, 0x1d,
+    0x1d, 0x9d, 0x1c, 0x02, 0x39, 0x39, 0x08, 0x94, 0x04, 0x98, 0x1c, 0x03, 0x47, 0x69, 0x46, 0x08,
+    0x9e, 0x04, 0x00, 0x05, 0x85, 0x08, 0x01, 0x0f, 0x28, 0x95, 0x1c, 0x03, 0x1d, 0x1c, 0x1d, 0x1d,
+    0x8a, 0x1c, 0x82, 0x08, 0x00, 0x05, 0x8f, 0x04, 0x01, 0x08, 0x08, 0x9a, 0x1c, 0x02, 0x1d, 0x1c,
+    0x0e, 0x9d, 0x04, 0x00, 0x14, 0xaf, 0x1c, 0x01, 0x1b, 0x05, 0x8e, 0x04, 0x01, 0x1b, 0x28, 0x9c,
+    0x1c, 0x00, 0x0f, 0x84, 0x0e, 0x96, 0x04, 0x02, 0x08, 0x0e, 0x1b, 0xaf, 0x1c, 0x00, 0x1b, 0x82,
+    0x0e, 0x00, 0x08, 0x89, 0x04, 0x03, 0x08, 0x0e, 0x1c, 0x1c, 0x9e, 0x1c, 0x03, 0x28, 0x1c, 0x1c,
+    0x1b, 0x96, 0x04, 0x00, 0x0f, 0xb5, 0x1c, 0x00, 0x0e, 0x89, 0x04, 0x00, 0x14, 0x82, 0x1c, 0x9f,
+    0x1c, 0x02, 0x1d, 0x1d, 0x1c, 0x82, 0x0f, 0x00, 0x08, 0x8d, 0x04, 0x84, 0x0f, 0x00, 0x1b, 0xb5,
+    0x1c, 0x00, 0x14, 0x89, 0x0f, 0x00, 0x1b, 0x82, 0x1c, 0xa5, 0x1c, 0x00, 0x0e, 0x8c, 0x04, 0x00,
+    0x05, 0xca, 0x1c, 0xa5, 0x1c, 0x00, 0x1b, 0x8d, 0x14, 0xca, 0x1c, 0xb4, 0x1c, 0x00, 0x28, 0xc9,
+    0x1c, 0xff, 0x1c, 0xee, 0x1c, 0x01, 0x1d, 0x30, 0x88, 0x39, 0x83, 0x30, 0x01, 0x29, 0x30, 0xee,
+    0x1c, 0x00, 0x5d, 0x8f, 0x88, 0x89, 0x3a, 0x01, 0x31, 0x1d, 0x8b, 0x1c, 0x00, 0x1d, 0x84, 0x1c,
+    0x00, 0x1d, 0xc0, 0x1c, 0x00, 0x1d, 0x8d, 0x3a, 0x00, 0x65, 0x8f, 0x90, 0x88, 0x90, 0x02, 0x89,
+    0x80, 0x30, 0x8a, 0x1c, 0x82, 0x28, 0xbd, 0x1c, 0x00, 0x1d, 0x86, 0x1c, 0x01, 0x31, 0x88, 0x8a,
+    0x89, 0x92, 0x90, 0x89, 0x90, 0x01, 0x88, 0x5c, 0x95, 0x53, 0x00, 0x40, 0xaf, 0x1c, 0x00, 0x28,
+    0x8b, 0x53, 0x01, 0x5c, 0x88, 0x9d, 0x90, 0xa1, 0x90, 0x0e, 0x79, 0x1c, 0x1c, 0x1d, 0x1c, 0x1d,
+    0x1c, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x83, 0x1d, 0x0a, 0x1c, 0x1d, 0x1d, 0x1c,
+    0x1c, 0x1d, 0x1c, 0x1d, 0x1d, 0x1c, 0x1c, 0x82, 0x1d, 0x00, 0x1c, 0x82, 0x1d, 0x06, 0x1c, 0x1d,
+    0x1c, 0x1d, 0x1d, 0x1c, 0x1c, 0x84, 0x1d, 0x01, 0x28, 0x80, 0x85, 0x90, 0x00, 0x89, 0xa3, 0x90,
+    0xa1, 0x90, 0x00, 0x80, 0xb0, 0x65, 0x00, 0x88, 0x8a, 0x90, 0x00, 0x89, 0x9e, 0x90, 0xa3, 0x90,
+    0xae, 0x89, 0xac, 0x90, 0xff, 0x90, 0xff, 0x90, 0xff, 0x90, 0xff, 0x90,
+};
+
+// 178 colors, 3858 bytes (raw: 32768)
+static constexpr uint16_t cat_pal_4[] = {
+    0x0000, 0x0861, 0x09a1, 0x09c1, 0x10a2, 0x10c1, 0x1162, 0x11a1, 0x11e2, 0x18e3, 0x1923, 0x19e2,
+    0x1a23, 0x1a43, 0x2124, 0x2143, 0x2144, 0x21a4, 0x2224, 0x2264, 0x2945, 0x2983, 0x29c3, 0x2a23,
+    0x2a25, 0x2a43, 0x2a65, 0x2aa4, 0x2ae5, 0x2b05, 0x30c3, 0x3186, 0x31a6, 0x32a3, 0x32a4, 0x32e5,
+    0x3306, 0x34a6, 0x34c6, 0x3966, 0x39c7, 0x3a05, 0x3a24, 0x3a45, 0x3b67, 0x3c87, 0x4205, 0x4208,
+    0x42a6, 0x42e4, 0x4306, 0x43a8, 0x43c7, 0x4a69, 0x4ae6, 0x4ae9, 0x4b06, 0x4be7, 0x5126, 0x528a,
+    0x5327, 0x5367, 0x53a7, 0x5428, 0x58e6, 0x5967, 0x5aeb, 0x5b28, 0x5b2a, 0x5b47, 0x5b6a, 0x5c22,
+    0x5c28, 0x5c48, 0x6024, 0x632c, 0x63a8, 0x63c8, 0x6408, 0x6448, 0x6aab, 0x6b4d, 0x6ba9, 0x6be9,
+    0x6beb, 0x6c2a, 0x6c6a, 0x6c8a, 0x7024, 0x738e, 0x740b, 0x742a, 0x744a, 0x7482, 0x748a, 0x74ca,
+    0x78c7, 0x7b2d, 0x7bae, 0x7bea, 0x7bef, 0x7caa, 0x7ccb, 0x7d03, 0x7d0b, 0x8046, 0x83eb, 0x842c,
+    0x8430, 0x846c, 0x8470, 0x84ab, 0x84ca, 0x84cb, 0x8827, 0x8846, 0x89c9, 0x8bab, 0x8c71, 0x8ceb,
+    0x8d0b, 0x8d0e, 0x8d62, 0x946c, 0x948d, 0x94b2, 0x94d3, 0x958d, 0x95a1, 0x95a4, 0x95c1, 0x9b8f,
+    0x9cb3, 0x9cd3, 0x9d6d, 0x9da3, 0x9dc1, 0xa410, 0xa4ee, 0xa514, 0xa52e, 0xa5ae, 0xa5b1, 0xab8f,
+    0xac32, 0xac92, 0xad34, 0xad6f, 0xad75, 0xadae, 0xadcf, 0xb596, 0xb5af, 0xbcb2, 0xbdf0, 0xbdf7,
+    0xc555, 0xc5f0, 0xc610, 0xc631, 0xc638, 0xc672, 0xc693, 0xc6f4, 0xce59, 0xce92, 0xcf35, 0xcf55,
+    0xd639, 0xd735, 0xdcb3, 0xe4b3, 0xe71c, 0xef7d, 0xf4b3, 0xf7be, 0xfcb2, 0xffff,
+};
+static constexpr uint16_t cat_row_4[] = {
+    0, 39, 41, 43, 45, 47, 49, 55, 61, 67, 69, 75, 77, 79, 81, 91,
+    102, 115, 140, 162, 180, 201, 222, 251, 279, 298, 319, 353, 392, 431, 476, 500,
+    524, 564, 584, 598, 606, 618, 620, 622, 624, 638, 652, 664, 670, 672, 697, 719,
+    762, 772, 786, 800, 837, 875, 916, 976, 1024, 1083, 1136, 1188, 1236, 1280, 1324, 1381,
+    1450, 1500, 1560, 1616, 1674, 1733, 1797, 1849, 1900, 1946, 2001, 2061, 2125, 2174, 2206, 2248,
+    2278, 2333, 2388, 2439, 2474, 2508, 2510, 2512, 2514, 2516, 2518, 2524, 2538, 2540, 2542, 2544,
+    2546, 2553, 2561, 2579, 2604, 2642, 2675, 2732, 2776, 2833, 2872, 2909, 2943, 2964, 2994, 3016,
+    3043, 3053, 3059, 3065, 3067, 3077, 3096, 3113, 3150, 3166, 3207, 3217, 3227, 3229, 3231, 3233,
+};
+static constexpr uint8_t cat_code_4[] = {
+    0x8f, 0x70, 0x00, 0x66, 0xa6, 0x70, 0x00, 0x66, 0x8d, 0x70, 0x00, 0x66, 0x84, 0x70, 0x00, 0x66,
+    0x85, 0x70, 0x03, 0x66, 0x70, 0x70, 0x66, 0x82, 0x70, 0x00, 0x66, 0x88, 0x70, 0x00, 0x66, 0x84,
+    0x70, 0x02, 0x66, 0x70, 0x66, 0x91, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff,
+    0x70, 0xd0, 0x70, 0x00, 0x66, 0xad, 0x70, 0xd7, 0x70, 0x00, 0x66, 0xa6, 0x70, 0xbd, 0x70, 0x00,
+    0x66, 0xc0, 0x70, 0xff, 0x70, 0xa1, 0x70, 0x00, 0x66, 0xdc, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff,
+    0x70, 0x98, 0x70, 0x00, 0x5c, 0x85, 0x4d, 0x00, 0x53, 0xde, 0x70, 0x98, 0x70, 0x00, 0x4c, 0x85,
+    0x10, 0x01, 0x20, 0x65, 0xdd, 0x70, 0x96, 0x70, 0x02, 0x5e, 0x45, 0x45, 0x86, 0x4c, 0x01, 0x45,
+    0x4d, 0xdc, 0x70, 0x96, 0x70, 0x05, 0x5b, 0x10, 0x38, 0x66, 0x66, 0x70, 0x82, 0x66, 0x02, 0x5e,
+    0x15, 0x30, 0x92, 0x70, 0x00, 0x66, 0xb2, 0x70, 0x00, 0x66, 0x94, 0x70, 0x94, 0x70, 0x04, 0x65,
+    0x30, 0x3c, 0x55, 0x5c, 0x85, 0x70, 0x04, 0x65, 0x5b, 0x4d, 0x30, 0x4c, 0x9a, 0x70, 0x00, 0x66,
+    0xbe, 0x70, 0x94, 0x70, 0x02, 0x65, 0x10, 0x30, 0x85, 0x70, 0x00, 0x66, 0x82, 0x70, 0x02, 0x55,
+    0x10, 0x45, 0xda, 0x70, 0x94, 0x70, 0x0f, 0x5e, 0x10, 0x30, 0x66, 0x4d, 0x29, 0x4d, 0x70, 0x70,
+    0x65, 0x2b, 0x2b, 0x65, 0x55, 0x10, 0x45, 0xda, 0x70, 0x94, 0x70, 0x0f, 0x5e, 0x10, 0x30, 0x70,
+    0x4d, 0x20, 0x4c, 0x65, 0x5e, 0x5c, 0x2b, 0x2b, 0x65, 0x55, 0x10, 0x3c, 0xda, 0x70, 0x94, 0x70,
+    0x0f, 0x5e, 0x10, 0x30, 0x70, 0x70, 0x65, 0x3c, 0x10, 0x10, 0x15, 0x5c, 0x65, 0x66, 0x55, 0x10,
+    0x3c, 0xad, 0x70, 0x00, 0x66, 0x83, 0x70, 0x00, 0x66, 0xa6, 0x70, 0x8f, 0x70, 0x00, 0x5e, 0x83,
+    0x5c, 0x06, 0x53, 0x10, 0x2b, 0x56, 0x5c, 0x5c, 0x36, 0x82, 0x10, 0x06, 0x4e, 0x5b, 0x5c, 0x4c,
+    0x10, 0x36, 0x56, 0x83, 0x5c, 0xd5, 0x70, 0x8f, 0x70, 0x00, 0x45, 0x83, 0x10, 0x00, 0x0f, 0x92,
+    0x10, 0x01, 0x15, 0x5e, 0x8a, 0x70, 0x00, 0x66, 0xc8, 0x70, 0x8d, 0x70, 0x02, 0x5c, 0x4c, 0x52,
+    0x89, 0x63, 0x03, 0x52, 0x52, 0x63, 0x52, 0x89, 0x63, 0x02, 0x52, 0x4c, 0x4d, 0xd3, 0x70, 0x8c,
+    0x70, 0x0d, 0x66, 0x53, 0x10, 0x7b, 0x9d, 0x9a, 0x9a, 0x9e, 0x9d, 0x9d, 0x9e, 0x9d, 0x9d, 0x9e,
+    0x83, 0x9a, 0x00, 0x9e, 0x82, 0x9d, 0x01, 0x9a, 0x9e, 0x83, 0x9d, 0x02, 0x9a, 0x2e, 0x29, 0xd3,
+    0x70, 0x8b, 0x70, 0x18, 0x5e, 0x3c, 0x5a, 0x8e, 0x98, 0x9a, 0x7c, 0x63, 0x63, 0x6b, 0x9a, 0x9e,
+    0xa2, 0xa1, 0x9d, 0x8a, 0x63, 0x63, 0x6a, 0x98, 0x9e, 0xa5, 0xa2, 0x9e, 0x8c, 0x82, 0x63, 0x05,
+    0x93, 0x9a, 0x8e, 0x79, 0x45, 0x4c, 0xd1, 0x70, 0x8b, 0x70, 0x21, 0x5b, 0x10, 0x6d, 0xa9, 0xa2,
+    0x9a, 0x43, 0x10, 0x10, 0x2e, 0x9a, 0x9f, 0xa7, 0xa2, 0x9a, 0x63, 0x0e, 0x0e, 0x15, 0x95, 0x9e,
+    0xa9, 0xa3, 0x9a, 0x7b, 0x0e, 0x0e, 0x10, 0x8c, 0x9a, 0xa6, 0xa2, 0x10, 0x30, 0xd1, 0x70, 0x8b,
+    0x70, 0x06, 0x65, 0x55, 0x53, 0x54, 0x8c, 0x9a, 0x93, 0x82, 0x8c, 0x05, 0x9a, 0x9e, 0x9f, 0x9e,
+    0x9a, 0x93, 0x82, 0x8c, 0x0e, 0x9a, 0x9d, 0x9f, 0x9f, 0x9a, 0x98, 0x8a, 0x8a, 0x8c, 0x98, 0x9a,
+    0x5a, 0x54, 0x55, 0x5c, 0x9d, 0x70, 0x02, 0x77, 0x95, 0x86, 0xb0, 0x70, 0x8d, 0x70, 0x02, 0x53,
+    0x15, 0x7b, 0x97, 0x9a, 0x03, 0x98, 0x2e, 0x29, 0x66, 0x9e, 0x70, 0x05, 0x78, 0x9a, 0x95, 0x70,
+    0x70, 0x66, 0xad, 0x70, 0x8d, 0x70, 0x02, 0x65, 0x5e, 0x45, 0x98, 0x2e, 0x01, 0x5c, 0x65, 0x9d,
+    0x70, 0x07, 0x71, 0x98, 0x95, 0x77, 0x86, 0x9a, 0x7f, 0x66, 0xad, 0x70, 0x8f, 0x70, 0x00, 0x4c,
+    0x83, 0x16, 0x01, 0x18, 0x18, 0x82, 0x16, 0x02, 0x18, 0x16, 0x18, 0x83, 0x16, 0x00, 0x18, 0x82,
+    0x16, 0x82, 0x18, 0x02, 0x16, 0x29, 0x65, 0x9e, 0x70, 0x07, 0x71, 0x96, 0x95, 0x77, 0x86, 0x9a,
+    0x7f, 0x66, 0xad, 0x70, 0x90, 0x70, 0x98, 0x65, 0x01, 0x66, 0x66, 0x9f, 0x70, 0x04, 0x78, 0x9a,
+    0x95, 0x70, 0x66, 0xac, 0x70, 0x01, 0x66, 0x70, 0xca, 0x70, 0x03, 0x66, 0x77, 0x95, 0x86, 0x91,
+    0x70, 0x01, 0x78, 0x78, 0x9c, 0x70, 0xdf, 0x70, 0x02, 0x77, 0x9a, 0x95, 0x9c, 0x70, 0xcf, 0x70,
+    0x00, 0x66, 0x8e, 0x70, 0x02, 0x71, 0x8d, 0x86, 0x9c, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70,
+    0xda, 0x70, 0x02, 0x86, 0x98, 0x78, 0x87, 0x70, 0x02, 0x86, 0x95, 0x78, 0x96, 0x70, 0xda, 0x70,
+    0x02, 0x86, 0x9a, 0x78, 0x87, 0x70, 0x02, 0x8d, 0x9a, 0x78, 0x96, 0x70, 0xda, 0x70, 0x01, 0x68,
+    0x68, 0x88, 0x70, 0x01, 0x71, 0x71, 0x97, 0x70, 0xda, 0x70, 0x00, 0x66, 0xa3, 0x70, 0xff, 0x70,
+    0x8e, 0x65, 0x8d, 0x70, 0x8a, 0x65, 0x00, 0x5e, 0x82, 0x65, 0x91, 0x70, 0x00, 0x66, 0xa1, 0x70,
+    0x01, 0x78, 0x78, 0x88, 0x70, 0x00, 0x66, 0x92, 0x70, 0x8d, 0x56, 0x00, 0x5e, 0x8d, 0x70, 0x8e,
+    0x56, 0x00, 0x66, 0x82, 0x70, 0x83, 0x66, 0xab, 0x70, 0x02, 0x77, 0x9a, 0x95, 0x9c, 0x70, 0x8d,
+    0x56, 0x00, 0x57, 0x84, 0x5e, 0x82, 0x65, 0x82, 0x5e, 0x02, 0x65, 0x5e, 0x5e, 0x8e, 0x56, 0x01,
+    0x5e, 0x65, 0x82, 0x5e, 0x01, 0x4e, 0x45, 0x82, 0x4c, 0x01, 0x45, 0x4c, 0x83, 0x45, 0x93, 0x4c,
+    0x00, 0x5b, 0x8e, 0x70, 0x02, 0x71, 0x86, 0x86, 0x9c, 0x70, 0xb0, 0x56, 0x00, 0x30, 0x9d, 0x00,
+    0x00, 0x4c, 0xae, 0x70, 0xae, 0x56, 0x02, 0x4c, 0x30, 0x6c, 0x9d, 0x8b, 0x02, 0x64, 0x38, 0x5c,
+    0xac, 0x70, 0xae, 0x56, 0x02, 0x3c, 0x00, 0x8b, 0x9d, 0xa4, 0x02, 0x76, 0x00, 0x53, 0xac, 0x70,
+    0x8d, 0x48, 0x00, 0x49, 0x8d, 0x56, 0x8e, 0x48, 0x05, 0x56, 0x4c, 0x16, 0x64, 0x97, 0x6c, 0x8e,
+    0x42, 0x00, 0x64, 0x84, 0xa4, 0x04, 0x90, 0x74, 0x74, 0x83, 0xa8, 0x83, 0xa4, 0x04, 0x9b, 0x97,
+    0x4b, 0x2a, 0x5e, 0xaa, 0x70, 0x8d, 0x48, 0x01, 0x49, 0x4f, 0x8c, 0x56, 0x8e, 0x48, 0x05, 0x4f,
+    0x3e, 0x00, 0x76, 0xa4, 0x6c, 0x8e, 0x1f, 0x00, 0x4b, 0x84, 0xa4, 0x04, 0x83, 0x73, 0x73, 0x74,
+    0xa8, 0x85, 0xa4, 0x02, 0x51, 0x00, 0x5e, 0xa9, 0x70, 0x00, 0x66, 0x8f, 0x48, 0x00, 0x3f, 0x89,
+    0x48, 0x01, 0x3f, 0x3f, 0x82, 0x48, 0x00, 0x3f, 0x8b, 0x48, 0x04, 0x3e, 0x00, 0x76, 0xa4, 0x6c,
+    0x8e, 0x1f, 0x00, 0x4b, 0x84, 0xa4, 0x04, 0x83, 0x72, 0x72, 0x74, 0xa8, 0x85, 0xa4, 0x02, 0x51,
+    0x00, 0x5e, 0xaa, 0x70, 0x00, 0x3f, 0x84, 0x48, 0x00, 0x3f, 0x88, 0x48, 0x00, 0x3f, 0x87, 0x48,
+    0x02, 0x3f, 0x48, 0x3f, 0x85, 0x48, 0x03, 0x3f, 0x48, 0x48, 0x3f, 0x82, 0x48, 0x08, 0x3f, 0x3f,
+    0x48, 0x48, 0x3d, 0x00, 0x76, 0xa4, 0x6c, 0x82, 0x1f, 0x88, 0x18, 0x03, 0x20, 0x1f, 0x1f, 0x4b,
+    0x84, 0xa4, 0x00, 0x89, 0x82, 0x74, 0x00, 0xa8, 0x85, 0xa4, 0x02, 0x51, 0x00, 0x5e, 0xaa, 0x70,
+    0x00, 0x3f, 0x86, 0x48, 0x00, 0x3f, 0x83, 0x48, 0x00, 0x3f, 0x95, 0x48, 0x02, 0x3f, 0x48, 0x3f,
+    0x84, 0x48, 0x09, 0x3f, 0x3d, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x03,
+    0x1a, 0x1f, 0x1f, 0x4b, 0x8f, 0xa4, 0x02, 0x51, 0x00, 0x5e, 0xa1, 0x70, 0x00, 0x66, 0x87, 0x70,
+    0x00, 0x3f, 0x8c, 0x39, 0x00, 0x3f, 0x84, 0x48, 0x08, 0x3f, 0x48, 0x3f, 0x48, 0x48, 0x3f, 0x3f,
+    0x48, 0x3f, 0x8e, 0x39, 0x09, 0x3f, 0x3d, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x85,
+    0x26, 0x07, 0x25, 0x25, 0x1a, 0x1f, 0x1f, 0x4b, 0xa4, 0x9b, 0x82, 0x94, 0x83, 0x9c, 0x86, 0xa4,
+    0x03, 0x51, 0x00, 0x5e, 0x65, 0x82, 0x53, 0x00, 0x5c, 0xa5, 0x70, 0x8d, 0x33, 0x01, 0x39, 0x3f,
+    0x8b, 0x48, 0x00, 0x3f, 0x8d, 0x33, 0x0a, 0x34, 0x3f, 0x3d, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f,
+    0x20, 0x2d, 0x87, 0x25, 0x05, 0x1a, 0x1f, 0x1f, 0x4b, 0xa4, 0x92, 0x82, 0x00, 0x04, 0x58, 0x73,
+    0x73, 0x74, 0xa8, 0x85, 0xa4, 0x07, 0x51, 0x00, 0x5e, 0x5e, 0x05, 0x00, 0x00, 0x36, 0xa5, 0x70,
+    0x8d, 0x33, 0x00, 0x34, 0x8d, 0x39, 0x8d, 0x33, 0x0a, 0x34, 0x39, 0x2c, 0x00, 0x76, 0xa4, 0x6c,
+    0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x05, 0x1a, 0x1f, 0x1f, 0x35, 0x7d, 0x6e, 0x82, 0x51, 0x04,
+    0x41, 0x4a, 0x69, 0x74, 0xa8, 0x85, 0xa4, 0x03, 0x51, 0x00, 0x45, 0x45, 0x82, 0x51, 0x02, 0x46,
+    0x4c, 0x5c, 0xa3, 0x70, 0xac, 0x33, 0x08, 0x24, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d,
+    0x87, 0x25, 0x05, 0x1a, 0x1f, 0x1f, 0x14, 0x00, 0x42, 0x82, 0x84, 0x04, 0x3b, 0x00, 0x60, 0x74,
+    0xa0, 0x85, 0xa4, 0x09, 0x51, 0x00, 0x00, 0x10, 0x7d, 0x7e, 0x84, 0x59, 0x00, 0x4c, 0x8b, 0x70,
+    0x00, 0x66, 0x96, 0x70, 0xac, 0x33, 0x08, 0x24, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d,
+    0x87, 0x25, 0x0d, 0x1a, 0x1f, 0x1f, 0x14, 0x00, 0x42, 0x84, 0x7e, 0x84, 0x6c, 0x64, 0x3a, 0x41,
+    0xa0, 0x85, 0xa4, 0x03, 0x51, 0x00, 0x59, 0x64, 0x82, 0x84, 0x02, 0x59, 0x00, 0x4c, 0xa3, 0x70,
+    0xac, 0x33, 0x08, 0x24, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x0d, 0x1a,
+    0x1f, 0x1f, 0x14, 0x00, 0x42, 0x84, 0x84, 0x7e, 0x7e, 0x7d, 0x20, 0x1f, 0xa0, 0x85, 0xa4, 0x09,
+    0x51, 0x01, 0x76, 0x84, 0x7e, 0x84, 0x84, 0x59, 0x00, 0x4c, 0xa3, 0x70, 0x8d, 0x24, 0x00, 0x2c,
+    0x8d, 0x33, 0x84, 0x24, 0x00, 0x1c, 0x85, 0x06, 0x0c, 0x07, 0x1d, 0x24, 0x33, 0x24, 0x00, 0x76,
+    0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x0c, 0x1a, 0x1f, 0x1f, 0x14, 0x00, 0x42, 0x84,
+    0x84, 0x7e, 0x84, 0x84, 0x76, 0x6c, 0x86, 0x42, 0x09, 0x64, 0x76, 0x7d, 0x7e, 0x84, 0x7e, 0x7e,
+    0x59, 0x00, 0x4c, 0xa3, 0x70, 0x82, 0x1c, 0x85, 0x24, 0x00, 0x1d, 0x82, 0x24, 0x01, 0x1c, 0x24,
+    0x8d, 0x33, 0x05, 0x24, 0x1c, 0x1c, 0x24, 0x1d, 0x1b, 0x85, 0x00, 0x0c, 0x01, 0x1c, 0x24, 0x33,
+    0x24, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x05, 0x1a, 0x1f, 0x1f, 0x14,
+    0x00, 0x42, 0x85, 0x84, 0x01, 0x7d, 0x09, 0x85, 0x00, 0x09, 0x64, 0x84, 0x7e, 0x7e, 0x84, 0x7e,
+    0x84, 0x59, 0x00, 0x4c, 0x9a, 0x70, 0x00, 0x66, 0x87, 0x70, 0x9f, 0x1c, 0x03, 0x1b, 0x01, 0x35,
+    0x7d, 0x83, 0x7e, 0x00, 0x35, 0x85, 0x00, 0x06, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87,
+    0x25, 0x0b, 0x1a, 0x1f, 0x1f, 0x14, 0x00, 0x42, 0x84, 0x7e, 0x84, 0x7e, 0x84, 0x84, 0x86, 0x7e,
+    0x02, 0x84, 0x84, 0x7e, 0x84, 0x84, 0x02, 0x59, 0x00, 0x4c, 0xa3, 0x70, 0x9f, 0x1c, 0x0b, 0x1b,
+    0x01, 0x2f, 0x76, 0x76, 0x84, 0x84, 0x7e, 0x42, 0x2f, 0x2f, 0x28, 0x82, 0x00, 0x06, 0x76, 0xa4,
+    0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x0c, 0x1a, 0x1f, 0x14, 0x1f, 0x2f, 0x51, 0x84, 0x7e,
+    0x7e, 0x84, 0x84, 0x7e, 0x7e, 0x82, 0x84, 0x05, 0x7e, 0x84, 0x84, 0x7e, 0x84, 0x7d, 0x84, 0x84,
+    0x04, 0x64, 0x2f, 0x4c, 0x5c, 0x65, 0xa1, 0x70, 0x9f, 0x1c, 0x0b, 0x1b, 0x01, 0x00, 0x01, 0x4b,
+    0x84, 0x84, 0x85, 0x7d, 0x7d, 0x7e, 0x76, 0x82, 0x00, 0x06, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20,
+    0x2d, 0x87, 0x25, 0x04, 0x1a, 0x1f, 0x00, 0x2f, 0x7d, 0x85, 0x84, 0x01, 0x7d, 0x7e, 0x85, 0x84,
+    0x03, 0x7d, 0x84, 0x7e, 0x7e, 0x82, 0x84, 0x05, 0x85, 0x84, 0x84, 0x4b, 0x01, 0x55, 0xa1, 0x70,
+    0x9f, 0x1c, 0x04, 0x1b, 0x07, 0x06, 0x06, 0x3b, 0x85, 0x64, 0x0a, 0x62, 0x42, 0x35, 0x00, 0x76,
+    0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x04, 0x1a, 0x1f, 0x00, 0x2f, 0x7d, 0x83, 0x84,
+    0x06, 0x97, 0xa0, 0x6c, 0x64, 0x7d, 0x84, 0x7e, 0x82, 0x84, 0x06, 0x7e, 0x84, 0x84, 0x9b, 0x9b,
+    0x64, 0x6c, 0x82, 0x84, 0x02, 0x4b, 0x00, 0x55, 0xa1, 0x70, 0x8d, 0x1b, 0x8e, 0x1c, 0x86, 0x1b,
+    0x00, 0x0b, 0x85, 0x00, 0x0a, 0x1f, 0x7d, 0x64, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d,
+    0x87, 0x25, 0x04, 0x1a, 0x1f, 0x00, 0x2f, 0x7e, 0x82, 0x84, 0x09, 0x7e, 0xac, 0xb1, 0x42, 0x0e,
+    0x7d, 0x7e, 0x84, 0x84, 0x7d, 0x82, 0x84, 0x0a, 0x85, 0xaf, 0xad, 0x14, 0x2f, 0x84, 0x7e, 0x84,
+    0x4b, 0x00, 0x55, 0xa1, 0x70, 0x8e, 0x1b, 0x02, 0x1c, 0x22, 0x1b, 0x8a, 0x1c, 0x86, 0x1b, 0x00,
+    0x12, 0x84, 0x0b, 0x0b, 0x01, 0x09, 0x51, 0x42, 0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d,
+    0x87, 0x25, 0x05, 0x1a, 0x1f, 0x00, 0x2f, 0x84, 0x7e, 0x82, 0x84, 0x04, 0x94, 0x97, 0x28, 0x0e,
+    0x7d, 0x82, 0x84, 0x08, 0x7e, 0x6c, 0x51, 0x76, 0x84, 0x94, 0x92, 0x09, 0x2f, 0x82, 0x84, 0x02,
+    0x4b, 0x00, 0x55, 0xa1, 0x70, 0xa8, 0x1b, 0x01, 0x13, 0x01, 0x83, 0x00, 0x06, 0x76, 0xa4, 0x6c,
+    0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x19, 0x1a, 0x1f, 0x00, 0x2f, 0x7e, 0x84, 0x84, 0x7d, 0x84,
+    0x3b, 0x00, 0x00, 0x0e, 0x7d, 0x7e, 0x84, 0x7e, 0x84, 0x4b, 0x00, 0x64, 0x7d, 0x1f, 0x00, 0x00,
+    0x2f, 0x82, 0x84, 0x02, 0x4b, 0x00, 0x55, 0xa1, 0x70, 0xa9, 0x1b, 0x0b, 0x12, 0x0c, 0x0c, 0x11,
+    0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x0d, 0x1a, 0x1f, 0x00, 0x2f, 0x7e,
+    0x91, 0xab, 0xab, 0xaa, 0x89, 0x64, 0x64, 0x6c, 0x7d, 0x83, 0x84, 0x07, 0x76, 0x64, 0x76, 0x7e,
+    0x6c, 0x64, 0x64, 0x89, 0x82, 0xab, 0x02, 0x75, 0x00, 0x55, 0xa1, 0x70, 0xac, 0x1b, 0x08, 0x12,
+    0x00, 0x76, 0xa4, 0x6c, 0x1f, 0x1f, 0x20, 0x2d, 0x87, 0x25, 0x05, 0x1a, 0x1f, 0x00, 0x2f, 0x7e,
+    0x99, 0x82, 0xb0, 0x01, 0x99, 0x7e, 0x85, 0x84, 0x08, 0x7e, 0x84, 0x7e, 0x7e, 0x84, 0x7e, 0x7e,
+    0x7d, 0x91, 0x82, 0xb0, 0x02, 0x8f, 0x00, 0x55, 0xa1, 0x70, 0x8d, 0x0d, 0x00, 0x13, 0x8d, 0x1b,
+    0x8d, 0x0d, 0x06, 0x13, 0x1b, 0x12, 0x00, 0x76, 0xa4, 0x6c, 0x82, 0x1f, 0x88, 0x18, 0x05, 0x20,
+    0x1f, 0x00, 0x2f, 0x84, 0x99, 0x82, 0xb0, 0x10, 0x99, 0x84, 0x2f, 0x28, 0x7d, 0x84, 0x7e, 0x64,
+    0x1f, 0x59, 0x7e, 0x84, 0x7d, 0x2f, 0x28, 0x7d, 0x91, 0x82, 0xb0, 0x02, 0x8f, 0x00, 0x55, 0xa1,
+    0x70, 0x8d, 0x0c, 0x00, 0x13, 0x8d, 0x1b, 0x04, 0x0d, 0x12, 0x0c, 0x0c, 0x12, 0x88, 0x0c, 0x06,
+    0x12, 0x13, 0x0b, 0x00, 0x76, 0xa4, 0x6c, 0x86, 0x1f, 0x00, 0x27, 0x86, 0x1f, 0x02, 0x35, 0x7d,
+    0x99, 0x82, 0xae, 0x09, 0x99, 0x84, 0x20, 0x0e, 0x76, 0x7d, 0x7d, 0x59, 0x00, 0x51, 0x82, 0x7d,
+    0x03, 0x1f, 0x14, 0x7d, 0x91, 0x82, 0xae, 0x02, 0x83, 0x0a, 0x55, 0xa1, 0x70, 0x8c, 0x0c, 0x02,
+    0x12, 0x0d, 0x0d, 0x82, 0x0c, 0x85, 0x0d, 0x04, 0x0c, 0x0d, 0x0d, 0x0c, 0x12, 0x8d, 0x0c, 0x05,
+    0x01, 0x01, 0x00, 0x76, 0xa4, 0x6c, 0x85, 0x1f, 0x02, 0x3a, 0x69, 0x40, 0x83, 0x1f, 0x04, 0x14,
+    0xa0, 0x97, 0x0e, 0x4b, 0x84, 0x84, 0x01, 0x20, 0x00, 0x82, 0x09, 0x02, 0x04, 0x00, 0x04, 0x82,
+    0x09, 0x08, 0x00, 0x14, 0x7d, 0x84, 0x84, 0x62, 0x1e, 0x4c, 0x65, 0xa2, 0x70, 0x8f, 0x0c, 0x00,
+    0x12, 0x98, 0x0c, 0x01, 0x0b, 0x0b, 0x82, 0x00, 0x02, 0x64, 0x97, 0x6c, 0x85, 0x42, 0x02, 0x50,
+    0x74, 0x61, 0x84, 0x42, 0x05, 0xa4, 0x9b, 0x42, 0x51, 0x6c, 0x76, 0x82, 0x7e, 0x03, 0x35, 0x2f,
+    0x2f, 0x28, 0x87, 0x2f, 0x06, 0x35, 0x7d, 0x7d, 0x6c, 0x51, 0x17, 0x4d, 0xa3, 0x70, 0xa6, 0x0c,
+    0x03, 0x12, 0x0c, 0x0c, 0x01, 0x85, 0x00, 0x00, 0x8b, 0x90, 0xa4, 0x03, 0x94, 0x00, 0x59, 0x84,
+    0x89, 0x85, 0x08, 0x84, 0x85, 0x85, 0x84, 0x85, 0x84, 0x6c, 0x00, 0x36, 0xa5, 0x70, 0x8d, 0x3d,
+    0x00, 0x32, 0x8d, 0x0c, 0x00, 0x32, 0x89, 0x3d, 0x02, 0x18, 0x11, 0x3b, 0x83, 0x42, 0x02, 0x2f,
+    0x00, 0x64, 0x90, 0x8b, 0x03, 0x6c, 0x00, 0x3b, 0x64, 0x87, 0x62, 0x00, 0x64, 0x83, 0x62, 0x05,
+    0x64, 0x62, 0x62, 0x59, 0x38, 0x4d, 0xa5, 0x70, 0x82, 0x70, 0x8a, 0x66, 0x00, 0x4e, 0x8d, 0x0c,
+    0x00, 0x56, 0x87, 0x70, 0x09, 0x66, 0x70, 0x2b, 0x04, 0x76, 0x84, 0x7e, 0x85, 0x84, 0x59, 0xa6,
+    0x00, 0x01, 0x2a, 0x66, 0xa6, 0x70, 0x8d, 0x70, 0x00, 0x5c, 0x8d, 0x4d, 0x00, 0x5e, 0x89, 0x70,
+    0x11, 0x2b, 0x04, 0x76, 0x84, 0x84, 0x76, 0x4b, 0x44, 0x45, 0x29, 0x00, 0x4b, 0x59, 0x59, 0x4b,
+    0x00, 0x16, 0x45, 0x88, 0x4c, 0x02, 0x36, 0x00, 0x35, 0x82, 0x59, 0x05, 0x0e, 0x05, 0x45, 0x3c,
+    0x00, 0x2f, 0x82, 0x59, 0x05, 0x28, 0x00, 0x45, 0x4c, 0x4c, 0x4d, 0xa7, 0x70, 0x8d, 0x70, 0x00,
+    0x66, 0x83, 0x70, 0x00, 0x66, 0x8a, 0x70, 0x00, 0x66, 0x87, 0x70, 0x10, 0x2a, 0x04, 0x76, 0x85,
+    0x84, 0x6c, 0x00, 0x3c, 0x70, 0x36, 0x00, 0x6c, 0x85, 0x85, 0x76, 0x00, 0x30, 0x89, 0x70, 0x11,
+    0x53, 0x00, 0x51, 0x7e, 0x7e, 0x84, 0x20, 0x0a, 0x65, 0x5b, 0x00, 0x42, 0x7e, 0x7e, 0x85, 0x3b,
+    0x00, 0x5c, 0xaa, 0x70, 0x9f, 0x70, 0x00, 0x66, 0x86, 0x70, 0x01, 0x2b, 0x01, 0x82, 0x35, 0x06,
+    0x37, 0x53, 0x5c, 0x70, 0x5c, 0x53, 0x3b, 0x82, 0x35, 0x01, 0x00, 0x30, 0x89, 0x70, 0x02, 0x5e,
+    0x55, 0x45, 0x82, 0x35, 0x05, 0x09, 0x0a, 0x65, 0x65, 0x53, 0x4c, 0x82, 0x35, 0x02, 0x0e, 0x00,
+    0x5c, 0x9b, 0x70, 0x00, 0x66, 0x8d, 0x70, 0xa7, 0x70, 0x00, 0x2b, 0x83, 0x00, 0x00, 0x2b, 0x84,
+    0x70, 0x00, 0x2a, 0x83, 0x00, 0x00, 0x30, 0x8b, 0x70, 0x00, 0x45, 0x83, 0x00, 0x04, 0x0a, 0x65,
+    0x70, 0x70, 0x4d, 0x83, 0x00, 0x01, 0x01, 0x5c, 0xaa, 0x70, 0xa7, 0x70, 0x06, 0x65, 0x5c, 0x5e,
+    0x5c, 0x5e, 0x65, 0x66, 0x83, 0x70, 0x00, 0x65, 0x82, 0x5e, 0x01, 0x5c, 0x65, 0x8b, 0x70, 0x00,
+    0x65, 0x84, 0x5c, 0x82, 0x70, 0x01, 0x65, 0x5e, 0x83, 0x5c, 0xab, 0x70, 0xff, 0x70, 0xff, 0x70,
+    0xff, 0x70, 0xff, 0x70, 0xff, 0x70, 0xd0, 0x70, 0x00, 0x66, 0xad, 0x70, 0xab, 0x70, 0x00, 0x66,
+    0xac, 0x70, 0x00, 0x66, 0x98, 0x70, 0x00, 0x66, 0x8a, 0x70, 0xff, 0x70, 0xff, 0x70, 0xff, 0x70,
+    0xff, 0x70, 0xcc, 0x70, 0x01, 0x71, 0x71, 0xb0, 0x70, 0xcb, 0x70, 0x02, 0x78, 0x9a, 0x8d, 0xb0,
+    0x70, 0xa1, 0x70, 0x00, 0x65, 0x89, 0x55, 0x85, 0x4e, 0x00, 0x65, 0x97, 0x70, 0x02, 0x78, 0x9a,
+    0x95, 0xb0, 0x70, 0xa1, 0x70, 0x00, 0x55, 0x8f, 0x02, 0x00, 0x56, 0x90, 0x70, 0x00, 0x66, 0x85,
+    0x70, 0x03, 0x78, 0x9a, 0x8d, 0x66, 0x94, 0x70, 0x87, 0x66, 0x92, 0x70, 0x9c, 0x70, 0x00, 0x4e,
+    0x83, 0x4d, 0x00, 0x3d, 0x8f, 0x02, 0x02, 0x3d, 0x4d, 0x65, 0x8e, 0x70, 0x00, 0x5c, 0x85, 0x4e,
+    0x02, 0x5c, 0x77, 0x6f, 0x84, 0x4e, 0x00, 0x65, 0x8e, 0x70, 0x00, 0x5c, 0x89, 0x4d, 0x00, 0x5b,
+    0x8f, 0x70, 0x9c, 0x70, 0x00, 0x31, 0x95, 0x02, 0x02, 0x0b, 0x65, 0x66, 0x8d, 0x70, 0x00, 0x48,
+    0x87, 0x1c, 0x01, 0x1d, 0x1d, 0x83, 0x1c, 0x00, 0x65, 0x8e, 0x70, 0x00, 0x4d, 0x89, 0x02, 0x00,
+    0x3e, 0x8f, 0x70, 0x82, 0x3e, 0x00, 0x4e, 0x90, 0x70, 0x01, 0x65, 0x3d, 0x85, 0x38, 0x00, 0x12,
+    0x95, 0x02, 0x00, 0x03, 0x82, 0x38, 0x00, 0x4d, 0x87, 0x70, 0x00, 0x5e, 0x82, 0x3e, 0x00, 0x2c,
+    0x8d, 0x1c, 0x82, 0x3e, 0x00, 0x4e, 0x87, 0x70, 0x04, 0x65, 0x3d, 0x38, 0x38, 0x22, 0x89, 0x02,
+    0x00, 0x21, 0x82, 0x38, 0x00, 0x5e, 0x87, 0x70, 0x00, 0x4e, 0x82, 0x3e, 0x82, 0x1c, 0x01, 0x3e,
+    0x66, 0x8f, 0x70, 0x01, 0x5e, 0x08, 0xa0, 0x02, 0x00, 0x32, 0x87, 0x70, 0x02, 0x5e, 0x23, 0x23,
+    0x92, 0x1c, 0x03, 0x2c, 0x70, 0x70, 0x66, 0x84, 0x70, 0x01, 0x5e, 0x08, 0x90, 0x02, 0x02, 0x56,
+    0x70, 0x66, 0x85, 0x70, 0x00, 0x3e, 0x82, 0x1c, 0x82, 0x1c, 0x04, 0x32, 0x2c, 0x3d, 0x3d, 0x5e,
+    0x87, 0x70, 0x00, 0x4d, 0x84, 0x22, 0x00, 0x07, 0xa0, 0x02, 0x02, 0x0c, 0x22, 0x32, 0x85, 0x3d,
+    0x02, 0x2c, 0x23, 0x23, 0x92, 0x1c, 0x00, 0x24, 0x82, 0x2c, 0x02, 0x4f, 0x70, 0x3d, 0x82, 0x22,
+    0x00, 0x07, 0x90, 0x02, 0x05, 0x21, 0x22, 0x22, 0x32, 0x70, 0x5c, 0x82, 0x2c, 0x00, 0x32, 0x82,
+    0x1c, 0x83, 0x1c, 0x82, 0x23, 0x01, 0x56, 0x66, 0x82, 0x65, 0x04, 0x66, 0x70, 0x70, 0x65, 0x3d,
+    0xa5, 0x02, 0x82, 0x03, 0x00, 0x13, 0x9b, 0x1c, 0x00, 0x23, 0x82, 0x1c, 0x02, 0x4e, 0x66, 0x22,
+    0x97, 0x02, 0x02, 0x19, 0x5f, 0x56, 0x86, 0x1c, 0x86, 0x1c, 0x00, 0x24, 0x83, 0x32, 0x04, 0x3e,
+    0x70, 0x4e, 0x12, 0x0b, 0xa4, 0x02, 0x00, 0x08, 0x83, 0x1c, 0x01, 0x1d, 0x1d, 0x9d, 0x1c, 0x02,
+    0x24, 0x32, 0x0c, 0x95, 0x02, 0x04, 0x03, 0x1b, 0x1c, 0x24, 0x24, 0x86, 0x1c, 0x8b, 0x1c, 0x04,
+    0x2c, 0x5e, 0x4d, 0x08, 0x03, 0x9e, 0x02, 0x85, 0x08, 0x01, 0x0c, 0x23, 0x95, 0x1c, 0x03, 0x23,
+    0x23, 0x1c, 0x1d, 0x8a, 0x1c, 0x00, 0x0c, 0x82, 0x08, 0x8f, 0x02, 0x83, 0x08, 0x8a, 0x1c, 0x8d,
+    0x1c, 0x02, 0x1d, 0x1c, 0x0d, 0x9d, 0x02, 0x00, 0x0d, 0xb0, 0x1c, 0x00, 0x03, 0x8e, 0x02, 0x01,
+    0x1b, 0x23, 0x8c, 0x1c, 0x8f, 0x1c, 0x00, 0x13, 0x84, 0x0c, 0x96, 0x02, 0x02, 0x07, 0x0c, 0x13,
+    0x87, 0x1c, 0x00, 0x1d, 0xa7, 0x1c, 0x82, 0x0c, 0x00, 0x08, 0x89, 0x02, 0x02, 0x08, 0x0c, 0x1b,
+    0x8d, 0x1c, 0x91, 0x1c, 0x00, 0x23, 0x82, 0x1c, 0x00, 0x03, 0x95, 0x02, 0x00, 0x0c, 0xb5, 0x1c,
+    0x00, 0x13, 0x89, 0x02, 0x00, 0x13, 0x8f, 0x1c, 0x93, 0x1c, 0x01, 0x1d, 0x1c, 0x82, 0x13, 0x00,
+    0x0c, 0x8d, 0x02, 0x00, 0x0c, 0x83, 0x0d, 0x00, 0x1b, 0xb5, 0x1c, 0x00, 0x1b, 0x89, 0x13, 0x00,
+    0x1b, 0x8f, 0x1c, 0x98, 0x1c, 0x00, 0x13, 0x8d, 0x02, 0x00, 0x1b, 0xd6, 0x1c, 0x99, 0x1c, 0x8d,
+    0x1b, 0xd7, 0x1c, 0xa7, 0x1c, 0x00, 0x23, 0xd6, 0x1c, 0xff, 0x1c, 0xe1, 0x1c, 0x00, 0x1d, 0x8f,
+    0x24, 0x00, 0x23, 0x8b, 0x1c, 0xe1, 0x1c, 0x03, 0x3e, 0x80, 0x81, 0x81, 0x86, 0x80, 0x00, 0x81,
+    0x82, 0x80, 0x02, 0x81, 0x80, 0x3e, 0x8b, 0x1c, 0xd3, 0x1c, 0x8d, 0x2c, 0x01, 0x47, 0x82, 0x82,
+    0x88, 0x00, 0x82, 0x8a, 0x88, 0x00, 0x47, 0x8b, 0x2c, 0xd3, 0x1c, 0x01, 0x7a, 0x80, 0x84, 0x87,
+    0x0a, 0x80, 0x87, 0x87, 0x80, 0x80, 0x88, 0x87, 0x82, 0x88, 0x82, 0x82, 0x82, 0x88, 0x03, 0x82,
+    0x88, 0x82, 0x82, 0x89, 0x88, 0x05, 0x82, 0x88, 0x82, 0x88, 0x82, 0x88, 0x82, 0x82, 0x95, 0x47,
+    0xb0, 0x1c, 0x00, 0x3e, 0x8b, 0x47, 0x00, 0x80, 0x8b, 0x88, 0x00, 0x87, 0x9d, 0x88, 0x94, 0x88,
+    0x01, 0x7a, 0x24, 0x8b, 0x1c, 0x00, 0x1d, 0x86, 0x1c, 0x01, 0x1d, 0x1c, 0x82, 0x1d, 0x01, 0x1c,
+    0x1d, 0x83, 0x1c, 0x00, 0x1d, 0x83, 0x1c, 0x03, 0x1d, 0x1c, 0x1c, 0x1d, 0x82, 0x1c, 0x05, 0x1d,
+    0x1c, 0x1c, 0x1d, 0x1c, 0x67, 0xb7, 0x88, 0x94, 0x88, 0x00, 0x80, 0xb0, 0x5d, 0x00, 0x7a, 0xb7,
+    0x88, 0x96, 0x88, 0xae, 0x82, 0xa7, 0x88, 0x00, 0x87, 0x90, 0x88, 0xff, 0x88, 0xff, 0x88, 0xff,
+    0x88, 0x91, 0x88, 0x00, 0x87, 0x99, 0x88, 0x03, 0x82, 0x88, 0x88, 0x87, 0xce, 0x88,
+};
+
+// 183 colors, 9602 bytes (raw: 32768)
+static constexpr uint16_t cat_pal_5[] = {
+    0x0000, 0x0861, 0x0881, 0x09a1, 0x09c1, 0x10a2, 0x1102, 0x1162, 0x11a1, 0x11e2, 0x18c2, 0x1923,
+    0x19e2, 0x1a23, 0x2124, 0x2143, 0x2144, 0x21a3, 0x21a4, 0x21e4, 0x2224, 0x2244, 0x2944, 0x2946,
+    0x2983, 0x29a3, 0x2a25, 0x2a63, 0x2a66, 0x2a85, 0x2aa4, 0x2ac4, 0x2ae5, 0x2b05, 0x3186, 0x31a6,
+    0x31e4, 0x32a4, 0x32a6, 0x32e5, 0x3306, 0x34a6, 0x34c6, 0x3966, 0x39c7, 0x3a05, 0x3a24, 0x3a45,
+    0x3a64, 0x3ae4, 0x3b06, 0x3b43, 0x3b67, 0x3c87, 0x4226, 0x4228, 0x42a6, 0x42e4, 0x43a8, 0x43e7,
+    0x4a66, 0x4a69, 0x4ae6, 0x4b84, 0x4be7, 0x5126, 0x5187, 0x526a, 0x528a, 0x5306, 0x5366, 0x5367,
+    0x53a7, 0x53a8, 0x53e8, 0x5428, 0x58e6, 0x5aeb, 0x5b28, 0x5b47, 0x5b6a, 0x5b87, 0x5c09, 0x5c22,
+    0x5c28, 0x5c48, 0x6106, 0x6309, 0x632c, 0x63a9, 0x63c7, 0x63c8, 0x6425, 0x6429, 0x6b2c, 0x6b68,
+    0x6b6d, 0x6bc9, 0x6c2a, 0x6c69, 0x6c6a, 0x73ae, 0x7429, 0x742a, 0x7449, 0x746a, 0x7489, 0x748a,
+    0x74a3, 0x7b4d, 0x7baf, 0x7bca, 0x7bcf, 0x7c0f, 0x7ca9, 0x7caa, 0x7cca, 0x7ce4, 0x7ce9, 0x8005,
+    0x8047, 0x842b, 0x8430, 0x84ab, 0x84ca, 0x850b, 0x8542, 0x8827, 0x8846, 0x89c9, 0x8b4c, 0x8c6c,
+    0x8c71, 0x9471, 0x948d, 0x94b2, 0x94d3, 0x94eb, 0x94f0, 0x950b, 0x954c, 0x95c3, 0x9b6f, 0x9b8f,
+    0x9cb3, 0x9cd3, 0x9cee, 0x9d6d, 0x9dc1, 0xa514, 0xa52e, 0xa5ae, 0xa5b1, 0xab2c, 0xac32, 0xac92,
+    0xad34, 0xad6f, 0xad75, 0xb596, 0xb5af, 0xb5ef, 0xb60f, 0xbd75, 0xbdcf, 0xbdf0, 0xbdf7, 0xbe31,
+    0xc4b3, 0xc610, 0xc638, 0xc672, 0xc6b2, 0xccb3, 0xce59, 0xceb2, 0xcef3, 0xcf34, 0xcf55, 0xe73c,
+    0xef5d, 0xfcb3, 0xffff,
+};
+static constexpr uint16_t cat_row_5[] = {
+    0, 40, 102, 172, 249, 326, 407, 489, 569, 638, 711, 790, 863, 926, 1003, 1090,
+    1184, 1262, 1362, 1443, 1530, 1621, 1712, 1797, 1892, 1969, 2042, 2124, 2224, 2313, 2414, 2488,
+    2559, 2634, 2735, 2826, 2910, 2992, 3083, 3173, 3247, 3314, 3387, 3469, 3552, 3618, 3669, 3753,
+    3811, 3864, 3922, 3971, 4039, 4112, 4184, 4277, 4358, 4440, 4518, 4586, 4648, 4723, 4798, 4881,
+    4969, 5045, 5119, 5196, 5268, 5354, 5443, 5520, 5598, 5676, 5757, 5833, 5901, 5959, 6012, 6076,
+    6129, 6227, 6318, 6432, 6533, 6646, 6740, 6852, 6964, 7051, 7131, 7220, 7317, 7394, 7477, 7575,
+    7668, 7755, 7844, 7917, 7995, 8081, 8164, 8251, 8301, 8356, 8385, 8417, 8454, 8478, 8509, 8531,
+    8558, 8568, 8580, 8586, 8592, 8602, 8613, 8640, 8679, 8704, 8742, 8789, 8836, 8860, 8901, 8936,
+};
+static constexpr uint8_t cat_code_5[] = {
+    0x03, 0x7c, 0x7c, 0x74, 0x7c, 0xb3, 0x74, 0x05, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x8f, 0x74,
+    0x02, 0x7c, 0x74, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c,
+    0x8a, 0x74, 0x87, 0x7c, 0x87, 0x74, 0x00, 0x7c, 0x02, 0x7c, 0x74, 0x76, 0x8b, 0x74, 0x02, 0x7c,
+    0x74, 0x7c, 0x8a, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x93, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x88, 0x74,
+    0x08, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x8c, 0x74, 0x04, 0x7c, 0x74, 0x7c,
+    0x74, 0x7c, 0x89, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x8b, 0x74, 0x06, 0x7c,
+    0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x08, 0x74, 0x76, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c,
+    0x88, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x84, 0x7c, 0x89, 0x74, 0x05, 0x7c, 0x74, 0x7c, 0x74, 0x7c,
+    0x74, 0x82, 0x7c, 0x88, 0x74, 0x02, 0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x8c,
+    0x74, 0x02, 0x7c, 0x74, 0x7c, 0x8b, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x89,
+    0x74, 0x01, 0x7c, 0x74, 0x86, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x01, 0x74, 0x7c, 0x85,
+    0x74, 0x02, 0x7c, 0x74, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x8d, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74,
+    0x7c, 0x88, 0x74, 0x08, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x86, 0x74, 0x00,
+    0x7c, 0x83, 0x74, 0x08, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x85, 0x74, 0x85,
+    0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x88, 0x7c, 0x01, 0x74, 0x7c, 0x84, 0x74, 0x07, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x82, 0x7c, 0x85, 0x74, 0x83, 0x7c, 0x82,
+    0x74, 0x02, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x0c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c,
+    0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x8a, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x8a,
+    0x74, 0x00, 0x7c, 0x85, 0x74, 0x01, 0x7c, 0x7c, 0x8a, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x00, 0x7c,
+    0x8b, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x88, 0x74, 0x08, 0x7c, 0x74, 0x74,
+    0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x06, 0x74, 0x76, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x87, 0x74,
+    0x03, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x87, 0x74, 0x01, 0x7c,
+    0x7c, 0x89, 0x74, 0x01, 0x7c, 0x7c, 0x84, 0x74, 0x01, 0x7c, 0x7c, 0x87, 0x74, 0x08, 0x7c, 0x74,
+    0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x8a, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x7c,
+    0x83, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x06, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x8b, 0x74,
+    0x00, 0x7c, 0x84, 0x74, 0x01, 0x7c, 0x7c, 0x03, 0x7c, 0x74, 0x7c, 0x7c, 0x85, 0x74, 0x04, 0x7c,
+    0x7c, 0x74, 0x7c, 0x74, 0x83, 0x7c, 0x03, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74,
+    0x7c, 0x84, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x85, 0x7c,
+    0x88, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x83, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x88, 0x74, 0x83,
+    0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x8b, 0x74, 0x07, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c,
+    0x89, 0x74, 0x82, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x74, 0x07, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x7c, 0x7c, 0x89, 0x74, 0x01, 0x7c, 0x74, 0x84, 0x7c, 0x88, 0x74, 0x0b, 0x7c, 0x74, 0x74, 0x7c,
+    0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x84, 0x74, 0x07, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x74, 0x84, 0x7c, 0x88, 0x74, 0x01, 0x7c, 0x74, 0x84, 0x7c, 0x01, 0x74, 0x7c, 0x82,
+    0x74, 0x02, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x87, 0x74, 0x83, 0x7c,
+    0x8a, 0x74, 0x01, 0x7c, 0x74, 0x83, 0x7c, 0x82, 0x74, 0x08, 0x7c, 0x76, 0x74, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x7c, 0x8a, 0x74, 0x84, 0x7c, 0x8b, 0x74, 0x05, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74,
+    0x82, 0x7c, 0x8a, 0x74, 0x01, 0x7c, 0x7c, 0x8c, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x01, 0x74,
+    0x74, 0x82, 0x7c, 0x06, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x86, 0x7c, 0x83,
+    0x74, 0x02, 0x7c, 0x74, 0x7c, 0x8c, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x03, 0x7c,
+    0x74, 0x7c, 0x7c, 0x84, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x89,
+    0x74, 0x03, 0x7c, 0x7c, 0x74, 0x74, 0x84, 0x7c, 0x8a, 0x74, 0x84, 0x7c, 0x8c, 0x74, 0x00, 0x7c,
+    0x82, 0x74, 0x82, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x74, 0x88, 0x7c, 0x86, 0x74, 0x08, 0x7c, 0x7c,
+    0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x82,
+    0x7c, 0x83, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x04, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x09,
+    0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x84, 0x74, 0x05, 0x7c, 0x7c, 0x74,
+    0x74, 0x7c, 0x7c, 0x8b, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x8e, 0x74,
+    0x00, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x89, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x02, 0x74,
+    0x7c, 0x7c, 0x89, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x84, 0x74, 0x82, 0x7c, 0x01,
+    0x74, 0x7c, 0x87, 0x74, 0x00, 0x7c, 0x07, 0x7c, 0x76, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x87,
+    0x74, 0x00, 0x7c, 0x82, 0x74, 0x83, 0x7c, 0x04, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x00,
+    0x74, 0x83, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x06, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74,
+    0x7c, 0x89, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74, 0x83, 0x7c, 0x88, 0x74, 0x83, 0x7c, 0x01, 0x74,
+    0x7c, 0x8f, 0x74, 0x85, 0x7c, 0x8a, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x05,
+    0x74, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x92, 0x74, 0x00, 0x7c,
+    0x82, 0x74, 0x01, 0x7c, 0x7c, 0x87, 0x74, 0x05, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x84, 0x74,
+    0x03, 0x7c, 0x74, 0x7c, 0x7c, 0x8f, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x82,
+    0x74, 0x85, 0x7c, 0x01, 0x74, 0x7c, 0x86, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x87, 0x7c, 0x03, 0x74,
+    0x7c, 0x74, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x87, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x00,
+    0x7c, 0x89, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x04, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x03,
+    0x7c, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x07, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x82,
+    0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x90, 0x74, 0x86, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x82,
+    0x74, 0x02, 0x7c, 0x74, 0x74, 0x84, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x76, 0x7c, 0x74,
+    0x7c, 0x84, 0x74, 0x87, 0x7c, 0x07, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x68, 0x85, 0x5b,
+    0x03, 0x61, 0x74, 0x74, 0x7c, 0x83, 0x74, 0x05, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x89, 0x74,
+    0x85, 0x7c, 0x01, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x84,
+    0x7c, 0x02, 0x74, 0x74, 0x7c, 0x83, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x89, 0x74, 0x00, 0x7c,
+    0x82, 0x74, 0x83, 0x7c, 0x86, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x74,
+    0x7c, 0x7c, 0x07, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x86, 0x74, 0x84, 0x7c, 0x06,
+    0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x59, 0x0e, 0x84, 0x10, 0x04, 0x24, 0x73, 0x74, 0x7c, 0x7c, 0x84,
+    0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x86, 0x7c, 0x0b, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x83, 0x7c, 0x04, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x87, 0x74, 0x06, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x01,
+    0x7c, 0x7c, 0x87, 0x74, 0x85, 0x7c, 0x03, 0x74, 0x7c, 0x74, 0x74, 0x84, 0x7c, 0x01, 0x74, 0x74,
+    0x03, 0x74, 0x7c, 0x74, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x8b, 0x74, 0x03, 0x7c, 0x6a, 0x4f, 0x4f,
+    0x86, 0x51, 0x03, 0x4f, 0x59, 0x7c, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x88,
+    0x74, 0x05, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x89, 0x74, 0x02, 0x7c, 0x74, 0x74,
+    0x82, 0x7c, 0x01, 0x74, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x7c,
+    0x74, 0x85, 0x7c, 0x89, 0x74, 0x87, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x74, 0x84, 0x7c, 0x05, 0x74,
+    0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x05, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x82, 0x74,
+    0x07, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x66, 0x10, 0x45, 0x85, 0x74, 0x06, 0x69, 0x10, 0x38, 0x7c,
+    0x7c, 0x74, 0x7c, 0x86, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x84, 0x7c, 0x05, 0x74, 0x74, 0x7c, 0x74,
+    0x7c, 0x74, 0x83, 0x7c, 0x05, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x84, 0x74, 0x03,
+    0x7c, 0x74, 0x7c, 0x7c, 0x87, 0x74, 0x0a, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x74,
+    0x7c, 0x7c, 0x86, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x74, 0x7c,
+    0x88, 0x74, 0x07, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x82,
+    0x74, 0x82, 0x7c, 0x04, 0x73, 0x38, 0x45, 0x5d, 0x68, 0x85, 0x74, 0x04, 0x73, 0x66, 0x5b, 0x38,
+    0x59, 0x89, 0x74, 0x82, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c,
+    0x83, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x02,
+    0x7c, 0x7c, 0x74, 0x84, 0x7c, 0x02, 0x74, 0x7c, 0x74, 0x84, 0x7c, 0x83, 0x74, 0x86, 0x7c, 0x88,
+    0x74, 0x88, 0x7c, 0x04, 0x7c, 0x76, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x83,
+    0x7c, 0x83, 0x74, 0x06, 0x7c, 0x73, 0x10, 0x3c, 0x74, 0x74, 0x7c, 0x84, 0x74, 0x07, 0x7c, 0x7c,
+    0x66, 0x10, 0x4e, 0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x88, 0x74, 0x08, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x88, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x82, 0x7c,
+    0x01, 0x74, 0x7c, 0x88, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x7c,
+    0x86, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x8c, 0x74, 0x07, 0x74, 0x76, 0x74, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x0b, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x6a,
+    0x10, 0x38, 0x74, 0x5b, 0x2d, 0x5b, 0x82, 0x74, 0x07, 0x2f, 0x2f, 0x73, 0x62, 0x10, 0x4f, 0x74,
+    0x74, 0x83, 0x7c, 0x01, 0x74, 0x7c, 0x8b, 0x74, 0x83, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x86, 0x74,
+    0x09, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x89, 0x74, 0x09, 0x7c, 0x74,
+    0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x74, 0x85, 0x7c, 0x02,
+    0x74, 0x74, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x07, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c,
+    0x74, 0x7c, 0x84, 0x74, 0x13, 0x7c, 0x74, 0x7c, 0x7c, 0x6a, 0x10, 0x38, 0x7c, 0x5b, 0x23, 0x59,
+    0x73, 0x6a, 0x69, 0x2f, 0x2f, 0x73, 0x62, 0x10, 0x4e, 0x89, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x01,
+    0x7c, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x01, 0x7c, 0x74, 0x84, 0x7c, 0x03, 0x74, 0x74,
+    0x7c, 0x7c, 0x85, 0x74, 0x87, 0x7c, 0x06, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c,
+    0x82, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x85, 0x74, 0x85, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x74,
+    0x00, 0x7c, 0x82, 0x74, 0x84, 0x7c, 0x87, 0x74, 0x83, 0x7c, 0x10, 0x6a, 0x10, 0x38, 0x7c, 0x7c,
+    0x73, 0x4e, 0x10, 0x10, 0x18, 0x69, 0x74, 0x74, 0x5d, 0x10, 0x4e, 0x76, 0x83, 0x7c, 0x83, 0x74,
+    0x02, 0x7c, 0x7c, 0x74, 0x85, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x06, 0x7c, 0x7c, 0x74,
+    0x7c, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x05, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00,
+    0x7c, 0x86, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x85, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x82,
+    0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x00, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x87, 0x74, 0x01,
+    0x7c, 0x73, 0x83, 0x68, 0x02, 0x5d, 0x10, 0x2f, 0x82, 0x68, 0x00, 0x3e, 0x82, 0x10, 0x06, 0x5d,
+    0x68, 0x68, 0x59, 0x10, 0x3e, 0x63, 0x83, 0x68, 0x05, 0x74, 0x74, 0x76, 0x74, 0x7c, 0x74, 0x84,
+    0x7c, 0x01, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x00, 0x7c,
+    0x83, 0x74, 0x00, 0x7c, 0x87, 0x74, 0x04, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x8d, 0x74, 0x02, 0x7c,
+    0x74, 0x74, 0x85, 0x7c, 0x04, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x83, 0x74, 0x02, 0x7c, 0x7c, 0x74,
+    0x84, 0x7c, 0x00, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x84, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x82,
+    0x7c, 0x00, 0x4f, 0x98, 0x10, 0x00, 0x6a, 0x82, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x83, 0x74,
+    0x0e, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c,
+    0x8a, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x05, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x8c, 0x74, 0x02,
+    0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x74, 0x83,
+    0x7c, 0x02, 0x74, 0x74, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x85, 0x74, 0x02, 0x69, 0x59, 0x61,
+    0x97, 0x6f, 0x04, 0x61, 0x59, 0x5b, 0x74, 0x7c, 0x8a, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x7c, 0x86,
+    0x74, 0x82, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x00, 0x7c,
+    0x83, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x83, 0x74, 0x84, 0x7c, 0x8c, 0x74,
+    0x04, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x08, 0x74, 0x7c, 0x74, 0x74, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x07, 0x7c, 0x74, 0x61, 0x10, 0x83, 0xa5, 0xa5, 0xa9, 0x94,
+    0xa5, 0x02, 0xa4, 0x36, 0x2d, 0x89, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x87,
+    0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x89, 0x74, 0x01, 0x7c,
+    0x74, 0x84, 0x7c, 0x01, 0x74, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x84, 0x74, 0x83, 0x7c, 0x03,
+    0x74, 0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x00, 0x7c, 0x82, 0x74,
+    0x83, 0x7c, 0x83, 0x74, 0x0b, 0x6a, 0x4e, 0x67, 0x98, 0x86, 0x6f, 0x9d, 0xa4, 0xaf, 0xaf, 0xa5,
+    0xa0, 0x82, 0x6f, 0x14, 0x96, 0xa5, 0xac, 0xac, 0xa9, 0xa4, 0x79, 0x79, 0x6f, 0x92, 0xa5, 0xab,
+    0xac, 0xa9, 0xa4, 0x36, 0x19, 0x4e, 0x59, 0x7c, 0x7c, 0x86, 0x74, 0x84, 0x7c, 0x07, 0x74, 0x7c,
+    0x74, 0x7c, 0x74, 0x7d, 0x97, 0x93, 0x83, 0x7c, 0x06, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c,
+    0x82, 0x74, 0x83, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x84, 0x7c,
+    0x02, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x08, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x07, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x0b, 0x68, 0x0e, 0x83, 0xb2,
+    0x8a, 0x0e, 0x96, 0xa5, 0xb1, 0xb1, 0xa5, 0x96, 0x82, 0x0e, 0x17, 0x83, 0xa4, 0xb0, 0xb1, 0xa7,
+    0xa0, 0x18, 0x0e, 0x0e, 0x6f, 0xa4, 0xac, 0xb2, 0xa7, 0xa4, 0x2d, 0x0f, 0x10, 0x38, 0x7c, 0x7c,
+    0x74, 0x7c, 0x74, 0x83, 0x7c, 0x89, 0x74, 0x03, 0x8b, 0xa4, 0x97, 0x7c, 0x83, 0x74, 0x85, 0x7c,
+    0x03, 0x74, 0x7c, 0x74, 0x7c, 0x86, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x82, 0x7c, 0x89, 0x74, 0x84,
+    0x7c, 0x83, 0x74, 0x83, 0x7c, 0x00, 0x74, 0x83, 0x7c, 0x03, 0x74, 0x76, 0x7c, 0x76, 0x84, 0x74,
+    0x0e, 0x7c, 0x74, 0x74, 0x73, 0x5d, 0x61, 0x61, 0x83, 0x96, 0xa0, 0xa4, 0xa7, 0xa7, 0xa5, 0xa4,
+    0x82, 0x96, 0x05, 0xa0, 0xa4, 0xa7, 0xab, 0xa9, 0xa4, 0x82, 0x96, 0x0b, 0x9d, 0xa5, 0xa9, 0xa7,
+    0xa9, 0xa4, 0x2d, 0x24, 0x5d, 0x68, 0x7c, 0x7c, 0x86, 0x74, 0x87, 0x7c, 0x05, 0x74, 0x74, 0x8b,
+    0xa4, 0x9d, 0x76, 0x84, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x07, 0x7c,
+    0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x74,
+    0x88, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x88, 0x74, 0x03, 0x7c,
+    0x74, 0x74, 0x76, 0x83, 0x74, 0x08, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x61, 0x18, 0x83, 0x97,
+    0xa4, 0x02, 0xa0, 0x36, 0x2d, 0x83, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x88, 0x74, 0x82, 0x7c,
+    0x02, 0x8b, 0xa5, 0x9d, 0x82, 0x7c, 0x8c, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x86,
+    0x74, 0x00, 0x7c, 0x83, 0x74, 0x04, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x74,
+    0x84, 0x7c, 0x85, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x08, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c,
+    0x74, 0x7c, 0x84, 0x74, 0x02, 0x73, 0x6a, 0x4f, 0x98, 0x36, 0x01, 0x68, 0x73, 0x83, 0x74, 0x85,
+    0x7c, 0x87, 0x74, 0x05, 0xa0, 0xa1, 0xa1, 0xa0, 0x8b, 0x93, 0x82, 0xa1, 0x01, 0x8b, 0x7c, 0x8a,
+    0x74, 0x00, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x05, 0x7c, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0x88, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x03,
+    0x7c, 0x74, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x01, 0x7c,
+    0x51, 0x97, 0x24, 0x02, 0x2d, 0x73, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x87,
+    0x7c, 0x05, 0x97, 0xa1, 0xa1, 0xa0, 0x8b, 0x93, 0x82, 0xa1, 0x01, 0x8b, 0x74, 0x83, 0x7c, 0x00,
+    0x74, 0x82, 0x7c, 0x00, 0x74, 0x83, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x8b, 0x74, 0x83, 0x7c, 0x01,
+    0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x8a, 0x74, 0x84, 0x7c, 0x01, 0x74, 0x7c, 0x86, 0x74, 0x00,
+    0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74, 0x83, 0x73, 0x07, 0x74, 0x74, 0x73, 0x73, 0x74,
+    0x73, 0x74, 0x73, 0x82, 0x74, 0x00, 0x73, 0x83, 0x74, 0x00, 0x73, 0x82, 0x74, 0x07, 0x73, 0x74,
+    0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x06, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74,
+    0x83, 0x7c, 0x04, 0x74, 0x7c, 0x8b, 0xa4, 0x9d, 0x83, 0x7c, 0x05, 0x74, 0x7c, 0x74, 0x7c, 0x74,
+    0x7c, 0x83, 0x74, 0x07, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x8d, 0x74, 0x82, 0x7c,
+    0x82, 0x74, 0x00, 0x7c, 0x87, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x74, 0x08,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x86, 0x74, 0x82, 0x7c, 0x83, 0x74, 0x07,
+    0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x76, 0x7c, 0x82, 0x74, 0x0c, 0x7c, 0x74, 0x7c, 0x74, 0x74,
+    0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x87, 0x74, 0x84, 0x7c, 0x0a, 0x74, 0x7c, 0x74,
+    0x7c, 0x74, 0x8b, 0xa4, 0x97, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x84, 0x7c, 0x02, 0x74, 0x7c, 0x7c,
+    0x85, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x85, 0x7c, 0x03, 0x74, 0x7c, 0x74, 0x74, 0x86,
+    0x7c, 0x01, 0x74, 0x74, 0x86, 0x7c, 0x83, 0x74, 0x84, 0x7c, 0x01, 0x74, 0x76, 0x82, 0x7c, 0x00,
+    0x74, 0x82, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x74, 0x7c,
+    0x74, 0x74, 0x82, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x74, 0x83, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x7c,
+    0x88, 0x74, 0x02, 0x7c, 0x7c, 0x74, 0x84, 0x7c, 0x06, 0x74, 0x74, 0x8b, 0xa2, 0x97, 0x74, 0x74,
+    0x82, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x85, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x87,
+    0x74, 0x05, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x84, 0x74, 0x85, 0x7c, 0x8b, 0x74, 0x08, 0x74,
+    0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x01, 0x7c,
+    0x74, 0x84, 0x7c, 0x8b, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x84, 0x74,
+    0x03, 0x7c, 0x7c, 0x74, 0x74, 0x84, 0x7c, 0x08, 0x74, 0x7d, 0x97, 0x8c, 0x74, 0x74, 0x7c, 0x74,
+    0x74, 0x88, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x89, 0x74, 0x08, 0x7c,
+    0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x84, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x84, 0x7c,
+    0x82, 0x7c, 0x01, 0x74, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x08, 0x7c, 0x74, 0x74, 0x7c,
+    0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x7c,
+    0x84, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x08, 0x7c, 0x74,
+    0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x8a, 0x74, 0x06, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74,
+    0x7c, 0x85, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x83, 0x7c, 0x01,
+    0x74, 0x74, 0x86, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x76, 0x83, 0x74,
+    0x0e, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x82, 0x7c, 0x01, 0x74, 0x7c, 0x88, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x7c, 0x74,
+    0x82, 0x7c, 0x8a, 0x74, 0x0e, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0x85, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x02,
+    0x74, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x88, 0x7c, 0x88, 0x74, 0x82, 0x7c, 0x82,
+    0x74, 0x02, 0x7c, 0x74, 0x74, 0x05, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x88, 0x74,
+    0x02, 0x7c, 0x7c, 0x74, 0x85, 0x7c, 0x87, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x82,
+    0x7c, 0x8a, 0x74, 0x0b, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c,
+    0x83, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x74, 0x83, 0x7c, 0x83, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x82,
+    0x74, 0x82, 0x7c, 0x00, 0x74, 0x8d, 0x7c, 0x89, 0x74, 0x85, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x00,
+    0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x00, 0x74, 0x84, 0x7c, 0x01, 0x74,
+    0x7c, 0x87, 0x74, 0x01, 0x7c, 0x74, 0x83, 0x7c, 0x92, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x88, 0x74,
+    0x82, 0x7c, 0x02, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x87, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x82, 0x7c,
+    0x84, 0x74, 0x84, 0x7c, 0x8b, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x04, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x84, 0x7c, 0x03, 0x74, 0x7c, 0x74, 0x7c, 0x8b, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x83, 0x7c, 0x02,
+    0x74, 0x7c, 0x7c, 0x86, 0x74, 0x05, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x83, 0x74,
+    0x08, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x89, 0x74, 0x02, 0x7c, 0x7c, 0x74,
+    0x83, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x86, 0x74, 0x82, 0x7c, 0x90, 0x74, 0x86, 0x7c, 0x83, 0x74,
+    0x01, 0x7c, 0x7c, 0x82, 0x74, 0x85, 0x7c, 0x02, 0x74, 0x7c, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x7c,
+    0x74, 0x82, 0x7c, 0x88, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x85,
+    0x74, 0x00, 0x7c, 0x83, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x7c, 0x82, 0x74, 0x08, 0x7c, 0x74, 0x74,
+    0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x74,
+    0x7c, 0x8a, 0x74, 0x84, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x84,
+    0x7c, 0x02, 0x74, 0x74, 0x7c, 0x86, 0x74, 0x84, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x05, 0x7c, 0x74,
+    0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x86, 0x74, 0x83, 0x7c, 0x00, 0x74, 0x83, 0x7c, 0x01, 0x74,
+    0x7c, 0x89, 0x74, 0x82, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x83, 0x74,
+    0x82, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x89, 0x74,
+    0x07, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x88, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74,
+    0x82, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x00, 0x74,
+    0x02, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x88, 0x7c, 0x88, 0x74, 0x01, 0x7c, 0x7c, 0x8b, 0x74, 0x01,
+    0x7c, 0x7c, 0x82, 0x74, 0x85, 0x7c, 0x04, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x03, 0x7c,
+    0x7c, 0x74, 0x7c, 0x89, 0x74, 0x84, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x84, 0x7c, 0x8b,
+    0x74, 0x02, 0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x89, 0x74, 0x02, 0x7c, 0x7c, 0x74, 0x83, 0x7c, 0x01,
+    0x74, 0x7c, 0x8c, 0x73, 0x84, 0x74, 0x88, 0x7c, 0x00, 0x74, 0x8d, 0x73, 0x00, 0x7c, 0x82, 0x74,
+    0x01, 0x7c, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x89, 0x74, 0x88, 0x7c, 0x85, 0x74, 0x01, 0x7c,
+    0x7c, 0x83, 0x74, 0x85, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x88,
+    0x7c, 0x87, 0x74, 0x89, 0x7c, 0x01, 0x64, 0x64, 0x85, 0x63, 0x84, 0x64, 0x8c, 0x7c, 0x05, 0x74,
+    0x6b, 0x64, 0x63, 0x63, 0x64, 0x82, 0x63, 0x06, 0x64, 0x63, 0x63, 0x64, 0x63, 0x64, 0x63, 0x83,
+    0x74, 0x00, 0x7c, 0x89, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x0c, 0x7c, 0x7c, 0x74, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x7c, 0x88,
+    0x74, 0x02, 0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x06, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x82,
+    0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x87, 0x7c, 0x00, 0x63, 0x87, 0x64, 0x00, 0x63, 0x82,
+    0x64, 0x84, 0x73, 0x00, 0x6b, 0x87, 0x73, 0x01, 0x64, 0x63, 0x87, 0x64, 0x01, 0x63, 0x63, 0x82,
+    0x64, 0x00, 0x6b, 0x84, 0x73, 0x01, 0x6b, 0x5d, 0x9d, 0x51, 0x01, 0x68, 0x7c, 0x87, 0x74, 0x01,
+    0x7c, 0x74, 0x86, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x88, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x00,
+    0x7c, 0x89, 0x74, 0x8c, 0x64, 0x01, 0x63, 0x64, 0x82, 0x63, 0x00, 0x64, 0x87, 0x63, 0x85, 0x64,
+    0x00, 0x63, 0x87, 0x64, 0x01, 0x63, 0x63, 0x84, 0x64, 0x00, 0x38, 0x9d, 0x00, 0x00, 0x51, 0x88,
+    0x7c, 0x85, 0x74, 0x04, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x85,
+    0x7c, 0x01, 0x74, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x00, 0x63, 0x87, 0x64, 0x00, 0x63, 0x8b, 0x64,
+    0x03, 0x63, 0x64, 0x64, 0x63, 0x86, 0x64, 0x00, 0x63, 0x8c, 0x64, 0x02, 0x49, 0x38, 0x7a, 0x9d,
+    0x95, 0x04, 0x71, 0x45, 0x68, 0x7c, 0x74, 0x82, 0x7c, 0x08, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74,
+    0x7c, 0x74, 0x7c, 0x85, 0x74, 0x85, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x7c, 0x86, 0x74, 0x02, 0x7c,
+    0x74, 0x7c, 0x85, 0x64, 0x02, 0x63, 0x64, 0x63, 0x99, 0x64, 0x00, 0x63, 0x8a, 0x64, 0x02, 0x45,
+    0x00, 0x95, 0x9d, 0xae, 0x04, 0x84, 0x00, 0x5d, 0x74, 0x74, 0x85, 0x7c, 0x8a, 0x74, 0x09, 0x7c,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x86, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x82,
+    0x74, 0x82, 0x7c, 0x8c, 0x54, 0x03, 0x63, 0x63, 0x64, 0x63, 0x89, 0x64, 0x00, 0x55, 0x8c, 0x54,
+    0x08, 0x52, 0x63, 0x64, 0x63, 0x4a, 0x19, 0x71, 0x9f, 0x7a, 0x8e, 0x4d, 0x00, 0x70, 0x84, 0xae,
+    0x03, 0x9a, 0x82, 0x82, 0x8e, 0x84, 0xae, 0x04, 0xa6, 0x9f, 0x58, 0x24, 0x6a, 0x86, 0x74, 0x02,
+    0x7c, 0x74, 0x7c, 0x83, 0x74, 0x06, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x8c, 0x74, 0x00,
+    0x7c, 0x84, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x8c, 0x54, 0x8d, 0x63, 0x00, 0x55, 0x83, 0x54, 0x00,
+    0x4b, 0x82, 0x54, 0x00, 0x4b, 0x82, 0x54, 0x01, 0x4b, 0x54, 0x82, 0x63, 0x04, 0x49, 0x00, 0x84,
+    0xae, 0x7a, 0x8e, 0x22, 0x00, 0x58, 0x84, 0xae, 0x04, 0x8e, 0x80, 0x80, 0x81, 0xaa, 0x85, 0xae,
+    0x07, 0x60, 0x00, 0x6a, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x8c, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x74,
+    0x82, 0x7c, 0x01, 0x74, 0x7c, 0x87, 0x74, 0x07, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74,
+    0x8c, 0x54, 0x03, 0x4b, 0x4b, 0x54, 0x4b, 0x83, 0x54, 0x00, 0x4b, 0x8d, 0x54, 0x00, 0x4b, 0x87,
+    0x54, 0x04, 0x48, 0x00, 0x84, 0xae, 0x7a, 0x8e, 0x22, 0x00, 0x58, 0x84, 0xae, 0x04, 0x8e, 0x7f,
+    0x7f, 0x81, 0xaa, 0x85, 0xae, 0x02, 0x60, 0x00, 0x6a, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x86, 0x74,
+    0x01, 0x7c, 0x7c, 0x82, 0x74, 0x04, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x03, 0x7c, 0x74,
+    0x74, 0x7c, 0x83, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x85, 0x54, 0x00, 0x4b, 0x85, 0x54, 0x01, 0x4b,
+    0x4b, 0x8a, 0x54, 0x00, 0x4b, 0x85, 0x54, 0x10, 0x4b, 0x4b, 0x54, 0x54, 0x4b, 0x54, 0x4b, 0x4b,
+    0x54, 0x4b, 0x54, 0x54, 0x47, 0x00, 0x84, 0xae, 0x7a, 0x82, 0x22, 0x88, 0x1a, 0x05, 0x23, 0x22,
+    0x22, 0x58, 0xae, 0xaa, 0x82, 0xa6, 0x04, 0x8f, 0x81, 0x81, 0x82, 0xaa, 0x85, 0xae, 0x08, 0x60,
+    0x00, 0x6a, 0x74, 0x68, 0x69, 0x69, 0x73, 0x7c, 0x83, 0x74, 0x83, 0x7c, 0x85, 0x74, 0x04, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x0d, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c,
+    0x7c, 0x74, 0x7c, 0x74, 0x74, 0x03, 0x54, 0x4b, 0x54, 0x4b, 0x83, 0x54, 0x00, 0x4b, 0x96, 0x54,
+    0x04, 0x4b, 0x54, 0x54, 0x4b, 0x4b, 0x87, 0x54, 0x08, 0x48, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22,
+    0x23, 0x35, 0x87, 0x29, 0x05, 0x1c, 0x22, 0x22, 0x58, 0xae, 0x9c, 0x82, 0x00, 0x00, 0x9e, 0x89,
+    0xae, 0x0c, 0x60, 0x00, 0x6a, 0x6a, 0x05, 0x00, 0x00, 0x3e, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x86,
+    0x74, 0x03, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x08, 0x7c, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x8c, 0x4a, 0x88, 0x54, 0x05, 0x4b, 0x54, 0x4b, 0x54, 0x4b,
+    0x4b, 0x89, 0x4a, 0x0f, 0x4b, 0x4a, 0x4a, 0x4b, 0x54, 0x4b, 0x54, 0x48, 0x00, 0x84, 0xae, 0x7a,
+    0x22, 0x22, 0x23, 0x35, 0x85, 0x2a, 0x07, 0x29, 0x29, 0x1c, 0x22, 0x22, 0x44, 0x9e, 0x87, 0x82,
+    0x44, 0x03, 0x87, 0x9e, 0xa3, 0xa3, 0x86, 0xae, 0x03, 0x60, 0x00, 0x59, 0x61, 0x82, 0x44, 0x02,
+    0x57, 0x5d, 0x6a, 0x88, 0x74, 0x08, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x88,
+    0x74, 0x00, 0x7c, 0x85, 0x74, 0x01, 0x7c, 0x74, 0x8c, 0x3a, 0x00, 0x4b, 0x8c, 0x54, 0x00, 0x3b,
+    0x8d, 0x3a, 0x0e, 0x4b, 0x54, 0x54, 0x47, 0x00, 0x7a, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x2a,
+    0x29, 0x2a, 0x84, 0x29, 0x0d, 0x1c, 0x22, 0x22, 0x17, 0x00, 0x4d, 0x91, 0x90, 0x90, 0x44, 0x00,
+    0x77, 0x81, 0xaa, 0x85, 0xae, 0x09, 0x60, 0x00, 0x00, 0x16, 0x87, 0x90, 0x90, 0x65, 0x00, 0x51,
+    0x88, 0x7c, 0x01, 0x74, 0x7c, 0x87, 0x74, 0x84, 0x7c, 0x0b, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x8c, 0x3a, 0x8d, 0x4a, 0x00, 0x3b, 0x8d, 0x3a, 0x82, 0x40,
+    0x08, 0x34, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x0d, 0x1c, 0x22, 0x22,
+    0x17, 0x00, 0x4d, 0x90, 0x90, 0x88, 0x70, 0x60, 0x4c, 0x56, 0xaa, 0x85, 0xae, 0x09, 0x60, 0x00,
+    0x58, 0x60, 0x87, 0x90, 0x90, 0x65, 0x00, 0x51, 0x84, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x91, 0x74,
+    0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0xac, 0x3a, 0x08, 0x28, 0x00, 0x84,
+    0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x05, 0x1c, 0x22, 0x22, 0x17, 0x00, 0x4d, 0x84,
+    0x90, 0x02, 0x23, 0x22, 0xaa, 0x85, 0xae, 0x02, 0x60, 0x00, 0x84, 0x83, 0x90, 0x02, 0x65, 0x00,
+    0x51, 0x82, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x89, 0x74, 0x06, 0x7c, 0x7c, 0x74,
+    0x7c, 0x74, 0x7c, 0x7c, 0x87, 0x74, 0x00, 0x7c, 0xa3, 0x3a, 0x00, 0x28, 0x82, 0x14, 0x00, 0x34,
+    0x83, 0x3a, 0x08, 0x28, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x0b, 0x1c,
+    0x22, 0x22, 0x17, 0x00, 0x4d, 0x91, 0x87, 0x88, 0x87, 0x87, 0x71, 0x87, 0x70, 0x09, 0x6e, 0x70,
+    0x87, 0x90, 0x88, 0x88, 0x90, 0x65, 0x00, 0x51, 0x82, 0x7c, 0x84, 0x74, 0x02, 0x7c, 0x74, 0x74,
+    0x82, 0x7c, 0x83, 0x74, 0x04, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x86, 0x74,
+    0x01, 0x7c, 0x74, 0xa3, 0x3a, 0x00, 0x26, 0x82, 0x01, 0x00, 0x28, 0x83, 0x3a, 0x08, 0x28, 0x00,
+    0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x0d, 0x1c, 0x22, 0x22, 0x17, 0x00, 0x4d,
+    0x90, 0x90, 0x88, 0x90, 0x88, 0x90, 0x87, 0x0b, 0x85, 0x01, 0x09, 0x71, 0x90, 0x90, 0x88, 0x88,
+    0x90, 0x88, 0x65, 0x00, 0x51, 0x82, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x01, 0x7c,
+    0x74, 0x82, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x8b, 0x28,
+    0x00, 0x34, 0x8d, 0x3a, 0x00, 0x34, 0x85, 0x28, 0x02, 0x20, 0x0f, 0x4d, 0x82, 0x84, 0x0d, 0x37,
+    0x11, 0x34, 0x3a, 0x3a, 0x28, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x0c,
+    0x1c, 0x22, 0x22, 0x17, 0x00, 0x4d, 0x90, 0x87, 0x87, 0x90, 0x88, 0x87, 0x87, 0x86, 0x84, 0x0c,
+    0x87, 0x90, 0x90, 0x87, 0x88, 0x90, 0x88, 0x65, 0x00, 0x51, 0x7c, 0x7c, 0x74, 0x85, 0x7c, 0x02,
+    0x74, 0x74, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x7c, 0x8a,
+    0x74, 0x82, 0x20, 0x85, 0x28, 0x00, 0x21, 0x82, 0x28, 0x8d, 0x3a, 0x1a, 0x34, 0x20, 0x20, 0x28,
+    0x21, 0x28, 0x21, 0x1d, 0x00, 0x58, 0x91, 0x90, 0x90, 0x37, 0x02, 0x34, 0x3a, 0x3a, 0x28, 0x00,
+    0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x1f, 0x1c, 0x22, 0x22, 0x17, 0x00, 0x4d,
+    0x88, 0x88, 0x90, 0x88, 0x87, 0x90, 0x90, 0x88, 0x87, 0x90, 0x87, 0x90, 0x88, 0x88, 0x90, 0x90,
+    0x88, 0x90, 0x88, 0x87, 0x88, 0x65, 0x00, 0x51, 0x7c, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x89, 0x74,
+    0x00, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x8b, 0x74, 0xa1, 0x20, 0x02, 0x1b, 0x00, 0x58, 0x82,
+    0x88, 0x00, 0x37, 0x85, 0x00, 0x06, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x14,
+    0x1c, 0x22, 0x00, 0x37, 0x87, 0x88, 0x87, 0x90, 0x87, 0x90, 0x90, 0x88, 0x90, 0x90, 0x87, 0x87,
+    0x90, 0x88, 0x90, 0x90, 0x88, 0x83, 0x90, 0x0b, 0x91, 0x90, 0x90, 0x88, 0x58, 0x00, 0x5d, 0x74,
+    0x7c, 0x74, 0x7c, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x89, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x05, 0x7c,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0xa1, 0x20, 0x06, 0x1d, 0x06, 0x4d, 0x84, 0x87, 0x90, 0x4d, 0x83,
+    0x37, 0x08, 0x23, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x19, 0x1c, 0x22,
+    0x00, 0x37, 0x88, 0x90, 0x90, 0x87, 0x90, 0x9c, 0x9e, 0x84, 0x84, 0x87, 0x88, 0x90, 0x87, 0x90,
+    0x90, 0x88, 0x90, 0x88, 0x9e, 0x9e, 0x84, 0x84, 0x82, 0x90, 0x07, 0x58, 0x00, 0x5d, 0x7c, 0x74,
+    0x7c, 0x74, 0x7c, 0x83, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x92, 0x74, 0x02, 0x7c, 0x74, 0x74, 0xa1,
+    0x20, 0x07, 0x27, 0x27, 0x14, 0x01, 0x65, 0x91, 0x87, 0x87, 0x82, 0x88, 0x08, 0x71, 0x00, 0x84,
+    0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x0e, 0x1c, 0x22, 0x00, 0x37, 0x88, 0x87, 0x90,
+    0x87, 0x88, 0xb3, 0xb6, 0x4d, 0x0e, 0x87, 0x87, 0x83, 0x90, 0x0f, 0x88, 0x87, 0x87, 0xb4, 0xb4,
+    0x17, 0x37, 0x90, 0x87, 0x91, 0x58, 0x00, 0x5d, 0x7c, 0x7c, 0x74, 0x82, 0x7c, 0x84, 0x74, 0x05,
+    0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x8b, 0x74, 0x00, 0x7c, 0x83, 0x74, 0xa2, 0x20, 0x03, 0x27,
+    0x15, 0x07, 0x4d, 0x82, 0x70, 0x82, 0x87, 0x08, 0x70, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23,
+    0x35, 0x87, 0x29, 0x03, 0x1c, 0x22, 0x00, 0x37, 0x84, 0x90, 0x04, 0xa6, 0xae, 0x3d, 0x0e, 0x87,
+    0x82, 0x90, 0x08, 0x87, 0x84, 0x70, 0x85, 0x90, 0xaa, 0xaa, 0x0e, 0x37, 0x82, 0x90, 0x04, 0x58,
+    0x00, 0x5d, 0x7c, 0x74, 0x82, 0x7c, 0x86, 0x74, 0x00, 0x7c, 0x8c, 0x74, 0x00, 0x7c, 0x83, 0x74,
+    0x02, 0x7c, 0x74, 0x74, 0x8c, 0x1e, 0x82, 0x20, 0x00, 0x27, 0x89, 0x20, 0x01, 0x1e, 0x1d, 0x86,
+    0x1e, 0x11, 0x1d, 0x1d, 0x07, 0x00, 0x00, 0x0a, 0x84, 0x87, 0x87, 0x71, 0x00, 0x84, 0xae, 0x7a,
+    0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x04, 0x1c, 0x22, 0x00, 0x37, 0x88, 0x82, 0x87, 0x11, 0x90,
+    0x44, 0x00, 0x00, 0x0e, 0x87, 0x90, 0x87, 0x90, 0x88, 0x58, 0x00, 0x7a, 0x90, 0x22, 0x00, 0x00,
+    0x37, 0x82, 0x90, 0x02, 0x58, 0x00, 0x5d, 0x84, 0x7c, 0x01, 0x74, 0x7c, 0x88, 0x74, 0x00, 0x7c,
+    0x87, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x8c, 0x1e, 0x82, 0x1f, 0x01, 0x26,
+    0x1d, 0x82, 0x20, 0x85, 0x1f, 0x00, 0x1d, 0x89, 0x1e, 0x0f, 0x14, 0x0c, 0x0c, 0x12, 0x58, 0x60,
+    0x60, 0x4d, 0x00, 0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x05, 0x1c, 0x22, 0x00,
+    0x37, 0x90, 0x9b, 0x82, 0xad, 0x10, 0x8f, 0x60, 0x60, 0x65, 0x87, 0x90, 0x87, 0x90, 0x87, 0x7a,
+    0x60, 0x84, 0x90, 0x65, 0x60, 0x60, 0x6e, 0x82, 0xad, 0x06, 0x82, 0x00, 0x5d, 0x7c, 0x74, 0x74,
+    0x7c, 0x89, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x82,
+    0x74, 0x00, 0x7c, 0x8f, 0x1e, 0x01, 0x1d, 0x1d, 0x96, 0x1e, 0x01, 0x1b, 0x01, 0x83, 0x00, 0x06,
+    0x84, 0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x05, 0x1c, 0x22, 0x00, 0x37, 0x90, 0xa8,
+    0x82, 0xb5, 0x00, 0xa8, 0x82, 0x87, 0x83, 0x90, 0x04, 0x87, 0x90, 0x88, 0x90, 0x90, 0x82, 0x87,
+    0x00, 0x9b, 0x82, 0xb5, 0x04, 0x99, 0x00, 0x5d, 0x7c, 0x74, 0x83, 0x7c, 0x03, 0x74, 0x74, 0x7c,
+    0x7c, 0x85, 0x74, 0x83, 0x7c, 0x07, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x85, 0x74,
+    0x92, 0x1e, 0x00, 0x1d, 0x94, 0x1e, 0x0c, 0x1d, 0x14, 0x0d, 0x14, 0x11, 0x00, 0x84, 0xae, 0x7a,
+    0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x05, 0x1c, 0x22, 0x00, 0x37, 0x87, 0xa8, 0x82, 0xb5, 0x10,
+    0xa8, 0x90, 0x4d, 0x4d, 0x87, 0x90, 0x90, 0x7a, 0x44, 0x70, 0x90, 0x87, 0x90, 0x4d, 0x4d, 0x87,
+    0x9b, 0x82, 0xb5, 0x06, 0x99, 0x00, 0x5d, 0x7c, 0x7c, 0x74, 0x7c, 0x8b, 0x74, 0x00, 0x7c, 0x82,
+    0x74, 0x07, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x92, 0x1e,
+    0x00, 0x1d, 0x85, 0x1e, 0x00, 0x1d, 0x8d, 0x1e, 0x0c, 0x1d, 0x1d, 0x1e, 0x1e, 0x14, 0x00, 0x84,
+    0xae, 0x7a, 0x22, 0x22, 0x23, 0x35, 0x87, 0x29, 0x05, 0x1c, 0x22, 0x00, 0x37, 0x90, 0xa8, 0x82,
+    0xb5, 0x10, 0xa8, 0x90, 0x23, 0x0e, 0x87, 0x90, 0x90, 0x6e, 0x00, 0x65, 0x90, 0x88, 0x90, 0x22,
+    0x16, 0x87, 0x9b, 0x82, 0xb5, 0x03, 0x99, 0x00, 0x5d, 0x74, 0x83, 0x7c, 0x87, 0x74, 0x0a, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x8c, 0x15, 0x82, 0x1d,
+    0x82, 0x1e, 0x87, 0x1d, 0x8e, 0x15, 0x0a, 0x1e, 0x1e, 0x1d, 0x14, 0x00, 0x84, 0xae, 0x7a, 0x22,
+    0x22, 0x23, 0x88, 0x1a, 0x05, 0x23, 0x22, 0x17, 0x17, 0x23, 0x5e, 0x82, 0x9b, 0x03, 0x90, 0x90,
+    0x23, 0x01, 0x82, 0x22, 0x0f, 0x0e, 0x00, 0x0e, 0x23, 0x22, 0x22, 0x01, 0x16, 0x87, 0x90, 0x9b,
+    0x8f, 0x42, 0x5f, 0x68, 0x73, 0x82, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x82,
+    0x74, 0x08, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x84, 0x7c, 0x8b, 0x0d, 0x00,
+    0x15, 0x82, 0x1d, 0x82, 0x1e, 0x87, 0x1d, 0x00, 0x15, 0x8d, 0x0d, 0x07, 0x1e, 0x1d, 0x15, 0x13,
+    0x00, 0x84, 0xae, 0x7a, 0x86, 0x22, 0x00, 0x2b, 0x85, 0x22, 0x09, 0x37, 0x37, 0x22, 0x58, 0x87,
+    0x87, 0x88, 0x88, 0x90, 0x37, 0x8a, 0x0e, 0x00, 0x23, 0x82, 0x87, 0x04, 0x60, 0x0b, 0x5a, 0x76,
+    0x76, 0x82, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x8b, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x05, 0x7c,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x00, 0x7d, 0x93, 0x0d, 0x00, 0x15, 0x96, 0x0d, 0x05,
+    0x01, 0x01, 0x00, 0x84, 0xae, 0x7a, 0x85, 0x22, 0x02, 0x41, 0x78, 0x56, 0x83, 0x22, 0x00, 0x16,
+    0x82, 0xaa, 0x05, 0x95, 0x0a, 0x65, 0x88, 0x90, 0x90, 0x8c, 0x87, 0x06, 0x90, 0x7a, 0x0a, 0x3e,
+    0x73, 0x74, 0x74, 0x83, 0x7c, 0x82, 0x74, 0x83, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x7c, 0x85, 0x74,
+    0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x03, 0x7c, 0x7c, 0xa0, 0xa4, 0xa9, 0x0d, 0x07,
+    0x0c, 0x13, 0x2c, 0x23, 0x00, 0x6e, 0x9f, 0x7a, 0x85, 0x4d, 0x02, 0x5e, 0x82, 0x6d, 0x84, 0x4d,
+    0x82, 0xae, 0x02, 0x9e, 0x44, 0x65, 0x90, 0x7a, 0x03, 0x6e, 0x24, 0x4f, 0x7c, 0x83, 0x74, 0x82,
+    0x7c, 0x87, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x82, 0x7c,
+    0x84, 0x74, 0x03, 0x7c, 0x7c, 0xa0, 0xa4, 0x9b, 0x0d, 0x00, 0x15, 0x89, 0x0d, 0x06, 0x14, 0x0d,
+    0x0d, 0x01, 0x22, 0x88, 0x71, 0x82, 0x00, 0x00, 0x95, 0x92, 0xae, 0x00, 0x85, 0x90, 0x00, 0x02,
+    0x2e, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x83,
+    0x74, 0x00, 0x7c, 0x8c, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x74, 0xa0, 0xa5, 0x89, 0x47, 0x02, 0x46,
+    0x47, 0x45, 0x8d, 0x0d, 0x00, 0x32, 0x8b, 0x47, 0x09, 0x1a, 0x11, 0x44, 0x58, 0x87, 0x7a, 0x4d,
+    0x37, 0x00, 0x71, 0x89, 0x95, 0x00, 0x91, 0x87, 0x95, 0x00, 0x65, 0x89, 0x00, 0x09, 0x37, 0x4d,
+    0x22, 0x00, 0x3e, 0x45, 0x3e, 0x4f, 0x7c, 0x7c, 0x86, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x82,
+    0x74, 0x00, 0x7c, 0x8e, 0x74, 0x83, 0x7c, 0x03, 0x74, 0x74, 0x93, 0x9d, 0x8b, 0x74, 0x00, 0x68,
+    0x8d, 0x0d, 0x00, 0x5b, 0x87, 0x7c, 0x0b, 0x76, 0x7c, 0x74, 0x74, 0x30, 0x0a, 0x84, 0x88, 0x87,
+    0x90, 0x88, 0x65, 0x9f, 0x00, 0x09, 0x65, 0x90, 0x3d, 0x00, 0x6a, 0x7c, 0x76, 0x76, 0x7c, 0x7c,
+    0x8c, 0x74, 0x06, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x8c, 0x74, 0x01, 0x7c, 0x74, 0x82,
+    0x7c, 0x0d, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x73, 0x5b,
+    0x83, 0x5a, 0x83, 0x5b, 0x84, 0x5a, 0x00, 0x68, 0x82, 0x74, 0x19, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x74, 0x7c, 0x30, 0x0a, 0x84, 0x90, 0x90, 0x84, 0x58, 0x50, 0x4f, 0x2e, 0x00, 0x58,
+    0x65, 0x65, 0x58, 0x00, 0x24, 0x89, 0x51, 0x02, 0x3e, 0x00, 0x3d, 0x82, 0x65, 0x0b, 0x0e, 0x05,
+    0x4f, 0x45, 0x00, 0x37, 0x65, 0x7a, 0x87, 0x3d, 0x00, 0x69, 0x85, 0x7c, 0x8b, 0x74, 0x04, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x00, 0x8b, 0x82, 0x97, 0x03, 0x8b,
+    0x74, 0x93, 0x97, 0x00, 0x74, 0x82, 0x7c, 0x07, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c,
+    0x9a, 0x74, 0x14, 0x7c, 0x30, 0x0a, 0x84, 0x91, 0x90, 0x7a, 0x00, 0x45, 0x7c, 0x3e, 0x00, 0x7a,
+    0x91, 0x91, 0x84, 0x00, 0x38, 0x7c, 0x74, 0x74, 0x86, 0x7c, 0x13, 0x61, 0x00, 0x60, 0x88, 0x90,
+    0x90, 0x23, 0x06, 0x73, 0x66, 0x00, 0x4d, 0x88, 0x87, 0x91, 0x3d, 0x00, 0x6a, 0x7c, 0x7c, 0x83,
+    0x74, 0x82, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x82, 0x7c, 0x00,
+    0x74, 0x82, 0x7c, 0x85, 0x74, 0x07, 0x8b, 0xa4, 0xa4, 0xa5, 0x93, 0x74, 0xa0, 0xa4, 0x06, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x02, 0x7c, 0x7c, 0x76,
+    0x87, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x7c, 0x30, 0x01, 0x82,
+    0x3d, 0x0b, 0x57, 0x5d, 0x68, 0x7c, 0x3e, 0x00, 0x37, 0x43, 0x43, 0x44, 0x61, 0x68, 0x83, 0x74,
+    0x11, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x5d, 0x00, 0x23, 0x43, 0x43, 0x3d, 0x61, 0x66, 0x74,
+    0x73, 0x5d, 0x59, 0x82, 0x3d, 0x02, 0x0e, 0x00, 0x69, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x74, 0x82,
+    0x7c, 0x83, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x7c, 0x83, 0x74, 0x09, 0x7c,
+    0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x82, 0x8b, 0x03, 0x7d, 0x7c, 0x8b, 0x8c,
+    0x10, 0x7c, 0x74, 0x7c, 0x74, 0x76, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74,
+    0x7c, 0x74, 0x82, 0x7c, 0x84, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x83, 0x74, 0x83, 0x7c, 0x03,
+    0x74, 0x7c, 0x7c, 0x30, 0x83, 0x00, 0x00, 0x3c, 0x82, 0x7c, 0x00, 0x3e, 0x83, 0x00, 0x03, 0x19,
+    0x7c, 0x7c, 0x74, 0x83, 0x7c, 0x05, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x61, 0x83, 0x00, 0x06, 0x01,
+    0x69, 0x7c, 0x7c, 0x74, 0x7c, 0x5b, 0x83, 0x00, 0x05, 0x01, 0x69, 0x74, 0x74, 0x7c, 0x7c, 0x88,
+    0x74, 0x0a, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x89, 0x74, 0x00,
+    0x7c, 0x83, 0x74, 0x83, 0x7c, 0x05, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x76, 0x82, 0x74, 0x0e, 0x76,
+    0x7c, 0x74, 0x76, 0x74, 0x7c, 0x76, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74,
+    0x02, 0x7c, 0x74, 0x7c, 0x87, 0x74, 0x07, 0x7c, 0x7c, 0x73, 0x68, 0x6a, 0x68, 0x6a, 0x73, 0x82,
+    0x74, 0x00, 0x72, 0x84, 0x6a, 0x11, 0x7c, 0x74, 0x7c, 0x74, 0x76, 0x7c, 0x74, 0x74, 0x7c, 0x76,
+    0x7c, 0x74, 0x73, 0x69, 0x68, 0x68, 0x6a, 0x69, 0x84, 0x7c, 0x0a, 0x73, 0x6a, 0x68, 0x68, 0x6a,
+    0x69, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x08, 0x7c, 0x74, 0x7c, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x88, 0x74, 0x08, 0x7c, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x7c, 0xa0, 0xa1, 0x01, 0x74, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x04, 0x7c, 0x76,
+    0x7c, 0x74, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x84, 0x74, 0x06, 0x7c, 0x7c, 0x74, 0x74, 0x7c,
+    0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x74,
+    0x87, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x86, 0x74, 0x84, 0x7c, 0x84, 0x74,
+    0x83, 0x7c, 0x08, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c,
+    0x88, 0x74, 0x00, 0x7c, 0x86, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x04, 0x7c,
+    0x74, 0x7c, 0xa0, 0xa4, 0x01, 0x74, 0x7c, 0x83, 0x74, 0x0c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x74, 0x74, 0x7c, 0x76, 0x74, 0x83, 0x7c, 0x01, 0x74, 0x74, 0x82, 0x7c, 0x01, 0x74,
+    0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x00,
+    0x7c, 0x84, 0x74, 0x0d, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74,
+    0x7c, 0x7c, 0x82, 0x74, 0x0f, 0x76, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x83,
+    0x74, 0x00, 0x7c, 0x83, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x7c, 0x88, 0x74, 0x06, 0x7c, 0x74, 0x74,
+    0x7c, 0x7c, 0xa0, 0xa4, 0x1b, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x76, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c,
+    0x76, 0x82, 0x74, 0x85, 0x7c, 0x03, 0x74, 0x74, 0x7c, 0x7c, 0x83, 0x74, 0x09, 0x7c, 0x74, 0x7c,
+    0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x0c, 0x74,
+    0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x76, 0x74, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x03, 0x74,
+    0x74, 0x76, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x08, 0x7c, 0x74, 0x7c, 0x7c,
+    0x74, 0x74, 0x7c, 0x74, 0x7c, 0x87, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x03,
+    0x7c, 0x7c, 0x97, 0xa0, 0x84, 0x74, 0x19, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x76, 0x74, 0x7c,
+    0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74,
+    0x7c, 0x84, 0x74, 0x82, 0x7c, 0x03, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x88, 0x74, 0x83, 0x7c,
+    0x01, 0x74, 0x7c, 0x8e, 0x74, 0x83, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x87, 0x74, 0x03, 0x7c, 0x7c,
+    0x74, 0x7c, 0x85, 0x74, 0x01, 0x7c, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x08,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x7c, 0x74, 0x7c,
+    0x7c, 0x82, 0x74, 0x02, 0x7c, 0x76, 0x7c, 0x82, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74,
+    0x74, 0x82, 0x7c, 0x0a, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x82,
+    0x74, 0x83, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x9a, 0x74, 0x00, 0x7c, 0x91, 0x74, 0x06, 0x7c,
+    0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x87, 0x74, 0x09, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x07, 0x74, 0x7c, 0x74, 0x7c,
+    0x76, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x02, 0x74, 0x74, 0x76, 0x83, 0x74, 0x02, 0x7c, 0x7c, 0x76,
+    0x82, 0x74, 0x07, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x83, 0x7c, 0x01, 0x76, 0x7c,
+    0x82, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x7c, 0x89, 0x74, 0x09, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x74, 0x7c, 0x86, 0x74, 0x00, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x03, 0x7c,
+    0x74, 0x74, 0x7c, 0x8e, 0x74, 0x07, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x85, 0x74,
+    0x00, 0x7c, 0x89, 0x74, 0x05, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x08, 0x7c, 0x74,
+    0x74, 0x76, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x09, 0x74, 0x7c, 0x74, 0x74, 0x76, 0x74,
+    0x7c, 0x74, 0x7c, 0x7c, 0x84, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x85,
+    0x74, 0x04, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x8a, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x74,
+    0x7c, 0x88, 0x74, 0x04, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00,
+    0x7c, 0x86, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x8a, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x7c,
+    0x82, 0x74, 0x01, 0x7c, 0x74, 0x02, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x82, 0x7c, 0x06, 0x74, 0x7c,
+    0x74, 0x74, 0x7c, 0x74, 0x76, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74,
+    0x85, 0x7c, 0x05, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x86,
+    0x74, 0x06, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x84, 0x74, 0x82, 0x7c, 0x91, 0x74, 0x00,
+    0x7c, 0x89, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x8e, 0x74, 0x02, 0x7c,
+    0x7c, 0x74, 0x05, 0x74, 0x7c, 0x76, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x06, 0x76, 0x7c, 0x74, 0x7c,
+    0x74, 0x7c, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x76, 0x83, 0x7c, 0x04, 0x74, 0x7c, 0x74,
+    0x7c, 0x74, 0x84, 0x7c, 0x01, 0x74, 0x74, 0x86, 0x7c, 0x83, 0x74, 0x83, 0x7c, 0x01, 0x74, 0x7c,
+    0x82, 0x74, 0x82, 0x7c, 0x8b, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x82, 0x74,
+    0x01, 0x7c, 0x7c, 0x95, 0x74, 0x06, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x85, 0x74, 0x02,
+    0x7c, 0x74, 0x7c, 0x83, 0x74, 0x01, 0x74, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x7c, 0x74,
+    0x7c, 0x82, 0x74, 0x06, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x7c,
+    0x74, 0x7c, 0x7c, 0x82, 0x74, 0x83, 0x7c, 0x00, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x7c, 0x83, 0x74,
+    0x83, 0x7c, 0x02, 0x74, 0x74, 0x7c, 0x8a, 0x74, 0x00, 0x7c, 0x87, 0x74, 0x82, 0x7c, 0x03, 0x74,
+    0x7c, 0x74, 0x7c, 0x83, 0x74, 0x04, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x86, 0x74, 0x03, 0x7c, 0x7c,
+    0x74, 0x7c, 0x83, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x86, 0x74, 0x00, 0x7c, 0x82,
+    0x74, 0x04, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x08, 0x7c, 0x74, 0x7c, 0x74,
+    0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x0c, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74,
+    0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74,
+    0x84, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x87, 0x74, 0x00, 0x7c, 0x8f, 0x74, 0x01, 0x7c, 0x74, 0x82,
+    0x7c, 0x01, 0x74, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x7c, 0x84, 0x74, 0x00, 0x7c, 0x82, 0x74, 0x00,
+    0x7c, 0x85, 0x74, 0x05, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x83, 0x74, 0x04, 0x7c, 0x74, 0x74,
+    0x7c, 0x7c, 0x85, 0x74, 0x14, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x76, 0x7c,
+    0x74, 0x7c, 0x7c, 0x76, 0x74, 0x7c, 0x7c, 0x74, 0x74, 0x76, 0x83, 0x7c, 0x82, 0x74, 0x01, 0x7c,
+    0x74, 0x85, 0x7c, 0x00, 0x76, 0x88, 0x74, 0x08, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74,
+    0x7c, 0x8a, 0x74, 0x03, 0x7c, 0x74, 0x74, 0x7c, 0x90, 0x74, 0x01, 0x7c, 0x7c, 0x86, 0x74, 0x07,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x86, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x82,
+    0x7c, 0x04, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x00, 0x7c, 0x83, 0x74, 0x09,
+    0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x82, 0x7c, 0x05, 0x74, 0x74, 0x7c,
+    0x74, 0x7c, 0x7c, 0x8d, 0x74, 0x82, 0x7c, 0x01, 0x74, 0x74, 0x82, 0x7c, 0x09, 0x74, 0x7c, 0x74,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x85, 0x74, 0x01, 0x7c, 0x7c, 0x86, 0x74, 0x01, 0x7c,
+    0x7c, 0x84, 0x74, 0x01, 0x7c, 0x7c, 0x82, 0x74, 0x01, 0x7c, 0x7c, 0x88, 0x74, 0x00, 0x7c, 0x88,
+    0x74, 0x82, 0x7c, 0x04, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x83, 0x74, 0x01,
+    0x7c, 0x74, 0x85, 0x7c, 0x17, 0x7c, 0x74, 0x7c, 0x76, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x76, 0x74,
+    0x7c, 0x74, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x73, 0x8f, 0x5d, 0x00,
+    0x73, 0x83, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x05, 0x8b, 0x8b, 0x74, 0x7c,
+    0x74, 0x7c, 0x83, 0x74, 0x00, 0x7c, 0x8a, 0x74, 0x01, 0x7c, 0x7c, 0x8c, 0x74, 0x00, 0x7c, 0x86,
+    0x74, 0x02, 0x7c, 0x74, 0x7c, 0x88, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x85, 0x74, 0x10, 0x7c, 0x74,
+    0x7c, 0x7c, 0x74, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x82,
+    0x7c, 0x04, 0x74, 0x7c, 0x7c, 0x68, 0x08, 0x8e, 0x03, 0x00, 0x63, 0x84, 0x74, 0x86, 0x7c, 0x01,
+    0x74, 0x7c, 0x86, 0x74, 0x01, 0xa1, 0xa5, 0x87, 0x74, 0x82, 0x7c, 0x04, 0x74, 0x7c, 0x74, 0x74,
+    0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x00, 0x7c, 0x88, 0x74, 0x01, 0x7c, 0x7c, 0x84, 0x74,
+    0x83, 0x7c, 0x88, 0x74, 0x01, 0x7c, 0x7c, 0x83, 0x74, 0x82, 0x7c, 0x82, 0x74, 0x82, 0x7c, 0x82,
+    0x74, 0x09, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x5d, 0x83, 0x5b, 0x00, 0x47,
+    0x8f, 0x03, 0x05, 0x47, 0x5b, 0x73, 0x74, 0x7c, 0x74, 0x85, 0x7c, 0x01, 0x74, 0x7c, 0x83, 0x74,
+    0x00, 0x68, 0x82, 0x5d, 0x01, 0x7b, 0x89, 0x88, 0x5d, 0x85, 0x74, 0x02, 0x7c, 0x74, 0x7c, 0x84,
+    0x74, 0x02, 0x7c, 0x74, 0x68, 0x82, 0x5a, 0x83, 0x5b, 0x04, 0x5a, 0x5b, 0x5a, 0x66, 0x74, 0x84,
+    0x7c, 0x02, 0x74, 0x74, 0x7c, 0x88, 0x74, 0x03, 0x7c, 0x74, 0x7c, 0x74, 0x82, 0x7c, 0x01, 0x74,
+    0x74, 0x86, 0x74, 0x01, 0x7c, 0x7c, 0x87, 0x74, 0x01, 0x7c, 0x39, 0x95, 0x03, 0x01, 0x09, 0x6b,
+    0x82, 0x74, 0x01, 0x7c, 0x74, 0x83, 0x7c, 0x01, 0x74, 0x7c, 0x83, 0x74, 0x05, 0x54, 0x20, 0x20,
+    0x27, 0x21, 0x21, 0x82, 0x20, 0x82, 0x21, 0x82, 0x20, 0x05, 0x73, 0x74, 0x7c, 0x74, 0x7c, 0x74,
+    0x82, 0x7c, 0x01, 0x74, 0x74, 0x84, 0x7c, 0x01, 0x5a, 0x04, 0x88, 0x03, 0x00, 0x46, 0x83, 0x74,
+    0x0d, 0x7c, 0x74, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x74, 0x7c, 0x86,
+    0x74, 0x01, 0x7c, 0x74, 0x83, 0x74, 0x00, 0x7c, 0x85, 0x74, 0x07, 0x46, 0x46, 0x45, 0x46, 0x46,
+    0x45, 0x46, 0x14, 0x96, 0x03, 0x03, 0x32, 0x46, 0x46, 0x51, 0x87, 0x74, 0x04, 0x73, 0x4a, 0x49,
+    0x4a, 0x34, 0x83, 0x20, 0x00, 0x27, 0x82, 0x20, 0x82, 0x27, 0x13, 0x20, 0x20, 0x27, 0x48, 0x4a,
+    0x4a, 0x5b, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x73, 0x46, 0x45, 0x45, 0x25, 0x89,
+    0x03, 0x00, 0x1b, 0x82, 0x45, 0x00, 0x6a, 0x84, 0x74, 0x07, 0x7c, 0x7c, 0x74, 0x5d, 0x4a, 0x49,
+    0x4a, 0x49, 0x82, 0x4a, 0x03, 0x49, 0x49, 0x4a, 0x6a, 0x82, 0x74, 0x83, 0x74, 0x00, 0x7c, 0x84,
+    0x74, 0x01, 0x73, 0x0c, 0xa0, 0x03, 0x00, 0x39, 0x87, 0x74, 0x02, 0x6b, 0x27, 0x27, 0x92, 0x20,
+    0x0a, 0x34, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x74, 0x7c, 0x7c, 0x73, 0x0c, 0x90, 0x03, 0x00, 0x63,
+    0x84, 0x74, 0x03, 0x7c, 0x7c, 0x74, 0x49, 0x89, 0x20, 0x00, 0x63, 0x82, 0x74, 0x84, 0x74, 0x00,
+    0x5b, 0x84, 0x25, 0x00, 0x08, 0xa0, 0x03, 0x03, 0x0c, 0x31, 0x32, 0x48, 0x83, 0x46, 0x03, 0x48,
+    0x34, 0x27, 0x27, 0x92, 0x20, 0x06, 0x28, 0x47, 0x34, 0x34, 0x63, 0x7c, 0x47, 0x82, 0x25, 0x00,
+    0x08, 0x90, 0x03, 0x82, 0x25, 0x02, 0x32, 0x74, 0x6a, 0x82, 0x34, 0x00, 0x32, 0x88, 0x20, 0x01,
+    0x27, 0x34, 0x82, 0x47, 0x83, 0x74, 0x01, 0x73, 0x47, 0xa7, 0x03, 0x01, 0x04, 0x15, 0x9f, 0x20,
+    0x02, 0x54, 0x74, 0x39, 0x97, 0x03, 0x02, 0x1b, 0x73, 0x63, 0x8c, 0x20, 0x01, 0x27, 0x27, 0x82,
+    0x20, 0x05, 0x32, 0x48, 0x74, 0x5d, 0x14, 0x0c, 0xa4, 0x03, 0x00, 0x09, 0x83, 0x20, 0x01, 0x21,
+    0x21, 0x9d, 0x20, 0x02, 0x28, 0x32, 0x0d, 0x95, 0x03, 0x04, 0x04, 0x1f, 0x20, 0x28, 0x28, 0x91,
+    0x20, 0x05, 0x20, 0x34, 0x6b, 0x5b, 0x09, 0x04, 0x9d, 0x03, 0x00, 0x04, 0x85, 0x09, 0x01, 0x0d,
+    0x27, 0x97, 0x20, 0x03, 0x21, 0x27, 0x20, 0x27, 0x88, 0x20, 0x00, 0x0d, 0x82, 0x09, 0x8f, 0x03,
+    0x00, 0x04, 0x82, 0x09, 0x95, 0x20, 0x82, 0x20, 0x02, 0x21, 0x20, 0x15, 0x9d, 0x03, 0x00, 0x15,
+    0x86, 0x20, 0x00, 0x27, 0xa8, 0x20, 0x00, 0x04, 0x8e, 0x03, 0x00, 0x15, 0x98, 0x20, 0x84, 0x20,
+    0x00, 0x1e, 0x84, 0x0d, 0x96, 0x03, 0x05, 0x08, 0x0d, 0x1d, 0x27, 0x20, 0x20, 0x82, 0x21, 0xaa,
+    0x20, 0x82, 0x0d, 0x00, 0x09, 0x89, 0x03, 0x02, 0x09, 0x0d, 0x1e, 0x98, 0x20, 0x86, 0x20, 0x00,
+    0x27, 0x82, 0x20, 0x00, 0x04, 0x95, 0x03, 0x00, 0x0d, 0xb5, 0x20, 0x00, 0x15, 0x89, 0x03, 0x00,
+    0x15, 0x9a, 0x20, 0x88, 0x20, 0x01, 0x28, 0x20, 0x82, 0x15, 0x00, 0x0d, 0x8d, 0x03, 0x00, 0x0d,
+    0x83, 0x15, 0x00, 0x1e, 0xb5, 0x20, 0x00, 0x1e, 0x89, 0x15, 0x00, 0x1e, 0x9a, 0x20, 0x8d, 0x20,
+    0x00, 0x1e, 0x8d, 0x03, 0x00, 0x1e, 0xe1, 0x20, 0x8d, 0x20, 0x00, 0x1f, 0x82, 0x1e, 0x89, 0x1d,
+    0x00, 0x1e, 0xe2, 0x20, 0x9c, 0x20, 0x00, 0x27, 0xe1, 0x20, 0xd7, 0x20, 0x00, 0x21, 0xa6, 0x20,
+    0xd6, 0x20, 0x00, 0x21, 0x8f, 0x28, 0x00, 0x21, 0x96, 0x20, 0xd5, 0x20, 0x01, 0x27, 0x3f, 0x8f,
+    0x8d, 0x00, 0x3f, 0x96, 0x20, 0xc8, 0x20, 0x02, 0x33, 0x33, 0x3f, 0x86, 0x33, 0x06, 0x3f, 0x33,
+    0x33, 0x3f, 0x53, 0x94, 0x8d, 0x8c, 0x94, 0x01, 0x8d, 0x53, 0x8c, 0x3f, 0x00, 0x33, 0x88, 0x20,
+    0xbb, 0x20, 0x05, 0x27, 0x20, 0x20, 0x27, 0x20, 0x21, 0x85, 0x20, 0x0c, 0x27, 0x7e, 0x8d, 0x94,
+    0x8d, 0x94, 0x8d, 0x94, 0x8d, 0x8d, 0x94, 0x94, 0x8d, 0x86, 0x94, 0x00, 0x8d, 0x85, 0x94, 0x82,
+    0x8d, 0x8f, 0x94, 0x00, 0x7e, 0x88, 0x20, 0x8a, 0x53, 0x00, 0x21, 0xae, 0x20, 0x01, 0x27, 0x3f,
+    0x8b, 0x53, 0x00, 0x8d, 0x9a, 0x94, 0x00, 0x8d, 0x8f, 0x94, 0x02, 0x8d, 0x53, 0x5c, 0x86, 0x53,
+    0x89, 0x94, 0x01, 0x8d, 0x28, 0x89, 0x20, 0x00, 0x21, 0x86, 0x20, 0x04, 0x21, 0x21, 0x20, 0x20,
+    0x21, 0x86, 0x20, 0x82, 0x21, 0x83, 0x20, 0x06, 0x21, 0x20, 0x20, 0x21, 0x20, 0x20, 0x21, 0x82,
+    0x20, 0x01, 0x21, 0x75, 0xc2, 0x94, 0x89, 0x94, 0x00, 0x8d, 0xb0, 0x6c, 0x03, 0x7e, 0x94, 0x94,
+    0x8d, 0x84, 0x94, 0x05, 0x8d, 0x94, 0x94, 0x8d, 0x94, 0x8d, 0x84, 0x94, 0x00, 0x8d, 0x88, 0x94,
+    0x03, 0x8d, 0x94, 0x94, 0x8d, 0x89, 0x94, 0x00, 0x8d, 0x87, 0x94, 0x02, 0x8d, 0x94, 0x8d, 0x82,
+    0x94, 0x00, 0x8d, 0x87, 0x94, 0x8d, 0x94, 0x84, 0x8d, 0x0b, 0x94, 0x8d, 0x8d, 0x94, 0x8d, 0x94,
+    0x8d, 0x94, 0x8d, 0x8d, 0x94, 0x94, 0x83, 0x8d, 0x04, 0x94, 0x94, 0x8d, 0x8d, 0x94, 0x89, 0x8d,
+    0x00, 0x94, 0x85, 0x8d, 0x8f, 0x94, 0x03, 0x8d, 0x94, 0x94, 0x8d, 0x9a, 0x94, 0x00, 0x8d, 0x94,
+    0x94, 0x01, 0x8d, 0x94, 0xac, 0x94, 0x04, 0x8d, 0x94, 0x8d, 0x94, 0x8d, 0x83, 0x94, 0x00, 0x8d,
+    0x8f, 0x94, 0x02, 0x8d, 0x94, 0x8d, 0x92, 0x94, 0x00, 0x8d, 0xa1, 0x94, 0x90, 0x94, 0x02, 0x8d,
+    0x94, 0x8d, 0x91, 0x94, 0x00, 0x8d, 0x8a, 0x94, 0x00, 0x8d, 0x85, 0x94, 0x00, 0x8d, 0x87, 0x94,
+    0x00, 0x8d, 0x86, 0x94, 0x00, 0x8d, 0x86, 0x94, 0x02, 0x8d, 0x94, 0x8d, 0x8b, 0x94, 0x03, 0x8d,
+    0x94, 0x8d, 0x8d, 0x9a, 0x94, 0x88, 0x94, 0x00, 0x8d, 0x87, 0x94, 0x00, 0x8d, 0x84, 0x94, 0x00,
+    0x8d, 0x82, 0x94, 0x00, 0x8d, 0x83, 0x94, 0x01, 0x8d, 0x8d, 0xa8, 0x94, 0x00, 0x8d, 0x91, 0x94,
+    0x00, 0x8d, 0x88, 0x94, 0x00, 0x8d, 0x95, 0x94, 0x84, 0x94, 0x00, 0x8d, 0x8a, 0x94, 0x00, 0x8d,
+    0x91, 0x94, 0x06, 0x8d, 0x94, 0x94, 0x8d, 0x94, 0x94, 0x8d, 0x8f, 0x94, 0x00, 0x8d, 0x82, 0x94,
+    0x00, 0x8d, 0x92, 0x94, 0x01, 0x8d, 0x8d, 0x8d, 0x94, 0x00, 0x8d, 0x86, 0x94, 0x00, 0x8d, 0x91,
+    0x94, 0x01, 0x8d, 0x94,
+};
+
+// 6 frames, 42456 bytes (raw: 196608)
+static constexpr Driver::Device::Rle565_t cat_rle[] = {
+    {128, 128, cat_pal_0, cat_row_0, cat_code_0},
+    {128, 128, cat_pal_1, cat_row_1, cat_code_1},
+    {128, 128, cat_pal_2, cat_row_2, cat_code_2},
+    {128, 128, cat_pal_3, cat_row_3, cat_code_3},
+    {128, 128, cat_pal_4, cat_row_4, cat_code_4},
+    {128, 128, cat_pal_5, cat_row_5, cat_code_5},
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef _FACE_GIF_DIRTY_
+#define _FACE_GIF_DIRTY_
+
+// Generated by tools/gif_dirty.py, do not edit
+// Dirty rectangles {x0, y0, x1, y1} of each frame against the previous one
+
+#include <stdint.h>
+
+// 29 rects, ~7067 bytes (full frame: 32768)
+static constexpr uint8_t face_dirty_0[][4] = {{22, 12, 105, 15}, {18, 16, 109, 19}, {13, 20, 114, 25}, {10, 26, 117, 29}, {9, 30, 118, 30}, {7, 31, 41, 35}, {6, 36, 37, 37}, {85, 31, 121, 37}, {70, 46, 70, 47}, {54, 46, 54, 48}, {86, 38, 86, 50}, {68, 57, 68, 57}, {44, 40, 44, 63}, {38, 64, 44, 64}, {86, 51, 89, 64}, {38, 65, 86, 67}, {80, 68, 86, 74}, {38, 68, 46, 76}, {68, 75, 86, 77}, {38, 77, 48, 82}, {80, 78, 86, 82}, {38, 83, 88, 87}, {38, 88, 42, 91}, {60, 88, 65, 91}, {84, 88, 88, 91}, {40, 93, 86, 93}, {40, 94, 42, 94}, {84, 94, 86, 94}, {40, 95, 86, 95}};
+// 15 rects, ~4669 bytes (full frame: 32768)
+static constexpr uint8_t face_dirty_1[][4] = {{35, 31, 42, 34}, {84, 31, 93, 35}, {33, 35, 46, 45}, {62, 45, 62, 45}, {70, 46, 70, 47}, {33, 46, 54, 48}, {68, 57, 68, 57}, {80, 36, 93, 74}, {33, 49, 46, 75}, {35, 76, 40, 76}, {68, 75, 93, 76}, {35, 77, 90, 79}, {38, 80, 57, 84}, {68, 80, 88, 84}, {38, 85, 88, 95}};
+// 24 rects, ~6244 bytes (full frame: 32768)
+static constexpr uint8_t face_dirty_2[][4] = {{37, 31, 89, 32}, {33, 33, 93, 41}, {33, 42, 50, 43}, {33, 44, 64, 44}, {74, 42, 93, 44}, {33, 45, 54, 56}, {68, 45, 93, 59}, {66, 60, 93, 60}, {33, 57, 56, 62}, {74, 61, 93, 62}, {127, 62, 127, 62}, {33, 63, 93, 67}, {58, 68, 66, 69}, {77, 68, 93, 69}, {33, 68, 46, 76}, {56, 70, 93, 76}, {35, 77, 90, 79}, {3, 81, 3, 81}, {124, 81, 124, 81}, {45, 80, 79, 84}, {51, 85, 75, 87}, {6, 88, 15, 88}, {32, 88, 119, 88}, {51, 89, 75, 89}};
+// 32 rects, ~7722 bytes (full frame: 32768)
+static constexpr uint8_t face_dirty_3[][4] = {{37, 31, 89, 32}, {35, 33, 91, 34}, {33, 35, 93, 41}, {33, 42, 50, 43}, {33, 44, 64, 44}, {74, 42, 93, 44}, {33, 45, 93, 45}, {33, 46, 54, 56}, {74, 46, 93, 59}, {66, 60, 93, 60}, {33, 57, 56, 62}, {74, 61, 93, 62}, {127, 62, 127, 62}, {33, 63, 93, 67}, {58, 68, 66, 69}, {77, 68, 93, 69}, {33, 68, 46, 71}, {56, 70, 93, 71}, {33, 72, 93, 74}, {33, 75, 46, 75}, {56, 75, 93, 75}, {32, 76, 95, 78}, {31, 79, 46, 79}, {58, 79, 66, 79}, {77, 79, 95, 79}, {3, 81, 3, 81}, {124, 81, 124, 81}, {29, 80, 97, 86}, {28, 87, 98, 87}, {6, 88, 15, 88}, {28, 88, 119, 88}, {28, 89, 99, 94}};
+// 29 rects, ~7537 bytes (full frame: 32768)
+static constexpr uint8_t face_dirty_4[][4] = {{37, 31, 89, 32}, {35, 33, 91, 34}, {33, 35, 93, 41}, {33, 42, 50, 43}, {33, 44, 64, 44}, {74, 42, 93, 44}, {33, 45, 93, 45}, {61, 54, 63, 54}, {33, 46, 54, 56}, {74, 46, 93, 59}, {66, 60, 93, 60}, {33, 57, 56, 64}, {74, 61, 93, 64}, {33, 65, 93, 67}, {33, 68, 50, 71}, {74, 68, 93, 71}, {33, 72, 93, 74}, {33, 75, 46, 75}, {60, 75, 64, 75}, {77, 75, 93, 75}, {32, 76, 95, 78}, {31, 79, 46, 79}, {60, 79, 65, 79}, {77, 79, 95, 79}, {3, 81, 3, 81}, {29, 80, 97, 86}, {28, 87, 98, 87}, {6, 88, 121, 88}, {28, 89, 99, 94}};
+// 28 rects, ~10498 bytes (full frame: 32768)
+static constexpr uint8_t face_dirty_5[][4] = {{22, 12, 105, 15}, {18, 16, 109, 19}, {13, 20, 114, 25}, {10, 26, 117, 29}, {8, 30, 119, 33}, {6, 34, 121, 37}, {38, 38, 89, 41}, {38, 42, 50, 43}, {38, 44, 64, 44}, {74, 42, 88, 44}, {38, 45, 88, 45}, {61, 54, 63, 54}, {38, 46, 54, 56}, {74, 46, 89, 59}, {66, 60, 88, 60}, {38, 57, 56, 71}, {74, 61, 88, 71}, {38, 72, 88, 74}, {38, 75, 46, 79}, {77, 75, 88, 79}, {38, 80, 49, 80}, {60, 75, 65, 80}, {75, 80, 88, 80}, {3, 81, 3, 81}, {38, 81, 88, 87}, {6, 88, 121, 88}, {38, 89, 88, 93}, {42, 94, 84, 95}};
+
+static constexpr const uint8_t (*face_dirty[])[4] = {face_dirty_0, face_dirty_1, face_dirty_2, face_dirty_3, face_dirty_4, face_dirty_5};
+
+static constexpr uint16_t face_dirty_cnt[] = {sizeof(face_dirty_0) / 4, sizeof(face_dirty_1) / 4, sizeof(face_dirty_2) / 4, sizeof(face_dirty_3) / 4, sizeof(face_dirty_4) / 4, sizeof(face_dirty_5) / 4};
+
+#endif
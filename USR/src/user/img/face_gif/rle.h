@@ -0,0 +1,951 @@
+#ifndef _FACE_GIF_RLE_
+#define _FACE_GIF_RLE_
+
+// Generated by tools/gif_rle.py, do not edit
+
+#include "../../../drivers/device/rle565.hpp"
+
+// 40 colors, 2442 bytes (raw: 32768)
+static constexpr uint16_t face_pal_0[] = {
+    0x0000, 0x0020, 0x057c, 0x10a2, 0x18a2, 0x2965, 0x3145, 0x38e1, 0x4941, 0x4a29, 0x4c39, 0x528a,
+    0x6b6d, 0x71c3, 0x71ce, 0x738e, 0x762b, 0x7a42, 0x8e2a, 0x9363, 0xa1c6, 0xa2b5, 0xaab4, 0xaab5,
+    0xb596, 0xb5b6, 0xba07, 0xd69a, 0xdedb, 0xe71c, 0xea89, 0xeac9, 0xeda5, 0xef5d, 0xfca4, 0xfcc4,
+    0xfe06, 0xfe26, 0xffdf, 0xffff,
+};
+static constexpr uint16_t face_row_0[] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 74, 80, 86, 92,
+    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+    204, 218, 237, 257, 278, 301, 327, 358, 388, 418, 448, 478, 508, 550, 598, 647,
+    697, 747, 797, 835, 871, 907, 945, 983, 1017, 1047, 1085, 1123, 1161, 1195, 1229, 1255,
+    1281, 1307, 1331, 1353, 1375, 1389, 1403, 1417, 1435, 1453, 1471, 1489, 1515, 1541, 1577, 1605,
+    1633, 1653, 1672, 1690, 1708, 1726, 1744, 1758, 1774, 1792, 1810, 1828, 1846, 1864, 1882, 1896,
+    1910, 1916, 1922, 1928, 1934, 1940, 1946, 1952, 1958, 1964, 1970, 1976, 1982, 1988, 1994, 2000,
+    2006, 2012, 2018, 2028, 2034, 2040, 2046, 2052, 2058, 2064, 2070, 2076, 2082, 2088, 2094, 2100,
+};
+static constexpr uint8_t face_code_0[] = {
+    0xb5, 0x00, 0x93, 0x10, 0xb5, 0x00, 0xb0, 0x00, 0x9d, 0x10, 0xb0, 0x00, 0xac, 0x00, 0xa5, 0x10,
+    0xac, 0x00, 0xa9, 0x00, 0xab, 0x10, 0xa9, 0x00, 0xa6, 0x00, 0xb1, 0x10, 0xa6, 0x00, 0xa4, 0x00,
+    0xb5, 0x10, 0xa4, 0x00, 0xa2, 0x00, 0xb9, 0x10, 0xa2, 0x00, 0xa0, 0x00, 0xbd, 0x10, 0xa0, 0x00,
+    0x9f, 0x00, 0xbf, 0x10, 0x9f, 0x00, 0x9d, 0x00, 0xc3, 0x10, 0x9d, 0x00, 0x9b, 0x00, 0xc7, 0x10,
+    0x9b, 0x00, 0x9a, 0x00, 0x00, 0x12, 0xc8, 0x10, 0x9a, 0x00, 0x99, 0x00, 0xcb, 0x24, 0x99, 0x00,
+    0x97, 0x00, 0xcf, 0x24, 0x97, 0x00, 0x96, 0x00, 0xd1, 0x24, 0x96, 0x00, 0x95, 0x00, 0xd3, 0x24,
+    0x95, 0x00, 0x94, 0x00, 0xd5, 0x24, 0x94, 0x00, 0x93, 0x00, 0xd7, 0x24, 0x93, 0x00, 0x92, 0x00,
+    0xd9, 0x24, 0x92, 0x00, 0x91, 0x00, 0xdb, 0x24, 0x91, 0x00, 0x90, 0x00, 0xdd, 0x24, 0x90, 0x00,
+    0x8f, 0x00, 0xdf, 0x24, 0x8f, 0x00, 0x8e, 0x00, 0xe1, 0x24, 0x8e, 0x00, 0x8d, 0x00, 0xe3, 0x24,
+    0x8d, 0x00, 0x8c, 0x00, 0xe4, 0x24, 0x8d, 0x00, 0x8c, 0x00, 0xe5, 0x24, 0x8c, 0x00, 0x8b, 0x00,
+    0xe7, 0x24, 0x8b, 0x00, 0x8a, 0x00, 0xe9, 0x24, 0x8a, 0x00, 0x8a, 0x00, 0xe9, 0x24, 0x8a, 0x00,
+    0x89, 0x00, 0xeb, 0x24, 0x89, 0x00, 0x88, 0x00, 0xed, 0x24, 0x88, 0x00, 0x88, 0x00, 0x9f, 0x24,
+    0x01, 0x25, 0x13, 0xa8, 0x08, 0x01, 0x13, 0x25, 0xa0, 0x24, 0x88, 0x00, 0x87, 0x00, 0xa1, 0x24,
+    0x00, 0x13, 0xa8, 0x05, 0x00, 0x11, 0xa2, 0x24, 0x87, 0x00, 0x87, 0x00, 0x9e, 0x24, 0x03, 0x25,
+    0x08, 0x04, 0x19, 0xa8, 0x21, 0x02, 0x1b, 0x04, 0x13, 0xa0, 0x24, 0x87, 0x00, 0x86, 0x00, 0x9f,
+    0x24, 0x03, 0x20, 0x05, 0x03, 0x1b, 0xa8, 0x27, 0x03, 0x1c, 0x03, 0x11, 0x20, 0xa0, 0x24, 0x86,
+    0x00, 0x86, 0x00, 0x9e, 0x24, 0x03, 0x13, 0x07, 0x1c, 0x26, 0xaa, 0x27, 0x04, 0x26, 0x1b, 0x07,
+    0x11, 0x25, 0x9e, 0x24, 0x86, 0x00, 0x85, 0x00, 0x9f, 0x24, 0x02, 0x13, 0x00, 0x1d, 0x84, 0x27,
+    0xa2, 0x26, 0x84, 0x27, 0x03, 0x1c, 0x00, 0x11, 0x25, 0x9f, 0x24, 0x85, 0x00, 0x85, 0x00, 0x9f,
+    0x24, 0x02, 0x13, 0x00, 0x1d, 0x84, 0x27, 0x00, 0x0f, 0xa0, 0x04, 0x00, 0x0c, 0x84, 0x27, 0x02,
+    0x1c, 0x00, 0x11, 0xa0, 0x24, 0x85, 0x00, 0x84, 0x00, 0xa0, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82,
+    0x27, 0x02, 0x26, 0x21, 0x0f, 0xa0, 0x04, 0x02, 0x0c, 0x21, 0x26, 0x82, 0x27, 0x03, 0x1c, 0x00,
+    0x11, 0x23, 0xa0, 0x22, 0x84, 0x00, 0x84, 0x00, 0xa0, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27,
+    0x02, 0x00, 0x05, 0x1b, 0xa0, 0x26, 0x02, 0x1b, 0x05, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11,
+    0xa1, 0x22, 0x84, 0x00, 0x83, 0x00, 0xa1, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f,
+    0x00, 0x1b, 0xa0, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa2, 0x22,
+    0x83, 0x00, 0x83, 0x00, 0xa1, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b,
+    0xa0, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa2, 0x22, 0x83, 0x00,
+    0x83, 0x00, 0xa1, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0xa0, 0x27,
+    0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa2, 0x22, 0x83, 0x00, 0x82, 0x00,
+    0xa2, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0xa0, 0x27, 0x02, 0x1c,
+    0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa3, 0x22, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x22,
+    0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x87, 0x27, 0x00, 0x26, 0x86, 0x27,
+    0x00, 0x26, 0x84, 0x27, 0x00, 0x26, 0x89, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c,
+    0x00, 0x11, 0xa3, 0x22, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27,
+    0x02, 0x0f, 0x00, 0x1b, 0x86, 0x27, 0x02, 0x18, 0x0b, 0x1b, 0x84, 0x27, 0x02, 0x1b, 0x0b, 0x19,
+    0x82, 0x27, 0x02, 0x1c, 0x0b, 0x19, 0x88, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c,
+    0x00, 0x11, 0xa3, 0x22, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82,
+    0x27, 0x02, 0x0f, 0x00, 0x1b, 0x86, 0x27, 0x02, 0x18, 0x00, 0x19, 0x84, 0x27, 0x02, 0x19, 0x00,
+    0x18, 0x82, 0x27, 0x02, 0x1b, 0x00, 0x18, 0x88, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02,
+    0x1c, 0x00, 0x11, 0xa3, 0x22, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x13, 0x00, 0x1d,
+    0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x86, 0x27, 0x02, 0x18, 0x00, 0x19, 0x84, 0x27, 0x02, 0x19,
+    0x00, 0x18, 0x82, 0x27, 0x02, 0x1b, 0x00, 0x18, 0x88, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27,
+    0x02, 0x1c, 0x00, 0x11, 0xa4, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x13,
+    0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x86, 0x27, 0x02, 0x18, 0x04, 0x19, 0x84, 0x27,
+    0x02, 0x19, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1b, 0x04, 0x19, 0x88, 0x27, 0x02, 0x1c, 0x00, 0x18,
+    0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa4, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22,
+    0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x86, 0x27, 0x02, 0x21, 0x21, 0x26,
+    0x84, 0x27, 0x02, 0x19, 0x00, 0x18, 0x82, 0x27, 0x02, 0x26, 0x21, 0x26, 0x88, 0x27, 0x02, 0x1c,
+    0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa4, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xa3, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8e, 0x27, 0x02, 0x19,
+    0x00, 0x18, 0x8e, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa4, 0x22,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00,
+    0x1b, 0x8e, 0x27, 0x02, 0x19, 0x00, 0x18, 0x8e, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02,
+    0x1c, 0x00, 0x11, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82,
+    0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8e, 0x27, 0x02, 0x19, 0x00, 0x18, 0x8e, 0x27, 0x02, 0x1c, 0x00,
+    0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02,
+    0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8c, 0x27, 0x04, 0x1b, 0x00, 0x0b, 0x00,
+    0x18, 0x8e, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa5, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8c,
+    0x27, 0x00, 0x19, 0x82, 0x03, 0x00, 0x18, 0x8e, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02,
+    0x1c, 0x00, 0x11, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82,
+    0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8c, 0x27, 0x84, 0x26, 0x8e, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82,
+    0x27, 0x02, 0x1c, 0x00, 0x11, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x13, 0x00,
+    0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0xa0, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02,
+    0x1c, 0x00, 0x11, 0xa5, 0x22, 0x00, 0x00, 0xa5, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02,
+    0x0f, 0x00, 0x1b, 0x88, 0x27, 0x02, 0x19, 0x0f, 0x1b, 0x86, 0x27, 0x02, 0x1b, 0x0f, 0x00, 0x8a,
+    0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa6, 0x22, 0xa5, 0x22, 0x02,
+    0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x88, 0x27, 0x02, 0x00, 0x00, 0x1b, 0x86,
+    0x27, 0x02, 0x19, 0x00, 0x0f, 0x8a, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00,
+    0x11, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x88,
+    0x27, 0x02, 0x21, 0x1c, 0x00, 0x86, 0x0c, 0x02, 0x18, 0x1c, 0x1d, 0x8a, 0x27, 0x02, 0x1c, 0x00,
+    0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x13, 0x00, 0x1d, 0x82,
+    0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8a, 0x27, 0x00, 0x00, 0x86, 0x01, 0x00, 0x18, 0x8c, 0x27, 0x02,
+    0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x13, 0x00,
+    0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0x8a, 0x27, 0x00, 0x21, 0x86, 0x1d, 0x00, 0x21, 0x8c,
+    0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x11, 0xa6, 0x22, 0xa5, 0x22, 0x02,
+    0x13, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0xa0, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82,
+    0x27, 0x02, 0x1c, 0x00, 0x11, 0xa6, 0x22, 0xa5, 0x1f, 0x02, 0x11, 0x00, 0x1d, 0x82, 0x27, 0x02,
+    0x0f, 0x00, 0x1b, 0xa0, 0x27, 0x02, 0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6,
+    0x1f, 0xa5, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0x82, 0x27, 0x02, 0x0f, 0x00, 0x1b, 0xa0, 0x27, 0x02,
+    0x1c, 0x00, 0x18, 0x82, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x0d, 0x00,
+    0x1d, 0x82, 0x27, 0x01, 0x1b, 0x1b, 0xa2, 0x00, 0x01, 0x1b, 0x1c, 0x82, 0x27, 0x02, 0x1c, 0x00,
+    0x0d, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0x84, 0x27, 0x00, 0x0f, 0xa0, 0x00, 0x00,
+    0x0c, 0x84, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0x84,
+    0x27, 0x00, 0x1c, 0xa0, 0x1b, 0x00, 0x1c, 0x84, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6, 0x1e, 0xa5,
+    0x1e, 0x02, 0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6, 0x1e, 0xa5, 0x1e, 0x02,
+    0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x0d, 0x00,
+    0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa6, 0x1e, 0x00, 0x00, 0xa4, 0x1e, 0x02, 0x0d, 0x00,
+    0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x1e, 0x02,
+    0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xa4,
+    0x1e, 0x02, 0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa5, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0xa4, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa5, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0xa4, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0x9a, 0x27, 0x00, 0x21, 0x8a, 0x18, 0x00,
+    0x19, 0x84, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x1e, 0x02,
+    0x0d, 0x00, 0x1d, 0x9a, 0x27, 0x00, 0x1b, 0x8a, 0x00, 0x00, 0x0c, 0x84, 0x27, 0x02, 0x1c, 0x00,
+    0x0d, 0xa5, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0x82, 0x27,
+    0x00, 0x19, 0x82, 0x18, 0x00, 0x21, 0x92, 0x27, 0x00, 0x21, 0x8a, 0x19, 0x00, 0x1b, 0x84, 0x27,
+    0x02, 0x1c, 0x00, 0x0d, 0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x0d,
+    0x00, 0x1d, 0x82, 0x27, 0x00, 0x0f, 0x82, 0x00, 0x00, 0x1c, 0xa4, 0x27, 0x02, 0x1c, 0x00, 0x0d,
+    0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0x82, 0x27,
+    0x00, 0x1b, 0x82, 0x19, 0x00, 0x21, 0xa4, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa4, 0x1e, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d,
+    0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x0d, 0x00, 0x1d, 0xac, 0x27,
+    0x02, 0x1c, 0x00, 0x0d, 0xa3, 0x1e, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x1e, 0x02, 0x0d, 0x00, 0x1d,
+    0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa3, 0x1e, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x1e, 0x02, 0x0d,
+    0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa3, 0x1e, 0x82, 0x00, 0x83, 0x00, 0xa1, 0x1e,
+    0x02, 0x0d, 0x00, 0x1d, 0xac, 0x27, 0x02, 0x1c, 0x00, 0x0d, 0xa2, 0x1e, 0x83, 0x00, 0x83, 0x00,
+    0xa1, 0x1e, 0x02, 0x1a, 0x11, 0x18, 0xac, 0x19, 0x02, 0x18, 0x11, 0x14, 0xa2, 0x1e, 0x83, 0x00,
+    0x83, 0x00, 0xa3, 0x1e, 0x00, 0x06, 0xac, 0x00, 0x00, 0x0d, 0xa4, 0x1e, 0x83, 0x00, 0x84, 0x00,
+    0xa2, 0x1e, 0x02, 0x06, 0x00, 0x0f, 0xaa, 0x00, 0x00, 0x0d, 0xa3, 0x1e, 0x84, 0x00, 0x84, 0x00,
+    0xa2, 0x1e, 0x02, 0x06, 0x00, 0x1b, 0xa8, 0x27, 0x02, 0x1b, 0x00, 0x0d, 0xa3, 0x1e, 0x84, 0x00,
+    0x84, 0x00, 0xa2, 0x16, 0x02, 0x06, 0x00, 0x1b, 0xa8, 0x27, 0x02, 0x1b, 0x00, 0x09, 0xa2, 0x16,
+    0x85, 0x00, 0x85, 0x00, 0xa1, 0x17, 0x02, 0x06, 0x00, 0x1b, 0xa8, 0x27, 0x02, 0x1b, 0x00, 0x09,
+    0xa2, 0x17, 0x85, 0x00, 0x85, 0x00, 0xa1, 0x17, 0x02, 0x06, 0x00, 0x1b, 0xa8, 0x27, 0x02, 0x1b,
+    0x00, 0x09, 0xa2, 0x17, 0x85, 0x00, 0x86, 0x00, 0xa0, 0x17, 0x02, 0x06, 0x00, 0x1b, 0xa8, 0x27,
+    0x02, 0x1b, 0x00, 0x09, 0xa1, 0x17, 0x86, 0x00, 0x86, 0x00, 0xa0, 0x17, 0x02, 0x06, 0x00, 0x18,
+    0xa8, 0x1b, 0x02, 0x18, 0x00, 0x09, 0xa0, 0x17, 0x87, 0x00, 0x87, 0x00, 0x9f, 0x17, 0x00, 0x06,
+    0xac, 0x00, 0x00, 0x09, 0xa0, 0x17, 0x87, 0x00, 0x87, 0x00, 0x9f, 0x17, 0x00, 0x0b, 0xac, 0x09,
+    0x00, 0x0e, 0xa0, 0x17, 0x87, 0x00, 0x88, 0x00, 0xed, 0x17, 0x88, 0x00, 0x89, 0x00, 0xeb, 0x17,
+    0x89, 0x00, 0x89, 0x00, 0xeb, 0x17, 0x89, 0x00, 0x8a, 0x00, 0xe9, 0x17, 0x8a, 0x00, 0x8b, 0x00,
+    0xe7, 0x17, 0x8b, 0x00, 0x8b, 0x00, 0xe7, 0x17, 0x8b, 0x00, 0x8c, 0x00, 0xe5, 0x17, 0x8c, 0x00,
+    0x8d, 0x00, 0xe3, 0x17, 0x8d, 0x00, 0x8e, 0x00, 0xe1, 0x17, 0x8e, 0x00, 0x8e, 0x00, 0xe1, 0x17,
+    0x8e, 0x00, 0x8f, 0x00, 0xdf, 0x17, 0x8f, 0x00, 0x90, 0x00, 0xdd, 0x17, 0x90, 0x00, 0x91, 0x00,
+    0xdb, 0x17, 0x91, 0x00, 0x92, 0x00, 0xd9, 0x17, 0x92, 0x00, 0x93, 0x00, 0xd7, 0x17, 0x93, 0x00,
+    0x94, 0x00, 0xd5, 0x17, 0x94, 0x00, 0x95, 0x00, 0xd3, 0x17, 0x95, 0x00, 0x97, 0x00, 0xcf, 0x17,
+    0x97, 0x00, 0x98, 0x00, 0x00, 0x15, 0xcb, 0x0a, 0x00, 0x15, 0x98, 0x00, 0x99, 0x00, 0xcb, 0x02,
+    0x99, 0x00, 0x9b, 0x00, 0xc7, 0x02, 0x9b, 0x00, 0x9c, 0x00, 0xc5, 0x02, 0x9c, 0x00, 0x9e, 0x00,
+    0xc1, 0x02, 0x9e, 0x00, 0x9f, 0x00, 0xbf, 0x02, 0x9f, 0x00, 0xa1, 0x00, 0xbb, 0x02, 0xa1, 0x00,
+    0xa3, 0x00, 0xb7, 0x02, 0xa3, 0x00, 0xa5, 0x00, 0xb3, 0x02, 0xa5, 0x00, 0xa7, 0x00, 0xae, 0x02,
+    0xa8, 0x00, 0xaa, 0x00, 0xa9, 0x02, 0xaa, 0x00, 0xad, 0x00, 0xa3, 0x02, 0xad, 0x00, 0xb2, 0x00,
+    0x99, 0x02, 0xb2, 0x00, 0xb8, 0x00, 0x8d, 0x02, 0xb8, 0x00,
+};
+
+// 49 colors, 2409 bytes (raw: 32768)
+static constexpr uint16_t face_pal_1[] = {
+    0x0000, 0x0020, 0x057c, 0x0861, 0x1061, 0x10a2, 0x18a2, 0x2965, 0x3145, 0x38e1, 0x4941, 0x4a49,
+    0x4a69, 0x4c39, 0x528a, 0x6b6d, 0x71c3, 0x738e, 0x762b, 0x7a42, 0x8e2a, 0x9363, 0x9a73, 0xa1c6,
+    0xa2b4, 0xa2b5, 0xaab4, 0xaab5, 0xb596, 0xb5b6, 0xba07, 0xd249, 0xd505, 0xd69a, 0xdedb, 0xe269,
+    0xe28a, 0xe71c, 0xea89, 0xeac9, 0xed85, 0xeda5, 0xef5d, 0xf484, 0xf565, 0xfca4, 0xfe06, 0xffdf,
+    0xffff,
+};
+static constexpr uint16_t face_row_1[] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 74, 80, 86, 92,
+    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+    202, 218, 237, 258, 280, 302, 330, 360, 391, 422, 453, 484, 515, 558, 607, 657,
+    708, 759, 810, 849, 886, 923, 962, 1001, 1036, 1067, 1106, 1145, 1184, 1219, 1254, 1281,
+    1308, 1335, 1360, 1384, 1406, 1420, 1434, 1448, 1466, 1484, 1502, 1520, 1544, 1564, 1583, 1601,
+    1629, 1650, 1670, 1689, 1708, 1731, 1750, 1773, 1796, 1811, 1823, 1829, 1835, 1841, 1847, 1853,
+    1859, 1865, 1871, 1877, 1883, 1889, 1895, 1901, 1907, 1913, 1919, 1925, 1931, 1937, 1943, 1949,
+    1955, 1961, 1967, 1977, 1983, 1989, 1995, 2001, 2007, 2013, 2019, 2025, 2031, 2037, 2043, 2049,
+};
+static constexpr uint8_t face_code_1[] = {
+    0xb5, 0x00, 0x93, 0x12, 0xb5, 0x00, 0xb0, 0x00, 0x9d, 0x12, 0xb0, 0x00, 0xac, 0x00, 0xa5, 0x12,
+    0xac, 0x00, 0xa9, 0x00, 0xab, 0x12, 0xa9, 0x00, 0xa6, 0x00, 0xb1, 0x12, 0xa6, 0x00, 0xa4, 0x00,
+    0xb5, 0x12, 0xa4, 0x00, 0xa2, 0x00, 0xb9, 0x12, 0xa2, 0x00, 0xa0, 0x00, 0xbd, 0x12, 0xa0, 0x00,
+    0x9f, 0x00, 0xbf, 0x12, 0x9f, 0x00, 0x9d, 0x00, 0xc3, 0x12, 0x9d, 0x00, 0x9b, 0x00, 0xc7, 0x12,
+    0x9b, 0x00, 0x9a, 0x00, 0x00, 0x14, 0xc8, 0x12, 0x9a, 0x00, 0x99, 0x00, 0xcb, 0x2e, 0x99, 0x00,
+    0x97, 0x00, 0xcf, 0x2e, 0x97, 0x00, 0x96, 0x00, 0xd1, 0x2e, 0x96, 0x00, 0x95, 0x00, 0xd3, 0x2e,
+    0x95, 0x00, 0x94, 0x00, 0xd5, 0x2e, 0x94, 0x00, 0x93, 0x00, 0xd7, 0x2e, 0x93, 0x00, 0x92, 0x00,
+    0xd9, 0x2e, 0x92, 0x00, 0x91, 0x00, 0xdb, 0x2e, 0x91, 0x00, 0x90, 0x00, 0xdd, 0x2e, 0x90, 0x00,
+    0x8f, 0x00, 0xdf, 0x2e, 0x8f, 0x00, 0x8e, 0x00, 0xe1, 0x2e, 0x8e, 0x00, 0x8d, 0x00, 0xe3, 0x2e,
+    0x8d, 0x00, 0x8c, 0x00, 0xe4, 0x2e, 0x8d, 0x00, 0x8c, 0x00, 0xe5, 0x2e, 0x8c, 0x00, 0x8b, 0x00,
+    0xe7, 0x2e, 0x8b, 0x00, 0x8a, 0x00, 0xe9, 0x2e, 0x8a, 0x00, 0x8a, 0x00, 0xe9, 0x2e, 0x8a, 0x00,
+    0x89, 0x00, 0xeb, 0x2e, 0x89, 0x00, 0x88, 0x00, 0xed, 0x2e, 0x88, 0x00, 0x88, 0x00, 0x9b, 0x2e,
+    0x00, 0x29, 0xb2, 0x0a, 0x00, 0x28, 0x9c, 0x2e, 0x88, 0x00, 0x87, 0x00, 0x9c, 0x2e, 0x01, 0x28,
+    0x08, 0xb0, 0x07, 0x01, 0x08, 0x28, 0x9d, 0x2e, 0x87, 0x00, 0x87, 0x00, 0x9a, 0x2e, 0x03, 0x20,
+    0x09, 0x0b, 0x25, 0xb1, 0x2a, 0x02, 0x0e, 0x09, 0x29, 0x9b, 0x2e, 0x87, 0x00, 0x86, 0x00, 0x9b,
+    0x2e, 0x03, 0x20, 0x05, 0x0c, 0x2f, 0xb0, 0x30, 0x04, 0x2f, 0x0e, 0x05, 0x28, 0x29, 0x9b, 0x2e,
+    0x86, 0x00, 0x86, 0x00, 0x99, 0x2e, 0x04, 0x29, 0x0a, 0x11, 0x2f, 0x2f, 0xb2, 0x30, 0x04, 0x2f,
+    0x2f, 0x0e, 0x0a, 0x28, 0x9a, 0x2e, 0x86, 0x00, 0x85, 0x00, 0x9a, 0x2e, 0x02, 0x29, 0x06, 0x11,
+    0x85, 0x30, 0xaa, 0x2f, 0x85, 0x30, 0x02, 0x0e, 0x06, 0x28, 0x9b, 0x2e, 0x85, 0x00, 0x85, 0x00,
+    0x9a, 0x2e, 0x02, 0x2c, 0x06, 0x11, 0x84, 0x30, 0x01, 0x2a, 0x08, 0xa8, 0x06, 0x01, 0x08, 0x25,
+    0x84, 0x30, 0x02, 0x0e, 0x06, 0x28, 0x9b, 0x2e, 0x85, 0x00, 0x84, 0x00, 0x9b, 0x2d, 0x02, 0x2b,
+    0x06, 0x11, 0x83, 0x30, 0x02, 0x2a, 0x25, 0x08, 0xa8, 0x06, 0x02, 0x08, 0x22, 0x2a, 0x83, 0x30,
+    0x02, 0x0e, 0x06, 0x2b, 0x9c, 0x2d, 0x84, 0x00, 0x84, 0x00, 0x9b, 0x2d, 0x02, 0x2b, 0x06, 0x11,
+    0x82, 0x30, 0x03, 0x2a, 0x07, 0x0f, 0x2a, 0xa9, 0x2f, 0x02, 0x11, 0x0c, 0x2f, 0x82, 0x30, 0x02,
+    0x0e, 0x06, 0x2b, 0x9c, 0x2d, 0x84, 0x00, 0x83, 0x00, 0x9c, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82,
+    0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e,
+    0x06, 0x2b, 0x9d, 0x2d, 0x83, 0x00, 0x83, 0x00, 0x9c, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30,
+    0x03, 0x2a, 0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06,
+    0x2b, 0x9d, 0x2d, 0x83, 0x00, 0x83, 0x00, 0x9c, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03,
+    0x2a, 0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b,
+    0x9d, 0x2d, 0x83, 0x00, 0x82, 0x00, 0x9d, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a,
+    0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9e,
+    0x2d, 0x82, 0x00, 0x82, 0x00, 0x9d, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00,
+    0x0e, 0x2f, 0x8b, 0x30, 0x00, 0x2f, 0x86, 0x30, 0x00, 0x2f, 0x84, 0x30, 0x00, 0x2f, 0x8e, 0x30,
+    0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9e, 0x2d, 0x82, 0x00, 0x82, 0x00,
+    0x9d, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8a, 0x30, 0x02,
+    0x1c, 0x0e, 0x21, 0x84, 0x30, 0x02, 0x1d, 0x0e, 0x1d, 0x82, 0x30, 0x02, 0x22, 0x0e, 0x1d, 0x8d,
+    0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9e, 0x2d, 0x82, 0x00, 0x01,
+    0x00, 0x00, 0x9e, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8a,
+    0x30, 0x02, 0x00, 0x00, 0x1d, 0x84, 0x30, 0x02, 0x1d, 0x00, 0x1c, 0x82, 0x30, 0x02, 0x21, 0x00,
+    0x1d, 0x8d, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9e, 0x2d, 0x82,
+    0x00, 0x01, 0x00, 0x00, 0x9e, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e,
+    0x2f, 0x8a, 0x30, 0x02, 0x00, 0x00, 0x1d, 0x84, 0x30, 0x02, 0x1d, 0x00, 0x1c, 0x82, 0x30, 0x02,
+    0x21, 0x00, 0x1d, 0x8d, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9f,
+    0x2d, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03,
+    0x2a, 0x00, 0x0e, 0x2f, 0x8a, 0x30, 0x02, 0x00, 0x06, 0x1d, 0x84, 0x30, 0x02, 0x1d, 0x00, 0x1c,
+    0x82, 0x30, 0x02, 0x21, 0x06, 0x1d, 0x8d, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e,
+    0x06, 0x2b, 0x9f, 0x2d, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x2d, 0x02, 0x2b, 0x06, 0x11,
+    0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8a, 0x30, 0x02, 0x2a, 0x2a, 0x2f, 0x84, 0x30, 0x02,
+    0x1d, 0x00, 0x1c, 0x82, 0x30, 0x02, 0x2f, 0x2a, 0x2f, 0x8d, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82,
+    0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9f, 0x2d, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x2d, 0x02,
+    0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x92, 0x30, 0x02, 0x1d, 0x00, 0x1c,
+    0x93, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0x9f, 0x2d, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x9f, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f,
+    0x92, 0x30, 0x02, 0x1d, 0x00, 0x1c, 0x93, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e,
+    0x06, 0x2b, 0xa0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30,
+    0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x92, 0x30, 0x02, 0x1d, 0x00, 0x1c, 0x93, 0x30, 0x02, 0x0f, 0x07,
+    0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2d, 0x02,
+    0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x90, 0x30, 0x04, 0x21, 0x00, 0x0e,
+    0x00, 0x1c, 0x93, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa0, 0x2d,
+    0x00, 0x00, 0x00, 0x00, 0x9f, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e,
+    0x2f, 0x90, 0x30, 0x00, 0x1d, 0x82, 0x05, 0x00, 0x1c, 0x93, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82,
+    0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2d, 0x02, 0x2b, 0x06,
+    0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x90, 0x30, 0x84, 0x2f, 0x93, 0x30, 0x02, 0x0f,
+    0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa0, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x2d,
+    0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07,
+    0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa0, 0x2d, 0x00, 0x00, 0xa0, 0x2d, 0x02, 0x2b, 0x06,
+    0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8c, 0x30, 0x02, 0x1d, 0x11, 0x21, 0x86, 0x30,
+    0x02, 0x21, 0x11, 0x1c, 0x8f, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b,
+    0xa1, 0x2d, 0xa0, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8c,
+    0x30, 0x02, 0x00, 0x00, 0x21, 0x86, 0x30, 0x02, 0x1d, 0x00, 0x11, 0x8f, 0x30, 0x02, 0x0f, 0x07,
+    0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa1, 0x2d, 0xa0, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82,
+    0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8c, 0x30, 0x02, 0x2a, 0x22, 0x00, 0x86, 0x0f, 0x02, 0x1c,
+    0x22, 0x25, 0x8f, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa1, 0x2d,
+    0xa0, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0x8e, 0x30, 0x00,
+    0x00, 0x86, 0x01, 0x00, 0x1c, 0x91, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06,
+    0x2b, 0xa1, 0x2d, 0xa0, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f,
+    0x8e, 0x30, 0x00, 0x2a, 0x86, 0x25, 0x00, 0x2a, 0x91, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30,
+    0x02, 0x0e, 0x06, 0x2b, 0xa1, 0x2d, 0xa0, 0x2d, 0x02, 0x2b, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a,
+    0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x06, 0x2b, 0xa1,
+    0x2d, 0xa0, 0x27, 0x02, 0x23, 0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0xa9, 0x30,
+    0x02, 0x0f, 0x07, 0x2f, 0x82, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x27, 0xa0, 0x26, 0x02, 0x1f,
+    0x06, 0x11, 0x82, 0x30, 0x03, 0x2a, 0x00, 0x0e, 0x2f, 0xa9, 0x30, 0x02, 0x0f, 0x07, 0x2f, 0x82,
+    0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26, 0xa0, 0x26, 0x02, 0x1f, 0x06, 0x11, 0x82, 0x30, 0x02,
+    0x2f, 0x21, 0x1d, 0xaa, 0x00, 0x01, 0x1d, 0x21, 0x83, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26,
+    0xa0, 0x26, 0x02, 0x1f, 0x06, 0x11, 0x84, 0x30, 0x01, 0x2a, 0x03, 0xa8, 0x00, 0x01, 0x01, 0x25,
+    0x84, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26, 0xa0, 0x26, 0x02, 0x1f, 0x06, 0x11, 0x84, 0x30,
+    0x00, 0x2f, 0xaa, 0x21, 0x00, 0x2f, 0x84, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26, 0xa0, 0x26,
+    0x02, 0x1f, 0x06, 0x11, 0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26, 0xa0, 0x26, 0x02, 0x1f,
+    0x06, 0x11, 0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26, 0xa0, 0x26, 0x02, 0x1f, 0x06, 0x11,
+    0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa1, 0x26, 0x00, 0x00, 0x9f, 0x26, 0x02, 0x1f, 0x06, 0x11,
+    0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x26, 0x02, 0x1f,
+    0x06, 0x11, 0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x26,
+    0x02, 0x1f, 0x06, 0x11, 0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa0, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x9f, 0x26, 0x02, 0x1f, 0x06, 0x11, 0xb6, 0x30, 0x02, 0x0e, 0x04, 0x1f, 0xa0, 0x26, 0x00, 0x00,
+    0x00, 0x00, 0x9f, 0x26, 0x05, 0x24, 0x1e, 0x17, 0x11, 0x11, 0x2f, 0xb0, 0x30, 0x05, 0x2f, 0x00,
+    0x11, 0x1e, 0x1e, 0x23, 0xa0, 0x26, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x26, 0x03, 0x1e, 0x00, 0x0b,
+    0x2f, 0xb0, 0x30, 0x03, 0x2f, 0x0e, 0x00, 0x23, 0xa2, 0x26, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa0,
+    0x26, 0x02, 0x23, 0x1f, 0x1e, 0xb2, 0x11, 0x01, 0x1e, 0x1f, 0xa2, 0x26, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xa2, 0x26, 0x01, 0x1f, 0x06, 0xb0, 0x00, 0x01, 0x04, 0x1f, 0xa3, 0x26, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0xa2, 0x26, 0x00, 0x24, 0x90, 0x1e, 0x02, 0x13, 0x00, 0x0f, 0x89, 0x22,
+    0x02, 0x1c, 0x00, 0x09, 0x91, 0x1e, 0x00, 0x23, 0xa3, 0x26, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xb4, 0x26, 0x02, 0x17, 0x00, 0x11, 0x89, 0x30, 0x03, 0x21, 0x00, 0x09, 0x23, 0xb5, 0x26, 0x01,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0xb4, 0x26, 0x02, 0x17, 0x00, 0x11, 0x89, 0x30, 0x03, 0x21, 0x00,
+    0x09, 0x23, 0xb4, 0x26, 0x82, 0x00, 0x82, 0x00, 0xb3, 0x26, 0x02, 0x17, 0x00, 0x11, 0x89, 0x30,
+    0x03, 0x21, 0x00, 0x09, 0x23, 0xb4, 0x26, 0x82, 0x00, 0x82, 0x00, 0xb3, 0x26, 0x02, 0x17, 0x00,
+    0x11, 0x89, 0x30, 0x03, 0x21, 0x00, 0x09, 0x24, 0xb4, 0x26, 0x82, 0x00, 0x83, 0x00, 0xb0, 0x26,
+    0x04, 0x1f, 0x1e, 0x15, 0x11, 0x1c, 0x89, 0x30, 0x05, 0x22, 0x11, 0x11, 0x1e, 0x1e, 0x23, 0xb1,
+    0x26, 0x83, 0x00, 0x83, 0x00, 0xb0, 0x26, 0x02, 0x10, 0x00, 0x1c, 0x8d, 0x30, 0x03, 0x2a, 0x06,
+    0x04, 0x1f, 0xb1, 0x26, 0x83, 0x00, 0x83, 0x00, 0xae, 0x26, 0x04, 0x1f, 0x1f, 0x10, 0x00, 0x00,
+    0x8d, 0x2a, 0x05, 0x21, 0x05, 0x03, 0x1e, 0x1f, 0x23, 0xaf, 0x26, 0x83, 0x00, 0x84, 0x00, 0xad,
+    0x26, 0x04, 0x0a, 0x04, 0x00, 0x00, 0x04, 0x8d, 0x06, 0x05, 0x05, 0x00, 0x00, 0x03, 0x04, 0x1e,
+    0xae, 0x26, 0x84, 0x00, 0x84, 0x00, 0xac, 0x26, 0x01, 0x24, 0x0a, 0x96, 0x04, 0x00, 0x1e, 0xae,
+    0x26, 0x84, 0x00, 0x84, 0x00, 0xad, 0x1a, 0x97, 0x16, 0x00, 0x18, 0xad, 0x1a, 0x85, 0x00, 0x85,
+    0x00, 0xf3, 0x1b, 0x85, 0x00, 0x85, 0x00, 0xf3, 0x1b, 0x85, 0x00, 0x86, 0x00, 0xf1, 0x1b, 0x86,
+    0x00, 0x86, 0x00, 0xf0, 0x1b, 0x87, 0x00, 0x87, 0x00, 0xef, 0x1b, 0x87, 0x00, 0x87, 0x00, 0xef,
+    0x1b, 0x87, 0x00, 0x88, 0x00, 0xed, 0x1b, 0x88, 0x00, 0x89, 0x00, 0xeb, 0x1b, 0x89, 0x00, 0x89,
+    0x00, 0xeb, 0x1b, 0x89, 0x00, 0x8a, 0x00, 0xe9, 0x1b, 0x8a, 0x00, 0x8b, 0x00, 0xe7, 0x1b, 0x8b,
+    0x00, 0x8b, 0x00, 0xe7, 0x1b, 0x8b, 0x00, 0x8c, 0x00, 0xe5, 0x1b, 0x8c, 0x00, 0x8d, 0x00, 0xe3,
+    0x1b, 0x8d, 0x00, 0x8e, 0x00, 0xe1, 0x1b, 0x8e, 0x00, 0x8e, 0x00, 0xe1, 0x1b, 0x8e, 0x00, 0x8f,
+    0x00, 0xdf, 0x1b, 0x8f, 0x00, 0x90, 0x00, 0xdd, 0x1b, 0x90, 0x00, 0x91, 0x00, 0xdb, 0x1b, 0x91,
+    0x00, 0x92, 0x00, 0xd9, 0x1b, 0x92, 0x00, 0x93, 0x00, 0xd7, 0x1b, 0x93, 0x00, 0x94, 0x00, 0xd5,
+    0x1b, 0x94, 0x00, 0x95, 0x00, 0xd3, 0x1b, 0x95, 0x00, 0x97, 0x00, 0xcf, 0x1b, 0x97, 0x00, 0x98,
+    0x00, 0x00, 0x19, 0xcb, 0x0d, 0x00, 0x19, 0x98, 0x00, 0x99, 0x00, 0xcb, 0x02, 0x99, 0x00, 0x9b,
+    0x00, 0xc7, 0x02, 0x9b, 0x00, 0x9c, 0x00, 0xc5, 0x02, 0x9c, 0x00, 0x9e, 0x00, 0xc1, 0x02, 0x9e,
+    0x00, 0x9f, 0x00, 0xbf, 0x02, 0x9f, 0x00, 0xa1, 0x00, 0xbb, 0x02, 0xa1, 0x00, 0xa3, 0x00, 0xb7,
+    0x02, 0xa3, 0x00, 0xa5, 0x00, 0xb3, 0x02, 0xa5, 0x00, 0xa7, 0x00, 0xae, 0x02, 0xa8, 0x00, 0xaa,
+    0x00, 0xa9, 0x02, 0xaa, 0x00, 0xad, 0x00, 0xa3, 0x02, 0xad, 0x00, 0xb2, 0x00, 0x99, 0x02, 0xb2,
+    0x00, 0xb8, 0x00, 0x8d, 0x02, 0xb8, 0x00,
+};
+
+// 48 colors, 2338 bytes (raw: 32768)
+static constexpr uint16_t face_pal_2[] = {
+    0x0000, 0x0020, 0x057c, 0x0861, 0x1061, 0x10a2, 0x18a2, 0x2965, 0x38e1, 0x4941, 0x4a29, 0x4a49,
+    0x4a69, 0x4c39, 0x528a, 0x69a3, 0x6b6d, 0x738e, 0x762b, 0x7a42, 0x8e2a, 0x9363, 0xa2b5, 0xaab4,
+    0xaab5, 0xb596, 0xb5b6, 0xba07, 0xd249, 0xd505, 0xd506, 0xd69a, 0xdedb, 0xe269, 0xe28a, 0xe71c,
+    0xea89, 0xeac9, 0xed85, 0xef5d, 0xf484, 0xf565, 0xfca4, 0xfcc4, 0xfe06, 0xfe26, 0xffdf, 0xffff,
+};
+static constexpr uint16_t face_row_2[] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 74, 80, 86, 92,
+    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+    194, 200, 206, 216, 228, 242, 261, 283, 308, 334, 359, 384, 409, 447, 490, 534,
+    579, 624, 669, 702, 733, 764, 797, 830, 859, 884, 917, 950, 983, 1012, 1041, 1064,
+    1084, 1105, 1126, 1140, 1154, 1176, 1196, 1222, 1252, 1286, 1320, 1354, 1388, 1422, 1454, 1485,
+    1511, 1543, 1568, 1586, 1600, 1633, 1639, 1645, 1651, 1748, 1754, 1760, 1766, 1772, 1778, 1784,
+    1790, 1796, 1802, 1808, 1814, 1820, 1826, 1832, 1838, 1844, 1850, 1856, 1862, 1868, 1874, 1880,
+    1886, 1892, 1898, 1908, 1914, 1920, 1926, 1932, 1938, 1944, 1950, 1956, 1962, 1968, 1974, 1980,
+};
+static constexpr uint8_t face_code_2[] = {
+    0xb5, 0x00, 0x93, 0x12, 0xb5, 0x00, 0xb0, 0x00, 0x9d, 0x12, 0xb0, 0x00, 0xac, 0x00, 0xa5, 0x12,
+    0xac, 0x00, 0xa9, 0x00, 0xab, 0x12, 0xa9, 0x00, 0xa6, 0x00, 0xb1, 0x12, 0xa6, 0x00, 0xa4, 0x00,
+    0xb5, 0x12, 0xa4, 0x00, 0xa2, 0x00, 0xb9, 0x12, 0xa2, 0x00, 0xa0, 0x00, 0xbd, 0x12, 0xa0, 0x00,
+    0x9f, 0x00, 0xbf, 0x12, 0x9f, 0x00, 0x9d, 0x00, 0xc3, 0x12, 0x9d, 0x00, 0x9b, 0x00, 0xc7, 0x12,
+    0x9b, 0x00, 0x9a, 0x00, 0x00, 0x14, 0xc8, 0x12, 0x9a, 0x00, 0x99, 0x00, 0xcb, 0x2c, 0x99, 0x00,
+    0x97, 0x00, 0xcf, 0x2c, 0x97, 0x00, 0x96, 0x00, 0xd1, 0x2c, 0x96, 0x00, 0x95, 0x00, 0xd3, 0x2c,
+    0x95, 0x00, 0x94, 0x00, 0xd5, 0x2c, 0x94, 0x00, 0x93, 0x00, 0xd7, 0x2c, 0x93, 0x00, 0x92, 0x00,
+    0xd9, 0x2c, 0x92, 0x00, 0x91, 0x00, 0xdb, 0x2c, 0x91, 0x00, 0x90, 0x00, 0xdd, 0x2c, 0x90, 0x00,
+    0x8f, 0x00, 0xdf, 0x2c, 0x8f, 0x00, 0x8e, 0x00, 0xe1, 0x2c, 0x8e, 0x00, 0x8d, 0x00, 0xe3, 0x2c,
+    0x8d, 0x00, 0x8c, 0x00, 0xe4, 0x2c, 0x8d, 0x00, 0x8c, 0x00, 0xe5, 0x2c, 0x8c, 0x00, 0x8b, 0x00,
+    0xe7, 0x2c, 0x8b, 0x00, 0x8a, 0x00, 0xe9, 0x2c, 0x8a, 0x00, 0x8a, 0x00, 0xe9, 0x2c, 0x8a, 0x00,
+    0x89, 0x00, 0xeb, 0x2c, 0x89, 0x00, 0x88, 0x00, 0xed, 0x2c, 0x88, 0x00, 0x88, 0x00, 0xed, 0x2c,
+    0x88, 0x00, 0x87, 0x00, 0xef, 0x2c, 0x87, 0x00, 0x87, 0x00, 0xef, 0x2c, 0x87, 0x00, 0x86, 0x00,
+    0xa9, 0x2c, 0x9a, 0x2d, 0xac, 0x2c, 0x86, 0x00, 0x86, 0x00, 0xa8, 0x2c, 0x00, 0x1d, 0x9a, 0x13,
+    0xac, 0x2c, 0x86, 0x00, 0x85, 0x00, 0xa9, 0x2c, 0x00, 0x1e, 0x99, 0x00, 0x00, 0x06, 0xad, 0x2c,
+    0x85, 0x00, 0x85, 0x00, 0xa7, 0x2c, 0x02, 0x26, 0x13, 0x13, 0x99, 0x20, 0x03, 0x1f, 0x13, 0x15,
+    0x29, 0xaa, 0x2c, 0x85, 0x00, 0x84, 0x00, 0xa7, 0x2a, 0x04, 0x2b, 0x1d, 0x00, 0x0a, 0x2e, 0x98,
+    0x2f, 0x04, 0x2e, 0x00, 0x08, 0x28, 0x2b, 0xaa, 0x2a, 0x84, 0x00, 0x84, 0x00, 0xa6, 0x2a, 0x06,
+    0x28, 0x0f, 0x11, 0x20, 0x20, 0x2f, 0x27, 0x96, 0x10, 0x05, 0x27, 0x2e, 0x20, 0x1f, 0x0f, 0x0f,
+    0xaa, 0x2a, 0x84, 0x00, 0x83, 0x00, 0xa7, 0x2a, 0x02, 0x28, 0x04, 0x00, 0x82, 0x2f, 0x01, 0x1f,
+    0x04, 0x95, 0x01, 0x05, 0x23, 0x2f, 0x2f, 0x27, 0x05, 0x06, 0xab, 0x2a, 0x83, 0x00, 0x83, 0x00,
+    0xa7, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x20, 0x11, 0x00, 0x96, 0x23, 0x05, 0x00, 0x11, 0x2f,
+    0x27, 0x05, 0x06, 0xab, 0x2a, 0x83, 0x00, 0x83, 0x00, 0xa7, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f,
+    0x1f, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xab, 0x2a, 0x83, 0x00,
+    0x82, 0x00, 0xa8, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x10,
+    0x05, 0x2f, 0x27, 0x05, 0x06, 0xac, 0x2a, 0x82, 0x00, 0x82, 0x00, 0xa8, 0x2a, 0x06, 0x28, 0x04,
+    0x00, 0x2f, 0x1f, 0x00, 0x00, 0x82, 0x2f, 0x01, 0x2e, 0x2e, 0x85, 0x2f, 0x82, 0x2e, 0x83, 0x2f,
+    0x00, 0x2e, 0x83, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xac, 0x2a, 0x82, 0x00, 0x82,
+    0x00, 0xa8, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x82, 0x2f, 0x02, 0x1a, 0x0e,
+    0x1f, 0x84, 0x2f, 0x02, 0x1a, 0x0e, 0x1a, 0x82, 0x2f, 0x02, 0x1f, 0x0e, 0x1a, 0x82, 0x2f, 0x05,
+    0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xac, 0x2a, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x2a, 0x06,
+    0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x82, 0x2f, 0x02, 0x19, 0x00, 0x1a, 0x84, 0x2f, 0x02,
+    0x1a, 0x00, 0x19, 0x82, 0x2f, 0x02, 0x1f, 0x00, 0x1a, 0x82, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27,
+    0x05, 0x06, 0xac, 0x2a, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f,
+    0x1f, 0x00, 0x00, 0x82, 0x2f, 0x02, 0x19, 0x00, 0x1a, 0x84, 0x2f, 0x02, 0x1a, 0x00, 0x19, 0x82,
+    0x2f, 0x02, 0x1f, 0x00, 0x1a, 0x82, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xad, 0x2a,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00,
+    0x82, 0x2f, 0x02, 0x19, 0x06, 0x1a, 0x84, 0x2f, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x2f, 0x02, 0x1f,
+    0x06, 0x1a, 0x82, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xad, 0x2a, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0xa9, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x82, 0x2f, 0x02,
+    0x27, 0x27, 0x2e, 0x84, 0x2f, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x2f, 0x02, 0x2e, 0x27, 0x2e, 0x82,
+    0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xad, 0x2a, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xa9, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x8a, 0x2f, 0x02, 0x1a, 0x00, 0x19,
+    0x88, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xad, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x8a, 0x2f, 0x02, 0x1a, 0x00, 0x19,
+    0x88, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xae, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x8a, 0x2f, 0x02, 0x1a, 0x00, 0x19, 0x88,
+    0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xae, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a,
+    0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x88, 0x2f, 0x04, 0x1f, 0x00, 0x0e, 0x00, 0x19,
+    0x88, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xae, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x88, 0x2f, 0x00, 0x1a, 0x82, 0x05, 0x00,
+    0x19, 0x88, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xae, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x88, 0x2f, 0x84, 0x2e, 0x88, 0x2f,
+    0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xae, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2a, 0x06,
+    0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06,
+    0xae, 0x2a, 0x00, 0x00, 0xab, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x84, 0x2f,
+    0x02, 0x19, 0x11, 0x1f, 0x86, 0x2f, 0x02, 0x1f, 0x11, 0x19, 0x84, 0x2f, 0x05, 0x10, 0x05, 0x2f,
+    0x27, 0x05, 0x06, 0xaf, 0x2a, 0xab, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x84,
+    0x2f, 0x02, 0x00, 0x00, 0x1f, 0x86, 0x2f, 0x02, 0x1a, 0x00, 0x11, 0x84, 0x2f, 0x05, 0x10, 0x05,
+    0x2f, 0x27, 0x05, 0x06, 0xaf, 0x2a, 0xab, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00,
+    0x84, 0x2f, 0x02, 0x27, 0x20, 0x00, 0x86, 0x10, 0x02, 0x19, 0x20, 0x23, 0x84, 0x2f, 0x05, 0x10,
+    0x05, 0x2f, 0x27, 0x05, 0x06, 0xaf, 0x2a, 0xab, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00,
+    0x00, 0x86, 0x2f, 0x00, 0x00, 0x86, 0x01, 0x00, 0x1a, 0x86, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27,
+    0x06, 0x06, 0xaf, 0x2a, 0xab, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x86, 0x2f,
+    0x00, 0x27, 0x86, 0x23, 0x00, 0x27, 0x86, 0x2f, 0x05, 0x10, 0x05, 0x2f, 0x27, 0x05, 0x06, 0xaf,
+    0x2a, 0xab, 0x2a, 0x06, 0x28, 0x04, 0x00, 0x2f, 0x1f, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x10, 0x05,
+    0x2f, 0x27, 0x05, 0x06, 0xae, 0x2a, 0x00, 0x2b, 0xac, 0x25, 0x05, 0x04, 0x00, 0x2f, 0x27, 0x1a,
+    0x19, 0x96, 0x00, 0x05, 0x1a, 0x1f, 0x2f, 0x27, 0x05, 0x06, 0xaf, 0x25, 0xab, 0x24, 0x02, 0x21,
+    0x04, 0x00, 0x82, 0x2f, 0x00, 0x1f, 0x96, 0x00, 0x05, 0x23, 0x2f, 0x2f, 0x27, 0x05, 0x06, 0xaf,
+    0x24, 0xab, 0x24, 0x02, 0x21, 0x04, 0x00, 0x82, 0x2f, 0x00, 0x27, 0x96, 0x1a, 0x05, 0x2e, 0x2f,
+    0x2f, 0x27, 0x05, 0x06, 0xaf, 0x24, 0xab, 0x24, 0x02, 0x21, 0x04, 0x00, 0x9d, 0x2f, 0x02, 0x27,
+    0x05, 0x06, 0xaf, 0x24, 0xab, 0x24, 0x02, 0x21, 0x04, 0x00, 0x9d, 0x2f, 0x02, 0x27, 0x05, 0x06,
+    0xaf, 0x24, 0xab, 0x24, 0x02, 0x21, 0x04, 0x00, 0x8a, 0x2f, 0x00, 0x19, 0x86, 0x10, 0x00, 0x1f,
+    0x89, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xaf, 0x24, 0xab, 0x24, 0x02, 0x21, 0x04, 0x00, 0x8a, 0x2f,
+    0x87, 0x00, 0x00, 0x19, 0x89, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xaf, 0x24, 0xab, 0x24, 0x02, 0x21,
+    0x04, 0x00, 0x88, 0x2f, 0x02, 0x19, 0x10, 0x1a, 0x86, 0x23, 0x02, 0x19, 0x10, 0x1a, 0x87, 0x2f,
+    0x02, 0x27, 0x05, 0x06, 0xaf, 0x24, 0x00, 0x00, 0xaa, 0x24, 0x02, 0x21, 0x04, 0x00, 0x88, 0x2f,
+    0x02, 0x00, 0x00, 0x1f, 0x86, 0x2f, 0x02, 0x1a, 0x00, 0x19, 0x87, 0x2f, 0x02, 0x27, 0x05, 0x06,
+    0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x24, 0x02, 0x21, 0x04, 0x00, 0x88, 0x2f, 0x04, 0x00,
+    0x00, 0x1f, 0x2f, 0x20, 0x82, 0x00, 0x04, 0x23, 0x2f, 0x1a, 0x00, 0x19, 0x87, 0x2f, 0x02, 0x27,
+    0x05, 0x06, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x24, 0x02, 0x21, 0x04, 0x00, 0x88, 0x2f,
+    0x04, 0x00, 0x00, 0x1f, 0x2f, 0x1a, 0x82, 0x00, 0x04, 0x1f, 0x2f, 0x1a, 0x00, 0x19, 0x87, 0x2f,
+    0x02, 0x27, 0x05, 0x06, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x24, 0x02, 0x21, 0x04, 0x00,
+    0x88, 0x2f, 0x04, 0x00, 0x00, 0x1f, 0x2f, 0x1a, 0x82, 0x00, 0x04, 0x1f, 0x2f, 0x1a, 0x00, 0x19,
+    0x87, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x24, 0x02, 0x21,
+    0x04, 0x00, 0x88, 0x2f, 0x04, 0x00, 0x00, 0x1f, 0x2f, 0x1a, 0x82, 0x00, 0x04, 0x1f, 0x2f, 0x1a,
+    0x00, 0x19, 0x87, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xae, 0x24, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x24,
+    0x02, 0x21, 0x04, 0x00, 0x88, 0x2f, 0x04, 0x00, 0x00, 0x1f, 0x2f, 0x2e, 0x82, 0x23, 0x04, 0x2e,
+    0x2f, 0x1a, 0x00, 0x19, 0x87, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xae, 0x24, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0xa9, 0x24, 0x02, 0x21, 0x04, 0x00, 0x88, 0x2f, 0x02, 0x00, 0x00, 0x1f, 0x86, 0x2f, 0x02,
+    0x1a, 0x00, 0x19, 0x87, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xad, 0x24, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0xa9, 0x24, 0x02, 0x21, 0x04, 0x00, 0x88, 0x2f, 0x01, 0x20, 0x1f, 0x87, 0x00, 0x02, 0x19,
+    0x1f, 0x23, 0x87, 0x2f, 0x02, 0x27, 0x05, 0x06, 0xad, 0x24, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0xa9, 0x24, 0x02, 0x21, 0x04, 0x00, 0x8a, 0x2f, 0x87, 0x00, 0x00, 0x1a, 0x89, 0x2f, 0x02, 0x27,
+    0x05, 0x06, 0xad, 0x24, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xaa, 0x24, 0x04, 0x1c, 0x1b, 0x07,
+    0x0e, 0x2e, 0x87, 0x2f, 0x00, 0x23, 0x86, 0x1f, 0x00, 0x27, 0x87, 0x2f, 0x04, 0x2e, 0x07, 0x09,
+    0x1c, 0x21, 0xad, 0x24, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x24, 0x22, 0xa9, 0x24, 0x03, 0x1b,
+    0x03, 0x0a, 0x27, 0x98, 0x2e, 0x03, 0x27, 0x04, 0x09, 0x21, 0xac, 0x24, 0x00, 0x22, 0x82, 0x00,
+    0x82, 0x00, 0xaa, 0x24, 0x02, 0x22, 0x1c, 0x1b, 0x99, 0x0c, 0x02, 0x0b, 0x1c, 0x1c, 0xae, 0x24,
+    0x82, 0x00, 0x82, 0x00, 0xac, 0x24, 0x00, 0x1b, 0x99, 0x00, 0x00, 0x06, 0xb0, 0x24, 0x82, 0x00,
+    0x83, 0x00, 0xab, 0x24, 0x11, 0x22, 0x21, 0x1c, 0x21, 0x21, 0x1c, 0x21, 0x1c, 0x21, 0x21, 0x1c,
+    0x21, 0x1c, 0x21, 0x21, 0x1c, 0x21, 0x1c, 0x83, 0x21, 0x00, 0x1c, 0x84, 0x21, 0xaf, 0x24, 0x83,
+    0x00, 0x83, 0x00, 0xf7, 0x24, 0x83, 0x00, 0x83, 0x00, 0xf7, 0x24, 0x83, 0x00, 0x84, 0x00, 0xf5,
+    0x24, 0x84, 0x00, 0x84, 0x00, 0x01, 0x24, 0x22, 0x84, 0x24, 0x03, 0x22, 0x24, 0x24, 0x22, 0x8f,
+    0x24, 0x01, 0x22, 0x22, 0x85, 0x24, 0x07, 0x22, 0x22, 0x24, 0x24, 0x22, 0x24, 0x24, 0x22, 0x82,
+    0x24, 0x11, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x24, 0x22, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24,
+    0x22, 0x24, 0x22, 0x24, 0x83, 0x22, 0x03, 0x24, 0x24, 0x22, 0x24, 0x85, 0x22, 0x02, 0x24, 0x22,
+    0x22, 0x82, 0x24, 0x04, 0x22, 0x24, 0x22, 0x24, 0x24, 0x82, 0x22, 0x08, 0x24, 0x22, 0x22, 0x24,
+    0x24, 0x22, 0x24, 0x24, 0x22, 0x85, 0x24, 0x03, 0x22, 0x24, 0x24, 0x22, 0x82, 0x24, 0x00, 0x22,
+    0x82, 0x24, 0x84, 0x00, 0x84, 0x00, 0xf4, 0x17, 0x85, 0x00, 0x85, 0x00, 0xf3, 0x18, 0x85, 0x00,
+    0x85, 0x00, 0xf3, 0x18, 0x85, 0x00, 0x86, 0x00, 0xf1, 0x18, 0x86, 0x00, 0x86, 0x00, 0xf0, 0x18,
+    0x87, 0x00, 0x87, 0x00, 0xef, 0x18, 0x87, 0x00, 0x87, 0x00, 0xef, 0x18, 0x87, 0x00, 0x88, 0x00,
+    0xed, 0x18, 0x88, 0x00, 0x89, 0x00, 0xeb, 0x18, 0x89, 0x00, 0x89, 0x00, 0xeb, 0x18, 0x89, 0x00,
+    0x8a, 0x00, 0xe9, 0x18, 0x8a, 0x00, 0x8b, 0x00, 0xe7, 0x18, 0x8b, 0x00, 0x8b, 0x00, 0xe7, 0x18,
+    0x8b, 0x00, 0x8c, 0x00, 0xe5, 0x18, 0x8c, 0x00, 0x8d, 0x00, 0xe3, 0x18, 0x8d, 0x00, 0x8e, 0x00,
+    0xe1, 0x18, 0x8e, 0x00, 0x8e, 0x00, 0xe1, 0x18, 0x8e, 0x00, 0x8f, 0x00, 0xdf, 0x18, 0x8f, 0x00,
+    0x90, 0x00, 0xdd, 0x18, 0x90, 0x00, 0x91, 0x00, 0xdb, 0x18, 0x91, 0x00, 0x92, 0x00, 0xd9, 0x18,
+    0x92, 0x00, 0x93, 0x00, 0xd7, 0x18, 0x93, 0x00, 0x94, 0x00, 0xd5, 0x18, 0x94, 0x00, 0x95, 0x00,
+    0xd3, 0x18, 0x95, 0x00, 0x97, 0x00, 0xcf, 0x18, 0x97, 0x00, 0x98, 0x00, 0x00, 0x16, 0xcb, 0x0d,
+    0x00, 0x16, 0x98, 0x00, 0x99, 0x00, 0xcb, 0x02, 0x99, 0x00, 0x9b, 0x00, 0xc7, 0x02, 0x9b, 0x00,
+    0x9c, 0x00, 0xc5, 0x02, 0x9c, 0x00, 0x9e, 0x00, 0xc1, 0x02, 0x9e, 0x00, 0x9f, 0x00, 0xbf, 0x02,
+    0x9f, 0x00, 0xa1, 0x00, 0xbb, 0x02, 0xa1, 0x00, 0xa3, 0x00, 0xb7, 0x02, 0xa3, 0x00, 0xa5, 0x00,
+    0xb3, 0x02, 0xa5, 0x00, 0xa7, 0x00, 0xae, 0x02, 0xa8, 0x00, 0xaa, 0x00, 0xa9, 0x02, 0xaa, 0x00,
+    0xad, 0x00, 0xa3, 0x02, 0xad, 0x00, 0xb2, 0x00, 0x99, 0x02, 0xb2, 0x00, 0xb8, 0x00, 0x8d, 0x02,
+    0xb8, 0x00,
+};
+
+// 45 colors, 2961 bytes (raw: 32768)
+static constexpr uint16_t face_pal_3[] = {
+    0x0000, 0x0020, 0x057c, 0x0861, 0x1061, 0x10a2, 0x18a2, 0x2965, 0x3145, 0x38e1, 0x4941, 0x4a29,
+    0x4a49, 0x4a69, 0x4c39, 0x528a, 0x6b6d, 0x738e, 0x762b, 0x8e2a, 0x9a73, 0xa2b4, 0xa2b5, 0xaab4,
+    0xaab5, 0xb596, 0xb5b6, 0xba07, 0xd249, 0xd505, 0xd69a, 0xdedb, 0xe269, 0xe28a, 0xe71c, 0xea89,
+    0xeac9, 0xed85, 0xeda5, 0xef5d, 0xf484, 0xfca4, 0xfe06, 0xffdf, 0xffff,
+};
+static constexpr uint16_t face_row_3[] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 74, 80, 86, 92,
+    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+    202, 216, 235, 255, 277, 299, 327, 357, 388, 419, 450, 481, 512, 555, 604, 654,
+    705, 756, 807, 846, 883, 920, 959, 998, 1033, 1064, 1103, 1142, 1181, 1216, 1251, 1278,
+    1305, 1332, 1357, 1381, 1403, 1417, 1431, 1445, 1463, 1481, 1499, 1517, 1537, 1606, 1677, 1751,
+    1773, 1844, 1916, 1989, 2060, 2080, 2151, 2222, 2295, 2314, 2333, 2352, 2371, 2387, 2403, 2413,
+    2419, 2425, 2431, 2437, 2443, 2449, 2455, 2461, 2467, 2473, 2479, 2485, 2491, 2497, 2503, 2509,
+    2515, 2521, 2527, 2537, 2543, 2549, 2555, 2561, 2567, 2573, 2579, 2585, 2591, 2597, 2603, 2609,
+};
+static constexpr uint8_t face_code_3[] = {
+    0xb5, 0x00, 0x93, 0x12, 0xb5, 0x00, 0xb0, 0x00, 0x9d, 0x12, 0xb0, 0x00, 0xac, 0x00, 0xa5, 0x12,
+    0xac, 0x00, 0xa9, 0x00, 0xab, 0x12, 0xa9, 0x00, 0xa6, 0x00, 0xb1, 0x12, 0xa6, 0x00, 0xa4, 0x00,
+    0xb5, 0x12, 0xa4, 0x00, 0xa2, 0x00, 0xb9, 0x12, 0xa2, 0x00, 0xa0, 0x00, 0xbd, 0x12, 0xa0, 0x00,
+    0x9f, 0x00, 0xbf, 0x12, 0x9f, 0x00, 0x9d, 0x00, 0xc3, 0x12, 0x9d, 0x00, 0x9b, 0x00, 0xc7, 0x12,
+    0x9b, 0x00, 0x9a, 0x00, 0x00, 0x13, 0xc8, 0x12, 0x9a, 0x00, 0x99, 0x00, 0xcb, 0x2a, 0x99, 0x00,
+    0x97, 0x00, 0xcf, 0x2a, 0x97, 0x00, 0x96, 0x00, 0xd1, 0x2a, 0x96, 0x00, 0x95, 0x00, 0xd3, 0x2a,
+    0x95, 0x00, 0x94, 0x00, 0xd5, 0x2a, 0x94, 0x00, 0x93, 0x00, 0xd7, 0x2a, 0x93, 0x00, 0x92, 0x00,
+    0xd9, 0x2a, 0x92, 0x00, 0x91, 0x00, 0xdb, 0x2a, 0x91, 0x00, 0x90, 0x00, 0xdd, 0x2a, 0x90, 0x00,
+    0x8f, 0x00, 0xdf, 0x2a, 0x8f, 0x00, 0x8e, 0x00, 0xe1, 0x2a, 0x8e, 0x00, 0x8d, 0x00, 0xe3, 0x2a,
+    0x8d, 0x00, 0x8c, 0x00, 0xe4, 0x2a, 0x8d, 0x00, 0x8c, 0x00, 0xe5, 0x2a, 0x8c, 0x00, 0x8b, 0x00,
+    0xe7, 0x2a, 0x8b, 0x00, 0x8a, 0x00, 0xe9, 0x2a, 0x8a, 0x00, 0x8a, 0x00, 0xe9, 0x2a, 0x8a, 0x00,
+    0x89, 0x00, 0xeb, 0x2a, 0x89, 0x00, 0x88, 0x00, 0xed, 0x2a, 0x88, 0x00, 0x88, 0x00, 0x9b, 0x2a,
+    0x00, 0x26, 0xb2, 0x0a, 0x00, 0x25, 0x9c, 0x2a, 0x88, 0x00, 0x87, 0x00, 0x9c, 0x2a, 0x00, 0x25,
+    0xb2, 0x08, 0x00, 0x25, 0x9d, 0x2a, 0x87, 0x00, 0x87, 0x00, 0x9a, 0x2a, 0x03, 0x1d, 0x09, 0x0c,
+    0x22, 0xb1, 0x27, 0x02, 0x0f, 0x09, 0x26, 0x9b, 0x2a, 0x87, 0x00, 0x86, 0x00, 0x9b, 0x2a, 0x03,
+    0x1d, 0x05, 0x0d, 0x2b, 0xb0, 0x2c, 0x03, 0x2b, 0x0f, 0x05, 0x26, 0x9c, 0x2a, 0x86, 0x00, 0x86,
+    0x00, 0x99, 0x2a, 0x04, 0x26, 0x0a, 0x11, 0x2b, 0x2b, 0xb2, 0x2c, 0x04, 0x2b, 0x2b, 0x0f, 0x0a,
+    0x25, 0x9a, 0x2a, 0x86, 0x00, 0x85, 0x00, 0x9a, 0x2a, 0x02, 0x26, 0x06, 0x11, 0x85, 0x2c, 0xaa,
+    0x2b, 0x85, 0x2c, 0x02, 0x0f, 0x04, 0x25, 0x9b, 0x2a, 0x85, 0x00, 0x85, 0x00, 0x9a, 0x2a, 0x02,
+    0x26, 0x06, 0x11, 0x84, 0x2c, 0x01, 0x27, 0x07, 0xa8, 0x06, 0x01, 0x08, 0x22, 0x84, 0x2c, 0x02,
+    0x0f, 0x04, 0x25, 0x9b, 0x2a, 0x85, 0x00, 0x84, 0x00, 0x9b, 0x29, 0x02, 0x28, 0x06, 0x11, 0x83,
+    0x2c, 0x02, 0x27, 0x22, 0x07, 0xa8, 0x06, 0x02, 0x08, 0x1f, 0x27, 0x83, 0x2c, 0x02, 0x0f, 0x04,
+    0x28, 0x9c, 0x29, 0x84, 0x00, 0x84, 0x00, 0x9b, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03,
+    0x27, 0x07, 0x10, 0x27, 0xa9, 0x2b, 0x02, 0x11, 0x0d, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28,
+    0x9c, 0x29, 0x84, 0x00, 0x83, 0x00, 0x9c, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27,
+    0x00, 0x0f, 0x2b, 0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9d,
+    0x29, 0x83, 0x00, 0x83, 0x00, 0x9c, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00,
+    0x0f, 0x2b, 0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9d, 0x29,
+    0x83, 0x00, 0x83, 0x00, 0x9c, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f,
+    0x2b, 0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9d, 0x29, 0x83,
+    0x00, 0x82, 0x00, 0x9d, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b,
+    0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9e, 0x29, 0x82, 0x00,
+    0x82, 0x00, 0x9d, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8b,
+    0x2c, 0x00, 0x2b, 0x86, 0x2c, 0x00, 0x2b, 0x84, 0x2c, 0x00, 0x2b, 0x8e, 0x2c, 0x02, 0x10, 0x07,
+    0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9e, 0x29, 0x82, 0x00, 0x82, 0x00, 0x9d, 0x29, 0x02,
+    0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8a, 0x2c, 0x02, 0x19, 0x0f, 0x1e,
+    0x84, 0x2c, 0x02, 0x1e, 0x0f, 0x1a, 0x82, 0x2c, 0x02, 0x1f, 0x0f, 0x1a, 0x8d, 0x2c, 0x02, 0x10,
+    0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9e, 0x29, 0x82, 0x00, 0x01, 0x00, 0x00, 0x9e,
+    0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8a, 0x2c, 0x02, 0x00,
+    0x00, 0x1a, 0x84, 0x2c, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x2c, 0x02, 0x1e, 0x00, 0x1a, 0x8d, 0x2c,
+    0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9e, 0x29, 0x82, 0x00, 0x01, 0x00,
+    0x00, 0x9e, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8a, 0x2c,
+    0x02, 0x00, 0x00, 0x1a, 0x84, 0x2c, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x2c, 0x02, 0x1e, 0x00, 0x1a,
+    0x8d, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9f, 0x29, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x9e, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f,
+    0x2b, 0x8a, 0x2c, 0x02, 0x00, 0x06, 0x1a, 0x84, 0x2c, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x2c, 0x02,
+    0x1e, 0x06, 0x1a, 0x8d, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9f,
+    0x29, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03,
+    0x27, 0x00, 0x0f, 0x2b, 0x8a, 0x2c, 0x02, 0x27, 0x27, 0x2b, 0x84, 0x2c, 0x02, 0x1a, 0x00, 0x19,
+    0x82, 0x2c, 0x02, 0x2b, 0x27, 0x2b, 0x8d, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f,
+    0x04, 0x28, 0x9f, 0x29, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x29, 0x02, 0x28, 0x06, 0x11,
+    0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x92, 0x2c, 0x02, 0x1a, 0x00, 0x19, 0x93, 0x2c, 0x02,
+    0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0x9f, 0x29, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x9f, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x92, 0x2c, 0x02,
+    0x1a, 0x00, 0x19, 0x93, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa0,
+    0x29, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00,
+    0x0f, 0x2b, 0x92, 0x2c, 0x02, 0x1a, 0x00, 0x19, 0x93, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c,
+    0x02, 0x0f, 0x04, 0x28, 0xa0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x29, 0x02, 0x28, 0x06, 0x11,
+    0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x90, 0x2c, 0x04, 0x1e, 0x00, 0x0f, 0x00, 0x19, 0x93,
+    0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa0, 0x29, 0x00, 0x00, 0x00,
+    0x00, 0x9f, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x90, 0x2c,
+    0x00, 0x1a, 0x82, 0x05, 0x00, 0x19, 0x93, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f,
+    0x04, 0x28, 0xa0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c,
+    0x03, 0x27, 0x00, 0x0f, 0x2b, 0x90, 0x2c, 0x84, 0x2b, 0x93, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82,
+    0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa0, 0x29, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x29, 0x02, 0x28, 0x06,
+    0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c,
+    0x02, 0x0f, 0x04, 0x28, 0xa0, 0x29, 0x00, 0x00, 0xa0, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c,
+    0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8c, 0x2c, 0x02, 0x1a, 0x11, 0x1e, 0x86, 0x2c, 0x02, 0x1e, 0x11,
+    0x19, 0x8f, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa1, 0x29, 0xa0,
+    0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8c, 0x2c, 0x02, 0x00,
+    0x00, 0x1e, 0x86, 0x2c, 0x02, 0x1a, 0x00, 0x11, 0x8f, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c,
+    0x02, 0x0f, 0x04, 0x28, 0xa1, 0x29, 0xa0, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27,
+    0x00, 0x0f, 0x2b, 0x8c, 0x2c, 0x02, 0x27, 0x1f, 0x00, 0x86, 0x10, 0x02, 0x19, 0x1f, 0x22, 0x8f,
+    0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa1, 0x29, 0xa0, 0x29, 0x02,
+    0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8e, 0x2c, 0x00, 0x00, 0x86, 0x01,
+    0x00, 0x19, 0x91, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa1, 0x29,
+    0xa0, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0x8e, 0x2c, 0x00,
+    0x27, 0x86, 0x22, 0x00, 0x27, 0x91, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04,
+    0x28, 0xa1, 0x29, 0xa0, 0x29, 0x02, 0x28, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b,
+    0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x28, 0xa1, 0x29, 0xa0, 0x24,
+    0x02, 0x20, 0x06, 0x11, 0x82, 0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0xa9, 0x2c, 0x02, 0x10, 0x07,
+    0x2b, 0x82, 0x2c, 0x02, 0x0f, 0x04, 0x1c, 0xa1, 0x24, 0xa0, 0x23, 0x02, 0x1c, 0x06, 0x11, 0x82,
+    0x2c, 0x03, 0x27, 0x00, 0x0f, 0x2b, 0xa9, 0x2c, 0x02, 0x10, 0x07, 0x2b, 0x82, 0x2c, 0x02, 0x0f,
+    0x04, 0x1c, 0xa1, 0x23, 0xa0, 0x23, 0x02, 0x1c, 0x06, 0x11, 0x82, 0x2c, 0x02, 0x2b, 0x1e, 0x1a,
+    0xaa, 0x00, 0x01, 0x1a, 0x1e, 0x83, 0x2c, 0x02, 0x0f, 0x04, 0x1c, 0xa1, 0x23, 0xa0, 0x23, 0x02,
+    0x1c, 0x06, 0x11, 0x84, 0x2c, 0x01, 0x27, 0x03, 0xa8, 0x00, 0x01, 0x01, 0x22, 0x84, 0x2c, 0x02,
+    0x0f, 0x04, 0x1c, 0xa1, 0x23, 0xa0, 0x23, 0x02, 0x1c, 0x06, 0x11, 0x84, 0x2c, 0x00, 0x2b, 0xaa,
+    0x1e, 0x00, 0x2b, 0x84, 0x2c, 0x02, 0x0f, 0x04, 0x1c, 0xa1, 0x23, 0xa0, 0x23, 0x02, 0x1c, 0x06,
+    0x11, 0xb6, 0x2c, 0x02, 0x0f, 0x04, 0x1c, 0xa1, 0x23, 0xa0, 0x23, 0x02, 0x1c, 0x06, 0x11, 0xb6,
+    0x2c, 0x02, 0x0f, 0x04, 0x1c, 0xa1, 0x23, 0xa0, 0x23, 0x02, 0x1c, 0x06, 0x11, 0xb6, 0x2c, 0x02,
+    0x0f, 0x04, 0x1c, 0xa1, 0x23, 0x00, 0x00, 0x9f, 0x23, 0x02, 0x1c, 0x06, 0x11, 0xb6, 0x2c, 0x02,
+    0x0f, 0x04, 0x1c, 0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x02, 0x1c, 0x06, 0x11, 0xb6,
+    0x2b, 0x02, 0x0d, 0x04, 0x1c, 0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x02, 0x1c, 0x06,
+    0x05, 0xb6, 0x07, 0x02, 0x03, 0x04, 0x1c, 0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x23, 0x02,
+    0x1c, 0x06, 0x01, 0xb6, 0x10, 0x02, 0x06, 0x04, 0x1c, 0xa0, 0x23, 0x00, 0x00, 0x00, 0x00, 0x9f,
+    0x23, 0x03, 0x1c, 0x06, 0x05, 0x2b, 0xb4, 0x2c, 0x03, 0x2b, 0x0f, 0x04, 0x1c, 0xa0, 0x23, 0x00,
+    0x00, 0x00, 0x00, 0x9f, 0x23, 0x02, 0x1c, 0x06, 0x05, 0x82, 0x2c, 0x2f, 0x2b, 0x1a, 0x1a, 0x2b,
+    0x2c, 0x1e, 0x1a, 0x1f, 0x2c, 0x27, 0x1a, 0x1a, 0x2c, 0x2c, 0x1a, 0x1a, 0x27, 0x2c, 0x1f, 0x1a,
+    0x1e, 0x2c, 0x2b, 0x1a, 0x1a, 0x2b, 0x2c, 0x1e, 0x1a, 0x1f, 0x2c, 0x27, 0x1a, 0x1a, 0x2c, 0x2c,
+    0x1a, 0x1a, 0x27, 0x2c, 0x1f, 0x1a, 0x1e, 0x2c, 0x2b, 0x1a, 0x1a, 0x2b, 0x83, 0x2c, 0x02, 0x0f,
+    0x04, 0x1c, 0xa0, 0x23, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x23, 0x02, 0x1c, 0x06, 0x05, 0x82,
+    0x2c, 0x2f, 0x27, 0x00, 0x03, 0x27, 0x2c, 0x00, 0x00, 0x19, 0x2c, 0x1e, 0x00, 0x0b, 0x2b, 0x2b,
+    0x0b, 0x00, 0x1e, 0x2c, 0x19, 0x00, 0x00, 0x2c, 0x27, 0x03, 0x00, 0x27, 0x2c, 0x11, 0x00, 0x19,
+    0x2c, 0x1e, 0x00, 0x0f, 0x2c, 0x2b, 0x0b, 0x00, 0x1e, 0x2c, 0x19, 0x00, 0x00, 0x2c, 0x22, 0x00,
+    0x05, 0x27, 0x83, 0x2c, 0x02, 0x0f, 0x04, 0x1c, 0x9f, 0x23, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x9d, 0x23, 0x03, 0x1b, 0x1b, 0x11, 0x11, 0x82, 0x2c, 0x2f, 0x27, 0x11, 0x11, 0x27, 0x2c, 0x19,
+    0x11, 0x1a, 0x2c, 0x1f, 0x11, 0x00, 0x2b, 0x2b, 0x00, 0x11, 0x1f, 0x2c, 0x1a, 0x11, 0x19, 0x2c,
+    0x27, 0x11, 0x11, 0x27, 0x2c, 0x00, 0x11, 0x1e, 0x2c, 0x1f, 0x11, 0x00, 0x2c, 0x2b, 0x00, 0x11,
+    0x1f, 0x2c, 0x1a, 0x11, 0x19, 0x2c, 0x27, 0x11, 0x11, 0x2b, 0x83, 0x2c, 0x04, 0x00, 0x11, 0x1b,
+    0x1b, 0x21, 0x9d, 0x23, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9c, 0x23, 0x03, 0x20, 0x00, 0x07,
+    0x27, 0xb8, 0x2c, 0x03, 0x2b, 0x0b, 0x00, 0x1c, 0x9d, 0x23, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x9c, 0x23, 0x03, 0x20, 0x00, 0x07, 0x2b, 0x84, 0x2c, 0x03, 0x2b, 0x2b, 0x2c, 0x2c, 0x82, 0x2b,
+    0x00, 0x2c, 0x82, 0x2b, 0x01, 0x2c, 0x2c, 0x82, 0x2b, 0x00, 0x2c, 0x82, 0x2b, 0x05, 0x2c, 0x2c,
+    0x2b, 0x2b, 0x2c, 0x2c, 0x82, 0x2b, 0x00, 0x2c, 0x82, 0x2b, 0x05, 0x2c, 0x2c, 0x2b, 0x2b, 0x2c,
+    0x2c, 0x82, 0x2b, 0x03, 0x2c, 0x2c, 0x2b, 0x2b, 0x85, 0x2c, 0x03, 0x2b, 0x0b, 0x00, 0x1c, 0x9d,
+    0x23, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9c, 0x23, 0x03, 0x20, 0x00, 0x07, 0x2b, 0x83, 0x2c,
+    0x2f, 0x27, 0x05, 0x05, 0x27, 0x2c, 0x00, 0x05, 0x19, 0x2c, 0x1e, 0x05, 0x0d, 0x2b, 0x2b, 0x0d,
+    0x05, 0x1e, 0x2c, 0x19, 0x05, 0x00, 0x2c, 0x27, 0x05, 0x05, 0x27, 0x2c, 0x11, 0x05, 0x19, 0x2c,
+    0x1e, 0x05, 0x0f, 0x2c, 0x2b, 0x0d, 0x05, 0x1e, 0x2c, 0x19, 0x05, 0x00, 0x2c, 0x22, 0x05, 0x08,
+    0x27, 0x84, 0x2c, 0x03, 0x2b, 0x0b, 0x00, 0x1c, 0x9c, 0x23, 0x82, 0x00, 0x82, 0x00, 0x9a, 0x23,
+    0x04, 0x1c, 0x1c, 0x07, 0x0f, 0x2b, 0x83, 0x2c, 0x2f, 0x27, 0x00, 0x03, 0x27, 0x2c, 0x00, 0x00,
+    0x19, 0x2c, 0x1e, 0x00, 0x0b, 0x2b, 0x2b, 0x0b, 0x00, 0x1e, 0x2c, 0x19, 0x00, 0x00, 0x2c, 0x27,
+    0x03, 0x00, 0x27, 0x2c, 0x11, 0x00, 0x19, 0x2c, 0x1e, 0x00, 0x0f, 0x2c, 0x2b, 0x0b, 0x00, 0x1e,
+    0x2c, 0x19, 0x00, 0x00, 0x2c, 0x22, 0x00, 0x05, 0x27, 0x84, 0x2c, 0x04, 0x2b, 0x0f, 0x07, 0x1b,
+    0x1c, 0x9b, 0x23, 0x82, 0x00, 0x82, 0x00, 0x99, 0x23, 0x04, 0x20, 0x09, 0x06, 0x27, 0x2b, 0x85,
+    0x2c, 0x2d, 0x22, 0x22, 0x2b, 0x2c, 0x27, 0x22, 0x27, 0x2c, 0x2b, 0x22, 0x22, 0x2c, 0x2c, 0x22,
+    0x22, 0x2b, 0x2c, 0x27, 0x22, 0x27, 0x2c, 0x2b, 0x22, 0x22, 0x2c, 0x2c, 0x27, 0x22, 0x27, 0x2c,
+    0x2b, 0x22, 0x22, 0x2c, 0x2c, 0x22, 0x22, 0x2b, 0x2c, 0x27, 0x22, 0x27, 0x2c, 0x2b, 0x22, 0x22,
+    0x86, 0x2c, 0x04, 0x2b, 0x2b, 0x0c, 0x06, 0x1c, 0x9a, 0x23, 0x82, 0x00, 0x83, 0x00, 0x98, 0x23,
+    0x03, 0x1c, 0x06, 0x01, 0x2b, 0xbc, 0x2c, 0x03, 0x2b, 0x0b, 0x04, 0x1c, 0x99, 0x23, 0x83, 0x00,
+    0x83, 0x00, 0x98, 0x23, 0x03, 0x1c, 0x06, 0x01, 0x2b, 0x85, 0x2c, 0x2f, 0x2b, 0x00, 0x00, 0x27,
+    0x2c, 0x1a, 0x00, 0x1e, 0x2c, 0x22, 0x00, 0x00, 0x2b, 0x2b, 0x00, 0x00, 0x22, 0x2c, 0x1e, 0x00,
+    0x1a, 0x2c, 0x27, 0x00, 0x00, 0x2b, 0x2c, 0x19, 0x00, 0x1e, 0x2c, 0x1f, 0x00, 0x00, 0x2c, 0x2c,
+    0x00, 0x00, 0x22, 0x2c, 0x1e, 0x00, 0x1a, 0x2c, 0x27, 0x00, 0x00, 0x2b, 0x86, 0x2c, 0x03, 0x2b,
+    0x0b, 0x04, 0x1c, 0x99, 0x23, 0x83, 0x00, 0x83, 0x00, 0x98, 0x23, 0x03, 0x1c, 0x06, 0x01, 0x2b,
+    0x85, 0x2c, 0x2f, 0x27, 0x00, 0x03, 0x27, 0x2c, 0x00, 0x00, 0x19, 0x2c, 0x1e, 0x00, 0x0b, 0x2b,
+    0x2b, 0x0b, 0x00, 0x1e, 0x2c, 0x19, 0x00, 0x00, 0x2c, 0x27, 0x03, 0x00, 0x27, 0x2c, 0x11, 0x00,
+    0x19, 0x2c, 0x1e, 0x00, 0x0f, 0x2c, 0x2b, 0x0b, 0x00, 0x1e, 0x2c, 0x19, 0x00, 0x00, 0x2c, 0x22,
+    0x00, 0x05, 0x27, 0x86, 0x2c, 0x03, 0x2b, 0x0b, 0x04, 0x1c, 0x99, 0x23, 0x83, 0x00, 0x84, 0x00,
+    0x96, 0x23, 0x04, 0x1b, 0x1b, 0x10, 0x10, 0x2b, 0x85, 0x2c, 0x2f, 0x2b, 0x00, 0x19, 0x2b, 0x2c,
+    0x1a, 0x00, 0x1e, 0x2c, 0x22, 0x00, 0x19, 0x2b, 0x2b, 0x19, 0x00, 0x22, 0x2c, 0x1e, 0x00, 0x1a,
+    0x2c, 0x2b, 0x19, 0x00, 0x2b, 0x2c, 0x1a, 0x00, 0x1e, 0x2c, 0x22, 0x00, 0x19, 0x2c, 0x2c, 0x19,
+    0x00, 0x22, 0x2c, 0x1e, 0x00, 0x1a, 0x2c, 0x27, 0x00, 0x19, 0x2b, 0x86, 0x2c, 0x04, 0x2b, 0x11,
+    0x10, 0x1b, 0x1b, 0x97, 0x23, 0x84, 0x00, 0x84, 0x00, 0x96, 0x23, 0x02, 0x01, 0x07, 0x27, 0xc0,
+    0x2c, 0x03, 0x2b, 0x07, 0x01, 0x20, 0x96, 0x23, 0x84, 0x00, 0x84, 0x00, 0x96, 0x17, 0x02, 0x01,
+    0x07, 0x27, 0xc0, 0x2c, 0x03, 0x2b, 0x07, 0x01, 0x15, 0x95, 0x17, 0x85, 0x00, 0x85, 0x00, 0x95,
+    0x18, 0x02, 0x01, 0x07, 0x27, 0xc0, 0x2c, 0x03, 0x2b, 0x07, 0x01, 0x15, 0x95, 0x18, 0x85, 0x00,
+    0x85, 0x00, 0x95, 0x18, 0x02, 0x04, 0x07, 0x22, 0xc0, 0x2b, 0x03, 0x27, 0x07, 0x03, 0x15, 0x95,
+    0x18, 0x85, 0x00, 0x86, 0x00, 0x95, 0x18, 0x01, 0x15, 0x08, 0xc0, 0x00, 0x01, 0x06, 0x14, 0x96,
+    0x18, 0x86, 0x00, 0x86, 0x00, 0x95, 0x18, 0x01, 0x15, 0x07, 0xc0, 0x08, 0x01, 0x07, 0x15, 0x95,
+    0x18, 0x87, 0x00, 0x87, 0x00, 0x95, 0x18, 0xc2, 0x15, 0x96, 0x18, 0x87, 0x00, 0x87, 0x00, 0xef,
+    0x18, 0x87, 0x00, 0x88, 0x00, 0xed, 0x18, 0x88, 0x00, 0x89, 0x00, 0xeb, 0x18, 0x89, 0x00, 0x89,
+    0x00, 0xeb, 0x18, 0x89, 0x00, 0x8a, 0x00, 0xe9, 0x18, 0x8a, 0x00, 0x8b, 0x00, 0xe7, 0x18, 0x8b,
+    0x00, 0x8b, 0x00, 0xe7, 0x18, 0x8b, 0x00, 0x8c, 0x00, 0xe5, 0x18, 0x8c, 0x00, 0x8d, 0x00, 0xe3,
+    0x18, 0x8d, 0x00, 0x8e, 0x00, 0xe1, 0x18, 0x8e, 0x00, 0x8e, 0x00, 0xe1, 0x18, 0x8e, 0x00, 0x8f,
+    0x00, 0xdf, 0x18, 0x8f, 0x00, 0x90, 0x00, 0xdd, 0x18, 0x90, 0x00, 0x91, 0x00, 0xdb, 0x18, 0x91,
+    0x00, 0x92, 0x00, 0xd9, 0x18, 0x92, 0x00, 0x93, 0x00, 0xd7, 0x18, 0x93, 0x00, 0x94, 0x00, 0xd5,
+    0x18, 0x94, 0x00, 0x95, 0x00, 0xd3, 0x18, 0x95, 0x00, 0x97, 0x00, 0xcf, 0x18, 0x97, 0x00, 0x98,
+    0x00, 0x00, 0x16, 0xcb, 0x0e, 0x00, 0x16, 0x98, 0x00, 0x99, 0x00, 0xcb, 0x02, 0x99, 0x00, 0x9b,
+    0x00, 0xc7, 0x02, 0x9b, 0x00, 0x9c, 0x00, 0xc5, 0x02, 0x9c, 0x00, 0x9e, 0x00, 0xc1, 0x02, 0x9e,
+    0x00, 0x9f, 0x00, 0xbf, 0x02, 0x9f, 0x00, 0xa1, 0x00, 0xbb, 0x02, 0xa1, 0x00, 0xa3, 0x00, 0xb7,
+    0x02, 0xa3, 0x00, 0xa5, 0x00, 0xb3, 0x02, 0xa5, 0x00, 0xa7, 0x00, 0xae, 0x02, 0xa8, 0x00, 0xaa,
+    0x00, 0xa9, 0x02, 0xaa, 0x00, 0xad, 0x00, 0xa3, 0x02, 0xad, 0x00, 0xb2, 0x00, 0x99, 0x02, 0xb2,
+    0x00, 0xb8, 0x00, 0x8d, 0x02, 0xb8, 0x00,
+};
+
+// 48 colors, 2199 bytes (raw: 32768)
+static constexpr uint16_t face_pal_4[] = {
+    0x0000, 0x0020, 0x057c, 0x0861, 0x1061, 0x1081, 0x10a2, 0x18a2, 0x2965, 0x38e1, 0x4941, 0x4a29,
+    0x4a49, 0x4a69, 0x4c39, 0x528a, 0x5903, 0x69a3, 0x6b6d, 0x738e, 0x762b, 0x7a42, 0x8e2a, 0x9363,
+    0xa2b5, 0xaab4, 0xaab5, 0xb596, 0xb5b6, 0xba07, 0xd249, 0xd505, 0xd69a, 0xdedb, 0xe269, 0xe28a,
+    0xe71c, 0xea89, 0xeac9, 0xed85, 0xef5d, 0xf484, 0xf565, 0xfca4, 0xfe06, 0xfe26, 0xffdf, 0xffff,
+};
+static constexpr uint16_t face_row_4[] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 74, 80, 86, 92,
+    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+    194, 200, 206, 216, 228, 242, 261, 281, 306, 332, 357, 382, 407, 445, 488, 532,
+    577, 622, 667, 700, 731, 762, 795, 828, 857, 882, 915, 948, 981, 1010, 1039, 1060,
+    1080, 1101, 1122, 1143, 1164, 1185, 1206, 1227, 1252, 1277, 1302, 1327, 1351, 1378, 1407, 1436,
+    1465, 1495, 1518, 1536, 1550, 1569, 1575, 1581, 1587, 1609, 1615, 1621, 1627, 1633, 1639, 1645,
+    1651, 1657, 1663, 1669, 1675, 1681, 1687, 1693, 1699, 1705, 1711, 1717, 1723, 1729, 1735, 1741,
+    1747, 1753, 1759, 1769, 1775, 1781, 1787, 1793, 1799, 1805, 1811, 1817, 1823, 1829, 1835, 1841,
+};
+static constexpr uint8_t face_code_4[] = {
+    0xb5, 0x00, 0x93, 0x14, 0xb5, 0x00, 0xb0, 0x00, 0x9d, 0x14, 0xb0, 0x00, 0xac, 0x00, 0xa5, 0x14,
+    0xac, 0x00, 0xa9, 0x00, 0xab, 0x14, 0xa9, 0x00, 0xa6, 0x00, 0xb1, 0x14, 0xa6, 0x00, 0xa4, 0x00,
+    0xb5, 0x14, 0xa4, 0x00, 0xa2, 0x00, 0xb9, 0x14, 0xa2, 0x00, 0xa0, 0x00, 0xbd, 0x14, 0xa0, 0x00,
+    0x9f, 0x00, 0xbf, 0x14, 0x9f, 0x00, 0x9d, 0x00, 0xc3, 0x14, 0x9d, 0x00, 0x9b, 0x00, 0xc7, 0x14,
+    0x9b, 0x00, 0x9a, 0x00, 0x00, 0x16, 0xc8, 0x14, 0x9a, 0x00, 0x99, 0x00, 0xcb, 0x2c, 0x99, 0x00,
+    0x97, 0x00, 0xcf, 0x2c, 0x97, 0x00, 0x96, 0x00, 0xd1, 0x2c, 0x96, 0x00, 0x95, 0x00, 0xd3, 0x2c,
+    0x95, 0x00, 0x94, 0x00, 0xd5, 0x2c, 0x94, 0x00, 0x93, 0x00, 0xd7, 0x2c, 0x93, 0x00, 0x92, 0x00,
+    0xd9, 0x2c, 0x92, 0x00, 0x91, 0x00, 0xdb, 0x2c, 0x91, 0x00, 0x90, 0x00, 0xdd, 0x2c, 0x90, 0x00,
+    0x8f, 0x00, 0xdf, 0x2c, 0x8f, 0x00, 0x8e, 0x00, 0xe1, 0x2c, 0x8e, 0x00, 0x8d, 0x00, 0xe3, 0x2c,
+    0x8d, 0x00, 0x8c, 0x00, 0xe4, 0x2c, 0x8d, 0x00, 0x8c, 0x00, 0xe5, 0x2c, 0x8c, 0x00, 0x8b, 0x00,
+    0xe7, 0x2c, 0x8b, 0x00, 0x8a, 0x00, 0xe9, 0x2c, 0x8a, 0x00, 0x8a, 0x00, 0xe9, 0x2c, 0x8a, 0x00,
+    0x89, 0x00, 0xeb, 0x2c, 0x89, 0x00, 0x88, 0x00, 0xed, 0x2c, 0x88, 0x00, 0x88, 0x00, 0xed, 0x2c,
+    0x88, 0x00, 0x87, 0x00, 0xef, 0x2c, 0x87, 0x00, 0x87, 0x00, 0xef, 0x2c, 0x87, 0x00, 0x86, 0x00,
+    0xa9, 0x2c, 0x9a, 0x2d, 0xac, 0x2c, 0x86, 0x00, 0x86, 0x00, 0xa8, 0x2c, 0x00, 0x1f, 0x9a, 0x15,
+    0xac, 0x2c, 0x86, 0x00, 0x85, 0x00, 0xa9, 0x2c, 0x00, 0x1f, 0x99, 0x00, 0x00, 0x03, 0xad, 0x2c,
+    0x85, 0x00, 0x85, 0x00, 0xa7, 0x2c, 0x02, 0x27, 0x17, 0x17, 0x99, 0x21, 0x03, 0x20, 0x17, 0x17,
+    0x2a, 0xaa, 0x2c, 0x85, 0x00, 0x84, 0x00, 0xa8, 0x2b, 0x03, 0x1f, 0x00, 0x0b, 0x2e, 0x98, 0x2f,
+    0x03, 0x2e, 0x00, 0x09, 0x29, 0xab, 0x2b, 0x84, 0x00, 0x84, 0x00, 0xa6, 0x2b, 0x06, 0x29, 0x10,
+    0x13, 0x21, 0x21, 0x2f, 0x28, 0x96, 0x12, 0x05, 0x28, 0x2e, 0x21, 0x20, 0x10, 0x11, 0xaa, 0x2b,
+    0x84, 0x00, 0x83, 0x00, 0xa7, 0x2b, 0x02, 0x29, 0x01, 0x00, 0x82, 0x2f, 0x01, 0x20, 0x04, 0x95,
+    0x01, 0x05, 0x24, 0x2f, 0x2f, 0x28, 0x06, 0x07, 0xab, 0x2b, 0x83, 0x00, 0x83, 0x00, 0xa7, 0x2b,
+    0x06, 0x29, 0x01, 0x00, 0x2f, 0x21, 0x13, 0x00, 0x96, 0x24, 0x05, 0x00, 0x13, 0x2f, 0x28, 0x06,
+    0x07, 0xab, 0x2b, 0x83, 0x00, 0x83, 0x00, 0xa7, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00,
+    0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xab, 0x2b, 0x83, 0x00, 0x82, 0x00,
+    0xa8, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f,
+    0x28, 0x06, 0x07, 0xac, 0x2b, 0x82, 0x00, 0x82, 0x00, 0xa8, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f,
+    0x20, 0x00, 0x00, 0x82, 0x2f, 0x01, 0x2e, 0x2e, 0x85, 0x2f, 0x82, 0x2e, 0x83, 0x2f, 0x00, 0x2e,
+    0x83, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xac, 0x2b, 0x82, 0x00, 0x82, 0x00, 0xa8,
+    0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x82, 0x2f, 0x02, 0x1c, 0x0f, 0x20, 0x84,
+    0x2f, 0x02, 0x1c, 0x0f, 0x1c, 0x82, 0x2f, 0x02, 0x20, 0x0f, 0x1c, 0x82, 0x2f, 0x05, 0x12, 0x06,
+    0x2f, 0x28, 0x06, 0x07, 0xac, 0x2b, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x2b, 0x06, 0x29, 0x01,
+    0x00, 0x2f, 0x20, 0x00, 0x00, 0x82, 0x2f, 0x02, 0x1b, 0x00, 0x1c, 0x84, 0x2f, 0x02, 0x1c, 0x00,
+    0x1b, 0x82, 0x2f, 0x02, 0x20, 0x00, 0x1c, 0x82, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07,
+    0xac, 0x2b, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00,
+    0x00, 0x82, 0x2f, 0x02, 0x1b, 0x00, 0x1c, 0x84, 0x2f, 0x02, 0x1c, 0x00, 0x1b, 0x82, 0x2f, 0x02,
+    0x20, 0x00, 0x1c, 0x82, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xad, 0x2b, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0xa9, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x82, 0x2f,
+    0x02, 0x1b, 0x07, 0x1c, 0x84, 0x2f, 0x02, 0x1c, 0x00, 0x1b, 0x82, 0x2f, 0x02, 0x20, 0x07, 0x1c,
+    0x82, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xad, 0x2b, 0x01, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0xa9, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x82, 0x2f, 0x02, 0x28, 0x28,
+    0x2e, 0x84, 0x2f, 0x02, 0x1c, 0x00, 0x1b, 0x82, 0x2f, 0x02, 0x2e, 0x28, 0x2e, 0x82, 0x2f, 0x05,
+    0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xad, 0x2b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x2b,
+    0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x8a, 0x2f, 0x02, 0x1c, 0x00, 0x1b, 0x88, 0x2f,
+    0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xad, 0x2b, 0x01, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2b,
+    0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x8a, 0x2f, 0x02, 0x1c, 0x00, 0x1b, 0x88, 0x2f,
+    0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2b, 0x06,
+    0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x8a, 0x2f, 0x02, 0x1c, 0x00, 0x1b, 0x88, 0x2f, 0x05,
+    0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2b, 0x06, 0x29,
+    0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x88, 0x2f, 0x04, 0x20, 0x00, 0x0f, 0x00, 0x1b, 0x88, 0x2f,
+    0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2b, 0x06,
+    0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x88, 0x2f, 0x00, 0x1c, 0x82, 0x04, 0x00, 0x1b, 0x88,
+    0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2b,
+    0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x88, 0x2f, 0x84, 0x2e, 0x88, 0x2f, 0x05, 0x12,
+    0x06, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x2b, 0x06, 0x29, 0x01,
+    0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x2b,
+    0x00, 0x00, 0xab, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x84, 0x2f, 0x02, 0x1b,
+    0x13, 0x20, 0x86, 0x2f, 0x02, 0x20, 0x13, 0x1b, 0x84, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06,
+    0x07, 0xaf, 0x2b, 0xab, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x84, 0x2f, 0x02,
+    0x00, 0x00, 0x20, 0x86, 0x2f, 0x02, 0x1c, 0x00, 0x13, 0x84, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28,
+    0x06, 0x07, 0xaf, 0x2b, 0xab, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x84, 0x2f,
+    0x02, 0x28, 0x21, 0x00, 0x86, 0x12, 0x02, 0x1b, 0x21, 0x24, 0x84, 0x2f, 0x05, 0x12, 0x06, 0x2f,
+    0x28, 0x06, 0x07, 0xaf, 0x2b, 0xab, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x86,
+    0x2f, 0x00, 0x00, 0x86, 0x01, 0x00, 0x1c, 0x86, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07,
+    0xaf, 0x2b, 0xab, 0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x86, 0x2f, 0x00, 0x28,
+    0x86, 0x24, 0x00, 0x28, 0x86, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf, 0x2b, 0xab,
+    0x2b, 0x06, 0x29, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28,
+    0x06, 0x07, 0xaf, 0x2b, 0xac, 0x26, 0x05, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05,
+    0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf, 0x26, 0xab, 0x25, 0x06, 0x22, 0x01, 0x00, 0x2f, 0x20,
+    0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf, 0x25, 0xab, 0x25, 0x06,
+    0x22, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07,
+    0xaf, 0x25, 0xab, 0x25, 0x06, 0x22, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12,
+    0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf, 0x25, 0xab, 0x25, 0x06, 0x22, 0x01, 0x00, 0x2f, 0x20, 0x00,
+    0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf, 0x25, 0xab, 0x25, 0x06, 0x22,
+    0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf,
+    0x25, 0xab, 0x25, 0x06, 0x22, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06,
+    0x2f, 0x28, 0x06, 0x07, 0xaf, 0x25, 0xab, 0x25, 0x06, 0x22, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00,
+    0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07, 0xaf, 0x25, 0x00, 0x00, 0xaa, 0x25, 0x06,
+    0x22, 0x01, 0x00, 0x2f, 0x20, 0x00, 0x00, 0x96, 0x2f, 0x05, 0x12, 0x06, 0x2f, 0x28, 0x06, 0x07,
+    0xae, 0x25, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x25, 0x06, 0x22, 0x01, 0x00, 0x2f, 0x2e, 0x21, 0x1c,
+    0x96, 0x0f, 0x05, 0x20, 0x24, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x25, 0x00, 0x00, 0x00, 0x00, 0xaa,
+    0x25, 0x02, 0x22, 0x01, 0x00, 0x82, 0x2f, 0x00, 0x20, 0x96, 0x01, 0x05, 0x24, 0x2f, 0x2f, 0x28,
+    0x06, 0x07, 0xae, 0x25, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x25, 0x02, 0x22, 0x01, 0x00, 0x82, 0x2f,
+    0x00, 0x2e, 0x96, 0x24, 0x05, 0x2e, 0x2f, 0x2f, 0x28, 0x06, 0x07, 0xae, 0x25, 0x00, 0x00, 0x00,
+    0x00, 0xaa, 0x25, 0x02, 0x22, 0x01, 0x00, 0x8c, 0x2f, 0x00, 0x2e, 0x83, 0x28, 0x8b, 0x2f, 0x02,
+    0x28, 0x06, 0x07, 0xae, 0x25, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x25, 0x02, 0x22, 0x01, 0x00, 0x8c,
+    0x2f, 0x00, 0x1c, 0x82, 0x00, 0x01, 0x0b, 0x2e, 0x8a, 0x2f, 0x02, 0x28, 0x06, 0x07, 0xae, 0x25,
+    0x00, 0x00, 0x01, 0x00, 0x00, 0xa9, 0x25, 0x02, 0x22, 0x01, 0x00, 0x8c, 0x2f, 0x00, 0x1c, 0x82,
+    0x00, 0x01, 0x0b, 0x2e, 0x8a, 0x2f, 0x02, 0x28, 0x06, 0x07, 0xad, 0x25, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0xa9, 0x25, 0x02, 0x22, 0x01, 0x00, 0x8c, 0x2f, 0x00, 0x1c, 0x82, 0x00, 0x01, 0x0b,
+    0x2e, 0x8a, 0x2f, 0x02, 0x28, 0x06, 0x07, 0xad, 0x25, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa9,
+    0x25, 0x02, 0x22, 0x01, 0x00, 0x8c, 0x2f, 0x00, 0x1c, 0x82, 0x00, 0x01, 0x0b, 0x2e, 0x8a, 0x2f,
+    0x02, 0x28, 0x06, 0x07, 0xad, 0x25, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xaa, 0x25, 0x04, 0x1e,
+    0x1d, 0x08, 0x0f, 0x2e, 0x89, 0x2f, 0x00, 0x28, 0x83, 0x20, 0x89, 0x2f, 0x04, 0x2e, 0x08, 0x0a,
+    0x1e, 0x1e, 0xad, 0x25, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x25, 0x23, 0xa9, 0x25, 0x03, 0x1d,
+    0x05, 0x0c, 0x28, 0x98, 0x2e, 0x03, 0x28, 0x07, 0x0a, 0x22, 0xad, 0x25, 0x82, 0x00, 0x82, 0x00,
+    0xaa, 0x25, 0x02, 0x22, 0x1e, 0x1d, 0x99, 0x0d, 0x02, 0x0b, 0x1e, 0x1e, 0xae, 0x25, 0x82, 0x00,
+    0x82, 0x00, 0xac, 0x25, 0x00, 0x1d, 0x99, 0x00, 0x00, 0x03, 0xb0, 0x25, 0x82, 0x00, 0x83, 0x00,
+    0xab, 0x25, 0x00, 0x23, 0x93, 0x22, 0x01, 0x1e, 0x1e, 0x83, 0x22, 0x00, 0x1e, 0xaf, 0x25, 0x83,
+    0x00, 0x83, 0x00, 0xf7, 0x25, 0x83, 0x00, 0x83, 0x00, 0xf7, 0x25, 0x83, 0x00, 0x84, 0x00, 0xf5,
+    0x25, 0x84, 0x00, 0x84, 0x00, 0x00, 0x25, 0x98, 0x23, 0x00, 0x25, 0x9a, 0x23, 0x00, 0x25, 0x9a,
+    0x23, 0x00, 0x25, 0xa1, 0x23, 0x00, 0x25, 0x84, 0x00, 0x84, 0x00, 0xf4, 0x19, 0x85, 0x00, 0x85,
+    0x00, 0xf3, 0x1a, 0x85, 0x00, 0x85, 0x00, 0xf3, 0x1a, 0x85, 0x00, 0x86, 0x00, 0xf1, 0x1a, 0x86,
+    0x00, 0x86, 0x00, 0xf0, 0x1a, 0x87, 0x00, 0x87, 0x00, 0xef, 0x1a, 0x87, 0x00, 0x87, 0x00, 0xef,
+    0x1a, 0x87, 0x00, 0x88, 0x00, 0xed, 0x1a, 0x88, 0x00, 0x89, 0x00, 0xeb, 0x1a, 0x89, 0x00, 0x89,
+    0x00, 0xeb, 0x1a, 0x89, 0x00, 0x8a, 0x00, 0xe9, 0x1a, 0x8a, 0x00, 0x8b, 0x00, 0xe7, 0x1a, 0x8b,
+    0x00, 0x8b, 0x00, 0xe7, 0x1a, 0x8b, 0x00, 0x8c, 0x00, 0xe5, 0x1a, 0x8c, 0x00, 0x8d, 0x00, 0xe3,
+    0x1a, 0x8d, 0x00, 0x8e, 0x00, 0xe1, 0x1a, 0x8e, 0x00, 0x8e, 0x00, 0xe1, 0x1a, 0x8e, 0x00, 0x8f,
+    0x00, 0xdf, 0x1a, 0x8f, 0x00, 0x90, 0x00, 0xdd, 0x1a, 0x90, 0x00, 0x91, 0x00, 0xdb, 0x1a, 0x91,
+    0x00, 0x92, 0x00, 0xd9, 0x1a, 0x92, 0x00, 0x93, 0x00, 0xd7, 0x1a, 0x93, 0x00, 0x94, 0x00, 0xd5,
+    0x1a, 0x94, 0x00, 0x95, 0x00, 0xd3, 0x1a, 0x95, 0x00, 0x97, 0x00, 0xcf, 0x1a, 0x97, 0x00, 0x98,
+    0x00, 0x00, 0x18, 0xcb, 0x0e, 0x00, 0x18, 0x98, 0x00, 0x99, 0x00, 0xcb, 0x02, 0x99, 0x00, 0x9b,
+    0x00, 0xc7, 0x02, 0x9b, 0x00, 0x9c, 0x00, 0xc5, 0x02, 0x9c, 0x00, 0x9e, 0x00, 0xc1, 0x02, 0x9e,
+    0x00, 0x9f, 0x00, 0xbf, 0x02, 0x9f, 0x00, 0xa1, 0x00, 0xbb, 0x02, 0xa1, 0x00, 0xa3, 0x00, 0xb7,
+    0x02, 0xa3, 0x00, 0xa5, 0x00, 0xb3, 0x02, 0xa5, 0x00, 0xa7, 0x00, 0xae, 0x02, 0xa8, 0x00, 0xaa,
+    0x00, 0xa9, 0x02, 0xaa, 0x00, 0xad, 0x00, 0xa3, 0x02, 0xad, 0x00, 0xb2, 0x00, 0x99, 0x02, 0xb2,
+    0x00, 0xb8, 0x00, 0x8d, 0x02, 0xb8, 0x00,
+};
+
+// 39 colors, 2659 bytes (raw: 32768)
+static constexpr uint16_t face_pal_5[] = {
+    0x0000, 0x0020, 0x057c, 0x1061, 0x10a2, 0x18a2, 0x2965, 0x3145, 0x38e1, 0x4941, 0x4a29, 0x4c39,
+    0x528a, 0x6b6d, 0x71c3, 0x71ee, 0x738e, 0x762b, 0x7a42, 0x8e2a, 0x9363, 0x9a73, 0xa2b5, 0xaab4,
+    0xaab5, 0xb596, 0xb5b6, 0xd69a, 0xdedb, 0xe71c, 0xea89, 0xeac9, 0xeda5, 0xef5d, 0xfca4, 0xfcc4,
+    0xfe26, 0xffdf, 0xffff,
+};
+static constexpr uint16_t face_row_5[] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 74, 80, 86, 92,
+    98, 104, 110, 116, 122, 128, 134, 140, 146, 152, 158, 164, 170, 176, 182, 188,
+    202, 216, 234, 255, 275, 297, 323, 354, 384, 414, 444, 474, 504, 546, 594, 643,
+    693, 743, 793, 831, 868, 904, 942, 980, 1014, 1044, 1082, 1120, 1158, 1192, 1226, 1252,
+    1278, 1304, 1330, 1356, 1382, 1408, 1434, 1460, 1490, 1520, 1550, 1580, 1610, 1640, 1672, 1704,
+    1736, 1768, 1799, 1829, 1859, 1885, 1911, 1929, 1955, 1982, 2009, 2036, 2067, 2085, 2103, 2117,
+    2129, 2135, 2141, 2147, 2153, 2159, 2165, 2171, 2177, 2183, 2189, 2195, 2201, 2207, 2213, 2219,
+    2225, 2231, 2237, 2247, 2253, 2259, 2265, 2271, 2277, 2283, 2289, 2295, 2301, 2307, 2313, 2319,
+};
+static constexpr uint8_t face_code_5[] = {
+    0xb5, 0x00, 0x93, 0x11, 0xb5, 0x00, 0xb0, 0x00, 0x9d, 0x11, 0xb0, 0x00, 0xac, 0x00, 0xa5, 0x11,
+    0xac, 0x00, 0xa9, 0x00, 0xab, 0x11, 0xa9, 0x00, 0xa6, 0x00, 0xb1, 0x11, 0xa6, 0x00, 0xa4, 0x00,
+    0xb5, 0x11, 0xa4, 0x00, 0xa2, 0x00, 0xb9, 0x11, 0xa2, 0x00, 0xa0, 0x00, 0xbd, 0x11, 0xa0, 0x00,
+    0x9f, 0x00, 0xbf, 0x11, 0x9f, 0x00, 0x9d, 0x00, 0xc3, 0x11, 0x9d, 0x00, 0x9b, 0x00, 0xc7, 0x11,
+    0x9b, 0x00, 0x9a, 0x00, 0x00, 0x13, 0xc8, 0x11, 0x9a, 0x00, 0x99, 0x00, 0xcb, 0x24, 0x99, 0x00,
+    0x97, 0x00, 0xcf, 0x24, 0x97, 0x00, 0x96, 0x00, 0xd1, 0x24, 0x96, 0x00, 0x95, 0x00, 0xd3, 0x24,
+    0x95, 0x00, 0x94, 0x00, 0xd5, 0x24, 0x94, 0x00, 0x93, 0x00, 0xd7, 0x24, 0x93, 0x00, 0x92, 0x00,
+    0xd9, 0x24, 0x92, 0x00, 0x91, 0x00, 0xdb, 0x24, 0x91, 0x00, 0x90, 0x00, 0xdd, 0x24, 0x90, 0x00,
+    0x8f, 0x00, 0xdf, 0x24, 0x8f, 0x00, 0x8e, 0x00, 0xe1, 0x24, 0x8e, 0x00, 0x8d, 0x00, 0xe3, 0x24,
+    0x8d, 0x00, 0x8c, 0x00, 0xe4, 0x24, 0x8d, 0x00, 0x8c, 0x00, 0xe5, 0x24, 0x8c, 0x00, 0x8b, 0x00,
+    0xe7, 0x24, 0x8b, 0x00, 0x8a, 0x00, 0xe9, 0x24, 0x8a, 0x00, 0x8a, 0x00, 0xe9, 0x24, 0x8a, 0x00,
+    0x89, 0x00, 0xeb, 0x24, 0x89, 0x00, 0x88, 0x00, 0xed, 0x24, 0x88, 0x00, 0x88, 0x00, 0xa0, 0x24,
+    0x00, 0x14, 0xa8, 0x09, 0x00, 0x14, 0xa1, 0x24, 0x88, 0x00, 0x87, 0x00, 0xa1, 0x24, 0x00, 0x14,
+    0xa8, 0x06, 0x00, 0x12, 0xa2, 0x24, 0x87, 0x00, 0x87, 0x00, 0x9f, 0x24, 0x02, 0x09, 0x05, 0x1a,
+    0xa8, 0x21, 0x02, 0x1b, 0x05, 0x14, 0xa0, 0x24, 0x87, 0x00, 0x86, 0x00, 0x9f, 0x24, 0x03, 0x20,
+    0x06, 0x04, 0x1b, 0xa8, 0x26, 0x04, 0x1c, 0x04, 0x14, 0x20, 0x20, 0x9f, 0x24, 0x86, 0x00, 0x86,
+    0x00, 0x9e, 0x24, 0x03, 0x14, 0x08, 0x1c, 0x25, 0xaa, 0x26, 0x03, 0x25, 0x1b, 0x08, 0x14, 0x9f,
+    0x24, 0x86, 0x00, 0x85, 0x00, 0x9f, 0x24, 0x02, 0x14, 0x00, 0x1d, 0x84, 0x26, 0xa2, 0x25, 0x84,
+    0x26, 0x02, 0x1b, 0x00, 0x14, 0xa0, 0x24, 0x85, 0x00, 0x85, 0x00, 0x9f, 0x24, 0x02, 0x14, 0x00,
+    0x1d, 0x84, 0x26, 0x00, 0x10, 0xa0, 0x05, 0x00, 0x0d, 0x84, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa0,
+    0x24, 0x85, 0x00, 0x84, 0x00, 0xa0, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x25, 0x21,
+    0x10, 0xa0, 0x05, 0x02, 0x0d, 0x21, 0x25, 0x82, 0x26, 0x03, 0x1b, 0x00, 0x12, 0x23, 0xa0, 0x22,
+    0x84, 0x00, 0x84, 0x00, 0xa0, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x06, 0x1b,
+    0xa0, 0x25, 0x02, 0x1b, 0x06, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa1, 0x22, 0x84, 0x00,
+    0x83, 0x00, 0xa1, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26,
+    0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa2, 0x22, 0x83, 0x00, 0x83, 0x00,
+    0xa1, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c,
+    0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa2, 0x22, 0x83, 0x00, 0x83, 0x00, 0xa1, 0x22,
+    0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19,
+    0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa2, 0x22, 0x83, 0x00, 0x82, 0x00, 0xa2, 0x22, 0x02, 0x14,
+    0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x12, 0xa3, 0x22, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x22, 0x02, 0x14, 0x00, 0x1d,
+    0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x87, 0x26, 0x00, 0x25, 0x86, 0x26, 0x00, 0x25, 0x84, 0x26,
+    0x00, 0x25, 0x89, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa3, 0x22,
+    0x82, 0x00, 0x82, 0x00, 0xa2, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b,
+    0x86, 0x26, 0x02, 0x19, 0x0c, 0x1b, 0x84, 0x26, 0x02, 0x1b, 0x0c, 0x1a, 0x82, 0x26, 0x02, 0x1c,
+    0x0c, 0x1a, 0x88, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa3, 0x22,
+    0x82, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00,
+    0x1b, 0x86, 0x26, 0x02, 0x00, 0x00, 0x1a, 0x84, 0x26, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x26, 0x02,
+    0x1b, 0x00, 0x1a, 0x88, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa3,
+    0x22, 0x82, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00,
+    0x00, 0x1b, 0x86, 0x26, 0x02, 0x00, 0x00, 0x1a, 0x84, 0x26, 0x02, 0x1a, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x1a, 0x88, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12,
+    0xa4, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26,
+    0x02, 0x00, 0x00, 0x1b, 0x86, 0x26, 0x02, 0x00, 0x05, 0x1a, 0x84, 0x26, 0x02, 0x1a, 0x00, 0x19,
+    0x82, 0x26, 0x02, 0x1b, 0x05, 0x1a, 0x88, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b,
+    0x00, 0x12, 0xa4, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x14, 0x00, 0x1d,
+    0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x86, 0x26, 0x02, 0x21, 0x21, 0x25, 0x84, 0x26, 0x02, 0x1a,
+    0x00, 0x19, 0x82, 0x26, 0x02, 0x25, 0x21, 0x25, 0x88, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x12, 0xa4, 0x22, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x22, 0x02, 0x14,
+    0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x8e, 0x26, 0x02, 0x1a, 0x00, 0x19, 0x8e, 0x26,
+    0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa4, 0x22, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xa4, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x8e, 0x26, 0x02,
+    0x1a, 0x00, 0x19, 0x8e, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x03, 0x1b, 0x00, 0x12, 0x23,
+    0xa4, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00,
+    0x00, 0x1b, 0x8e, 0x26, 0x02, 0x1a, 0x00, 0x19, 0x8e, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x12, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x14, 0x00, 0x1d,
+    0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x8c, 0x26, 0x04, 0x1b, 0x00, 0x0c, 0x00, 0x19, 0x8e, 0x26,
+    0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0xa4, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x8c, 0x26, 0x00, 0x1a,
+    0x82, 0x04, 0x00, 0x19, 0x8e, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12,
+    0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00,
+    0x00, 0x1b, 0x8c, 0x26, 0x84, 0x25, 0x8e, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b,
+    0x00, 0x12, 0xa5, 0x22, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26,
+    0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12,
+    0xa5, 0x22, 0x00, 0x00, 0xa5, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b,
+    0x88, 0x26, 0x02, 0x1a, 0x10, 0x1b, 0x86, 0x26, 0x02, 0x1b, 0x10, 0x19, 0x8a, 0x26, 0x02, 0x1c,
+    0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x14, 0x00, 0x1d,
+    0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x88, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x86, 0x26, 0x02, 0x1a,
+    0x00, 0x10, 0x8a, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa6, 0x22,
+    0xa5, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0x88, 0x26, 0x02, 0x21,
+    0x1c, 0x00, 0x86, 0x0d, 0x02, 0x19, 0x1c, 0x1d, 0x8a, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x12, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00,
+    0x00, 0x1b, 0x8a, 0x26, 0x00, 0x00, 0x86, 0x01, 0x00, 0x19, 0x8c, 0x26, 0x02, 0x1c, 0x00, 0x19,
+    0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x14, 0x00, 0x1d, 0x82, 0x26,
+    0x02, 0x00, 0x00, 0x1b, 0x8a, 0x26, 0x00, 0x21, 0x86, 0x1d, 0x00, 0x21, 0x8c, 0x26, 0x02, 0x1c,
+    0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x12, 0xa6, 0x22, 0xa5, 0x22, 0x02, 0x14, 0x00, 0x1d,
+    0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b,
+    0x00, 0x12, 0xa6, 0x22, 0xa5, 0x1f, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b,
+    0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa6, 0x1f, 0xa5, 0x1e,
+    0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19,
+    0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26,
+    0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e,
+    0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26,
+    0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x12,
+    0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x0e, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00,
+    0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa6, 0x1e,
+    0xa5, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c,
+    0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa6, 0x1e, 0xa5, 0x1e, 0x02, 0x12, 0x00, 0x1d,
+    0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b,
+    0x00, 0x0e, 0xa6, 0x1e, 0x00, 0x00, 0xa4, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00,
+    0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa5, 0x1e,
+    0x00, 0x00, 0x00, 0x00, 0xa4, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b,
+    0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa5, 0x1e, 0x00, 0x00,
+    0x00, 0x00, 0xa4, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26,
+    0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00,
+    0xa4, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c,
+    0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x1e,
+    0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19,
+    0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa5, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x1e, 0x02, 0x12,
+    0x00, 0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26,
+    0x02, 0x1b, 0x00, 0x0e, 0xa5, 0x1e, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x12, 0x00,
+    0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02,
+    0x1b, 0x00, 0x0e, 0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x12, 0x00,
+    0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02,
+    0x1b, 0x00, 0x0e, 0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x12, 0x00,
+    0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02,
+    0x1b, 0x00, 0x0e, 0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x12, 0x00,
+    0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02,
+    0x1b, 0x00, 0x0e, 0xa4, 0x1e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0xa3, 0x1e, 0x02, 0x12, 0x00,
+    0x1d, 0x82, 0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02,
+    0x1b, 0x00, 0x0e, 0xa3, 0x1e, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82,
+    0x26, 0x02, 0x00, 0x00, 0x1b, 0xa0, 0x26, 0x02, 0x1c, 0x00, 0x19, 0x82, 0x26, 0x02, 0x1b, 0x00,
+    0x0e, 0xa3, 0x1e, 0x82, 0x00, 0x82, 0x00, 0xa2, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x82, 0x26, 0x02,
+    0x21, 0x1d, 0x10, 0xa0, 0x0c, 0x02, 0x10, 0x1d, 0x21, 0x82, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa3,
+    0x1e, 0x82, 0x00, 0x83, 0x00, 0xa1, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x84, 0x26, 0x00, 0x10, 0xa0,
+    0x03, 0x00, 0x0d, 0x84, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa2, 0x1e, 0x83, 0x00, 0x83, 0x00, 0xa1,
+    0x1e, 0x02, 0x12, 0x00, 0x1d, 0x84, 0x26, 0x00, 0x21, 0xa0, 0x1d, 0x00, 0x21, 0x84, 0x26, 0x02,
+    0x1b, 0x00, 0x0e, 0xa2, 0x1e, 0x83, 0x00, 0x83, 0x00, 0xa1, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0xac,
+    0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa2, 0x1e, 0x83, 0x00, 0x84, 0x00, 0xa0, 0x1e, 0x02, 0x12, 0x00,
+    0x1d, 0x92, 0x26, 0x00, 0x1b, 0x83, 0x00, 0x00, 0x25, 0x93, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa1,
+    0x1e, 0x84, 0x00, 0x84, 0x00, 0xa0, 0x1e, 0x02, 0x12, 0x00, 0x1d, 0x92, 0x26, 0x00, 0x1a, 0x82,
+    0x00, 0x01, 0x0a, 0x25, 0x93, 0x26, 0x02, 0x1b, 0x00, 0x0e, 0xa1, 0x1e, 0x84, 0x00, 0x84, 0x00,
+    0xa0, 0x17, 0x02, 0x0a, 0x00, 0x1d, 0x92, 0x26, 0x00, 0x1a, 0x82, 0x00, 0x01, 0x0a, 0x25, 0x93,
+    0x26, 0x02, 0x1b, 0x00, 0x0a, 0xa0, 0x17, 0x85, 0x00, 0x85, 0x00, 0x9f, 0x18, 0x02, 0x0a, 0x00,
+    0x1d, 0x92, 0x26, 0x00, 0x1a, 0x82, 0x00, 0x01, 0x0a, 0x25, 0x93, 0x26, 0x02, 0x1b, 0x00, 0x0a,
+    0xa0, 0x18, 0x85, 0x00, 0x85, 0x00, 0x9f, 0x18, 0x04, 0x15, 0x0f, 0x00, 0x19, 0x1d, 0x90, 0x26,
+    0x00, 0x1b, 0x82, 0x10, 0x01, 0x00, 0x25, 0x91, 0x26, 0x04, 0x21, 0x19, 0x00, 0x0f, 0x0f, 0xa0,
+    0x18, 0x85, 0x00, 0x86, 0x00, 0xa0, 0x18, 0x02, 0x07, 0x00, 0x1b, 0xa8, 0x26, 0x02, 0x1b, 0x00,
+    0x0a, 0xa1, 0x18, 0x86, 0x00, 0x86, 0x00, 0xa0, 0x18, 0x02, 0x0f, 0x0f, 0x00, 0xa8, 0x19, 0x02,
+    0x00, 0x0f, 0x0f, 0xa0, 0x18, 0x87, 0x00, 0x87, 0x00, 0xa1, 0x18, 0x00, 0x0a, 0xa8, 0x00, 0x00,
+    0x0a, 0xa2, 0x18, 0x87, 0x00, 0x87, 0x00, 0xa1, 0x18, 0x00, 0x15, 0xa9, 0x0f, 0xa2, 0x18, 0x87,
+    0x00, 0x88, 0x00, 0xed, 0x18, 0x88, 0x00, 0x89, 0x00, 0xeb, 0x18, 0x89, 0x00, 0x89, 0x00, 0xeb,
+    0x18, 0x89, 0x00, 0x8a, 0x00, 0xe9, 0x18, 0x8a, 0x00, 0x8b, 0x00, 0xe7, 0x18, 0x8b, 0x00, 0x8b,
+    0x00, 0xe7, 0x18, 0x8b, 0x00, 0x8c, 0x00, 0xe5, 0x18, 0x8c, 0x00, 0x8d, 0x00, 0xe3, 0x18, 0x8d,
+    0x00, 0x8e, 0x00, 0xe1, 0x18, 0x8e, 0x00, 0x8e, 0x00, 0xe1, 0x18, 0x8e, 0x00, 0x8f, 0x00, 0xdf,
+    0x18, 0x8f, 0x00, 0x90, 0x00, 0xdd, 0x18, 0x90, 0x00, 0x91, 0x00, 0xdb, 0x18, 0x91, 0x00, 0x92,
+    0x00, 0xd9, 0x18, 0x92, 0x00, 0x93, 0x00, 0xd7, 0x18, 0x93, 0x00, 0x94, 0x00, 0xd5, 0x18, 0x94,
+    0x00, 0x95, 0x00, 0xd3, 0x18, 0x95, 0x00, 0x97, 0x00, 0xcf, 0x18, 0x97, 0x00, 0x98, 0x00, 0x00,
+    0x16, 0xcb, 0x0b, 0x00, 0x16, 0x98, 0x00, 0x99, 0x00, 0xcb, 0x02, 0x99, 0x00, 0x9b, 0x00, 0xc7,
+    0x02, 0x9b, 0x00, 0x9c, 0x00, 0xc5, 0x02, 0x9c, 0x00, 0x9e, 0x00, 0xc1, 0x02, 0x9e, 0x00, 0x9f,
+    0x00, 0xbf, 0x02, 0x9f, 0x00, 0xa1, 0x00, 0xbb, 0x02, 0xa1, 0x00, 0xa3, 0x00, 0xb7, 0x02, 0xa3,
+    0x00, 0xa5, 0x00, 0xb3, 0x02, 0xa5, 0x00, 0xa7, 0x00, 0xae, 0x02, 0xa8, 0x00, 0xaa, 0x00, 0xa9,
+    0x02, 0xaa, 0x00, 0xad, 0x00, 0xa3, 0x02, 0xad, 0x00, 0xb2, 0x00, 0x99, 0x02, 0xb2, 0x00, 0xb8,
+    0x00, 0x8d, 0x02, 0xb8, 0x00,
+};
+
+// 6 frames, 15008 bytes (raw: 196608)
+static constexpr Driver::Device::Rle565_t face_rle[] = {
+    {128, 128, face_pal_0, face_row_0, face_code_0},
+    {128, 128, face_pal_1, face_row_1, face_code_1},
+    {128, 128, face_pal_2, face_row_2, face_code_2},
+    {128, 128, face_pal_3, face_row_3, face_code_3},
+    {128, 128, face_pal_4, face_row_4, face_code_4},
+    {128, 128, face_pal_5, face_row_5, face_code_5},
+};
+
+#endif
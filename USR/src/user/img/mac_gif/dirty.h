@@ -0,0 +1,32 @@
+#ifndef _MAC_GIF_DIRTY_
+#define _MAC_GIF_DIRTY_
+
+// Generated by tools/gif_dirty.py, do not edit
+// Dirty rectangles {x0, y0, x1, y1} of each frame against the previous one
+
+#include <stdint.h>
+
+// 53 rects, ~10579 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_0[][4] = {{102, 9, 102, 9}, {57, 10, 57, 10}, {82, 11, 82, 11}, {63, 13, 63, 13}, {88, 14, 88, 14}, {45, 15, 45, 15}, {28, 17, 28, 17}, {41, 18, 41, 18}, {69, 19, 76, 21}, {111, 21, 111, 21}, {98, 23, 98, 23}, {64, 22, 78, 24}, {62, 25, 86, 25}, {34, 26, 34, 26}, {54, 26, 77, 29}, {46, 30, 77, 33}, {40, 34, 77, 36}, {33, 37, 78, 40}, {26, 41, 78, 49}, {27, 50, 80, 50}, {27, 51, 92, 53}, {21, 54, 92, 56}, {22, 57, 97, 62}, {21, 63, 103, 68}, {21, 69, 106, 75}, {24, 76, 111, 82}, {29, 83, 107, 86}, {28, 87, 98, 90}, {25, 91, 91, 91}, {33, 92, 89, 92}, {22, 93, 22, 94}, {38, 93, 86, 94}, {42, 95, 82, 97}, {22, 100, 22, 100}, {47, 98, 78, 100}, {90, 100, 90, 100}, {52, 101, 72, 102}, {103, 102, 103, 102}, {56, 103, 68, 104}, {110, 105, 110, 105}, {60, 105, 69, 106}, {105, 107, 105, 107}, {31, 108, 31, 108}, {101, 108, 101, 109}, {22, 110, 22, 110}, {36, 110, 36, 110}, {98, 111, 98, 111}, {96, 113, 96, 113}, {101, 114, 101, 114}, {95, 115, 95, 115}, {44, 116, 44, 116}, {95, 117, 95, 117}, {71, 118, 71, 118}};
+// 40 rects, ~11676 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_1[][4] = {{111, 21, 111, 21}, {78, 22, 78, 22}, {55, 21, 66, 23}, {98, 23, 98, 23}, {86, 25, 86, 25}, {34, 26, 34, 26}, {52, 24, 72, 26}, {49, 27, 78, 29}, {46, 30, 82, 31}, {38, 32, 85, 33}, {30, 34, 88, 42}, {28, 43, 88, 50}, {28, 51, 92, 53}, {21, 54, 92, 54}, {28, 55, 93, 57}, {22, 58, 97, 62}, {21, 63, 103, 68}, {21, 69, 106, 78}, {28, 79, 107, 83}, {28, 84, 111, 90}, {25, 91, 25, 91}, {33, 91, 109, 92}, {22, 93, 22, 94}, {42, 93, 105, 94}, {46, 95, 101, 97}, {22, 100, 22, 100}, {51, 98, 96, 100}, {103, 102, 103, 102}, {55, 101, 91, 105}, {110, 105, 110, 105}, {105, 107, 105, 107}, {31, 108, 31, 108}, {55, 106, 83, 108}, {101, 108, 101, 109}, {36, 110, 36, 110}, {59, 109, 78, 111}, {98, 111, 98, 111}, {96, 113, 96, 113}, {64, 112, 73, 114}, {101, 114, 101, 114}};
+// 26 rects, ~12474 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_2[][4] = {{62, 12, 73, 14}, {88, 14, 88, 14}, {45, 15, 45, 15}, {28, 17, 28, 17}, {57, 15, 79, 17}, {41, 18, 41, 18}, {50, 18, 83, 21}, {43, 22, 83, 25}, {36, 26, 83, 29}, {30, 30, 85, 33}, {26, 34, 88, 42}, {24, 43, 88, 53}, {23, 54, 88, 72}, {24, 73, 92, 76}, {23, 77, 97, 79}, {23, 80, 107, 83}, {23, 84, 111, 93}, {26, 94, 105, 96}, {32, 97, 100, 98}, {36, 99, 96, 101}, {42, 102, 91, 104}, {48, 105, 86, 106}, {52, 107, 82, 109}, {58, 110, 77, 111}, {63, 112, 74, 113}, {67, 114, 70, 114}};
+// 32 rects, ~13050 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_3[][4] = {{64, 12, 71, 13}, {60, 14, 75, 15}, {57, 16, 79, 17}, {50, 18, 83, 21}, {43, 22, 83, 25}, {36, 26, 83, 29}, {28, 30, 86, 37}, {25, 38, 87, 44}, {20, 45, 88, 52}, {20, 53, 89, 71}, {25, 72, 92, 73}, {103, 73, 110, 73}, {20, 74, 112, 81}, {23, 82, 108, 87}, {23, 88, 111, 93}, {26, 94, 105, 96}, {32, 97, 100, 98}, {36, 99, 96, 101}, {42, 102, 91, 104}, {45, 105, 86, 106}, {41, 107, 41, 108}, {52, 107, 82, 108}, {47, 109, 79, 109}, {22, 110, 22, 110}, {92, 110, 92, 110}, {58, 110, 77, 111}, {47, 112, 47, 112}, {26, 113, 26, 113}, {63, 112, 74, 113}, {100, 113, 100, 113}, {67, 114, 70, 114}, {81, 114, 81, 114}};
+// 23 rects, ~10179 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_4[][4] = {{62, 27, 75, 27}, {53, 28, 82, 29}, {43, 30, 85, 32}, {35, 33, 86, 36}, {25, 37, 87, 44}, {20, 45, 88, 52}, {20, 53, 89, 71}, {25, 72, 92, 73}, {103, 73, 110, 73}, {20, 74, 111, 74}, {22, 81, 22, 81}, {27, 75, 112, 81}, {33, 82, 106, 86}, {39, 87, 111, 88}, {42, 89, 105, 91}, {47, 92, 101, 94}, {53, 95, 94, 97}, {58, 98, 90, 100}, {51, 101, 85, 103}, {45, 104, 48, 106}, {63, 104, 78, 106}, {41, 107, 41, 108}, {68, 107, 75, 108}};
+// 14 rects, ~8744 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_5[][4] = {{41, 22, 52, 23}, {37, 24, 58, 27}, {36, 28, 64, 31}, {35, 32, 72, 35}, {35, 36, 80, 39}, {35, 40, 86, 42}, {35, 43, 94, 46}, {35, 47, 96, 85}, {42, 86, 96, 93}, {51, 94, 96, 97}, {59, 98, 96, 100}, {68, 101, 95, 104}, {74, 105, 90, 106}, {80, 107, 84, 107}};
+// 31 rects, ~11249 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_6[][4] = {{69, 12, 79, 15}, {63, 16, 80, 18}, {61, 19, 67, 19}, {78, 19, 80, 19}, {56, 20, 80, 21}, {36, 22, 81, 29}, {33, 30, 83, 41}, {34, 42, 94, 46}, {34, 47, 96, 77}, {35, 78, 98, 79}, {35, 80, 102, 89}, {36, 90, 41, 90}, {51, 90, 102, 90}, {33, 91, 102, 93}, {38, 94, 99, 94}, {38, 95, 45, 95}, {56, 95, 98, 95}, {40, 96, 96, 99}, {48, 100, 95, 102}, {43, 103, 93, 106}, {43, 107, 84, 107}, {43, 108, 73, 108}, {44, 109, 80, 109}, {92, 110, 92, 110}, {46, 110, 70, 112}, {100, 113, 100, 113}, {81, 114, 81, 114}, {51, 113, 63, 115}, {95, 115, 95, 115}, {44, 116, 44, 116}, {56, 116, 57, 116}};
+// 27 rects, ~12465 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_7[][4] = {{102, 9, 102, 9}, {57, 10, 57, 10}, {79, 8, 89, 11}, {69, 12, 89, 15}, {61, 16, 89, 19}, {52, 20, 89, 23}, {44, 24, 89, 27}, {35, 28, 89, 32}, {25, 33, 89, 46}, {24, 47, 89, 68}, {24, 69, 80, 72}, {24, 73, 71, 75}, {24, 76, 75, 76}, {24, 77, 106, 93}, {27, 94, 27, 94}, {38, 94, 101, 97}, {44, 98, 93, 100}, {46, 101, 95, 101}, {40, 102, 85, 104}, {38, 105, 80, 109}, {41, 110, 70, 111}, {26, 113, 26, 113}, {44, 112, 65, 114}, {48, 115, 59, 117}, {95, 117, 95, 117}, {53, 118, 53, 118}, {71, 118, 71, 118}};
+// 22 rects, ~12836 bytes (full frame: 32768)
+static constexpr uint8_t mac_dirty_8[][4] = {{79, 8, 89, 11}, {71, 12, 89, 15}, {62, 16, 89, 19}, {54, 20, 89, 23}, {48, 24, 89, 26}, {39, 27, 89, 30}, {33, 31, 89, 33}, {25, 34, 89, 46}, {24, 47, 89, 65}, {24, 66, 95, 69}, {24, 70, 102, 73}, {24, 74, 111, 86}, {24, 87, 105, 93}, {27, 94, 27, 94}, {40, 94, 101, 97}, {44, 98, 93, 100}, {42, 101, 86, 103}, {38, 104, 82, 107}, {38, 108, 73, 110}, {42, 111, 67, 113}, {47, 114, 61, 116}, {51, 117, 55, 118}};
+
+static constexpr const uint8_t (*mac_dirty[])[4] = {mac_dirty_0, mac_dirty_1, mac_dirty_2, mac_dirty_3, mac_dirty_4, mac_dirty_5, mac_dirty_6, mac_dirty_7, mac_dirty_8};
+
+static constexpr uint16_t mac_dirty_cnt[] = {sizeof(mac_dirty_0) / 4, sizeof(mac_dirty_1) / 4, sizeof(mac_dirty_2) / 4, sizeof(mac_dirty_3) / 4, sizeof(mac_dirty_4) / 4, sizeof(mac_dirty_5) / 4, sizeof(mac_dirty_6) / 4, sizeof(mac_dirty_7) / 4, sizeof(mac_dirty_8) / 4};
+
+#endif
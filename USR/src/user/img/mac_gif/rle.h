@@ -0,0 +1,2547 @@
+#ifndef _MAC_GIF_RLE_
+#define _MAC_GIF_RLE_
+
+// Generated by tools/gif_rle.py, do not edit
+
+#include "../../../drivers/device/rle565.hpp"
+
+// 87 colors, 3704 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_0[] = {
+    0x18a0, 0x2921, 0x2943, 0x39a4, 0x4226, 0x4962, 0x5247, 0x5288, 0x52cb, 0x59e2, 0x6280, 0x62c8,
+    0x62ec, 0x630b, 0x6b07, 0x6b8e, 0x7244, 0x7300, 0x7349, 0x7432, 0x8185, 0x8389, 0x83ce, 0x84f4,
+    0x8ac6, 0x8acc, 0x8c4f, 0x8c92, 0x9449, 0x9556, 0x9b06, 0x9cf3, 0xa4cf, 0xa4d1, 0xa4d4, 0xa557,
+    0xab47, 0xad0c, 0xad32, 0xad55, 0xadb7, 0xadd9, 0xb3a8, 0xb531, 0xb532, 0xb533, 0xb574, 0xb5b6,
+    0xb5f9, 0xb639, 0xbb02, 0xbb8c, 0xbc29, 0xbd6c, 0xbd72, 0xbd74, 0xbdf7, 0xbe7a, 0xc513, 0xc5f7,
+    0xc638, 0xc67a, 0xcbc8, 0xcc49, 0xcdae, 0xcdd4, 0xcebb, 0xcefb, 0xd44e, 0xd679, 0xd6b9, 0xd6ba,
+    0xd6fc, 0xde2f, 0xdefa, 0xdefb, 0xdf3d, 0xe4eb, 0xe650, 0xe73c, 0xebe8, 0xef3c, 0xef7c, 0xef7d,
+    0xf7be, 0xfef2, 0xffff,
+};
+static constexpr uint16_t mac_row_0[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 74, 80, 90,
+    96, 98, 104, 114, 124, 126, 132, 138, 144, 146, 152, 162, 168, 170, 176, 185,
+    199, 211, 229, 249, 270, 290, 315, 342, 370, 396, 428, 462, 499, 539, 581, 628,
+    670, 708, 749, 789, 836, 880, 923, 963, 995, 1028, 1062, 1104, 1150, 1191, 1232, 1276,
+    1325, 1375, 1428, 1485, 1543, 1598, 1660, 1720, 1781, 1856, 1926, 2003, 2078, 2153, 2221, 2291,
+    2353, 2419, 2476, 2531, 2579, 2629, 2679, 2727, 2772, 2813, 2853, 2891, 2923, 2956, 2983, 3010,
+    3034, 3051, 3069, 3084, 3090, 3100, 3110, 3120, 3126, 3128, 3134, 3140, 3146, 3156, 3162, 3168,
+    3174, 3176, 3182, 3192, 3198, 3208, 3214, 3220, 3226, 3228, 3234, 3240, 3246, 3252, 3258, 3268,
+};
+static constexpr uint8_t mac_code_0[] = {
+    0xff, 0x56, 0xd8, 0x56, 0x00, 0x54, 0xa5, 0x56, 0x86, 0x56, 0x00, 0x54, 0xc9, 0x56, 0x00, 0x54,
+    0xac, 0x56, 0xbf, 0x56, 0x00, 0x54, 0xbe, 0x56, 0xff, 0x56, 0xa7, 0x56, 0x00, 0x54, 0xd6, 0x56,
+    0x9d, 0x56, 0x00, 0x54, 0xcb, 0x56, 0x00, 0x54, 0x93, 0x56, 0x90, 0x56, 0x00, 0x54, 0xe8, 0x56,
+    0x00, 0x54, 0x83, 0x56, 0xff, 0x56, 0xe5, 0x56, 0x00, 0x54, 0x98, 0x56, 0xb8, 0x56, 0x00, 0x54,
+    0xc5, 0x56, 0xd1, 0x56, 0x00, 0x54, 0xac, 0x56, 0xff, 0x56, 0xbe, 0x56, 0x00, 0x54, 0xbf, 0x56,
+    0x87, 0x56, 0x00, 0x54, 0xce, 0x56, 0x00, 0x54, 0xa6, 0x56, 0xac, 0x56, 0x00, 0x54, 0xd1, 0x56,
+    0xff, 0x56, 0x9b, 0x56, 0x00, 0x54, 0xe2, 0x56, 0xa8, 0x56, 0x00, 0x54, 0xd0, 0x56, 0x00, 0x54,
+    0x83, 0x56, 0x8b, 0x56, 0x00, 0x54, 0xef, 0x56, 0x02, 0x54, 0x56, 0x56, 0xff, 0x56, 0xee, 0x56,
+    0x00, 0x54, 0x8f, 0x56, 0xcd, 0x56, 0x00, 0x54, 0xb0, 0x56, 0xe1, 0x56, 0x00, 0x54, 0x9c, 0x56,
+    0xff, 0x56, 0xd5, 0x56, 0x00, 0x54, 0xa8, 0x56, 0xa1, 0x56, 0x00, 0x54, 0xd3, 0x56, 0x00, 0x54,
+    0x87, 0x56, 0xca, 0x56, 0x00, 0x54, 0xb3, 0x56, 0xff, 0x56, 0xbf, 0x56, 0x00, 0x4f, 0xbe, 0x56,
+    0xbd, 0x56, 0x03, 0x52, 0x1b, 0x10, 0x1b, 0xbd, 0x56, 0x86, 0x56, 0x00, 0x54, 0xb4, 0x56, 0x04,
+    0x2e, 0x05, 0x1e, 0x3e, 0x1b, 0xbd, 0x56, 0xba, 0x56, 0x02, 0x3c, 0x0b, 0x18, 0x82, 0x3e, 0x00,
+    0x21, 0xbd, 0x56, 0x02, 0x56, 0x56, 0x54, 0xb5, 0x56, 0x08, 0x47, 0x0f, 0x10, 0x3e, 0x3e, 0x2a,
+    0x18, 0x05, 0x1b, 0xbd, 0x56, 0x83, 0x56, 0x00, 0x54, 0xb1, 0x56, 0x0a, 0x4f, 0x1b, 0x10, 0x2a,
+    0x3e, 0x3f, 0x24, 0x05, 0x05, 0x09, 0x1b, 0xbd, 0x56, 0x02, 0x56, 0x56, 0x54, 0xb2, 0x56, 0x0b,
+    0x27, 0x09, 0x24, 0x3f, 0x3f, 0x3e, 0x3e, 0x09, 0x06, 0x05, 0x05, 0x1b, 0xbd, 0x56, 0xb2, 0x56,
+    0x06, 0x54, 0x38, 0x0b, 0x18, 0x3e, 0x3e, 0x2a, 0x82, 0x3e, 0x04, 0x05, 0x05, 0x09, 0x09, 0x1b,
+    0xbd, 0x56, 0x86, 0x56, 0x00, 0x54, 0xa9, 0x56, 0x0f, 0x45, 0x0c, 0x18, 0x32, 0x3e, 0x3e, 0x05,
+    0x10, 0x3e, 0x3e, 0x2a, 0x05, 0x05, 0x09, 0x09, 0x1b, 0xbd, 0x56, 0x84, 0x56, 0x00, 0x54, 0xa9,
+    0x56, 0x11, 0x4b, 0x1a, 0x10, 0x3e, 0x3e, 0x2a, 0x3e, 0x3f, 0x10, 0x3e, 0x3e, 0x2a, 0x3e, 0x05,
+    0x05, 0x09, 0x09, 0x1b, 0xbd, 0x56, 0x87, 0x56, 0x00, 0x54, 0xa5, 0x56, 0x02, 0x1f, 0x09, 0x2a,
+    0x82, 0x3e, 0x0c, 0x10, 0x3e, 0x3e, 0x10, 0x18, 0x3e, 0x2b, 0x26, 0x05, 0x05, 0x09, 0x09, 0x1b,
+    0xbd, 0x56, 0xac, 0x56, 0x14, 0x2f, 0x06, 0x1e, 0x3e, 0x3e, 0x2a, 0x16, 0x18, 0x10, 0x3e, 0x3e,
+    0x09, 0x2a, 0x3e, 0x42, 0x2e, 0x05, 0x05, 0x0a, 0x05, 0x1b, 0xbd, 0x56, 0x02, 0x56, 0x56, 0x54,
+    0xa7, 0x56, 0x04, 0x3c, 0x0b, 0x18, 0x3e, 0x3e, 0x82, 0x18, 0x0e, 0x3c, 0x18, 0x10, 0x3e, 0x3e,
+    0x10, 0x32, 0x3e, 0x48, 0x33, 0x05, 0x05, 0x09, 0x09, 0x1b, 0xbd, 0x56, 0x02, 0x56, 0x56, 0x54,
+    0xa5, 0x56, 0x13, 0x4a, 0x16, 0x10, 0x3e, 0x3e, 0x2a, 0x3e, 0x45, 0x09, 0x18, 0x0f, 0x1e, 0x18,
+    0x3e, 0x3e, 0x18, 0x10, 0x24, 0x34, 0x3e, 0x82, 0x05, 0x01, 0x12, 0x21, 0xbd, 0x56, 0x82, 0x56,
+    0x00, 0x54, 0xa2, 0x56, 0x1b, 0x51, 0x1b, 0x10, 0x2a, 0x3e, 0x3e, 0x18, 0x3e, 0x2a, 0x2f, 0x10,
+    0x24, 0x1e, 0x3e, 0x18, 0x18, 0x1e, 0x1e, 0x24, 0x3e, 0x24, 0x3e, 0x05, 0x05, 0x24, 0x3f, 0x16,
+    0x4f, 0xbc, 0x56, 0x82, 0x56, 0x00, 0x54, 0xa1, 0x56, 0x02, 0x27, 0x09, 0x2a, 0x82, 0x3e, 0x0a,
+    0x2a, 0x09, 0x2a, 0x1e, 0x09, 0x2a, 0x1e, 0x32, 0x3e, 0x24, 0x1e, 0x82, 0x3e, 0x0a, 0x2a, 0x10,
+    0x2a, 0x3e, 0x3f, 0x24, 0x3f, 0x3f, 0x18, 0x22, 0x4f, 0xba, 0x56, 0x82, 0x56, 0x00, 0x54, 0x9f,
+    0x56, 0x02, 0x3b, 0x0b, 0x18, 0x84, 0x3e, 0x12, 0x24, 0x10, 0x24, 0x2a, 0x24, 0x3e, 0x24, 0x1e,
+    0x3e, 0x3e, 0x2a, 0x3e, 0x24, 0x18, 0x24, 0x10, 0x32, 0x3e, 0x2a, 0x82, 0x4d, 0x04, 0x3a, 0x37,
+    0x1e, 0x22, 0x4f, 0xb8, 0x56, 0x82, 0x56, 0x00, 0x54, 0x9d, 0x56, 0x05, 0x47, 0x0f, 0x10, 0x3e,
+    0x3e, 0x2a, 0x82, 0x3e, 0x12, 0x2a, 0x18, 0x24, 0x18, 0x24, 0x18, 0x3e, 0x3e, 0x2a, 0x3e, 0x3e,
+    0x24, 0x2a, 0x24, 0x18, 0x1e, 0x24, 0x1e, 0x3f, 0x83, 0x4d, 0x06, 0x3a, 0x37, 0x4d, 0x4d, 0x24,
+    0x22, 0x4f, 0xb6, 0x56, 0x89, 0x56, 0x00, 0x54, 0x94, 0x56, 0x05, 0x4f, 0x1b, 0x10, 0x3e, 0x3e,
+    0x2a, 0x83, 0x3e, 0x11, 0x2a, 0x3e, 0x24, 0x18, 0x09, 0x2a, 0x1e, 0x3e, 0x3e, 0x2a, 0x3e, 0x24,
+    0x18, 0x1e, 0x24, 0x1e, 0x3f, 0x3e, 0x8b, 0x4d, 0x02, 0x24, 0x22, 0x4f, 0xb4, 0x56, 0x9e, 0x56,
+    0x0f, 0x22, 0x09, 0x2a, 0x3e, 0x3e, 0x2a, 0x3e, 0x3e, 0x21, 0x20, 0x3e, 0x3e, 0x2a, 0x10, 0x18,
+    0x18, 0x82, 0x3e, 0x07, 0x2a, 0x10, 0x10, 0x18, 0x3e, 0x3e, 0x2a, 0x3e, 0x8f, 0x4d, 0x02, 0x24,
+    0x22, 0x4f, 0xb2, 0x56, 0x8a, 0x56, 0x00, 0x54, 0x91, 0x56, 0x04, 0x4b, 0x10, 0x3e, 0x3e, 0x2a,
+    0x82, 0x3e, 0x02, 0x1a, 0x1b, 0x1f, 0x82, 0x3e, 0x0b, 0x10, 0x3e, 0x24, 0x1e, 0x3e, 0x24, 0x18,
+    0x1e, 0x2a, 0x24, 0x1e, 0x2a, 0x93, 0x4d, 0x02, 0x24, 0x22, 0x4f, 0xb0, 0x56, 0x8a, 0x56, 0x00,
+    0x54, 0x91, 0x56, 0x01, 0x4b, 0x10, 0x82, 0x3e, 0x13, 0x22, 0x22, 0x2a, 0x1b, 0x1f, 0x1b, 0x3e,
+    0x3e, 0x2a, 0x10, 0x3e, 0x3e, 0x2a, 0x18, 0x3e, 0x18, 0x24, 0x2a, 0x24, 0x3f, 0x96, 0x4d, 0x02,
+    0x24, 0x1f, 0x4f, 0xae, 0x56, 0x8f, 0x56, 0x00, 0x54, 0x8c, 0x56, 0x09, 0x4b, 0x10, 0x3e, 0x3e,
+    0x1a, 0x1b, 0x1f, 0x33, 0x19, 0x1b, 0x82, 0x3e, 0x01, 0x32, 0x18, 0x82, 0x3e, 0x04, 0x1e, 0x24,
+    0x1e, 0x1e, 0x3e, 0x86, 0x4d, 0x00, 0x3f, 0x92, 0x4d, 0x02, 0x24, 0x22, 0x4f, 0x86, 0x56, 0x01,
+    0x47, 0x53, 0xa3, 0x56, 0x85, 0x56, 0x00, 0x54, 0x96, 0x56, 0x09, 0x4b, 0x10, 0x3e, 0x3e, 0x1a,
+    0x1b, 0x1f, 0x3e, 0x3e, 0x2a, 0x84, 0x3e, 0x00, 0x2a, 0x83, 0x3e, 0x00, 0x34, 0x88, 0x4d, 0x01,
+    0x28, 0x3a, 0x93, 0x4d, 0x02, 0x24, 0x22, 0x4f, 0x84, 0x56, 0x02, 0x13, 0x17, 0x47, 0xa2, 0x56,
+    0x9b, 0x56, 0x0f, 0x54, 0x56, 0x4b, 0x10, 0x3e, 0x3e, 0x24, 0x22, 0x2a, 0x3e, 0x3f, 0x24, 0x3f,
+    0x3e, 0x3e, 0x2a, 0x83, 0x3e, 0x01, 0x34, 0x3e, 0x89, 0x4d, 0x01, 0x23, 0x36, 0x95, 0x4d, 0x02,
+    0x24, 0x22, 0x4f, 0x82, 0x56, 0x02, 0x13, 0x17, 0x3c, 0xa2, 0x56, 0x94, 0x56, 0x00, 0x54, 0x87,
+    0x56, 0x01, 0x4b, 0x10, 0x83, 0x3e, 0x00, 0x2a, 0x83, 0x3e, 0x06, 0x34, 0x3e, 0x3e, 0x2a, 0x3e,
+    0x24, 0x3f, 0x8b, 0x4d, 0x01, 0x28, 0x3a, 0x97, 0x4d, 0x06, 0x24, 0x1f, 0x4f, 0x56, 0x1b, 0x29,
+    0x3b, 0xa2, 0x56, 0x9d, 0x56, 0x04, 0x4f, 0x10, 0x3e, 0x3e, 0x2a, 0x84, 0x3e, 0x00, 0x2a, 0x83,
+    0x3e, 0x01, 0x34, 0x3e, 0x8c, 0x4d, 0x01, 0x28, 0x3a, 0x99, 0x4d, 0x04, 0x18, 0x1b, 0x13, 0x17,
+    0x3c, 0xa2, 0x56, 0x9d, 0x56, 0x04, 0x1b, 0x14, 0x3e, 0x3e, 0x2a, 0x82, 0x3e, 0x00, 0x2a, 0x82,
+    0x3e, 0x01, 0x24, 0x2a, 0x8f, 0x4d, 0x01, 0x31, 0x36, 0x98, 0x4d, 0x05, 0x44, 0x30, 0x2b, 0x26,
+    0x29, 0x3b, 0xa2, 0x56, 0x9b, 0x56, 0x03, 0x2f, 0x1e, 0x4d, 0x18, 0x86, 0x3e, 0x06, 0x2a, 0x3e,
+    0x24, 0x4d, 0x3e, 0x1e, 0x3e, 0x8c, 0x4d, 0x02, 0x28, 0x4c, 0x3a, 0x99, 0x4d, 0x05, 0x44, 0x44,
+    0x45, 0x31, 0x24, 0x22, 0xa1, 0x56, 0x99, 0x56, 0x05, 0x38, 0x19, 0x3f, 0x4d, 0x4d, 0x18, 0x84,
+    0x3e, 0x02, 0x2a, 0x3e, 0x24, 0x82, 0x3f, 0x04, 0x2a, 0x10, 0x2a, 0x24, 0x3f, 0x88, 0x4d, 0x03,
+    0x3a, 0x3d, 0x31, 0x36, 0x9a, 0x4d, 0x06, 0x2d, 0x3d, 0x31, 0x41, 0x3f, 0x15, 0x54, 0xa0, 0x56,
+    0x97, 0x56, 0x02, 0x4b, 0x1a, 0x34, 0x83, 0x4d, 0x0b, 0x18, 0x3e, 0x3e, 0x2a, 0x3e, 0x3e, 0x24,
+    0x3e, 0x4d, 0x3f, 0x10, 0x10, 0x82, 0x3f, 0x01, 0x05, 0x18, 0x88, 0x4d, 0x02, 0x45, 0x2f, 0x44,
+    0x9a, 0x4d, 0x08, 0x3b, 0x39, 0x3b, 0x44, 0x24, 0x10, 0x2a, 0x1a, 0x54, 0x9f, 0x56, 0x96, 0x56,
+    0x02, 0x4b, 0x10, 0x3e, 0x84, 0x4d, 0x00, 0x18, 0x82, 0x3e, 0x01, 0x24, 0x1e, 0x83, 0x4d, 0x04,
+    0x2a, 0x3f, 0x18, 0x10, 0x3e, 0xa5, 0x4d, 0x0c, 0x2a, 0x24, 0x3f, 0x4d, 0x3f, 0x2a, 0x10, 0x10,
+    0x2a, 0x1e, 0x3e, 0x1a, 0x54, 0x9e, 0x56, 0x96, 0x56, 0x04, 0x27, 0x24, 0x2a, 0x24, 0x3e, 0x82,
+    0x4d, 0x03, 0x18, 0x3e, 0x2a, 0x24, 0x87, 0x4d, 0x01, 0x3f, 0x2a, 0xa4, 0x4d, 0x0f, 0x2a, 0x3f,
+    0x18, 0x10, 0x3f, 0x2a, 0x24, 0x10, 0x18, 0x3e, 0x4d, 0x3f, 0x2a, 0x3e, 0x1a, 0x54, 0x9d, 0x56,
+    0x95, 0x56, 0x0d, 0x21, 0x18, 0x18, 0x1e, 0x2a, 0x24, 0x1e, 0x3e, 0x4d, 0x10, 0x24, 0x2a, 0x44,
+    0x44, 0x84, 0x4d, 0x02, 0x3f, 0x38, 0x44, 0xa4, 0x4d, 0x08, 0x34, 0x10, 0x18, 0x4d, 0x3e, 0x2a,
+    0x10, 0x18, 0x3e, 0x83, 0x4d, 0x03, 0x3f, 0x1e, 0x3e, 0x1b, 0x9d, 0x56, 0x94, 0x56, 0x0e, 0x3b,
+    0x18, 0x3e, 0x3e, 0x18, 0x18, 0x24, 0x2a, 0x24, 0x18, 0x09, 0x09, 0x2a, 0x2c, 0x38, 0x84, 0x4d,
+    0x02, 0x3f, 0x28, 0x3a, 0xa2, 0x4d, 0x13, 0x24, 0x18, 0x3f, 0x3e, 0x3e, 0x2a, 0x10, 0x10, 0x2a,
+    0x4d, 0x4d, 0x3f, 0x2a, 0x4d, 0x44, 0x30, 0x20, 0x1e, 0x3e, 0x1b, 0x9c, 0x56, 0x94, 0x56, 0x0e,
+    0x38, 0x18, 0x18, 0x1e, 0x24, 0x2a, 0x24, 0x18, 0x24, 0x2a, 0x24, 0x18, 0x10, 0x10, 0x24, 0x84,
+    0x4d, 0x02, 0x44, 0x30, 0x3a, 0xa2, 0x4d, 0x06, 0x24, 0x18, 0x3f, 0x2a, 0x10, 0x10, 0x24, 0x82,
+    0x4d, 0x0a, 0x3f, 0x15, 0x25, 0x24, 0x4d, 0x41, 0x4d, 0x3e, 0x24, 0x3e, 0x1f, 0x9b, 0x56, 0x94,
+    0x56, 0x10, 0x3b, 0x18, 0x18, 0x1e, 0x1e, 0x24, 0x24, 0x2a, 0x24, 0x18, 0x1e, 0x2a, 0x24, 0x1e,
+    0x10, 0x10, 0x2a, 0x82, 0x4d, 0x05, 0x44, 0x30, 0x3a, 0x37, 0x27, 0x44, 0xa0, 0x4d, 0x04, 0x3f,
+    0x1e, 0x10, 0x18, 0x3e, 0x84, 0x4d, 0x03, 0x2a, 0x0e, 0x1c, 0x34, 0x82, 0x4d, 0x03, 0x3f, 0x1e,
+    0x3e, 0x1f, 0x9a, 0x56, 0x94, 0x56, 0x01, 0x38, 0x18, 0x82, 0x1e, 0x00, 0x24, 0x82, 0x1e, 0x05,
+    0x3e, 0x18, 0x10, 0x24, 0x2a, 0x24, 0x82, 0x10, 0x06, 0x2a, 0x4d, 0x44, 0x30, 0x1d, 0x43, 0x37,
+    0x9f, 0x4d, 0x09, 0x3f, 0x2a, 0x10, 0x10, 0x3e, 0x4d, 0x4d, 0x3e, 0x1c, 0x24, 0x82, 0x4d, 0x03,
+    0x2a, 0x1c, 0x12, 0x34, 0x82, 0x4d, 0x03, 0x24, 0x1e, 0x34, 0x27, 0x99, 0x56, 0x94, 0x56, 0x17,
+    0x38, 0x18, 0x18, 0x1e, 0x1e, 0x24, 0x24, 0x1e, 0x24, 0x1e, 0x1e, 0x3e, 0x1e, 0x09, 0x1e, 0x2a,
+    0x24, 0x18, 0x10, 0x10, 0x24, 0x26, 0x29, 0x44, 0x9f, 0x4d, 0x0b, 0x24, 0x10, 0x10, 0x2a, 0x4d,
+    0x4d, 0x3f, 0x35, 0x25, 0x1c, 0x12, 0x24, 0x82, 0x4d, 0x0a, 0x2a, 0x1c, 0x1c, 0x34, 0x4d, 0x44,
+    0x30, 0x18, 0x3e, 0x2a, 0x2f, 0x98, 0x56, 0x94, 0x56, 0x04, 0x38, 0x18, 0x1e, 0x1e, 0x24, 0x87,
+    0x1e, 0x05, 0x3e, 0x24, 0x10, 0x24, 0x2a, 0x24, 0x82, 0x10, 0x00, 0x24, 0x9e, 0x4d, 0x03, 0x2a,
+    0x10, 0x10, 0x24, 0x82, 0x4d, 0x07, 0x3e, 0x49, 0x35, 0x49, 0x24, 0x50, 0x50, 0x24, 0x82, 0x4d,
+    0x0a, 0x24, 0x12, 0x1c, 0x34, 0x44, 0x30, 0x44, 0x1e, 0x3e, 0x24, 0x2f, 0x97, 0x56, 0x94, 0x56,
+    0x09, 0x38, 0x18, 0x18, 0x1e, 0x1e, 0x24, 0x24, 0x1e, 0x1e, 0x24, 0x84, 0x1e, 0x09, 0x3e, 0x1e,
+    0x09, 0x1e, 0x2a, 0x24, 0x18, 0x10, 0x10, 0x2a, 0x9a, 0x4d, 0x10, 0x3e, 0x18, 0x10, 0x18, 0x3e,
+    0x4d, 0x4d, 0x3e, 0x40, 0x4e, 0x49, 0x25, 0x49, 0x34, 0x3e, 0x34, 0x3e, 0x83, 0x4d, 0x02, 0x2a,
+    0x1c, 0x24, 0x83, 0x4d, 0x04, 0x2a, 0x2a, 0x24, 0x38, 0x54, 0x95, 0x56, 0x94, 0x56, 0x01, 0x38,
+    0x18, 0x83, 0x1e, 0x00, 0x24, 0x89, 0x1e, 0x09, 0x3e, 0x24, 0x10, 0x24, 0x2a, 0x24, 0x1e, 0x10,
+    0x10, 0x2a, 0x96, 0x4d, 0x13, 0x3f, 0x2a, 0x10, 0x10, 0x3e, 0x4d, 0x4d, 0x3f, 0x3f, 0x55, 0x35,
+    0x25, 0x40, 0x4e, 0x49, 0x35, 0x35, 0x4e, 0x40, 0x1e, 0x83, 0x4d, 0x00, 0x3f, 0x83, 0x4d, 0x05,
+    0x3f, 0x1e, 0x18, 0x3e, 0x2a, 0x3c, 0x95, 0x56, 0x94, 0x56, 0x01, 0x38, 0x18, 0x84, 0x1e, 0x00,
+    0x24, 0x8a, 0x1e, 0x09, 0x3f, 0x1e, 0x09, 0x1e, 0x2a, 0x24, 0x18, 0x10, 0x10, 0x2a, 0x93, 0x4d,
+    0x03, 0x24, 0x10, 0x10, 0x2a, 0x82, 0x4d, 0x0e, 0x34, 0x49, 0x4e, 0x25, 0x35, 0x4e, 0x40, 0x35,
+    0x40, 0x40, 0x4e, 0x25, 0x25, 0x16, 0x24, 0x85, 0x4d, 0x08, 0x3f, 0x24, 0x34, 0x3e, 0x09, 0x2a,
+    0x3e, 0x19, 0x54, 0x94, 0x56, 0x94, 0x56, 0x08, 0x38, 0x18, 0x1e, 0x24, 0x1e, 0x24, 0x1e, 0x1e,
+    0x24, 0x82, 0x1e, 0x00, 0x24, 0x83, 0x1e, 0x00, 0x24, 0x82, 0x1e, 0x09, 0x3e, 0x24, 0x10, 0x18,
+    0x3e, 0x24, 0x18, 0x10, 0x10, 0x2a, 0x8f, 0x4d, 0x03, 0x24, 0x10, 0x10, 0x2a, 0x82, 0x4d, 0x10,
+    0x3f, 0x35, 0x55, 0x35, 0x25, 0x49, 0x4e, 0x40, 0x25, 0x49, 0x49, 0x35, 0x40, 0x40, 0x4e, 0x0b,
+    0x24, 0x84, 0x4d, 0x09, 0x2a, 0x3e, 0x3f, 0x2a, 0x3e, 0x3e, 0x10, 0x24, 0x2a, 0x4f, 0x94, 0x56,
+    0x94, 0x56, 0x03, 0x3c, 0x18, 0x1e, 0x24, 0x8e, 0x1e, 0x00, 0x24, 0x82, 0x1e, 0x09, 0x3e, 0x18,
+    0x10, 0x1e, 0x24, 0x1e, 0x1e, 0x10, 0x10, 0x24, 0x8b, 0x4d, 0x19, 0x3f, 0x18, 0x10, 0x18, 0x3e,
+    0x4d, 0x4d, 0x3f, 0x40, 0x4e, 0x49, 0x25, 0x35, 0x55, 0x35, 0x25, 0x4e, 0x40, 0x35, 0x25, 0x49,
+    0x49, 0x40, 0x15, 0x12, 0x18, 0x82, 0x4d, 0x04, 0x3f, 0x24, 0x34, 0x2a, 0x3e, 0x82, 0x4d, 0x03,
+    0x10, 0x18, 0x3e, 0x4b, 0x94, 0x56, 0x95, 0x56, 0x04, 0x10, 0x24, 0x1e, 0x1e, 0x24, 0x8b, 0x1e,
+    0x00, 0x24, 0x85, 0x1e, 0x0d, 0x3e, 0x1e, 0x09, 0x1e, 0x2a, 0x24, 0x1e, 0x10, 0x10, 0x24, 0x4d,
+    0x4d, 0x3a, 0x37, 0x83, 0x4d, 0x2a, 0x3f, 0x1e, 0x10, 0x10, 0x2a, 0x4d, 0x4d, 0x3f, 0x40, 0x40,
+    0x4e, 0x25, 0x35, 0x4e, 0x49, 0x35, 0x35, 0x55, 0x35, 0x25, 0x40, 0x40, 0x4e, 0x15, 0x12, 0x12,
+    0x0b, 0x18, 0x3f, 0x3f, 0x2a, 0x3e, 0x3e, 0x2a, 0x3e, 0x4d, 0x4d, 0x3e, 0x2a, 0x10, 0x0a, 0x24,
+    0x47, 0x94, 0x56, 0x95, 0x56, 0x02, 0x47, 0x0b, 0x18, 0x85, 0x1e, 0x00, 0x24, 0x8e, 0x1e, 0x0c,
+    0x2a, 0x3e, 0x1e, 0x09, 0x1e, 0x2a, 0x24, 0x18, 0x10, 0x10, 0x24, 0x26, 0x37, 0x82, 0x4d, 0x03,
+    0x24, 0x10, 0x10, 0x2a, 0x82, 0x4d, 0x24, 0x34, 0x49, 0x4e, 0x40, 0x25, 0x40, 0x4e, 0x25, 0x35,
+    0x4e, 0x40, 0x25, 0x40, 0x4e, 0x40, 0x1c, 0x12, 0x15, 0x0e, 0x0e, 0x34, 0x4d, 0x2a, 0x3e, 0x3f,
+    0x24, 0x3f, 0x4d, 0x4d, 0x3f, 0x24, 0x1e, 0x1e, 0x09, 0x02, 0x03, 0x27, 0x94, 0x56, 0x97, 0x56,
+    0x04, 0x38, 0x0b, 0x18, 0x1e, 0x24, 0x88, 0x1e, 0x00, 0x24, 0x89, 0x1e, 0x0f, 0x3e, 0x3e, 0x1e,
+    0x09, 0x1e, 0x24, 0x1e, 0x1e, 0x10, 0x10, 0x2a, 0x3f, 0x2a, 0x10, 0x10, 0x24, 0x82, 0x4d, 0x1a,
+    0x34, 0x49, 0x35, 0x49, 0x25, 0x49, 0x49, 0x40, 0x25, 0x40, 0x4e, 0x25, 0x25, 0x55, 0x35, 0x25,
+    0x15, 0x15, 0x12, 0x07, 0x24, 0x4d, 0x3e, 0x2a, 0x3e, 0x3f, 0x24, 0x82, 0x4d, 0x08, 0x3f, 0x1e,
+    0x1e, 0x24, 0x1e, 0x09, 0x01, 0x03, 0x27, 0x94, 0x56, 0x99, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x86,
+    0x1e, 0x00, 0x24, 0x8e, 0x1e, 0x06, 0x3e, 0x24, 0x10, 0x24, 0x2a, 0x24, 0x18, 0x82, 0x10, 0x01,
+    0x18, 0x3e, 0x82, 0x4d, 0x13, 0x35, 0x4e, 0x49, 0x25, 0x49, 0x49, 0x40, 0x25, 0x25, 0x4e, 0x35,
+    0x40, 0x40, 0x55, 0x35, 0x15, 0x12, 0x12, 0x0b, 0x18, 0x84, 0x3e, 0x00, 0x2a, 0x82, 0x4d, 0x0a,
+    0x3e, 0x24, 0x1e, 0x1e, 0x24, 0x1e, 0x1e, 0x04, 0x03, 0x01, 0x27, 0x94, 0x56, 0x9b, 0x56, 0x02,
+    0x38, 0x0b, 0x18, 0x82, 0x1e, 0x00, 0x24, 0x8c, 0x1e, 0x00, 0x24, 0x84, 0x1e, 0x07, 0x3e, 0x24,
+    0x10, 0x24, 0x2a, 0x24, 0x10, 0x2a, 0x84, 0x4d, 0x04, 0x3f, 0x35, 0x25, 0x49, 0x49, 0x82, 0x40,
+    0x1f, 0x4e, 0x25, 0x25, 0x4e, 0x25, 0x1c, 0x12, 0x15, 0x12, 0x07, 0x3f, 0x3f, 0x2a, 0x3e, 0x3e,
+    0x24, 0x3e, 0x4d, 0x4d, 0x3f, 0x24, 0x18, 0x1e, 0x24, 0x1e, 0x1e, 0x0a, 0x05, 0x02, 0x01, 0x16,
+    0x4f, 0x94, 0x56, 0x9d, 0x56, 0x02, 0x3b, 0x0b, 0x18, 0x87, 0x1e, 0x00, 0x24, 0x8d, 0x1e, 0x05,
+    0x3e, 0x18, 0x10, 0x1e, 0x24, 0x1e, 0x84, 0x4d, 0x1b, 0x3f, 0x4e, 0x40, 0x35, 0x25, 0x49, 0x4e,
+    0x25, 0x49, 0x49, 0x40, 0x25, 0x12, 0x1c, 0x12, 0x07, 0x34, 0x4d, 0x2a, 0x2a, 0x3e, 0x1e, 0x3e,
+    0x4d, 0x4d, 0x3f, 0x2a, 0x24, 0x82, 0x1e, 0x06, 0x24, 0x10, 0x03, 0x03, 0x01, 0x16, 0x4b, 0x96,
+    0x56, 0x9f, 0x56, 0x04, 0x38, 0x0b, 0x18, 0x1e, 0x24, 0x84, 0x1e, 0x00, 0x24, 0x85, 0x1e, 0x00,
+    0x24, 0x86, 0x1e, 0x1e, 0x3e, 0x24, 0x10, 0x24, 0x1e, 0x24, 0x44, 0x30, 0x44, 0x4d, 0x3e, 0x35,
+    0x15, 0x12, 0x25, 0x49, 0x35, 0x40, 0x4e, 0x25, 0x15, 0x12, 0x12, 0x07, 0x24, 0x4d, 0x3e, 0x3e,
+    0x2a, 0x3e, 0x3e, 0x82, 0x4d, 0x02, 0x3f, 0x1e, 0x24, 0x83, 0x1e, 0x04, 0x04, 0x03, 0x01, 0x08,
+    0x3c, 0x98, 0x56, 0xa1, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x85, 0x1e, 0x00, 0x24, 0x8d, 0x1e, 0x06,
+    0x3e, 0x24, 0x10, 0x18, 0x18, 0x1e, 0x37, 0x83, 0x4d, 0x1b, 0x24, 0x12, 0x0b, 0x0e, 0x25, 0x49,
+    0x0e, 0x0e, 0x15, 0x12, 0x18, 0x3f, 0x3f, 0x2a, 0x3e, 0x3e, 0x2a, 0x3e, 0x4d, 0x4d, 0x3e, 0x2a,
+    0x10, 0x1e, 0x24, 0x1e, 0x1e, 0x09, 0x82, 0x03, 0x00, 0x27, 0x9a, 0x56, 0xa3, 0x56, 0x02, 0x38,
+    0x0b, 0x18, 0x83, 0x1e, 0x00, 0x24, 0x8d, 0x1e, 0x06, 0x24, 0x3e, 0x24, 0x10, 0x24, 0x18, 0x24,
+    0x84, 0x4d, 0x1d, 0x24, 0x0b, 0x0e, 0x10, 0x3e, 0x4d, 0x0e, 0x0e, 0x3e, 0x4d, 0x2a, 0x3e, 0x3f,
+    0x24, 0x3f, 0x4d, 0x4d, 0x3f, 0x2a, 0x24, 0x1e, 0x24, 0x1e, 0x1e, 0x10, 0x03, 0x03, 0x01, 0x1a,
+    0x54, 0x9b, 0x56, 0xa5, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x86, 0x1e, 0x00, 0x24, 0x8a, 0x1e, 0x05,
+    0x3f, 0x1e, 0x10, 0x24, 0x1e, 0x3e, 0x84, 0x4d, 0x01, 0x24, 0x24, 0x84, 0x4d, 0x09, 0x34, 0x3e,
+    0x34, 0x24, 0x3f, 0x4d, 0x4d, 0x3f, 0x2a, 0x24, 0x83, 0x1e, 0x05, 0x09, 0x04, 0x03, 0x01, 0x0d,
+    0x46, 0x9d, 0x56, 0xa7, 0x56, 0x05, 0x38, 0x0b, 0x18, 0x1e, 0x1e, 0x24, 0x8a, 0x1e, 0x00, 0x24,
+    0x82, 0x1e, 0x08, 0x3e, 0x18, 0x10, 0x24, 0x18, 0x3f, 0x44, 0x30, 0x44, 0x85, 0x4d, 0x0b, 0x3f,
+    0x2a, 0x3e, 0x2a, 0x3e, 0x3f, 0x4d, 0x4d, 0x24, 0x1e, 0x1e, 0x24, 0x82, 0x1e, 0x04, 0x09, 0x03,
+    0x01, 0x03, 0x2f, 0x9f, 0x56, 0xa1, 0x56, 0x00, 0x54, 0x86, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x88,
+    0x1e, 0x00, 0x24, 0x86, 0x1e, 0x06, 0x3f, 0x18, 0x10, 0x24, 0x18, 0x3f, 0x2e, 0x84, 0x4d, 0x14,
+    0x3f, 0x2a, 0x3e, 0x3f, 0x24, 0x3f, 0x4d, 0x4d, 0x3e, 0x2a, 0x10, 0x1e, 0x1e, 0x24, 0x1e, 0x09,
+    0x03, 0x01, 0x02, 0x1b, 0x53, 0xa0, 0x56, 0xa3, 0x56, 0x00, 0x54, 0x86, 0x56, 0x02, 0x38, 0x0b,
+    0x18, 0x83, 0x1e, 0x00, 0x24, 0x8a, 0x1e, 0x05, 0x3f, 0x18, 0x18, 0x24, 0x18, 0x3e, 0x83, 0x4d,
+    0x0a, 0x2a, 0x3f, 0x3f, 0x2a, 0x3e, 0x4d, 0x4d, 0x3f, 0x24, 0x1e, 0x24, 0x82, 0x1e, 0x05, 0x09,
+    0x03, 0x03, 0x01, 0x0f, 0x4b, 0xa2, 0x56, 0x9f, 0x56, 0x00, 0x54, 0x8c, 0x56, 0x02, 0x38, 0x0b,
+    0x18, 0x87, 0x1e, 0x00, 0x24, 0x85, 0x1e, 0x11, 0x3e, 0x1e, 0x18, 0x24, 0x18, 0x3e, 0x4d, 0x3e,
+    0x3e, 0x2a, 0x3e, 0x24, 0x4d, 0x4d, 0x3e, 0x2a, 0x1e, 0x24, 0x83, 0x1e, 0x04, 0x04, 0x03, 0x01,
+    0x04, 0x3b, 0xa4, 0x56, 0xaf, 0x56, 0x06, 0x38, 0x0b, 0x18, 0x18, 0x1e, 0x1e, 0x24, 0x87, 0x1e,
+    0x10, 0x24, 0x1e, 0x3f, 0x18, 0x18, 0x1e, 0x1e, 0x24, 0x3f, 0x2a, 0x24, 0x3f, 0x4d, 0x4d, 0x24,
+    0x1e, 0x24, 0x83, 0x1e, 0x05, 0x09, 0x03, 0x01, 0x02, 0x22, 0x4f, 0xa5, 0x56, 0x9b, 0x56, 0x00,
+    0x54, 0x94, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x88, 0x1e, 0x00, 0x24, 0x82, 0x1e, 0x0b, 0x3e, 0x18,
+    0x10, 0x2a, 0x24, 0x1e, 0x3f, 0x4d, 0x4d, 0x3f, 0x1e, 0x24, 0x83, 0x1e, 0x05, 0x09, 0x03, 0x03,
+    0x01, 0x16, 0x4f, 0xa7, 0x56, 0x9c, 0x56, 0x00, 0x54, 0x95, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x84,
+    0x1e, 0x00, 0x24, 0x85, 0x1e, 0x12, 0x3e, 0x10, 0x24, 0x1e, 0x3e, 0x4d, 0x3f, 0x2a, 0x24, 0x1e,
+    0x1e, 0x24, 0x1e, 0x09, 0x04, 0x03, 0x01, 0x08, 0x45, 0xa9, 0x56, 0x98, 0x56, 0x00, 0x54, 0x9b,
+    0x56, 0x02, 0x38, 0x0b, 0x18, 0x89, 0x1e, 0x08, 0x24, 0x3e, 0x10, 0x24, 0x1e, 0x3e, 0x18, 0x1e,
+    0x24, 0x82, 0x1e, 0x00, 0x09, 0x82, 0x03, 0x00, 0x27, 0xab, 0x56, 0xa0, 0x56, 0x00, 0x54, 0x95,
+    0x56, 0x02, 0x38, 0x0b, 0x18, 0x82, 0x1e, 0x00, 0x24, 0x85, 0x1e, 0x04, 0x3e, 0x10, 0x18, 0x1e,
+    0x24, 0x82, 0x1e, 0x05, 0x09, 0x03, 0x01, 0x02, 0x1b, 0x4f, 0xac, 0x56, 0x95, 0x56, 0x00, 0x54,
+    0xa2, 0x56, 0x02, 0x38, 0x0b, 0x18, 0x87, 0x1e, 0x0b, 0x3e, 0x05, 0x10, 0x18, 0x24, 0x18, 0x10,
+    0x03, 0x03, 0x01, 0x0f, 0x47, 0xae, 0x56, 0x95, 0x56, 0x00, 0x54, 0xa4, 0x56, 0x02, 0x3b, 0x0b,
+    0x18, 0x84, 0x1e, 0x0b, 0x24, 0x3e, 0x09, 0x01, 0x03, 0x09, 0x03, 0x03, 0x01, 0x04, 0x38, 0x54,
+    0xaf, 0x56, 0x92, 0x56, 0x00, 0x54, 0xa9, 0x56, 0x02, 0x45, 0x0b, 0x18, 0x83, 0x1e, 0x08, 0x34,
+    0x10, 0x03, 0x01, 0x02, 0x02, 0x01, 0x1f, 0x4f, 0xb1, 0x56, 0xbf, 0x56, 0x0b, 0x3b, 0x0b, 0x18,
+    0x1e, 0x1e, 0x24, 0x11, 0x03, 0x01, 0x02, 0x0f, 0x4b, 0xb3, 0x56, 0x8d, 0x56, 0x00, 0x54, 0xb2,
+    0x56, 0x08, 0x27, 0x0b, 0x10, 0x18, 0x0c, 0x01, 0x00, 0x0f, 0x4b, 0xb4, 0x56, 0x91, 0x56, 0x00,
+    0x54, 0xb0, 0x56, 0x05, 0x3c, 0x4b, 0x56, 0x4b, 0x56, 0x4b, 0xb5, 0x56, 0x8b, 0x56, 0x00, 0x54,
+    0xf2, 0x56, 0x95, 0x56, 0x00, 0x54, 0xc2, 0x56, 0x00, 0x54, 0xa4, 0x56, 0x82, 0x56, 0x00, 0x54,
+    0xf6, 0x56, 0x00, 0x54, 0x83, 0x56, 0x89, 0x56, 0x00, 0x54, 0xdb, 0x56, 0x00, 0x54, 0x97, 0x56,
+    0xf3, 0x56, 0x00, 0x54, 0x8a, 0x56, 0xff, 0x56, 0xed, 0x56, 0x00, 0x54, 0x90, 0x56, 0xc4, 0x56,
+    0x00, 0x54, 0xb9, 0x56, 0xe8, 0x56, 0x00, 0x54, 0x95, 0x56, 0x9e, 0x56, 0x00, 0x54, 0xc4, 0x56,
+    0x00, 0x54, 0x99, 0x56, 0xe4, 0x56, 0x00, 0x54, 0x99, 0x56, 0xa3, 0x56, 0x00, 0x54, 0xda, 0x56,
+    0xe1, 0x56, 0x00, 0x54, 0x9c, 0x56, 0xff, 0x56, 0xdf, 0x56, 0x00, 0x54, 0x9e, 0x56, 0x83, 0x56,
+    0x00, 0x54, 0xdf, 0x56, 0x00, 0x54, 0x99, 0x56, 0xde, 0x56, 0x00, 0x54, 0x9f, 0x56, 0xab, 0x56,
+    0x00, 0x54, 0xc6, 0x56, 0x00, 0x54, 0x8a, 0x56, 0xde, 0x56, 0x00, 0x54, 0x9f, 0x56, 0xc6, 0x56,
+    0x00, 0x54, 0xb7, 0x56, 0xdf, 0x56, 0x00, 0x54, 0x9e, 0x56, 0xff, 0x56, 0xe1, 0x56, 0x00, 0x54,
+    0x9c, 0x56, 0xa9, 0x56, 0x00, 0x54, 0xd4, 0x56, 0xe4, 0x56, 0x00, 0x54, 0x99, 0x56, 0xbc, 0x56,
+    0x00, 0x54, 0xc1, 0x56, 0xe8, 0x56, 0x00, 0x54, 0x95, 0x56, 0x8d, 0x56, 0x00, 0x54, 0xe3, 0x56,
+    0x00, 0x54, 0x8b, 0x56, 0xed, 0x56, 0x00, 0x54, 0x90, 0x56,
+};
+
+// 101 colors, 4930 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_1[] = {
+    0x2124, 0x2186, 0x21a8, 0x2921, 0x2943, 0x2946, 0x3186, 0x3207, 0x39a4, 0x3a4a, 0x4226, 0x4248,
+    0x42ad, 0x4a89, 0x4a8b, 0x5247, 0x5288, 0x52cb, 0x532e, 0x62c8, 0x62ec, 0x630b, 0x63b1, 0x6b8e,
+    0x7349, 0x7432, 0x83ce, 0x84f4, 0x8558, 0x8c4f, 0x8c92, 0x9556, 0x95b8, 0x95f9, 0x9bd1, 0x9cf3,
+    0x9d78, 0x9dfa, 0x9e3b, 0xa4cf, 0xa4d1, 0xa4d4, 0xa557, 0xa5fa, 0xa639, 0xad31, 0xad32, 0xad55,
+    0xadd9, 0xae5b, 0xaebd, 0xaedc, 0xb532, 0xb533, 0xb572, 0xb573, 0xb574, 0xb5b6, 0xb5f9, 0xb639,
+    0xbd72, 0xbd74, 0xbdb3, 0xbdf7, 0xbebb, 0xbefc, 0xbefe, 0xc5f7, 0xc638, 0xcdd4, 0xce35, 0xce57,
+    0xcf3e, 0xd44e, 0xd679, 0xd6b8, 0xd6ba, 0xde2f, 0xde35, 0xde36, 0xdeb7, 0xdeb8, 0xdeba, 0xdef9,
+    0xdefb, 0xe6f8, 0xe6fb, 0xe73c, 0xee97, 0xeefa, 0xef39, 0xef3b, 0xef3c, 0xef7d, 0xf738, 0xf77d,
+    0xf7be, 0xff7a, 0xffbb, 0xffbc, 0xffff,
+};
+static constexpr uint16_t mac_row_1[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 74, 80, 90,
+    96, 98, 104, 114, 124, 126, 137, 151, 165, 179, 193, 216, 238, 263, 293, 326,
+    363, 398, 445, 491, 536, 576, 620, 666, 713, 755, 807, 858, 908, 959, 1012, 1070,
+    1124, 1178, 1235, 1291, 1346, 1401, 1451, 1500, 1550, 1599, 1648, 1697, 1745, 1794, 1842, 1891,
+    1939, 1986, 2034, 2080, 2123, 2165, 2207, 2248, 2291, 2333, 2374, 2413, 2453, 2491, 2531, 2575,
+    2618, 2667, 2722, 2786, 2852, 2920, 2993, 3074, 3154, 3234, 3315, 3393, 3469, 3539, 3608, 3670,
+    3731, 3786, 3842, 3897, 3948, 3992, 4040, 4084, 4127, 4163, 4198, 4231, 4261, 4288, 4310, 4332,
+    4350, 4365, 4377, 4390, 4396, 4406, 4412, 4418, 4424, 4426, 4432, 4438, 4444, 4450, 4456, 4466,
+};
+static constexpr uint8_t mac_code_1[] = {
+    0xff, 0x64, 0xd8, 0x64, 0x00, 0x60, 0xa5, 0x64, 0x86, 0x64, 0x00, 0x60, 0xc9, 0x64, 0x00, 0x60,
+    0xac, 0x64, 0xbf, 0x64, 0x00, 0x60, 0xbe, 0x64, 0xff, 0x64, 0xa7, 0x64, 0x00, 0x60, 0xd6, 0x64,
+    0x9d, 0x64, 0x00, 0x60, 0xcb, 0x64, 0x00, 0x60, 0x93, 0x64, 0x90, 0x64, 0x00, 0x60, 0xe8, 0x64,
+    0x00, 0x60, 0x83, 0x64, 0xff, 0x64, 0xe5, 0x64, 0x00, 0x60, 0x98, 0x64, 0xb8, 0x64, 0x00, 0x60,
+    0xc5, 0x64, 0xd1, 0x64, 0x00, 0x60, 0xac, 0x64, 0xff, 0x64, 0xbe, 0x64, 0x00, 0x60, 0xbf, 0x64,
+    0x87, 0x64, 0x00, 0x60, 0xce, 0x64, 0x00, 0x60, 0xa6, 0x64, 0xac, 0x64, 0x00, 0x60, 0xd1, 0x64,
+    0xff, 0x64, 0x9b, 0x64, 0x00, 0x60, 0xe2, 0x64, 0xa8, 0x64, 0x00, 0x60, 0xd0, 0x64, 0x00, 0x60,
+    0x83, 0x64, 0x8b, 0x64, 0x00, 0x60, 0xef, 0x64, 0x02, 0x60, 0x64, 0x64, 0xff, 0x64, 0xb9, 0x64,
+    0x00, 0x44, 0x82, 0x1d, 0x01, 0x44, 0x60, 0xbf, 0x64, 0xb7, 0x64, 0x02, 0x54, 0x1d, 0x3e, 0x82,
+    0x5e, 0x02, 0x45, 0x1a, 0x4a, 0xbe, 0x64, 0xb6, 0x64, 0x02, 0x23, 0x27, 0x55, 0x85, 0x5e, 0x02,
+    0x3e, 0x1d, 0x4c, 0xbc, 0x64, 0xb4, 0x64, 0x02, 0x3f, 0x1a, 0x4a, 0x89, 0x5e, 0x02, 0x3e, 0x1d,
+    0x4c, 0xba, 0x64, 0xb3, 0x64, 0x01, 0x44, 0x28, 0x8c, 0x5e, 0x03, 0x55, 0x2d, 0x1e, 0x57, 0xb8,
+    0x64, 0xb3, 0x64, 0x03, 0x1a, 0x4a, 0x5e, 0x55, 0x87, 0x5e, 0x00, 0x55, 0x84, 0x5e, 0x02, 0x28,
+    0x23, 0x5c, 0xad, 0x64, 0x00, 0x60, 0x87, 0x64, 0xb2, 0x64, 0x01, 0x1e, 0x47, 0x82, 0x4b, 0x01,
+    0x51, 0x55, 0x88, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x02, 0x1d, 0x3e, 0x5d, 0xb4, 0x64, 0xb1, 0x64,
+    0x09, 0x4a, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x89, 0x5e, 0x06, 0x55, 0x5e,
+    0x5e, 0x50, 0x1d, 0x3e, 0x5d, 0xb2, 0x64, 0xb0, 0x64, 0x0d, 0x4c, 0x1a, 0x4a, 0x5e, 0x4b, 0x4b,
+    0x51, 0x4b, 0x55, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x86, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x03, 0x45,
+    0x1d, 0x3f, 0x60, 0xb0, 0x64, 0xae, 0x64, 0x09, 0x57, 0x1e, 0x2d, 0x5a, 0x55, 0x4b, 0x4b, 0x51,
+    0x4b, 0x55, 0x82, 0x4b, 0x03, 0x51, 0x4b, 0x55, 0x4b, 0x86, 0x5e, 0x00, 0x55, 0x84, 0x5e, 0x03,
+    0x45, 0x1d, 0x44, 0x60, 0xae, 0x64, 0x86, 0x64, 0x00, 0x60, 0xa5, 0x64, 0x02, 0x2f, 0x1d, 0x4c,
+    0x84, 0x5e, 0x04, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x87, 0x5e,
+    0x00, 0x55, 0x83, 0x5e, 0x03, 0x45, 0x1a, 0x2f, 0x57, 0xac, 0x64, 0xab, 0x64, 0x02, 0x3f, 0x1a,
+    0x46, 0x86, 0x5e, 0x06, 0x55, 0x5e, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x84, 0x4b, 0x00, 0x51, 0x86,
+    0x5e, 0x00, 0x55, 0x83, 0x5e, 0x05, 0x34, 0x45, 0x58, 0x1d, 0x3e, 0x5d, 0xaa, 0x64, 0x02, 0x64,
+    0x64, 0x60, 0xa2, 0x64, 0x06, 0x3f, 0x29, 0x52, 0x64, 0x54, 0x1d, 0x3c, 0x86, 0x5e, 0x00, 0x55,
+    0x83, 0x5e, 0x00, 0x55, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x82, 0x4b, 0x86, 0x5e, 0x0b, 0x55,
+    0x5e, 0x5e, 0x45, 0x36, 0x5a, 0x55, 0x5e, 0x5e, 0x45, 0x1d, 0x44, 0xa9, 0x64, 0x83, 0x64, 0x00,
+    0x60, 0x9e, 0x64, 0x07, 0x44, 0x1a, 0x46, 0x50, 0x28, 0x1a, 0x27, 0x55, 0x86, 0x5e, 0x00, 0x55,
+    0x83, 0x5e, 0x00, 0x55, 0x82, 0x5e, 0x04, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x88, 0x5e, 0x03, 0x55,
+    0x5e, 0x28, 0x4b, 0x86, 0x5e, 0x02, 0x34, 0x1e, 0x57, 0xa7, 0x64, 0x02, 0x64, 0x64, 0x60, 0x9e,
+    0x64, 0x02, 0x57, 0x1e, 0x34, 0x84, 0x5e, 0x00, 0x4b, 0x86, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00,
+    0x55, 0x84, 0x5e, 0x02, 0x4b, 0x4b, 0x51, 0x87, 0x5e, 0x04, 0x55, 0x5e, 0x28, 0x45, 0x58, 0x86,
+    0x5e, 0x03, 0x45, 0x36, 0x45, 0x1a, 0xa7, 0x64, 0xa0, 0x64, 0x02, 0x39, 0x1d, 0x4c, 0x87, 0x5e,
+    0x00, 0x55, 0x83, 0x5e, 0x00, 0x55, 0x88, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00, 0x55, 0x86, 0x5e,
+    0x02, 0x3e, 0x36, 0x5a, 0x86, 0x5e, 0x06, 0x55, 0x28, 0x4b, 0x5e, 0x5e, 0x27, 0x60, 0xa6, 0x64,
+    0x86, 0x64, 0x00, 0x60, 0x97, 0x64, 0x01, 0x1a, 0x46, 0x86, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00,
+    0x55, 0x8a, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00, 0x55, 0x85, 0x5e, 0x02, 0x4e, 0x28, 0x4b, 0x86,
+    0x5e, 0x02, 0x4b, 0x34, 0x45, 0x83, 0x5e, 0x01, 0x27, 0x60, 0xa6, 0x64, 0x84, 0x64, 0x00, 0x60,
+    0x98, 0x64, 0x02, 0x39, 0x39, 0x55, 0x8a, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00, 0x55, 0x85, 0x5e,
+    0x01, 0x51, 0x55, 0x86, 0x5e, 0x04, 0x55, 0x5e, 0x5e, 0x2d, 0x46, 0x87, 0x5e, 0x02, 0x45, 0x36,
+    0x5a, 0x82, 0x5e, 0x03, 0x63, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x87, 0x64, 0x00, 0x60, 0x95, 0x64,
+    0x04, 0x1a, 0x4a, 0x5e, 0x4b, 0x55, 0x8b, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x03, 0x55, 0x5e, 0x51,
+    0x55, 0x87, 0x5e, 0x05, 0x55, 0x5e, 0x3e, 0x36, 0x5a, 0x55, 0x85, 0x5e, 0x02, 0x4b, 0x34, 0x50,
+    0x82, 0x5e, 0x83, 0x63, 0x01, 0x28, 0x60, 0xa6, 0x64, 0x9d, 0x64, 0x01, 0x4c, 0x28, 0x82, 0x4b,
+    0x02, 0x51, 0x4b, 0x55, 0x89, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x01, 0x55, 0x55, 0x89, 0x5e, 0x02,
+    0x4b, 0x2d, 0x5a, 0x86, 0x5e, 0x03, 0x55, 0x28, 0x45, 0x58, 0x82, 0x5e, 0x84, 0x63, 0x01, 0x28,
+    0x60, 0xa6, 0x64, 0x02, 0x64, 0x64, 0x60, 0x9a, 0x64, 0x01, 0x29, 0x47, 0x82, 0x4b, 0x02, 0x51,
+    0x4b, 0x55, 0x82, 0x4b, 0x87, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00, 0x55, 0x85, 0x5e, 0x04, 0x51,
+    0x5e, 0x5e, 0x2d, 0x46, 0x86, 0x5e, 0x03, 0x55, 0x3e, 0x36, 0x5a, 0x82, 0x5e, 0x83, 0x63, 0x04,
+    0x4f, 0x51, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x02, 0x64, 0x64, 0x60, 0x9a, 0x64, 0x05, 0x1a, 0x4b,
+    0x4b, 0x51, 0x4b, 0x55, 0x85, 0x4b, 0x00, 0x51, 0x88, 0x5e, 0x00, 0x55, 0x83, 0x5e, 0x00, 0x55,
+    0x83, 0x5e, 0x02, 0x3e, 0x36, 0x5a, 0x86, 0x5e, 0x02, 0x4e, 0x28, 0x50, 0x82, 0x5e, 0x83, 0x63,
+    0x06, 0x51, 0x36, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x82, 0x64, 0x00, 0x60, 0x98, 0x64,
+    0x06, 0x4a, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x86, 0x4b, 0x00, 0x51, 0x89, 0x5e, 0x00, 0x55,
+    0x83, 0x5e, 0x03, 0x55, 0x55, 0x2d, 0x5a, 0x87, 0x5e, 0x01, 0x34, 0x46, 0x83, 0x5e, 0x82, 0x63,
+    0x08, 0x5b, 0x3e, 0x36, 0x2d, 0x36, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x82, 0x64, 0x00, 0x60,
+    0x98, 0x64, 0x06, 0x1e, 0x47, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x87, 0x4b, 0x02, 0x51, 0x4b, 0x55,
+    0x8a, 0x5e, 0x02, 0x55, 0x28, 0x45, 0x86, 0x5e, 0x06, 0x55, 0x3e, 0x36, 0x5a, 0x5e, 0x5e, 0x61,
+    0x83, 0x63, 0x09, 0x46, 0x2d, 0x1e, 0x27, 0x2d, 0x36, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x82,
+    0x64, 0x00, 0x60, 0x98, 0x64, 0x09, 0x1a, 0x4a, 0x5e, 0x4b, 0x55, 0x4b, 0x4b, 0x51, 0x4b, 0x55,
+    0x88, 0x4b, 0x00, 0x51, 0x87, 0x5e, 0x01, 0x3e, 0x3c, 0x87, 0x5e, 0x04, 0x45, 0x36, 0x58, 0x5e,
+    0x5e, 0x82, 0x63, 0x0d, 0x5b, 0x63, 0x51, 0x36, 0x1d, 0x0a, 0x06, 0x16, 0x1d, 0x3e, 0x36, 0x63,
+    0x28, 0x60, 0xa6, 0x64, 0x82, 0x64, 0x00, 0x60, 0x98, 0x64, 0x06, 0x1d, 0x4c, 0x4b, 0x4b, 0x51,
+    0x4b, 0x55, 0x89, 0x4b, 0x0b, 0x51, 0x4b, 0x55, 0x4b, 0x5e, 0x5a, 0x55, 0x5e, 0x5e, 0x58, 0x28,
+    0x4b, 0x86, 0x5e, 0x02, 0x4b, 0x2d, 0x46, 0x82, 0x5e, 0x00, 0x62, 0x82, 0x63, 0x0d, 0x59, 0x3e,
+    0x1d, 0x13, 0x00, 0x17, 0x1c, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x89, 0x64,
+    0x00, 0x60, 0x91, 0x64, 0x01, 0x1d, 0x4c, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8a, 0x4b, 0x07,
+    0x51, 0x4b, 0x55, 0x4b, 0x5e, 0x5a, 0x5e, 0x27, 0x86, 0x5e, 0x02, 0x55, 0x3e, 0x36, 0x82, 0x5e,
+    0x84, 0x63, 0x0e, 0x4f, 0x2d, 0x18, 0x04, 0x11, 0x30, 0x1f, 0x16, 0x12, 0x1a, 0x27, 0x36, 0x63,
+    0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x01, 0x1d, 0x4c, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8b,
+    0x4b, 0x11, 0x51, 0x4b, 0x55, 0x4b, 0x5e, 0x36, 0x5a, 0x5e, 0x5e, 0x61, 0x5e, 0x5e, 0x45, 0x2d,
+    0x5a, 0x5e, 0x5e, 0x61, 0x83, 0x63, 0x10, 0x4f, 0x2d, 0x1d, 0x0a, 0x07, 0x1f, 0x31, 0x1b, 0x1b,
+    0x25, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x8a, 0x64, 0x00, 0x60, 0x90, 0x64,
+    0x05, 0x1a, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x8c, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x83, 0x4b, 0x07,
+    0x2e, 0x5a, 0x55, 0x5e, 0x5e, 0x58, 0x2d, 0x46, 0x82, 0x5e, 0x82, 0x63, 0x13, 0x5b, 0x63, 0x3e,
+    0x1d, 0x13, 0x00, 0x19, 0x30, 0x1f, 0x1b, 0x25, 0x33, 0x31, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28,
+    0x60, 0xa6, 0x64, 0x8a, 0x64, 0x00, 0x60, 0x8f, 0x64, 0x02, 0x57, 0x1d, 0x4c, 0x84, 0x4b, 0x02,
+    0x51, 0x4b, 0x55, 0x8d, 0x4b, 0x03, 0x51, 0x4b, 0x28, 0x4b, 0x82, 0x5e, 0x04, 0x2d, 0x5a, 0x5e,
+    0x5e, 0x61, 0x83, 0x63, 0x13, 0x46, 0x28, 0x18, 0x04, 0x11, 0x30, 0x31, 0x21, 0x2c, 0x48, 0x42,
+    0x32, 0x31, 0x16, 0x1a, 0x27, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x8f, 0x64, 0x00, 0x60, 0x8b,
+    0x64, 0x05, 0x1d, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x8e, 0x4b, 0x05, 0x51, 0x4b, 0x55, 0x4b, 0x4b,
+    0x28, 0x83, 0x4b, 0x02, 0x36, 0x5a, 0x5e, 0x83, 0x63, 0x15, 0x46, 0x34, 0x1e, 0x08, 0x05, 0x1b,
+    0x25, 0x33, 0x40, 0x48, 0x42, 0x48, 0x42, 0x32, 0x31, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28, 0x60,
+    0xa6, 0x64, 0x85, 0x64, 0x00, 0x60, 0x95, 0x64, 0x05, 0x1a, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x8f,
+    0x4b, 0x04, 0x51, 0x4b, 0x55, 0x4b, 0x28, 0x83, 0x4b, 0x1c, 0x36, 0x5a, 0x5e, 0x63, 0x63, 0x51,
+    0x3e, 0x1d, 0x13, 0x00, 0x17, 0x3b, 0x2b, 0x20, 0x41, 0x48, 0x42, 0x48, 0x48, 0x42, 0x32, 0x31,
+    0x16, 0x1a, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x05, 0x1d, 0x4b, 0x4b, 0x51,
+    0x4b, 0x55, 0x90, 0x4b, 0x03, 0x51, 0x4b, 0x55, 0x28, 0x83, 0x4b, 0x1c, 0x36, 0x5a, 0x5e, 0x63,
+    0x63, 0x2d, 0x27, 0x06, 0x0b, 0x2a, 0x30, 0x1f, 0x2c, 0x48, 0x48, 0x42, 0x48, 0x1b, 0x41, 0x48,
+    0x31, 0x21, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x01, 0x1d, 0x4c,
+    0x85, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8e, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x1c, 0x36, 0x5e, 0x5e,
+    0x63, 0x63, 0x45, 0x0f, 0x19, 0x30, 0x1b, 0x1b, 0x41, 0x48, 0x48, 0x42, 0x30, 0x1f, 0x2c, 0x41,
+    0x1b, 0x1b, 0x41, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x05, 0x1d,
+    0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x91, 0x4b, 0x12, 0x51, 0x4b, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x28,
+    0x5e, 0x5e, 0x63, 0x63, 0x45, 0x1b, 0x1b, 0x19, 0x30, 0x48, 0x42, 0x82, 0x48, 0x0d, 0x24, 0x19,
+    0x1f, 0x31, 0x20, 0x26, 0x26, 0x16, 0x1d, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64,
+    0x00, 0x1a, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x15, 0x36, 0x4b, 0x4b, 0x51, 0x4b,
+    0x28, 0x5e, 0x61, 0x63, 0x63, 0x2d, 0x1e, 0x20, 0x1f, 0x48, 0x42, 0x32, 0x31, 0x48, 0x42, 0x1b,
+    0x1b, 0x82, 0x1f, 0x08, 0x25, 0x26, 0x16, 0x1a, 0x27, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9b,
+    0x64, 0x06, 0x57, 0x1d, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x93, 0x4b, 0x00, 0x36, 0x82, 0x4b, 0x1d,
+    0x51, 0x36, 0x5a, 0x5e, 0x63, 0x63, 0x2d, 0x19, 0x30, 0x1b, 0x48, 0x42, 0x30, 0x2c, 0x48, 0x31,
+    0x16, 0x2b, 0x19, 0x1f, 0x31, 0x21, 0x26, 0x16, 0x1a, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6, 0x64,
+    0x9c, 0x64, 0x01, 0x1d, 0x4c, 0x86, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8d, 0x4b, 0x00, 0x28, 0x83,
+    0x4b, 0x1c, 0x36, 0x5e, 0x61, 0x63, 0x63, 0x2d, 0x19, 0x1f, 0x1c, 0x42, 0x48, 0x24, 0x2c, 0x24,
+    0x1f, 0x16, 0x1c, 0x42, 0x32, 0x31, 0x26, 0x26, 0x12, 0x1a, 0x2d, 0x36, 0x63, 0x28, 0x60, 0xa6,
+    0x64, 0x9c, 0x64, 0x00, 0x1d, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x00, 0x28, 0x83,
+    0x4b, 0x1c, 0x36, 0x5e, 0x61, 0x63, 0x63, 0x28, 0x0c, 0x1b, 0x1b, 0x41, 0x42, 0x16, 0x1b, 0x1b,
+    0x19, 0x26, 0x26, 0x32, 0x31, 0x26, 0x1b, 0x16, 0x0e, 0x1a, 0x27, 0x36, 0x63, 0x28, 0x60, 0xa6,
+    0x64, 0x9c, 0x64, 0x01, 0x1d, 0x4c, 0x87, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8c, 0x4b, 0x00, 0x28,
+    0x83, 0x4b, 0x0a, 0x36, 0x5e, 0x61, 0x63, 0x61, 0x28, 0x19, 0x1f, 0x1c, 0x42, 0x20, 0x82, 0x1f,
+    0x0e, 0x25, 0x32, 0x31, 0x32, 0x20, 0x16, 0x19, 0x12, 0x09, 0x1a, 0x27, 0x36, 0x63, 0x28, 0x60,
+    0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x91, 0x4b, 0x00, 0x28,
+    0x83, 0x4b, 0x1c, 0x36, 0x5e, 0x61, 0x63, 0x61, 0x28, 0x19, 0x1b, 0x1b, 0x41, 0x20, 0x26, 0x32,
+    0x31, 0x32, 0x32, 0x31, 0x1b, 0x1b, 0x1f, 0x12, 0x01, 0x00, 0x27, 0x2d, 0x36, 0x63, 0x28, 0x60,
+    0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1a, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x10, 0x28,
+    0x4b, 0x4b, 0x51, 0x4b, 0x28, 0x5e, 0x61, 0x63, 0x63, 0x28, 0x19, 0x1f, 0x1c, 0x42, 0x32, 0x31,
+    0x82, 0x32, 0x0d, 0x20, 0x16, 0x19, 0x1b, 0x0c, 0x00, 0x00, 0x17, 0x3e, 0x36, 0x2d, 0x63, 0x28,
+    0x60, 0xa6, 0x64, 0x9c, 0x64, 0x05, 0x1d, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x93, 0x4b, 0x21, 0x36,
+    0x4b, 0x4b, 0x51, 0x4b, 0x28, 0x5e, 0x61, 0x63, 0x61, 0x28, 0x19, 0x1f, 0x1c, 0x42, 0x32, 0x32,
+    0x31, 0x26, 0x1b, 0x19, 0x1f, 0x16, 0x01, 0x00, 0x00, 0x27, 0x50, 0x5e, 0x4f, 0x51, 0x63, 0x28,
+    0x60, 0xa6, 0x64, 0x9c, 0x64, 0x05, 0x1d, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x93, 0x4b, 0x00, 0x28,
+    0x83, 0x4b, 0x17, 0x36, 0x5e, 0x61, 0x63, 0x61, 0x28, 0x19, 0x1f, 0x1c, 0x42, 0x32, 0x31, 0x1b,
+    0x0c, 0x16, 0x1b, 0x09, 0x00, 0x00, 0x15, 0x45, 0x58, 0x5e, 0x5e, 0x82, 0x63, 0x01, 0x28, 0x60,
+    0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x00, 0x28,
+    0x82, 0x4b, 0x17, 0x51, 0x36, 0x5e, 0x5e, 0x63, 0x63, 0x28, 0x19, 0x19, 0x1f, 0x31, 0x1c, 0x12,
+    0x16, 0x19, 0x0c, 0x00, 0x00, 0x0a, 0x34, 0x5e, 0x58, 0x5e, 0x62, 0x83, 0x63, 0x01, 0x28, 0x60,
+    0xa6, 0x64, 0x9c, 0x64, 0x01, 0x1d, 0x4c, 0x88, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8b, 0x4b, 0x00,
+    0x28, 0x83, 0x4b, 0x14, 0x36, 0x5e, 0x61, 0x63, 0x61, 0x28, 0x19, 0x20, 0x16, 0x19, 0x0e, 0x19,
+    0x16, 0x01, 0x00, 0x00, 0x1d, 0x4f, 0x51, 0x55, 0x5e, 0x85, 0x63, 0x01, 0x28, 0x60, 0xa6, 0x64,
+    0x9c, 0x64, 0x05, 0x1a, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x93, 0x4b, 0x17, 0x28, 0x4b, 0x4b, 0x51,
+    0x4b, 0x28, 0x5e, 0x61, 0x63, 0x61, 0x28, 0x19, 0x1b, 0x19, 0x16, 0x1c, 0x0e, 0x00, 0x00, 0x15,
+    0x45, 0x58, 0x5e, 0x5e, 0x87, 0x63, 0x01, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x84,
+    0x4b, 0x02, 0x51, 0x4b, 0x55, 0x90, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x11, 0x36, 0x5e, 0x61, 0x63,
+    0x61, 0x28, 0x1b, 0x16, 0x19, 0x12, 0x05, 0x00, 0x0a, 0x34, 0x5e, 0x58, 0x5a, 0x62, 0x88, 0x63,
+    0x01, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x05, 0x1d, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x93, 0x4b,
+    0x00, 0x28, 0x82, 0x4b, 0x10, 0x51, 0x36, 0x5e, 0x61, 0x63, 0x63, 0x2d, 0x19, 0x16, 0x01, 0x00,
+    0x04, 0x1d, 0x4f, 0x58, 0x5e, 0x62, 0x88, 0x63, 0x03, 0x51, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c,
+    0x64, 0x05, 0x1d, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x93, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x0d, 0x36,
+    0x5e, 0x5e, 0x63, 0x63, 0x28, 0x02, 0x00, 0x00, 0x15, 0x45, 0x58, 0x5e, 0x5b, 0x88, 0x63, 0x05,
+    0x51, 0x3e, 0x2d, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1a, 0x82, 0x4b, 0x02, 0x51,
+    0x4b, 0x55, 0x92, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x0c, 0x36, 0x5e, 0x61, 0x63, 0x63, 0x58, 0x1d,
+    0x18, 0x36, 0x5a, 0x58, 0x5e, 0x62, 0x87, 0x63, 0x07, 0x59, 0x3e, 0x50, 0x5e, 0x2d, 0x63, 0x28,
+    0x60, 0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x00,
+    0x28, 0x83, 0x4b, 0x0a, 0x36, 0x5e, 0x5e, 0x63, 0x63, 0x58, 0x5e, 0x58, 0x5e, 0x58, 0x61, 0x88,
+    0x63, 0x01, 0x59, 0x46, 0x82, 0x5e, 0x03, 0x2d, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x01,
+    0x1d, 0x4c, 0x89, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8a, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x08, 0x36,
+    0x5e, 0x61, 0x63, 0x61, 0x58, 0x5e, 0x58, 0x61, 0x8a, 0x63, 0x00, 0x51, 0x82, 0x5e, 0x04, 0x1d,
+    0x2d, 0x63, 0x28, 0x60, 0xa6, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x85, 0x4b, 0x02, 0x51, 0x4b, 0x55,
+    0x8f, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x06, 0x36, 0x5e, 0x61, 0x63, 0x61, 0x5a, 0x55, 0x8c, 0x63,
+    0x09, 0x59, 0x5e, 0x3e, 0x18, 0x36, 0x2d, 0x63, 0x28, 0x1a, 0x46, 0xa5, 0x64, 0x9c, 0x64, 0x00,
+    0x1a, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x91, 0x4b, 0x09, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x28,
+    0x5e, 0x61, 0x63, 0x61, 0x8e, 0x63, 0x0b, 0x51, 0x17, 0x2d, 0x5a, 0x5e, 0x2d, 0x63, 0x28, 0x1e,
+    0x1d, 0x3e, 0x5d, 0xa3, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x91,
+    0x4b, 0x00, 0x28, 0x82, 0x4b, 0x03, 0x51, 0x36, 0x5e, 0x61, 0x90, 0x63, 0x0b, 0x39, 0x55, 0x5e,
+    0x5e, 0x45, 0x2d, 0x63, 0x28, 0x60, 0x29, 0x1a, 0x5d, 0xa3, 0x64, 0x9b, 0x64, 0x01, 0x57, 0x1d,
+    0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x00, 0x28, 0x83, 0x4b, 0x02, 0x36, 0x5a, 0x5e,
+    0x8e, 0x63, 0x0d, 0x53, 0x1a, 0x27, 0x5e, 0x5e, 0x2d, 0x3e, 0x5e, 0x63, 0x28, 0x60, 0x57, 0x1a,
+    0x4a, 0xa3, 0x64, 0x9c, 0x64, 0x00, 0x1d, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x92, 0x4b, 0x00,
+    0x28, 0x83, 0x4b, 0x02, 0x36, 0x5e, 0x5e, 0x82, 0x63, 0x00, 0x5b, 0x89, 0x63, 0x0e, 0x28, 0x1a,
+    0x53, 0x53, 0x3e, 0x36, 0x5a, 0x5e, 0x63, 0x63, 0x1d, 0x60, 0x64, 0x1a, 0x46, 0xa3, 0x64, 0x9b,
+    0x64, 0x01, 0x57, 0x1d, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x91, 0x4b, 0x00, 0x28, 0x83, 0x4b,
+    0x02, 0x36, 0x5e, 0x61, 0x8b, 0x63, 0x02, 0x38, 0x17, 0x3b, 0x82, 0x63, 0x01, 0x4f, 0x5b, 0x82,
+    0x63, 0x05, 0x51, 0x23, 0x64, 0x54, 0x1a, 0x4a, 0xa3, 0x64, 0x9b, 0x64, 0x01, 0x57, 0x1d, 0x84,
+    0x4b, 0x02, 0x51, 0x4b, 0x55, 0x90, 0x4b, 0x09, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x28, 0x5e, 0x61,
+    0x63, 0x61, 0x87, 0x63, 0x03, 0x47, 0x17, 0x39, 0x5f, 0x86, 0x63, 0x07, 0x59, 0x2d, 0x36, 0x63,
+    0x64, 0x44, 0x1a, 0x5d, 0x88, 0x64, 0x01, 0x54, 0x4a, 0x98, 0x64, 0x9c, 0x64, 0x02, 0x1d, 0x3e,
+    0x47, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x8f, 0x4b, 0x09, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x28,
+    0x5e, 0x61, 0x63, 0x61, 0x85, 0x63, 0x03, 0x51, 0x1a, 0x2e, 0x5a, 0x86, 0x63, 0x03, 0x59, 0x46,
+    0x1d, 0x4c, 0x82, 0x64, 0x01, 0x1d, 0x1d, 0x87, 0x64, 0x05, 0x5c, 0x1e, 0x18, 0x36, 0x2d, 0x4a,
+    0x96, 0x64, 0x9c, 0x64, 0x04, 0x1d, 0x3e, 0x36, 0x37, 0x47, 0x84, 0x4b, 0x02, 0x51, 0x4b, 0x55,
+    0x8c, 0x4b, 0x09, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x28, 0x5e, 0x61, 0x63, 0x61, 0x84, 0x63, 0x03,
+    0x28, 0x1d, 0x4c, 0x64, 0x86, 0x63, 0x02, 0x47, 0x1a, 0x46, 0x83, 0x64, 0x12, 0x54, 0x1d, 0x3f,
+    0x60, 0x64, 0x64, 0x54, 0x3f, 0x39, 0x39, 0x2f, 0x1d, 0x3d, 0x4f, 0x3d, 0x4f, 0x46, 0x2d, 0x5d,
+    0x94, 0x64, 0x9c, 0x64, 0x0b, 0x1d, 0x3e, 0x36, 0x37, 0x2e, 0x37, 0x47, 0x4b, 0x4b, 0x51, 0x4b,
+    0x55, 0x8d, 0x4b, 0x09, 0x28, 0x4b, 0x4b, 0x51, 0x4b, 0x28, 0x5e, 0x61, 0x63, 0x61, 0x83, 0x63,
+    0x01, 0x46, 0x4b, 0x87, 0x63, 0x0d, 0x5a, 0x2d, 0x14, 0x17, 0x5d, 0x64, 0x64, 0x39, 0x1d, 0x2d,
+    0x1a, 0x46, 0x57, 0x3f, 0x83, 0x1a, 0x0a, 0x1d, 0x28, 0x3d, 0x4f, 0x46, 0x3d, 0x3d, 0x5f, 0x63,
+    0x28, 0x3d, 0x93, 0x64, 0x9c, 0x64, 0x0c, 0x1d, 0x3e, 0x36, 0x37, 0x2e, 0x2e, 0x37, 0x38, 0x4b,
+    0x4b, 0x51, 0x4b, 0x55, 0x8c, 0x4b, 0x00, 0x28, 0x82, 0x4b, 0x03, 0x51, 0x36, 0x5e, 0x61, 0x83,
+    0x63, 0x00, 0x59, 0x88, 0x63, 0x09, 0x5e, 0x3e, 0x18, 0x28, 0x1a, 0x17, 0x5d, 0x4c, 0x1a, 0x50,
+    0x82, 0x5e, 0x06, 0x3e, 0x18, 0x1a, 0x1e, 0x47, 0x5d, 0x1d, 0x82, 0x5e, 0x02, 0x37, 0x37, 0x59,
+    0x83, 0x63, 0x02, 0x51, 0x1e, 0x57, 0x91, 0x64, 0x9c, 0x64, 0x0e, 0x17, 0x3b, 0x47, 0x37, 0x37,
+    0x2e, 0x37, 0x38, 0x2e, 0x37, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x85, 0x4b, 0x05, 0x38, 0x2e, 0x47,
+    0x4b, 0x4b, 0x28, 0x83, 0x4b, 0x07, 0x36, 0x5e, 0x61, 0x63, 0x61, 0x5a, 0x47, 0x4b, 0x86, 0x63,
+    0x18, 0x59, 0x50, 0x1d, 0x0d, 0x0d, 0x28, 0x3d, 0x1d, 0x17, 0x2d, 0x37, 0x37, 0x2e, 0x5f, 0x63,
+    0x61, 0x55, 0x2d, 0x39, 0x5f, 0x64, 0x1a, 0x4a, 0x5e, 0x61, 0x88, 0x63, 0x01, 0x2e, 0x37, 0x90,
+    0x64, 0x9c, 0x64, 0x10, 0x54, 0x14, 0x28, 0x4b, 0x4b, 0x2e, 0x37, 0x38, 0x2e, 0x2e, 0x37, 0x38,
+    0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x82, 0x4b, 0x12, 0x39, 0x39, 0x4b, 0x36, 0x28, 0x23, 0x39, 0x55,
+    0x4b, 0x4b, 0x51, 0x36, 0x5e, 0x61, 0x63, 0x63, 0x55, 0x4d, 0x59, 0x85, 0x63, 0x1b, 0x55, 0x2d,
+    0x15, 0x17, 0x1a, 0x1e, 0x15, 0x08, 0x28, 0x23, 0x39, 0x3c, 0x1d, 0x3e, 0x36, 0x37, 0x63, 0x63,
+    0x51, 0x4e, 0x1d, 0x4c, 0x1a, 0x46, 0x43, 0x55, 0x5e, 0x5e, 0x86, 0x63, 0x02, 0x59, 0x2d, 0x5c,
+    0x8f, 0x64, 0x9e, 0x64, 0x0b, 0x3f, 0x15, 0x45, 0x4b, 0x36, 0x28, 0x2e, 0x37, 0x38, 0x2e, 0x2e,
+    0x47, 0x85, 0x4b, 0x00, 0x36, 0x83, 0x4b, 0x02, 0x51, 0x4b, 0x55, 0x82, 0x4b, 0x07, 0x39, 0x5e,
+    0x5e, 0x63, 0x63, 0x49, 0x22, 0x53, 0x83, 0x63, 0x1e, 0x51, 0x45, 0x1a, 0x2f, 0x1a, 0x1e, 0x1a,
+    0x04, 0x11, 0x2e, 0x37, 0x28, 0x3d, 0x1d, 0x45, 0x58, 0x45, 0x36, 0x35, 0x4b, 0x63, 0x61, 0x55,
+    0x3e, 0x17, 0x3b, 0x47, 0x3f, 0x39, 0x5a, 0x55, 0x83, 0x63, 0x04, 0x59, 0x5e, 0x47, 0x1e, 0x57,
+    0x8f, 0x64, 0xa0, 0x64, 0x0b, 0x2f, 0x15, 0x45, 0x4b, 0x39, 0x2e, 0x37, 0x38, 0x2e, 0x2e, 0x37,
+    0x47, 0x82, 0x4b, 0x02, 0x51, 0x36, 0x47, 0x86, 0x4b, 0x09, 0x51, 0x4b, 0x28, 0x5e, 0x61, 0x63,
+    0x61, 0x3a, 0x4a, 0x64, 0x82, 0x63, 0x20, 0x4f, 0x1d, 0x28, 0x2f, 0x2f, 0x1d, 0x0b, 0x03, 0x1d,
+    0x3e, 0x36, 0x37, 0x2e, 0x2e, 0x4f, 0x3d, 0x28, 0x3d, 0x4f, 0x51, 0x45, 0x36, 0x5f, 0x63, 0x61,
+    0x55, 0x2d, 0x39, 0x3f, 0x39, 0x3f, 0x51, 0x55, 0x82, 0x5e, 0x04, 0x4e, 0x3f, 0x39, 0x1e, 0x57,
+    0x8f, 0x64, 0xa2, 0x64, 0x14, 0x1d, 0x17, 0x3b, 0x47, 0x3f, 0x2e, 0x37, 0x38, 0x2e, 0x2e, 0x37,
+    0x4b, 0x4b, 0x51, 0x36, 0x47, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x83, 0x4b, 0x02, 0x2e, 0x5e, 0x5e,
+    0x82, 0x63, 0x2d, 0x5b, 0x63, 0x63, 0x55, 0x2d, 0x1d, 0x3e, 0x2f, 0x2f, 0x15, 0x03, 0x18, 0x36,
+    0x2d, 0x4a, 0x3d, 0x1d, 0x3e, 0x36, 0x28, 0x27, 0x2d, 0x36, 0x34, 0x45, 0x45, 0x36, 0x35, 0x46,
+    0x63, 0x63, 0x51, 0x4e, 0x2e, 0x37, 0x4b, 0x3f, 0x39, 0x5a, 0x51, 0x3f, 0x39, 0x3f, 0x23, 0x15,
+    0x5d, 0x8f, 0x64, 0xa3, 0x64, 0x13, 0x56, 0x1d, 0x1d, 0x44, 0x47, 0x37, 0x2e, 0x37, 0x38, 0x2e,
+    0x2e, 0x37, 0x4b, 0x2e, 0x47, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x83, 0x4b, 0x02, 0x2e, 0x5e, 0x61,
+    0x83, 0x63, 0x2b, 0x5e, 0x3e, 0x1d, 0x29, 0x2f, 0x2f, 0x1a, 0x0a, 0x0f, 0x28, 0x27, 0x45, 0x36,
+    0x1a, 0x2e, 0x34, 0x1e, 0x1d, 0x3e, 0x36, 0x28, 0x45, 0x46, 0x1a, 0x2e, 0x4f, 0x3d, 0x28, 0x35,
+    0x4b, 0x63, 0x63, 0x51, 0x4e, 0x2e, 0x3f, 0x39, 0x3f, 0x3f, 0x39, 0x3f, 0x1a, 0x1a, 0x4a, 0x90,
+    0x64, 0xa5, 0x64, 0x11, 0x4c, 0x1a, 0x1d, 0x3f, 0x47, 0x37, 0x2e, 0x2e, 0x37, 0x38, 0x2e, 0x2e,
+    0x47, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x83, 0x4b, 0x02, 0x2e, 0x5e, 0x61, 0x82, 0x63, 0x2b, 0x4f,
+    0x1d, 0x23, 0x2f, 0x2f, 0x1e, 0x10, 0x0f, 0x1d, 0x3e, 0x2f, 0x46, 0x1a, 0x28, 0x27, 0x45, 0x1d,
+    0x3e, 0x47, 0x1d, 0x28, 0x2f, 0x28, 0x27, 0x45, 0x46, 0x1a, 0x28, 0x4f, 0x28, 0x1a, 0x63, 0x63,
+    0x51, 0x5e, 0x28, 0x1a, 0x23, 0x3f, 0x39, 0x1e, 0x15, 0x45, 0x60, 0x91, 0x64, 0xa7, 0x64, 0x0a,
+    0x54, 0x14, 0x28, 0x4b, 0x3f, 0x29, 0x2e, 0x37, 0x38, 0x2e, 0x47, 0x85, 0x4b, 0x32, 0x37, 0x47,
+    0x4b, 0x36, 0x5a, 0x5e, 0x5e, 0x61, 0x28, 0x1a, 0x23, 0x2f, 0x2f, 0x15, 0x11, 0x17, 0x2d, 0x37,
+    0x3c, 0x1d, 0x1a, 0x2e, 0x4f, 0x35, 0x1d, 0x4f, 0x27, 0x2d, 0x36, 0x34, 0x28, 0x3d, 0x1d, 0x1d,
+    0x3e, 0x47, 0x1d, 0x15, 0x17, 0x4b, 0x63, 0x61, 0x55, 0x4b, 0x1a, 0x2e, 0x17, 0x1a, 0x15, 0x23,
+    0x5c, 0x93, 0x64, 0xa9, 0x64, 0x07, 0x3f, 0x15, 0x2e, 0x47, 0x4b, 0x2e, 0x37, 0x38, 0x82, 0x4b,
+    0x34, 0x51, 0x4b, 0x55, 0x4b, 0x28, 0x1e, 0x2d, 0x1d, 0x5e, 0x5e, 0x3e, 0x1d, 0x29, 0x2f, 0x2f,
+    0x1a, 0x15, 0x17, 0x1d, 0x28, 0x2f, 0x28, 0x1d, 0x28, 0x4f, 0x28, 0x1d, 0x3e, 0x36, 0x28, 0x27,
+    0x2d, 0x36, 0x1d, 0x4f, 0x3d, 0x28, 0x3d, 0x1d, 0x1d, 0x15, 0x45, 0x60, 0x61, 0x55, 0x4b, 0x36,
+    0x1e, 0x17, 0x5d, 0x60, 0x4a, 0x54, 0x95, 0x64, 0xab, 0x64, 0x06, 0x2f, 0x15, 0x38, 0x4b, 0x39,
+    0x2e, 0x47, 0x85, 0x4b, 0x2e, 0x37, 0x2f, 0x2f, 0x1e, 0x1d, 0x1d, 0x23, 0x2f, 0x2f, 0x1d, 0x11,
+    0x17, 0x1a, 0x2e, 0x34, 0x4f, 0x28, 0x1d, 0x4f, 0x3d, 0x1d, 0x28, 0x2f, 0x28, 0x1d, 0x4f, 0x3d,
+    0x1d, 0x46, 0x2d, 0x1a, 0x2e, 0x34, 0x28, 0x18, 0x2e, 0x5a, 0x63, 0x5e, 0x5e, 0x45, 0x23, 0x27,
+    0x2e, 0x17, 0x5d, 0x60, 0x97, 0x64, 0x92, 0x64, 0x00, 0x60, 0x99, 0x64, 0x0b, 0x23, 0x15, 0x39,
+    0x2e, 0x47, 0x4b, 0x4b, 0x51, 0x4b, 0x55, 0x4b, 0x28, 0x86, 0x2f, 0x24, 0x15, 0x1a, 0x1a, 0x28,
+    0x27, 0x4f, 0x28, 0x1d, 0x4f, 0x3d, 0x1d, 0x28, 0x27, 0x45, 0x1d, 0x45, 0x36, 0x1a, 0x45, 0x36,
+    0x1a, 0x45, 0x4f, 0x3d, 0x17, 0x1a, 0x47, 0x63, 0x63, 0x51, 0x4e, 0x2e, 0x1d, 0x28, 0x1d, 0x1d,
+    0x57, 0x99, 0x64, 0xae, 0x64, 0x03, 0x57, 0x1e, 0x10, 0x38, 0x82, 0x4b, 0x02, 0x51, 0x4b, 0x55,
+    0x85, 0x2f, 0x24, 0x1a, 0x15, 0x1d, 0x1d, 0x23, 0x45, 0x36, 0x1a, 0x45, 0x34, 0x1e, 0x1d, 0x45,
+    0x46, 0x27, 0x2d, 0x46, 0x1a, 0x28, 0x34, 0x1e, 0x28, 0x3d, 0x4f, 0x1d, 0x17, 0x37, 0x59, 0x61,
+    0x55, 0x4b, 0x3f, 0x29, 0x27, 0x2d, 0x1a, 0x46, 0x9b, 0x64, 0x8d, 0x64, 0x00, 0x60, 0xa1, 0x64,
+    0x03, 0x57, 0x1a, 0x1e, 0x47, 0x83, 0x4b, 0x83, 0x2f, 0x25, 0x1e, 0x17, 0x1e, 0x1d, 0x28, 0x3d,
+    0x3d, 0x1d, 0x1d, 0x3e, 0x47, 0x28, 0x3d, 0x3d, 0x1a, 0x2e, 0x34, 0x28, 0x28, 0x27, 0x45, 0x1d,
+    0x45, 0x4f, 0x28, 0x18, 0x1d, 0x4c, 0x5e, 0x5e, 0x55, 0x4b, 0x23, 0x27, 0x2e, 0x1a, 0x2e, 0x5d,
+    0x9c, 0x64, 0x91, 0x64, 0x00, 0x60, 0x9f, 0x64, 0x2d, 0x44, 0x15, 0x23, 0x4b, 0x4b, 0x51, 0x36,
+    0x2f, 0x2f, 0x15, 0x1a, 0x1d, 0x17, 0x37, 0x2d, 0x1e, 0x27, 0x27, 0x46, 0x2d, 0x1a, 0x45, 0x1a,
+    0x2f, 0x34, 0x1e, 0x1d, 0x45, 0x4f, 0x3d, 0x28, 0x4f, 0x3d, 0x17, 0x17, 0x3b, 0x63, 0x61, 0x55,
+    0x4b, 0x3f, 0x1d, 0x28, 0x1d, 0x1d, 0x4c, 0x9e, 0x64, 0x8b, 0x64, 0x00, 0x60, 0xa7, 0x64, 0x0a,
+    0x3f, 0x15, 0x2e, 0x4b, 0x36, 0x17, 0x1a, 0x23, 0x1a, 0x2e, 0x34, 0x82, 0x28, 0x1b, 0x4b, 0x46,
+    0x1a, 0x28, 0x34, 0x27, 0x1d, 0x4f, 0x3d, 0x28, 0x4b, 0x27, 0x2d, 0x36, 0x46, 0x1a, 0x15, 0x23,
+    0x5b, 0x63, 0x5e, 0x4e, 0x3f, 0x1e, 0x1d, 0x28, 0x1a, 0x46, 0xa0, 0x64, 0xb6, 0x64, 0x26, 0x2f,
+    0x10, 0x15, 0x23, 0x1d, 0x4f, 0x1d, 0x4f, 0x3d, 0x28, 0x4f, 0x3d, 0x1d, 0x28, 0x27, 0x45, 0x1a,
+    0x2e, 0x34, 0x28, 0x28, 0x34, 0x1e, 0x28, 0x4f, 0x3d, 0x17, 0x17, 0x51, 0x63, 0x5e, 0x5e, 0x45,
+    0x23, 0x1d, 0x28, 0x1d, 0x23, 0x5c, 0xa1, 0x64, 0x82, 0x64, 0x00, 0x60, 0xb4, 0x64, 0x22, 0x2f,
+    0x28, 0x5e, 0x5b, 0x17, 0x13, 0x1d, 0x4f, 0x3d, 0x28, 0x34, 0x45, 0x1d, 0x4f, 0x3d, 0x28, 0x34,
+    0x34, 0x1e, 0x1d, 0x45, 0x45, 0x1a, 0x17, 0x39, 0x5f, 0x63, 0x61, 0x55, 0x39, 0x1d, 0x2d, 0x28,
+    0x1a, 0x53, 0x9e, 0x64, 0x00, 0x60, 0x83, 0x64, 0x89, 0x64, 0x00, 0x60, 0xac, 0x64, 0x02, 0x1e,
+    0x4e, 0x5e, 0x82, 0x63, 0x1c, 0x28, 0x17, 0x13, 0x28, 0x4b, 0x1d, 0x3e, 0x36, 0x28, 0x27, 0x28,
+    0x3d, 0x1d, 0x28, 0x3d, 0x18, 0x15, 0x23, 0x5b, 0x61, 0x55, 0x4b, 0x3f, 0x23, 0x27, 0x2e, 0x1a,
+    0x39, 0x5f, 0xa4, 0x64, 0xb6, 0x64, 0x02, 0x3f, 0x39, 0x5a, 0x82, 0x5e, 0x1b, 0x63, 0x63, 0x4b,
+    0x1d, 0x17, 0x13, 0x45, 0x46, 0x27, 0x27, 0x46, 0x28, 0x3d, 0x4f, 0x1d, 0x15, 0x1d, 0x4c, 0x5e,
+    0x5e, 0x55, 0x47, 0x37, 0x1d, 0x28, 0x1d, 0x23, 0x57, 0x9a, 0x64, 0x00, 0x60, 0x8a, 0x64, 0xb6,
+    0x64, 0x82, 0x2f, 0x03, 0x5a, 0x55, 0x5e, 0x5e, 0x82, 0x63, 0x15, 0x3f, 0x1a, 0x14, 0x17, 0x4f,
+    0x3d, 0x1d, 0x46, 0x27, 0x1d, 0x15, 0x45, 0x60, 0x61, 0x5e, 0x4e, 0x3f, 0x1e, 0x28, 0x27, 0x1a,
+    0x4a, 0xa8, 0x64, 0xb6, 0x64, 0x04, 0x2f, 0x1d, 0x1d, 0x44, 0x47, 0x82, 0x5e, 0x82, 0x63, 0x13,
+    0x5b, 0x3e, 0x14, 0x17, 0x28, 0x4b, 0x27, 0x15, 0x23, 0x5b, 0x61, 0x5e, 0x5e, 0x45, 0x23, 0x1d,
+    0x2e, 0x17, 0x2f, 0x57, 0xa9, 0x64, 0xb6, 0x64, 0x06, 0x4c, 0x17, 0x2d, 0x1d, 0x28, 0x4f, 0x55,
+    0x83, 0x5e, 0x11, 0x63, 0x63, 0x51, 0x1d, 0x17, 0x17, 0x1a, 0x47, 0x63, 0x63, 0x51, 0x4e, 0x2e,
+    0x1d, 0x28, 0x27, 0x1a, 0x54, 0xab, 0x64, 0xb7, 0x64, 0x06, 0x54, 0x1d, 0x28, 0x27, 0x1a, 0x39,
+    0x55, 0x83, 0x5e, 0x82, 0x63, 0x0c, 0x3f, 0x39, 0x5a, 0x5e, 0x5e, 0x4e, 0x3f, 0x1e, 0x28, 0x28,
+    0x1a, 0x44, 0x60, 0xac, 0x64, 0xb9, 0x64, 0x06, 0x39, 0x1d, 0x2d, 0x1d, 0x28, 0x43, 0x55, 0x82,
+    0x5e, 0x82, 0x63, 0x09, 0x5b, 0x5e, 0x5e, 0x45, 0x23, 0x1d, 0x2e, 0x1d, 0x28, 0x5d, 0xae, 0x64,
+    0xba, 0x64, 0x06, 0x54, 0x1d, 0x1d, 0x23, 0x1d, 0x3f, 0x47, 0x85, 0x5e, 0x06, 0x4b, 0x36, 0x28,
+    0x2e, 0x28, 0x1a, 0x53, 0xb0, 0x64, 0xbc, 0x64, 0x06, 0x44, 0x1d, 0x28, 0x1a, 0x23, 0x2f, 0x55,
+    0x82, 0x5e, 0x06, 0x3f, 0x29, 0x1d, 0x28, 0x1d, 0x3f, 0x60, 0xb1, 0x64, 0xbe, 0x64, 0x0c, 0x1d,
+    0x1d, 0x28, 0x1d, 0x23, 0x43, 0x43, 0x2f, 0x1d, 0x3d, 0x1d, 0x28, 0x5d, 0xb3, 0x64, 0xbf, 0x64,
+    0x09, 0x4a, 0x1a, 0x27, 0x36, 0x1e, 0x1d, 0x28, 0x28, 0x1a, 0x53, 0xb5, 0x64, 0xc1, 0x64, 0x06,
+    0x2f, 0x1a, 0x2e, 0x34, 0x1a, 0x2e, 0x5d, 0xb6, 0x64, 0x83, 0x64, 0x00, 0x60, 0xbd, 0x64, 0x03,
+    0x4c, 0x28, 0x2f, 0x57, 0xb8, 0x64, 0xde, 0x64, 0x00, 0x60, 0x9f, 0x64, 0xab, 0x64, 0x00, 0x60,
+    0xc6, 0x64, 0x00, 0x60, 0x8a, 0x64, 0xde, 0x64, 0x00, 0x60, 0x9f, 0x64, 0xc6, 0x64, 0x00, 0x60,
+    0xb7, 0x64, 0xdf, 0x64, 0x00, 0x60, 0x9e, 0x64, 0xff, 0x64, 0xe1, 0x64, 0x00, 0x60, 0x9c, 0x64,
+    0xa9, 0x64, 0x00, 0x60, 0xd4, 0x64, 0xe4, 0x64, 0x00, 0x60, 0x99, 0x64, 0xbc, 0x64, 0x00, 0x60,
+    0xc1, 0x64, 0xe8, 0x64, 0x00, 0x60, 0x95, 0x64, 0x8d, 0x64, 0x00, 0x60, 0xe3, 0x64, 0x00, 0x60,
+    0x8b, 0x64, 0xed, 0x64, 0x00, 0x60, 0x90, 0x64,
+};
+
+// 77 colors, 5917 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_2[] = {
+    0x2124, 0x2943, 0x2946, 0x3186, 0x3207, 0x39a4, 0x4226, 0x4248, 0x4a89, 0x5247, 0x5288, 0x52cb,
+    0x62c8, 0x62ec, 0x630b, 0x6b07, 0x6b8e, 0x7244, 0x7349, 0x8389, 0x83ce, 0x8acc, 0x8be0, 0x8c4f,
+    0x8c92, 0x9cf3, 0xa4cf, 0xa4d1, 0xa4d4, 0xad31, 0xad32, 0xad55, 0xadb5, 0xadb7, 0xb531, 0xb532,
+    0xb533, 0xb572, 0xb573, 0xb574, 0xb5b6, 0xbb02, 0xbd72, 0xbd74, 0xbdb3, 0xbdf7, 0xc5f7, 0xc638,
+    0xcdd4, 0xce35, 0xce57, 0xceba, 0xd2e7, 0xd679, 0xd6b8, 0xd6b9, 0xd6ba, 0xde35, 0xde36, 0xdeb7,
+    0xdeb8, 0xdeb9, 0xdeba, 0xdef9, 0xdefa, 0xdefb, 0xe6f8, 0xe6fb, 0xe73c, 0xeefa, 0xef39, 0xef3b,
+    0xef3c, 0xef7c, 0xef7d, 0xf7be, 0xffff,
+};
+static constexpr uint16_t mac_row_2[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 81, 94, 113,
+    128, 143, 157, 175, 200, 220, 238, 258, 283, 307, 326, 360, 393, 426, 460, 498,
+    544, 579, 630, 681, 729, 787, 847, 904, 965, 1020, 1082, 1141, 1201, 1257, 1315, 1370,
+    1429, 1483, 1540, 1594, 1650, 1708, 1762, 1816, 1868, 1920, 1973, 2023, 2076, 2132, 2188, 2244,
+    2300, 2357, 2413, 2475, 2536, 2598, 2661, 2726, 2790, 2853, 2919, 2985, 3050, 3116, 3180, 3249,
+    3323, 3403, 3483, 3565, 3649, 3733, 3817, 3901, 3987, 4069, 4158, 4247, 4336, 4419, 4502, 4580,
+    4657, 4726, 4793, 4860, 4921, 4976, 5036, 5089, 5137, 5178, 5217, 5253, 5284, 5312, 5337, 5360,
+    5380, 5397, 5412, 5425, 5431, 5441, 5447, 5453, 5459, 5461, 5467, 5473, 5479, 5485, 5491, 5501,
+};
+static constexpr uint8_t mac_code_2[] = {
+    0xff, 0x4c, 0xd8, 0x4c, 0x00, 0x4b, 0xa5, 0x4c, 0x86, 0x4c, 0x00, 0x4b, 0xc9, 0x4c, 0x00, 0x4b,
+    0xac, 0x4c, 0xbf, 0x4c, 0x00, 0x4b, 0xbe, 0x4c, 0xff, 0x4c, 0xa7, 0x4c, 0x00, 0x4b, 0xd6, 0x4c,
+    0x9d, 0x4c, 0x00, 0x4b, 0xcb, 0x4c, 0x00, 0x4b, 0x93, 0x4c, 0x90, 0x4c, 0x00, 0x4b, 0xe8, 0x4c,
+    0x00, 0x4b, 0x83, 0x4c, 0xff, 0x4c, 0xe5, 0x4c, 0x00, 0x4b, 0x98, 0x4c, 0xb8, 0x4c, 0x00, 0x4b,
+    0xc5, 0x4c, 0xd1, 0x4c, 0x00, 0x4b, 0xac, 0x4c, 0xc0, 0x4c, 0x03, 0x44, 0x27, 0x1f, 0x38, 0xba,
+    0x4c, 0xbf, 0x4c, 0x07, 0x1f, 0x17, 0x31, 0x3a, 0x1d, 0x17, 0x35, 0x4b, 0xb7, 0x4c, 0x87, 0x4c,
+    0x00, 0x4b, 0xb4, 0x4c, 0x02, 0x2f, 0x17, 0x31, 0x84, 0x3b, 0x03, 0x26, 0x17, 0x35, 0x4b, 0xb5,
+    0x4c, 0xbb, 0x4c, 0x02, 0x38, 0x17, 0x31, 0x88, 0x3b, 0x03, 0x2c, 0x17, 0x31, 0x4b, 0xb3, 0x4c,
+    0xb9, 0x4c, 0x02, 0x44, 0x18, 0x1d, 0x8c, 0x3b, 0x03, 0x26, 0x17, 0x1f, 0x4a, 0xb1, 0x4c, 0xb8,
+    0x4c, 0x02, 0x1f, 0x17, 0x3a, 0x90, 0x3b, 0x02, 0x17, 0x1f, 0x44, 0xaf, 0x4c, 0xb6, 0x4c, 0x02,
+    0x2d, 0x17, 0x31, 0x94, 0x3b, 0x02, 0x17, 0x1f, 0x44, 0xa8, 0x4c, 0x00, 0x4b, 0x83, 0x4c, 0x8b,
+    0x4c, 0x00, 0x4b, 0xa7, 0x4c, 0x02, 0x37, 0x17, 0x31, 0x95, 0x3b, 0x05, 0x31, 0x3a, 0x31, 0x17,
+    0x31, 0x4b, 0xa8, 0x4c, 0x02, 0x4b, 0x4c, 0x4c, 0xb2, 0x4c, 0x02, 0x44, 0x18, 0x1d, 0x94, 0x3b,
+    0x03, 0x31, 0x30, 0x31, 0x3a, 0x82, 0x3b, 0x01, 0x2c, 0x1c, 0xab, 0x4c, 0xb1, 0x4c, 0x02, 0x1f,
+    0x17, 0x3a, 0x94, 0x3b, 0x00, 0x31, 0x85, 0x3b, 0x02, 0x47, 0x47, 0x18, 0xab, 0x4c, 0xaf, 0x4c,
+    0x03, 0x2d, 0x17, 0x31, 0x3a, 0x94, 0x3b, 0x01, 0x31, 0x3a, 0x84, 0x3b, 0x82, 0x47, 0x00, 0x18,
+    0xab, 0x4c, 0xad, 0x4c, 0x02, 0x35, 0x14, 0x2c, 0x94, 0x3b, 0x02, 0x31, 0x31, 0x3a, 0x82, 0x3b,
+    0x00, 0x42, 0x82, 0x47, 0x03, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0xab, 0x4c, 0x02, 0x38, 0x17,
+    0x1f, 0x95, 0x3b, 0x01, 0x31, 0x31, 0x83, 0x3b, 0x82, 0x47, 0x05, 0x45, 0x3d, 0x45, 0x47, 0x47,
+    0x18, 0xab, 0x4c, 0xaa, 0x4c, 0x01, 0x19, 0x1a, 0x9c, 0x3b, 0x82, 0x47, 0x06, 0x45, 0x3d, 0x3d,
+    0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0xa8, 0x4c, 0x02, 0x28, 0x17, 0x31, 0x94, 0x3b, 0x01, 0x31,
+    0x3a, 0x82, 0x3b, 0x01, 0x42, 0x45, 0x82, 0x47, 0x08, 0x31, 0x17, 0x1a, 0x3b, 0x3d, 0x45, 0x47,
+    0x47, 0x18, 0xa2, 0x4c, 0x00, 0x4b, 0x87, 0x4c, 0xa6, 0x4c, 0x03, 0x35, 0x14, 0x30, 0x31, 0x90,
+    0x3b, 0x00, 0x31, 0x82, 0x3b, 0x00, 0x2c, 0x84, 0x3b, 0x82, 0x47, 0x02, 0x45, 0x1b, 0x22, 0x82,
+    0x2a, 0x04, 0x32, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0xa4, 0x4c, 0x02, 0x41, 0x17, 0x1f, 0x91,
+    0x3b, 0x00, 0x31, 0x82, 0x3b, 0x00, 0x26, 0x84, 0x3b, 0x83, 0x47, 0x0b, 0x1e, 0x1b, 0x22, 0x2a,
+    0x2a, 0x32, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0xa3, 0x4c, 0x01, 0x19, 0x1a, 0x90,
+    0x3b, 0x00, 0x31, 0x84, 0x3b, 0x00, 0x2c, 0x84, 0x3b, 0x82, 0x47, 0x05, 0x2b, 0x1a, 0x2a, 0x2a,
+    0x2c, 0x3b, 0x82, 0x39, 0x04, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0xa1, 0x4c, 0x03, 0x28,
+    0x17, 0x31, 0x3a, 0x82, 0x3b, 0x00, 0x42, 0x90, 0x3b, 0x00, 0x31, 0x84, 0x3b, 0x82, 0x47, 0x01,
+    0x32, 0x1a, 0x82, 0x2a, 0x00, 0x32, 0x82, 0x39, 0x06, 0x1b, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18,
+    0xab, 0x4c, 0x86, 0x4c, 0x00, 0x4b, 0x97, 0x4c, 0x03, 0x2f, 0x17, 0x30, 0x31, 0x91, 0x3b, 0x04,
+    0x31, 0x3b, 0x3b, 0x31, 0x3a, 0x82, 0x3b, 0x06, 0x42, 0x45, 0x47, 0x47, 0x3c, 0x1b, 0x22, 0x82,
+    0x2a, 0x02, 0x32, 0x39, 0x39, 0x82, 0x1a, 0x05, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c,
+    0x9e, 0x4c, 0x01, 0x1f, 0x1d, 0x92, 0x3b, 0x00, 0x31, 0x87, 0x3b, 0x83, 0x47, 0x12, 0x2b, 0x1a,
+    0x2a, 0x2a, 0x2c, 0x3b, 0x39, 0x39, 0x1b, 0x06, 0x12, 0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47,
+    0x18, 0xab, 0x4c, 0x02, 0x4c, 0x4c, 0x4b, 0x9a, 0x4c, 0x04, 0x44, 0x14, 0x2c, 0x31, 0x3a, 0x82,
+    0x3b, 0x00, 0x42, 0x8e, 0x3b, 0x01, 0x31, 0x3a, 0x82, 0x3b, 0x18, 0x42, 0x45, 0x47, 0x47, 0x31,
+    0x1a, 0x2a, 0x2a, 0x2c, 0x30, 0x31, 0x3b, 0x2a, 0x0c, 0x05, 0x05, 0x0c, 0x1a, 0x1a, 0x39, 0x1b,
+    0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x83, 0x4c, 0x00, 0x4b, 0x98, 0x4c, 0x01, 0x19, 0x1a, 0x82,
+    0x23, 0x01, 0x31, 0x3a, 0x82, 0x3b, 0x00, 0x42, 0x8a, 0x3b, 0x00, 0x31, 0x84, 0x3b, 0x82, 0x47,
+    0x02, 0x32, 0x1a, 0x22, 0x82, 0x2a, 0x03, 0x32, 0x39, 0x39, 0x14, 0x83, 0x05, 0x08, 0x0a, 0x1a,
+    0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x02, 0x4c, 0x4c, 0x4b, 0x99, 0x4c, 0x01,
+    0x44, 0x14, 0x84, 0x23, 0x02, 0x2c, 0x30, 0x31, 0x8a, 0x3b, 0x00, 0x31, 0x84, 0x3b, 0x83, 0x47,
+    0x04, 0x1e, 0x1b, 0x22, 0x2a, 0x2a, 0x82, 0x39, 0x01, 0x1b, 0x06, 0x84, 0x05, 0x08, 0x0a, 0x1a,
+    0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x9c, 0x4c, 0x01, 0x19, 0x1a, 0x83, 0x23,
+    0x00, 0x2c, 0x82, 0x23, 0x02, 0x2c, 0x31, 0x3a, 0x82, 0x3b, 0x04, 0x42, 0x3b, 0x3b, 0x31, 0x3a,
+    0x82, 0x3b, 0x01, 0x42, 0x45, 0x82, 0x47, 0x09, 0x31, 0x1a, 0x2a, 0x2a, 0x2c, 0x31, 0x3a, 0x31,
+    0x22, 0x0a, 0x83, 0x05, 0x00, 0x04, 0x82, 0x07, 0x07, 0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47,
+    0x18, 0xab, 0x4c, 0x86, 0x4c, 0x00, 0x4b, 0x93, 0x4c, 0x01, 0x44, 0x14, 0x83, 0x23, 0x00, 0x2c,
+    0x83, 0x23, 0x08, 0x2c, 0x23, 0x23, 0x31, 0x3a, 0x3b, 0x3b, 0x31, 0x3a, 0x82, 0x3b, 0x01, 0x42,
+    0x45, 0x82, 0x47, 0x09, 0x32, 0x1a, 0x22, 0x2a, 0x2a, 0x32, 0x39, 0x39, 0x30, 0x12, 0x83, 0x05,
+    0x00, 0x04, 0x84, 0x07, 0x07, 0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x84,
+    0x4c, 0x00, 0x4b, 0x95, 0x4c, 0x01, 0x19, 0x1d, 0x82, 0x23, 0x00, 0x2c, 0x84, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x03, 0x2c, 0x30, 0x30, 0x31, 0x82, 0x3b, 0x00, 0x42, 0x82, 0x47, 0x04, 0x3c, 0x1b,
+    0x22, 0x2a, 0x2a, 0x83, 0x39, 0x00, 0x17, 0x83, 0x05, 0x00, 0x04, 0x86, 0x07, 0x07, 0x1a, 0x17,
+    0x31, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x87, 0x4c, 0x00, 0x4b, 0x91, 0x4c, 0x01, 0x44,
+    0x14, 0x84, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x02,
+    0x2c, 0x31, 0x3a, 0x82, 0x47, 0x05, 0x45, 0x1b, 0x1b, 0x22, 0x2a, 0x2a, 0x82, 0x39, 0x01, 0x1b,
+    0x06, 0x82, 0x05, 0x03, 0x0a, 0x07, 0x18, 0x0e, 0x85, 0x07, 0x07, 0x1a, 0x17, 0x31, 0x1b, 0x45,
+    0x47, 0x47, 0x18, 0xab, 0x4c, 0x9a, 0x4c, 0x01, 0x19, 0x1a, 0x84, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x83, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x0d, 0x2c, 0x31, 0x47, 0x47, 0x2b, 0x1a, 0x2a,
+    0x2a, 0x2c, 0x31, 0x39, 0x39, 0x1b, 0x12, 0x82, 0x05, 0x04, 0x0a, 0x07, 0x07, 0x28, 0x35, 0x86,
+    0x07, 0x07, 0x1a, 0x17, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x02, 0x4c, 0x4c, 0x4b,
+    0x96, 0x4c, 0x02, 0x44, 0x14, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x84, 0x23,
+    0x00, 0x2c, 0x82, 0x23, 0x07, 0x2c, 0x23, 0x45, 0x47, 0x1b, 0x22, 0x2a, 0x2a, 0x82, 0x39, 0x01,
+    0x30, 0x14, 0x82, 0x05, 0x06, 0x0a, 0x07, 0x07, 0x18, 0x35, 0x2f, 0x33, 0x85, 0x07, 0x08, 0x09,
+    0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x02, 0x4c, 0x4c, 0x4b, 0x96, 0x4c,
+    0x01, 0x19, 0x1d, 0x83, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x85, 0x23, 0x00, 0x2c, 0x82,
+    0x23, 0x0c, 0x2c, 0x31, 0x28, 0x2a, 0x2a, 0x2c, 0x31, 0x39, 0x39, 0x1b, 0x06, 0x05, 0x05, 0x82,
+    0x07, 0x05, 0x0e, 0x2f, 0x33, 0x44, 0x4c, 0x35, 0x86, 0x07, 0x07, 0x1a, 0x1a, 0x39, 0x1b, 0x45,
+    0x47, 0x47, 0x18, 0xab, 0x4c, 0x82, 0x4c, 0x00, 0x4b, 0x94, 0x4c, 0x02, 0x44, 0x14, 0x2c, 0x83,
+    0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x14, 0x45, 0x27,
+    0x1f, 0x2a, 0x2a, 0x32, 0x2a, 0x0c, 0x05, 0x05, 0x0a, 0x07, 0x07, 0x10, 0x20, 0x35, 0x2f, 0x4b,
+    0x4c, 0x4a, 0x35, 0x85, 0x07, 0x08, 0x0c, 0x1a, 0x17, 0x31, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab,
+    0x4c, 0x82, 0x4c, 0x00, 0x4b, 0x94, 0x4c, 0x01, 0x19, 0x1a, 0x85, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x87, 0x23, 0x07, 0x2c, 0x23, 0x45, 0x27, 0x2a, 0x2a, 0x32, 0x2a, 0x83, 0x05, 0x0a,
+    0x04, 0x07, 0x07, 0x35, 0x2f, 0x4b, 0x4b, 0x41, 0x4b, 0x4c, 0x35, 0x85, 0x07, 0x08, 0x0e, 0x1a,
+    0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x82, 0x4c, 0x00, 0x4b, 0x93, 0x4c, 0x01,
+    0x44, 0x14, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x88, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x08, 0x2c, 0x31, 0x28, 0x2a, 0x2a, 0x32, 0x2a, 0x05, 0x05, 0x84, 0x07, 0x07, 0x35, 0x2f, 0x4b,
+    0x44, 0x41, 0x4b, 0x4a, 0x35, 0x85, 0x07, 0x08, 0x12, 0x1a, 0x17, 0x31, 0x1b, 0x45, 0x47, 0x47,
+    0x18, 0xab, 0x4c, 0x82, 0x4c, 0x00, 0x4b, 0x93, 0x4c, 0x01, 0x19, 0x1a, 0x86, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x09, 0x1b, 0x22, 0x2a, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a,
+    0x05, 0x85, 0x07, 0x07, 0x35, 0x38, 0x4c, 0x44, 0x41, 0x4b, 0x41, 0x41, 0x85, 0x07, 0x08, 0x12,
+    0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x89, 0x4c, 0x00, 0x4b, 0x8c, 0x4c,
+    0x00, 0x12, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x82, 0x23,
+    0x00, 0x2c, 0x82, 0x23, 0x06, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x04, 0x85, 0x07, 0x07, 0x35,
+    0x38, 0x4b, 0x41, 0x35, 0x2f, 0x4b, 0x44, 0x85, 0x07, 0x08, 0x14, 0x1a, 0x1a, 0x39, 0x1b, 0x45,
+    0x47, 0x47, 0x18, 0xab, 0x4c, 0x97, 0x4c, 0x00, 0x13, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00,
+    0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x08, 0x1b, 0x22, 0x2a, 0x45, 0x27, 0x1f, 0x2a, 0x31,
+    0x2a, 0x85, 0x07, 0x08, 0x09, 0x35, 0x2f, 0x4b, 0x35, 0x4b, 0x44, 0x41, 0x44, 0x85, 0x07, 0x08,
+    0x14, 0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x8a, 0x4c, 0x00, 0x4b, 0x8b,
+    0x4c, 0x00, 0x13, 0x83, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x84,
+    0x23, 0x07, 0x1b, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a, 0x04, 0x85, 0x07, 0x08, 0x35, 0x2f, 0x44,
+    0x4c, 0x4b, 0x41, 0x4b, 0x2f, 0x10, 0x84, 0x07, 0x08, 0x17, 0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47,
+    0x47, 0x18, 0xab, 0x4c, 0x8a, 0x4c, 0x00, 0x4b, 0x8b, 0x4c, 0x00, 0x13, 0x84, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x84, 0x23, 0x05, 0x45, 0x27, 0x2a, 0x2a, 0x31,
+    0x2a, 0x86, 0x07, 0x00, 0x35, 0x83, 0x4c, 0x03, 0x41, 0x38, 0x35, 0x14, 0x84, 0x07, 0x08, 0x17,
+    0x1a, 0x1a, 0x39, 0x1b, 0x45, 0x47, 0x47, 0x18, 0xab, 0x4c, 0x8f, 0x4c, 0x00, 0x4b, 0x86, 0x4c,
+    0x00, 0x13, 0x85, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23,
+    0x05, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a, 0x85, 0x07, 0x08, 0x09, 0x35, 0x44, 0x4c, 0x4b, 0x35,
+    0x4b, 0x2d, 0x0b, 0x84, 0x07, 0x09, 0x05, 0x1d, 0x17, 0x17, 0x31, 0x1b, 0x45, 0x32, 0x32, 0x18,
+    0xab, 0x4c, 0x85, 0x4c, 0x00, 0x4b, 0x90, 0x4c, 0x00, 0x13, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x09, 0x1b, 0x22, 0x2a, 0x45, 0x27, 0x2a, 0x2a,
+    0x32, 0x2a, 0x05, 0x85, 0x07, 0x05, 0x35, 0x4c, 0x35, 0x41, 0x38, 0x10, 0x85, 0x07, 0x0a, 0x05,
+    0x17, 0x31, 0x30, 0x1d, 0x3b, 0x1b, 0x45, 0x31, 0x3a, 0x18, 0xab, 0x4c, 0x97, 0x4c, 0x00, 0x13,
+    0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x08, 0x1b,
+    0x23, 0x23, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x85, 0x07, 0x04, 0x09, 0x28, 0x35, 0x4a, 0x19,
+    0x85, 0x07, 0x02, 0x05, 0x07, 0x23, 0x82, 0x3b, 0x06, 0x2c, 0x39, 0x1b, 0x39, 0x29, 0x28, 0x17,
+    0xab, 0x4c, 0x96, 0x4c, 0x01, 0x44, 0x14, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86,
+    0x23, 0x00, 0x1b, 0x83, 0x23, 0x08, 0x1b, 0x23, 0x23, 0x3b, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x86,
+    0x07, 0x02, 0x35, 0x2f, 0x0b, 0x85, 0x07, 0x03, 0x05, 0x0a, 0x30, 0x31, 0x82, 0x3b, 0x06, 0x30,
+    0x31, 0x26, 0x32, 0x21, 0x31, 0x2a, 0xab, 0x4c, 0x96, 0x4c, 0x01, 0x44, 0x14, 0x83, 0x23, 0x00,
+    0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x07, 0x1b, 0x23, 0x45, 0x27,
+    0x2a, 0x2a, 0x31, 0x2a, 0x86, 0x07, 0x00, 0x14, 0x85, 0x07, 0x03, 0x05, 0x05, 0x14, 0x2c, 0x82,
+    0x3b, 0x07, 0x2c, 0x39, 0x30, 0x1d, 0x3c, 0x42, 0x30, 0x18, 0xac, 0x4c, 0x97, 0x4c, 0x00, 0x13,
+    0x83, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x07, 0x1b,
+    0x23, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x87, 0x07, 0x00, 0x09, 0x83, 0x07, 0x0f, 0x05, 0x05,
+    0x1b, 0x45, 0x31, 0x3a, 0x30, 0x31, 0x3b, 0x1b, 0x31, 0x47, 0x31, 0x1a, 0x0e, 0x2f, 0xac, 0x4c,
+    0x97, 0x4c, 0x00, 0x13, 0x86, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b,
+    0x82, 0x23, 0x05, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a, 0x87, 0x07, 0x00, 0x09, 0x82, 0x07, 0x12,
+    0x05, 0x0c, 0x31, 0x3a, 0x3b, 0x30, 0x31, 0x3b, 0x1b, 0x27, 0x45, 0x3c, 0x1b, 0x30, 0x31, 0x3b,
+    0x12, 0x35, 0x4b, 0xaa, 0x4c, 0x97, 0x4c, 0x00, 0x13, 0x87, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00,
+    0x2c, 0x86, 0x23, 0x08, 0x1b, 0x23, 0x23, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a, 0x88, 0x07, 0x03,
+    0x09, 0x05, 0x05, 0x1b, 0x82, 0x3b, 0x0d, 0x2c, 0x39, 0x30, 0x1e, 0x3c, 0x42, 0x2c, 0x30, 0x3b,
+    0x3b, 0x26, 0x30, 0x31, 0x2f, 0xab, 0x4c, 0x96, 0x4c, 0x01, 0x44, 0x14, 0x84, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x06, 0x1b, 0x45, 0x27, 0x2a, 0x2a,
+    0x31, 0x2a, 0x88, 0x07, 0x0c, 0x05, 0x17, 0x31, 0x3a, 0x3b, 0x30, 0x39, 0x39, 0x1b, 0x39, 0x47,
+    0x31, 0x25, 0x82, 0x3b, 0x04, 0x2c, 0x3b, 0x1b, 0x22, 0x2f, 0xab, 0x4c, 0x97, 0x4c, 0x00, 0x13,
+    0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x08, 0x1b,
+    0x23, 0x23, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a, 0x86, 0x07, 0x16, 0x05, 0x0c, 0x26, 0x32, 0x3b,
+    0x2c, 0x31, 0x3a, 0x1d, 0x28, 0x47, 0x31, 0x25, 0x31, 0x3a, 0x3b, 0x30, 0x32, 0x2b, 0x0a, 0x09,
+    0x26, 0x32, 0xab, 0x4c, 0x96, 0x4c, 0x01, 0x44, 0x14, 0x85, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00,
+    0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x05, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x84, 0x07,
+    0x02, 0x05, 0x0c, 0x1d, 0x82, 0x3b, 0x0d, 0x30, 0x31, 0x26, 0x26, 0x45, 0x3c, 0x25, 0x30, 0x31,
+    0x3b, 0x2a, 0x31, 0x3a, 0x12, 0x82, 0x09, 0x01, 0x26, 0x32, 0xab, 0x4c, 0x97, 0x4c, 0x01, 0x10,
+    0x1d, 0x84, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x0b,
+    0x45, 0x27, 0x2a, 0x2a, 0x32, 0x2a, 0x05, 0x07, 0x05, 0x05, 0x0a, 0x1a, 0x82, 0x3b, 0x0d, 0x2c,
+    0x39, 0x30, 0x1e, 0x36, 0x45, 0x27, 0x2a, 0x3b, 0x3b, 0x26, 0x30, 0x32, 0x18, 0x84, 0x09, 0x01,
+    0x26, 0x32, 0xab, 0x4c, 0x97, 0x4c, 0x02, 0x37, 0x0c, 0x1a, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x0a, 0x1b, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a,
+    0x05, 0x05, 0x12, 0x23, 0x82, 0x3b, 0x0d, 0x2c, 0x39, 0x30, 0x1e, 0x36, 0x47, 0x31, 0x25, 0x31,
+    0x3b, 0x3b, 0x26, 0x3b, 0x1b, 0x86, 0x09, 0x01, 0x26, 0x32, 0xab, 0x4c, 0x98, 0x4c, 0x03, 0x37,
+    0x0e, 0x14, 0x1a, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x82,
+    0x23, 0x07, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x17, 0x31, 0x82, 0x3b, 0x0e, 0x30, 0x31, 0x3b,
+    0x1b, 0x27, 0x45, 0x3c, 0x25, 0x31, 0x3a, 0x3b, 0x30, 0x32, 0x26, 0x0a, 0x83, 0x09, 0x83, 0x06,
+    0x01, 0x26, 0x32, 0xab, 0x4c, 0x99, 0x4c, 0x03, 0x1f, 0x1d, 0x14, 0x13, 0x88, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x00, 0x2c, 0x83, 0x23, 0x05, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x2a, 0x82, 0x3b, 0x0f,
+    0x2c, 0x39, 0x30, 0x2c, 0x1c, 0x3c, 0x42, 0x2c, 0x17, 0x1f, 0x3b, 0x2c, 0x30, 0x3b, 0x0e, 0x07,
+    0x82, 0x09, 0x07, 0x03, 0x01, 0x05, 0x05, 0x04, 0x07, 0x26, 0x32, 0xab, 0x4c, 0x99, 0x4c, 0x09,
+    0x19, 0x1d, 0x17, 0x13, 0x12, 0x13, 0x1a, 0x2a, 0x2a, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x83, 0x23, 0x15, 0x45, 0x27, 0x1f, 0x2a, 0x31, 0x2a, 0x3b, 0x3b, 0x26, 0x30, 0x32,
+    0x1b, 0x31, 0x45, 0x27, 0x2a, 0x3b, 0x3b, 0x17, 0x1a, 0x27, 0x14, 0x82, 0x09, 0x05, 0x06, 0x03,
+    0x01, 0x00, 0x01, 0x05, 0x82, 0x06, 0x01, 0x26, 0x32, 0xab, 0x4c, 0x99, 0x4c, 0x09, 0x1f, 0x1d,
+    0x14, 0x13, 0x12, 0x13, 0x12, 0x13, 0x17, 0x1f, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c,
+    0x83, 0x23, 0x14, 0x45, 0x27, 0x2a, 0x2a, 0x32, 0x39, 0x39, 0x30, 0x39, 0x1b, 0x28, 0x47, 0x30,
+    0x1d, 0x3c, 0x3b, 0x2c, 0x31, 0x46, 0x1a, 0x2a, 0x83, 0x09, 0x0a, 0x06, 0x00, 0x01, 0x02, 0x03,
+    0x09, 0x09, 0x0b, 0x07, 0x26, 0x32, 0xab, 0x4c, 0x99, 0x4c, 0x0a, 0x1f, 0x1d, 0x17, 0x13, 0x13,
+    0x12, 0x10, 0x14, 0x10, 0x12, 0x1a, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x14, 0x45, 0x27, 0x2a, 0x2a, 0x31, 0x39, 0x39, 0x1b, 0x39, 0x47, 0x32, 0x2b, 0x3a, 0x3b, 0x31,
+    0x2a, 0x3b, 0x1b, 0x31, 0x1a, 0x2a, 0x83, 0x09, 0x0a, 0x03, 0x00, 0x01, 0x02, 0x03, 0x09, 0x0b,
+    0x10, 0x07, 0x26, 0x32, 0xab, 0x4c, 0x99, 0x4c, 0x0c, 0x19, 0x1d, 0x23, 0x1a, 0x14, 0x13, 0x10,
+    0x14, 0x14, 0x10, 0x12, 0x14, 0x1a, 0x83, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x02, 0x2c, 0x31, 0x28,
+    0x82, 0x2a, 0x11, 0x2c, 0x31, 0x39, 0x3c, 0x1b, 0x30, 0x3b, 0x3b, 0x26, 0x3b, 0x1b, 0x0a, 0x09,
+    0x27, 0x1a, 0x2a, 0x09, 0x09, 0x83, 0x05, 0x0a, 0x04, 0x07, 0x03, 0x09, 0x14, 0x09, 0x10, 0x20,
+    0x17, 0x35, 0x4b, 0xa9, 0x4c, 0x99, 0x4c, 0x01, 0x19, 0x1d, 0x82, 0x23, 0x09, 0x1a, 0x14, 0x14,
+    0x10, 0x14, 0x10, 0x23, 0x23, 0x14, 0x1a, 0x84, 0x23, 0x19, 0x2c, 0x23, 0x45, 0x3d, 0x26, 0x23,
+    0x23, 0x31, 0x3c, 0x1b, 0x30, 0x3b, 0x3b, 0x2c, 0x31, 0x31, 0x0e, 0x07, 0x09, 0x09, 0x26, 0x1a,
+    0x2a, 0x09, 0x09, 0x05, 0x82, 0x06, 0x0c, 0x04, 0x07, 0x07, 0x09, 0x09, 0x26, 0x31, 0x2d, 0x40,
+    0x2d, 0x17, 0x35, 0x4b, 0xa7, 0x4c, 0x99, 0x4c, 0x01, 0x19, 0x1d, 0x82, 0x23, 0x05, 0x2c, 0x23,
+    0x23, 0x17, 0x14, 0x10, 0x83, 0x23, 0x02, 0x17, 0x14, 0x1d, 0x82, 0x23, 0x01, 0x1a, 0x45, 0x82,
+    0x47, 0x08, 0x45, 0x27, 0x2a, 0x3b, 0x3b, 0x30, 0x31, 0x2f, 0x14, 0x84, 0x09, 0x05, 0x26, 0x1a,
+    0x2a, 0x09, 0x09, 0x05, 0x83, 0x06, 0x0c, 0x09, 0x09, 0x26, 0x31, 0x27, 0x32, 0x45, 0x41, 0x4b,
+    0x4a, 0x27, 0x1f, 0x4b, 0xa6, 0x4c, 0x99, 0x4c, 0x01, 0x19, 0x1d, 0x82, 0x23, 0x00, 0x2c, 0x82,
+    0x23, 0x02, 0x2c, 0x17, 0x1f, 0x83, 0x23, 0x10, 0x1b, 0x17, 0x14, 0x1d, 0x23, 0x23, 0x45, 0x47,
+    0x47, 0x2b, 0x1a, 0x31, 0x3a, 0x3b, 0x30, 0x32, 0x26, 0x83, 0x09, 0x05, 0x06, 0x09, 0x09, 0x26,
+    0x1a, 0x2a, 0x85, 0x09, 0x0d, 0x06, 0x17, 0x31, 0x30, 0x35, 0x41, 0x40, 0x3e, 0x44, 0x41, 0x44,
+    0x47, 0x31, 0x18, 0xa6, 0x4c, 0x99, 0x4c, 0x01, 0x1f, 0x1d, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x86, 0x23, 0x0e, 0x1b, 0x23, 0x17, 0x14, 0x17, 0x31, 0x3b, 0x1b, 0x31, 0x3b, 0x3b,
+    0x26, 0x3b, 0x1b, 0x0a, 0x83, 0x09, 0x1d, 0x06, 0x09, 0x06, 0x06, 0x27, 0x1a, 0x1e, 0x09, 0x0e,
+    0x11, 0x09, 0x09, 0x10, 0x31, 0x2a, 0x3b, 0x40, 0x3e, 0x44, 0x41, 0x44, 0x47, 0x3d, 0x45, 0x47,
+    0x47, 0x3d, 0x17, 0x35, 0x4b, 0xa3, 0x4c, 0x99, 0x4c, 0x01, 0x1f, 0x1d, 0x83, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x82, 0x23, 0x07, 0x17, 0x1a, 0x27, 0x31, 0x2a,
+    0x3b, 0x30, 0x12, 0x82, 0x09, 0x15, 0x06, 0x03, 0x03, 0x09, 0x03, 0x09, 0x03, 0x27, 0x1a, 0x1e,
+    0x0b, 0x10, 0x19, 0x0c, 0x26, 0x31, 0x2d, 0x40, 0x3e, 0x44, 0x4a, 0x49, 0x82, 0x47, 0x07, 0x45,
+    0x3d, 0x3d, 0x47, 0x47, 0x3c, 0x1b, 0x2f, 0xa3, 0x4c, 0x98, 0x4c, 0x04, 0x44, 0x14, 0x23, 0x17,
+    0x1f, 0x84, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x23, 0x01,
+    0x1b, 0x14, 0x83, 0x09, 0x04, 0x05, 0x05, 0x00, 0x01, 0x02, 0x82, 0x06, 0x0c, 0x26, 0x1a, 0x2a,
+    0x0e, 0x1f, 0x1d, 0x32, 0x21, 0x37, 0x40, 0x3e, 0x44, 0x4a, 0x82, 0x47, 0x00, 0x45, 0x82, 0x47,
+    0x06, 0x45, 0x3d, 0x3d, 0x47, 0x47, 0x31, 0x28, 0xa2, 0x4c, 0x97, 0x4c, 0x07, 0x2f, 0x17, 0x37,
+    0x40, 0x37, 0x27, 0x1a, 0x1e, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x00,
+    0x1b, 0x83, 0x23, 0x00, 0x1b, 0x83, 0x09, 0x13, 0x06, 0x00, 0x01, 0x02, 0x03, 0x06, 0x06, 0x0b,
+    0x07, 0x26, 0x1a, 0x2a, 0x17, 0x31, 0x30, 0x35, 0x40, 0x3e, 0x44, 0x4a, 0x83, 0x47, 0x00, 0x45,
+    0x83, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x00, 0x18, 0xa2, 0x4c, 0x96, 0x4c, 0x0a, 0x49,
+    0x18, 0x35, 0x35, 0x19, 0x28, 0x35, 0x37, 0x27, 0x17, 0x1f, 0x85, 0x23, 0x00, 0x2c, 0x82, 0x23,
+    0x00, 0x2c, 0x86, 0x23, 0x00, 0x1b, 0x83, 0x09, 0x11, 0x06, 0x00, 0x00, 0x01, 0x02, 0x06, 0x0b,
+    0x10, 0x08, 0x27, 0x1a, 0x1e, 0x30, 0x31, 0x40, 0x3e, 0x44, 0x4a, 0x84, 0x47, 0x00, 0x45, 0x84,
+    0x47, 0x07, 0x45, 0x47, 0x47, 0x36, 0x45, 0x3d, 0x2e, 0x1c, 0xa1, 0x4c, 0x96, 0x4c, 0x0c, 0x2d,
+    0x28, 0x35, 0x17, 0x1f, 0x17, 0x1f, 0x19, 0x37, 0x40, 0x28, 0x17, 0x1d, 0x85, 0x23, 0x00, 0x2c,
+    0x82, 0x23, 0x00, 0x2c, 0x85, 0x23, 0x82, 0x09, 0x11, 0x03, 0x00, 0x02, 0x03, 0x04, 0x03, 0x09,
+    0x14, 0x0b, 0x10, 0x31, 0x2a, 0x28, 0x35, 0x4a, 0x43, 0x4a, 0x49, 0x82, 0x47, 0x00, 0x45, 0x85,
+    0x47, 0x00, 0x45, 0x83, 0x47, 0x08, 0x3d, 0x2e, 0x45, 0x47, 0x32, 0x14, 0x1a, 0x35, 0x4b, 0x9d,
+    0x4c, 0x96, 0x4c, 0x0e, 0x28, 0x2a, 0x1b, 0x18, 0x18, 0x1d, 0x10, 0x20, 0x17, 0x28, 0x35, 0x37,
+    0x28, 0x17, 0x1d, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x86, 0x23, 0x02, 0x09, 0x09,
+    0x05, 0x82, 0x06, 0x0c, 0x04, 0x04, 0x07, 0x07, 0x09, 0x2b, 0x31, 0x2d, 0x40, 0x40, 0x3e, 0x44,
+    0x4a, 0x83, 0x47, 0x02, 0x31, 0x10, 0x1d, 0x82, 0x47, 0x00, 0x45, 0x83, 0x47, 0x0a, 0x3d, 0x3d,
+    0x45, 0x35, 0x41, 0x40, 0x43, 0x4a, 0x43, 0x1c, 0x28, 0x9d, 0x4c, 0x96, 0x4c, 0x12, 0x2f, 0x1e,
+    0x17, 0x14, 0x17, 0x17, 0x1f, 0x17, 0x2d, 0x17, 0x28, 0x19, 0x37, 0x37, 0x27, 0x1b, 0x22, 0x2a,
+    0x2a, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x82, 0x09, 0x02, 0x06, 0x03,
+    0x03, 0x82, 0x09, 0x02, 0x26, 0x31, 0x2d, 0x82, 0x40, 0x02, 0x3e, 0x44, 0x4a, 0x83, 0x47, 0x05,
+    0x17, 0x07, 0x28, 0x14, 0x10, 0x45, 0x82, 0x47, 0x04, 0x45, 0x45, 0x47, 0x32, 0x45, 0x82, 0x47,
+    0x01, 0x45, 0x45, 0x82, 0x48, 0x02, 0x2d, 0x17, 0x4b, 0x9b, 0x4c, 0x96, 0x4c, 0x14, 0x27, 0x1f,
+    0x17, 0x14, 0x17, 0x10, 0x14, 0x1b, 0x14, 0x2c, 0x10, 0x20, 0x17, 0x28, 0x28, 0x35, 0x37, 0x1b,
+    0x22, 0x2a, 0x2a, 0x83, 0x23, 0x00, 0x2c, 0x82, 0x23, 0x03, 0x2c, 0x09, 0x09, 0x11, 0x83, 0x09,
+    0x08, 0x17, 0x31, 0x30, 0x35, 0x40, 0x40, 0x3e, 0x44, 0x4a, 0x83, 0x47, 0x07, 0x1e, 0x09, 0x17,
+    0x1f, 0x17, 0x0b, 0x10, 0x3f, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x02, 0x43, 0x4a,
+    0x43, 0x84, 0x48, 0x04, 0x35, 0x14, 0x44, 0x4c, 0x4b, 0x98, 0x4c, 0x96, 0x4c, 0x17, 0x27, 0x1f,
+    0x17, 0x17, 0x14, 0x10, 0x14, 0x1b, 0x14, 0x1a, 0x23, 0x10, 0x20, 0x17, 0x1e, 0x17, 0x32, 0x32,
+    0x2e, 0x1c, 0x1b, 0x22, 0x2a, 0x2a, 0x84, 0x23, 0x0e, 0x1b, 0x0a, 0x14, 0x13, 0x09, 0x09, 0x10,
+    0x31, 0x2a, 0x3b, 0x40, 0x40, 0x3e, 0x44, 0x4a, 0x83, 0x47, 0x07, 0x28, 0x0b, 0x10, 0x19, 0x1f,
+    0x0e, 0x0e, 0x2f, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x00, 0x43, 0x82, 0x48, 0x0a,
+    0x35, 0x35, 0x2f, 0x44, 0x43, 0x4a, 0x43, 0x48, 0x17, 0x35, 0x4b, 0x98, 0x4c, 0x96, 0x4c, 0x17,
+    0x27, 0x1f, 0x17, 0x17, 0x14, 0x10, 0x14, 0x17, 0x14, 0x10, 0x17, 0x1a, 0x10, 0x20, 0x17, 0x1e,
+    0x18, 0x1d, 0x1f, 0x38, 0x32, 0x1a, 0x22, 0x2a, 0x82, 0x23, 0x09, 0x2c, 0x23, 0x23, 0x09, 0x26,
+    0x18, 0x0e, 0x28, 0x31, 0x2d, 0x82, 0x40, 0x00, 0x49, 0x83, 0x47, 0x09, 0x45, 0x3d, 0x14, 0x13,
+    0x17, 0x1f, 0x17, 0x0b, 0x27, 0x45, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x00, 0x43,
+    0x82, 0x48, 0x06, 0x2d, 0x32, 0x45, 0x41, 0x3d, 0x2e, 0x45, 0x82, 0x48, 0x01, 0x1b, 0x31, 0x98,
+    0x4c, 0x96, 0x4c, 0x1a, 0x27, 0x1e, 0x1b, 0x1e, 0x17, 0x10, 0x14, 0x1b, 0x14, 0x10, 0x14, 0x1b,
+    0x14, 0x10, 0x28, 0x17, 0x1d, 0x18, 0x1d, 0x1f, 0x2e, 0x35, 0x2f, 0x1b, 0x22, 0x2a, 0x2a, 0x82,
+    0x23, 0x09, 0x0b, 0x10, 0x19, 0x32, 0x21, 0x37, 0x40, 0x3e, 0x44, 0x4a, 0x85, 0x47, 0x06, 0x0b,
+    0x16, 0x34, 0x34, 0x0d, 0x18, 0x35, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x00, 0x43,
+    0x82, 0x48, 0x0f, 0x37, 0x27, 0x17, 0x12, 0x23, 0x3b, 0x3d, 0x45, 0x35, 0x37, 0x40, 0x48, 0x48,
+    0x2d, 0x19, 0x4b, 0x96, 0x4c, 0x96, 0x4c, 0x26, 0x19, 0x1e, 0x1b, 0x1e, 0x24, 0x1b, 0x14, 0x17,
+    0x14, 0x10, 0x17, 0x17, 0x14, 0x10, 0x17, 0x1b, 0x14, 0x28, 0x17, 0x1d, 0x18, 0x27, 0x1f, 0x35,
+    0x2f, 0x1b, 0x1a, 0x2a, 0x2a, 0x2c, 0x23, 0x32, 0x21, 0x37, 0x40, 0x40, 0x3e, 0x44, 0x4a, 0x86,
+    0x47, 0x04, 0x3c, 0x14, 0x15, 0x18, 0x35, 0x82, 0x47, 0x1c, 0x3c, 0x3d, 0x45, 0x47, 0x47, 0x3d,
+    0x43, 0x4a, 0x43, 0x48, 0x3e, 0x32, 0x1a, 0x12, 0x09, 0x0c, 0x09, 0x1a, 0x36, 0x45, 0x3d, 0x3d,
+    0x2e, 0x45, 0x48, 0x48, 0x37, 0x17, 0x4a, 0x95, 0x4c, 0x96, 0x4c, 0x24, 0x1f, 0x1d, 0x23, 0x23,
+    0x24, 0x1b, 0x24, 0x1b, 0x17, 0x14, 0x10, 0x17, 0x17, 0x10, 0x14, 0x1b, 0x14, 0x10, 0x28, 0x14,
+    0x2c, 0x18, 0x18, 0x1e, 0x28, 0x35, 0x37, 0x1b, 0x1a, 0x2a, 0x28, 0x35, 0x37, 0x40, 0x3e, 0x44,
+    0x4a, 0x88, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x06, 0x43, 0x3d, 0x45, 0x47, 0x47, 0x3d,
+    0x43, 0x82, 0x48, 0x16, 0x35, 0x35, 0x27, 0x13, 0x12, 0x0c, 0x09, 0x0a, 0x13, 0x12, 0x10, 0x3d,
+    0x45, 0x35, 0x37, 0x35, 0x41, 0x40, 0x43, 0x3e, 0x17, 0x35, 0x4b, 0x93, 0x4c, 0x96, 0x4c, 0x20,
+    0x1f, 0x1d, 0x23, 0x23, 0x24, 0x24, 0x1b, 0x24, 0x24, 0x1b, 0x17, 0x17, 0x14, 0x10, 0x17, 0x17,
+    0x10, 0x10, 0x14, 0x1b, 0x14, 0x1f, 0x1d, 0x18, 0x1d, 0x1f, 0x1f, 0x38, 0x32, 0x28, 0x35, 0x37,
+    0x28, 0x82, 0x48, 0x82, 0x47, 0x00, 0x45, 0x83, 0x47, 0x00, 0x3d, 0x82, 0x47, 0x00, 0x45, 0x83,
+    0x47, 0x00, 0x3d, 0x83, 0x47, 0x1a, 0x45, 0x47, 0x47, 0x36, 0x2d, 0x17, 0x12, 0x09, 0x0c, 0x06,
+    0x12, 0x0a, 0x13, 0x0a, 0x09, 0x32, 0x45, 0x41, 0x3d, 0x3d, 0x2e, 0x45, 0x48, 0x48, 0x43, 0x1c,
+    0x2d, 0x93, 0x4c, 0x96, 0x4c, 0x03, 0x1f, 0x1d, 0x23, 0x23, 0x82, 0x24, 0x00, 0x1b, 0x82, 0x24,
+    0x16, 0x1b, 0x17, 0x10, 0x14, 0x1b, 0x14, 0x10, 0x14, 0x1a, 0x17, 0x0e, 0x1f, 0x18, 0x1d, 0x1f,
+    0x18, 0x1d, 0x1f, 0x2e, 0x40, 0x3e, 0x44, 0x4a, 0x89, 0x47, 0x00, 0x45, 0x83, 0x47, 0x00, 0x3d,
+    0x84, 0x47, 0x00, 0x45, 0x82, 0x47, 0x15, 0x37, 0x32, 0x18, 0x12, 0x09, 0x0c, 0x06, 0x0f, 0x0c,
+    0x0f, 0x0c, 0x0a, 0x09, 0x12, 0x13, 0x1e, 0x3c, 0x3d, 0x45, 0x35, 0x37, 0x35, 0x82, 0x48, 0x02,
+    0x28, 0x19, 0x4b, 0x91, 0x4c, 0x96, 0x4c, 0x03, 0x1f, 0x1d, 0x23, 0x23, 0x83, 0x24, 0x00, 0x1b,
+    0x83, 0x24, 0x17, 0x1b, 0x17, 0x17, 0x14, 0x10, 0x14, 0x17, 0x17, 0x0e, 0x14, 0x1a, 0x17, 0x1e,
+    0x1b, 0x14, 0x2e, 0x43, 0x4a, 0x43, 0x48, 0x3e, 0x36, 0x45, 0x3d, 0x82, 0x47, 0x00, 0x45, 0x83,
+    0x47, 0x08, 0x3d, 0x47, 0x47, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x83, 0x48, 0x17, 0x28, 0x1f,
+    0x13, 0x12, 0x0c, 0x09, 0x09, 0x0f, 0x0c, 0x0a, 0x06, 0x06, 0x12, 0x13, 0x06, 0x06, 0x12, 0x14,
+    0x2e, 0x3d, 0x45, 0x35, 0x37, 0x35, 0x82, 0x48, 0x02, 0x2d, 0x19, 0x4b, 0x90, 0x4c, 0x96, 0x4c,
+    0x03, 0x1f, 0x1d, 0x23, 0x23, 0x84, 0x24, 0x00, 0x1b, 0x84, 0x24, 0x1b, 0x1b, 0x24, 0x10, 0x14,
+    0x14, 0x17, 0x0e, 0x14, 0x17, 0x14, 0x10, 0x17, 0x1b, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x48,
+    0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x48, 0x48, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47,
+    0x00, 0x43, 0x82, 0x48, 0x19, 0x35, 0x2f, 0x14, 0x13, 0x09, 0x0c, 0x09, 0x0a, 0x0c, 0x0f, 0x06,
+    0x12, 0x0a, 0x12, 0x09, 0x0c, 0x06, 0x13, 0x0a, 0x09, 0x32, 0x3d, 0x45, 0x35, 0x37, 0x35, 0x82,
+    0x48, 0x02, 0x37, 0x27, 0x45, 0x90, 0x4c, 0x96, 0x4c, 0x06, 0x1f, 0x1e, 0x1b, 0x1e, 0x24, 0x24,
+    0x1b, 0x85, 0x24, 0x00, 0x1b, 0x83, 0x24, 0x0e, 0x18, 0x18, 0x17, 0x0e, 0x14, 0x17, 0x17, 0x14,
+    0x17, 0x17, 0x32, 0x45, 0x41, 0x3d, 0x3d, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x2d,
+    0x43, 0x48, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x48, 0x48, 0x47, 0x43, 0x35, 0x2f, 0x1b, 0x12,
+    0x09, 0x0c, 0x06, 0x0f, 0x0c, 0x0f, 0x06, 0x0c, 0x09, 0x12, 0x09, 0x0c, 0x06, 0x13, 0x0c, 0x09,
+    0x0a, 0x14, 0x2e, 0x3d, 0x3d, 0x45, 0x35, 0x37, 0x44, 0x41, 0x44, 0x36, 0x17, 0x4a, 0x90, 0x4c,
+    0x96, 0x4c, 0x04, 0x2f, 0x17, 0x30, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x86, 0x24, 0x0c, 0x1b,
+    0x14, 0x17, 0x17, 0x14, 0x10, 0x17, 0x1b, 0x24, 0x28, 0x35, 0x37, 0x40, 0x82, 0x47, 0x02, 0x45,
+    0x3d, 0x3d, 0x82, 0x47, 0x01, 0x43, 0x3d, 0x82, 0x47, 0x00, 0x45, 0x83, 0x47, 0x22, 0x3d, 0x3d,
+    0x1e, 0x13, 0x12, 0x0c, 0x09, 0x0c, 0x0f, 0x0c, 0x09, 0x0a, 0x0c, 0x12, 0x13, 0x06, 0x0a, 0x13,
+    0x0a, 0x06, 0x06, 0x12, 0x14, 0x12, 0x0e, 0x2f, 0x47, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x27, 0x1f,
+    0x4b, 0x91, 0x4c, 0x97, 0x4c, 0x05, 0x27, 0x14, 0x1b, 0x22, 0x2a, 0x2a, 0x82, 0x23, 0x01, 0x24,
+    0x1b, 0x86, 0x24, 0x10, 0x1b, 0x24, 0x1b, 0x24, 0x18, 0x18, 0x10, 0x14, 0x1b, 0x24, 0x1b, 0x24,
+    0x35, 0x41, 0x40, 0x43, 0x3e, 0x82, 0x47, 0x02, 0x45, 0x3d, 0x3d, 0x82, 0x47, 0x00, 0x43, 0x84,
+    0x48, 0x21, 0x2d, 0x32, 0x14, 0x13, 0x09, 0x0c, 0x09, 0x0f, 0x0c, 0x0a, 0x06, 0x0c, 0x09, 0x12,
+    0x06, 0x06, 0x12, 0x13, 0x0a, 0x06, 0x12, 0x13, 0x12, 0x0c, 0x14, 0x2e, 0x3d, 0x3d, 0x48, 0x37,
+    0x3d, 0x26, 0x18, 0x35, 0x93, 0x4c, 0x99, 0x4c, 0x04, 0x27, 0x10, 0x1d, 0x24, 0x1b, 0x86, 0x24,
+    0x03, 0x1b, 0x24, 0x24, 0x1b, 0x85, 0x24, 0x10, 0x14, 0x10, 0x23, 0x23, 0x24, 0x1b, 0x24, 0x35,
+    0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x32, 0x45, 0x41, 0x82, 0x47, 0x00, 0x45, 0x82, 0x47, 0x21,
+    0x37, 0x32, 0x18, 0x12, 0x0c, 0x09, 0x0a, 0x0c, 0x12, 0x0f, 0x0c, 0x0a, 0x06, 0x12, 0x09, 0x0c,
+    0x06, 0x13, 0x0c, 0x06, 0x12, 0x13, 0x13, 0x12, 0x0c, 0x28, 0x35, 0x4a, 0x43, 0x43, 0x35, 0x32,
+    0x18, 0x2f, 0x95, 0x4c, 0x92, 0x4c, 0x00, 0x4b, 0x87, 0x4c, 0x05, 0x27, 0x10, 0x1d, 0x24, 0x24,
+    0x1b, 0x86, 0x24, 0x00, 0x1b, 0x82, 0x24, 0x00, 0x1b, 0x86, 0x24, 0x0d, 0x1b, 0x24, 0x24, 0x2e,
+    0x35, 0x3d, 0x45, 0x35, 0x37, 0x44, 0x36, 0x45, 0x3d, 0x47, 0x82, 0x48, 0x21, 0x35, 0x35, 0x27,
+    0x12, 0x13, 0x06, 0x0a, 0x0c, 0x0f, 0x0c, 0x0c, 0x0f, 0x0c, 0x0c, 0x0f, 0x06, 0x06, 0x12, 0x13,
+    0x06, 0x06, 0x12, 0x14, 0x12, 0x0a, 0x19, 0x37, 0x37, 0x44, 0x41, 0x44, 0x36, 0x18, 0x28, 0x97,
+    0x4c, 0x9d, 0x4c, 0x04, 0x2f, 0x10, 0x14, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x83, 0x24, 0x00,
+    0x1b, 0x86, 0x24, 0x06, 0x1b, 0x24, 0x28, 0x35, 0x4a, 0x43, 0x43, 0x82, 0x47, 0x25, 0x45, 0x47,
+    0x47, 0x36, 0x35, 0x2f, 0x13, 0x12, 0x0c, 0x09, 0x0c, 0x12, 0x09, 0x0c, 0x06, 0x0f, 0x0c, 0x12,
+    0x09, 0x0c, 0x06, 0x13, 0x0c, 0x06, 0x0f, 0x13, 0x12, 0x0c, 0x14, 0x32, 0x45, 0x41, 0x3d, 0x3d,
+    0x47, 0x1e, 0x1b, 0x4a, 0x98, 0x4c, 0x8d, 0x4c, 0x00, 0x4b, 0x90, 0x4c, 0x05, 0x2d, 0x10, 0x14,
+    0x24, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x84, 0x24, 0x00, 0x1b, 0x86, 0x24, 0x00, 0x3f, 0x83,
+    0x47, 0x24, 0x45, 0x47, 0x47, 0x36, 0x35, 0x3d, 0x2e, 0x0c, 0x09, 0x0a, 0x0c, 0x12, 0x0f, 0x09,
+    0x09, 0x0f, 0x12, 0x09, 0x0c, 0x06, 0x13, 0x0c, 0x06, 0x0f, 0x13, 0x12, 0x0c, 0x0e, 0x1f, 0x3d,
+    0x45, 0x47, 0x47, 0x3d, 0x27, 0x18, 0x35, 0x9a, 0x4c, 0x91, 0x4c, 0x00, 0x4b, 0x8e, 0x4c, 0x02,
+    0x2d, 0x10, 0x14, 0x82, 0x24, 0x00, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x85, 0x24, 0x00, 0x1b, 0x83,
+    0x24, 0x27, 0x36, 0x45, 0x3d, 0x47, 0x48, 0x40, 0x3e, 0x3d, 0x45, 0x35, 0x37, 0x27, 0x0c, 0x0f,
+    0x0c, 0x0c, 0x0a, 0x09, 0x12, 0x0c, 0x09, 0x0a, 0x0c, 0x12, 0x06, 0x06, 0x12, 0x13, 0x0f, 0x0c,
+    0x1e, 0x3c, 0x3d, 0x48, 0x37, 0x3d, 0x2e, 0x1c, 0x35, 0x4b, 0x9b, 0x4c, 0x8b, 0x4c, 0x00, 0x4b,
+    0x96, 0x4c, 0x03, 0x2f, 0x10, 0x17, 0x1f, 0x83, 0x23, 0x01, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b,
+    0x86, 0x24, 0x23, 0x28, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x32, 0x3d, 0x45, 0x28, 0x0b, 0x0c,
+    0x09, 0x0a, 0x0c, 0x12, 0x06, 0x0c, 0x0f, 0x0c, 0x0c, 0x0a, 0x12, 0x13, 0x12, 0x09, 0x17, 0x35,
+    0x40, 0x3e, 0x44, 0x3d, 0x2e, 0x18, 0x35, 0x9e, 0x4c, 0xa5, 0x4c, 0x03, 0x35, 0x14, 0x17, 0x1f,
+    0x83, 0x23, 0x02, 0x24, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x85, 0x24, 0x20, 0x3d, 0x45, 0x47,
+    0x47, 0x3d, 0x43, 0x32, 0x3d, 0x3d, 0x2e, 0x18, 0x0c, 0x0f, 0x0c, 0x0c, 0x0a, 0x12, 0x0c, 0x09,
+    0x0a, 0x13, 0x12, 0x0c, 0x14, 0x32, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x27, 0x18, 0x4a, 0x9f, 0x4c,
+    0x82, 0x4c, 0x00, 0x4b, 0xa3, 0x4c, 0x04, 0x35, 0x14, 0x17, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b,
+    0x87, 0x24, 0x22, 0x1b, 0x24, 0x24, 0x36, 0x45, 0x3d, 0x47, 0x48, 0x40, 0x3d, 0x45, 0x35, 0x37,
+    0x35, 0x0e, 0x0e, 0x13, 0x12, 0x06, 0x14, 0x2c, 0x0c, 0x0f, 0x0c, 0x1f, 0x38, 0x43, 0x4a, 0x43,
+    0x3d, 0x26, 0x18, 0x44, 0x4c, 0x4b, 0x9a, 0x4c, 0x00, 0x4b, 0x83, 0x4c, 0x89, 0x4c, 0x00, 0x4b,
+    0x9e, 0x4c, 0x03, 0x37, 0x17, 0x17, 0x1f, 0x83, 0x23, 0x82, 0x24, 0x00, 0x1b, 0x86, 0x24, 0x00,
+    0x1b, 0x82, 0x24, 0x14, 0x32, 0x45, 0x41, 0x47, 0x48, 0x37, 0x3d, 0x3d, 0x45, 0x35, 0x37, 0x14,
+    0x09, 0x10, 0x1e, 0x3c, 0x3d, 0x2e, 0x1c, 0x35, 0x45, 0x82, 0x47, 0x02, 0x2e, 0x1c, 0x35, 0xa3,
+    0x4c, 0xab, 0x4c, 0x06, 0x2f, 0x17, 0x14, 0x1d, 0x23, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x86,
+    0x24, 0x02, 0x2e, 0x35, 0x3d, 0x82, 0x48, 0x12, 0x35, 0x35, 0x3d, 0x45, 0x35, 0x1b, 0x22, 0x2f,
+    0x1e, 0x3c, 0x3d, 0x48, 0x44, 0x41, 0x44, 0x32, 0x18, 0x2f, 0x4b, 0x98, 0x4c, 0x00, 0x4b, 0x8a,
+    0x4c, 0xad, 0x4c, 0x07, 0x38, 0x17, 0x14, 0x2c, 0x23, 0x23, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b,
+    0x85, 0x24, 0x14, 0x3d, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x32, 0x3d, 0x3d, 0x27, 0x14, 0x27,
+    0x45, 0x47, 0x48, 0x48, 0x2d, 0x19, 0x1f, 0x4a, 0xa6, 0x4c, 0xaf, 0x4c, 0x08, 0x41, 0x17, 0x14,
+    0x2c, 0x23, 0x23, 0x24, 0x24, 0x1b, 0x86, 0x24, 0x00, 0x1b, 0x83, 0x24, 0x11, 0x36, 0x45, 0x3d,
+    0x47, 0x48, 0x40, 0x3d, 0x3d, 0x45, 0x35, 0x37, 0x44, 0x48, 0x37, 0x3d, 0x2e, 0x19, 0x4b, 0xa8,
+    0x4c, 0xb1, 0x4c, 0x05, 0x41, 0x17, 0x14, 0x1e, 0x1b, 0x1e, 0x82, 0x24, 0x00, 0x1b, 0x86, 0x24,
+    0x11, 0x1b, 0x24, 0x24, 0x2e, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x43, 0x32, 0x3d, 0x48, 0x37, 0x3d,
+    0x2e, 0x19, 0x3e, 0xaa, 0x4c, 0xb3, 0x4c, 0x05, 0x43, 0x1c, 0x14, 0x2c, 0x23, 0x23, 0x82, 0x24,
+    0x00, 0x1b, 0x86, 0x24, 0x04, 0x1b, 0x24, 0x2e, 0x35, 0x3d, 0x83, 0x48, 0x04, 0x35, 0x35, 0x3d,
+    0x18, 0x35, 0xac, 0x4c, 0xb5, 0x4c, 0x03, 0x43, 0x19, 0x14, 0x1a, 0x82, 0x23, 0x01, 0x24, 0x1b,
+    0x86, 0x24, 0x0a, 0x1b, 0x24, 0x28, 0x3d, 0x45, 0x47, 0x47, 0x3d, 0x35, 0x19, 0x28, 0xae, 0x4c,
+    0xb7, 0x4c, 0x03, 0x44, 0x18, 0x14, 0x1a, 0x82, 0x23, 0x02, 0x24, 0x24, 0x1b, 0x86, 0x24, 0x06,
+    0x27, 0x32, 0x3d, 0x45, 0x1e, 0x1b, 0x4a, 0xaf, 0x4c, 0xb9, 0x4c, 0x06, 0x44, 0x18, 0x14, 0x1b,
+    0x22, 0x2a, 0x2a, 0x82, 0x23, 0x02, 0x24, 0x24, 0x1b, 0x84, 0x24, 0x01, 0x18, 0x35, 0xb1, 0x4c,
+    0xbb, 0x4c, 0x06, 0x44, 0x1f, 0x0e, 0x1b, 0x22, 0x2a, 0x2a, 0x82, 0x23, 0x82, 0x24, 0x02, 0x1b,
+    0x0d, 0x2f, 0xb3, 0x4c, 0xbe, 0x4c, 0x02, 0x1f, 0x10, 0x1d, 0x82, 0x24, 0x05, 0x1b, 0x24, 0x24,
+    0x10, 0x20, 0x4a, 0xb4, 0x4c, 0xc0, 0x4c, 0x09, 0x19, 0x10, 0x1d, 0x24, 0x24, 0x14, 0x18, 0x44,
+    0x4c, 0x4b, 0xb4, 0x4c, 0x83, 0x4c, 0x00, 0x4b, 0xbd, 0x4c, 0x03, 0x19, 0x10, 0x18, 0x35, 0xb8,
+    0x4c, 0xde, 0x4c, 0x00, 0x4b, 0x9f, 0x4c, 0xab, 0x4c, 0x00, 0x4b, 0xc6, 0x4c, 0x00, 0x4b, 0x8a,
+    0x4c, 0xde, 0x4c, 0x00, 0x4b, 0x9f, 0x4c, 0xc6, 0x4c, 0x00, 0x4b, 0xb7, 0x4c, 0xdf, 0x4c, 0x00,
+    0x4b, 0x9e, 0x4c, 0xff, 0x4c, 0xe1, 0x4c, 0x00, 0x4b, 0x9c, 0x4c, 0xa9, 0x4c, 0x00, 0x4b, 0xd4,
+    0x4c, 0xe4, 0x4c, 0x00, 0x4b, 0x99, 0x4c, 0xbc, 0x4c, 0x00, 0x4b, 0xc1, 0x4c, 0xe8, 0x4c, 0x00,
+    0x4b, 0x95, 0x4c, 0x8d, 0x4c, 0x00, 0x4b, 0xe3, 0x4c, 0x00, 0x4b, 0x8b, 0x4c, 0xed, 0x4c, 0x00,
+    0x4b, 0x90, 0x4c,
+};
+
+// 79 colors, 4363 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_3[] = {
+    0x0433, 0x0579, 0x1125, 0x21a8, 0x2a2a, 0x3207, 0x3a4a, 0x3b72, 0x4248, 0x42ad, 0x4479, 0x4a89,
+    0x4a8b, 0x52cb, 0x532e, 0x62ec, 0x630b, 0x63b1, 0x6b8e, 0x7432, 0x83ce, 0x84f4, 0x8558, 0x8c4f,
+    0x8c92, 0x9556, 0x95b8, 0x95f9, 0x9bd1, 0x9cf3, 0x9cf9, 0x9d78, 0x9e3b, 0xa4d1, 0xa4d4, 0xa557,
+    0xad55, 0xad78, 0xadb5, 0xadb7, 0xadd9, 0xae5b, 0xaedc, 0xb5b6, 0xb5f9, 0xb639, 0xbd76, 0xbdf7,
+    0xbe7a, 0xbebb, 0xc5f7, 0xc638, 0xc67a, 0xc6ba, 0xc6bb, 0xceba, 0xcebb, 0xcefb, 0xcefd, 0xd679,
+    0xd6ba, 0xd6bb, 0xd6fb, 0xd6fc, 0xdefb, 0xdf3d, 0xe73c, 0xe73d, 0xe77c, 0xe77d, 0xe77e, 0xef7c,
+    0xef7d, 0xefbe, 0xefbf, 0xf7be, 0xf7bf, 0xf7ff, 0xffff,
+};
+static constexpr uint16_t mac_row_3[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 74, 76, 82,
+    84, 86, 88, 94, 104, 106, 108, 110, 112, 114, 116, 122, 140, 169, 188, 206,
+    229, 253, 285, 317, 356, 389, 421, 459, 501, 538, 578, 619, 659, 696, 740, 781,
+    825, 861, 902, 945, 985, 1028, 1071, 1115, 1160, 1206, 1252, 1291, 1336, 1381, 1426, 1470,
+    1512, 1554, 1595, 1635, 1676, 1715, 1752, 1793, 1837, 1885, 1945, 2018, 2090, 2162, 2235, 2312,
+    2387, 2458, 2535, 2602, 2670, 2735, 2804, 2875, 2947, 3020, 3085, 3150, 3213, 3272, 3324, 3380,
+    3422, 3458, 3498, 3537, 3575, 3608, 3651, 3691, 3724, 3749, 3771, 3789, 3804, 3819, 3825, 3835,
+    3841, 3847, 3857, 3867, 3873, 3883, 3889, 3895, 3901, 3903, 3909, 3915, 3921, 3927, 3933, 3943,
+};
+static constexpr uint8_t mac_code_3[] = {
+    0xff, 0x4e, 0xd8, 0x4e, 0x00, 0x4b, 0xa5, 0x4e, 0x86, 0x4e, 0x00, 0x4b, 0xc9, 0x4e, 0x00, 0x4b,
+    0xac, 0x4e, 0xbf, 0x4e, 0x00, 0x4b, 0xbe, 0x4e, 0xff, 0x4e, 0xa7, 0x4e, 0x00, 0x4b, 0xd6, 0x4e,
+    0x9d, 0x4e, 0x00, 0x4b, 0xcb, 0x4e, 0x00, 0x4b, 0x93, 0x4e, 0x90, 0x4e, 0x00, 0x4b, 0xe8, 0x4e,
+    0x00, 0x4b, 0x83, 0x4e, 0xff, 0x4e, 0xe5, 0x4e, 0x00, 0x4b, 0x98, 0x4e, 0xb8, 0x4e, 0x00, 0x4b,
+    0xc5, 0x4e, 0xd1, 0x4e, 0x00, 0x4b, 0xac, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0x87, 0x4e, 0x00, 0x4b,
+    0xf6, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xfa, 0x4e, 0x00, 0x4b, 0x83, 0x4e, 0x8b, 0x4e,
+    0x00, 0x4b, 0xef, 0x4e, 0x02, 0x4b, 0x4e, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e, 0xff, 0x4e,
+    0xff, 0x4e, 0xff, 0x4e, 0xf6, 0x4e, 0x00, 0x4b, 0x87, 0x4e, 0xbd, 0x4e, 0x02, 0x42, 0x3c, 0x33,
+    0x82, 0x2f, 0x82, 0x2b, 0x04, 0x33, 0x2f, 0x3d, 0x40, 0x48, 0xb3, 0x4e, 0xb8, 0x4e, 0x17, 0x3c,
+    0x33, 0x1d, 0x18, 0x18, 0x23, 0x28, 0x2d, 0x34, 0x36, 0x38, 0x39, 0x38, 0x39, 0x34, 0x36, 0x27,
+    0x19, 0x13, 0x12, 0x13, 0x2b, 0x3d, 0x4b, 0xae, 0x4e, 0xb4, 0x4e, 0x05, 0x3b, 0x24, 0x1d, 0x19,
+    0x2d, 0x34, 0x92, 0x41, 0x04, 0x30, 0x19, 0x13, 0x1d, 0x3c, 0xac, 0x4e, 0xb0, 0x4e, 0x05, 0x3c,
+    0x24, 0x14, 0x18, 0x2d, 0x34, 0x9a, 0x41, 0x03, 0x27, 0x13, 0x40, 0x48, 0xa9, 0x4e, 0x86, 0x4e,
+    0x00, 0x4b, 0xa5, 0x4e, 0x04, 0x3b, 0x18, 0x06, 0x18, 0x2d, 0x88, 0x41, 0x00, 0x29, 0x96, 0x41,
+    0x01, 0x18, 0x42, 0xa9, 0x4e, 0xaa, 0x4e, 0x04, 0x42, 0x24, 0x0e, 0x11, 0x2f, 0x8a, 0x41, 0x04,
+    0x31, 0x01, 0x1b, 0x01, 0x1b, 0x91, 0x41, 0x82, 0x4e, 0x00, 0x18, 0xa9, 0x4e, 0x02, 0x4e, 0x4e,
+    0x4b, 0xa5, 0x4e, 0x05, 0x37, 0x13, 0x07, 0x13, 0x2b, 0x43, 0x8b, 0x41, 0x00, 0x20, 0x83, 0x01,
+    0x01, 0x1b, 0x2a, 0x8d, 0x41, 0x83, 0x4e, 0x02, 0x3c, 0x18, 0x42, 0xa8, 0x4e, 0x83, 0x4e, 0x00,
+    0x4b, 0xa1, 0x4e, 0x04, 0x33, 0x11, 0x00, 0x00, 0x27, 0x8d, 0x41, 0x00, 0x29, 0x86, 0x01, 0x00,
+    0x29, 0x8a, 0x41, 0x83, 0x4e, 0x04, 0x46, 0x41, 0x41, 0x27, 0x41, 0xa8, 0x4e, 0x02, 0x4e, 0x4e,
+    0x4b, 0xa1, 0x4e, 0x06, 0x33, 0x11, 0x00, 0x01, 0x00, 0x34, 0x36, 0x8d, 0x41, 0x01, 0x3a, 0x16,
+    0x85, 0x01, 0x01, 0x36, 0x38, 0x87, 0x41, 0x00, 0x4d, 0x83, 0x4e, 0x00, 0x3c, 0x82, 0x41, 0x01,
+    0x30, 0x2f, 0xa8, 0x4e, 0xa2, 0x4e, 0x07, 0x37, 0x13, 0x00, 0x01, 0x01, 0x00, 0x36, 0x38, 0x8e,
+    0x41, 0x06, 0x3a, 0x41, 0x29, 0x1a, 0x01, 0x01, 0x36, 0x88, 0x41, 0x00, 0x4d, 0x83, 0x4e, 0x86,
+    0x41, 0x00, 0x18, 0xa8, 0x4e, 0x86, 0x4e, 0x00, 0x4b, 0x98, 0x4e, 0x02, 0x42, 0x18, 0x00, 0x83,
+    0x01, 0x00, 0x36, 0x8e, 0x41, 0x00, 0x3a, 0x8e, 0x41, 0x00, 0x4c, 0x83, 0x4e, 0x00, 0x3c, 0x87,
+    0x41, 0x00, 0x12, 0xa8, 0x4e, 0x84, 0x4e, 0x00, 0x4b, 0x99, 0x4e, 0x03, 0x2b, 0x07, 0x0a, 0x00,
+    0x82, 0x01, 0x00, 0x15, 0x8d, 0x41, 0x00, 0x3a, 0x8e, 0x41, 0x00, 0x4c, 0x83, 0x4e, 0x84, 0x41,
+    0x07, 0x30, 0x15, 0x13, 0x2d, 0x41, 0x41, 0x13, 0x40, 0xa7, 0x4e, 0x87, 0x4e, 0x00, 0x4b, 0x94,
+    0x4e, 0x01, 0x42, 0x18, 0x83, 0x00, 0x82, 0x01, 0x00, 0x27, 0x8e, 0x41, 0x00, 0x3a, 0x8b, 0x41,
+    0x00, 0x4d, 0x83, 0x4e, 0x00, 0x3c, 0x83, 0x41, 0x01, 0x30, 0x19, 0x82, 0x1e, 0x04, 0x13, 0x40,
+    0x41, 0x19, 0x3c, 0xa7, 0x4e, 0x9c, 0x4e, 0x01, 0x33, 0x07, 0x84, 0x00, 0x82, 0x01, 0x00, 0x27,
+    0x8f, 0x41, 0x00, 0x3a, 0x88, 0x41, 0x00, 0x4d, 0x83, 0x4e, 0x84, 0x41, 0x02, 0x34, 0x1d, 0x19,
+    0x83, 0x1e, 0x04, 0x13, 0x41, 0x41, 0x30, 0x2f, 0xa7, 0x4e, 0x02, 0x4e, 0x4e, 0x4b, 0x98, 0x4e,
+    0x00, 0x24, 0x86, 0x00, 0x82, 0x01, 0x00, 0x15, 0x8e, 0x41, 0x00, 0x3a, 0x86, 0x41, 0x84, 0x4e,
+    0x00, 0x46, 0x84, 0x41, 0x02, 0x34, 0x19, 0x15, 0x85, 0x1e, 0x04, 0x11, 0x36, 0x38, 0x41, 0x24,
+    0xa7, 0x4e, 0x02, 0x4e, 0x4e, 0x4b, 0x97, 0x4e, 0x00, 0x18, 0x88, 0x00, 0x82, 0x01, 0x01, 0x00,
+    0x34, 0x8d, 0x41, 0x00, 0x3a, 0x84, 0x41, 0x83, 0x4e, 0x00, 0x46, 0x84, 0x41, 0x02, 0x30, 0x19,
+    0x15, 0x87, 0x1e, 0x04, 0x13, 0x2d, 0x41, 0x41, 0x13, 0xa7, 0x4e, 0x82, 0x4e, 0x00, 0x4b, 0x95,
+    0x4e, 0x00, 0x13, 0x89, 0x00, 0x84, 0x01, 0x01, 0x15, 0x30, 0x8d, 0x41, 0x01, 0x4c, 0x49, 0x83,
+    0x4e, 0x00, 0x3c, 0x84, 0x41, 0x02, 0x30, 0x2f, 0x15, 0x89, 0x1e, 0x04, 0x15, 0x27, 0x41, 0x41,
+    0x13, 0xa7, 0x4e, 0x82, 0x4e, 0x00, 0x4b, 0x94, 0x4e, 0x00, 0x13, 0x8c, 0x00, 0x84, 0x01, 0x01,
+    0x15, 0x27, 0x8a, 0x41, 0x00, 0x4d, 0x83, 0x4e, 0x00, 0x3c, 0x85, 0x41, 0x01, 0x13, 0x15, 0x8c,
+    0x1e, 0x03, 0x18, 0x42, 0x41, 0x13, 0xa7, 0x4e, 0x82, 0x4e, 0x00, 0x4b, 0x93, 0x4e, 0x01, 0x1d,
+    0x0a, 0x8d, 0x00, 0x00, 0x0a, 0x84, 0x01, 0x03, 0x00, 0x27, 0x34, 0x36, 0x84, 0x41, 0x00, 0x4d,
+    0x82, 0x4e, 0x00, 0x46, 0x85, 0x41, 0x02, 0x34, 0x19, 0x15, 0x8e, 0x1e, 0x04, 0x11, 0x36, 0x41,
+    0x19, 0x42, 0xa6, 0x4e, 0x82, 0x4e, 0x00, 0x4b, 0x92, 0x4e, 0x00, 0x2f, 0x92, 0x00, 0x84, 0x01,
+    0x04, 0x0a, 0x15, 0x41, 0x41, 0x49, 0x83, 0x4e, 0x86, 0x41, 0x02, 0x34, 0x19, 0x15, 0x8a, 0x1e,
+    0x01, 0x2c, 0x25, 0x83, 0x1e, 0x04, 0x13, 0x38, 0x39, 0x34, 0x37, 0xa6, 0x4e, 0x89, 0x4e, 0x00,
+    0x4b, 0x8a, 0x4e, 0x02, 0x42, 0x00, 0x0a, 0x93, 0x00, 0x00, 0x0a, 0x83, 0x01, 0x01, 0x15, 0x4b,
+    0x82, 0x4e, 0x86, 0x41, 0x01, 0x2c, 0x15, 0x8b, 0x1e, 0x04, 0x2c, 0x3c, 0x40, 0x2c, 0x25, 0x82,
+    0x1e, 0x04, 0x11, 0x30, 0x41, 0x30, 0x2f, 0xa6, 0x4e, 0x95, 0x4e, 0x01, 0x13, 0x01, 0x96, 0x00,
+    0x83, 0x01, 0x01, 0x29, 0x46, 0x86, 0x41, 0x01, 0x27, 0x15, 0x8b, 0x1e, 0x05, 0x2c, 0x3c, 0x3c,
+    0x40, 0x40, 0x2c, 0x83, 0x1e, 0x04, 0x15, 0x28, 0x41, 0x41, 0x24, 0xa6, 0x4e, 0x8a, 0x4e, 0x00,
+    0x4b, 0x88, 0x4e, 0x00, 0x3c, 0x99, 0x00, 0x82, 0x01, 0x00, 0x15, 0x84, 0x41, 0x02, 0x34, 0x19,
+    0x15, 0x8b, 0x1e, 0x07, 0x2c, 0x3c, 0x3c, 0x42, 0x4e, 0x4e, 0x42, 0x3c, 0x83, 0x1e, 0x04, 0x15,
+    0x19, 0x3c, 0x41, 0x13, 0xa6, 0x4e, 0x8a, 0x4e, 0x00, 0x4b, 0x88, 0x4e, 0x01, 0x18, 0x01, 0x99,
+    0x00, 0x08, 0x01, 0x01, 0x00, 0x36, 0x41, 0x41, 0x30, 0x19, 0x15, 0x8b, 0x1e, 0x04, 0x2c, 0x3c,
+    0x3c, 0x42, 0x4b, 0x82, 0x4e, 0x01, 0x42, 0x3c, 0x84, 0x1e, 0x03, 0x13, 0x38, 0x41, 0x13, 0xa6,
+    0x4e, 0x8f, 0x4e, 0x00, 0x4b, 0x83, 0x4e, 0x01, 0x00, 0x01, 0x99, 0x00, 0x06, 0x01, 0x01, 0x00,
+    0x36, 0x41, 0x3f, 0x15, 0x8b, 0x1e, 0x04, 0x2c, 0x3c, 0x3c, 0x42, 0x4b, 0x85, 0x4e, 0x00, 0x3c,
+    0x84, 0x1e, 0x03, 0x11, 0x41, 0x41, 0x13, 0xa6, 0x4e, 0x85, 0x4e, 0x00, 0x4b, 0x8c, 0x4e, 0x01,
+    0x33, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x03, 0x30, 0x41, 0x30, 0x15, 0x89, 0x1e, 0x07, 0x2c, 0x3c,
+    0x40, 0x40, 0x4b, 0x42, 0x3c, 0x36, 0x83, 0x4e, 0x01, 0x46, 0x41, 0x84, 0x1e, 0x03, 0x11, 0x41,
+    0x41, 0x13, 0xa6, 0x4e, 0x93, 0x4e, 0x01, 0x1d, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x03, 0x27, 0x41,
+    0x41, 0x15, 0x87, 0x1e, 0x09, 0x2c, 0x3c, 0x3c, 0x42, 0x4b, 0x4e, 0x38, 0x13, 0x15, 0x30, 0x83,
+    0x4e, 0x02, 0x46, 0x41, 0x25, 0x83, 0x1e, 0x04, 0x11, 0x30, 0x41, 0x19, 0x42, 0xa5, 0x4e, 0x93,
+    0x4e, 0x01, 0x11, 0x01, 0x9b, 0x00, 0x05, 0x01, 0x01, 0x19, 0x3c, 0x41, 0x15, 0x86, 0x1e, 0x0a,
+    0x3c, 0x40, 0x40, 0x4b, 0x4e, 0x4e, 0x2c, 0x07, 0x13, 0x16, 0x1f, 0x83, 0x4e, 0x02, 0x46, 0x41,
+    0x25, 0x83, 0x1e, 0x04, 0x13, 0x38, 0x41, 0x19, 0x3c, 0xa5, 0x4e, 0x93, 0x4e, 0x01, 0x09, 0x01,
+    0x9b, 0x00, 0x06, 0x01, 0x01, 0x15, 0x41, 0x41, 0x23, 0x28, 0x85, 0x1e, 0x01, 0x3c, 0x40, 0x83,
+    0x4e, 0x05, 0x3c, 0x07, 0x0e, 0x11, 0x19, 0x4d, 0x82, 0x4e, 0x02, 0x46, 0x40, 0x2c, 0x83, 0x1e,
+    0x04, 0x11, 0x30, 0x41, 0x27, 0x41, 0xa5, 0x4e, 0x93, 0x4e, 0x01, 0x09, 0x01, 0x9b, 0x00, 0x05,
+    0x01, 0x01, 0x00, 0x36, 0x41, 0x27, 0x86, 0x1e, 0x02, 0x2c, 0x40, 0x48, 0x82, 0x4e, 0x06, 0x41,
+    0x07, 0x07, 0x13, 0x36, 0x4e, 0x4c, 0x82, 0x4e, 0x02, 0x42, 0x2c, 0x25, 0x82, 0x1e, 0x04, 0x13,
+    0x2d, 0x41, 0x28, 0x2d, 0xa5, 0x4e, 0x93, 0x4e, 0x00, 0x09, 0x9c, 0x00, 0x07, 0x01, 0x01, 0x00,
+    0x34, 0x41, 0x34, 0x16, 0x1f, 0x84, 0x1e, 0x01, 0x34, 0x36, 0x83, 0x4e, 0x06, 0x3c, 0x07, 0x2d,
+    0x34, 0x4b, 0x42, 0x3f, 0x82, 0x4e, 0x02, 0x41, 0x34, 0x16, 0x82, 0x1e, 0x04, 0x11, 0x30, 0x41,
+    0x27, 0x33, 0xa5, 0x4e, 0x93, 0x4e, 0x00, 0x11, 0x9c, 0x00, 0x82, 0x01, 0x03, 0x30, 0x41, 0x41,
+    0x15, 0x85, 0x1e, 0x01, 0x2c, 0x3c, 0x87, 0x4e, 0x07, 0x3c, 0x3f, 0x34, 0x4b, 0x4e, 0x4e, 0x42,
+    0x3c, 0x83, 0x1e, 0x04, 0x13, 0x2d, 0x41, 0x29, 0x2f, 0xa5, 0x4e, 0x93, 0x4e, 0x00, 0x1d, 0x9c,
+    0x00, 0x06, 0x0a, 0x01, 0x01, 0x28, 0x41, 0x41, 0x19, 0x85, 0x1e, 0x02, 0x2c, 0x3c, 0x4b, 0x82,
+    0x4e, 0x0b, 0x4b, 0x4e, 0x48, 0x42, 0x3c, 0x43, 0x41, 0x4e, 0x4e, 0x41, 0x41, 0x3c, 0x83, 0x1e,
+    0x04, 0x15, 0x27, 0x41, 0x34, 0x2b, 0xa5, 0x4e, 0x93, 0x4e, 0x01, 0x33, 0x0e, 0x9c, 0x00, 0x05,
+    0x01, 0x01, 0x19, 0x3c, 0x41, 0x19, 0x85, 0x1e, 0x11, 0x2c, 0x3c, 0x4b, 0x4e, 0x4e, 0x41, 0x3c,
+    0x33, 0x1d, 0x4b, 0x4e, 0x4e, 0x42, 0x44, 0x40, 0x48, 0x40, 0x48, 0x83, 0x1e, 0x04, 0x15, 0x19,
+    0x41, 0x41, 0x24, 0xa5, 0x4e, 0x93, 0x4e, 0x02, 0x42, 0x18, 0x07, 0x9b, 0x00, 0x05, 0x01, 0x01,
+    0x16, 0x41, 0x41, 0x27, 0x86, 0x1e, 0x10, 0x40, 0x48, 0x4e, 0x4e, 0x40, 0x2c, 0x2b, 0x3d, 0x47,
+    0x4b, 0x42, 0x3f, 0x40, 0x48, 0x40, 0x40, 0x48, 0x83, 0x1e, 0x04, 0x15, 0x19, 0x3c, 0x41, 0x19,
+    0xa5, 0x4e, 0x94, 0x4e, 0x01, 0x18, 0x18, 0x9b, 0x00, 0x05, 0x01, 0x01, 0x16, 0x41, 0x41, 0x27,
+    0x86, 0x1e, 0x0b, 0x3c, 0x42, 0x4e, 0x4e, 0x42, 0x42, 0x4e, 0x4e, 0x42, 0x42, 0x40, 0x48, 0x82,
+    0x40, 0x01, 0x2c, 0x2b, 0x83, 0x1e, 0x04, 0x15, 0x19, 0x41, 0x3a, 0x1d, 0xa5, 0x4e, 0x94, 0x4e,
+    0x02, 0x24, 0x32, 0x11, 0x9a, 0x00, 0x06, 0x01, 0x01, 0x00, 0x41, 0x41, 0x30, 0x19, 0x85, 0x1e,
+    0x01, 0x3c, 0x42, 0x83, 0x4e, 0x08, 0x46, 0x41, 0x25, 0x2f, 0x34, 0x36, 0x40, 0x2c, 0x2b, 0x86,
+    0x1e, 0x03, 0x18, 0x42, 0x41, 0x18, 0xa5, 0x4e, 0x94, 0x4e, 0x03, 0x3c, 0x24, 0x2f, 0x11, 0x99,
+    0x00, 0x02, 0x01, 0x01, 0x00, 0x82, 0x41, 0x00, 0x15, 0x85, 0x1e, 0x0c, 0x34, 0x40, 0x48, 0x4e,
+    0x4e, 0x40, 0x40, 0x2c, 0x34, 0x36, 0x40, 0x34, 0x2b, 0x88, 0x1e, 0x03, 0x13, 0x40, 0x41, 0x18,
+    0xa5, 0x4e, 0x95, 0x4e, 0x03, 0x1d, 0x33, 0x2f, 0x07, 0x98, 0x00, 0x02, 0x01, 0x01, 0x00, 0x82,
+    0x41, 0x00, 0x19, 0x85, 0x1e, 0x0a, 0x34, 0x40, 0x48, 0x42, 0x40, 0x48, 0x24, 0x1d, 0x37, 0x34,
+    0x2b, 0x89, 0x1e, 0x04, 0x15, 0x13, 0x41, 0x41, 0x13, 0xa5, 0x4e, 0x95, 0x4e, 0x04, 0x33, 0x2b,
+    0x2b, 0x33, 0x07, 0x97, 0x00, 0x82, 0x01, 0x03, 0x30, 0x41, 0x41, 0x19, 0x85, 0x1e, 0x08, 0x2c,
+    0x3c, 0x3c, 0x42, 0x40, 0x3b, 0x33, 0x2f, 0x25, 0x8a, 0x1e, 0x05, 0x13, 0x11, 0x36, 0x41, 0x3f,
+    0x15, 0xa5, 0x4e, 0x96, 0x4e, 0x04, 0x13, 0x33, 0x2f, 0x25, 0x07, 0x96, 0x00, 0x06, 0x0a, 0x01,
+    0x01, 0x28, 0x41, 0x41, 0x27, 0x85, 0x1e, 0x06, 0x2c, 0x40, 0x48, 0x40, 0x40, 0x33, 0x2f, 0x8a,
+    0x1e, 0x03, 0x13, 0x12, 0x23, 0x3a, 0x82, 0x41, 0x00, 0x18, 0xa5, 0x4e, 0x96, 0x4e, 0x05, 0x3c,
+    0x26, 0x33, 0x2f, 0x18, 0x07, 0x96, 0x00, 0x05, 0x01, 0x01, 0x27, 0x41, 0x41, 0x27, 0x85, 0x1e,
+    0x04, 0x2c, 0x3c, 0x40, 0x2c, 0x2b, 0x8a, 0x1e, 0x02, 0x15, 0x11, 0x15, 0x84, 0x41, 0x01, 0x30,
+    0x18, 0xa5, 0x4e, 0x97, 0x4e, 0x05, 0x1d, 0x33, 0x33, 0x2f, 0x18, 0x07, 0x95, 0x00, 0x05, 0x01,
+    0x01, 0x27, 0x41, 0x41, 0x19, 0x86, 0x1e, 0x01, 0x2c, 0x25, 0x8b, 0x1e, 0x02, 0x11, 0x13, 0x2d,
+    0x84, 0x41, 0x02, 0x27, 0x2d, 0x18, 0xa5, 0x4e, 0x97, 0x4e, 0x06, 0x3b, 0x24, 0x33, 0x2f, 0x25,
+    0x18, 0x07, 0x94, 0x00, 0x05, 0x01, 0x01, 0x19, 0x41, 0x41, 0x27, 0x8c, 0x1e, 0x02, 0x15, 0x22,
+    0x15, 0x82, 0x1e, 0x02, 0x13, 0x13, 0x2d, 0x84, 0x41, 0x04, 0x30, 0x27, 0x41, 0x41, 0x22, 0xa5,
+    0x4e, 0x98, 0x4e, 0x06, 0x1d, 0x2f, 0x2f, 0x2b, 0x33, 0x1d, 0x07, 0x93, 0x00, 0x06, 0x01, 0x01,
+    0x16, 0x41, 0x41, 0x29, 0x1a, 0x89, 0x1e, 0x09, 0x22, 0x21, 0x1c, 0x19, 0x1e, 0x1e, 0x13, 0x12,
+    0x23, 0x3f, 0x84, 0x41, 0x05, 0x27, 0x38, 0x39, 0x27, 0x2d, 0x22, 0xa5, 0x4e, 0x98, 0x4e, 0x07,
+    0x42, 0x18, 0x24, 0x32, 0x24, 0x32, 0x24, 0x07, 0x92, 0x00, 0x06, 0x01, 0x01, 0x15, 0x41, 0x41,
+    0x34, 0x16, 0x87, 0x1e, 0x09, 0x22, 0x17, 0x18, 0x16, 0x1f, 0x1e, 0x13, 0x12, 0x23, 0x3f, 0x84,
+    0x41, 0x08, 0x27, 0x2d, 0x41, 0x28, 0x00, 0x01, 0x13, 0x12, 0x2f, 0xa4, 0x4e, 0x99, 0x4e, 0x07,
+    0x26, 0x1d, 0x3c, 0x2f, 0x24, 0x32, 0x24, 0x07, 0x91, 0x00, 0x02, 0x01, 0x01, 0x19, 0x82, 0x41,
+    0x00, 0x15, 0x86, 0x1e, 0x07, 0x34, 0x19, 0x15, 0x1e, 0x1e, 0x15, 0x13, 0x15, 0x85, 0x41, 0x04,
+    0x30, 0x27, 0x41, 0x41, 0x15, 0x82, 0x01, 0x04, 0x00, 0x0f, 0x18, 0x18, 0x2b, 0x89, 0x4e, 0x01,
+    0x45, 0x2f, 0x83, 0x18, 0x01, 0x3b, 0x4b, 0x90, 0x4e, 0x93, 0x4e, 0x00, 0x4b, 0x85, 0x4e, 0x07,
+    0x12, 0x2f, 0x2f, 0x2b, 0x33, 0x33, 0x2f, 0x11, 0x90, 0x00, 0x02, 0x01, 0x01, 0x16, 0x82, 0x41,
+    0x00, 0x18, 0x83, 0x1e, 0x09, 0x24, 0x1d, 0x27, 0x19, 0x1e, 0x1e, 0x15, 0x13, 0x15, 0x30, 0x84,
+    0x41, 0x05, 0x30, 0x15, 0x3f, 0x41, 0x41, 0x13, 0x83, 0x01, 0x07, 0x07, 0x13, 0x4d, 0x3b, 0x18,
+    0x13, 0x2b, 0x43, 0x85, 0x4e, 0x03, 0x26, 0x1d, 0x3f, 0x4e, 0x82, 0x4a, 0x02, 0x2f, 0x11, 0x3c,
+    0x8f, 0x4e, 0x9a, 0x4e, 0x09, 0x3c, 0x18, 0x2d, 0x33, 0x1d, 0x33, 0x2f, 0x3d, 0x18, 0x07, 0x8e,
+    0x00, 0x06, 0x01, 0x01, 0x00, 0x36, 0x41, 0x3f, 0x15, 0x82, 0x1e, 0x08, 0x2e, 0x21, 0x19, 0x1e,
+    0x1e, 0x15, 0x13, 0x15, 0x30, 0x84, 0x41, 0x07, 0x34, 0x19, 0x2d, 0x28, 0x41, 0x41, 0x28, 0x00,
+    0x83, 0x01, 0x01, 0x0f, 0x33, 0x82, 0x4e, 0x0a, 0x37, 0x1d, 0x11, 0x15, 0x23, 0x28, 0x33, 0x2f,
+    0x25, 0x37, 0x4e, 0x86, 0x4a, 0x01, 0x13, 0x40, 0x8e, 0x4e, 0x9b, 0x4e, 0x09, 0x26, 0x33, 0x33,
+    0x2f, 0x25, 0x37, 0x33, 0x2f, 0x25, 0x07, 0x8d, 0x00, 0x02, 0x01, 0x01, 0x00, 0x82, 0x41, 0x0a,
+    0x18, 0x1e, 0x1e, 0x2c, 0x19, 0x1e, 0x1e, 0x15, 0x11, 0x15, 0x30, 0x85, 0x41, 0x08, 0x27, 0x27,
+    0x41, 0x38, 0x28, 0x41, 0x41, 0x15, 0x00, 0x82, 0x01, 0x02, 0x11, 0x0f, 0x4b, 0x82, 0x4e, 0x05,
+    0x4b, 0x4e, 0x42, 0x3c, 0x27, 0x19, 0x82, 0x18, 0x02, 0x49, 0x4e, 0x4e, 0x86, 0x4a, 0x00, 0x12,
+    0x8e, 0x4e, 0x9c, 0x4e, 0x09, 0x18, 0x2d, 0x33, 0x24, 0x32, 0x33, 0x2f, 0x3d, 0x2f, 0x11, 0x8c,
+    0x00, 0x06, 0x01, 0x01, 0x00, 0x36, 0x41, 0x3f, 0x15, 0x83, 0x1e, 0x03, 0x13, 0x12, 0x15, 0x30,
+    0x85, 0x41, 0x17, 0x2c, 0x27, 0x41, 0x38, 0x38, 0x39, 0x27, 0x30, 0x41, 0x15, 0x00, 0x0a, 0x01,
+    0x13, 0x12, 0x18, 0x2d, 0x41, 0x33, 0x2f, 0x25, 0x24, 0x32, 0x43, 0x82, 0x4e, 0x06, 0x33, 0x2f,
+    0x3d, 0x38, 0x28, 0x2d, 0x41, 0x84, 0x4a, 0x00, 0x18, 0x8e, 0x4e, 0x9c, 0x4e, 0x0b, 0x41, 0x17,
+    0x33, 0x1d, 0x33, 0x33, 0x2f, 0x3d, 0x2f, 0x33, 0x1d, 0x07, 0x8a, 0x00, 0x02, 0x01, 0x01, 0x00,
+    0x82, 0x41, 0x06, 0x15, 0x1e, 0x1e, 0x13, 0x12, 0x23, 0x3f, 0x85, 0x41, 0x1f, 0x34, 0x19, 0x2d,
+    0x19, 0x3c, 0x41, 0x19, 0x30, 0x2f, 0x27, 0x2d, 0x22, 0x00, 0x00, 0x18, 0x10, 0x1d, 0x19, 0x13,
+    0x13, 0x18, 0x23, 0x27, 0x2b, 0x1d, 0x18, 0x33, 0x4e, 0x4e, 0x42, 0x11, 0x00, 0x82, 0x01, 0x01,
+    0x27, 0x41, 0x83, 0x4a, 0x00, 0x12, 0x8e, 0x4e, 0x9d, 0x4e, 0x0b, 0x45, 0x18, 0x23, 0x27, 0x33,
+    0x2f, 0x3d, 0x2f, 0x33, 0x33, 0x2f, 0x11, 0x89, 0x00, 0x02, 0x01, 0x01, 0x00, 0x82, 0x41, 0x04,
+    0x19, 0x11, 0x13, 0x2c, 0x3c, 0x85, 0x41, 0x11, 0x2c, 0x27, 0x2c, 0x15, 0x00, 0x27, 0x34, 0x2d,
+    0x34, 0x41, 0x41, 0x2c, 0x3c, 0x33, 0x1d, 0x17, 0x08, 0x33, 0x85, 0x4e, 0x04, 0x46, 0x41, 0x3b,
+    0x24, 0x18, 0x82, 0x4e, 0x01, 0x24, 0x0a, 0x82, 0x01, 0x01, 0x00, 0x36, 0x82, 0x4a, 0x01, 0x30,
+    0x19, 0x8e, 0x4e, 0x9e, 0x4e, 0x06, 0x3c, 0x18, 0x23, 0x33, 0x2f, 0x3d, 0x2f, 0x82, 0x33, 0x02,
+    0x2f, 0x25, 0x07, 0x87, 0x00, 0x05, 0x01, 0x01, 0x00, 0x36, 0x41, 0x3f, 0x88, 0x41, 0x08, 0x29,
+    0x23, 0x28, 0x38, 0x28, 0x16, 0x1f, 0x2c, 0x3c, 0x83, 0x41, 0x05, 0x30, 0x33, 0x2f, 0x11, 0x04,
+    0x42, 0x85, 0x4e, 0x05, 0x46, 0x1d, 0x19, 0x2d, 0x18, 0x13, 0x83, 0x4e, 0x01, 0x24, 0x00, 0x82,
+    0x01, 0x05, 0x00, 0x2d, 0x34, 0x19, 0x15, 0x4b, 0x8e, 0x4e, 0x95, 0x4e, 0x00, 0x4b, 0x88, 0x4e,
+    0x06, 0x37, 0x12, 0x2f, 0x33, 0x2f, 0x3d, 0x2f, 0x83, 0x33, 0x02, 0x2f, 0x18, 0x07, 0x85, 0x00,
+    0x05, 0x01, 0x01, 0x00, 0x36, 0x41, 0x3f, 0x86, 0x41, 0x08, 0x2c, 0x1d, 0x2d, 0x34, 0x41, 0x38,
+    0x39, 0x27, 0x30, 0x84, 0x41, 0x07, 0x27, 0x2d, 0x17, 0x00, 0x01, 0x00, 0x40, 0x48, 0x83, 0x4e,
+    0x08, 0x24, 0x23, 0x3a, 0x24, 0x0e, 0x14, 0x23, 0x18, 0x42, 0x82, 0x4e, 0x07, 0x41, 0x24, 0x11,
+    0x07, 0x07, 0x0e, 0x1d, 0x3c, 0x90, 0x4e, 0xa0, 0x4e, 0x05, 0x37, 0x1d, 0x33, 0x2f, 0x3d, 0x2f,
+    0x84, 0x33, 0x02, 0x2f, 0x25, 0x11, 0x84, 0x00, 0x02, 0x01, 0x01, 0x00, 0x87, 0x41, 0x08, 0x34,
+    0x19, 0x38, 0x28, 0x38, 0x39, 0x34, 0x2c, 0x3c, 0x84, 0x41, 0x08, 0x30, 0x33, 0x1d, 0x10, 0x04,
+    0x01, 0x01, 0x00, 0x41, 0x82, 0x4e, 0x0c, 0x33, 0x1d, 0x3c, 0x2f, 0x0d, 0x0f, 0x05, 0x0c, 0x10,
+    0x1d, 0x18, 0x23, 0x4b, 0x82, 0x4e, 0x00, 0x4b, 0x95, 0x4e, 0xa1, 0x4e, 0x05, 0x3c, 0x18, 0x33,
+    0x2f, 0x3d, 0x2f, 0x85, 0x33, 0x02, 0x2f, 0x25, 0x07, 0x82, 0x00, 0x04, 0x01, 0x01, 0x0a, 0x36,
+    0x38, 0x83, 0x41, 0x08, 0x27, 0x1e, 0x3f, 0x41, 0x41, 0x34, 0x2b, 0x2c, 0x3c, 0x84, 0x41, 0x1b,
+    0x30, 0x2f, 0x2b, 0x12, 0x14, 0x11, 0x00, 0x01, 0x01, 0x0f, 0x4b, 0x4e, 0x3b, 0x18, 0x38, 0x28,
+    0x12, 0x10, 0x04, 0x05, 0x12, 0x10, 0x05, 0x12, 0x12, 0x2f, 0x13, 0x40, 0x98, 0x4e, 0xa2, 0x4e,
+    0x06, 0x42, 0x17, 0x33, 0x33, 0x2f, 0x3d, 0x2f, 0x85, 0x33, 0x0f, 0x2f, 0x18, 0x07, 0x00, 0x01,
+    0x01, 0x0a, 0x36, 0x41, 0x41, 0x30, 0x2f, 0x2b, 0x30, 0x2f, 0x35, 0x88, 0x41, 0x1e, 0x37, 0x34,
+    0x2f, 0x18, 0x14, 0x18, 0x00, 0x01, 0x01, 0x00, 0x0e, 0x40, 0x3b, 0x18, 0x2d, 0x41, 0x43, 0x12,
+    0x10, 0x05, 0x0d, 0x0f, 0x05, 0x0c, 0x0f, 0x05, 0x0b, 0x10, 0x1d, 0x18, 0x1d, 0x97, 0x4e, 0xa4,
+    0x4e, 0x06, 0x18, 0x2f, 0x34, 0x33, 0x2f, 0x3d, 0x2f, 0x85, 0x33, 0x0f, 0x2f, 0x13, 0x00, 0x01,
+    0x01, 0x36, 0x2c, 0x25, 0x30, 0x2f, 0x15, 0x00, 0x07, 0x00, 0x39, 0x38, 0x85, 0x41, 0x05, 0x2c,
+    0x33, 0x1d, 0x14, 0x18, 0x07, 0x82, 0x01, 0x19, 0x07, 0x26, 0x40, 0x1d, 0x2d, 0x34, 0x12, 0x10,
+    0x13, 0x40, 0x23, 0x0d, 0x0c, 0x08, 0x10, 0x0b, 0x05, 0x12, 0x0b, 0x05, 0x0f, 0x0f, 0x23, 0x18,
+    0x3b, 0x4b, 0x94, 0x4e, 0xa5, 0x4e, 0x07, 0x18, 0x24, 0x32, 0x33, 0x33, 0x2f, 0x3d, 0x2f, 0x85,
+    0x33, 0x0e, 0x2f, 0x13, 0x15, 0x27, 0x41, 0x36, 0x00, 0x01, 0x01, 0x09, 0x03, 0x00, 0x34, 0x41,
+    0x34, 0x82, 0x41, 0x24, 0x30, 0x33, 0x1d, 0x12, 0x15, 0x11, 0x0a, 0x01, 0x01, 0x07, 0x26, 0x3e,
+    0x24, 0x27, 0x2d, 0x22, 0x10, 0x04, 0x05, 0x0f, 0x0f, 0x27, 0x41, 0x12, 0x10, 0x05, 0x0d, 0x0d,
+    0x0c, 0x0d, 0x0f, 0x05, 0x0d, 0x0c, 0x34, 0x2b, 0x18, 0x94, 0x4e, 0xa6, 0x4e, 0x05, 0x2f, 0x18,
+    0x33, 0x2f, 0x3d, 0x2f, 0x85, 0x33, 0x02, 0x2f, 0x33, 0x2f, 0x82, 0x41, 0x00, 0x00, 0x82, 0x01,
+    0x2f, 0x04, 0x03, 0x07, 0x34, 0x36, 0x41, 0x41, 0x33, 0x2f, 0x25, 0x12, 0x15, 0x11, 0x00, 0x01,
+    0x01, 0x00, 0x13, 0x40, 0x23, 0x24, 0x41, 0x41, 0x13, 0x10, 0x0b, 0x0c, 0x10, 0x08, 0x08, 0x10,
+    0x13, 0x4e, 0x2f, 0x0d, 0x0f, 0x05, 0x0d, 0x0c, 0x08, 0x10, 0x14, 0x37, 0x4e, 0x30, 0x09, 0x40,
+    0x48, 0x92, 0x4e, 0xa7, 0x4e, 0x06, 0x3b, 0x13, 0x2b, 0x33, 0x2f, 0x3d, 0x2f, 0x85, 0x33, 0x03,
+    0x2f, 0x41, 0x41, 0x27, 0x83, 0x01, 0x2e, 0x04, 0x03, 0x13, 0x40, 0x41, 0x33, 0x2f, 0x25, 0x12,
+    0x18, 0x18, 0x00, 0x01, 0x01, 0x00, 0x0e, 0x33, 0x2f, 0x18, 0x37, 0x27, 0x0d, 0x13, 0x40, 0x23,
+    0x10, 0x0b, 0x0c, 0x10, 0x0b, 0x1d, 0x3c, 0x4e, 0x4a, 0x4a, 0x13, 0x0c, 0x10, 0x08, 0x12, 0x34,
+    0x4b, 0x34, 0x1d, 0x00, 0x0f, 0x4b, 0x82, 0x4e, 0x00, 0x4b, 0x8f, 0x4e, 0xa9, 0x4e, 0x05, 0x26,
+    0x1d, 0x33, 0x2f, 0x3d, 0x2f, 0x85, 0x33, 0x02, 0x3f, 0x41, 0x16, 0x83, 0x01, 0x09, 0x00, 0x00,
+    0x27, 0x34, 0x2d, 0x2b, 0x12, 0x18, 0x18, 0x07, 0x82, 0x01, 0x1f, 0x0e, 0x33, 0x33, 0x1d, 0x33,
+    0x33, 0x10, 0x14, 0x08, 0x10, 0x10, 0x2f, 0x41, 0x13, 0x0d, 0x13, 0x38, 0x39, 0x27, 0x30, 0x41,
+    0x27, 0x2d, 0x2d, 0x14, 0x23, 0x49, 0x38, 0x15, 0x00, 0x07, 0x1d, 0x95, 0x4e, 0xaa, 0x4e, 0x06,
+    0x42, 0x18, 0x24, 0x33, 0x2f, 0x3d, 0x2f, 0x84, 0x33, 0x01, 0x41, 0x19, 0x82, 0x01, 0x08, 0x00,
+    0x13, 0x2b, 0x33, 0x2b, 0x12, 0x18, 0x1d, 0x11, 0x82, 0x01, 0x20, 0x07, 0x1d, 0x2d, 0x1d, 0x3c,
+    0x2f, 0x12, 0x10, 0x05, 0x0d, 0x12, 0x14, 0x0d, 0x0f, 0x14, 0x37, 0x3f, 0x4e, 0x4a, 0x23, 0x0d,
+    0x0c, 0x10, 0x10, 0x0b, 0x46, 0x41, 0x41, 0x15, 0x00, 0x07, 0x1d, 0x45, 0x96, 0x4e, 0xac, 0x4e,
+    0x06, 0x33, 0x14, 0x23, 0x33, 0x2f, 0x3d, 0x2f, 0x82, 0x33, 0x2f, 0x41, 0x41, 0x15, 0x00, 0x15,
+    0x27, 0x33, 0x2f, 0x18, 0x02, 0x18, 0x18, 0x00, 0x01, 0x01, 0x00, 0x13, 0x2d, 0x1d, 0x2d, 0x34,
+    0x13, 0x0d, 0x0d, 0x0c, 0x0d, 0x10, 0x0b, 0x0c, 0x10, 0x12, 0x14, 0x0d, 0x23, 0x46, 0x41, 0x41,
+    0x0d, 0x0c, 0x0d, 0x27, 0x41, 0x41, 0x22, 0x00, 0x00, 0x18, 0x42, 0x98, 0x4e, 0xae, 0x4e, 0x03,
+    0x2f, 0x18, 0x24, 0x32, 0x82, 0x33, 0x2e, 0x2f, 0x3d, 0x38, 0x3b, 0x33, 0x33, 0x1d, 0x13, 0x00,
+    0x01, 0x0a, 0x00, 0x01, 0x01, 0x00, 0x0e, 0x2f, 0x24, 0x27, 0x2d, 0x22, 0x10, 0x10, 0x0b, 0x0c,
+    0x10, 0x0d, 0x0c, 0x0d, 0x10, 0x0d, 0x0c, 0x0d, 0x10, 0x0d, 0x0f, 0x33, 0x34, 0x12, 0x1d, 0x45,
+    0x4e, 0x27, 0x00, 0x00, 0x11, 0x36, 0x9a, 0x4e, 0xb0, 0x4e, 0x0b, 0x37, 0x13, 0x15, 0x2f, 0x34,
+    0x33, 0x33, 0x2f, 0x25, 0x17, 0x12, 0x13, 0x85, 0x01, 0x11, 0x0f, 0x24, 0x1d, 0x27, 0x37, 0x1d,
+    0x0d, 0x0c, 0x0d, 0x10, 0x0d, 0x0f, 0x08, 0x10, 0x10, 0x08, 0x10, 0x0c, 0x82, 0x10, 0x0a, 0x0b,
+    0x0f, 0x0f, 0x37, 0x4e, 0x4a, 0x28, 0x00, 0x00, 0x11, 0x36, 0x9c, 0x4e, 0xb2, 0x4e, 0x2e, 0x40,
+    0x2c, 0x1d, 0x18, 0x18, 0x23, 0x33, 0x42, 0x4e, 0x4e, 0x15, 0x00, 0x01, 0x01, 0x07, 0x26, 0x24,
+    0x1d, 0x37, 0x1d, 0x10, 0x0d, 0x0c, 0x0d, 0x10, 0x0d, 0x0f, 0x08, 0x0d, 0x0c, 0x0d, 0x08, 0x10,
+    0x10, 0x08, 0x0b, 0x10, 0x0d, 0x0f, 0x33, 0x4e, 0x30, 0x00, 0x00, 0x0e, 0x33, 0x4b, 0x82, 0x4e,
+    0x00, 0x4b, 0x99, 0x4e, 0x92, 0x4e, 0x00, 0x4b, 0xa9, 0x4e, 0x20, 0x40, 0x2c, 0x2b, 0x26, 0x1d,
+    0x33, 0x23, 0x0d, 0x10, 0x0b, 0x0c, 0x10, 0x0d, 0x0d, 0x0c, 0x0d, 0x08, 0x0f, 0x0f, 0x0b, 0x10,
+    0x0d, 0x0b, 0x10, 0x0d, 0x12, 0x2f, 0x4a, 0x38, 0x15, 0x00, 0x0f, 0x2b, 0xa0, 0x4e, 0xbe, 0x4e,
+    0x1e, 0x41, 0x17, 0x33, 0x2f, 0x11, 0x0d, 0x0f, 0x05, 0x0d, 0x10, 0x0b, 0x0c, 0x10, 0x08, 0x10,
+    0x10, 0x08, 0x0b, 0x0d, 0x0c, 0x0d, 0x12, 0x10, 0x27, 0x41, 0x41, 0x22, 0x00, 0x07, 0x26, 0x3e,
+    0xa1, 0x4e, 0x8d, 0x4e, 0x00, 0x4b, 0xad, 0x4e, 0x0f, 0x41, 0x1d, 0x19, 0x2d, 0x12, 0x10, 0x05,
+    0x0d, 0x12, 0x0f, 0x05, 0x0b, 0x10, 0x0b, 0x0c, 0x10, 0x82, 0x0d, 0x0b, 0x0c, 0x0d, 0x12, 0x10,
+    0x1d, 0x43, 0x41, 0x19, 0x00, 0x00, 0x18, 0x42, 0xa3, 0x4e, 0x91, 0x4e, 0x00, 0x4b, 0xa8, 0x4e,
+    0x07, 0x18, 0x23, 0x3a, 0x14, 0x10, 0x0b, 0x0c, 0x10, 0x83, 0x0d, 0x12, 0x0c, 0x0d, 0x10, 0x0d,
+    0x0f, 0x08, 0x0d, 0x0d, 0x0f, 0x14, 0x18, 0x42, 0x41, 0x27, 0x00, 0x00, 0x11, 0x40, 0x48, 0xa4,
+    0x4e, 0x8b, 0x4e, 0x00, 0x4b, 0xad, 0x4e, 0x1c, 0x18, 0x42, 0x18, 0x10, 0x08, 0x10, 0x0c, 0x12,
+    0x10, 0x05, 0x0d, 0x0d, 0x08, 0x10, 0x10, 0x08, 0x0b, 0x0d, 0x0d, 0x0f, 0x14, 0x13, 0x40, 0x41,
+    0x33, 0x00, 0x00, 0x11, 0x3c, 0xa7, 0x4e, 0xb9, 0x4e, 0x1b, 0x49, 0x07, 0x26, 0x2f, 0x11, 0x10,
+    0x14, 0x08, 0x0b, 0x10, 0x0d, 0x0b, 0x0d, 0x0f, 0x05, 0x0d, 0x0c, 0x0d, 0x0f, 0x10, 0x14, 0x34,
+    0x4b, 0x34, 0x00, 0x00, 0x0e, 0x33, 0xa9, 0x4e, 0x82, 0x4e, 0x00, 0x4b, 0xb2, 0x4e, 0x00, 0x49,
+    0x82, 0x4e, 0x0d, 0x07, 0x01, 0x15, 0x30, 0x1d, 0x10, 0x0d, 0x08, 0x10, 0x0c, 0x10, 0x0b, 0x0c,
+    0x10, 0x82, 0x0d, 0x08, 0x12, 0x2f, 0x4a, 0x34, 0x1d, 0x00, 0x0e, 0x33, 0x4b, 0xa5, 0x4e, 0x00,
+    0x4b, 0x83, 0x4e, 0x89, 0x4e, 0x00, 0x4b, 0xa7, 0x4e, 0x00, 0x49, 0x86, 0x4e, 0x1a, 0x3c, 0x18,
+    0x00, 0x0a, 0x27, 0x2d, 0x12, 0x10, 0x0f, 0x05, 0x10, 0x10, 0x0b, 0x0c, 0x10, 0x0d, 0x2d, 0x41,
+    0x38, 0x15, 0x00, 0x07, 0x26, 0x49, 0x4e, 0x4e, 0x4a, 0xa9, 0x4e, 0xb3, 0x4e, 0x00, 0x49, 0x87,
+    0x4e, 0x13, 0x3c, 0x07, 0x0a, 0x15, 0x30, 0x27, 0x0d, 0x12, 0x08, 0x10, 0x0c, 0x10, 0x27, 0x41,
+    0x41, 0x16, 0x00, 0x07, 0x26, 0x3e, 0xa2, 0x4e, 0x00, 0x4b, 0x8a, 0x4e, 0xaf, 0x4e, 0x00, 0x49,
+    0x8d, 0x4e, 0x0f, 0x24, 0x00, 0x00, 0x27, 0x34, 0x13, 0x0d, 0x0d, 0x1d, 0x45, 0x41, 0x19, 0x00,
+    0x00, 0x18, 0x42, 0xb0, 0x4e, 0xad, 0x4e, 0x00, 0x49, 0x90, 0x4e, 0x0c, 0x42, 0x18, 0x00, 0x15,
+    0x41, 0x30, 0x41, 0x41, 0x27, 0x00, 0x00, 0x11, 0x36, 0xb2, 0x4e, 0xac, 0x4e, 0x00, 0x49, 0x93,
+    0x4e, 0x08, 0x37, 0x13, 0x00, 0x28, 0x2d, 0x00, 0x00, 0x11, 0x3c, 0xb4, 0x4e, 0xa8, 0x4e, 0x00,
+    0x49, 0x99, 0x4e, 0x05, 0x2f, 0x07, 0x00, 0x0e, 0x33, 0x4b, 0xb5, 0x4e, 0xa8, 0x4e, 0x00, 0x49,
+    0x9b, 0x4e, 0x01, 0x3c, 0x4b, 0x82, 0x4e, 0x00, 0x4b, 0xb3, 0x4e, 0xae, 0x4e, 0x00, 0x49, 0xcf,
+    0x4e, 0x95, 0x4e, 0x00, 0x49, 0xc4, 0x4e, 0x00, 0x49, 0xa2, 0x4e, 0xc4, 0x4e, 0x00, 0x49, 0xb9,
+    0x4e, 0xae, 0x4e, 0x00, 0x49, 0xcf, 0x4e, 0x99, 0x4e, 0x00, 0x49, 0xc8, 0x4e, 0x00, 0x49, 0x9a,
+    0x4e, 0x83, 0x4e, 0x00, 0x4b, 0xcb, 0x4e, 0x00, 0x49, 0xad, 0x4e, 0xde, 0x4e, 0x00, 0x4b, 0x9f,
+    0x4e, 0xab, 0x4e, 0x00, 0x4b, 0xc6, 0x4e, 0x00, 0x4b, 0x8a, 0x4e, 0xde, 0x4e, 0x00, 0x4b, 0x9f,
+    0x4e, 0xc6, 0x4e, 0x00, 0x4b, 0xb7, 0x4e, 0xdf, 0x4e, 0x00, 0x4b, 0x9e, 0x4e, 0xff, 0x4e, 0xe1,
+    0x4e, 0x00, 0x4b, 0x9c, 0x4e, 0xa9, 0x4e, 0x00, 0x4b, 0xd4, 0x4e, 0xe4, 0x4e, 0x00, 0x4b, 0x99,
+    0x4e, 0xbc, 0x4e, 0x00, 0x4b, 0xc1, 0x4e, 0xe8, 0x4e, 0x00, 0x4b, 0x95, 0x4e, 0x8d, 0x4e, 0x00,
+    0x4b, 0xe3, 0x4e, 0x00, 0x4b, 0x8b, 0x4e, 0xed, 0x4e, 0x00, 0x4b, 0x90, 0x4e,
+};
+
+// 47 colors, 2984 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_4[] = {
+    0x4a8b, 0x52cb, 0x630b, 0x63b1, 0x6b8e, 0x7432, 0x8c92, 0x9556, 0x95b8, 0x95f9, 0x9cf3, 0x9d78,
+    0xa4d4, 0xa557, 0xa639, 0xad55, 0xadb5, 0xadb7, 0xadd9, 0xb5b6, 0xb5f9, 0xb639, 0xbdf7, 0xbe7a,
+    0xbebb, 0xc5f7, 0xc638, 0xc67a, 0xc6ba, 0xceba, 0xcebb, 0xcefb, 0xcefd, 0xd679, 0xd6ba, 0xd6bb,
+    0xd6fb, 0xd6fc, 0xdefb, 0xdf3d, 0xe73c, 0xe77d, 0xe77e, 0xef7d, 0xefbe, 0xf7be, 0xffff,
+};
+static constexpr uint16_t mac_row_4[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 74, 76, 82,
+    84, 86, 88, 94, 104, 106, 108, 110, 112, 114, 116, 122, 124, 126, 128, 130,
+    136, 145, 162, 180, 203, 222, 246, 276, 312, 344, 383, 427, 473, 521, 570, 620,
+    667, 708, 758, 809, 859, 906, 946, 985, 1022, 1060, 1098, 1133, 1163, 1194, 1225, 1256,
+    1287, 1318, 1352, 1384, 1416, 1447, 1481, 1512, 1543, 1575, 1607, 1638, 1666, 1696, 1728, 1763,
+    1798, 1835, 1868, 1906, 1949, 1994, 2038, 2077, 2115, 2154, 2191, 2228, 2264, 2299, 2328, 2351,
+    2379, 2398, 2421, 2441, 2461, 2472, 2482, 2488, 2494, 2496, 2498, 2500, 2502, 2504, 2510, 2520,
+    2526, 2532, 2542, 2552, 2558, 2568, 2574, 2580, 2586, 2588, 2594, 2600, 2606, 2612, 2618, 2628,
+};
+static constexpr uint8_t mac_code_4[] = {
+    0xff, 0x2e, 0xd8, 0x2e, 0x00, 0x2d, 0xa5, 0x2e, 0x86, 0x2e, 0x00, 0x2d, 0xc9, 0x2e, 0x00, 0x2d,
+    0xac, 0x2e, 0xbf, 0x2e, 0x00, 0x2d, 0xbe, 0x2e, 0xff, 0x2e, 0xa7, 0x2e, 0x00, 0x2d, 0xd6, 0x2e,
+    0x9d, 0x2e, 0x00, 0x2d, 0xcb, 0x2e, 0x00, 0x2d, 0x93, 0x2e, 0x90, 0x2e, 0x00, 0x2d, 0xe8, 0x2e,
+    0x00, 0x2d, 0x83, 0x2e, 0xff, 0x2e, 0xe5, 0x2e, 0x00, 0x2d, 0x98, 0x2e, 0xb8, 0x2e, 0x00, 0x2d,
+    0xc5, 0x2e, 0xd1, 0x2e, 0x00, 0x2d, 0xac, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0x87, 0x2e, 0x00, 0x2d,
+    0xf6, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xfa, 0x2e, 0x00, 0x2d, 0x83, 0x2e, 0x8b, 0x2e,
+    0x00, 0x2d, 0xef, 0x2e, 0x02, 0x2d, 0x2e, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e,
+    0xff, 0x2e, 0xff, 0x2e, 0xf6, 0x2e, 0x00, 0x2d, 0x87, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e,
+    0xff, 0x2e, 0x86, 0x2e, 0x00, 0x2d, 0xf7, 0x2e, 0xbe, 0x2e, 0x03, 0x21, 0x16, 0x16, 0x26, 0xbc,
+    0x2e, 0x02, 0x2e, 0x2e, 0x2d, 0xb9, 0x2e, 0x07, 0x16, 0x0a, 0x1b, 0x25, 0x24, 0x16, 0x0a, 0x22,
+    0xba, 0x2e, 0x83, 0x2e, 0x00, 0x2d, 0xb5, 0x2e, 0x02, 0x21, 0x06, 0x1d, 0x85, 0x2c, 0x02, 0x16,
+    0x0a, 0x22, 0xb8, 0x2e, 0x02, 0x2e, 0x2e, 0x2d, 0xb5, 0x2e, 0x07, 0x28, 0x06, 0x16, 0x2a, 0x2c,
+    0x2c, 0x16, 0x26, 0x84, 0x2c, 0x02, 0x16, 0x06, 0x1d, 0xb6, 0x2e, 0xb7, 0x2e, 0x07, 0x0f, 0x0f,
+    0x29, 0x2c, 0x2c, 0x16, 0x06, 0x24, 0x87, 0x2c, 0x02, 0x11, 0x06, 0x1d, 0xb4, 0x2e, 0x86, 0x2e,
+    0x00, 0x2d, 0xad, 0x2e, 0x07, 0x16, 0x0a, 0x22, 0x2e, 0x2c, 0x1d, 0x0a, 0x1b, 0x8a, 0x2c, 0x03,
+    0x29, 0x11, 0x06, 0x28, 0xb2, 0x2e, 0x84, 0x2e, 0x00, 0x2d, 0xad, 0x2e, 0x08, 0x22, 0x06, 0x1d,
+    0x2e, 0x2c, 0x1d, 0x0f, 0x0f, 0x29, 0x86, 0x2c, 0x00, 0x29, 0x84, 0x2c, 0x04, 0x25, 0x24, 0x0d,
+    0x0a, 0x28, 0xb0, 0x2e, 0x87, 0x2e, 0x00, 0x2d, 0xa8, 0x2e, 0x08, 0x28, 0x06, 0x16, 0x26, 0x2c,
+    0x29, 0x11, 0x0c, 0x24, 0x86, 0x2c, 0x00, 0x29, 0x82, 0x23, 0x00, 0x25, 0x82, 0x2c, 0x06, 0x10,
+    0x16, 0x2a, 0x27, 0x0f, 0x0f, 0x29, 0xae, 0x2e, 0xb0, 0x2e, 0x07, 0x0f, 0x0f, 0x29, 0x2e, 0x2c,
+    0x1d, 0x0f, 0x21, 0x85, 0x2c, 0x01, 0x29, 0x23, 0x82, 0x22, 0x04, 0x1a, 0x28, 0x26, 0x1d, 0x24,
+    0x86, 0x2c, 0x02, 0x0a, 0x0f, 0x29, 0xac, 0x2e, 0x02, 0x2e, 0x2e, 0x2d, 0xab, 0x2e, 0x0a, 0x21,
+    0x06, 0x1d, 0x2e, 0x2c, 0x26, 0x0f, 0x16, 0x26, 0x2c, 0x29, 0x84, 0x2c, 0x04, 0x1d, 0x24, 0x16,
+    0x0a, 0x22, 0x85, 0x1a, 0x00, 0x29, 0x85, 0x2c, 0x03, 0x25, 0x0a, 0x0f, 0x2b, 0xaa, 0x2e, 0x02,
+    0x2e, 0x2e, 0x2d, 0xa9, 0x2e, 0x09, 0x22, 0x06, 0x1b, 0x25, 0x2c, 0x2c, 0x16, 0x0f, 0x29, 0x2e,
+    0x85, 0x2c, 0x08, 0x1d, 0x24, 0x16, 0x1a, 0x0a, 0x1b, 0x0c, 0x16, 0x16, 0x82, 0x1a, 0x01, 0x29,
+    0x1d, 0x86, 0x2c, 0x04, 0x29, 0x23, 0x0a, 0x0f, 0x2b, 0xa8, 0x2e, 0x82, 0x2e, 0x00, 0x2d, 0xa7,
+    0x2e, 0x07, 0x0a, 0x0f, 0x2b, 0x2e, 0x2c, 0x1d, 0x0f, 0x21, 0x85, 0x2c, 0x10, 0x29, 0x23, 0x22,
+    0x22, 0x10, 0x16, 0x06, 0x16, 0x13, 0x10, 0x16, 0x0a, 0x1b, 0x16, 0x16, 0x1a, 0x1b, 0x85, 0x2c,
+    0x00, 0x29, 0x82, 0x2c, 0x01, 0x24, 0x06, 0xa8, 0x2e, 0x82, 0x2e, 0x00, 0x2d, 0xa5, 0x2e, 0x02,
+    0x28, 0x06, 0x27, 0x82, 0x2c, 0x02, 0x0c, 0x16, 0x29, 0x85, 0x2c, 0x11, 0x24, 0x22, 0x22, 0x1a,
+    0x0f, 0x16, 0x13, 0x10, 0x16, 0x0a, 0x22, 0x0a, 0x1b, 0x16, 0x0f, 0x16, 0x22, 0x22, 0x85, 0x2c,
+    0x00, 0x29, 0x83, 0x2c, 0x01, 0x16, 0x26, 0xa7, 0x2e, 0x82, 0x2e, 0x00, 0x2d, 0xa5, 0x2e, 0x01,
+    0x06, 0x29, 0x83, 0x2c, 0x00, 0x29, 0x83, 0x2c, 0x15, 0x29, 0x2c, 0x2c, 0x16, 0x26, 0x0f, 0x16,
+    0x13, 0x13, 0x1a, 0x0a, 0x21, 0x0f, 0x16, 0x13, 0x13, 0x1a, 0x0a, 0x21, 0x21, 0x16, 0x25, 0x86,
+    0x2c, 0x00, 0x29, 0x82, 0x2c, 0x01, 0x1d, 0x19, 0xa7, 0x2e, 0x82, 0x2e, 0x00, 0x2d, 0xa5, 0x2e,
+    0x01, 0x06, 0x29, 0x85, 0x2c, 0x00, 0x29, 0x82, 0x2c, 0x12, 0x29, 0x22, 0x19, 0x16, 0x16, 0x1a,
+    0x06, 0x16, 0x13, 0x19, 0x16, 0x13, 0x1a, 0x0f, 0x16, 0x13, 0x28, 0x1a, 0x1a, 0x85, 0x2c, 0x09,
+    0x29, 0x2c, 0x06, 0x02, 0x26, 0x2e, 0x28, 0x0d, 0x21, 0x2c, 0xa6, 0x2e, 0x89, 0x2e, 0x00, 0x2d,
+    0x9e, 0x2e, 0x01, 0x04, 0x1d, 0x87, 0x2c, 0x13, 0x29, 0x2c, 0x1d, 0x24, 0x21, 0x16, 0x25, 0x13,
+    0x1a, 0x0f, 0x0a, 0x1b, 0x0c, 0x21, 0x0f, 0x1a, 0x1a, 0x23, 0x1a, 0x28, 0x85, 0x2c, 0x09, 0x29,
+    0x11, 0x00, 0x11, 0x29, 0x2c, 0x24, 0x16, 0x04, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x03, 0x04, 0x06,
+    0x16, 0x1d, 0x88, 0x2c, 0x0e, 0x1d, 0x21, 0x16, 0x25, 0x13, 0x21, 0x0f, 0x1a, 0x0a, 0x0f, 0x1a,
+    0x1a, 0x23, 0x1a, 0x28, 0x86, 0x2c, 0x0a, 0x1d, 0x04, 0x06, 0x28, 0x26, 0x24, 0x16, 0x0f, 0x16,
+    0x06, 0x1d, 0xa7, 0x2e, 0x8a, 0x2e, 0x00, 0x2d, 0x9d, 0x2e, 0x07, 0x04, 0x0d, 0x11, 0x06, 0x16,
+    0x26, 0x2c, 0x29, 0x84, 0x2c, 0x0c, 0x25, 0x21, 0x0f, 0x1a, 0x21, 0x16, 0x25, 0x13, 0x13, 0x1a,
+    0x21, 0x16, 0x25, 0x85, 0x2c, 0x0d, 0x29, 0x23, 0x0a, 0x04, 0x1d, 0x29, 0x22, 0x1d, 0x0a, 0x1a,
+    0x28, 0x1b, 0x06, 0x1d, 0xa7, 0x2e, 0x8a, 0x2e, 0x00, 0x2d, 0x9d, 0x2e, 0x01, 0x04, 0x0d, 0x82,
+    0x15, 0x0f, 0x0a, 0x16, 0x26, 0x2c, 0x29, 0x2c, 0x26, 0x0f, 0x1d, 0x24, 0x16, 0x1a, 0x26, 0x1d,
+    0x22, 0x22, 0x82, 0x1a, 0x86, 0x2c, 0x0f, 0x29, 0x11, 0x01, 0x16, 0x2a, 0x27, 0x1d, 0x11, 0x16,
+    0x26, 0x2c, 0x29, 0x1b, 0x06, 0x21, 0x2c, 0xa6, 0x2e, 0x8f, 0x2e, 0x00, 0x2d, 0x98, 0x2e, 0x02,
+    0x04, 0x0d, 0x21, 0x82, 0x15, 0x06, 0x0d, 0x0a, 0x1a, 0x28, 0x2c, 0x2c, 0x1d, 0x82, 0x2c, 0x01,
+    0x1d, 0x19, 0x83, 0x1a, 0x00, 0x28, 0x86, 0x2c, 0x0f, 0x1d, 0x02, 0x0a, 0x28, 0x29, 0x22, 0x16,
+    0x0a, 0x22, 0x2e, 0x2c, 0x29, 0x22, 0x1d, 0x06, 0x1d, 0xa7, 0x2e, 0x85, 0x2e, 0x00, 0x2d, 0xa2,
+    0x2e, 0x01, 0x04, 0x0d, 0x85, 0x15, 0x03, 0x0a, 0x0a, 0x1b, 0x24, 0x88, 0x2c, 0x00, 0x29, 0x82,
+    0x2c, 0x0b, 0x29, 0x2c, 0x2c, 0x24, 0x05, 0x04, 0x1d, 0x29, 0x24, 0x22, 0x0f, 0x1d, 0x82, 0x2c,
+    0x06, 0x1d, 0x29, 0x22, 0x1d, 0x06, 0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x02, 0x04, 0x0d, 0x21,
+    0x86, 0x15, 0x03, 0x0a, 0x0a, 0x1a, 0x28, 0x88, 0x2c, 0x00, 0x29, 0x82, 0x2c, 0x08, 0x0f, 0x01,
+    0x16, 0x29, 0x22, 0x1d, 0x0d, 0x21, 0x29, 0x83, 0x2c, 0x05, 0x29, 0x2c, 0x28, 0x1a, 0x06, 0x1d,
+    0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x89, 0x15, 0x03, 0x07, 0x07, 0x1b, 0x25, 0x86, 0x2c,
+    0x0c, 0x29, 0x2c, 0x1d, 0x01, 0x0a, 0x28, 0x29, 0x23, 0x11, 0x16, 0x28, 0x26, 0x29, 0x83, 0x2c,
+    0x05, 0x29, 0x2c, 0x28, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x02, 0x04, 0x0d, 0x21, 0x8a,
+    0x15, 0x03, 0x07, 0x07, 0x1b, 0x24, 0x85, 0x2c, 0x07, 0x24, 0x05, 0x24, 0x2c, 0x24, 0x16, 0x0f,
+    0x24, 0x84, 0x2c, 0x00, 0x29, 0x83, 0x2c, 0x03, 0x29, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e,
+    0x02, 0x04, 0x0d, 0x21, 0x8c, 0x15, 0x03, 0x07, 0x07, 0x1b, 0x25, 0x85, 0x2c, 0x04, 0x25, 0x21,
+    0x0f, 0x1d, 0x29, 0x83, 0x2c, 0x03, 0x29, 0x2c, 0x28, 0x29, 0x82, 0x2c, 0x04, 0x28, 0x1a, 0x06,
+    0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x02, 0x04, 0x0d, 0x21, 0x8e, 0x15, 0x0b, 0x07, 0x07, 0x1b,
+    0x24, 0x22, 0x24, 0x22, 0x24, 0x11, 0x16, 0x28, 0x29, 0x83, 0x2c, 0x04, 0x29, 0x2c, 0x28, 0x29,
+    0x29, 0x82, 0x2c, 0x03, 0x28, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x91,
+    0x15, 0x0b, 0x07, 0x07, 0x0d, 0x0a, 0x1a, 0x16, 0x26, 0x2c, 0x29, 0x2c, 0x26, 0x29, 0x83, 0x2c,
+    0x02, 0x29, 0x2c, 0x28, 0x82, 0x29, 0x03, 0x22, 0x1d, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01,
+    0x04, 0x0d, 0x93, 0x15, 0x03, 0x24, 0x22, 0x24, 0x29, 0x83, 0x2c, 0x02, 0x29, 0x2c, 0x28, 0x83,
+    0x29, 0x83, 0x2c, 0x04, 0x29, 0x1b, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d,
+    0x93, 0x15, 0x04, 0x24, 0x22, 0x24, 0x29, 0x29, 0x83, 0x2c, 0x05, 0x29, 0x2c, 0x28, 0x29, 0x29,
+    0x24, 0x84, 0x2c, 0x03, 0x29, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93,
+    0x15, 0x02, 0x24, 0x22, 0x24, 0x82, 0x29, 0x83, 0x2c, 0x05, 0x29, 0x2c, 0x28, 0x1b, 0x1c, 0x29,
+    0x83, 0x2c, 0x03, 0x29, 0x1b, 0x06, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15,
+    0x02, 0x24, 0x22, 0x24, 0x83, 0x29, 0x83, 0x2c, 0x0c, 0x29, 0x1b, 0x08, 0x25, 0x2c, 0x2c, 0x29,
+    0x2c, 0x24, 0x28, 0x1a, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02,
+    0x24, 0x22, 0x24, 0x84, 0x29, 0x82, 0x2c, 0x01, 0x28, 0x1b, 0x82, 0x12, 0x00, 0x29, 0x82, 0x2c,
+    0x03, 0x28, 0x1b, 0x06, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02, 0x24,
+    0x22, 0x24, 0x85, 0x29, 0x07, 0x2c, 0x24, 0x28, 0x1b, 0x12, 0x12, 0x1b, 0x25, 0x82, 0x2c, 0x03,
+    0x28, 0x1a, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x03, 0x24, 0x24,
+    0x22, 0x29, 0x83, 0x2c, 0x08, 0x29, 0x1b, 0x1b, 0x0e, 0x09, 0x08, 0x08, 0x25, 0x29, 0x82, 0x2c,
+    0x04, 0x28, 0x1b, 0x06, 0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x02, 0x04, 0x0d, 0x21, 0x92, 0x15,
+    0x02, 0x24, 0x22, 0x24, 0x85, 0x29, 0x0e, 0x26, 0x0e, 0x09, 0x09, 0x08, 0x08, 0x25, 0x29, 0x29,
+    0x2c, 0x24, 0x28, 0x1b, 0x06, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02,
+    0x24, 0x22, 0x24, 0x85, 0x29, 0x0f, 0x26, 0x0e, 0x09, 0x09, 0x08, 0x08, 0x27, 0x2c, 0x29, 0x2c,
+    0x24, 0x28, 0x1b, 0x06, 0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x02, 0x04, 0x0d, 0x21, 0x92, 0x15,
+    0x02, 0x24, 0x22, 0x24, 0x85, 0x29, 0x82, 0x15, 0x04, 0x07, 0x08, 0x08, 0x12, 0x29, 0x82, 0x2c,
+    0x03, 0x28, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x04, 0x24,
+    0x24, 0x22, 0x29, 0x29, 0x82, 0x2c, 0x0f, 0x28, 0x11, 0x16, 0x0e, 0x09, 0x09, 0x08, 0x15, 0x24,
+    0x29, 0x2c, 0x24, 0x28, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15,
+    0x02, 0x24, 0x22, 0x24, 0x85, 0x29, 0x06, 0x15, 0x0e, 0x09, 0x09, 0x08, 0x08, 0x25, 0x82, 0x29,
+    0x04, 0x2c, 0x24, 0x1b, 0x06, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02,
+    0x24, 0x22, 0x24, 0x85, 0x29, 0x06, 0x15, 0x0e, 0x0e, 0x09, 0x09, 0x08, 0x29, 0x83, 0x2c, 0x04,
+    0x29, 0x1b, 0x06, 0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x02, 0x04, 0x0d, 0x21, 0x92, 0x15, 0x02,
+    0x24, 0x22, 0x24, 0x85, 0x29, 0x0e, 0x15, 0x0e, 0x0e, 0x0b, 0x14, 0x25, 0x2c, 0x2c, 0x29, 0x29,
+    0x2c, 0x24, 0x1b, 0x06, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02, 0x24,
+    0x24, 0x22, 0x82, 0x29, 0x82, 0x2c, 0x04, 0x28, 0x07, 0x12, 0x29, 0x29, 0x83, 0x2c, 0x05, 0x29,
+    0x2c, 0x28, 0x1b, 0x06, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02, 0x24,
+    0x24, 0x22, 0x83, 0x29, 0x82, 0x2c, 0x02, 0x28, 0x1b, 0x29, 0x83, 0x2c, 0x06, 0x29, 0x2c, 0x28,
+    0x1b, 0x1c, 0x06, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02, 0x24, 0x24,
+    0x22, 0x84, 0x29, 0x83, 0x2c, 0x02, 0x29, 0x2c, 0x28, 0x84, 0x29, 0x03, 0x22, 0x1d, 0x06, 0x21,
+    0xa7, 0x2e, 0xa9, 0x2e, 0x01, 0x04, 0x0d, 0x93, 0x15, 0x02, 0x24, 0x22, 0x24, 0x85, 0x29, 0x01,
+    0x26, 0x29, 0x83, 0x2c, 0x08, 0x29, 0x2c, 0x28, 0x29, 0x29, 0x1a, 0x1a, 0x0d, 0x21, 0xa7, 0x2e,
+    0xa9, 0x2e, 0x04, 0x04, 0x18, 0x11, 0x16, 0x0e, 0x90, 0x15, 0x02, 0x24, 0x24, 0x22, 0x85, 0x29,
+    0x83, 0x2c, 0x0a, 0x29, 0x2c, 0x28, 0x29, 0x29, 0x24, 0x16, 0x26, 0x1e, 0x0d, 0x21, 0xa7, 0x2e,
+    0xa9, 0x2e, 0x00, 0x04, 0x82, 0x18, 0x02, 0x11, 0x16, 0x0e, 0x8e, 0x15, 0x82, 0x24, 0x84, 0x2c,
+    0x02, 0x29, 0x1b, 0x29, 0x83, 0x2c, 0x09, 0x29, 0x1b, 0x1b, 0x0e, 0x27, 0x25, 0x24, 0x0d, 0x21,
+    0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x00, 0x04, 0x84, 0x18, 0x02, 0x0d, 0x0a, 0x1a, 0x8c, 0x15, 0x82,
+    0x24, 0x84, 0x2c, 0x0f, 0x29, 0x1b, 0x29, 0x29, 0x2c, 0x24, 0x28, 0x1b, 0x17, 0x27, 0x2c, 0x29,
+    0x25, 0x24, 0x0d, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x00, 0x04, 0x86, 0x18, 0x03, 0x0d, 0x11, 0x16,
+    0x0e, 0x89, 0x15, 0x02, 0x24, 0x24, 0x22, 0x86, 0x29, 0x0e, 0x2c, 0x24, 0x28, 0x1b, 0x17, 0x27,
+    0x2c, 0x29, 0x25, 0x27, 0x25, 0x1e, 0x0d, 0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x00, 0x04, 0x88,
+    0x18, 0x01, 0x07, 0x12, 0x89, 0x15, 0x02, 0x24, 0x24, 0x22, 0x87, 0x29, 0x0c, 0x22, 0x16, 0x1f,
+    0x25, 0x24, 0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x0d, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x00, 0x04,
+    0x86, 0x18, 0x00, 0x17, 0x82, 0x18, 0x01, 0x0d, 0x11, 0x87, 0x15, 0x82, 0x24, 0x84, 0x2c, 0x0f,
+    0x29, 0x1b, 0x1a, 0x1a, 0x2c, 0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x27, 0x25, 0x1e, 0x0d, 0x21,
+    0xa7, 0x2e, 0xa9, 0x2e, 0x00, 0x04, 0x84, 0x18, 0x00, 0x17, 0x84, 0x18, 0x03, 0x17, 0x18, 0x07,
+    0x12, 0x85, 0x15, 0x02, 0x24, 0x24, 0x22, 0x84, 0x29, 0x10, 0x1a, 0x1a, 0x2c, 0x27, 0x27, 0x2c,
+    0x29, 0x25, 0x27, 0x1e, 0x27, 0x27, 0x25, 0x1e, 0x0d, 0x21, 0x2c, 0xa6, 0x2e, 0xa9, 0x2e, 0x00,
+    0x04, 0x84, 0x18, 0x00, 0x17, 0x85, 0x18, 0x04, 0x17, 0x18, 0x18, 0x07, 0x12, 0x83, 0x15, 0x02,
+    0x24, 0x24, 0x22, 0x82, 0x29, 0x07, 0x1b, 0x12, 0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x82, 0x27,
+    0x06, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x0d, 0x21, 0xa7, 0x2e, 0xa9, 0x2e, 0x00, 0x04, 0x84, 0x18,
+    0x00, 0x17, 0x86, 0x18, 0x00, 0x17, 0x82, 0x18, 0x11, 0x07, 0x12, 0x15, 0x15, 0x24, 0x22, 0x24,
+    0x29, 0x29, 0x16, 0x26, 0x1e, 0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x83, 0x27, 0x05, 0x2c, 0x29,
+    0x25, 0x1d, 0x0a, 0x1a, 0xa7, 0x2e, 0xa9, 0x2e, 0x00, 0x04, 0x87, 0x18, 0x00, 0x17, 0x87, 0x18,
+    0x0e, 0x17, 0x18, 0x07, 0x11, 0x1d, 0x24, 0x16, 0x1a, 0x26, 0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e,
+    0x84, 0x27, 0x07, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x27, 0x11, 0x1d, 0xa7, 0x2e, 0xa9, 0x2e, 0x00,
+    0x05, 0x84, 0x18, 0x00, 0x17, 0x88, 0x18, 0x00, 0x17, 0x84, 0x18, 0x09, 0x15, 0x15, 0x24, 0x24,
+    0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x85, 0x27, 0x07, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x27, 0x11,
+    0x22, 0xa7, 0x2e, 0xa9, 0x2e, 0x00, 0x06, 0x84, 0x18, 0x00, 0x17, 0x84, 0x18, 0x00, 0x15, 0x84,
+    0x18, 0x00, 0x17, 0x83, 0x18, 0x82, 0x20, 0x05, 0x27, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x86, 0x27,
+    0x06, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x05, 0x2d, 0xa7, 0x2e, 0xa9, 0x2e, 0x02, 0x16, 0x0a, 0x17,
+    0x85, 0x18, 0x00, 0x17, 0x84, 0x18, 0x00, 0x15, 0x85, 0x18, 0x08, 0x20, 0x20, 0x27, 0x27, 0x2c,
+    0x29, 0x25, 0x27, 0x1e, 0x87, 0x27, 0x05, 0x2c, 0x29, 0x25, 0x0d, 0x0a, 0x28, 0xa8, 0x2e, 0xaa,
+    0x2e, 0x04, 0x22, 0x06, 0x07, 0x1b, 0x24, 0x84, 0x18, 0x00, 0x17, 0x84, 0x18, 0x00, 0x15, 0x84,
+    0x18, 0x01, 0x20, 0x20, 0x82, 0x27, 0x04, 0x2c, 0x29, 0x25, 0x27, 0x1e, 0x86, 0x27, 0x02, 0x15,
+    0x05, 0x18, 0xaa, 0x2e, 0xac, 0x2e, 0x04, 0x21, 0x06, 0x07, 0x1b, 0x24, 0x85, 0x18, 0x00, 0x17,
+    0x84, 0x18, 0x04, 0x15, 0x18, 0x18, 0x20, 0x20, 0x83, 0x27, 0x04, 0x2c, 0x29, 0x25, 0x27, 0x1e,
+    0x84, 0x27, 0x02, 0x05, 0x13, 0x2d, 0xab, 0x2e, 0xae, 0x2e, 0x02, 0x21, 0x06, 0x07, 0x84, 0x18,
+    0x00, 0x17, 0x84, 0x18, 0x02, 0x15, 0x18, 0x18, 0x82, 0x20, 0x84, 0x27, 0x0b, 0x2c, 0x29, 0x25,
+    0x27, 0x1e, 0x27, 0x27, 0x0a, 0x0f, 0x2b, 0x2e, 0x2c, 0xab, 0x2e, 0xb0, 0x2e, 0x02, 0x1a, 0x05,
+    0x13, 0x84, 0x18, 0x00, 0x17, 0x84, 0x18, 0x02, 0x15, 0x20, 0x20, 0x85, 0x27, 0x07, 0x2c, 0x29,
+    0x25, 0x27, 0x1e, 0x0d, 0x05, 0x18, 0xaf, 0x2e, 0xb2, 0x2e, 0x03, 0x1a, 0x05, 0x11, 0x1d, 0x84,
+    0x18, 0x00, 0x17, 0x83, 0x18, 0x82, 0x20, 0x86, 0x27, 0x02, 0x17, 0x05, 0x18, 0xb1, 0x2e, 0x92,
+    0x2e, 0x00, 0x2d, 0xa0, 0x2e, 0x03, 0x16, 0x03, 0x11, 0x1d, 0x85, 0x18, 0x03, 0x17, 0x18, 0x20,
+    0x20, 0x86, 0x27, 0x04, 0x06, 0x0f, 0x29, 0x2e, 0x2c, 0xb0, 0x2e, 0xb6, 0x2e, 0x02, 0x13, 0x05,
+    0x13, 0x85, 0x18, 0x82, 0x20, 0x84, 0x27, 0x03, 0x07, 0x06, 0x29, 0x2c, 0xb3, 0x2e, 0x8d, 0x2e,
+    0x00, 0x2d, 0xa9, 0x2e, 0x02, 0x13, 0x05, 0x12, 0x84, 0x18, 0x07, 0x20, 0x20, 0x27, 0x25, 0x1e,
+    0x0d, 0x05, 0x18, 0xb6, 0x2e, 0x91, 0x2e, 0x00, 0x2d, 0xa7, 0x2e, 0x01, 0x0f, 0x05, 0x83, 0x18,
+    0x82, 0x20, 0x03, 0x17, 0x05, 0x16, 0x2a, 0xb7, 0x2e, 0x8b, 0x2e, 0x00, 0x2d, 0xaf, 0x2e, 0x0a,
+    0x0f, 0x05, 0x11, 0x1d, 0x18, 0x11, 0x06, 0x0f, 0x29, 0x2e, 0x2c, 0xb7, 0x2e, 0xbe, 0x2e, 0x05,
+    0x0f, 0x10, 0x16, 0x1a, 0x28, 0x2c, 0xba, 0x2e, 0x82, 0x2e, 0x00, 0x2d, 0xf6, 0x2e, 0x00, 0x2d,
+    0x83, 0x2e, 0x89, 0x2e, 0x00, 0x2d, 0xf4, 0x2e, 0xf3, 0x2e, 0x00, 0x2d, 0x8a, 0x2e, 0xff, 0x2e,
+    0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xff, 0x2e, 0xae, 0x2e, 0x00, 0x2c, 0xcf, 0x2e, 0x95, 0x2e,
+    0x00, 0x2c, 0xc4, 0x2e, 0x00, 0x2c, 0xa2, 0x2e, 0xc4, 0x2e, 0x00, 0x2c, 0xb9, 0x2e, 0xae, 0x2e,
+    0x00, 0x2c, 0xcf, 0x2e, 0x99, 0x2e, 0x00, 0x2c, 0xc8, 0x2e, 0x00, 0x2c, 0x9a, 0x2e, 0x83, 0x2e,
+    0x00, 0x2d, 0xcb, 0x2e, 0x00, 0x2c, 0xad, 0x2e, 0xde, 0x2e, 0x00, 0x2d, 0x9f, 0x2e, 0xab, 0x2e,
+    0x00, 0x2d, 0xc6, 0x2e, 0x00, 0x2d, 0x8a, 0x2e, 0xde, 0x2e, 0x00, 0x2d, 0x9f, 0x2e, 0xc6, 0x2e,
+    0x00, 0x2d, 0xb7, 0x2e, 0xdf, 0x2e, 0x00, 0x2d, 0x9e, 0x2e, 0xff, 0x2e, 0xe1, 0x2e, 0x00, 0x2d,
+    0x9c, 0x2e, 0xa9, 0x2e, 0x00, 0x2d, 0xd4, 0x2e, 0xe4, 0x2e, 0x00, 0x2d, 0x99, 0x2e, 0xbc, 0x2e,
+    0x00, 0x2d, 0xc1, 0x2e, 0xe8, 0x2e, 0x00, 0x2d, 0x95, 0x2e, 0x8d, 0x2e, 0x00, 0x2d, 0xe3, 0x2e,
+    0x00, 0x2d, 0x8b, 0x2e, 0xed, 0x2e, 0x00, 0x2d, 0x90, 0x2e,
+};
+
+// 56 colors, 4067 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_5[] = {
+    0x4a8b, 0x52cb, 0x62ec, 0x630b, 0x63b1, 0x6b8e, 0x7432, 0x83ce, 0x84f4, 0x8c4f, 0x8c92, 0x9556,
+    0x95b8, 0x95f9, 0x9cf3, 0x9d78, 0xa4d4, 0xa557, 0xa639, 0xad55, 0xad78, 0xadb5, 0xadb7, 0xadd9,
+    0xb5b6, 0xb5f9, 0xb639, 0xbdf7, 0xbe7a, 0xc638, 0xc67a, 0xc6ba, 0xc6bb, 0xceba, 0xcebb, 0xcefb,
+    0xcefd, 0xd679, 0xd6ba, 0xd6bb, 0xd6fb, 0xd6fc, 0xdefb, 0xdf3d, 0xdf7e, 0xe73c, 0xe73d, 0xe77c,
+    0xe77d, 0xe77e, 0xe7bf, 0xef7d, 0xefbe, 0xefbf, 0xf7be, 0xffff,
+};
+static constexpr uint16_t mac_row_5[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 74, 76, 82,
+    84, 86, 88, 94, 104, 106, 108, 121, 138, 157, 174, 194, 209, 234, 264, 291,
+    324, 356, 391, 426, 458, 486, 519, 554, 589, 623, 662, 706, 754, 803, 848, 891,
+    937, 984, 1029, 1074, 1118, 1161, 1208, 1255, 1302, 1351, 1397, 1438, 1486, 1536, 1589, 1639,
+    1692, 1739, 1792, 1844, 1896, 1947, 1999, 2051, 2102, 2163, 2216, 2265, 2313, 2365, 2418, 2469,
+    2514, 2560, 2605, 2649, 2692, 2741, 2785, 2831, 2878, 2922, 2966, 3010, 3048, 3083, 3124, 3163,
+    3206, 3244, 3284, 3322, 3362, 3393, 3431, 3461, 3493, 3518, 3539, 3557, 3567, 3569, 3575, 3585,
+    3591, 3597, 3607, 3617, 3623, 3633, 3639, 3645, 3651, 3653, 3659, 3665, 3671, 3677, 3683, 3693,
+};
+static constexpr uint8_t mac_code_5[] = {
+    0xff, 0x37, 0xd8, 0x37, 0x00, 0x36, 0xa5, 0x37, 0x86, 0x37, 0x00, 0x36, 0xc9, 0x37, 0x00, 0x36,
+    0xac, 0x37, 0xbf, 0x37, 0x00, 0x36, 0xbe, 0x37, 0xff, 0x37, 0xa7, 0x37, 0x00, 0x36, 0xd6, 0x37,
+    0x9d, 0x37, 0x00, 0x36, 0xcb, 0x37, 0x00, 0x36, 0x93, 0x37, 0x90, 0x37, 0x00, 0x36, 0xe8, 0x37,
+    0x00, 0x36, 0x83, 0x37, 0xff, 0x37, 0xe5, 0x37, 0x00, 0x36, 0x98, 0x37, 0xb8, 0x37, 0x00, 0x36,
+    0xc5, 0x37, 0xd1, 0x37, 0x00, 0x36, 0xac, 0x37, 0xff, 0x37, 0xff, 0x37, 0x87, 0x37, 0x00, 0x36,
+    0xf6, 0x37, 0xff, 0x37, 0xff, 0x37, 0xff, 0x37, 0xfa, 0x37, 0x00, 0x36, 0x83, 0x37, 0x8b, 0x37,
+    0x00, 0x36, 0xef, 0x37, 0x02, 0x36, 0x37, 0x37, 0xff, 0x37, 0xff, 0x37, 0xaa, 0x37, 0x07, 0x1d,
+    0x0e, 0x0a, 0x0e, 0x0a, 0x0a, 0x0e, 0x2a, 0xcc, 0x37, 0xa8, 0x37, 0x04, 0x10, 0x0e, 0x1e, 0x1e,
+    0x1b, 0x82, 0x16, 0x03, 0x1d, 0x1b, 0x0a, 0x2d, 0xca, 0x37, 0xa6, 0x37, 0x05, 0x1d, 0x0e, 0x28,
+    0x1b, 0x0a, 0x11, 0x84, 0x16, 0x04, 0x0e, 0x1e, 0x15, 0x15, 0x36, 0xc8, 0x37, 0xa5, 0x37, 0x04,
+    0x1b, 0x16, 0x21, 0x0a, 0x0e, 0x88, 0x16, 0x03, 0x0b, 0x1e, 0x0a, 0x2d, 0xc7, 0x37, 0xa4, 0x37,
+    0x03, 0x25, 0x16, 0x1e, 0x0b, 0x8b, 0x16, 0x03, 0x0e, 0x1e, 0x15, 0x1d, 0xbd, 0x37, 0x00, 0x36,
+    0x87, 0x37, 0xa4, 0x37, 0x02, 0x0a, 0x2d, 0x0e, 0x8e, 0x16, 0x03, 0x1b, 0x1d, 0x0e, 0x36, 0xc4,
+    0x37, 0xa3, 0x37, 0x02, 0x1d, 0x1e, 0x0b, 0x85, 0x16, 0x01, 0x08, 0x0e, 0x83, 0x16, 0x08, 0x0e,
+    0x08, 0x0e, 0x0b, 0x08, 0x06, 0x1e, 0x0b, 0x26, 0xc3, 0x37, 0xa3, 0x37, 0x02, 0x0e, 0x1e, 0x15,
+    0x82, 0x16, 0x09, 0x06, 0x0a, 0x1b, 0x1d, 0x1d, 0x0e, 0x06, 0x16, 0x16, 0x0b, 0x83, 0x24, 0x05,
+    0x1a, 0x0a, 0x1b, 0x1b, 0x0a, 0x33, 0xc1, 0x37, 0xa3, 0x37, 0x06, 0x0a, 0x1e, 0x0b, 0x16, 0x08,
+    0x0e, 0x2d, 0x84, 0x37, 0x02, 0x1b, 0x05, 0x19, 0x86, 0x24, 0x05, 0x20, 0x16, 0x1e, 0x10, 0x1b,
+    0x36, 0xbf, 0x37, 0x86, 0x37, 0x00, 0x36, 0x9b, 0x37, 0x04, 0x01, 0x1e, 0x1b, 0x06, 0x1e, 0x85,
+    0x37, 0x02, 0x25, 0x06, 0x1e, 0x83, 0x24, 0x00, 0x20, 0x83, 0x24, 0x05, 0x20, 0x24, 0x16, 0x1e,
+    0x0a, 0x1e, 0xbe, 0x37, 0xa2, 0x37, 0x04, 0x25, 0x0e, 0x1e, 0x05, 0x2a, 0x84, 0x37, 0x03, 0x2d,
+    0x0a, 0x0e, 0x2a, 0x83, 0x24, 0x00, 0x20, 0x84, 0x24, 0x07, 0x20, 0x24, 0x24, 0x19, 0x1b, 0x1d,
+    0x0a, 0x2d, 0xbc, 0x37, 0x02, 0x37, 0x37, 0x36, 0x9f, 0x37, 0x04, 0x1b, 0x23, 0x1d, 0x0e, 0x36,
+    0x83, 0x37, 0x02, 0x15, 0x0a, 0x1e, 0x83, 0x24, 0x00, 0x20, 0x85, 0x24, 0x00, 0x20, 0x84, 0x24,
+    0x82, 0x16, 0x01, 0x0e, 0x2d, 0xba, 0x37, 0x83, 0x37, 0x00, 0x36, 0x9d, 0x37, 0x09, 0x0e, 0x2c,
+    0x1c, 0x1d, 0x0e, 0x28, 0x13, 0x0a, 0x0e, 0x16, 0x83, 0x24, 0x00, 0x20, 0x87, 0x24, 0x00, 0x20,
+    0x86, 0x24, 0x04, 0x16, 0x1d, 0x1b, 0x13, 0x33, 0xb8, 0x37, 0x02, 0x37, 0x37, 0x36, 0x9f, 0x37,
+    0x06, 0x0a, 0x2d, 0x37, 0x1b, 0x16, 0x17, 0x20, 0x83, 0x24, 0x00, 0x20, 0x89, 0x24, 0x00, 0x20,
+    0x89, 0x24, 0x04, 0x16, 0x1e, 0x10, 0x18, 0x36, 0xb6, 0x37, 0xa2, 0x37, 0x06, 0x0a, 0x2d, 0x37,
+    0x2c, 0x1c, 0x16, 0x1e, 0x83, 0x24, 0x00, 0x20, 0x8b, 0x24, 0x00, 0x20, 0x88, 0x24, 0x04, 0x1c,
+    0x16, 0x1e, 0x10, 0x18, 0xb5, 0x37, 0x86, 0x37, 0x00, 0x36, 0x9a, 0x37, 0x07, 0x0a, 0x2d, 0x37,
+    0x2c, 0x2b, 0x1b, 0x16, 0x21, 0x83, 0x24, 0x00, 0x20, 0x8c, 0x24, 0x00, 0x20, 0x88, 0x24, 0x04,
+    0x1c, 0x1b, 0x1d, 0x0a, 0x26, 0xb3, 0x37, 0x84, 0x37, 0x00, 0x36, 0x9c, 0x37, 0x09, 0x0a, 0x2d,
+    0x22, 0x1e, 0x1e, 0x2c, 0x1c, 0x16, 0x16, 0x1e, 0x84, 0x24, 0x00, 0x20, 0x8d, 0x24, 0x00, 0x20,
+    0x86, 0x24, 0x04, 0x17, 0x1b, 0x1d, 0x0a, 0x2d, 0xb1, 0x37, 0x87, 0x37, 0x00, 0x36, 0x99, 0x37,
+    0x0a, 0x0a, 0x2d, 0x22, 0x29, 0x2b, 0x32, 0x32, 0x1b, 0x1d, 0x1d, 0x1c, 0x83, 0x24, 0x00, 0x20,
+    0x8e, 0x24, 0x00, 0x20, 0x87, 0x24, 0x03, 0x16, 0x1e, 0x10, 0x18, 0xb0, 0x37, 0xa2, 0x37, 0x0c,
+    0x0e, 0x2b, 0x32, 0x1d, 0x2b, 0x32, 0x32, 0x1b, 0x17, 0x1b, 0x1e, 0x0b, 0x26, 0x83, 0x24, 0x00,
+    0x20, 0x8f, 0x24, 0x00, 0x20, 0x86, 0x24, 0x04, 0x17, 0x1d, 0x0e, 0x18, 0x36, 0xad, 0x37, 0x02,
+    0x37, 0x37, 0x36, 0x9f, 0x37, 0x0d, 0x15, 0x2b, 0x32, 0x1d, 0x2b, 0x32, 0x16, 0x16, 0x20, 0x24,
+    0x16, 0x1e, 0x1b, 0x1d, 0x83, 0x24, 0x00, 0x20, 0x90, 0x24, 0x00, 0x20, 0x86, 0x24, 0x04, 0x17,
+    0x1d, 0x0e, 0x16, 0x36, 0xab, 0x37, 0x02, 0x37, 0x37, 0x36, 0x9f, 0x37, 0x11, 0x1d, 0x1e, 0x32,
+    0x32, 0x31, 0x11, 0x16, 0x1c, 0x24, 0x20, 0x24, 0x16, 0x16, 0x1e, 0x1b, 0x1c, 0x24, 0x20, 0x83,
+    0x24, 0x00, 0x20, 0x91, 0x24, 0x00, 0x20, 0x82, 0x24, 0x05, 0x1a, 0x1b, 0x1d, 0x0a, 0x26, 0x33,
+    0xa9, 0x37, 0x82, 0x37, 0x00, 0x36, 0x9e, 0x37, 0x11, 0x1d, 0x1a, 0x32, 0x29, 0x0b, 0x16, 0x19,
+    0x24, 0x20, 0x24, 0x20, 0x24, 0x20, 0x17, 0x1b, 0x1e, 0x16, 0x1e, 0x85, 0x24, 0x00, 0x20, 0x92,
+    0x24, 0x0d, 0x20, 0x24, 0x24, 0x19, 0x1b, 0x1d, 0x1d, 0x10, 0x1b, 0x10, 0x0e, 0x0e, 0x0a, 0x26,
+    0xa2, 0x37, 0x82, 0x37, 0x00, 0x36, 0x9e, 0x37, 0x0b, 0x2a, 0x0b, 0x16, 0x0b, 0x16, 0x19, 0x1a,
+    0x20, 0x24, 0x20, 0x20, 0x24, 0x82, 0x20, 0x03, 0x16, 0x1d, 0x1b, 0x13, 0x83, 0x24, 0x00, 0x20,
+    0x93, 0x24, 0x00, 0x20, 0x83, 0x24, 0x04, 0x17, 0x13, 0x1b, 0x1d, 0x31, 0x82, 0x35, 0x01, 0x1b,
+    0x1d, 0xa1, 0x37, 0x82, 0x37, 0x00, 0x36, 0x9f, 0x37, 0x05, 0x05, 0x19, 0x19, 0x1b, 0x16, 0x1e,
+    0x82, 0x24, 0x01, 0x20, 0x24, 0x83, 0x20, 0x06, 0x1c, 0x16, 0x1d, 0x1b, 0x19, 0x24, 0x20, 0x83,
+    0x24, 0x00, 0x20, 0x93, 0x24, 0x02, 0x16, 0x1d, 0x2b, 0x86, 0x35, 0x01, 0x13, 0x33, 0xa0, 0x37,
+    0x82, 0x37, 0x00, 0x36, 0x9f, 0x37, 0x07, 0x06, 0x16, 0x19, 0x0b, 0x16, 0x19, 0x20, 0x24, 0x84,
+    0x20, 0x00, 0x24, 0x83, 0x20, 0x04, 0x11, 0x16, 0x1c, 0x1a, 0x20, 0x83, 0x24, 0x00, 0x20, 0x8f,
+    0x24, 0x02, 0x1c, 0x16, 0x1d, 0x8a, 0x35, 0x00, 0x13, 0xa0, 0x37, 0x89, 0x37, 0x00, 0x36, 0x97,
+    0x37, 0x0a, 0x2a, 0x06, 0x16, 0x19, 0x11, 0x16, 0x1b, 0x1d, 0x24, 0x20, 0x24, 0x85, 0x20, 0x07,
+    0x24, 0x20, 0x20, 0x1a, 0x1b, 0x1b, 0x16, 0x21, 0x84, 0x24, 0x00, 0x20, 0x8c, 0x24, 0x01, 0x16,
+    0x1e, 0x8c, 0x35, 0x02, 0x1d, 0x2b, 0x35, 0x9e, 0x37, 0xa2, 0x37, 0x07, 0x2a, 0x0b, 0x19, 0x1b,
+    0x19, 0x0b, 0x16, 0x1e, 0x82, 0x24, 0x02, 0x20, 0x20, 0x24, 0x86, 0x20, 0x05, 0x24, 0x16, 0x16,
+    0x18, 0x16, 0x1e, 0x82, 0x24, 0x01, 0x20, 0x20, 0x83, 0x24, 0x00, 0x20, 0x84, 0x24, 0x01, 0x16,
+    0x1e, 0x8f, 0x35, 0x01, 0x15, 0x36, 0x9e, 0x37, 0x8a, 0x37, 0x00, 0x36, 0x96, 0x37, 0x0a, 0x25,
+    0x0e, 0x19, 0x1b, 0x19, 0x1c, 0x24, 0x20, 0x24, 0x20, 0x24, 0x87, 0x20, 0x00, 0x24, 0x84, 0x20,
+    0x83, 0x16, 0x83, 0x24, 0x00, 0x20, 0x85, 0x24, 0x01, 0x16, 0x1e, 0x8e, 0x35, 0x04, 0x2b, 0x32,
+    0x32, 0x13, 0x33, 0x9e, 0x37, 0x8a, 0x37, 0x00, 0x36, 0x96, 0x37, 0x07, 0x1d, 0x0e, 0x19, 0x1b,
+    0x19, 0x1c, 0x20, 0x24, 0x88, 0x20, 0x00, 0x24, 0x88, 0x20, 0x84, 0x16, 0x07, 0x1a, 0x20, 0x24,
+    0x22, 0x1e, 0x16, 0x16, 0x20, 0x8c, 0x35, 0x07, 0x2b, 0x1e, 0x0b, 0x08, 0x06, 0x0a, 0x1e, 0x0e,
+    0x9f, 0x37, 0x8f, 0x37, 0x00, 0x36, 0x91, 0x37, 0x08, 0x18, 0x16, 0x19, 0x1b, 0x19, 0x1c, 0x20,
+    0x20, 0x24, 0x89, 0x20, 0x00, 0x24, 0x88, 0x20, 0x83, 0x16, 0x03, 0x0e, 0x08, 0x1b, 0x28, 0x8d,
+    0x35, 0x09, 0x1e, 0x0b, 0x06, 0x0a, 0x08, 0x0e, 0x08, 0x06, 0x0a, 0x0a, 0x9f, 0x37, 0x85, 0x37,
+    0x00, 0x36, 0x9b, 0x37, 0x05, 0x18, 0x14, 0x19, 0x1b, 0x19, 0x1c, 0x82, 0x20, 0x00, 0x24, 0x8a,
+    0x20, 0x00, 0x24, 0x88, 0x20, 0x00, 0x16, 0x8f, 0x35, 0x0c, 0x2b, 0x19, 0x0a, 0x06, 0x0a, 0x08,
+    0x08, 0x0e, 0x08, 0x08, 0x0e, 0x08, 0x07, 0x9f, 0x37, 0xa2, 0x37, 0x05, 0x0e, 0x16, 0x19, 0x1b,
+    0x19, 0x1c, 0x83, 0x20, 0x00, 0x24, 0x8b, 0x20, 0x00, 0x24, 0x86, 0x20, 0x01, 0x19, 0x24, 0x82,
+    0x35, 0x02, 0x1e, 0x1e, 0x22, 0x87, 0x35, 0x04, 0x15, 0x0a, 0x06, 0x08, 0x0e, 0x82, 0x08, 0x00,
+    0x0e, 0x82, 0x08, 0x01, 0x0b, 0x08, 0x9f, 0x37, 0xa2, 0x37, 0x04, 0x0e, 0x19, 0x1b, 0x19, 0x1c,
+    0x84, 0x20, 0x00, 0x24, 0x8c, 0x20, 0x00, 0x24, 0x86, 0x20, 0x00, 0x19, 0x82, 0x35, 0x82, 0x1e,
+    0x00, 0x2c, 0x84, 0x35, 0x05, 0x1f, 0x0e, 0x0a, 0x0a, 0x08, 0x0e, 0x82, 0x08, 0x02, 0x0b, 0x08,
+    0x0e, 0x82, 0x08, 0x00, 0x09, 0x9f, 0x37, 0xa2, 0x37, 0x04, 0x09, 0x19, 0x1b, 0x19, 0x1c, 0x85,
+    0x20, 0x00, 0x24, 0x8d, 0x20, 0x00, 0x24, 0x84, 0x20, 0x00, 0x16, 0x84, 0x35, 0x01, 0x1f, 0x22,
+    0x83, 0x35, 0x03, 0x1b, 0x0a, 0x08, 0x0e, 0x82, 0x08, 0x03, 0x0b, 0x08, 0x08, 0x0e, 0x82, 0x08,
+    0x02, 0x0b, 0x08, 0x09, 0x9f, 0x37, 0xa2, 0x37, 0x04, 0x07, 0x19, 0x1b, 0x19, 0x1c, 0x86, 0x20,
+    0x00, 0x24, 0x8e, 0x20, 0x00, 0x24, 0x82, 0x20, 0x0d, 0x16, 0x2e, 0x35, 0x21, 0x2b, 0x32, 0x1d,
+    0x2b, 0x35, 0x35, 0x29, 0x0b, 0x06, 0x0a, 0x82, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x82,
+    0x08, 0x00, 0x0e, 0x82, 0x08, 0x9f, 0x37, 0xa2, 0x37, 0x04, 0x09, 0x19, 0x1b, 0x19, 0x1c, 0x87,
+    0x20, 0x00, 0x24, 0x8f, 0x20, 0x0d, 0x24, 0x20, 0x20, 0x1a, 0x35, 0x21, 0x1e, 0x35, 0x21, 0x1e,
+    0x35, 0x21, 0x06, 0x0a, 0x83, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x83, 0x08, 0x03, 0x0e,
+    0x08, 0x08, 0x09, 0x9f, 0x37, 0xa2, 0x37, 0x04, 0x07, 0x19, 0x1b, 0x19, 0x1c, 0x88, 0x20, 0x00,
+    0x24, 0x8f, 0x20, 0x03, 0x1c, 0x24, 0x16, 0x2e, 0x84, 0x35, 0x02, 0x1f, 0x06, 0x0a, 0x84, 0x08,
+    0x00, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x84, 0x08, 0x02, 0x0e, 0x06, 0x07, 0x9f, 0x37, 0xa2, 0x37,
+    0x00, 0x05, 0x82, 0x19, 0x02, 0x1b, 0x20, 0x24, 0x8f, 0x20, 0x02, 0x1c, 0x20, 0x24, 0x83, 0x20,
+    0x04, 0x11, 0x16, 0x1e, 0x24, 0x11, 0x83, 0x35, 0x04, 0x2b, 0x0a, 0x0e, 0x08, 0x0e, 0x82, 0x08,
+    0x00, 0x0b, 0x85, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x02, 0x0b, 0x08, 0x09, 0x9f, 0x37, 0xa2, 0x37,
+    0x00, 0x05, 0x82, 0x19, 0x05, 0x1a, 0x20, 0x24, 0x22, 0x20, 0x24, 0x86, 0x20, 0x03, 0x0b, 0x16,
+    0x20, 0x24, 0x88, 0x20, 0x05, 0x16, 0x16, 0x1a, 0x20, 0x1c, 0x1d, 0x82, 0x35, 0x02, 0x1e, 0x06,
+    0x0a, 0x85, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x01, 0x0b, 0x08, 0x9f, 0x37,
+    0xa2, 0x37, 0x05, 0x07, 0x19, 0x19, 0x1b, 0x19, 0x1c, 0x86, 0x20, 0x08, 0x16, 0x16, 0x20, 0x0b,
+    0x16, 0x0b, 0x1f, 0x20, 0x24, 0x88, 0x20, 0x0b, 0x0b, 0x1e, 0x20, 0x24, 0x16, 0x22, 0x35, 0x35,
+    0x0b, 0x08, 0x08, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x02, 0x0b, 0x08, 0x0e, 0x82, 0x08,
+    0x01, 0x0b, 0x0a, 0x9f, 0x37, 0xa2, 0x37, 0x05, 0x09, 0x19, 0x19, 0x1b, 0x19, 0x1c, 0x85, 0x20,
+    0x0a, 0x0b, 0x16, 0x19, 0x1a, 0x08, 0x0c, 0x0b, 0x1e, 0x20, 0x20, 0x24, 0x8c, 0x20, 0x06, 0x16,
+    0x2e, 0x35, 0x0e, 0x0a, 0x08, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x07, 0x0b, 0x1a, 0x1b,
+    0x1b, 0x08, 0x0e, 0x08, 0x08, 0x9f, 0x37, 0xa2, 0x37, 0x05, 0x0e, 0x19, 0x19, 0x1b, 0x19, 0x1c,
+    0x85, 0x20, 0x00, 0x0b, 0x82, 0x12, 0x07, 0x0f, 0x08, 0x19, 0x24, 0x20, 0x24, 0x20, 0x24, 0x8c,
+    0x20, 0x06, 0x16, 0x30, 0x0e, 0x0a, 0x08, 0x08, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x82, 0x08, 0x09,
+    0x16, 0x1e, 0x1b, 0x1c, 0x1c, 0x1d, 0x08, 0x0e, 0x08, 0x08, 0x9f, 0x37, 0xa2, 0x37, 0x05, 0x13,
+    0x1b, 0x19, 0x1b, 0x19, 0x1c, 0x85, 0x20, 0x00, 0x0b, 0x82, 0x12, 0x06, 0x0f, 0x0c, 0x0b, 0x17,
+    0x20, 0x20, 0x24, 0x8e, 0x20, 0x02, 0x0b, 0x06, 0x0a, 0x86, 0x08, 0x0c, 0x0e, 0x1b, 0x1d, 0x1d,
+    0x1c, 0x1c, 0x1d, 0x1a, 0x0b, 0x08, 0x08, 0x0e, 0x0a, 0x9f, 0x37, 0xa2, 0x37, 0x05, 0x18, 0x14,
+    0x19, 0x1b, 0x19, 0x1c, 0x85, 0x20, 0x00, 0x0b, 0x83, 0x12, 0x09, 0x0f, 0x0c, 0x0c, 0x1a, 0x20,
+    0x24, 0x22, 0x20, 0x20, 0x24, 0x8a, 0x20, 0x13, 0x0b, 0x08, 0x08, 0x0e, 0x08, 0x0e, 0x08, 0x08,
+    0x11, 0x16, 0x1c, 0x1a, 0x1c, 0x1d, 0x1a, 0x19, 0x0b, 0x16, 0x08, 0x0e, 0x82, 0x08, 0x9f, 0x37,
+    0xa2, 0x37, 0x06, 0x1d, 0x0e, 0x19, 0x19, 0x1b, 0x19, 0x1c, 0x84, 0x20, 0x0a, 0x0b, 0x16, 0x19,
+    0x0d, 0x0c, 0x0b, 0x17, 0x0c, 0x0b, 0x20, 0x24, 0x8e, 0x20, 0x10, 0x0b, 0x0e, 0x0a, 0x08, 0x08,
+    0x0b, 0x16, 0x19, 0x20, 0x1c, 0x1d, 0x1a, 0x19, 0x1b, 0x16, 0x08, 0x0e, 0x82, 0x08, 0x02, 0x0b,
+    0x08, 0x09, 0x9f, 0x37, 0xa2, 0x37, 0x06, 0x26, 0x08, 0x19, 0x19, 0x1b, 0x19, 0x1c, 0x84, 0x20,
+    0x03, 0x0b, 0x12, 0x12, 0x0f, 0x82, 0x0c, 0x03, 0x0b, 0x20, 0x20, 0x24, 0x8e, 0x20, 0x16, 0x0b,
+    0x0e, 0x08, 0x0e, 0x08, 0x1b, 0x1d, 0x1d, 0x1c, 0x1c, 0x1a, 0x1b, 0x0b, 0x08, 0x08, 0x0e, 0x1b,
+    0x16, 0x17, 0x08, 0x0e, 0x08, 0x08, 0x9f, 0x37, 0xa2, 0x37, 0x06, 0x2a, 0x0b, 0x19, 0x19, 0x1b,
+    0x19, 0x1c, 0x84, 0x20, 0x00, 0x0b, 0x82, 0x12, 0x00, 0x0f, 0x82, 0x0c, 0x01, 0x20, 0x24, 0x8f,
+    0x20, 0x16, 0x0b, 0x08, 0x08, 0x0e, 0x08, 0x1a, 0x20, 0x1c, 0x1b, 0x16, 0x08, 0x08, 0x0e, 0x0b,
+    0x1a, 0x20, 0x1c, 0x1b, 0x1b, 0x0a, 0x08, 0x08, 0x0e, 0x9f, 0x37, 0xa2, 0x37, 0x07, 0x2a, 0x0a,
+    0x1b, 0x1b, 0x19, 0x1b, 0x19, 0x1c, 0x83, 0x20, 0x09, 0x0b, 0x16, 0x19, 0x0d, 0x0c, 0x0b, 0x17,
+    0x0c, 0x20, 0x24, 0x8f, 0x20, 0x16, 0x0b, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x1b, 0x16, 0x08, 0x08,
+    0x0b, 0x16, 0x19, 0x20, 0x1c, 0x1c, 0x1d, 0x1a, 0x13, 0x0a, 0x08, 0x0e, 0x08, 0x9f, 0x37, 0xa2,
+    0x37, 0x01, 0x2a, 0x08, 0x82, 0x19, 0x02, 0x1b, 0x19, 0x1c, 0x84, 0x20, 0x09, 0x0b, 0x12, 0x12,
+    0x0c, 0x0b, 0x17, 0x0c, 0x20, 0x20, 0x24, 0x8e, 0x20, 0x04, 0x0b, 0x0e, 0x08, 0x08, 0x0e, 0x82,
+    0x08, 0x0e, 0x0b, 0x1b, 0x1d, 0x1d, 0x1c, 0x1c, 0x1a, 0x1a, 0x1b, 0x0b, 0x08, 0x0e, 0x06, 0x0e,
+    0x0a, 0x9f, 0x37, 0xa2, 0x37, 0x06, 0x25, 0x0e, 0x19, 0x19, 0x1b, 0x19, 0x1c, 0x85, 0x20, 0x09,
+    0x0b, 0x12, 0x0c, 0x0b, 0x17, 0x0c, 0x0c, 0x1a, 0x20, 0x24, 0x8e, 0x20, 0x01, 0x0b, 0x0e, 0x82,
+    0x08, 0x11, 0x0e, 0x0b, 0x1a, 0x1c, 0x1d, 0x1a, 0x19, 0x1a, 0x1b, 0x1b, 0x08, 0x08, 0x0e, 0x08,
+    0x08, 0x06, 0x0a, 0x10, 0x9f, 0x37, 0xa2, 0x37, 0x15, 0x18, 0x14, 0x19, 0x19, 0x1b, 0x19, 0x1c,
+    0x1a, 0x20, 0x24, 0x22, 0x20, 0x20, 0x1a, 0x0b, 0x0c, 0x0b, 0x17, 0x0c, 0x0c, 0x16, 0x1e, 0x82,
+    0x24, 0x04, 0x20, 0x20, 0x24, 0x20, 0x24, 0x87, 0x20, 0x16, 0x0b, 0x08, 0x08, 0x0e, 0x08, 0x1a,
+    0x1c, 0x1d, 0x1a, 0x19, 0x1a, 0x1b, 0x16, 0x08, 0x08, 0x0b, 0x08, 0x0e, 0x08, 0x08, 0x06, 0x0e,
+    0x0a, 0x9f, 0x37, 0xa2, 0x37, 0x09, 0x25, 0x0b, 0x16, 0x19, 0x20, 0x1c, 0x19, 0x1b, 0x19, 0x1c,
+    0x84, 0x20, 0x04, 0x0b, 0x0b, 0x16, 0x0c, 0x0b, 0x82, 0x20, 0x00, 0x24, 0x8d, 0x20, 0x10, 0x0b,
+    0x08, 0x08, 0x0e, 0x08, 0x1a, 0x1c, 0x1c, 0x16, 0x1d, 0x0b, 0x08, 0x08, 0x0e, 0x08, 0x08, 0x0e,
+    0x82, 0x08, 0x02, 0x06, 0x0a, 0x10, 0x9f, 0x37, 0xa2, 0x37, 0x01, 0x18, 0x14, 0x82, 0x19, 0x05,
+    0x1b, 0x19, 0x1c, 0x1a, 0x20, 0x24, 0x85, 0x20, 0x05, 0x0b, 0x16, 0x0b, 0x1f, 0x20, 0x24, 0x8e,
+    0x20, 0x01, 0x0b, 0x0e, 0x82, 0x08, 0x05, 0x1b, 0x16, 0x17, 0x08, 0x08, 0x0e, 0x82, 0x08, 0x00,
+    0x0b, 0x84, 0x08, 0x02, 0x06, 0x0a, 0x10, 0x9f, 0x37, 0xa2, 0x37, 0x0c, 0x13, 0x0a, 0x19, 0x1b,
+    0x19, 0x0b, 0x16, 0x19, 0x20, 0x1c, 0x1c, 0x20, 0x24, 0x8f, 0x20, 0x03, 0x1c, 0x20, 0x20, 0x24,
+    0x84, 0x20, 0x07, 0x16, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x08, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85,
+    0x08, 0x04, 0x0b, 0x08, 0x06, 0x0a, 0x10, 0x9f, 0x37, 0xa2, 0x37, 0x0c, 0x18, 0x16, 0x19, 0x19,
+    0x0b, 0x1d, 0x1b, 0x19, 0x19, 0x1b, 0x20, 0x20, 0x24, 0x8f, 0x20, 0x00, 0x1c, 0x82, 0x20, 0x00,
+    0x24, 0x83, 0x20, 0x0e, 0x11, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x08, 0x08, 0x0e, 0x08, 0x08, 0x11,
+    0x17, 0x08, 0x0e, 0x82, 0x08, 0x04, 0x0b, 0x08, 0x06, 0x0a, 0x10, 0x9f, 0x37, 0xa2, 0x37, 0x06,
+    0x25, 0x1c, 0x1d, 0x1a, 0x13, 0x18, 0x16, 0x82, 0x19, 0x00, 0x1b, 0x82, 0x20, 0x00, 0x24, 0x8f,
+    0x20, 0x00, 0x1c, 0x83, 0x20, 0x05, 0x24, 0x20, 0x0b, 0x08, 0x08, 0x0e, 0x82, 0x08, 0x08, 0x0e,
+    0x08, 0x08, 0x11, 0x17, 0x19, 0x0a, 0x08, 0x0e, 0x82, 0x08, 0x04, 0x0b, 0x06, 0x0a, 0x15, 0x36,
+    0x9e, 0x37, 0xa2, 0x37, 0x0c, 0x33, 0x0e, 0x2c, 0x1a, 0x1b, 0x0b, 0x11, 0x16, 0x1c, 0x1a, 0x1c,
+    0x20, 0x24, 0x8f, 0x20, 0x00, 0x1c, 0x84, 0x20, 0x06, 0x24, 0x20, 0x20, 0x0b, 0x08, 0x08, 0x0e,
+    0x83, 0x08, 0x07, 0x0e, 0x08, 0x11, 0x1c, 0x1d, 0x08, 0x08, 0x0e, 0x82, 0x08, 0x04, 0x0b, 0x06,
+    0x0e, 0x16, 0x36, 0x9e, 0x37, 0xa3, 0x37, 0x0a, 0x06, 0x31, 0x35, 0x16, 0x1e, 0x1b, 0x1c, 0x19,
+    0x1b, 0x19, 0x1c, 0x89, 0x20, 0x00, 0x24, 0x8e, 0x20, 0x01, 0x0b, 0x0e, 0x83, 0x08, 0x00, 0x0e,
+    0x82, 0x08, 0x03, 0x0b, 0x1b, 0x08, 0x0e, 0x82, 0x08, 0x05, 0x0b, 0x08, 0x08, 0x06, 0x0a, 0x15,
+    0x9f, 0x37, 0xa3, 0x37, 0x0b, 0x1d, 0x1b, 0x1d, 0x24, 0x0b, 0x16, 0x19, 0x20, 0x1c, 0x19, 0x19,
+    0x1b, 0x83, 0x20, 0x00, 0x24, 0x8f, 0x20, 0x00, 0x1c, 0x82, 0x20, 0x03, 0x0b, 0x08, 0x08, 0x0e,
+    0x84, 0x08, 0x03, 0x0e, 0x08, 0x06, 0x0a, 0x86, 0x08, 0x03, 0x06, 0x0a, 0x1b, 0x36, 0x9e, 0x37,
+    0xa4, 0x37, 0x0d, 0x06, 0x1e, 0x24, 0x1a, 0x1b, 0x1b, 0x19, 0x1b, 0x19, 0x1c, 0x1a, 0x20, 0x20,
+    0x24, 0x8f, 0x20, 0x00, 0x1c, 0x84, 0x20, 0x03, 0x0b, 0x08, 0x08, 0x0e, 0x85, 0x08, 0x00, 0x0e,
+    0x82, 0x08, 0x00, 0x0b, 0x84, 0x08, 0x03, 0x06, 0x0e, 0x16, 0x36, 0x9e, 0x37, 0xa4, 0x37, 0x08,
+    0x18, 0x14, 0x32, 0x32, 0x0b, 0x16, 0x19, 0x20, 0x1c, 0x82, 0x19, 0x00, 0x1b, 0x84, 0x20, 0x00,
+    0x24, 0x8f, 0x20, 0x04, 0x1c, 0x0b, 0x08, 0x08, 0x0e, 0x86, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x00,
+    0x0b, 0x83, 0x08, 0x02, 0x06, 0x0a, 0x1b, 0x9f, 0x37, 0xa5, 0x37, 0x07, 0x15, 0x23, 0x32, 0x0b,
+    0x16, 0x19, 0x20, 0x1c, 0x83, 0x19, 0x00, 0x1b, 0x85, 0x20, 0x00, 0x24, 0x8e, 0x20, 0x01, 0x0b,
+    0x0e, 0x84, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x05, 0x0b, 0x08, 0x06, 0x0e,
+    0x16, 0x36, 0x9e, 0x37, 0xa6, 0x37, 0x0c, 0x06, 0x1e, 0x0b, 0x26, 0x19, 0x1b, 0x19, 0x1c, 0x1a,
+    0x19, 0x1b, 0x19, 0x1c, 0x8a, 0x20, 0x00, 0x24, 0x88, 0x20, 0x05, 0x0b, 0x0e, 0x0a, 0x08, 0x08,
+    0x0b, 0x82, 0x08, 0x06, 0x0e, 0x08, 0x11, 0x1f, 0x20, 0x08, 0x0e, 0x82, 0x08, 0x04, 0x0b, 0x06,
+    0x0e, 0x1b, 0x36, 0x9e, 0x37, 0xa7, 0x37, 0x06, 0x15, 0x05, 0x0b, 0x16, 0x19, 0x20, 0x1c, 0x84,
+    0x19, 0x00, 0x1b, 0x86, 0x20, 0x00, 0x24, 0x8b, 0x20, 0x03, 0x0b, 0x08, 0x08, 0x0e, 0x85, 0x08,
+    0x0d, 0x1a, 0x0a, 0x04, 0x1a, 0x0b, 0x0c, 0x08, 0x0e, 0x08, 0x08, 0x06, 0x0e, 0x1b, 0x36, 0x9e,
+    0x37, 0xa9, 0x37, 0x0a, 0x1d, 0x0e, 0x06, 0x17, 0x1b, 0x1e, 0x16, 0x19, 0x1b, 0x19, 0x1c, 0x8b,
+    0x20, 0x00, 0x24, 0x86, 0x20, 0x05, 0x0b, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x82, 0x08, 0x07, 0x16,
+    0x06, 0x00, 0x06, 0x16, 0x19, 0x08, 0x0e, 0x82, 0x08, 0x02, 0x06, 0x0b, 0x16, 0x9f, 0x37, 0xab,
+    0x37, 0x0a, 0x2d, 0x0a, 0x06, 0x16, 0x19, 0x11, 0x19, 0x1b, 0x19, 0x1c, 0x1a, 0x82, 0x20, 0x00,
+    0x24, 0x8d, 0x20, 0x05, 0x0b, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x82, 0x08, 0x07, 0x16, 0x00, 0x01,
+    0x0b, 0x16, 0x0b, 0x08, 0x0e, 0x82, 0x08, 0x03, 0x06, 0x0b, 0x1b, 0x36, 0x9e, 0x37, 0xae, 0x37,
+    0x09, 0x18, 0x06, 0x16, 0x19, 0x11, 0x19, 0x19, 0x1b, 0x19, 0x1c, 0x8c, 0x20, 0x08, 0x24, 0x20,
+    0x20, 0x0b, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x82, 0x08, 0x06, 0x16, 0x00, 0x08, 0x19, 0x19, 0x08,
+    0x0e, 0x82, 0x08, 0x03, 0x0b, 0x06, 0x0e, 0x1b, 0x9f, 0x37, 0xb0, 0x37, 0x04, 0x15, 0x06, 0x16,
+    0x19, 0x11, 0x82, 0x19, 0x00, 0x1b, 0x87, 0x20, 0x00, 0x24, 0x85, 0x20, 0x05, 0x0b, 0x0e, 0x0a,
+    0x08, 0x08, 0x0b, 0x82, 0x08, 0x07, 0x16, 0x0b, 0x16, 0x19, 0x1a, 0x08, 0x08, 0x0e, 0x82, 0x08,
+    0x02, 0x06, 0x0a, 0x1b, 0x9f, 0x37, 0xb2, 0x37, 0x08, 0x1b, 0x05, 0x11, 0x16, 0x1c, 0x1a, 0x1c,
+    0x19, 0x1b, 0x88, 0x20, 0x00, 0x24, 0x82, 0x20, 0x05, 0x16, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x82,
+    0x08, 0x06, 0x16, 0x20, 0x1c, 0x16, 0x0e, 0x08, 0x0e, 0x82, 0x08, 0x03, 0x0b, 0x04, 0x0b, 0x08,
+    0x9f, 0x37, 0xb4, 0x37, 0x08, 0x18, 0x06, 0x17, 0x1b, 0x1e, 0x16, 0x19, 0x19, 0x1b, 0x89, 0x20,
+    0x06, 0x1c, 0x16, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x83, 0x08, 0x00, 0x0e, 0x82, 0x08, 0x00, 0x0b,
+    0x84, 0x08, 0x02, 0x06, 0x0e, 0x07, 0x9f, 0x37, 0xb6, 0x37, 0x08, 0x0a, 0x0a, 0x1b, 0x1b, 0x19,
+    0x19, 0x1b, 0x19, 0x1c, 0x88, 0x20, 0x03, 0x0b, 0x08, 0x08, 0x0e, 0x87, 0x08, 0x00, 0x0e, 0x82,
+    0x08, 0x00, 0x0b, 0x82, 0x08, 0x02, 0x04, 0x0b, 0x07, 0x9f, 0x37, 0xb7, 0x37, 0x06, 0x2a, 0x07,
+    0x0b, 0x16, 0x19, 0x20, 0x1c, 0x83, 0x19, 0x01, 0x20, 0x24, 0x83, 0x20, 0x03, 0x11, 0x0e, 0x08,
+    0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x09, 0x0b, 0x08, 0x06, 0x0e, 0x08, 0x0e, 0x06, 0x0e,
+    0x0a, 0x2d, 0x9e, 0x37, 0xb9, 0x37, 0x0a, 0x1b, 0x0a, 0x11, 0x19, 0x1b, 0x19, 0x1c, 0x1a, 0x19,
+    0x19, 0x1b, 0x83, 0x20, 0x04, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x84, 0x08, 0x00, 0x0e, 0x82, 0x08,
+    0x00, 0x0b, 0x84, 0x08, 0x03, 0x06, 0x0e, 0x07, 0x25, 0x9e, 0x37, 0x92, 0x37, 0x00, 0x36, 0xa6,
+    0x37, 0x06, 0x2d, 0x0a, 0x0b, 0x16, 0x19, 0x20, 0x1c, 0x83, 0x19, 0x08, 0x0b, 0x16, 0x19, 0x20,
+    0x0a, 0x0e, 0x08, 0x08, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x07, 0x0b, 0x08, 0x06, 0x06,
+    0x16, 0x11, 0x02, 0x1d, 0x9e, 0x37, 0xbc, 0x37, 0x0f, 0x1b, 0x0a, 0x11, 0x19, 0x19, 0x1b, 0x19,
+    0x0b, 0x1b, 0x36, 0x37, 0x35, 0x35, 0x13, 0x08, 0x0e, 0x82, 0x08, 0x00, 0x0b, 0x85, 0x08, 0x09,
+    0x0b, 0x08, 0x06, 0x0e, 0x08, 0x06, 0x16, 0x11, 0x03, 0x25, 0x9e, 0x37, 0x8d, 0x37, 0x00, 0x36,
+    0xae, 0x37, 0x06, 0x2f, 0x0a, 0x0e, 0x16, 0x24, 0x0b, 0x1e, 0x84, 0x35, 0x02, 0x11, 0x08, 0x0e,
+    0x82, 0x08, 0x00, 0x0b, 0x84, 0x08, 0x0a, 0x06, 0x0e, 0x06, 0x04, 0x06, 0x04, 0x0b, 0x16, 0x0b,
+    0x05, 0x2a, 0x9e, 0x37, 0x91, 0x37, 0x00, 0x36, 0xac, 0x37, 0x0c, 0x1d, 0x04, 0x1a, 0x16, 0x2e,
+    0x35, 0x25, 0x1c, 0x35, 0x35, 0x29, 0x06, 0x0a, 0x86, 0x08, 0x06, 0x06, 0x05, 0x0a, 0x1b, 0x1b,
+    0x07, 0x0b, 0x82, 0x16, 0x02, 0x0e, 0x06, 0x31, 0x9e, 0x37, 0x8b, 0x37, 0x00, 0x36, 0xb4, 0x37,
+    0x0a, 0x05, 0x0e, 0x37, 0x35, 0x35, 0x1b, 0x31, 0x35, 0x2b, 0x0a, 0x0e, 0x82, 0x08, 0x05, 0x0e,
+    0x08, 0x06, 0x07, 0x19, 0x36, 0x82, 0x37, 0x07, 0x0a, 0x1b, 0x1b, 0x16, 0x16, 0x0b, 0x13, 0x33,
+    0x9e, 0x37, 0xc2, 0x37, 0x0f, 0x1d, 0x0a, 0x2d, 0x37, 0x28, 0x1e, 0x35, 0x35, 0x21, 0x06, 0x08,
+    0x0e, 0x08, 0x06, 0x07, 0x25, 0x85, 0x37, 0x06, 0x05, 0x0e, 0x16, 0x16, 0x0b, 0x0a, 0x2d, 0x9f,
+    0x37, 0x82, 0x37, 0x00, 0x36, 0xbf, 0x37, 0x0d, 0x2a, 0x09, 0x27, 0x29, 0x2b, 0x35, 0x35, 0x29,
+    0x0e, 0x0a, 0x08, 0x08, 0x0a, 0x2d, 0x85, 0x37, 0x07, 0x06, 0x0b, 0x16, 0x0b, 0x0b, 0x08, 0x13,
+    0x33, 0x9a, 0x37, 0x00, 0x36, 0x83, 0x37, 0x89, 0x37, 0x00, 0x36, 0xba, 0x37, 0x02, 0x0a, 0x1b,
+    0x37, 0x82, 0x35, 0x03, 0x1e, 0x0a, 0x06, 0x08, 0x86, 0x37, 0x07, 0x13, 0x0a, 0x19, 0x16, 0x0e,
+    0x08, 0x0a, 0x2d, 0xa0, 0x37, 0xc6, 0x37, 0x02, 0x1d, 0x0e, 0x37, 0x82, 0x35, 0x03, 0x29, 0x0e,
+    0x07, 0x25, 0x82, 0x37, 0x09, 0x36, 0x21, 0x07, 0x0b, 0x16, 0x0b, 0x08, 0x13, 0x0a, 0x2d, 0x95,
+    0x37, 0x00, 0x36, 0x8a, 0x37, 0xc7, 0x37, 0x02, 0x2a, 0x09, 0x1e, 0x83, 0x35, 0x0d, 0x29, 0x0e,
+    0x07, 0x09, 0x0a, 0x03, 0x06, 0x0a, 0x08, 0x08, 0x16, 0x16, 0x0b, 0x36, 0xa2, 0x37, 0xc9, 0x37,
+    0x03, 0x1d, 0x0a, 0x1b, 0x37, 0x83, 0x35, 0x08, 0x1e, 0x1e, 0x1a, 0x20, 0x24, 0x22, 0x16, 0x0e,
+    0x2a, 0xa4, 0x37, 0xcb, 0x37, 0x0c, 0x26, 0x08, 0x0a, 0x0e, 0x2a, 0x21, 0x2b, 0x1e, 0x1e, 0x13,
+    0x0a, 0x19, 0x2d, 0xa6, 0x37, 0xcf, 0x37, 0x04, 0x2a, 0x21, 0x25, 0x1c, 0x2a, 0xaa, 0x37, 0xff,
+    0x37, 0xae, 0x37, 0x00, 0x34, 0xcf, 0x37, 0x95, 0x37, 0x00, 0x34, 0xc4, 0x37, 0x00, 0x34, 0xa2,
+    0x37, 0xc4, 0x37, 0x00, 0x34, 0xb9, 0x37, 0xae, 0x37, 0x00, 0x34, 0xcf, 0x37, 0x99, 0x37, 0x00,
+    0x34, 0xc8, 0x37, 0x00, 0x34, 0x9a, 0x37, 0x83, 0x37, 0x00, 0x36, 0xcb, 0x37, 0x00, 0x34, 0xad,
+    0x37, 0xde, 0x37, 0x00, 0x36, 0x9f, 0x37, 0xab, 0x37, 0x00, 0x36, 0xc6, 0x37, 0x00, 0x36, 0x8a,
+    0x37, 0xde, 0x37, 0x00, 0x36, 0x9f, 0x37, 0xc6, 0x37, 0x00, 0x36, 0xb7, 0x37, 0xdf, 0x37, 0x00,
+    0x36, 0x9e, 0x37, 0xff, 0x37, 0xe1, 0x37, 0x00, 0x36, 0x9c, 0x37, 0xa9, 0x37, 0x00, 0x36, 0xd4,
+    0x37, 0xe4, 0x37, 0x00, 0x36, 0x99, 0x37, 0xbc, 0x37, 0x00, 0x36, 0xc1, 0x37, 0xe8, 0x37, 0x00,
+    0x36, 0x95, 0x37, 0x8d, 0x37, 0x00, 0x36, 0xe3, 0x37, 0x00, 0x36, 0x8b, 0x37, 0xed, 0x37, 0x00,
+    0x36, 0x90, 0x37,
+};
+
+// 70 colors, 4758 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_6[] = {
+    0x3b72, 0x52cb, 0x630b, 0x63b1, 0x6b8e, 0x7432, 0x83ce, 0x84f4, 0x8558, 0x8c4f, 0x8c92, 0x9556,
+    0x95b8, 0x95f9, 0x9cf3, 0x9d78, 0x9dfa, 0xa4d4, 0xa557, 0xa5fa, 0xa639, 0xad55, 0xadb5, 0xadb7,
+    0xadbc, 0xadd9, 0xae5b, 0xaebd, 0xb5b6, 0xb5f9, 0xb639, 0xbdf7, 0xbe7a, 0xbebb, 0xbefc, 0xbefe,
+    0xc5f7, 0xc638, 0xc67a, 0xc6bb, 0xceba, 0xcebb, 0xcefd, 0xcf3e, 0xcf7f, 0xd679, 0xd6b9, 0xd6ba,
+    0xd6bb, 0xd6fb, 0xd6fc, 0xdefa, 0xdefb, 0xdf3d, 0xdf7e, 0xe6fb, 0xe73c, 0xe73d, 0xe77d, 0xe77e,
+    0xef3c, 0xef7c, 0xef7d, 0xefbe, 0xefbf, 0xf7be, 0xf7bf, 0xf7ff, 0xffbf, 0xffff,
+};
+static constexpr uint16_t mac_row_6[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 60, 66, 72, 81, 93, 108,
+    124, 143, 162, 184, 210, 234, 261, 290, 322, 356, 392, 433, 471, 507, 545, 584,
+    629, 671, 717, 765, 816, 860, 913, 965, 1019, 1068, 1122, 1176, 1231, 1283, 1336, 1391,
+    1445, 1495, 1550, 1603, 1654, 1705, 1749, 1791, 1829, 1863, 1899, 1935, 1969, 2002, 2035, 2066,
+    2095, 2124, 2151, 2175, 2194, 2213, 2232, 2256, 2281, 2307, 2335, 2363, 2392, 2433, 2479, 2535,
+    2590, 2646, 2700, 2753, 2806, 2858, 2910, 2958, 3006, 3059, 3119, 3184, 3245, 3309, 3371, 3435,
+    3498, 3555, 3612, 3670, 3724, 3769, 3824, 3871, 3917, 3959, 4000, 4039, 4076, 4112, 4149, 4183,
+    4210, 4232, 4254, 4274, 4285, 4296, 4302, 4308, 4314, 4316, 4322, 4328, 4334, 4340, 4346, 4356,
+};
+static constexpr uint8_t mac_code_6[] = {
+    0xff, 0x45, 0xd8, 0x45, 0x00, 0x41, 0xa5, 0x45, 0x86, 0x45, 0x00, 0x41, 0xc9, 0x45, 0x00, 0x41,
+    0xac, 0x45, 0xbf, 0x45, 0x00, 0x41, 0xbe, 0x45, 0xff, 0x45, 0xa7, 0x45, 0x00, 0x41, 0xd6, 0x45,
+    0x9d, 0x45, 0x00, 0x41, 0xcb, 0x45, 0x00, 0x41, 0x93, 0x45, 0x90, 0x45, 0x00, 0x41, 0xe8, 0x45,
+    0x00, 0x41, 0x83, 0x45, 0xff, 0x45, 0xe5, 0x45, 0x00, 0x41, 0x98, 0x45, 0xb8, 0x45, 0x00, 0x41,
+    0xc5, 0x45, 0xd1, 0x45, 0x00, 0x41, 0xac, 0x45, 0xca, 0x45, 0x03, 0x1e, 0x13, 0x13, 0x32, 0xb0,
+    0x45, 0xc8, 0x45, 0x01, 0x1e, 0x13, 0x82, 0x2c, 0x01, 0x1a, 0x38, 0xaf, 0x45, 0x87, 0x45, 0x00,
+    0x41, 0xbd, 0x45, 0x01, 0x1e, 0x13, 0x85, 0x2c, 0x00, 0x1e, 0xaf, 0x45, 0xc4, 0x45, 0x0a, 0x1e,
+    0x13, 0x2c, 0x21, 0x0b, 0x1f, 0x30, 0x20, 0x2c, 0x2c, 0x1a, 0xaf, 0x45, 0xc2, 0x45, 0x06, 0x1e,
+    0x1a, 0x38, 0x21, 0x0b, 0x25, 0x41, 0x82, 0x45, 0x03, 0x26, 0x2c, 0x1a, 0x38, 0xae, 0x45, 0xc0,
+    0x45, 0x06, 0x1e, 0x1a, 0x38, 0x21, 0x0b, 0x1f, 0x41, 0x84, 0x45, 0x03, 0x38, 0x23, 0x1b, 0x39,
+    0xae, 0x45, 0xbe, 0x45, 0x06, 0x1e, 0x13, 0x2c, 0x21, 0x0b, 0x1f, 0x41, 0x87, 0x45, 0x02, 0x21,
+    0x23, 0x30, 0xa9, 0x45, 0x00, 0x41, 0x83, 0x45, 0x8b, 0x45, 0x00, 0x41, 0xaf, 0x45, 0x06, 0x1e,
+    0x13, 0x2c, 0x21, 0x0b, 0x25, 0x41, 0x89, 0x45, 0x02, 0x20, 0x2c, 0x20, 0xab, 0x45, 0x02, 0x41,
+    0x45, 0x45, 0xba, 0x45, 0x06, 0x1e, 0x13, 0x2c, 0x21, 0x0b, 0x25, 0x41, 0x85, 0x45, 0x02, 0x38,
+    0x12, 0x17, 0x82, 0x45, 0x02, 0x26, 0x2c, 0x1a, 0xae, 0x45, 0xb7, 0x45, 0x07, 0x3a, 0x1e, 0x13,
+    0x2c, 0x21, 0x0b, 0x25, 0x41, 0x85, 0x45, 0x0a, 0x38, 0x12, 0x08, 0x0d, 0x08, 0x38, 0x45, 0x45,
+    0x28, 0x2c, 0x1a, 0xae, 0x45, 0xb5, 0x45, 0x07, 0x3a, 0x1e, 0x1a, 0x38, 0x1a, 0x0b, 0x1f, 0x41,
+    0x85, 0x45, 0x0c, 0x38, 0x12, 0x08, 0x0d, 0x0d, 0x08, 0x0c, 0x2f, 0x45, 0x45, 0x31, 0x2c, 0x1a,
+    0xae, 0x45, 0xb3, 0x45, 0x07, 0x3a, 0x1e, 0x1a, 0x2b, 0x1a, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x0f,
+    0x38, 0x12, 0x08, 0x0d, 0x08, 0x0c, 0x0d, 0x08, 0x0c, 0x25, 0x41, 0x45, 0x34, 0x2b, 0x1a, 0x3f,
+    0xad, 0x45, 0xb1, 0x45, 0x07, 0x3a, 0x1e, 0x1a, 0x2b, 0x1a, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x0b,
+    0x31, 0x12, 0x08, 0x0d, 0x08, 0x0c, 0x0d, 0x0d, 0x08, 0x0c, 0x0d, 0x0d, 0x82, 0x45, 0x02, 0x1e,
+    0x22, 0x38, 0xad, 0x45, 0xaf, 0x45, 0x07, 0x31, 0x1d, 0x1a, 0x38, 0x1a, 0x0b, 0x26, 0x41, 0x85,
+    0x45, 0x06, 0x38, 0x12, 0x08, 0x0d, 0x0d, 0x08, 0x0c, 0x82, 0x0d, 0x03, 0x08, 0x0c, 0x0d, 0x0d,
+    0x82, 0x45, 0x02, 0x20, 0x2c, 0x20, 0xad, 0x45, 0xad, 0x45, 0x07, 0x3a, 0x1e, 0x1a, 0x2b, 0x1a,
+    0x0b, 0x26, 0x41, 0x85, 0x45, 0x02, 0x3a, 0x12, 0x08, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x83, 0x0d,
+    0x03, 0x08, 0x0c, 0x0d, 0x07, 0x82, 0x45, 0x02, 0x26, 0x2c, 0x20, 0xa4, 0x45, 0x00, 0x41, 0x87,
+    0x45, 0xab, 0x45, 0x07, 0x3a, 0x1e, 0x1a, 0x2b, 0x1a, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x02, 0x38,
+    0x0b, 0x08, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x84, 0x0d, 0x04, 0x08, 0x0c, 0x0d, 0x0d, 0x07, 0x82,
+    0x45, 0x02, 0x20, 0x2c, 0x1a, 0xad, 0x45, 0xa9, 0x45, 0x07, 0x3a, 0x1e, 0x1a, 0x2b, 0x1a, 0x0b,
+    0x26, 0x41, 0x85, 0x45, 0x05, 0x34, 0x0b, 0x08, 0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x01, 0x08, 0x0c,
+    0x85, 0x0d, 0x05, 0x38, 0x45, 0x45, 0x30, 0x2c, 0x1a, 0xad, 0x45, 0xa7, 0x45, 0x07, 0x39, 0x1e,
+    0x13, 0x2c, 0x21, 0x0b, 0x25, 0x41, 0x85, 0x45, 0x02, 0x38, 0x0b, 0x08, 0x83, 0x0d, 0x01, 0x08,
+    0x0c, 0x86, 0x0d, 0x01, 0x08, 0x0c, 0x83, 0x0d, 0x05, 0x2d, 0x45, 0x45, 0x31, 0x2c, 0x1a, 0xad,
+    0x45, 0xa5, 0x45, 0x07, 0x39, 0x1e, 0x1a, 0x38, 0x1a, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x02, 0x38,
+    0x12, 0x08, 0x84, 0x0d, 0x01, 0x08, 0x0c, 0x87, 0x0d, 0x01, 0x08, 0x0c, 0x83, 0x0d, 0x06, 0x2d,
+    0x45, 0x45, 0x31, 0x2c, 0x1a, 0x38, 0xac, 0x45, 0x86, 0x45, 0x00, 0x41, 0x9b, 0x45, 0x07, 0x39,
+    0x1e, 0x1a, 0x2b, 0x1a, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x02, 0x38, 0x12, 0x08, 0x85, 0x0d, 0x01,
+    0x08, 0x0c, 0x84, 0x0d, 0x05, 0x20, 0x1d, 0x1a, 0x0d, 0x08, 0x0c, 0x84, 0x0d, 0x82, 0x45, 0x02,
+    0x26, 0x2c, 0x20, 0xac, 0x45, 0xa2, 0x45, 0x06, 0x1e, 0x13, 0x2c, 0x21, 0x0b, 0x25, 0x41, 0x85,
+    0x45, 0x05, 0x38, 0x12, 0x08, 0x0d, 0x08, 0x0c, 0x88, 0x0d, 0x07, 0x08, 0x20, 0x31, 0x34, 0x25,
+    0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x06, 0x38, 0x45, 0x45, 0x20, 0x2c, 0x26, 0x41, 0xab, 0x45, 0x02,
+    0x45, 0x45, 0x41, 0x9e, 0x45, 0x05, 0x20, 0x2c, 0x20, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x05, 0x38,
+    0x0b, 0x08, 0x0d, 0x08, 0x0c, 0x89, 0x0d, 0x08, 0x20, 0x31, 0x34, 0x2b, 0x34, 0x25, 0x0d, 0x08,
+    0x0c, 0x84, 0x0d, 0x00, 0x07, 0x82, 0x45, 0x02, 0x28, 0x2c, 0x1a, 0xac, 0x45, 0x83, 0x45, 0x00,
+    0x41, 0x9c, 0x45, 0x03, 0x1a, 0x21, 0x0b, 0x38, 0x85, 0x45, 0x06, 0x38, 0x0b, 0x08, 0x0d, 0x0d,
+    0x08, 0x0c, 0x88, 0x0d, 0x0b, 0x20, 0x31, 0x34, 0x34, 0x41, 0x45, 0x38, 0x33, 0x0c, 0x0d, 0x08,
+    0x0c, 0x83, 0x0d, 0x00, 0x07, 0x82, 0x45, 0x02, 0x28, 0x2c, 0x1e, 0xac, 0x45, 0x02, 0x45, 0x45,
+    0x41, 0x9d, 0x45, 0x04, 0x26, 0x2c, 0x19, 0x26, 0x41, 0x83, 0x45, 0x02, 0x34, 0x0b, 0x08, 0x86,
+    0x0d, 0x01, 0x08, 0x0c, 0x83, 0x0d, 0x04, 0x2d, 0x31, 0x34, 0x34, 0x41, 0x82, 0x45, 0x05, 0x38,
+    0x34, 0x0b, 0x0d, 0x08, 0x0c, 0x84, 0x0d, 0x05, 0x20, 0x45, 0x45, 0x31, 0x2c, 0x1a, 0xac, 0x45,
+    0xa0, 0x45, 0x03, 0x1e, 0x21, 0x0b, 0x41, 0x82, 0x45, 0x05, 0x34, 0x0b, 0x08, 0x0d, 0x08, 0x0c,
+    0x89, 0x0d, 0x04, 0x20, 0x31, 0x34, 0x34, 0x41, 0x85, 0x45, 0x04, 0x34, 0x19, 0x0d, 0x08, 0x0c,
+    0x84, 0x0d, 0x06, 0x20, 0x45, 0x45, 0x28, 0x2c, 0x1a, 0x38, 0xab, 0x45, 0x86, 0x45, 0x00, 0x41,
+    0x98, 0x45, 0x02, 0x20, 0x1a, 0x0b, 0x82, 0x45, 0x01, 0x26, 0x08, 0x87, 0x0d, 0x01, 0x08, 0x0c,
+    0x82, 0x0d, 0x07, 0x20, 0x31, 0x34, 0x34, 0x41, 0x38, 0x45, 0x32, 0x84, 0x45, 0x06, 0x38, 0x12,
+    0x08, 0x0d, 0x0d, 0x08, 0x0c, 0x82, 0x0d, 0x00, 0x20, 0x82, 0x45, 0x02, 0x1e, 0x22, 0x3a, 0xab,
+    0x45, 0x84, 0x45, 0x00, 0x41, 0x9a, 0x45, 0x02, 0x26, 0x1a, 0x21, 0x82, 0x45, 0x01, 0x0b, 0x08,
+    0x82, 0x0d, 0x01, 0x08, 0x0c, 0x85, 0x0d, 0x09, 0x20, 0x31, 0x34, 0x34, 0x41, 0x45, 0x3a, 0x12,
+    0x08, 0x18, 0x84, 0x45, 0x05, 0x38, 0x1e, 0x13, 0x0d, 0x08, 0x0c, 0x84, 0x0d, 0x82, 0x45, 0x02,
+    0x20, 0x2c, 0x26, 0xab, 0x45, 0x87, 0x45, 0x00, 0x41, 0x97, 0x45, 0x02, 0x26, 0x1a, 0x17, 0x82,
+    0x45, 0x01, 0x0b, 0x08, 0x83, 0x0d, 0x01, 0x08, 0x0c, 0x82, 0x0d, 0x0b, 0x20, 0x31, 0x34, 0x34,
+    0x41, 0x45, 0x45, 0x0f, 0x00, 0x05, 0x08, 0x0d, 0x84, 0x45, 0x04, 0x38, 0x1e, 0x0d, 0x08, 0x0c,
+    0x85, 0x0d, 0x05, 0x38, 0x45, 0x45, 0x28, 0x2c, 0x1a, 0xab, 0x45, 0xa0, 0x45, 0x02, 0x26, 0x1a,
+    0x17, 0x82, 0x45, 0x03, 0x0b, 0x0d, 0x08, 0x0c, 0x86, 0x0d, 0x02, 0x26, 0x34, 0x41, 0x83, 0x45,
+    0x04, 0x0b, 0x00, 0x05, 0x08, 0x0d, 0x84, 0x45, 0x06, 0x38, 0x28, 0x0c, 0x0d, 0x0d, 0x08, 0x0c,
+    0x82, 0x0d, 0x00, 0x07, 0x82, 0x45, 0x02, 0x28, 0x2c, 0x1a, 0xab, 0x45, 0x02, 0x45, 0x45, 0x41,
+    0x9d, 0x45, 0x09, 0x39, 0x1e, 0x0f, 0x3e, 0x45, 0x45, 0x20, 0x0d, 0x08, 0x0c, 0x86, 0x0d, 0x02,
+    0x26, 0x34, 0x41, 0x83, 0x45, 0x05, 0x20, 0x00, 0x00, 0x05, 0x08, 0x41, 0x83, 0x45, 0x02, 0x38,
+    0x33, 0x0c, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x82, 0x0d, 0x05, 0x3d, 0x45, 0x45, 0x31, 0x2c, 0x1a,
+    0xab, 0x45, 0x02, 0x45, 0x45, 0x41, 0x9e, 0x45, 0x09, 0x10, 0x0c, 0x2f, 0x45, 0x45, 0x31, 0x12,
+    0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x02, 0x20, 0x34, 0x41, 0x83, 0x45, 0x10, 0x28, 0x00, 0x07, 0x17,
+    0x45, 0x45, 0x41, 0x25, 0x41, 0x45, 0x34, 0x34, 0x0b, 0x0d, 0x0d, 0x08, 0x0c, 0x83, 0x0d, 0x05,
+    0x2d, 0x45, 0x45, 0x28, 0x2c, 0x1a, 0xab, 0x45, 0x82, 0x45, 0x00, 0x41, 0x9d, 0x45, 0x0a, 0x10,
+    0x19, 0x26, 0x45, 0x45, 0x31, 0x12, 0x0d, 0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x01, 0x38, 0x38, 0x83,
+    0x45, 0x10, 0x39, 0x29, 0x45, 0x45, 0x31, 0x1d, 0x41, 0x25, 0x41, 0x45, 0x38, 0x34, 0x19, 0x0d,
+    0x0d, 0x08, 0x0c, 0x83, 0x0d, 0x06, 0x2d, 0x45, 0x45, 0x34, 0x2b, 0x1a, 0x38, 0xaa, 0x45, 0x82,
+    0x45, 0x00, 0x41, 0x9d, 0x45, 0x0a, 0x1e, 0x1a, 0x25, 0x41, 0x45, 0x41, 0x07, 0x17, 0x0d, 0x08,
+    0x0c, 0x85, 0x0d, 0x01, 0x38, 0x38, 0x86, 0x45, 0x0d, 0x3a, 0x2f, 0x2d, 0x38, 0x33, 0x45, 0x45,
+    0x31, 0x34, 0x25, 0x0d, 0x0d, 0x08, 0x0c, 0x83, 0x0d, 0x06, 0x2d, 0x45, 0x45, 0x34, 0x22, 0x1b,
+    0x39, 0xaa, 0x45, 0x82, 0x45, 0x00, 0x41, 0x9d, 0x45, 0x02, 0x26, 0x1a, 0x17, 0x82, 0x45, 0x03,
+    0x0b, 0x0d, 0x08, 0x0c, 0x86, 0x0d, 0x01, 0x26, 0x34, 0x83, 0x45, 0x0c, 0x38, 0x38, 0x33, 0x2f,
+    0x2d, 0x2f, 0x45, 0x41, 0x38, 0x33, 0x2f, 0x34, 0x25, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x83, 0x0d,
+    0x82, 0x45, 0x02, 0x26, 0x2c, 0x20, 0xaa, 0x45, 0x82, 0x45, 0x00, 0x41, 0x9d, 0x45, 0x02, 0x26,
+    0x1a, 0x0b, 0x82, 0x45, 0x04, 0x0b, 0x0d, 0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x15, 0x20, 0x34, 0x45,
+    0x45, 0x31, 0x34, 0x24, 0x15, 0x3e, 0x45, 0x3e, 0x45, 0x3e, 0x34, 0x2b, 0x34, 0x34, 0x2b, 0x2d,
+    0x0d, 0x08, 0x0c, 0x84, 0x0d, 0x00, 0x07, 0x82, 0x45, 0x02, 0x26, 0x2c, 0x20, 0xaa, 0x45, 0x89,
+    0x45, 0x00, 0x41, 0x96, 0x45, 0x02, 0x3a, 0x14, 0x0b, 0x82, 0x45, 0x03, 0x1e, 0x0d, 0x08, 0x0c,
+    0x86, 0x0d, 0x0c, 0x26, 0x34, 0x45, 0x45, 0x3a, 0x12, 0x1c, 0x2d, 0x38, 0x41, 0x38, 0x34, 0x2b,
+    0x82, 0x34, 0x05, 0x2b, 0x2d, 0x17, 0x0d, 0x08, 0x0c, 0x84, 0x0d, 0x00, 0x07, 0x82, 0x45, 0x02,
+    0x31, 0x2c, 0x1a, 0xaa, 0x45, 0xa1, 0x45, 0x0a, 0x3a, 0x14, 0x0f, 0x3e, 0x45, 0x45, 0x20, 0x0d,
+    0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x01, 0x20, 0x34, 0x82, 0x45, 0x0f, 0x31, 0x34, 0x41, 0x38, 0x34,
+    0x34, 0x2b, 0x2d, 0x2f, 0x2d, 0x2f, 0x17, 0x0d, 0x0d, 0x08, 0x0c, 0x85, 0x0d, 0x00, 0x07, 0x82,
+    0x45, 0x02, 0x28, 0x2c, 0x14, 0xaa, 0x45, 0x8a, 0x45, 0x00, 0x41, 0x96, 0x45, 0x06, 0x10, 0x0c,
+    0x34, 0x41, 0x45, 0x34, 0x0b, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x84, 0x0d, 0x01, 0x34, 0x41, 0x82,
+    0x45, 0x09, 0x38, 0x33, 0x2f, 0x34, 0x2d, 0x2d, 0x38, 0x26, 0x1a, 0x0c, 0x83, 0x0d, 0x01, 0x08,
+    0x0c, 0x83, 0x0d, 0x07, 0x07, 0x34, 0x41, 0x45, 0x45, 0x20, 0x2c, 0x20, 0xaa, 0x45, 0x8a, 0x45,
+    0x00, 0x41, 0x96, 0x45, 0x02, 0x10, 0x19, 0x28, 0x82, 0x45, 0x04, 0x0b, 0x0d, 0x0d, 0x08, 0x0c,
+    0x85, 0x0d, 0x0b, 0x38, 0x38, 0x45, 0x38, 0x33, 0x2f, 0x34, 0x2d, 0x2d, 0x38, 0x26, 0x19, 0x82,
+    0x0d, 0x01, 0x08, 0x0c, 0x85, 0x0d, 0x03, 0x07, 0x2f, 0x45, 0x41, 0x82, 0x45, 0x02, 0x26, 0x2c,
+    0x13, 0xaa, 0x45, 0x8f, 0x45, 0x00, 0x41, 0x91, 0x45, 0x0b, 0x1e, 0x13, 0x25, 0x41, 0x45, 0x41,
+    0x07, 0x17, 0x0d, 0x0d, 0x08, 0x0c, 0x84, 0x0d, 0x01, 0x34, 0x31, 0x82, 0x34, 0x08, 0x25, 0x1c,
+    0x2d, 0x26, 0x1a, 0x0c, 0x0d, 0x08, 0x0c, 0x86, 0x0d, 0x02, 0x0b, 0x26, 0x41, 0x84, 0x45, 0x03,
+    0x26, 0x2c, 0x2c, 0x1a, 0xaa, 0x45, 0x85, 0x45, 0x00, 0x41, 0x9b, 0x45, 0x02, 0x1e, 0x13, 0x0d,
+    0x82, 0x45, 0x00, 0x0b, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x84, 0x0d, 0x03, 0x34, 0x31, 0x34, 0x2b,
+    0x82, 0x34, 0x00, 0x19, 0x83, 0x0d, 0x01, 0x08, 0x0c, 0x84, 0x0d, 0x03, 0x07, 0x2f, 0x45, 0x41,
+    0x84, 0x45, 0x03, 0x38, 0x23, 0x2c, 0x1a, 0xab, 0x45, 0xa2, 0x45, 0x02, 0x1e, 0x1a, 0x0b, 0x82,
+    0x45, 0x00, 0x17, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x84, 0x0d, 0x04, 0x34, 0x31, 0x34, 0x34, 0x25,
+    0x83, 0x0d, 0x01, 0x08, 0x0c, 0x85, 0x0d, 0x01, 0x07, 0x2f, 0x86, 0x45, 0x05, 0x3a, 0x2f, 0x2b,
+    0x2c, 0x2c, 0x1a, 0xab, 0x45, 0xa2, 0x45, 0x09, 0x32, 0x14, 0x0b, 0x41, 0x45, 0x45, 0x1f, 0x0d,
+    0x08, 0x0c, 0x86, 0x0d, 0x08, 0x26, 0x34, 0x26, 0x1a, 0x0c, 0x0d, 0x0d, 0x08, 0x0c, 0x85, 0x0d,
+    0x01, 0x07, 0x2f, 0x86, 0x45, 0x01, 0x38, 0x26, 0x82, 0x2c, 0x01, 0x1a, 0x1e, 0xac, 0x45, 0xa3,
+    0x45, 0x06, 0x10, 0x0c, 0x34, 0x45, 0x45, 0x31, 0x12, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x8a, 0x0d,
+    0x01, 0x08, 0x0c, 0x83, 0x0d, 0x01, 0x07, 0x34, 0x86, 0x45, 0x07, 0x3a, 0x2f, 0x2b, 0x2c, 0x2c,
+    0x1a, 0x1e, 0x39, 0xad, 0x45, 0xa3, 0x45, 0x06, 0x10, 0x0c, 0x34, 0x45, 0x45, 0x28, 0x08, 0x88,
+    0x0d, 0x01, 0x08, 0x0c, 0x88, 0x0d, 0x02, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x01, 0x38, 0x20, 0x82,
+    0x2c, 0x02, 0x1a, 0x1e, 0x39, 0xaf, 0x45, 0xa3, 0x45, 0x07, 0x13, 0x13, 0x26, 0x41, 0x45, 0x45,
+    0x07, 0x17, 0x82, 0x0d, 0x01, 0x08, 0x0c, 0x8a, 0x0d, 0x03, 0x08, 0x0b, 0x26, 0x41, 0x85, 0x45,
+    0x07, 0x31, 0x34, 0x23, 0x2c, 0x2c, 0x1a, 0x1d, 0x39, 0xb1, 0x45, 0xa3, 0x45, 0x02, 0x13, 0x14,
+    0x1e, 0x82, 0x45, 0x01, 0x07, 0x17, 0x83, 0x0d, 0x01, 0x08, 0x0c, 0x88, 0x0d, 0x03, 0x0b, 0x2f,
+    0x45, 0x41, 0x84, 0x45, 0x07, 0x38, 0x20, 0x2b, 0x2c, 0x2c, 0x1a, 0x1d, 0x39, 0xb3, 0x45, 0xa3,
+    0x45, 0x07, 0x20, 0x1d, 0x17, 0x45, 0x45, 0x41, 0x0b, 0x08, 0x84, 0x0d, 0x01, 0x08, 0x0c, 0x85,
+    0x0d, 0x01, 0x07, 0x2f, 0x86, 0x45, 0x07, 0x38, 0x1e, 0x2b, 0x2c, 0x2c, 0x1a, 0x21, 0x3a, 0xb5,
+    0x45, 0xa3, 0x45, 0x02, 0x29, 0x1a, 0x0b, 0x82, 0x45, 0x00, 0x17, 0x83, 0x0d, 0x01, 0x08, 0x0c,
+    0x85, 0x0d, 0x01, 0x07, 0x2f, 0x86, 0x45, 0x07, 0x38, 0x28, 0x2b, 0x2c, 0x2c, 0x1a, 0x1d, 0x39,
+    0xb7, 0x45, 0xa3, 0x45, 0x09, 0x38, 0x13, 0x13, 0x41, 0x45, 0x45, 0x1f, 0x0d, 0x08, 0x0c, 0x86,
+    0x0d, 0x03, 0x0b, 0x2f, 0x45, 0x41, 0x84, 0x45, 0x07, 0x31, 0x34, 0x23, 0x2c, 0x2c, 0x1a, 0x1e,
+    0x39, 0xb9, 0x45, 0xa4, 0x45, 0x06, 0x0b, 0x0d, 0x38, 0x45, 0x45, 0x30, 0x0c, 0x84, 0x0d, 0x04,
+    0x08, 0x0c, 0x0b, 0x26, 0x41, 0x85, 0x45, 0x01, 0x3a, 0x20, 0x82, 0x2c, 0x02, 0x1a, 0x1d, 0x39,
+    0xbb, 0x45, 0xa4, 0x45, 0x06, 0x10, 0x0c, 0x34, 0x45, 0x45, 0x38, 0x08, 0x84, 0x0d, 0x02, 0x0b,
+    0x26, 0x41, 0x85, 0x45, 0x07, 0x34, 0x25, 0x2b, 0x2c, 0x2c, 0x1a, 0x1d, 0x3a, 0xbd, 0x45, 0xa4,
+    0x45, 0x0c, 0x1e, 0x0d, 0x26, 0x41, 0x45, 0x45, 0x07, 0x0d, 0x08, 0x0c, 0x0b, 0x34, 0x41, 0x85,
+    0x45, 0x07, 0x31, 0x34, 0x23, 0x2c, 0x2c, 0x1a, 0x1d, 0x39, 0xbf, 0x45, 0xa4, 0x45, 0x02, 0x1e,
+    0x14, 0x1e, 0x82, 0x45, 0x04, 0x0b, 0x08, 0x0b, 0x34, 0x41, 0x85, 0x45, 0x07, 0x3a, 0x20, 0x2b,
+    0x2c, 0x2c, 0x1a, 0x1d, 0x3a, 0xc1, 0x45, 0xa4, 0x45, 0x02, 0x26, 0x1a, 0x0c, 0x83, 0x45, 0x01,
+    0x38, 0x38, 0x85, 0x45, 0x07, 0x38, 0x12, 0x1a, 0x2c, 0x2c, 0x1a, 0x1e, 0x39, 0xc3, 0x45, 0xa4,
+    0x45, 0x02, 0x38, 0x1a, 0x0b, 0x89, 0x45, 0x07, 0x3a, 0x20, 0x31, 0x1a, 0x2c, 0x1a, 0x21, 0x3a,
+    0xc5, 0x45, 0xa4, 0x45, 0x03, 0x3a, 0x13, 0x13, 0x41, 0x86, 0x45, 0x06, 0x3a, 0x17, 0x21, 0x23,
+    0x1a, 0x21, 0x1e, 0xc8, 0x45, 0xa5, 0x45, 0x02, 0x1e, 0x19, 0x26, 0x84, 0x45, 0x07, 0x38, 0x28,
+    0x2b, 0x1b, 0x23, 0x0c, 0x1d, 0x39, 0xc9, 0x45, 0xa5, 0x45, 0x02, 0x13, 0x32, 0x0b, 0x82, 0x45,
+    0x0c, 0x31, 0x1d, 0x41, 0x2b, 0x22, 0x0f, 0x19, 0x0d, 0x1f, 0x30, 0x3e, 0x45, 0x3e, 0xc6, 0x45,
+    0xa5, 0x45, 0x13, 0x21, 0x2c, 0x2c, 0x1a, 0x1e, 0x20, 0x2c, 0x20, 0x19, 0x07, 0x03, 0x0b, 0x36,
+    0x20, 0x1d, 0x11, 0x1c, 0x06, 0x1f, 0x41, 0xc5, 0x45, 0xa5, 0x45, 0x00, 0x20, 0x83, 0x2c, 0x10,
+    0x1a, 0x0f, 0x08, 0x0b, 0x15, 0x2f, 0x12, 0x36, 0x20, 0x2d, 0x38, 0x26, 0x3e, 0x33, 0x0e, 0x1c,
+    0x41, 0xc3, 0x45, 0xa6, 0x45, 0x16, 0x13, 0x32, 0x2b, 0x1a, 0x0b, 0x12, 0x17, 0x1f, 0x41, 0x38,
+    0x12, 0x35, 0x1d, 0x29, 0x45, 0x34, 0x2b, 0x34, 0x3e, 0x33, 0x0e, 0x34, 0x41, 0xc1, 0x45, 0xa6,
+    0x45, 0x03, 0x3a, 0x0b, 0x05, 0x08, 0x82, 0x1f, 0x08, 0x2f, 0x45, 0x32, 0x35, 0x1d, 0x27, 0x2a,
+    0x41, 0x38, 0x82, 0x34, 0x03, 0x41, 0x45, 0x15, 0x2f, 0xc1, 0x45, 0xa6, 0x45, 0x12, 0x38, 0x09,
+    0x2f, 0x2d, 0x2f, 0x17, 0x28, 0x2f, 0x45, 0x41, 0x32, 0x35, 0x32, 0x45, 0x45, 0x34, 0x25, 0x2b,
+    0x31, 0x82, 0x45, 0x01, 0x1e, 0x2d, 0xc0, 0x45, 0xa6, 0x45, 0x12, 0x06, 0x2f, 0x2d, 0x2f, 0x2f,
+    0x2d, 0x2f, 0x2f, 0x34, 0x41, 0x3e, 0x45, 0x3e, 0x45, 0x38, 0x33, 0x2f, 0x34, 0x41, 0x83, 0x45,
+    0x01, 0x15, 0x2f, 0x82, 0x45, 0x08, 0x31, 0x1d, 0x15, 0x0e, 0x0e, 0x1c, 0x3e, 0x45, 0x3e, 0xb3,
+    0x45, 0xa5, 0x45, 0x07, 0x0a, 0x2d, 0x38, 0x26, 0x2f, 0x2d, 0x41, 0x38, 0x83, 0x34, 0x00, 0x2b,
+    0x82, 0x34, 0x02, 0x41, 0x25, 0x41, 0x84, 0x45, 0x0c, 0x38, 0x0b, 0x38, 0x12, 0x0a, 0x05, 0x0e,
+    0x1c, 0x25, 0x25, 0x0e, 0x0e, 0x41, 0x87, 0x45, 0x03, 0x3e, 0x33, 0x2f, 0x38, 0xa8, 0x45, 0xa4,
+    0x45, 0x06, 0x1e, 0x15, 0x2f, 0x2f, 0x2d, 0x2f, 0x38, 0x83, 0x45, 0x0a, 0x39, 0x45, 0x3a, 0x3e,
+    0x45, 0x3e, 0x45, 0x45, 0x15, 0x3e, 0x41, 0x83, 0x45, 0x04, 0x38, 0x04, 0x0e, 0x1c, 0x3e, 0x83,
+    0x45, 0x02, 0x38, 0x06, 0x2f, 0x85, 0x45, 0x08, 0x1e, 0x0e, 0x05, 0x05, 0x0e, 0x06, 0x0a, 0x2d,
+    0x41, 0x87, 0x45, 0x00, 0x3e, 0x9c, 0x45, 0xa4, 0x45, 0x06, 0x09, 0x2f, 0x2f, 0x2d, 0x2f, 0x2f,
+    0x41, 0x87, 0x45, 0x06, 0x3e, 0x45, 0x45, 0x3a, 0x12, 0x06, 0x2f, 0x84, 0x45, 0x01, 0x0a, 0x44,
+    0x85, 0x45, 0x02, 0x1e, 0x0e, 0x41, 0x83, 0x45, 0x0d, 0x2e, 0x0a, 0x05, 0x1f, 0x41, 0x38, 0x45,
+    0x3a, 0x20, 0x0a, 0x05, 0x1f, 0x3e, 0x25, 0x82, 0x0e, 0x01, 0x1f, 0x30, 0x9d, 0x45, 0xa3, 0x45,
+    0x01, 0x21, 0x15, 0x82, 0x2f, 0x01, 0x2d, 0x2f, 0x8b, 0x45, 0x82, 0x06, 0x01, 0x1c, 0x41, 0x83,
+    0x45, 0x02, 0x2d, 0x38, 0x41, 0x83, 0x45, 0x03, 0x38, 0x0a, 0x2d, 0x41, 0x82, 0x45, 0x03, 0x0b,
+    0x0a, 0x2d, 0x41, 0x86, 0x45, 0x0d, 0x1e, 0x0e, 0x04, 0x1c, 0x2d, 0x38, 0x45, 0x32, 0x25, 0x0e,
+    0x25, 0x41, 0x45, 0x41, 0x98, 0x45, 0xa3, 0x45, 0x06, 0x0b, 0x2d, 0x38, 0x26, 0x2f, 0x2f, 0x38,
+    0x8a, 0x45, 0x00, 0x34, 0x83, 0x06, 0x00, 0x1c, 0x83, 0x45, 0x01, 0x38, 0x12, 0x84, 0x45, 0x01,
+    0x15, 0x0e, 0x82, 0x45, 0x03, 0x38, 0x0b, 0x0a, 0x37, 0x85, 0x45, 0x07, 0x38, 0x26, 0x1c, 0x41,
+    0x0a, 0x2d, 0x2f, 0x38, 0x84, 0x45, 0x02, 0x38, 0x0a, 0x41, 0x99, 0x45, 0xa3, 0x45, 0x06, 0x06,
+    0x2f, 0x2f, 0x2d, 0x2f, 0x2f, 0x41, 0x8b, 0x45, 0x83, 0x06, 0x00, 0x2d, 0x84, 0x45, 0x00, 0x0b,
+    0x83, 0x45, 0x08, 0x38, 0x0a, 0x34, 0x41, 0x45, 0x34, 0x0a, 0x0e, 0x34, 0x84, 0x45, 0x09, 0x38,
+    0x1e, 0x0e, 0x34, 0x32, 0x12, 0x01, 0x2f, 0x2d, 0x2f, 0x85, 0x45, 0x02, 0x38, 0x1c, 0x41, 0x98,
+    0x45, 0xa2, 0x45, 0x06, 0x3a, 0x0a, 0x2d, 0x2f, 0x2f, 0x2d, 0x2f, 0x8d, 0x45, 0x01, 0x15, 0x0e,
+    0x86, 0x45, 0x0c, 0x15, 0x3e, 0x41, 0x45, 0x45, 0x1c, 0x11, 0x45, 0x3a, 0x12, 0x0a, 0x0e, 0x41,
+    0x84, 0x45, 0x0c, 0x25, 0x0e, 0x25, 0x39, 0x1e, 0x2f, 0x2d, 0x2f, 0x17, 0x28, 0x2f, 0x45, 0x41,
+    0x84, 0x45, 0x00, 0x11, 0x99, 0x45, 0xa2, 0x45, 0x07, 0x31, 0x12, 0x2f, 0x2d, 0x2f, 0x2f, 0x34,
+    0x41, 0x87, 0x45, 0x00, 0x3e, 0x8c, 0x45, 0x01, 0x1c, 0x41, 0x82, 0x45, 0x05, 0x28, 0x05, 0x05,
+    0x06, 0x0a, 0x2e, 0x84, 0x45, 0x0d, 0x1e, 0x0a, 0x2d, 0x41, 0x1f, 0x30, 0x2d, 0x1c, 0x2d, 0x26,
+    0x1f, 0x1f, 0x1c, 0x2d, 0x85, 0x45, 0x00, 0x15, 0x99, 0x45, 0xa2, 0x45, 0x07, 0x38, 0x0b, 0x2f,
+    0x2d, 0x2f, 0x2f, 0x34, 0x41, 0x94, 0x45, 0x02, 0x39, 0x2e, 0x33, 0x83, 0x45, 0x02, 0x38, 0x28,
+    0x38, 0x84, 0x45, 0x17, 0x34, 0x0a, 0x2d, 0x41, 0x1f, 0x28, 0x2f, 0x1f, 0x1f, 0x2f, 0x1f, 0x30,
+    0x2d, 0x17, 0x21, 0x17, 0x21, 0x3e, 0x45, 0x3e, 0x45, 0x38, 0x1c, 0x41, 0x98, 0x45, 0xa2, 0x45,
+    0x07, 0x34, 0x0b, 0x2f, 0x2d, 0x2f, 0x2f, 0x34, 0x41, 0x93, 0x45, 0x03, 0x37, 0x45, 0x2e, 0x33,
+    0x89, 0x45, 0x05, 0x38, 0x12, 0x1f, 0x41, 0x28, 0x2f, 0x82, 0x1f, 0x0f, 0x2f, 0x1f, 0x38, 0x33,
+    0x0e, 0x1c, 0x3e, 0x16, 0x1f, 0x1f, 0x11, 0x1c, 0x15, 0x09, 0x1c, 0x41, 0x99, 0x45, 0xa2, 0x45,
+    0x07, 0x38, 0x12, 0x1f, 0x2f, 0x2d, 0x2f, 0x2f, 0x41, 0x92, 0x45, 0x04, 0x26, 0x45, 0x45, 0x1c,
+    0x24, 0x88, 0x45, 0x17, 0x0e, 0x0e, 0x41, 0x20, 0x31, 0x34, 0x15, 0x1f, 0x1f, 0x2f, 0x1f, 0x38,
+    0x0e, 0x1c, 0x3e, 0x25, 0x05, 0x2f, 0x45, 0x0e, 0x1c, 0x0e, 0x0e, 0x41, 0x9b, 0x45, 0xa2, 0x45,
+    0x01, 0x38, 0x09, 0x82, 0x2f, 0x01, 0x2d, 0x2f, 0x91, 0x45, 0x00, 0x38, 0x82, 0x45, 0x02, 0x38,
+    0x33, 0x0e, 0x85, 0x45, 0x1b, 0x38, 0x12, 0x0e, 0x34, 0x32, 0x17, 0x45, 0x2d, 0x1c, 0x3b, 0x17,
+    0x21, 0x34, 0x0b, 0x15, 0x3e, 0x2d, 0x04, 0x2f, 0x45, 0x0e, 0x04, 0x3e, 0x45, 0x15, 0x1f, 0x0a,
+    0x37, 0x9a, 0x45, 0xa2, 0x45, 0x06, 0x38, 0x06, 0x2d, 0x38, 0x26, 0x2f, 0x2f, 0x8e, 0x45, 0x02,
+    0x38, 0x38, 0x33, 0x83, 0x45, 0x03, 0x38, 0x34, 0x1f, 0x41, 0x82, 0x45, 0x1f, 0x38, 0x20, 0x0e,
+    0x34, 0x32, 0x17, 0x3f, 0x2d, 0x0a, 0x2d, 0x41, 0x1f, 0x28, 0x31, 0x0e, 0x34, 0x32, 0x06, 0x2f,
+    0x45, 0x15, 0x09, 0x3e, 0x45, 0x0a, 0x0e, 0x41, 0x2d, 0x2d, 0x17, 0x1c, 0x41, 0x98, 0x45, 0xa3,
+    0x45, 0x00, 0x06, 0x82, 0x2f, 0x01, 0x2d, 0x2f, 0x88, 0x45, 0x04, 0x38, 0x38, 0x33, 0x45, 0x38,
+    0x83, 0x45, 0x06, 0x39, 0x45, 0x3e, 0x45, 0x3e, 0x34, 0x2d, 0x82, 0x45, 0x20, 0x25, 0x0e, 0x25,
+    0x39, 0x17, 0x45, 0x2d, 0x0a, 0x2d, 0x2f, 0x2f, 0x25, 0x25, 0x2d, 0x1c, 0x3b, 0x1f, 0x0e, 0x41,
+    0x25, 0x04, 0x3e, 0x41, 0x07, 0x0e, 0x34, 0x32, 0x17, 0x15, 0x3e, 0x41, 0x17, 0x38, 0x98, 0x45,
+    0xa3, 0x45, 0x06, 0x15, 0x1f, 0x25, 0x25, 0x2d, 0x34, 0x41, 0x86, 0x45, 0x00, 0x38, 0x89, 0x45,
+    0x10, 0x38, 0x38, 0x3e, 0x45, 0x15, 0x38, 0x45, 0x2d, 0x0a, 0x26, 0x34, 0x25, 0x31, 0x34, 0x0e,
+    0x1c, 0x3e, 0x82, 0x25, 0x15, 0x1f, 0x1f, 0x2f, 0x0e, 0x41, 0x40, 0x32, 0x12, 0x25, 0x41, 0x15,
+    0x09, 0x3e, 0x38, 0x12, 0x0a, 0x32, 0x45, 0x3b, 0x17, 0x04, 0x3e, 0x98, 0x45, 0xa0, 0x45, 0x08,
+    0x41, 0x45, 0x45, 0x31, 0x0a, 0x2d, 0x2f, 0x2f, 0x25, 0x87, 0x45, 0x00, 0x38, 0x87, 0x45, 0x2a,
+    0x31, 0x34, 0x41, 0x3e, 0x45, 0x3e, 0x0a, 0x2d, 0x0a, 0x2d, 0x2f, 0x2f, 0x15, 0x3e, 0x2d, 0x1f,
+    0x41, 0x1f, 0x1f, 0x1c, 0x1f, 0x1f, 0x2f, 0x1f, 0x26, 0x41, 0x45, 0x45, 0x40, 0x40, 0x1f, 0x0e,
+    0x2f, 0x38, 0x11, 0x0e, 0x34, 0x45, 0x3b, 0x17, 0x0e, 0x0e, 0x09, 0x99, 0x45, 0xa4, 0x45, 0x04,
+    0x15, 0x24, 0x2d, 0x1c, 0x3b, 0x87, 0x45, 0x00, 0x38, 0x83, 0x45, 0x82, 0x38, 0x82, 0x45, 0x28,
+    0x38, 0x3e, 0x45, 0x15, 0x02, 0x1f, 0x30, 0x2d, 0x17, 0x45, 0x3a, 0x0a, 0x34, 0x41, 0x25, 0x31,
+    0x3a, 0x0b, 0x2d, 0x1c, 0x25, 0x41, 0x35, 0x1d, 0x25, 0x41, 0x35, 0x25, 0x31, 0x3a, 0x0b, 0x15,
+    0x2f, 0x45, 0x3b, 0x17, 0x0e, 0x0e, 0x04, 0x1c, 0x41, 0x99, 0x45, 0xa5, 0x45, 0x06, 0x06, 0x2f,
+    0x2f, 0x25, 0x41, 0x45, 0x41, 0x85, 0x45, 0x30, 0x38, 0x38, 0x3e, 0x3e, 0x45, 0x3e, 0x45, 0x45,
+    0x38, 0x33, 0x45, 0x45, 0x25, 0x0e, 0x35, 0x1d, 0x25, 0x45, 0x3a, 0x0a, 0x34, 0x45, 0x45, 0x31,
+    0x1d, 0x2f, 0x2d, 0x2f, 0x2f, 0x41, 0x45, 0x40, 0x1f, 0x3a, 0x39, 0x0e, 0x1c, 0x3e, 0x2f, 0x2d,
+    0x41, 0x40, 0x40, 0x1e, 0x0e, 0x0e, 0x04, 0x1c, 0x41, 0x9b, 0x45, 0x92, 0x45, 0x00, 0x41, 0x91,
+    0x45, 0x07, 0x38, 0x09, 0x1c, 0x2f, 0x45, 0x41, 0x32, 0x38, 0x89, 0x45, 0x2a, 0x38, 0x34, 0x3c,
+    0x45, 0x45, 0x31, 0x1d, 0x41, 0x26, 0x1f, 0x41, 0x28, 0x0e, 0x0e, 0x34, 0x41, 0x3e, 0x1f, 0x41,
+    0x38, 0x45, 0x45, 0x28, 0x28, 0x45, 0x40, 0x40, 0x39, 0x04, 0x0e, 0x43, 0x30, 0x0a, 0x1d, 0x39,
+    0x45, 0x26, 0x0e, 0x0e, 0x09, 0x15, 0x3e, 0x41, 0x9c, 0x45, 0xa7, 0x45, 0x02, 0x15, 0x09, 0x3e,
+    0x83, 0x45, 0x83, 0x38, 0x03, 0x33, 0x45, 0x38, 0x38, 0x83, 0x45, 0x24, 0x39, 0x1f, 0x30, 0x2d,
+    0x17, 0x45, 0x25, 0x0e, 0x25, 0x2d, 0x45, 0x1f, 0x0e, 0x2f, 0x1f, 0x1f, 0x2f, 0x38, 0x45, 0x32,
+    0x25, 0x1f, 0x41, 0x38, 0x17, 0x45, 0x2d, 0x0a, 0x17, 0x38, 0x40, 0x32, 0x0e, 0x0e, 0x05, 0x0e,
+    0x38, 0x9f, 0x45, 0x8d, 0x45, 0x00, 0x41, 0x99, 0x45, 0x04, 0x3a, 0x0e, 0x0e, 0x34, 0x41, 0x87,
+    0x45, 0x00, 0x3e, 0x82, 0x45, 0x23, 0x25, 0x31, 0x3a, 0x0b, 0x3e, 0x33, 0x0e, 0x0e, 0x34, 0x45,
+    0x30, 0x0a, 0x25, 0x25, 0x2d, 0x11, 0x39, 0x45, 0x16, 0x1f, 0x3e, 0x45, 0x2f, 0x12, 0x26, 0x2c,
+    0x19, 0x17, 0x38, 0x40, 0x29, 0x0e, 0x0e, 0x05, 0x0a, 0x37, 0xa1, 0x45, 0x91, 0x45, 0x00, 0x41,
+    0x98, 0x45, 0x2a, 0x24, 0x0a, 0x05, 0x1f, 0x2d, 0x38, 0x26, 0x3e, 0x34, 0x25, 0x25, 0x0e, 0x0e,
+    0x28, 0x2c, 0x1e, 0x34, 0x25, 0x1c, 0x0e, 0x41, 0x40, 0x2d, 0x0a, 0x26, 0x25, 0x31, 0x0a, 0x2d,
+    0x41, 0x11, 0x0e, 0x3e, 0x45, 0x3e, 0x0a, 0x3e, 0x45, 0x1f, 0x30, 0x45, 0x40, 0x32, 0x82, 0x0e,
+    0x02, 0x05, 0x34, 0x41, 0xa2, 0x45, 0x8b, 0x45, 0x00, 0x41, 0xa1, 0x45, 0x2c, 0x3a, 0x2f, 0x2d,
+    0x24, 0x2d, 0x25, 0x0e, 0x02, 0x1f, 0x32, 0x12, 0x25, 0x1f, 0x1f, 0x11, 0x3e, 0x33, 0x2f, 0x1f,
+    0x1f, 0x1c, 0x34, 0x0b, 0x2f, 0x41, 0x15, 0x1f, 0x34, 0x25, 0x0a, 0x2d, 0x2f, 0x38, 0x12, 0x0a,
+    0x32, 0x40, 0x32, 0x12, 0x0e, 0x0e, 0x04, 0x2f, 0x45, 0x41, 0xa3, 0x45, 0xb2, 0x45, 0x27, 0x39,
+    0x0a, 0x2d, 0x2f, 0x25, 0x0e, 0x43, 0x30, 0x0e, 0x34, 0x45, 0x1f, 0x1f, 0x11, 0x34, 0x41, 0x25,
+    0x28, 0x2f, 0x1f, 0x1f, 0x0e, 0x41, 0x40, 0x1f, 0x1f, 0x2f, 0x1f, 0x0e, 0x34, 0x45, 0x3b, 0x1f,
+    0x0e, 0x0e, 0x04, 0x25, 0x41, 0x45, 0x41, 0xa4, 0x45, 0x82, 0x45, 0x00, 0x41, 0xac, 0x45, 0x25,
+    0x38, 0x12, 0x0a, 0x32, 0x25, 0x0e, 0x43, 0x2f, 0x06, 0x2f, 0x45, 0x15, 0x25, 0x0e, 0x35, 0x41,
+    0x15, 0x1f, 0x1f, 0x2f, 0x1f, 0x0e, 0x41, 0x38, 0x0a, 0x2d, 0x2f, 0x25, 0x11, 0x29, 0x45, 0x34,
+    0x1e, 0x0e, 0x0e, 0x04, 0x25, 0x41, 0x87, 0x45, 0x00, 0x3e, 0x9a, 0x45, 0x00, 0x41, 0x83, 0x45,
+    0x89, 0x45, 0x00, 0x41, 0xa4, 0x45, 0x25, 0x15, 0x0e, 0x32, 0x25, 0x0e, 0x43, 0x2f, 0x0a, 0x2d,
+    0x2f, 0x2f, 0x25, 0x1f, 0x41, 0x45, 0x0a, 0x1d, 0x1f, 0x30, 0x1f, 0x0e, 0x45, 0x3a, 0x0a, 0x34,
+    0x45, 0x3e, 0x15, 0x2f, 0x45, 0x3b, 0x26, 0x0e, 0x0b, 0x06, 0x15, 0x3e, 0x41, 0xa9, 0x45, 0xad,
+    0x45, 0x24, 0x1c, 0x11, 0x31, 0x20, 0x15, 0x3e, 0x41, 0x0a, 0x1d, 0x1f, 0x45, 0x28, 0x1c, 0x41,
+    0x1f, 0x1f, 0x1c, 0x1f, 0x34, 0x25, 0x0a, 0x42, 0x34, 0x0a, 0x2d, 0x45, 0x45, 0x16, 0x1f, 0x3e,
+    0x40, 0x32, 0x0e, 0x0e, 0x05, 0x0e, 0x38, 0xa0, 0x45, 0x00, 0x41, 0x8a, 0x45, 0xab, 0x45, 0x24,
+    0x29, 0x0a, 0x2d, 0x2f, 0x25, 0x41, 0x38, 0x0a, 0x25, 0x25, 0x2d, 0x34, 0x0a, 0x2d, 0x2f, 0x25,
+    0x11, 0x1c, 0x41, 0x1f, 0x1f, 0x41, 0x28, 0x0e, 0x25, 0x41, 0x45, 0x1f, 0x1f, 0x3b, 0x40, 0x32,
+    0x0e, 0x0e, 0x05, 0x0a, 0x37, 0xae, 0x45, 0xaa, 0x45, 0x23, 0x15, 0x1f, 0x3b, 0x17, 0x3e, 0x25,
+    0x1c, 0x11, 0x31, 0x45, 0x3a, 0x0a, 0x34, 0x25, 0x25, 0x0a, 0x37, 0x45, 0x2d, 0x1c, 0x25, 0x2f,
+    0x2d, 0x2f, 0x2f, 0x41, 0x1f, 0x1f, 0x2f, 0x40, 0x32, 0x0e, 0x0e, 0x0a, 0x09, 0x2f, 0xb0, 0x45,
+    0xaa, 0x45, 0x21, 0x04, 0x0e, 0x35, 0x15, 0x1f, 0x25, 0x41, 0x45, 0x38, 0x0e, 0x34, 0x1f, 0x1f,
+    0x1c, 0x1f, 0x41, 0x15, 0x1f, 0x25, 0x25, 0x2d, 0x1f, 0x41, 0x45, 0x25, 0x0e, 0x35, 0x41, 0x35,
+    0x15, 0x0e, 0x0e, 0x04, 0x2f, 0xb2, 0x45, 0xaa, 0x45, 0x1f, 0x04, 0x1c, 0x0e, 0x34, 0x32, 0x15,
+    0x3e, 0x2d, 0x1f, 0x2d, 0x2d, 0x17, 0x34, 0x41, 0x25, 0x15, 0x1f, 0x34, 0x2f, 0x12, 0x3e, 0x45,
+    0x2f, 0x0e, 0x34, 0x45, 0x3b, 0x1f, 0x0e, 0x0e, 0x04, 0x2f, 0xb4, 0x45, 0xaa, 0x45, 0x1e, 0x0e,
+    0x0e, 0x1f, 0x0b, 0x15, 0x35, 0x1d, 0x25, 0x38, 0x12, 0x35, 0x3e, 0x15, 0x1f, 0x0e, 0x45, 0x38,
+    0x0a, 0x2d, 0x2f, 0x25, 0x11, 0x29, 0x45, 0x34, 0x1e, 0x0e, 0x0e, 0x04, 0x1f, 0x41, 0xb5, 0x45,
+    0xab, 0x45, 0x1b, 0x2d, 0x04, 0x0e, 0x1c, 0x0e, 0x29, 0x29, 0x0e, 0x39, 0x39, 0x1e, 0x11, 0x45,
+    0x39, 0x0e, 0x34, 0x41, 0x15, 0x0e, 0x32, 0x40, 0x40, 0x1e, 0x0e, 0x0e, 0x04, 0x1f, 0x41, 0x87,
+    0x45, 0x00, 0x3e, 0xae, 0x45, 0x95, 0x45, 0x00, 0x3f, 0x96, 0x45, 0x18, 0x1c, 0x06, 0x0b, 0x15,
+    0x17, 0x38, 0x1f, 0x0e, 0x45, 0x38, 0x0a, 0x2d, 0x2f, 0x25, 0x11, 0x29, 0x40, 0x40, 0x1e, 0x0e,
+    0x0b, 0x06, 0x15, 0x3e, 0x41, 0xb8, 0x45, 0xaf, 0x45, 0x15, 0x0a, 0x05, 0x1f, 0x0e, 0x34, 0x32,
+    0x15, 0x16, 0x45, 0x3a, 0x12, 0x26, 0x41, 0x45, 0x26, 0x0e, 0x0b, 0x06, 0x15, 0x3e, 0x45, 0x3e,
+    0xb9, 0x45, 0xb0, 0x45, 0x10, 0x31, 0x06, 0x0a, 0x0e, 0x1c, 0x3e, 0x25, 0x15, 0x1f, 0x3b, 0x40,
+    0x32, 0x0e, 0x0e, 0x05, 0x0a, 0x38, 0xbd, 0x45, 0x99, 0x45, 0x00, 0x3f, 0x97, 0x45, 0x0c, 0x24,
+    0x04, 0x0e, 0x0e, 0x34, 0x45, 0x3b, 0x29, 0x0e, 0x0b, 0x05, 0x0a, 0x37, 0xbf, 0x45, 0x83, 0x45,
+    0x00, 0x41, 0xaf, 0x45, 0x02, 0x15, 0x06, 0x0a, 0x82, 0x0e, 0x04, 0x05, 0x0a, 0x2f, 0x45, 0x41,
+    0xbf, 0x45, 0xb5, 0x45, 0x05, 0x3a, 0x09, 0x05, 0x05, 0x06, 0x2d, 0xc3, 0x45, 0xb7, 0x45, 0x01,
+    0x38, 0x38, 0xb9, 0x45, 0x00, 0x41, 0x8a, 0x45, 0xde, 0x45, 0x00, 0x41, 0x9f, 0x45, 0xc6, 0x45,
+    0x00, 0x41, 0xb7, 0x45, 0xdf, 0x45, 0x00, 0x41, 0x9e, 0x45, 0xff, 0x45, 0xe1, 0x45, 0x00, 0x41,
+    0x9c, 0x45, 0xa9, 0x45, 0x00, 0x41, 0xd4, 0x45, 0xe4, 0x45, 0x00, 0x41, 0x99, 0x45, 0xbc, 0x45,
+    0x00, 0x41, 0xc1, 0x45, 0xe8, 0x45, 0x00, 0x41, 0x95, 0x45, 0x8d, 0x45, 0x00, 0x41, 0xe3, 0x45,
+    0x00, 0x41, 0x8b, 0x45, 0xed, 0x45, 0x00, 0x41, 0x90, 0x45,
+};
+
+// 120 colors, 6114 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_7[] = {
+    0x10e3, 0x1125, 0x1985, 0x2124, 0x2186, 0x21a8, 0x2946, 0x2a2a, 0x3186, 0x3207, 0x3a4a, 0x3b72,
+    0x4248, 0x42ad, 0x4a89, 0x4a8b, 0x522a, 0x5247, 0x52cb, 0x532e, 0x5987, 0x62ec, 0x630b, 0x63b1,
+    0x6b8e, 0x7244, 0x7349, 0x7432, 0x7ddb, 0x8185, 0x83ce, 0x84f4, 0x8ac6, 0x8acc, 0x8c4f, 0x8c92,
+    0x91c3, 0x9227, 0x9556, 0x965d, 0x9b06, 0x9cf3, 0x9d78, 0xa4d4, 0xa557, 0xa5fa, 0xab47, 0xad55,
+    0xad78, 0xadb5, 0xadb7, 0xadd9, 0xae5b, 0xaebd, 0xb1e3, 0xb225, 0xb2c8, 0xb531, 0xb532, 0xb574,
+    0xb5b6, 0xb5f9, 0xb639, 0xbb02, 0xbb8c, 0xbd74, 0xbd76, 0xbdf7, 0xbe7a, 0xbebb, 0xc513, 0xc638,
+    0xc67a, 0xc6ba, 0xc6bb, 0xcbc8, 0xcc49, 0xcdd4, 0xceba, 0xcebb, 0xcefd, 0xcf3e, 0xd2e7, 0xd44e,
+    0xd679, 0xd6ba, 0xd6bb, 0xd6fb, 0xd6fc, 0xde35, 0xde36, 0xdeb9, 0xdefb, 0xdf3d, 0xdf7e, 0xe6fb,
+    0xe73c, 0xe73d, 0xe77d, 0xe77e, 0xebe8, 0xebea, 0xecec, 0xee97, 0xeefa, 0xef3b, 0xef3c, 0xef7d,
+    0xefbe, 0xefbf, 0xf449, 0xf44b, 0xf4aa, 0xf77d, 0xf77e, 0xf7be, 0xf7bf, 0xf7ff, 0xffbe, 0xffff,
+};
+static constexpr uint16_t mac_row_7[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 59, 70, 84, 100, 118, 138, 164,
+    188, 214, 242, 277, 318, 353, 390, 429, 470, 513, 557, 608, 655, 706, 758, 813,
+    874, 931, 990, 1049, 1109, 1169, 1233, 1296, 1359, 1417, 1483, 1549, 1616, 1681, 1747, 1809,
+    1870, 1927, 1990, 2055, 2118, 2184, 2244, 2305, 2366, 2423, 2484, 2542, 2604, 2665, 2720, 2776,
+    2832, 2893, 2953, 3012, 3064, 3118, 3168, 3218, 3263, 3314, 3363, 3410, 3460, 3503, 3556, 3603,
+    3646, 3691, 3743, 3799, 3861, 3924, 3984, 4047, 4108, 4176, 4247, 4327, 4411, 4481, 4546, 4607,
+    4667, 4726, 4786, 4842, 4899, 4948, 5002, 5053, 5104, 5152, 5199, 5244, 5290, 5331, 5369, 5407,
+    5438, 5465, 5489, 5513, 5530, 5548, 5558, 5564, 5570, 5572, 5578, 5584, 5590, 5596, 5602, 5612,
+};
+static constexpr uint8_t mac_code_7[] = {
+    0xff, 0x77, 0xd8, 0x77, 0x00, 0x73, 0xa5, 0x77, 0x86, 0x77, 0x00, 0x73, 0xc9, 0x77, 0x00, 0x73,
+    0xac, 0x77, 0xbf, 0x77, 0x00, 0x73, 0xbe, 0x77, 0xff, 0x77, 0xa7, 0x77, 0x00, 0x73, 0xd6, 0x77,
+    0x9d, 0x77, 0x00, 0x73, 0xcb, 0x77, 0x00, 0x73, 0x93, 0x77, 0x90, 0x77, 0x00, 0x73, 0xe8, 0x77,
+    0x00, 0x73, 0x83, 0x77, 0xd6, 0x77, 0x01, 0x60, 0x73, 0xa6, 0x77, 0xd3, 0x77, 0x05, 0x43, 0x23,
+    0x23, 0x13, 0x0e, 0x6b, 0xa5, 0x77, 0xd0, 0x77, 0x08, 0x5c, 0x29, 0x1f, 0x3e, 0x32, 0x16, 0x06,
+    0x03, 0x55, 0xa5, 0x77, 0xce, 0x77, 0x05, 0x57, 0x23, 0x23, 0x48, 0x26, 0x0f, 0x82, 0x08, 0x01,
+    0x06, 0x55, 0xa5, 0x77, 0xcc, 0x77, 0x0c, 0x4e, 0x1b, 0x26, 0x48, 0x26, 0x0a, 0x08, 0x08, 0x06,
+    0x08, 0x08, 0x06, 0x55, 0xa5, 0x77, 0xca, 0x77, 0x08, 0x54, 0x1b, 0x26, 0x44, 0x29, 0x09, 0x08,
+    0x08, 0x06, 0x82, 0x08, 0x02, 0x06, 0x08, 0x55, 0xa5, 0x77, 0x87, 0x77, 0x00, 0x73, 0xbf, 0x77,
+    0x05, 0x47, 0x1b, 0x26, 0x44, 0x23, 0x09, 0x82, 0x08, 0x07, 0x06, 0x08, 0x08, 0x09, 0x08, 0x08,
+    0x06, 0x55, 0xa5, 0x77, 0xc6, 0x77, 0x12, 0x43, 0x23, 0x33, 0x44, 0x1b, 0x08, 0x08, 0x06, 0x08,
+    0x08, 0x09, 0x09, 0x29, 0x48, 0x3e, 0x08, 0x08, 0x06, 0x55, 0xa5, 0x77, 0xc4, 0x77, 0x04, 0x3c,
+    0x1b, 0x3d, 0x3e, 0x1b, 0x82, 0x08, 0x05, 0x06, 0x08, 0x08, 0x09, 0x29, 0x48, 0x82, 0x5d, 0x03,
+    0x06, 0x03, 0x06, 0x55, 0xa5, 0x77, 0xc2, 0x77, 0x16, 0x2f, 0x1b, 0x3d, 0x3d, 0x18, 0x06, 0x03,
+    0x06, 0x08, 0x08, 0x06, 0x0a, 0x2f, 0x58, 0x5d, 0x5d, 0x61, 0x5d, 0x44, 0x06, 0x03, 0x06, 0x5c,
+    0xa5, 0x77, 0xbf, 0x77, 0x15, 0x60, 0x29, 0x1f, 0x44, 0x32, 0x16, 0x08, 0x08, 0x06, 0x08, 0x08,
+    0x09, 0x12, 0x2c, 0x58, 0x5d, 0x61, 0x5d, 0x61, 0x5d, 0x4f, 0x3e, 0x82, 0x08, 0x00, 0x5c, 0xa0,
+    0x77, 0x00, 0x73, 0x83, 0x77, 0x8b, 0x77, 0x00, 0x73, 0xb0, 0x77, 0x05, 0x5c, 0x29, 0x1f, 0x3e,
+    0x32, 0x16, 0x82, 0x08, 0x12, 0x06, 0x08, 0x08, 0x12, 0x2c, 0x62, 0x6c, 0x62, 0x6c, 0x61, 0x5d,
+    0x4f, 0x4f, 0x3e, 0x32, 0x08, 0x08, 0x06, 0x55, 0xa2, 0x77, 0x02, 0x73, 0x77, 0x77, 0xbb, 0x77,
+    0x15, 0x56, 0x23, 0x23, 0x48, 0x26, 0x0f, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x12, 0x43, 0x62,
+    0x6c, 0x61, 0x6c, 0x62, 0x5d, 0x44, 0x44, 0x82, 0x4a, 0x04, 0x2a, 0x08, 0x08, 0x06, 0x55, 0xa5,
+    0x77, 0xb9, 0x77, 0x1f, 0x4e, 0x1b, 0x26, 0x48, 0x29, 0x09, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09,
+    0x12, 0x47, 0x6c, 0x62, 0x5d, 0x61, 0x5d, 0x61, 0x58, 0x5d, 0x3e, 0x32, 0x3e, 0x32, 0x3e, 0x26,
+    0x08, 0x08, 0x06, 0x55, 0xa5, 0x77, 0xb7, 0x77, 0x1d, 0x54, 0x1b, 0x2c, 0x44, 0x29, 0x09, 0x08,
+    0x08, 0x06, 0x08, 0x08, 0x06, 0x18, 0x48, 0x6c, 0x62, 0x6c, 0x62, 0x5d, 0x61, 0x50, 0x4a, 0x4a,
+    0x2a, 0x2d, 0x33, 0x44, 0x33, 0x44, 0x26, 0x82, 0x08, 0x00, 0x5c, 0xa5, 0x77, 0xb5, 0x77, 0x23,
+    0x54, 0x1b, 0x26, 0x44, 0x23, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x09, 0x1e, 0x4e, 0x6c, 0x62,
+    0x6c, 0x6c, 0x62, 0x5d, 0x4a, 0x4a, 0x44, 0x4a, 0x2d, 0x33, 0x33, 0x44, 0x33, 0x33, 0x44, 0x26,
+    0x08, 0x08, 0x06, 0x55, 0xa5, 0x77, 0xb3, 0x77, 0x07, 0x43, 0x23, 0x33, 0x44, 0x1b, 0x06, 0x03,
+    0x06, 0x82, 0x08, 0x11, 0x06, 0x1b, 0x3d, 0x62, 0x6c, 0x61, 0x6c, 0x62, 0x58, 0x5d, 0x3e, 0x3d,
+    0x3e, 0x3d, 0x3e, 0x3d, 0x33, 0x44, 0x82, 0x33, 0x01, 0x44, 0x26, 0x82, 0x08, 0x00, 0x5c, 0xa5,
+    0x77, 0xb1, 0x77, 0x07, 0x43, 0x1b, 0x3d, 0x3d, 0x17, 0x06, 0x03, 0x06, 0x83, 0x08, 0x1b, 0x1b,
+    0x3d, 0x62, 0x5d, 0x5d, 0x61, 0x6c, 0x62, 0x5d, 0x3e, 0x32, 0x3e, 0x33, 0x44, 0x33, 0x33, 0x2a,
+    0x33, 0x44, 0x33, 0x33, 0x2a, 0x2a, 0x1f, 0x08, 0x08, 0x06, 0x55, 0xa5, 0x77, 0xaf, 0x77, 0x1e,
+    0x2f, 0x1b, 0x3e, 0x32, 0x18, 0x06, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x1b, 0x3d, 0x62, 0x5d,
+    0x50, 0x4a, 0x4f, 0x3e, 0x4a, 0x4a, 0x2a, 0x2d, 0x2a, 0x33, 0x2a, 0x33, 0x2a, 0x2a, 0x33, 0x82,
+    0x2a, 0x03, 0x33, 0x2a, 0x2a, 0x1f, 0x82, 0x08, 0x00, 0x5c, 0x9c, 0x77, 0x00, 0x73, 0x87, 0x77,
+    0xac, 0x77, 0x1b, 0x60, 0x29, 0x23, 0x44, 0x32, 0x15, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x09,
+    0x1e, 0x44, 0x4a, 0x58, 0x5d, 0x61, 0x50, 0x4a, 0x3e, 0x32, 0x3e, 0x33, 0x33, 0x2a, 0x33, 0x83,
+    0x2a, 0x00, 0x33, 0x83, 0x2a, 0x82, 0x2c, 0x04, 0x26, 0x08, 0x08, 0x06, 0x55, 0xa5, 0x77, 0xaa,
+    0x77, 0x1b, 0x5c, 0x29, 0x1f, 0x44, 0x32, 0x15, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x09, 0x1f,
+    0x3e, 0x50, 0x4a, 0x4f, 0x4f, 0x3e, 0x4a, 0x3e, 0x32, 0x3e, 0x33, 0x33, 0x2a, 0x33, 0x83, 0x2a,
+    0x02, 0x2c, 0x2a, 0x33, 0x82, 0x2a, 0x08, 0x2c, 0x2c, 0x26, 0x44, 0x32, 0x08, 0x08, 0x06, 0x6b,
+    0xa5, 0x77, 0xa8, 0x77, 0x05, 0x56, 0x23, 0x29, 0x48, 0x26, 0x0f, 0x82, 0x08, 0x10, 0x06, 0x08,
+    0x08, 0x09, 0x29, 0x44, 0x4a, 0x2d, 0x4a, 0x4a, 0x44, 0x3e, 0x32, 0x3e, 0x33, 0x2a, 0x33, 0x83,
+    0x2a, 0x03, 0x2c, 0x2a, 0x2a, 0x33, 0x82, 0x2a, 0x82, 0x2c, 0x08, 0x26, 0x44, 0x48, 0x3e, 0x26,
+    0x08, 0x08, 0x06, 0x6b, 0xa5, 0x77, 0xa6, 0x77, 0x13, 0x4e, 0x1b, 0x26, 0x44, 0x29, 0x09, 0x08,
+    0x08, 0x06, 0x08, 0x08, 0x09, 0x09, 0x1f, 0x3e, 0x32, 0x3e, 0x33, 0x33, 0x2d, 0x82, 0x33, 0x02,
+    0x2a, 0x2a, 0x33, 0x83, 0x2a, 0x00, 0x2c, 0x82, 0x2a, 0x00, 0x33, 0x82, 0x2a, 0x0c, 0x2c, 0x2c,
+    0x30, 0x33, 0x44, 0x33, 0x33, 0x1f, 0x13, 0x08, 0x08, 0x06, 0x6b, 0xa5, 0x77, 0x86, 0x77, 0x00,
+    0x73, 0x9c, 0x77, 0x08, 0x4e, 0x1b, 0x26, 0x44, 0x23, 0x09, 0x08, 0x08, 0x06, 0x82, 0x08, 0x10,
+    0x0a, 0x1f, 0x3e, 0x32, 0x33, 0x44, 0x33, 0x33, 0x2a, 0x2a, 0x3d, 0x3e, 0x4f, 0x3e, 0x4a, 0x2a,
+    0x33, 0x83, 0x2a, 0x0e, 0x2c, 0x2a, 0x2a, 0x33, 0x2a, 0x2a, 0x2c, 0x2c, 0x33, 0x44, 0x4f, 0x3e,
+    0x32, 0x1f, 0x0f, 0x82, 0x08, 0x01, 0x06, 0x6b, 0xa5, 0x77, 0xa2, 0x77, 0x05, 0x47, 0x1b, 0x32,
+    0x44, 0x29, 0x09, 0x82, 0x08, 0x09, 0x06, 0x08, 0x08, 0x12, 0x1f, 0x3e, 0x32, 0x33, 0x2a, 0x33,
+    0x82, 0x2a, 0x01, 0x4a, 0x6c, 0x85, 0x77, 0x18, 0x44, 0x32, 0x2a, 0x33, 0x2a, 0x2a, 0x3d, 0x3e,
+    0x3d, 0x33, 0x33, 0x44, 0x33, 0x44, 0x4a, 0x58, 0x3d, 0x26, 0x23, 0x09, 0x04, 0x08, 0x08, 0x06,
+    0x6b, 0xa5, 0x77, 0x02, 0x77, 0x77, 0x73, 0x9d, 0x77, 0x04, 0x43, 0x23, 0x33, 0x44, 0x1b, 0x83,
+    0x08, 0x0e, 0x06, 0x08, 0x08, 0x12, 0x1f, 0x33, 0x2a, 0x2a, 0x2c, 0x2a, 0x33, 0x2a, 0x2a, 0x3d,
+    0x6c, 0x88, 0x77, 0x17, 0x47, 0x33, 0x44, 0x33, 0x33, 0x44, 0x4a, 0x2d, 0x4a, 0x3e, 0x44, 0x4a,
+    0x48, 0x3e, 0x3d, 0x26, 0x2b, 0x18, 0x06, 0x01, 0x08, 0x08, 0x06, 0x6b, 0xa5, 0x77, 0x83, 0x77,
+    0x00, 0x73, 0x98, 0x77, 0x08, 0x5c, 0x2b, 0x1b, 0x3d, 0x3d, 0x17, 0x06, 0x03, 0x06, 0x83, 0x08,
+    0x0b, 0x16, 0x26, 0x33, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x33, 0x2a, 0x2a, 0x3d, 0x8b, 0x77, 0x16,
+    0x4f, 0x3e, 0x4a, 0x3e, 0x4a, 0x4a, 0x44, 0x3e, 0x4a, 0x4a, 0x44, 0x3e, 0x3d, 0x42, 0x41, 0x40,
+    0x09, 0x08, 0x08, 0x06, 0x08, 0x08, 0x6b, 0xa5, 0x77, 0x02, 0x77, 0x77, 0x73, 0x98, 0x77, 0x05,
+    0x60, 0x29, 0x23, 0x44, 0x32, 0x15, 0x82, 0x08, 0x10, 0x06, 0x08, 0x08, 0x09, 0x12, 0x29, 0x43,
+    0x30, 0x33, 0x33, 0x2a, 0x2a, 0x2c, 0x2a, 0x2a, 0x33, 0x58, 0x8d, 0x77, 0x15, 0x48, 0x3e, 0x4a,
+    0x4a, 0x58, 0x5d, 0x3e, 0x4a, 0x4a, 0x2a, 0x3b, 0x46, 0x40, 0x59, 0x5a, 0x04, 0x08, 0x04, 0x08,
+    0x04, 0x04, 0x6c, 0xa5, 0x77, 0x9a, 0x77, 0x04, 0x29, 0x1f, 0x44, 0x32, 0x16, 0x83, 0x08, 0x0c,
+    0x06, 0x08, 0x08, 0x09, 0x19, 0x21, 0x21, 0x2e, 0x25, 0x20, 0x2b, 0x33, 0x44, 0x82, 0x33, 0x00,
+    0x58, 0x88, 0x77, 0x01, 0x35, 0x75, 0x83, 0x77, 0x15, 0x5c, 0x48, 0x50, 0x61, 0x5d, 0x4f, 0x4f,
+    0x44, 0x29, 0x40, 0x38, 0x40, 0x40, 0x46, 0x4d, 0x04, 0x08, 0x04, 0x04, 0x08, 0x08, 0x73, 0xa5,
+    0x77, 0x86, 0x77, 0x00, 0x73, 0x91, 0x77, 0x19, 0x29, 0x3e, 0x32, 0x12, 0x08, 0x08, 0x06, 0x08,
+    0x08, 0x09, 0x09, 0x19, 0x38, 0x38, 0x25, 0x19, 0x28, 0x19, 0x28, 0x40, 0x1f, 0x3e, 0x32, 0x33,
+    0x2d, 0x4f, 0x89, 0x77, 0x01, 0x35, 0x75, 0x84, 0x77, 0x10, 0x58, 0x5d, 0x61, 0x50, 0x4a, 0x4a,
+    0x2f, 0x40, 0x38, 0x4b, 0x4b, 0x46, 0x53, 0x21, 0x04, 0x01, 0x01, 0x82, 0x08, 0x00, 0x73, 0xa5,
+    0x77, 0x84, 0x77, 0x00, 0x73, 0x92, 0x77, 0x02, 0x47, 0x32, 0x1b, 0x84, 0x08, 0x12, 0x06, 0x08,
+    0x14, 0x3f, 0x3f, 0x4c, 0x37, 0x28, 0x1d, 0x4b, 0x25, 0x24, 0x4b, 0x23, 0x44, 0x2d, 0x33, 0x34,
+    0x75, 0x88, 0x77, 0x01, 0x35, 0x6c, 0x85, 0x77, 0x14, 0x58, 0x5d, 0x3e, 0x4a, 0x43, 0x23, 0x41,
+    0x40, 0x4b, 0x38, 0x4c, 0x53, 0x66, 0x1a, 0x04, 0x08, 0x04, 0x04, 0x08, 0x08, 0x73, 0xa5, 0x77,
+    0x87, 0x77, 0x00, 0x73, 0x8f, 0x77, 0x15, 0x23, 0x44, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x14,
+    0x19, 0x28, 0x3f, 0x52, 0x64, 0x52, 0x3f, 0x37, 0x65, 0x25, 0x20, 0x4b, 0x23, 0x82, 0x34, 0x00,
+    0x6c, 0x89, 0x77, 0x01, 0x35, 0x75, 0x85, 0x77, 0x00, 0x58, 0x82, 0x45, 0x00, 0x46, 0x83, 0x4b,
+    0x0b, 0x38, 0x4c, 0x53, 0x40, 0x09, 0x04, 0x07, 0x05, 0x08, 0x08, 0x06, 0x6b, 0xa5, 0x77, 0x98,
+    0x77, 0x18, 0x1b, 0x26, 0x08, 0x08, 0x06, 0x08, 0x19, 0x1d, 0x1d, 0x25, 0x38, 0x52, 0x64, 0x70,
+    0x65, 0x4c, 0x37, 0x65, 0x24, 0x37, 0x3f, 0x40, 0x34, 0x34, 0x50, 0x89, 0x77, 0x01, 0x51, 0x5e,
+    0x86, 0x77, 0x04, 0x5d, 0x44, 0x44, 0x4d, 0x40, 0x83, 0x52, 0x0b, 0x4b, 0x4b, 0x40, 0x09, 0x04,
+    0x05, 0x07, 0x05, 0x08, 0x08, 0x06, 0x6b, 0xa5, 0x77, 0x02, 0x77, 0x77, 0x73, 0x95, 0x77, 0x1c,
+    0x23, 0x2c, 0x08, 0x08, 0x06, 0x25, 0x38, 0x38, 0x1d, 0x1d, 0x52, 0x52, 0x65, 0x6e, 0x65, 0x6e,
+    0x38, 0x64, 0x25, 0x37, 0x38, 0x40, 0x34, 0x34, 0x6c, 0x77, 0x77, 0x35, 0x51, 0x85, 0x77, 0x00,
+    0x35, 0x87, 0x77, 0x10, 0x60, 0x45, 0x3a, 0x59, 0x53, 0x65, 0x52, 0x4b, 0x52, 0x64, 0x4c, 0x20,
+    0x04, 0x08, 0x04, 0x07, 0x05, 0x82, 0x08, 0x00, 0x73, 0xa5, 0x77, 0x02, 0x77, 0x77, 0x73, 0x95,
+    0x77, 0x17, 0x23, 0x2c, 0x08, 0x08, 0x21, 0x52, 0x3f, 0x38, 0x25, 0x25, 0x4b, 0x52, 0x52, 0x65,
+    0x65, 0x6e, 0x38, 0x64, 0x3f, 0x37, 0x38, 0x4c, 0x2d, 0x4f, 0x83, 0x77, 0x01, 0x1c, 0x6c, 0x83,
+    0x77, 0x01, 0x62, 0x58, 0x87, 0x77, 0x0f, 0x60, 0x42, 0x41, 0x4d, 0x4b, 0x65, 0x52, 0x65, 0x6e,
+    0x4c, 0x65, 0x11, 0x04, 0x08, 0x07, 0x05, 0x83, 0x08, 0x00, 0x73, 0xa5, 0x77, 0x82, 0x77, 0x00,
+    0x73, 0x94, 0x77, 0x0b, 0x23, 0x26, 0x08, 0x08, 0x2e, 0x4b, 0x52, 0x4c, 0x40, 0x25, 0x3f, 0x3f,
+    0x82, 0x52, 0x08, 0x65, 0x6e, 0x64, 0x52, 0x25, 0x38, 0x4b, 0x2d, 0x74, 0x83, 0x77, 0x01, 0x5c,
+    0x27, 0x83, 0x77, 0x01, 0x44, 0x74, 0x87, 0x77, 0x0f, 0x5d, 0x39, 0x46, 0x53, 0x4c, 0x65, 0x52,
+    0x64, 0x70, 0x4b, 0x4b, 0x08, 0x08, 0x06, 0x0a, 0x05, 0x82, 0x08, 0x01, 0x0a, 0x73, 0xa5, 0x77,
+    0x82, 0x77, 0x00, 0x73, 0x94, 0x77, 0x0a, 0x1f, 0x26, 0x08, 0x08, 0x20, 0x52, 0x4b, 0x65, 0x4c,
+    0x37, 0x3f, 0x82, 0x52, 0x08, 0x3f, 0x52, 0x52, 0x64, 0x52, 0x37, 0x38, 0x4b, 0x4f, 0x85, 0x77,
+    0x01, 0x58, 0x45, 0x82, 0x77, 0x00, 0x49, 0x88, 0x77, 0x0f, 0x54, 0x46, 0x4d, 0x4b, 0x65, 0x6f,
+    0x65, 0x6e, 0x64, 0x4b, 0x4b, 0x08, 0x04, 0x07, 0x07, 0x05, 0x82, 0x08, 0x01, 0x09, 0x73, 0xa5,
+    0x77, 0x82, 0x77, 0x00, 0x73, 0x94, 0x77, 0x17, 0x1b, 0x26, 0x08, 0x08, 0x20, 0x38, 0x3f, 0x52,
+    0x52, 0x38, 0x3f, 0x52, 0x37, 0x52, 0x3f, 0x52, 0x52, 0x65, 0x52, 0x37, 0x3f, 0x4c, 0x60, 0x73,
+    0x85, 0x77, 0x05, 0x44, 0x62, 0x6c, 0x61, 0x6c, 0x62, 0x87, 0x77, 0x0e, 0x4d, 0x53, 0x53, 0x4b,
+    0x65, 0x6f, 0x6f, 0x65, 0x65, 0x4c, 0x4b, 0x05, 0x08, 0x07, 0x05, 0x82, 0x08, 0x02, 0x09, 0x09,
+    0x73, 0xa5, 0x77, 0x82, 0x77, 0x00, 0x73, 0x94, 0x77, 0x15, 0x1f, 0x26, 0x08, 0x08, 0x28, 0x38,
+    0x3f, 0x52, 0x52, 0x37, 0x37, 0x3f, 0x37, 0x3f, 0x3f, 0x37, 0x52, 0x64, 0x52, 0x36, 0x3f, 0x53,
+    0x87, 0x77, 0x04, 0x60, 0x42, 0x73, 0x47, 0x6c, 0x88, 0x77, 0x0f, 0x46, 0x40, 0x40, 0x38, 0x65,
+    0x4c, 0x4b, 0x38, 0x21, 0x21, 0x10, 0x05, 0x08, 0x07, 0x07, 0x05, 0x82, 0x08, 0x00, 0x09, 0xa6,
+    0x77, 0x89, 0x77, 0x00, 0x73, 0x8c, 0x77, 0x16, 0x60, 0x1f, 0x26, 0x08, 0x08, 0x20, 0x37, 0x3f,
+    0x4b, 0x3f, 0x1d, 0x25, 0x52, 0x4b, 0x3f, 0x37, 0x25, 0x52, 0x52, 0x3f, 0x3f, 0x36, 0x4d, 0x88,
+    0x77, 0x02, 0x57, 0x2f, 0x58, 0x89, 0x77, 0x13, 0x40, 0x38, 0x40, 0x25, 0x28, 0x21, 0x10, 0x0a,
+    0x07, 0x0f, 0x07, 0x05, 0x05, 0x08, 0x01, 0x01, 0x04, 0x08, 0x04, 0x0c, 0xa6, 0x77, 0x97, 0x77,
+    0x16, 0x60, 0x1f, 0x26, 0x08, 0x08, 0x21, 0x2e, 0x4b, 0x4b, 0x3f, 0x1d, 0x25, 0x3f, 0x52, 0x3f,
+    0x25, 0x37, 0x25, 0x37, 0x36, 0x52, 0x37, 0x5b, 0x89, 0x77, 0x01, 0x2b, 0x5f, 0x88, 0x77, 0x14,
+    0x57, 0x25, 0x20, 0x1d, 0x0a, 0x07, 0x07, 0x0f, 0x07, 0x0f, 0x07, 0x07, 0x05, 0x05, 0x01, 0x01,
+    0x00, 0x04, 0x08, 0x04, 0x0c, 0xa6, 0x77, 0x8a, 0x77, 0x00, 0x73, 0x8b, 0x77, 0x0e, 0x60, 0x1f,
+    0x26, 0x08, 0x08, 0x28, 0x4b, 0x52, 0x3f, 0x37, 0x25, 0x25, 0x4b, 0x37, 0x3f, 0x82, 0x37, 0x04,
+    0x24, 0x37, 0x36, 0x37, 0x6a, 0x88, 0x77, 0x03, 0x57, 0x54, 0x46, 0x72, 0x87, 0x77, 0x0d, 0x47,
+    0x19, 0x14, 0x0d, 0x07, 0x05, 0x05, 0x0d, 0x0d, 0x07, 0x05, 0x08, 0x07, 0x05, 0x82, 0x00, 0x03,
+    0x01, 0x08, 0x08, 0x0a, 0xa6, 0x77, 0x8a, 0x77, 0x00, 0x73, 0x8b, 0x77, 0x08, 0x60, 0x1f, 0x26,
+    0x08, 0x08, 0x20, 0x3f, 0x4c, 0x52, 0x82, 0x37, 0x0a, 0x52, 0x3f, 0x3f, 0x38, 0x36, 0x37, 0x1d,
+    0x36, 0x37, 0x38, 0x76, 0x88, 0x77, 0x04, 0x54, 0x73, 0x5f, 0x46, 0x72, 0x86, 0x77, 0x15, 0x22,
+    0x09, 0x08, 0x07, 0x0f, 0x07, 0x07, 0x0f, 0x0d, 0x07, 0x0d, 0x07, 0x05, 0x04, 0x01, 0x00, 0x00,
+    0x01, 0x08, 0x08, 0x0a, 0x73, 0xa5, 0x77, 0x8f, 0x77, 0x00, 0x73, 0x86, 0x77, 0x15, 0x56, 0x26,
+    0x23, 0x08, 0x08, 0x28, 0x37, 0x38, 0x52, 0x37, 0x1d, 0x25, 0x52, 0x37, 0x37, 0x38, 0x25, 0x25,
+    0x24, 0x37, 0x3f, 0x40, 0x89, 0x77, 0x04, 0x5a, 0x77, 0x77, 0x5a, 0x67, 0x86, 0x77, 0x10, 0x07,
+    0x05, 0x05, 0x0d, 0x07, 0x0f, 0x07, 0x07, 0x0f, 0x0d, 0x0d, 0x05, 0x08, 0x01, 0x00, 0x04, 0x01,
+    0x82, 0x08, 0x00, 0x16, 0xa6, 0x77, 0x85, 0x77, 0x00, 0x73, 0x90, 0x77, 0x0c, 0x60, 0x1f, 0x26,
+    0x08, 0x08, 0x19, 0x1d, 0x25, 0x38, 0x37, 0x24, 0x25, 0x3f, 0x82, 0x38, 0x05, 0x3f, 0x25, 0x24,
+    0x37, 0x3f, 0x53, 0x88, 0x77, 0x01, 0x47, 0x71, 0x82, 0x77, 0x01, 0x53, 0x6a, 0x84, 0x77, 0x02,
+    0x3c, 0x05, 0x08, 0x82, 0x07, 0x0f, 0x0f, 0x07, 0x07, 0x0f, 0x0d, 0x0d, 0x07, 0x01, 0x01, 0x00,
+    0x04, 0x08, 0x04, 0x04, 0x08, 0x12, 0xa6, 0x77, 0x97, 0x77, 0x15, 0x60, 0x1f, 0x26, 0x08, 0x08,
+    0x09, 0x08, 0x14, 0x19, 0x14, 0x14, 0x1d, 0x38, 0x25, 0x25, 0x37, 0x37, 0x25, 0x24, 0x37, 0x36,
+    0x53, 0x88, 0x77, 0x00, 0x59, 0x84, 0x77, 0x00, 0x53, 0x84, 0x77, 0x15, 0x12, 0x08, 0x05, 0x07,
+    0x07, 0x0f, 0x07, 0x05, 0x08, 0x07, 0x07, 0x0b, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x08,
+    0x08, 0x16, 0xa6, 0x77, 0x97, 0x77, 0x0e, 0x56, 0x26, 0x1f, 0x08, 0x08, 0x05, 0x08, 0x07, 0x05,
+    0x05, 0x08, 0x08, 0x19, 0x19, 0x14, 0x84, 0x1d, 0x01, 0x37, 0x53, 0x87, 0x77, 0x01, 0x5c, 0x68,
+    0x84, 0x77, 0x01, 0x67, 0x59, 0x82, 0x77, 0x02, 0x43, 0x05, 0x08, 0x83, 0x07, 0x09, 0x05, 0x05,
+    0x01, 0x0f, 0x07, 0x0d, 0x07, 0x01, 0x04, 0x01, 0x82, 0x00, 0x03, 0x08, 0x08, 0x0a, 0x73, 0xa5,
+    0x77, 0x97, 0x77, 0x15, 0x5c, 0x29, 0x1f, 0x08, 0x08, 0x06, 0x0a, 0x05, 0x0a, 0x07, 0x04, 0x08,
+    0x04, 0x07, 0x05, 0x08, 0x07, 0x14, 0x1d, 0x19, 0x28, 0x40, 0x87, 0x77, 0x00, 0x4d, 0x86, 0x77,
+    0x05, 0x59, 0x76, 0x77, 0x73, 0x13, 0x07, 0x82, 0x05, 0x11, 0x07, 0x07, 0x04, 0x08, 0x04, 0x07,
+    0x05, 0x0d, 0x01, 0x01, 0x04, 0x04, 0x08, 0x04, 0x04, 0x08, 0x08, 0x12, 0xa6, 0x77, 0x97, 0x77,
+    0x0e, 0x56, 0x26, 0x1f, 0x08, 0x08, 0x0a, 0x0a, 0x07, 0x07, 0x0a, 0x07, 0x04, 0x05, 0x08, 0x07,
+    0x82, 0x05, 0x03, 0x08, 0x08, 0x14, 0x21, 0x87, 0x77, 0x00, 0x4d, 0x89, 0x77, 0x05, 0x2c, 0x0d,
+    0x07, 0x05, 0x04, 0x07, 0x82, 0x05, 0x08, 0x04, 0x07, 0x04, 0x07, 0x07, 0x04, 0x08, 0x04, 0x04,
+    0x83, 0x08, 0x01, 0x06, 0x18, 0xa6, 0x77, 0x97, 0x77, 0x0c, 0x60, 0x1f, 0x23, 0x09, 0x04, 0x07,
+    0x05, 0x05, 0x0d, 0x07, 0x05, 0x08, 0x07, 0x82, 0x05, 0x06, 0x07, 0x05, 0x05, 0x01, 0x0f, 0x10,
+    0x6b, 0x85, 0x77, 0x03, 0x5a, 0x76, 0x77, 0x73, 0x86, 0x77, 0x0f, 0x5d, 0x09, 0x07, 0x05, 0x05,
+    0x01, 0x04, 0x08, 0x04, 0x04, 0x08, 0x08, 0x04, 0x08, 0x04, 0x04, 0x84, 0x08, 0x03, 0x06, 0x08,
+    0x1e, 0x1e, 0xa6, 0x77, 0x97, 0x77, 0x16, 0x60, 0x1f, 0x26, 0x08, 0x08, 0x09, 0x05, 0x07, 0x07,
+    0x04, 0x01, 0x08, 0x07, 0x05, 0x05, 0x01, 0x0f, 0x07, 0x05, 0x05, 0x0d, 0x07, 0x55, 0x85, 0x77,
+    0x01, 0x5a, 0x76, 0x88, 0x77, 0x0d, 0x18, 0x06, 0x01, 0x04, 0x08, 0x04, 0x04, 0x08, 0x08, 0x04,
+    0x04, 0x08, 0x04, 0x04, 0x85, 0x08, 0x04, 0x06, 0x23, 0x44, 0x6d, 0x23, 0xa6, 0x77, 0x97, 0x77,
+    0x16, 0x60, 0x1f, 0x26, 0x08, 0x08, 0x09, 0x05, 0x05, 0x07, 0x07, 0x01, 0x08, 0x0d, 0x07, 0x05,
+    0x04, 0x07, 0x13, 0x08, 0x05, 0x07, 0x07, 0x29, 0x84, 0x77, 0x01, 0x67, 0x71, 0x88, 0x77, 0x15,
+    0x23, 0x09, 0x04, 0x05, 0x08, 0x01, 0x04, 0x08, 0x04, 0x04, 0x08, 0x01, 0x01, 0x00, 0x04, 0x08,
+    0x08, 0x06, 0x08, 0x08, 0x23, 0x57, 0x82, 0x6d, 0x00, 0x23, 0xa6, 0x77, 0x97, 0x77, 0x05, 0x56,
+    0x26, 0x1f, 0x08, 0x08, 0x07, 0x82, 0x05, 0x0e, 0x04, 0x04, 0x07, 0x07, 0x04, 0x05, 0x08, 0x07,
+    0x13, 0x0e, 0x05, 0x07, 0x0f, 0x0d, 0x6b, 0x83, 0x77, 0x00, 0x69, 0x88, 0x77, 0x0c, 0x2c, 0x04,
+    0x08, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x01, 0x01, 0x00, 0x04, 0x82, 0x08, 0x04, 0x06, 0x08,
+    0x08, 0x29, 0x48, 0x84, 0x6d, 0x00, 0x23, 0xa6, 0x77, 0x97, 0x77, 0x17, 0x5c, 0x33, 0x1b, 0x08,
+    0x08, 0x07, 0x05, 0x05, 0x0d, 0x0f, 0x08, 0x07, 0x0f, 0x07, 0x05, 0x05, 0x07, 0x07, 0x13, 0x08,
+    0x07, 0x13, 0x13, 0x2c, 0x8c, 0x77, 0x07, 0x23, 0x05, 0x07, 0x04, 0x08, 0x04, 0x04, 0x08, 0x82,
+    0x01, 0x01, 0x00, 0x04, 0x83, 0x08, 0x02, 0x0a, 0x2b, 0x5f, 0x86, 0x6d, 0x00, 0x23, 0xa6, 0x77,
+    0x97, 0x77, 0x19, 0x54, 0x33, 0x1b, 0x08, 0x08, 0x06, 0x0a, 0x07, 0x0f, 0x0d, 0x0d, 0x05, 0x0d,
+    0x07, 0x05, 0x04, 0x07, 0x07, 0x13, 0x0d, 0x07, 0x0d, 0x13, 0x13, 0x48, 0x6c, 0x89, 0x77, 0x02,
+    0x1b, 0x08, 0x07, 0x82, 0x05, 0x05, 0x04, 0x04, 0x01, 0x01, 0x00, 0x04, 0x83, 0x08, 0x02, 0x07,
+    0x2c, 0x58, 0x88, 0x6d, 0x00, 0x23, 0xa6, 0x77, 0x97, 0x77, 0x02, 0x48, 0x33, 0x1b, 0x82, 0x08,
+    0x14, 0x05, 0x07, 0x0f, 0x0d, 0x0d, 0x05, 0x13, 0x0e, 0x05, 0x05, 0x07, 0x07, 0x13, 0x17, 0x07,
+    0x13, 0x0d, 0x17, 0x17, 0x48, 0x6c, 0x86, 0x77, 0x03, 0x44, 0x13, 0x07, 0x07, 0x82, 0x05, 0x03,
+    0x04, 0x04, 0x01, 0x01, 0x84, 0x08, 0x02, 0x0a, 0x32, 0x63, 0x8a, 0x6d, 0x00, 0x23, 0xa6, 0x77,
+    0x97, 0x77, 0x23, 0x43, 0x33, 0x1b, 0x08, 0x08, 0x04, 0x01, 0x05, 0x13, 0x13, 0x0d, 0x07, 0x0d,
+    0x13, 0x05, 0x08, 0x07, 0x05, 0x0d, 0x17, 0x0d, 0x07, 0x0d, 0x17, 0x17, 0x0d, 0x17, 0x47, 0x6c,
+    0x77, 0x6b, 0x5d, 0x44, 0x17, 0x0d, 0x07, 0x82, 0x05, 0x0b, 0x04, 0x04, 0x01, 0x01, 0x08, 0x08,
+    0x06, 0x08, 0x08, 0x12, 0x43, 0x62, 0x8b, 0x6d, 0x01, 0x48, 0x3e, 0xa6, 0x77, 0x97, 0x77, 0x02,
+    0x47, 0x3d, 0x1b, 0x82, 0x08, 0x08, 0x01, 0x01, 0x0f, 0x0d, 0x13, 0x07, 0x13, 0x13, 0x07, 0x82,
+    0x05, 0x01, 0x07, 0x13, 0x82, 0x0d, 0x12, 0x1b, 0x17, 0x06, 0x05, 0x07, 0x04, 0x0f, 0x0d, 0x1b,
+    0x17, 0x13, 0x13, 0x07, 0x07, 0x05, 0x01, 0x01, 0x00, 0x04, 0x83, 0x08, 0x04, 0x15, 0x47, 0x6c,
+    0x77, 0x6b, 0x8a, 0x6d, 0x01, 0x32, 0x29, 0xa7, 0x77, 0x97, 0x77, 0x02, 0x47, 0x3d, 0x1b, 0x83,
+    0x08, 0x1d, 0x03, 0x03, 0x0a, 0x13, 0x13, 0x0d, 0x17, 0x0d, 0x05, 0x08, 0x07, 0x05, 0x0d, 0x17,
+    0x0d, 0x0d, 0x17, 0x1b, 0x08, 0x01, 0x08, 0x08, 0x04, 0x07, 0x07, 0x17, 0x0d, 0x07, 0x07, 0x05,
+    0x82, 0x08, 0x08, 0x09, 0x08, 0x08, 0x06, 0x18, 0x47, 0x6c, 0x77, 0x6b, 0x8a, 0x6d, 0x02, 0x23,
+    0x23, 0x57, 0xa8, 0x77, 0x97, 0x77, 0x02, 0x47, 0x32, 0x1b, 0x82, 0x08, 0x1d, 0x01, 0x00, 0x00,
+    0x08, 0x0f, 0x0d, 0x13, 0x17, 0x0d, 0x07, 0x07, 0x05, 0x07, 0x0f, 0x17, 0x0d, 0x0d, 0x13, 0x1b,
+    0x0a, 0x08, 0x04, 0x01, 0x05, 0x05, 0x07, 0x07, 0x04, 0x01, 0x01, 0x85, 0x08, 0x01, 0x1e, 0x4e,
+    0x8d, 0x6d, 0x02, 0x23, 0x29, 0x48, 0xaa, 0x77, 0x97, 0x77, 0x02, 0x43, 0x30, 0x1b, 0x83, 0x08,
+    0x0c, 0x03, 0x00, 0x04, 0x01, 0x02, 0x09, 0x13, 0x1b, 0x07, 0x0f, 0x07, 0x07, 0x0f, 0x83, 0x0d,
+    0x0c, 0x1b, 0x0f, 0x01, 0x01, 0x00, 0x04, 0x01, 0x08, 0x0d, 0x04, 0x08, 0x04, 0x04, 0x82, 0x08,
+    0x02, 0x1b, 0x4e, 0x6c, 0x8b, 0x6d, 0x04, 0x58, 0x29, 0x1f, 0x60, 0x73, 0xab, 0x77, 0x97, 0x77,
+    0x1f, 0x43, 0x3e, 0x1b, 0x08, 0x08, 0x05, 0x00, 0x00, 0x08, 0x0f, 0x02, 0x09, 0x05, 0x08, 0x01,
+    0x04, 0x07, 0x0f, 0x07, 0x07, 0x0f, 0x13, 0x13, 0x0d, 0x17, 0x13, 0x01, 0x01, 0x00, 0x04, 0x08,
+    0x01, 0x85, 0x08, 0x02, 0x23, 0x57, 0x77, 0x8b, 0x6d, 0x03, 0x56, 0x23, 0x29, 0x6b, 0xae, 0x77,
+    0x97, 0x77, 0x1d, 0x43, 0x30, 0x1b, 0x08, 0x08, 0x0a, 0x02, 0x03, 0x03, 0x04, 0x08, 0x04, 0x07,
+    0x05, 0x0d, 0x04, 0x08, 0x04, 0x07, 0x05, 0x0d, 0x13, 0x13, 0x0d, 0x17, 0x13, 0x04, 0x08, 0x04,
+    0x04, 0x84, 0x08, 0x04, 0x09, 0x29, 0x58, 0x77, 0x77, 0x8a, 0x6d, 0x03, 0x4e, 0x1b, 0x3c, 0x6b,
+    0xb0, 0x77, 0x97, 0x77, 0x1b, 0x43, 0x3e, 0x17, 0x06, 0x05, 0x09, 0x08, 0x02, 0x03, 0x02, 0x03,
+    0x02, 0x02, 0x03, 0x07, 0x0f, 0x07, 0x05, 0x02, 0x03, 0x02, 0x09, 0x07, 0x05, 0x13, 0x0f, 0x01,
+    0x01, 0x85, 0x08, 0x01, 0x29, 0x48, 0x8c, 0x6d, 0x03, 0x48, 0x1b, 0x3d, 0x62, 0xb2, 0x77, 0x97,
+    0x77, 0x09, 0x43, 0x44, 0x1b, 0x06, 0x08, 0x08, 0x05, 0x00, 0x02, 0x03, 0x82, 0x02, 0x00, 0x03,
+    0x82, 0x02, 0x0a, 0x05, 0x08, 0x01, 0x04, 0x03, 0x03, 0x04, 0x01, 0x01, 0x00, 0x04, 0x82, 0x08,
+    0x07, 0x0c, 0x2f, 0x58, 0x77, 0x47, 0x6c, 0x77, 0x6b, 0x87, 0x6d, 0x03, 0x48, 0x1b, 0x3d, 0x62,
+    0xb4, 0x77, 0x97, 0x77, 0x0b, 0x3c, 0x44, 0x18, 0x06, 0x08, 0x05, 0x08, 0x01, 0x04, 0x03, 0x02,
+    0x03, 0x82, 0x02, 0x16, 0x05, 0x08, 0x08, 0x05, 0x00, 0x05, 0x08, 0x01, 0x04, 0x03, 0x02, 0x08,
+    0x08, 0x06, 0x0a, 0x32, 0x63, 0x6d, 0x6d, 0x58, 0x23, 0x57, 0x77, 0x86, 0x6d, 0x02, 0x43, 0x23,
+    0x54, 0xb7, 0x77, 0x97, 0x77, 0x0b, 0x3c, 0x48, 0x18, 0x06, 0x08, 0x05, 0x03, 0x03, 0x04, 0x01,
+    0x02, 0x03, 0x82, 0x02, 0x00, 0x05, 0x82, 0x08, 0x0a, 0x05, 0x00, 0x05, 0x08, 0x08, 0x06, 0x08,
+    0x08, 0x12, 0x43, 0x63, 0x82, 0x6d, 0x02, 0x2f, 0x1e, 0x1e, 0x86, 0x6d, 0x02, 0x32, 0x29, 0x55,
+    0xb9, 0x77, 0x97, 0x77, 0x05, 0x31, 0x4a, 0x18, 0x06, 0x08, 0x05, 0x82, 0x03, 0x12, 0x00, 0x00,
+    0x01, 0x08, 0x08, 0x04, 0x08, 0x04, 0x04, 0x03, 0x03, 0x04, 0x08, 0x08, 0x06, 0x08, 0x16, 0x43,
+    0x62, 0x83, 0x6d, 0x00, 0x4e, 0x82, 0x1e, 0x00, 0x4e, 0x83, 0x6d, 0x05, 0x23, 0x23, 0x57, 0x77,
+    0x6d, 0x6d, 0xb8, 0x77, 0x97, 0x77, 0x13, 0x2f, 0x4a, 0x18, 0x08, 0x08, 0x05, 0x00, 0x02, 0x04,
+    0x01, 0x00, 0x00, 0x03, 0x03, 0x04, 0x01, 0x02, 0x06, 0x03, 0x06, 0x82, 0x08, 0x01, 0x18, 0x48,
+    0x86, 0x6d, 0x09, 0x47, 0x1e, 0x1e, 0x23, 0x77, 0x77, 0x5d, 0x29, 0x1f, 0x60, 0xbd, 0x77, 0x97,
+    0x77, 0x05, 0x2f, 0x58, 0x18, 0x06, 0x08, 0x05, 0x83, 0x03, 0x06, 0x04, 0x01, 0x02, 0x06, 0x03,
+    0x03, 0x04, 0x82, 0x08, 0x02, 0x06, 0x18, 0x47, 0x88, 0x6d, 0x08, 0x58, 0x1e, 0x4e, 0x6d, 0x58,
+    0x29, 0x2b, 0x5f, 0x6d, 0x9a, 0x77, 0x0a, 0x60, 0x29, 0x23, 0x29, 0x2f, 0x29, 0x1f, 0x29, 0x48,
+    0x6d, 0x6d, 0x98, 0x77, 0x97, 0x77, 0x15, 0x3c, 0x4a, 0x18, 0x08, 0x06, 0x09, 0x08, 0x02, 0x00,
+    0x00, 0x01, 0x08, 0x08, 0x04, 0x08, 0x08, 0x06, 0x08, 0x08, 0x23, 0x4e, 0x6c, 0x8b, 0x6d, 0x03,
+    0x4e, 0x23, 0x2c, 0x6b, 0x9c, 0x77, 0x02, 0x43, 0x2f, 0x58, 0x85, 0x77, 0x03, 0x58, 0x23, 0x2c,
+    0x6b, 0x97, 0x77, 0x97, 0x77, 0x0a, 0x2b, 0x4a, 0x18, 0x08, 0x06, 0x04, 0x08, 0x04, 0x04, 0x03,
+    0x01, 0x85, 0x08, 0x01, 0x29, 0x56, 0x8c, 0x6d, 0x03, 0x56, 0x2f, 0x29, 0x54, 0x9b, 0x77, 0x03,
+    0x60, 0x55, 0x5c, 0x29, 0x89, 0x77, 0x04, 0x51, 0x23, 0x57, 0x77, 0x6d, 0x94, 0x77, 0x97, 0x77,
+    0x10, 0x29, 0x48, 0x16, 0x06, 0x08, 0x08, 0x05, 0x00, 0x02, 0x04, 0x08, 0x08, 0x06, 0x08, 0x08,
+    0x23, 0x4e, 0x8c, 0x6d, 0x05, 0x48, 0x26, 0x43, 0x44, 0x22, 0x6b, 0x99, 0x77, 0x05, 0x60, 0x1f,
+    0x26, 0x47, 0x1b, 0x43, 0x8b, 0x77, 0x01, 0x29, 0x48, 0x95, 0x77, 0x97, 0x77, 0x09, 0x29, 0x48,
+    0x16, 0x08, 0x08, 0x0a, 0x02, 0x06, 0x03, 0x06, 0x82, 0x08, 0x02, 0x29, 0x5d, 0x5d, 0x8b, 0x6d,
+    0x02, 0x48, 0x2b, 0x33, 0x82, 0x47, 0x00, 0x1e, 0x98, 0x77, 0x0c, 0x60, 0x29, 0x2f, 0x63, 0x6d,
+    0x47, 0x47, 0x48, 0x26, 0x43, 0x3c, 0x48, 0x73, 0x87, 0x77, 0x01, 0x2b, 0x6b, 0x94, 0x77, 0x97,
+    0x77, 0x02, 0x29, 0x48, 0x16, 0x82, 0x08, 0x08, 0x06, 0x08, 0x08, 0x09, 0x09, 0x2f, 0x58, 0x77,
+    0x77, 0x8a, 0x6d, 0x08, 0x3d, 0x26, 0x43, 0x44, 0x47, 0x47, 0x48, 0x43, 0x23, 0x97, 0x77, 0x0f,
+    0x2f, 0x29, 0x5d, 0x5d, 0x47, 0x29, 0x77, 0x77, 0x29, 0x48, 0x26, 0x18, 0x1e, 0x1e, 0x47, 0x6c,
+    0x85, 0x77, 0x01, 0x58, 0x43, 0x94, 0x77, 0x97, 0x77, 0x0d, 0x23, 0x50, 0x12, 0x08, 0x05, 0x08,
+    0x08, 0x06, 0x0a, 0x32, 0x62, 0x6c, 0x61, 0x6c, 0x89, 0x6d, 0x0b, 0x43, 0x23, 0x54, 0x47, 0x47,
+    0x48, 0x43, 0x47, 0x47, 0x2f, 0x47, 0x6c, 0x93, 0x77, 0x13, 0x60, 0x2f, 0x29, 0x54, 0x63, 0x3e,
+    0x32, 0x77, 0x77, 0x23, 0x23, 0x61, 0x5d, 0x43, 0x44, 0x22, 0x1e, 0x1e, 0x23, 0x73, 0x84, 0x77,
+    0x01, 0x60, 0x3c, 0x94, 0x77, 0x97, 0x77, 0x08, 0x1b, 0x50, 0x12, 0x08, 0x08, 0x06, 0x12, 0x2c,
+    0x62, 0x8c, 0x6d, 0x06, 0x32, 0x29, 0x55, 0x47, 0x47, 0x48, 0x43, 0x82, 0x47, 0x05, 0x48, 0x23,
+    0x57, 0x77, 0x6d, 0x6d, 0x90, 0x77, 0x1a, 0x3c, 0x1b, 0x50, 0x63, 0x3e, 0x43, 0x77, 0x57, 0x23,
+    0x3c, 0x6b, 0x5c, 0x47, 0x5c, 0x47, 0x43, 0x44, 0x2c, 0x18, 0x1e, 0x1e, 0x4e, 0x6d, 0x6d, 0x77,
+    0x60, 0x1e, 0x95, 0x77, 0x97, 0x77, 0x06, 0x23, 0x57, 0x12, 0x08, 0x16, 0x43, 0x63, 0x8c, 0x6d,
+    0x05, 0x29, 0x2f, 0x47, 0x47, 0x48, 0x43, 0x83, 0x47, 0x03, 0x48, 0x43, 0x47, 0x1e, 0x92, 0x77,
+    0x1c, 0x43, 0x23, 0x50, 0x6d, 0x6d, 0x2f, 0x6b, 0x47, 0x47, 0x2f, 0x56, 0x43, 0x62, 0x61, 0x3c,
+    0x29, 0x48, 0x77, 0x31, 0x43, 0x44, 0x22, 0x12, 0x0e, 0x1e, 0x23, 0x13, 0x23, 0x57, 0x95, 0x77,
+    0x97, 0x77, 0x06, 0x23, 0x57, 0x1e, 0x4e, 0x6d, 0x6d, 0x77, 0x89, 0x6d, 0x08, 0x58, 0x29, 0x2b,
+    0x16, 0x43, 0x47, 0x47, 0x48, 0x43, 0x84, 0x47, 0x02, 0x48, 0x43, 0x1b, 0x90, 0x77, 0x1d, 0x43,
+    0x23, 0x44, 0x6d, 0x47, 0x5c, 0x63, 0x29, 0x43, 0x43, 0x44, 0x47, 0x6b, 0x5d, 0x23, 0x23, 0x61,
+    0x77, 0x2f, 0x16, 0x60, 0x73, 0x3c, 0x48, 0x2c, 0x18, 0x4e, 0x6c, 0x6d, 0x6d, 0x96, 0x77, 0x97,
+    0x77, 0x03, 0x23, 0x50, 0x4a, 0x4f, 0x8a, 0x6d, 0x09, 0x4e, 0x23, 0x31, 0x6b, 0x5d, 0x23, 0x47,
+    0x47, 0x48, 0x43, 0x85, 0x47, 0x02, 0x48, 0x43, 0x2b, 0x8e, 0x77, 0x1d, 0x54, 0x1b, 0x3d, 0x62,
+    0x47, 0x47, 0x73, 0x5f, 0x47, 0x6c, 0x4e, 0x2f, 0x73, 0x5f, 0x18, 0x23, 0x77, 0x77, 0x23, 0x23,
+    0x61, 0x77, 0x31, 0x29, 0x48, 0x5d, 0x43, 0x62, 0x1b, 0x4e, 0x98, 0x77, 0x97, 0x77, 0x02, 0x29,
+    0x48, 0x3e, 0x89, 0x6d, 0x08, 0x58, 0x23, 0x2c, 0x6b, 0x77, 0x77, 0x2f, 0x43, 0x44, 0x82, 0x47,
+    0x01, 0x48, 0x43, 0x83, 0x47, 0x02, 0x5c, 0x5c, 0x47, 0x8c, 0x77, 0x21, 0x43, 0x1b, 0x3d, 0x62,
+    0x5d, 0x54, 0x61, 0x3c, 0x43, 0x44, 0x47, 0x47, 0x58, 0x5d, 0x29, 0x2f, 0x63, 0x60, 0x29, 0x23,
+    0x60, 0x5c, 0x47, 0x43, 0x54, 0x55, 0x43, 0x44, 0x47, 0x47, 0x48, 0x26, 0x43, 0x73, 0x96, 0x77,
+    0x97, 0x77, 0x02, 0x31, 0x4a, 0x3e, 0x87, 0x6d, 0x03, 0x47, 0x23, 0x2c, 0x6b, 0x83, 0x77, 0x04,
+    0x12, 0x47, 0x47, 0x48, 0x43, 0x84, 0x47, 0x05, 0x60, 0x73, 0x6b, 0x5d, 0x23, 0x6b, 0x89, 0x77,
+    0x08, 0x54, 0x1b, 0x47, 0x6c, 0x4e, 0x47, 0x47, 0x48, 0x43, 0x82, 0x47, 0x17, 0x73, 0x5f, 0x29,
+    0x48, 0x5d, 0x43, 0x29, 0x2f, 0x63, 0x47, 0x47, 0x48, 0x43, 0x47, 0x47, 0x60, 0x3c, 0x2b, 0x5f,
+    0x6d, 0x2f, 0x58, 0x77, 0x1b, 0x96, 0x77, 0x97, 0x77, 0x02, 0x54, 0x33, 0x44, 0x85, 0x6d, 0x03,
+    0x43, 0x23, 0x44, 0x6d, 0x84, 0x77, 0x05, 0x58, 0x23, 0x47, 0x47, 0x48, 0x43, 0x82, 0x47, 0x0a,
+    0x73, 0x6b, 0x5d, 0x6b, 0x77, 0x77, 0x58, 0x29, 0x2b, 0x60, 0x73, 0x84, 0x77, 0x26, 0x49, 0x23,
+    0x44, 0x6d, 0x61, 0x5d, 0x4f, 0x31, 0x4a, 0x3e, 0x2f, 0x58, 0x77, 0x60, 0x16, 0x26, 0x77, 0x77,
+    0x43, 0x6d, 0x6d, 0x23, 0x47, 0x47, 0x2f, 0x3c, 0x6b, 0x5c, 0x23, 0x23, 0x61, 0x77, 0x31, 0x2f,
+    0x58, 0x77, 0x60, 0x43, 0x44, 0x95, 0x77, 0x97, 0x77, 0x02, 0x60, 0x1f, 0x3e, 0x83, 0x6d, 0x05,
+    0x32, 0x23, 0x57, 0x77, 0x6d, 0x6d, 0x84, 0x77, 0x0e, 0x2b, 0x43, 0x44, 0x47, 0x47, 0x48, 0x55,
+    0x5c, 0x6b, 0x5d, 0x6b, 0x6c, 0x62, 0x6c, 0x6c, 0x82, 0x6d, 0x2d, 0x23, 0x23, 0x47, 0x6c, 0x77,
+    0x55, 0x23, 0x44, 0x6d, 0x47, 0x32, 0x44, 0x43, 0x62, 0x61, 0x29, 0x48, 0x77, 0x55, 0x18, 0x43,
+    0x62, 0x61, 0x29, 0x29, 0x48, 0x6d, 0x6d, 0x77, 0x4f, 0x29, 0x77, 0x60, 0x1e, 0x29, 0x77, 0x77,
+    0x29, 0x29, 0x48, 0x6d, 0x6d, 0x57, 0x26, 0x18, 0x48, 0x95, 0x77, 0x98, 0x77, 0x06, 0x23, 0x47,
+    0x6c, 0x77, 0x32, 0x29, 0x55, 0x89, 0x77, 0x0a, 0x1e, 0x4e, 0x47, 0x47, 0x48, 0x62, 0x6c, 0x61,
+    0x6c, 0x62, 0x77, 0x88, 0x6d, 0x17, 0x48, 0x1b, 0x1b, 0x3d, 0x62, 0x5d, 0x43, 0x62, 0x47, 0x47,
+    0x43, 0x44, 0x47, 0x6b, 0x43, 0x23, 0x33, 0x6b, 0x47, 0x3c, 0x29, 0x58, 0x77, 0x77, 0x84, 0x6d,
+    0x0d, 0x23, 0x29, 0x77, 0x60, 0x23, 0x23, 0x61, 0x77, 0x6d, 0x56, 0x2f, 0x18, 0x23, 0x5c, 0x96,
+    0x77, 0x98, 0x77, 0x04, 0x60, 0x1f, 0x29, 0x1f, 0x60, 0x8b, 0x77, 0x07, 0x1b, 0x3d, 0x62, 0x5d,
+    0x6b, 0x5d, 0x6b, 0x6c, 0x8b, 0x6d, 0x28, 0x48, 0x3e, 0x6d, 0x4f, 0x3e, 0x32, 0x55, 0x77, 0x47,
+    0x47, 0x73, 0x77, 0x77, 0x23, 0x61, 0x5d, 0x29, 0x43, 0x29, 0x48, 0x6d, 0x6d, 0x47, 0x47, 0x48,
+    0x62, 0x5d, 0x44, 0x44, 0x63, 0x3e, 0x29, 0x1f, 0x60, 0x77, 0x77, 0x58, 0x29, 0x17, 0x29, 0x5d,
+    0x98, 0x77, 0x9a, 0x77, 0x00, 0x5d, 0x8c, 0x77, 0x08, 0x4e, 0x2f, 0x58, 0x77, 0x60, 0x6b, 0x5d,
+    0x6b, 0x6c, 0x89, 0x6d, 0x1f, 0x48, 0x3e, 0x6d, 0x4f, 0x47, 0x29, 0x77, 0x77, 0x23, 0x47, 0x73,
+    0x77, 0x77, 0x55, 0x43, 0x60, 0x5c, 0x47, 0x6c, 0x5d, 0x5d, 0x6d, 0x6d, 0x56, 0x47, 0x6c, 0x5d,
+    0x29, 0x43, 0x77, 0x77, 0x43, 0x83, 0x6d, 0x04, 0x4e, 0x26, 0x18, 0x29, 0x5d, 0x9a, 0x77, 0x92,
+    0x77, 0x00, 0x73, 0x94, 0x77, 0x05, 0x60, 0x29, 0x6b, 0x5d, 0x6b, 0x6c, 0x8a, 0x6d, 0x0f, 0x48,
+    0x3e, 0x61, 0x5d, 0x29, 0x57, 0x6d, 0x6b, 0x1b, 0x26, 0x44, 0x73, 0x77, 0x55, 0x43, 0x60, 0x83,
+    0x77, 0x01, 0x3c, 0x4a, 0x83, 0x6d, 0x11, 0x32, 0x16, 0x43, 0x77, 0x60, 0x1f, 0x29, 0x57, 0x6d,
+    0x6b, 0x58, 0x29, 0x17, 0x23, 0x57, 0x77, 0x6d, 0x6d, 0x99, 0x77, 0xa9, 0x77, 0x06, 0x23, 0x57,
+    0x77, 0x6d, 0x6d, 0x77, 0x77, 0x86, 0x6d, 0x2b, 0x47, 0x43, 0x62, 0x61, 0x29, 0x60, 0x73, 0x3c,
+    0x31, 0x43, 0x43, 0x77, 0x73, 0x23, 0x2c, 0x54, 0x43, 0x62, 0x47, 0x60, 0x73, 0x77, 0x55, 0x2f,
+    0x47, 0x6d, 0x6d, 0x58, 0x47, 0x6c, 0x4e, 0x2f, 0x29, 0x5d, 0x6d, 0x6d, 0x58, 0x2f, 0x1e, 0x23,
+    0x57, 0x77, 0x6d, 0x6d, 0x9b, 0x77, 0x8d, 0x77, 0x00, 0x73, 0x9b, 0x77, 0x04, 0x23, 0x2c, 0x6b,
+    0x77, 0x77, 0x85, 0x6d, 0x21, 0x48, 0x43, 0x62, 0x61, 0x43, 0x62, 0x61, 0x43, 0x3c, 0x1b, 0x6b,
+    0x77, 0x77, 0x23, 0x2c, 0x2f, 0x58, 0x77, 0x47, 0x54, 0x77, 0x57, 0x23, 0x3c, 0x62, 0x6c, 0x61,
+    0x2b, 0x5f, 0x6d, 0x2f, 0x3c, 0x29, 0x58, 0x82, 0x6d, 0x82, 0x23, 0x03, 0x57, 0x77, 0x6d, 0x6d,
+    0x9d, 0x77, 0x91, 0x77, 0x00, 0x73, 0x98, 0x77, 0x03, 0x60, 0x29, 0x32, 0x63, 0x83, 0x6d, 0x1f,
+    0x4e, 0x43, 0x62, 0x61, 0x43, 0x54, 0x43, 0x5c, 0x47, 0x43, 0x73, 0x77, 0x55, 0x3c, 0x29, 0x3c,
+    0x6b, 0x73, 0x23, 0x43, 0x44, 0x47, 0x55, 0x43, 0x60, 0x77, 0x73, 0x47, 0x47, 0x6c, 0x4e, 0x47,
+    0x83, 0x6d, 0x04, 0x5d, 0x29, 0x17, 0x29, 0x55, 0xa2, 0x77, 0x8b, 0x77, 0x00, 0x73, 0xa0, 0x77,
+    0x2f, 0x4e, 0x23, 0x2c, 0x6b, 0x58, 0x43, 0x62, 0x61, 0x43, 0x3c, 0x5c, 0x77, 0x47, 0x47, 0x48,
+    0x43, 0x6b, 0x5d, 0x23, 0x47, 0x77, 0x60, 0x1f, 0x43, 0x44, 0x47, 0x6b, 0x29, 0x1f, 0x44, 0x73,
+    0x47, 0x47, 0x3c, 0x6b, 0x73, 0x2f, 0x58, 0x77, 0x60, 0x6b, 0x2c, 0x18, 0x23, 0x57, 0x77, 0x6d,
+    0x6d, 0xa1, 0x77, 0xaf, 0x77, 0x2b, 0x1b, 0x23, 0x44, 0x6d, 0x47, 0x57, 0x6d, 0x77, 0x2f, 0x43,
+    0x47, 0x47, 0x73, 0x5c, 0x1e, 0x60, 0x73, 0x47, 0x29, 0x29, 0x48, 0x77, 0x55, 0x29, 0x5d, 0x77,
+    0x77, 0x1b, 0x23, 0x73, 0x77, 0x55, 0x1e, 0x32, 0x63, 0x6d, 0x6d, 0x32, 0x1b, 0x23, 0x57, 0x77,
+    0x6d, 0x6d, 0xa3, 0x77, 0x82, 0x77, 0x00, 0x73, 0xa9, 0x77, 0x28, 0x4e, 0x23, 0x4e, 0x6c, 0x47,
+    0x47, 0x73, 0x43, 0x44, 0x47, 0x31, 0x6b, 0x77, 0x54, 0x23, 0x57, 0x54, 0x43, 0x43, 0x30, 0x73,
+    0x77, 0x55, 0x29, 0x43, 0x43, 0x60, 0x5c, 0x2b, 0x5f, 0x6d, 0x2f, 0x3c, 0x32, 0x63, 0x6d, 0x6d,
+    0x32, 0x1b, 0x23, 0x54, 0xa3, 0x77, 0x00, 0x73, 0x83, 0x77, 0x89, 0x77, 0x00, 0x73, 0xa0, 0x77,
+    0x21, 0x47, 0x29, 0x48, 0x6c, 0x43, 0x44, 0x47, 0x47, 0x48, 0x29, 0x48, 0x6d, 0x6d, 0x31, 0x29,
+    0x47, 0x47, 0x48, 0x47, 0x47, 0x73, 0x43, 0x43, 0x44, 0x47, 0x47, 0x58, 0x4e, 0x2f, 0x60, 0x5c,
+    0x2b, 0x2f, 0x47, 0x82, 0x6d, 0x04, 0x3e, 0x1b, 0x1b, 0x3d, 0x62, 0xa9, 0x77, 0xa9, 0x77, 0x29,
+    0x54, 0x1b, 0x47, 0x62, 0x43, 0x44, 0x47, 0x6b, 0x43, 0x3c, 0x6b, 0x73, 0x5c, 0x29, 0x1f, 0x54,
+    0x77, 0x77, 0x43, 0x30, 0x5c, 0x47, 0x43, 0x31, 0x29, 0x77, 0x77, 0x43, 0x2f, 0x58, 0x77, 0x60,
+    0x43, 0x43, 0x62, 0x6d, 0x6d, 0x47, 0x29, 0x1e, 0x32, 0x73, 0x9f, 0x77, 0x00, 0x73, 0x8a, 0x77,
+    0xa7, 0x77, 0x12, 0x56, 0x1b, 0x3d, 0x62, 0x47, 0x31, 0x6b, 0x77, 0x55, 0x2f, 0x56, 0x43, 0x60,
+    0x5c, 0x2b, 0x55, 0x77, 0x47, 0x2f, 0x82, 0x47, 0x14, 0x48, 0x43, 0x47, 0x77, 0x77, 0x23, 0x47,
+    0x73, 0x77, 0x77, 0x43, 0x2f, 0x61, 0x5d, 0x6d, 0x56, 0x23, 0x17, 0x3c, 0x6b, 0x73, 0xac, 0x77,
+    0xa5, 0x77, 0x29, 0x5c, 0x29, 0x43, 0x62, 0x47, 0x2f, 0x73, 0x77, 0x2f, 0x43, 0x47, 0x47, 0x5c,
+    0x63, 0x22, 0x55, 0x77, 0x43, 0x44, 0x2c, 0x31, 0x6b, 0x77, 0x31, 0x4a, 0x73, 0x47, 0x47, 0x3c,
+    0x60, 0x73, 0x77, 0x3c, 0x29, 0x58, 0x6d, 0x6d, 0x56, 0x23, 0x1e, 0x32, 0x73, 0xaf, 0x77, 0xa5,
+    0x77, 0x27, 0x1b, 0x77, 0x58, 0x43, 0x73, 0x5f, 0x29, 0x3c, 0x29, 0x6b, 0x77, 0x77, 0x23, 0x54,
+    0x43, 0x5c, 0x47, 0x29, 0x77, 0x77, 0x60, 0x1b, 0x26, 0x54, 0x77, 0x57, 0x43, 0x62, 0x6d, 0x6d,
+    0x47, 0x2f, 0x58, 0x77, 0x77, 0x48, 0x1b, 0x1b, 0x31, 0x6b, 0xb1, 0x77, 0xa5, 0x77, 0x28, 0x18,
+    0x48, 0x6d, 0x29, 0x43, 0x43, 0x60, 0x77, 0x77, 0x43, 0x2f, 0x43, 0x30, 0x73, 0x4e, 0x1b, 0x60,
+    0x5c, 0x2b, 0x55, 0x23, 0x57, 0x77, 0x47, 0x29, 0x60, 0x73, 0x77, 0x3c, 0x2b, 0x5f, 0x6d, 0x77,
+    0x48, 0x1b, 0x18, 0x2f, 0x58, 0x77, 0x77, 0x6d, 0xb0, 0x77, 0xa5, 0x77, 0x16, 0x54, 0x1e, 0x32,
+    0x73, 0x48, 0x3c, 0x6b, 0x73, 0x2f, 0x23, 0x77, 0x77, 0x54, 0x2f, 0x58, 0x5c, 0x47, 0x43, 0x23,
+    0x77, 0x77, 0x31, 0x29, 0x82, 0x77, 0x09, 0x43, 0x2f, 0x58, 0x77, 0x77, 0x48, 0x1b, 0x1e, 0x32,
+    0x73, 0xb5, 0x77, 0xa6, 0x77, 0x20, 0x58, 0x23, 0x1b, 0x4e, 0x5d, 0x29, 0x2b, 0x77, 0x73, 0x23,
+    0x43, 0x43, 0x44, 0x60, 0x3c, 0x47, 0x6c, 0x77, 0x29, 0x2f, 0x29, 0x77, 0x77, 0x47, 0x29, 0x60,
+    0x6d, 0x6d, 0x58, 0x23, 0x17, 0x29, 0x6b, 0xb7, 0x77, 0x95, 0x77, 0x00, 0x6c, 0x91, 0x77, 0x1c,
+    0x3c, 0x18, 0x2f, 0x63, 0x3e, 0x29, 0x3c, 0x6b, 0x73, 0x77, 0x2f, 0x47, 0x6d, 0x47, 0x47, 0x2f,
+    0x3c, 0x73, 0x5f, 0x29, 0x29, 0x48, 0x6d, 0x6d, 0x57, 0x29, 0x18, 0x2f, 0x63, 0xb9, 0x77, 0xa9,
+    0x77, 0x19, 0x4f, 0x1b, 0x23, 0x58, 0x5d, 0x29, 0x54, 0x43, 0x5c, 0x43, 0x44, 0x60, 0x29, 0x5d,
+    0x77, 0x77, 0x1b, 0x29, 0x5d, 0x77, 0x77, 0x4f, 0x29, 0x18, 0x2f, 0x63, 0xbb, 0x77, 0xab, 0x77,
+    0x15, 0x2f, 0x1b, 0x3e, 0x6c, 0x48, 0x3c, 0x73, 0x5f, 0x29, 0x55, 0x5c, 0x43, 0x44, 0x22, 0x58,
+    0x77, 0x77, 0x48, 0x29, 0x18, 0x29, 0x5d, 0xbd, 0x77, 0xac, 0x77, 0x12, 0x54, 0x1e, 0x23, 0x61,
+    0x5d, 0x29, 0x2f, 0x73, 0x77, 0x54, 0x2f, 0x61, 0x5d, 0x6d, 0x57, 0x26, 0x17, 0x29, 0x6b, 0xbf,
+    0x77, 0x83, 0x77, 0x00, 0x73, 0xa9, 0x77, 0x0e, 0x23, 0x1b, 0x3d, 0x62, 0x47, 0x31, 0x29, 0x48,
+    0x6d, 0x6d, 0x57, 0x29, 0x18, 0x2f, 0x63, 0xc1, 0x77, 0xaf, 0x77, 0x0b, 0x47, 0x18, 0x2f, 0x63,
+    0x77, 0x77, 0x6d, 0x56, 0x2f, 0x18, 0x29, 0x5d, 0xc3, 0x77, 0xb0, 0x77, 0x08, 0x60, 0x29, 0x23,
+    0x44, 0x48, 0x3c, 0x17, 0x29, 0x6b, 0xb9, 0x77, 0x00, 0x73, 0x8a, 0x77, 0xb2, 0x77, 0x04, 0x2f,
+    0x1b, 0x17, 0x29, 0x55, 0xc7, 0x77, 0xb4, 0x77, 0x00, 0x4e, 0xc9, 0x77, 0xdf, 0x77, 0x00, 0x73,
+    0x9e, 0x77, 0xff, 0x77, 0xe1, 0x77, 0x00, 0x73, 0x9c, 0x77, 0xa9, 0x77, 0x00, 0x73, 0xd4, 0x77,
+    0xe4, 0x77, 0x00, 0x73, 0x99, 0x77, 0xbc, 0x77, 0x00, 0x73, 0xc1, 0x77, 0xe8, 0x77, 0x00, 0x73,
+    0x95, 0x77, 0x8d, 0x77, 0x00, 0x73, 0xe3, 0x77, 0x00, 0x73, 0x8b, 0x77, 0xed, 0x77, 0x00, 0x73,
+    0x90, 0x77,
+};
+
+// 71 colors, 3922 bytes (raw: 32768)
+static constexpr uint16_t mac_pal_8[] = {
+    0x0433, 0x1125, 0x2186, 0x21a8, 0x2946, 0x3186, 0x3207, 0x35dd, 0x3a4a, 0x3b72, 0x3bb7, 0x3d7c,
+    0x4248, 0x4479, 0x4a89, 0x4a8b, 0x4d3b, 0x52cb, 0x532e, 0x630b, 0x63b1, 0x65fd, 0x6b8e, 0x7432,
+    0x83ce, 0x84f4, 0x8558, 0x8c92, 0x9556, 0x965d, 0x9cf3, 0x9d78, 0xa4d4, 0xa557, 0xad55, 0xadb5,
+    0xadb7, 0xadd9, 0xaebd, 0xb5b6, 0xb5f9, 0xb639, 0xbdf7, 0xbe7a, 0xbebb, 0xbefc, 0xbefe, 0xc5f7,
+    0xc638, 0xc67a, 0xc6ba, 0xc6bb, 0xcebb, 0xcefb, 0xcefd, 0xd679, 0xd6ba, 0xd6fb, 0xdefa, 0xdefb,
+    0xdf3d, 0xdf7e, 0xe73c, 0xe73d, 0xe77d, 0xef3c, 0xef7c, 0xef7d, 0xefbe, 0xf7be, 0xffff,
+};
+static constexpr uint16_t mac_row_8[] = {
+    0, 2, 8, 18, 24, 26, 32, 42, 52, 54, 56, 58, 60, 62, 64, 70,
+    72, 74, 76, 82, 98, 109, 122, 138, 154, 172, 192, 218, 240, 262, 284, 306,
+    332, 354, 380, 407, 433, 456, 483, 509, 535, 557, 583, 609, 635, 663, 692, 721,
+    755, 783, 818, 853, 887, 922, 953, 981, 1011, 1039, 1067, 1095, 1123, 1151, 1181, 1216,
+    1255, 1296, 1340, 1388, 1438, 1490, 1544, 1602, 1664, 1727, 1795, 1866, 1936, 2006, 2075, 2146,
+    2211, 2282, 2356, 2422, 2492, 2563, 2635, 2711, 2784, 2855, 2922, 2984, 3042, 3094, 3142, 3183,
+    3220, 3248, 3273, 3294, 3314, 3332, 3361, 3382, 3404, 3418, 3428, 3434, 3436, 3438, 3440, 3446,
+    3448, 3450, 3452, 3458, 3460, 3466, 3468, 3470, 3476, 3478, 3484, 3490, 3496, 3502, 3508, 3518,
+};
+static constexpr uint8_t mac_code_8[] = {
+    0xff, 0x46, 0xd8, 0x46, 0x00, 0x45, 0xa5, 0x46, 0x86, 0x46, 0x00, 0x45, 0xc9, 0x46, 0x00, 0x45,
+    0xac, 0x46, 0xbf, 0x46, 0x00, 0x45, 0xbe, 0x46, 0xff, 0x46, 0xa7, 0x46, 0x00, 0x45, 0xd6, 0x46,
+    0x9d, 0x46, 0x00, 0x45, 0xcb, 0x46, 0x00, 0x45, 0x93, 0x46, 0x90, 0x46, 0x00, 0x45, 0xe8, 0x46,
+    0x00, 0x45, 0x83, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46,
+    0x87, 0x46, 0x00, 0x45, 0xf6, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0xfa, 0x46, 0x00, 0x45,
+    0x83, 0x46, 0x8b, 0x46, 0x00, 0x45, 0xbb, 0x46, 0x02, 0x38, 0x27, 0x38, 0xb0, 0x46, 0x02, 0x45,
+    0x46, 0x46, 0xc6, 0x46, 0x05, 0x3b, 0x1b, 0x1b, 0x24, 0x1e, 0x1e, 0xb2, 0x46, 0xc4, 0x46, 0x07,
+    0x3b, 0x1b, 0x1b, 0x24, 0x1b, 0x06, 0x05, 0x1e, 0xb2, 0x46, 0xc2, 0x46, 0x0a, 0x3e, 0x1e, 0x17,
+    0x24, 0x1e, 0x06, 0x05, 0x04, 0x04, 0x1e, 0x3e, 0xb1, 0x46, 0xc0, 0x46, 0x05, 0x38, 0x1e, 0x17,
+    0x24, 0x1e, 0x06, 0x84, 0x04, 0x01, 0x1e, 0x3e, 0xb1, 0x46, 0xbf, 0x46, 0x04, 0x22, 0x17, 0x24,
+    0x1e, 0x08, 0x83, 0x04, 0x04, 0x16, 0x1b, 0x04, 0x1e, 0x3a, 0xb1, 0x46, 0xbd, 0x46, 0x04, 0x22,
+    0x17, 0x24, 0x1e, 0x11, 0x83, 0x04, 0x06, 0x16, 0x2b, 0x3d, 0x28, 0x04, 0x1e, 0x3a, 0xb1, 0x46,
+    0xbb, 0x46, 0x04, 0x23, 0x17, 0x24, 0x1e, 0x11, 0x83, 0x04, 0x01, 0x16, 0x2b, 0x82, 0x3d, 0x03,
+    0x29, 0x04, 0x1e, 0x30, 0xa8, 0x46, 0x00, 0x45, 0x87, 0x46, 0xb9, 0x46, 0x04, 0x27, 0x17, 0x24,
+    0x1e, 0x11, 0x83, 0x04, 0x01, 0x16, 0x29, 0x84, 0x3d, 0x03, 0x2b, 0x04, 0x1e, 0x30, 0xb1, 0x46,
+    0xb7, 0x46, 0x04, 0x2a, 0x17, 0x24, 0x1e, 0x16, 0x83, 0x04, 0x01, 0x16, 0x29, 0x86, 0x3d, 0x03,
+    0x33, 0x04, 0x1e, 0x30, 0xb1, 0x46, 0xb5, 0x46, 0x04, 0x2f, 0x17, 0x24, 0x1e, 0x16, 0x83, 0x04,
+    0x01, 0x11, 0x24, 0x88, 0x3d, 0x03, 0x35, 0x04, 0x1e, 0x22, 0xb1, 0x46, 0xb3, 0x46, 0x04, 0x30,
+    0x17, 0x24, 0x1e, 0x16, 0x83, 0x04, 0x01, 0x0f, 0x24, 0x8a, 0x3d, 0x03, 0x35, 0x04, 0x1e, 0x22,
+    0xb1, 0x46, 0x86, 0x46, 0x00, 0x45, 0xa9, 0x46, 0x04, 0x37, 0x17, 0x19, 0x21, 0x17, 0x83, 0x04,
+    0x01, 0x11, 0x24, 0x8c, 0x3d, 0x03, 0x35, 0x04, 0x19, 0x21, 0xb1, 0x46, 0xaf, 0x46, 0x04, 0x37,
+    0x17, 0x19, 0x21, 0x17, 0x83, 0x04, 0x02, 0x0f, 0x1c, 0x3c, 0x8e, 0x3d, 0x02, 0x06, 0x1b, 0x1b,
+    0xb1, 0x46, 0x02, 0x46, 0x46, 0x45, 0xaa, 0x46, 0x04, 0x38, 0x1b, 0x1b, 0x24, 0x17, 0x83, 0x04,
+    0x02, 0x06, 0x1c, 0x3c, 0x90, 0x3d, 0x02, 0x0c, 0x17, 0x19, 0xb1, 0x46, 0x83, 0x46, 0x00, 0x45,
+    0xa6, 0x46, 0x0b, 0x3a, 0x1b, 0x1b, 0x24, 0x1b, 0x04, 0x04, 0x06, 0x05, 0x04, 0x1e, 0x3e, 0x92,
+    0x3d, 0x02, 0x11, 0x16, 0x1b, 0xb1, 0x46, 0x02, 0x46, 0x46, 0x45, 0xa6, 0x46, 0x05, 0x3b, 0x1b,
+    0x1b, 0x24, 0x1e, 0x06, 0x83, 0x04, 0x01, 0x1e, 0x36, 0x94, 0x3d, 0x02, 0x16, 0x13, 0x1e, 0xb1,
+    0x46, 0xa7, 0x46, 0x06, 0x3e, 0x1e, 0x17, 0x24, 0x1e, 0x06, 0x05, 0x82, 0x04, 0x01, 0x1b, 0x36,
+    0x96, 0x3d, 0x02, 0x16, 0x0f, 0x1e, 0xb1, 0x46, 0x86, 0x46, 0x00, 0x45, 0x9d, 0x46, 0x05, 0x3e,
+    0x1e, 0x17, 0x24, 0x1e, 0x06, 0x83, 0x04, 0x01, 0x1b, 0x34, 0x98, 0x3d, 0x03, 0x17, 0x06, 0x1c,
+    0x45, 0xb0, 0x46, 0x84, 0x46, 0x00, 0x45, 0x9d, 0x46, 0x05, 0x3e, 0x22, 0x17, 0x24, 0x1e, 0x08,
+    0x83, 0x04, 0x01, 0x17, 0x33, 0x9a, 0x3d, 0x02, 0x1b, 0x04, 0x1e, 0xb1, 0x46, 0x87, 0x46, 0x00,
+    0x45, 0x99, 0x46, 0x04, 0x22, 0x17, 0x24, 0x1e, 0x0f, 0x83, 0x04, 0x01, 0x17, 0x33, 0x9c, 0x3d,
+    0x03, 0x1b, 0x04, 0x1e, 0x3a, 0xb0, 0x46, 0xa0, 0x46, 0x04, 0x22, 0x17, 0x24, 0x1e, 0x11, 0x83,
+    0x04, 0x01, 0x16, 0x2b, 0x9e, 0x3d, 0x03, 0x1c, 0x04, 0x1e, 0x3a, 0xb0, 0x46, 0x02, 0x46, 0x46,
+    0x45, 0x9b, 0x46, 0x04, 0x27, 0x17, 0x21, 0x1c, 0x13, 0x83, 0x04, 0x01, 0x16, 0x29, 0xa0, 0x3d,
+    0x03, 0x24, 0x04, 0x1e, 0x3a, 0xb0, 0x46, 0x02, 0x46, 0x46, 0x45, 0x99, 0x46, 0x04, 0x2a, 0x17,
+    0x1c, 0x1c, 0x13, 0x83, 0x04, 0x01, 0x16, 0x29, 0xa2, 0x3d, 0x03, 0x24, 0x04, 0x1e, 0x3a, 0xb0,
+    0x46, 0x82, 0x46, 0x00, 0x45, 0x96, 0x46, 0x04, 0x42, 0x17, 0x24, 0x1e, 0x16, 0x83, 0x04, 0x01,
+    0x13, 0x29, 0xa4, 0x3d, 0x03, 0x29, 0x04, 0x1e, 0x37, 0xb0, 0x46, 0x82, 0x46, 0x00, 0x45, 0x96,
+    0x46, 0x02, 0x1b, 0x24, 0x1b, 0x83, 0x04, 0x01, 0x16, 0x29, 0x95, 0x3d, 0x00, 0x40, 0x8f, 0x3d,
+    0x03, 0x2b, 0x04, 0x1c, 0x30, 0xb0, 0x46, 0x82, 0x46, 0x00, 0x45, 0x96, 0x46, 0x01, 0x17, 0x19,
+    0x82, 0x04, 0x01, 0x0f, 0x25, 0x92, 0x3d, 0x00, 0x40, 0x92, 0x3d, 0x05, 0x40, 0x3d, 0x31, 0x04,
+    0x1e, 0x30, 0xb0, 0x46, 0x82, 0x46, 0x00, 0x45, 0x95, 0x46, 0x05, 0x3e, 0x17, 0x19, 0x04, 0x08,
+    0x24, 0x95, 0x3d, 0x01, 0x40, 0x3d, 0x82, 0x44, 0x8f, 0x3d, 0x03, 0x2b, 0x04, 0x1e, 0x30, 0xb0,
+    0x46, 0x89, 0x46, 0x00, 0x45, 0x8e, 0x46, 0x04, 0x42, 0x17, 0x19, 0x04, 0x16, 0x92, 0x3d, 0x0a,
+    0x40, 0x2e, 0x15, 0x26, 0x44, 0x44, 0x3d, 0x44, 0x44, 0x3d, 0x44, 0x8e, 0x3d, 0x02, 0x04, 0x1e,
+    0x22, 0xb0, 0x46, 0x9a, 0x46, 0x03, 0x17, 0x1e, 0x04, 0x16, 0x91, 0x3d, 0x09, 0x2e, 0x15, 0x07,
+    0x07, 0x36, 0x3d, 0x3d, 0x39, 0x43, 0x3f, 0x90, 0x3d, 0x02, 0x04, 0x1e, 0x22, 0xb0, 0x46, 0x8a,
+    0x46, 0x00, 0x45, 0x8e, 0x46, 0x03, 0x17, 0x19, 0x04, 0x11, 0x90, 0x3d, 0x00, 0x26, 0x83, 0x07,
+    0x08, 0x3c, 0x3d, 0x3e, 0x3b, 0x43, 0x3f, 0x3c, 0x3d, 0x3e, 0x8d, 0x3d, 0x02, 0x04, 0x1e, 0x22,
+    0xb0, 0x46, 0x8a, 0x46, 0x00, 0x45, 0x8e, 0x46, 0x03, 0x17, 0x19, 0x04, 0x08, 0x90, 0x3d, 0x00,
+    0x26, 0x82, 0x07, 0x08, 0x0b, 0x3f, 0x3d, 0x43, 0x3f, 0x3c, 0x3c, 0x3d, 0x3e, 0x8e, 0x3d, 0x02,
+    0x04, 0x17, 0x19, 0xb0, 0x46, 0x8f, 0x46, 0x00, 0x45, 0x89, 0x46, 0x06, 0x17, 0x1e, 0x04, 0x04,
+    0x3c, 0x3d, 0x3e, 0x8d, 0x3d, 0x07, 0x1d, 0x07, 0x07, 0x0a, 0x10, 0x3f, 0x3d, 0x43, 0x92, 0x3d,
+    0x03, 0x40, 0x08, 0x14, 0x1e, 0xb0, 0x46, 0x85, 0x46, 0x00, 0x45, 0x93, 0x46, 0x04, 0x1b, 0x24,
+    0x04, 0x04, 0x3c, 0x8f, 0x3d, 0x0b, 0x1d, 0x07, 0x0b, 0x10, 0x10, 0x19, 0x21, 0x3d, 0x28, 0x3c,
+    0x3d, 0x3e, 0x8f, 0x3d, 0x02, 0x13, 0x16, 0x1b, 0xb0, 0x46, 0x9a, 0x46, 0x07, 0x17, 0x24, 0x04,
+    0x04, 0x36, 0x3d, 0x3d, 0x39, 0x8c, 0x3d, 0x02, 0x26, 0x10, 0x10, 0x82, 0x0d, 0x02, 0x1f, 0x36,
+    0x31, 0x92, 0x3d, 0x02, 0x16, 0x13, 0x1e, 0xb0, 0x46, 0x9a, 0x46, 0x04, 0x1e, 0x24, 0x04, 0x04,
+    0x33, 0x8f, 0x3d, 0x01, 0x26, 0x10, 0x83, 0x0d, 0x01, 0x17, 0x33, 0x92, 0x3d, 0x04, 0x40, 0x17,
+    0x06, 0x19, 0x45, 0xaf, 0x46, 0x9a, 0x46, 0x04, 0x20, 0x28, 0x04, 0x04, 0x36, 0x8f, 0x3d, 0x02,
+    0x1d, 0x0d, 0x0d, 0x82, 0x09, 0x00, 0x00, 0x82, 0x3d, 0x00, 0x2b, 0x90, 0x3d, 0x02, 0x1b, 0x06,
+    0x1e, 0xb0, 0x46, 0x9a, 0x46, 0x04, 0x22, 0x25, 0x06, 0x05, 0x2b, 0x8f, 0x3d, 0x00, 0x26, 0x82,
+    0x0d, 0x82, 0x0a, 0x01, 0x31, 0x34, 0x92, 0x3d, 0x03, 0x19, 0x05, 0x1e, 0x43, 0xaf, 0x46, 0x9a,
+    0x46, 0x04, 0x2a, 0x25, 0x0f, 0x04, 0x29, 0x8f, 0x3d, 0x01, 0x26, 0x0d, 0x83, 0x0a, 0x01, 0x1f,
+    0x36, 0x92, 0x3d, 0x04, 0x40, 0x1c, 0x04, 0x1e, 0x3e, 0xaf, 0x46, 0x9a, 0x46, 0x04, 0x2a, 0x24,
+    0x13, 0x04, 0x24, 0x8f, 0x3d, 0x00, 0x2d, 0x82, 0x0a, 0x01, 0x1f, 0x36, 0x93, 0x3d, 0x05, 0x40,
+    0x3d, 0x1e, 0x04, 0x1e, 0x3e, 0xaf, 0x46, 0x9a, 0x46, 0x04, 0x30, 0x1c, 0x13, 0x04, 0x24, 0x90,
+    0x3d, 0x05, 0x0a, 0x1a, 0x36, 0x3d, 0x3d, 0x39, 0x92, 0x3d, 0x05, 0x29, 0x16, 0x04, 0x04, 0x1e,
+    0x3a, 0xaf, 0x46, 0x9a, 0x46, 0x05, 0x37, 0x19, 0x17, 0x04, 0x1c, 0x3c, 0x93, 0x3d, 0x02, 0x40,
+    0x3d, 0x44, 0x8f, 0x3d, 0x07, 0x2b, 0x14, 0x04, 0x04, 0x06, 0x11, 0x24, 0x37, 0xaf, 0x46, 0x9a,
+    0x46, 0x04, 0x3b, 0x19, 0x17, 0x04, 0x1e, 0x92, 0x3d, 0x02, 0x40, 0x3d, 0x44, 0x8f, 0x3d, 0x0a,
+    0x33, 0x17, 0x04, 0x04, 0x06, 0x0f, 0x11, 0x11, 0x1e, 0x16, 0x1b, 0xae, 0x46, 0x9a, 0x46, 0x04,
+    0x42, 0x17, 0x1b, 0x04, 0x1e, 0x92, 0x3d, 0x02, 0x40, 0x3d, 0x44, 0x8d, 0x3d, 0x05, 0x2d, 0x17,
+    0x04, 0x04, 0x06, 0x0f, 0x82, 0x11, 0x06, 0x17, 0x33, 0x3d, 0x36, 0x1e, 0x1e, 0x43, 0xab, 0x46,
+    0x9a, 0x46, 0x04, 0x3e, 0x17, 0x19, 0x04, 0x16, 0x92, 0x3d, 0x02, 0x40, 0x3d, 0x44, 0x8b, 0x3d,
+    0x05, 0x35, 0x1b, 0x04, 0x04, 0x06, 0x0f, 0x82, 0x11, 0x0a, 0x17, 0x33, 0x3d, 0x36, 0x3d, 0x33,
+    0x3d, 0x33, 0x17, 0x2a, 0x45, 0xa9, 0x46, 0x9a, 0x46, 0x04, 0x41, 0x17, 0x19, 0x04, 0x16, 0x93,
+    0x3d, 0x02, 0x40, 0x3d, 0x44, 0x88, 0x3d, 0x05, 0x35, 0x1b, 0x04, 0x04, 0x06, 0x0f, 0x83, 0x11,
+    0x00, 0x29, 0x82, 0x3d, 0x08, 0x32, 0x14, 0x06, 0x0f, 0x33, 0x3d, 0x33, 0x17, 0x33, 0xa8, 0x46,
+    0x9b, 0x46, 0x03, 0x17, 0x19, 0x04, 0x16, 0x94, 0x3d, 0x02, 0x40, 0x3d, 0x44, 0x85, 0x3d, 0x05,
+    0x33, 0x1e, 0x04, 0x04, 0x06, 0x0e, 0x83, 0x11, 0x10, 0x16, 0x29, 0x3d, 0x3d, 0x2b, 0x19, 0x0f,
+    0x06, 0x05, 0x0f, 0x11, 0x11, 0x24, 0x3d, 0x24, 0x1e, 0x3e, 0xa6, 0x46, 0x9b, 0x46, 0x03, 0x17,
+    0x19, 0x04, 0x11, 0x92, 0x3d, 0x02, 0x40, 0x3d, 0x44, 0x85, 0x3d, 0x05, 0x36, 0x1e, 0x06, 0x05,
+    0x04, 0x0e, 0x83, 0x11, 0x0b, 0x16, 0x2b, 0x3d, 0x3d, 0x33, 0x1e, 0x06, 0x0f, 0x03, 0x1b, 0x0f,
+    0x06, 0x82, 0x08, 0x05, 0x19, 0x33, 0x3d, 0x1e, 0x1e, 0x43, 0xa4, 0x46, 0x9b, 0x46, 0x03, 0x17,
+    0x19, 0x04, 0x08, 0x93, 0x3d, 0x02, 0x40, 0x3d, 0x44, 0x83, 0x3d, 0x04, 0x1c, 0x06, 0x05, 0x04,
+    0x0e, 0x83, 0x11, 0x0a, 0x16, 0x2b, 0x3d, 0x3d, 0x33, 0x17, 0x06, 0x05, 0x12, 0x19, 0x0f, 0x83,
+    0x08, 0x09, 0x02, 0x04, 0x06, 0x0e, 0x17, 0x33, 0x3d, 0x17, 0x24, 0x45, 0xa2, 0x46, 0x9b, 0x46,
+    0x04, 0x17, 0x19, 0x04, 0x04, 0x36, 0x93, 0x3d, 0x08, 0x40, 0x3d, 0x44, 0x3d, 0x1c, 0x06, 0x04,
+    0x04, 0x06, 0x84, 0x11, 0x04, 0x24, 0x3d, 0x3d, 0x35, 0x24, 0x82, 0x08, 0x02, 0x03, 0x16, 0x13,
+    0x82, 0x03, 0x0c, 0x02, 0x04, 0x12, 0x03, 0x08, 0x08, 0x02, 0x14, 0x1e, 0x3c, 0x29, 0x17, 0x33,
+    0xa1, 0x46, 0x9b, 0x46, 0x04, 0x1b, 0x24, 0x04, 0x04, 0x36, 0x94, 0x3d, 0x05, 0x40, 0x1c, 0x08,
+    0x04, 0x05, 0x0c, 0x83, 0x11, 0x01, 0x16, 0x24, 0x82, 0x3d, 0x06, 0x19, 0x0f, 0x08, 0x02, 0x17,
+    0x17, 0x06, 0x82, 0x08, 0x10, 0x19, 0x17, 0x04, 0x08, 0x08, 0x02, 0x12, 0x01, 0x06, 0x0f, 0x03,
+    0x0f, 0x33, 0x3d, 0x24, 0x1e, 0x3e, 0x9f, 0x46, 0x9b, 0x46, 0x04, 0x17, 0x24, 0x04, 0x04, 0x33,
+    0x92, 0x3d, 0x05, 0x40, 0x1c, 0x08, 0x04, 0x04, 0x13, 0x83, 0x11, 0x23, 0x16, 0x24, 0x3c, 0x3d,
+    0x3e, 0x1e, 0x08, 0x04, 0x03, 0x08, 0x03, 0x08, 0x03, 0x02, 0x04, 0x02, 0x04, 0x02, 0x03, 0x01,
+    0x06, 0x06, 0x01, 0x06, 0x06, 0x08, 0x08, 0x02, 0x12, 0x16, 0x13, 0x29, 0x3d, 0x1e, 0x1e, 0x43,
+    0x9d, 0x46, 0x9b, 0x46, 0x04, 0x1e, 0x24, 0x04, 0x04, 0x3c, 0x91, 0x3d, 0x0e, 0x24, 0x13, 0x04,
+    0x04, 0x06, 0x16, 0x22, 0x13, 0x11, 0x11, 0x21, 0x3c, 0x3d, 0x3e, 0x29, 0x82, 0x08, 0x08, 0x03,
+    0x1b, 0x12, 0x03, 0x08, 0x08, 0x02, 0x1b, 0x0f, 0x82, 0x08, 0x09, 0x03, 0x16, 0x13, 0x03, 0x08,
+    0x08, 0x02, 0x12, 0x0f, 0x06, 0x82, 0x08, 0x05, 0x25, 0x3d, 0x35, 0x1b, 0x27, 0x45, 0x9b, 0x46,
+    0x9b, 0x46, 0x04, 0x20, 0x28, 0x05, 0x04, 0x36, 0x8f, 0x3d, 0x20, 0x28, 0x11, 0x04, 0x04, 0x0c,
+    0x16, 0x22, 0x1e, 0x16, 0x11, 0x24, 0x37, 0x3d, 0x3d, 0x1c, 0x06, 0x08, 0x04, 0x1b, 0x14, 0x06,
+    0x08, 0x08, 0x02, 0x1b, 0x03, 0x08, 0x03, 0x06, 0x05, 0x0f, 0x12, 0x03, 0x83, 0x08, 0x02, 0x12,
+    0x0f, 0x06, 0x83, 0x08, 0x07, 0x19, 0x1b, 0x06, 0x1e, 0x36, 0x31, 0x17, 0x33, 0x9a, 0x46, 0x9b,
+    0x46, 0x04, 0x22, 0x25, 0x06, 0x05, 0x2b, 0x8d, 0x3d, 0x27, 0x29, 0x13, 0x04, 0x05, 0x0c, 0x18,
+    0x20, 0x1b, 0x18, 0x11, 0x24, 0x37, 0x3d, 0x3c, 0x21, 0x17, 0x02, 0x04, 0x02, 0x03, 0x08, 0x04,
+    0x01, 0x06, 0x06, 0x01, 0x12, 0x03, 0x08, 0x08, 0x03, 0x03, 0x13, 0x06, 0x01, 0x03, 0x08, 0x17,
+    0x12, 0x0f, 0x83, 0x08, 0x0b, 0x19, 0x21, 0x06, 0x0f, 0x03, 0x0f, 0x16, 0x3d, 0x3d, 0x28, 0x1b,
+    0x36, 0x98, 0x46, 0x9b, 0x46, 0x04, 0x22, 0x25, 0x0f, 0x04, 0x29, 0x8b, 0x3d, 0x1a, 0x29, 0x13,
+    0x04, 0x04, 0x06, 0x11, 0x11, 0x1b, 0x18, 0x11, 0x1e, 0x36, 0x3d, 0x3d, 0x39, 0x0f, 0x06, 0x08,
+    0x08, 0x1b, 0x12, 0x06, 0x0f, 0x03, 0x02, 0x1c, 0x06, 0x83, 0x08, 0x15, 0x12, 0x12, 0x03, 0x08,
+    0x08, 0x03, 0x17, 0x12, 0x11, 0x04, 0x04, 0x0c, 0x08, 0x19, 0x1b, 0x0f, 0x01, 0x01, 0x06, 0x06,
+    0x19, 0x33, 0x83, 0x3d, 0x02, 0x1e, 0x1e, 0x43, 0x96, 0x46, 0x9b, 0x46, 0x04, 0x2f, 0x24, 0x13,
+    0x04, 0x28, 0x89, 0x3d, 0x04, 0x2b, 0x16, 0x04, 0x04, 0x0c, 0x84, 0x11, 0x29, 0x1e, 0x3e, 0x3d,
+    0x3d, 0x28, 0x11, 0x06, 0x05, 0x17, 0x12, 0x06, 0x0f, 0x03, 0x02, 0x13, 0x04, 0x03, 0x08, 0x03,
+    0x02, 0x03, 0x08, 0x03, 0x06, 0x08, 0x04, 0x08, 0x08, 0x19, 0x06, 0x0f, 0x03, 0x0f, 0x16, 0x1c,
+    0x1c, 0x14, 0x04, 0x01, 0x06, 0x03, 0x24, 0x87, 0x3d, 0x03, 0x35, 0x1b, 0x27, 0x45, 0x94, 0x46,
+    0x9b, 0x46, 0x04, 0x37, 0x21, 0x16, 0x04, 0x24, 0x87, 0x3d, 0x04, 0x33, 0x16, 0x04, 0x04, 0x0c,
+    0x84, 0x11, 0x12, 0x1e, 0x36, 0x3d, 0x3d, 0x29, 0x1b, 0x04, 0x06, 0x05, 0x0f, 0x12, 0x03, 0x03,
+    0x08, 0x04, 0x01, 0x1b, 0x04, 0x06, 0x82, 0x08, 0x02, 0x12, 0x0f, 0x06, 0x82, 0x08, 0x0e, 0x17,
+    0x06, 0x08, 0x02, 0x04, 0x02, 0x19, 0x19, 0x0f, 0x08, 0x08, 0x04, 0x08, 0x1b, 0x36, 0x8a, 0x3d,
+    0x02, 0x2b, 0x17, 0x33, 0x93, 0x46, 0x9b, 0x46, 0x04, 0x30, 0x1c, 0x17, 0x04, 0x1c, 0x85, 0x3d,
+    0x04, 0x32, 0x14, 0x04, 0x04, 0x06, 0x84, 0x11, 0x05, 0x1b, 0x36, 0x3d, 0x3d, 0x33, 0x16, 0x82,
+    0x08, 0x00, 0x19, 0x83, 0x08, 0x10, 0x03, 0x1b, 0x02, 0x08, 0x08, 0x02, 0x12, 0x0f, 0x13, 0x06,
+    0x08, 0x08, 0x02, 0x1b, 0x12, 0x14, 0x06, 0x82, 0x08, 0x08, 0x19, 0x1c, 0x17, 0x04, 0x06, 0x0f,
+    0x03, 0x17, 0x33, 0x8e, 0x3d, 0x02, 0x29, 0x1b, 0x36, 0x91, 0x46, 0x9b, 0x46, 0x05, 0x30, 0x19,
+    0x17, 0x04, 0x1c, 0x3c, 0x82, 0x3d, 0x05, 0x33, 0x17, 0x04, 0x04, 0x06, 0x0f, 0x83, 0x11, 0x1c,
+    0x1e, 0x33, 0x3d, 0x3d, 0x29, 0x13, 0x06, 0x05, 0x12, 0x03, 0x08, 0x03, 0x02, 0x03, 0x03, 0x01,
+    0x03, 0x08, 0x01, 0x06, 0x06, 0x01, 0x08, 0x08, 0x02, 0x01, 0x06, 0x06, 0x19, 0x82, 0x08, 0x05,
+    0x03, 0x16, 0x19, 0x21, 0x11, 0x06, 0x82, 0x08, 0x01, 0x19, 0x33, 0x92, 0x3d, 0x01, 0x24, 0x1e,
+    0x90, 0x46, 0x9b, 0x46, 0x0b, 0x38, 0x1b, 0x1b, 0x04, 0x1e, 0x3d, 0x3d, 0x33, 0x1e, 0x04, 0x04,
+    0x06, 0x84, 0x11, 0x15, 0x17, 0x33, 0x3d, 0x3d, 0x29, 0x19, 0x05, 0x08, 0x04, 0x12, 0x14, 0x01,
+    0x06, 0x06, 0x08, 0x11, 0x1e, 0x06, 0x0f, 0x03, 0x0f, 0x16, 0x85, 0x08, 0x0e, 0x19, 0x0f, 0x06,
+    0x01, 0x06, 0x03, 0x17, 0x24, 0x12, 0x03, 0x01, 0x06, 0x03, 0x17, 0x33, 0x95, 0x3d, 0x01, 0x2e,
+    0x1e, 0x8f, 0x46, 0x9b, 0x46, 0x0a, 0x3b, 0x1b, 0x1b, 0x04, 0x1e, 0x30, 0x1b, 0x04, 0x04, 0x06,
+    0x0f, 0x83, 0x11, 0x0a, 0x17, 0x33, 0x3d, 0x36, 0x3d, 0x14, 0x06, 0x08, 0x12, 0x19, 0x03, 0x83,
+    0x08, 0x0f, 0x12, 0x02, 0x08, 0x06, 0x01, 0x03, 0x0f, 0x11, 0x06, 0x0f, 0x03, 0x02, 0x17, 0x12,
+    0x17, 0x06, 0x82, 0x08, 0x03, 0x19, 0x29, 0x13, 0x06, 0x82, 0x08, 0x01, 0x19, 0x33, 0x92, 0x3d,
+    0x06, 0x40, 0x3d, 0x44, 0x3d, 0x1c, 0x17, 0x24, 0x8f, 0x46, 0x97, 0x46, 0x00, 0x45, 0x82, 0x46,
+    0x08, 0x3e, 0x17, 0x1b, 0x04, 0x06, 0x05, 0x04, 0x06, 0x0f, 0x83, 0x11, 0x2a, 0x1b, 0x2b, 0x3d,
+    0x3d, 0x32, 0x14, 0x11, 0x04, 0x06, 0x05, 0x06, 0x05, 0x04, 0x04, 0x06, 0x01, 0x11, 0x11, 0x06,
+    0x0f, 0x03, 0x02, 0x13, 0x06, 0x05, 0x04, 0x0e, 0x11, 0x17, 0x12, 0x06, 0x08, 0x04, 0x08, 0x14,
+    0x1e, 0x16, 0x06, 0x01, 0x03, 0x06, 0x16, 0x2b, 0x94, 0x3d, 0x06, 0x40, 0x3d, 0x31, 0x17, 0x12,
+    0x27, 0x45, 0x8f, 0x46, 0x9c, 0x46, 0x05, 0x17, 0x19, 0x04, 0x04, 0x06, 0x0f, 0x83, 0x11, 0x16,
+    0x17, 0x33, 0x3d, 0x3d, 0x35, 0x1c, 0x06, 0x08, 0x08, 0x14, 0x1e, 0x02, 0x08, 0x06, 0x06, 0x1b,
+    0x12, 0x03, 0x08, 0x08, 0x03, 0x12, 0x0f, 0x84, 0x08, 0x11, 0x1b, 0x0f, 0x08, 0x02, 0x08, 0x06,
+    0x16, 0x22, 0x14, 0x06, 0x08, 0x08, 0x06, 0x1b, 0x29, 0x33, 0x2c, 0x33, 0x93, 0x3d, 0x04, 0x33,
+    0x1b, 0x18, 0x27, 0x45, 0x91, 0x46, 0x9c, 0x46, 0x02, 0x17, 0x19, 0x04, 0x83, 0x11, 0x01, 0x16,
+    0x25, 0x82, 0x3d, 0x12, 0x35, 0x17, 0x06, 0x08, 0x08, 0x17, 0x06, 0x08, 0x08, 0x03, 0x08, 0x03,
+    0x02, 0x03, 0x03, 0x02, 0x08, 0x06, 0x06, 0x82, 0x08, 0x17, 0x03, 0x11, 0x11, 0x17, 0x06, 0x0f,
+    0x03, 0x02, 0x19, 0x19, 0x14, 0x06, 0x08, 0x08, 0x06, 0x11, 0x24, 0x37, 0x33, 0x3d, 0x33, 0x36,
+    0x31, 0x33, 0x8f, 0x3d, 0x04, 0x2b, 0x1b, 0x18, 0x27, 0x43, 0x93, 0x46, 0x9c, 0x46, 0x01, 0x17,
+    0x24, 0x83, 0x11, 0x00, 0x24, 0x83, 0x3d, 0x01, 0x19, 0x12, 0x82, 0x03, 0x2b, 0x08, 0x0f, 0x04,
+    0x06, 0x05, 0x04, 0x1e, 0x02, 0x08, 0x06, 0x06, 0x08, 0x12, 0x0f, 0x02, 0x08, 0x06, 0x06, 0x16,
+    0x14, 0x06, 0x08, 0x01, 0x06, 0x12, 0x19, 0x17, 0x06, 0x08, 0x08, 0x03, 0x11, 0x24, 0x37, 0x33,
+    0x36, 0x31, 0x33, 0x36, 0x31, 0x33, 0x36, 0x33, 0x2c, 0x8b, 0x3d, 0x04, 0x2d, 0x17, 0x16, 0x22,
+    0x43, 0x95, 0x46, 0x9c, 0x46, 0x29, 0x17, 0x24, 0x11, 0x13, 0x29, 0x3c, 0x3d, 0x3e, 0x3d, 0x19,
+    0x0f, 0x08, 0x02, 0x17, 0x17, 0x06, 0x0f, 0x03, 0x0f, 0x16, 0x08, 0x06, 0x0f, 0x03, 0x02, 0x06,
+    0x16, 0x02, 0x08, 0x06, 0x06, 0x16, 0x17, 0x12, 0x11, 0x06, 0x0f, 0x03, 0x0f, 0x28, 0x17, 0x06,
+    0x83, 0x08, 0x0e, 0x25, 0x2c, 0x33, 0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x31, 0x33, 0x36, 0x33,
+    0x36, 0x33, 0x88, 0x3d, 0x03, 0x29, 0x1b, 0x16, 0x1b, 0x98, 0x46, 0x9c, 0x46, 0x07, 0x1b, 0x1b,
+    0x24, 0x3c, 0x3d, 0x3e, 0x3d, 0x19, 0x83, 0x08, 0x1b, 0x03, 0x06, 0x05, 0x04, 0x04, 0x06, 0x01,
+    0x12, 0x01, 0x06, 0x06, 0x08, 0x11, 0x0f, 0x06, 0x01, 0x02, 0x08, 0x14, 0x14, 0x06, 0x08, 0x08,
+    0x06, 0x1b, 0x1b, 0x17, 0x06, 0x82, 0x08, 0x14, 0x0f, 0x1e, 0x2b, 0x33, 0x3d, 0x33, 0x36, 0x36,
+    0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x83, 0x3d, 0x04,
+    0x33, 0x1e, 0x16, 0x1e, 0x3e, 0x99, 0x46, 0x9d, 0x46, 0x01, 0x16, 0x2b, 0x82, 0x3d, 0x1f, 0x12,
+    0x0f, 0x02, 0x03, 0x08, 0x12, 0x03, 0x08, 0x08, 0x03, 0x1e, 0x04, 0x08, 0x08, 0x02, 0x12, 0x0f,
+    0x13, 0x02, 0x08, 0x06, 0x06, 0x17, 0x17, 0x06, 0x02, 0x04, 0x02, 0x0f, 0x1e, 0x1b, 0x0f, 0x83,
+    0x08, 0x04, 0x19, 0x33, 0x33, 0x3d, 0x33, 0x82, 0x36, 0x13, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33,
+    0x36, 0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x3d, 0x33, 0x1e, 0x16, 0x1b, 0x9c, 0x46,
+    0x9d, 0x46, 0x1c, 0x1b, 0x1b, 0x1e, 0x3e, 0x3d, 0x36, 0x1e, 0x14, 0x06, 0x08, 0x08, 0x06, 0x11,
+    0x01, 0x06, 0x06, 0x01, 0x02, 0x04, 0x12, 0x02, 0x08, 0x06, 0x06, 0x16, 0x12, 0x14, 0x0f, 0x06,
+    0x82, 0x08, 0x01, 0x2b, 0x19, 0x84, 0x08, 0x04, 0x19, 0x33, 0x33, 0x3d, 0x33, 0x83, 0x36, 0x05,
+    0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x82, 0x36, 0x0b, 0x31, 0x33, 0x36, 0x33, 0x36, 0x3c, 0x35,
+    0x24, 0x16, 0x1b, 0x3b, 0x43, 0x9c, 0x46, 0x9e, 0x46, 0x28, 0x2a, 0x16, 0x1b, 0x21, 0x3c, 0x3d,
+    0x33, 0x16, 0x08, 0x02, 0x04, 0x02, 0x0f, 0x08, 0x08, 0x02, 0x12, 0x0f, 0x03, 0x01, 0x03, 0x06,
+    0x16, 0x16, 0x06, 0x08, 0x08, 0x02, 0x12, 0x1b, 0x1b, 0x0f, 0x06, 0x01, 0x08, 0x08, 0x19, 0x29,
+    0x33, 0x3d, 0x33, 0x84, 0x36, 0x05, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x83, 0x36, 0x08, 0x31,
+    0x33, 0x36, 0x3c, 0x35, 0x1c, 0x13, 0x1b, 0x36, 0x9f, 0x46, 0xa0, 0x46, 0x08, 0x22, 0x18, 0x20,
+    0x25, 0x3d, 0x3d, 0x2c, 0x17, 0x06, 0x82, 0x08, 0x0e, 0x01, 0x06, 0x06, 0x08, 0x11, 0x06, 0x1b,
+    0x12, 0x11, 0x04, 0x04, 0x0c, 0x08, 0x19, 0x33, 0x84, 0x08, 0x09, 0x24, 0x29, 0x33, 0x36, 0x31,
+    0x33, 0x36, 0x33, 0x36, 0x33, 0x84, 0x36, 0x05, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x82, 0x36,
+    0x04, 0x29, 0x21, 0x16, 0x1b, 0x36, 0xa1, 0x46, 0xa1, 0x46, 0x0a, 0x3e, 0x1e, 0x18, 0x20, 0x25,
+    0x3d, 0x3d, 0x1c, 0x08, 0x04, 0x05, 0x84, 0x08, 0x01, 0x0f, 0x06, 0x82, 0x08, 0x11, 0x11, 0x24,
+    0x19, 0x0f, 0x08, 0x02, 0x02, 0x04, 0x1b, 0x36, 0x3d, 0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33,
+    0x85, 0x36, 0x0c, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x1e, 0x16, 0x16, 0x1b, 0x3b,
+    0xa3, 0x46, 0xa3, 0x46, 0x07, 0x38, 0x1b, 0x1b, 0x1e, 0x37, 0x3d, 0x3d, 0x1c, 0x85, 0x08, 0x0c,
+    0x0f, 0x08, 0x08, 0x02, 0x1b, 0x1c, 0x17, 0x06, 0x0f, 0x03, 0x0f, 0x1c, 0x3c, 0x82, 0x3d, 0x08,
+    0x3c, 0x35, 0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x86, 0x36, 0x07, 0x31, 0x33, 0x36, 0x1c,
+    0x13, 0x1b, 0x3b, 0x43, 0xa5, 0x46, 0xa5, 0x46, 0x09, 0x2a, 0x18, 0x17, 0x24, 0x36, 0x3d, 0x2b,
+    0x19, 0x17, 0x06, 0x82, 0x08, 0x0b, 0x0f, 0x1b, 0x1b, 0x0f, 0x08, 0x08, 0x02, 0x0f, 0x17, 0x33,
+    0x3d, 0x36, 0x85, 0x3d, 0x07, 0x35, 0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x85, 0x36, 0x03,
+    0x1c, 0x13, 0x1b, 0x3b, 0xa8, 0x46, 0xa7, 0x46, 0x12, 0x22, 0x17, 0x1b, 0x24, 0x3d, 0x3d, 0x29,
+    0x11, 0x06, 0x08, 0x17, 0x19, 0x17, 0x06, 0x08, 0x08, 0x03, 0x17, 0x33, 0x8b, 0x3d, 0x0d, 0x2b,
+    0x36, 0x31, 0x33, 0x36, 0x33, 0x36, 0x33, 0x36, 0x36, 0x21, 0x16, 0x1b, 0x38, 0xaa, 0x46, 0x92,
+    0x46, 0x00, 0x45, 0x95, 0x46, 0x09, 0x22, 0x18, 0x1b, 0x2b, 0x3d, 0x3d, 0x28, 0x29, 0x13, 0x06,
+    0x82, 0x08, 0x01, 0x19, 0x29, 0x8f, 0x3d, 0x09, 0x2b, 0x36, 0x31, 0x33, 0x36, 0x3c, 0x32, 0x18,
+    0x18, 0x37, 0xac, 0x46, 0xaa, 0x46, 0x0b, 0x3e, 0x1e, 0x18, 0x1e, 0x37, 0x3d, 0x3c, 0x1b, 0x06,
+    0x06, 0x16, 0x2b, 0x92, 0x3d, 0x07, 0x2b, 0x36, 0x3c, 0x35, 0x36, 0x18, 0x27, 0x45, 0xad, 0x46,
+    0x8d, 0x46, 0x00, 0x45, 0x9d, 0x46, 0x07, 0x38, 0x1b, 0x18, 0x27, 0x36, 0x3d, 0x2b, 0x2b, 0x96,
+    0x3d, 0x04, 0x29, 0x17, 0x16, 0x22, 0x43, 0xae, 0x46, 0x91, 0x46, 0x00, 0x45, 0x9b, 0x46, 0x03,
+    0x30, 0x18, 0x17, 0x24, 0x96, 0x3d, 0x04, 0x33, 0x1b, 0x16, 0x22, 0x43, 0xb0, 0x46, 0x8b, 0x46,
+    0x00, 0x45, 0xa3, 0x46, 0x03, 0x27, 0x16, 0x1b, 0x29, 0x92, 0x3d, 0x03, 0x33, 0x1b, 0x16, 0x22,
+    0xb3, 0x46, 0xb1, 0x46, 0x04, 0x3e, 0x20, 0x16, 0x1b, 0x3b, 0x8e, 0x3d, 0x04, 0x33, 0x1b, 0x16,
+    0x22, 0x43, 0xb4, 0x46, 0x82, 0x46, 0x00, 0x45, 0xaf, 0x46, 0x07, 0x3e, 0x1e, 0x18, 0x1e, 0x36,
+    0x3d, 0x3d, 0x39, 0x87, 0x3d, 0x04, 0x32, 0x1e, 0x16, 0x1e, 0x41, 0xb1, 0x46, 0x00, 0x45, 0x83,
+    0x46, 0x89, 0x46, 0x00, 0x45, 0xaa, 0x46, 0x03, 0x38, 0x1b, 0x18, 0x24, 0x87, 0x3d, 0x04, 0x33,
+    0x1e, 0x16, 0x1e, 0x41, 0xb8, 0x46, 0xb7, 0x46, 0x0c, 0x30, 0x18, 0x17, 0x33, 0x3d, 0x36, 0x3d,
+    0x3d, 0x33, 0x1e, 0x16, 0x1b, 0x3b, 0xae, 0x46, 0x00, 0x45, 0x8a, 0x46, 0xb9, 0x46, 0x08, 0x27,
+    0x16, 0x1b, 0x2b, 0x33, 0x1e, 0x16, 0x1b, 0x36, 0xbc, 0x46, 0xbb, 0x46, 0x04, 0x20, 0x16, 0x16,
+    0x1b, 0x3b, 0xbe, 0x46, 0xbd, 0x46, 0x00, 0x43, 0xc0, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46,
+    0x95, 0x46, 0x00, 0x44, 0xe8, 0x46, 0xff, 0x46, 0xff, 0x46, 0xff, 0x46, 0x83, 0x46, 0x00, 0x45,
+    0xfa, 0x46, 0xff, 0x46, 0xf3, 0x46, 0x00, 0x45, 0x8a, 0x46, 0xff, 0x46, 0xff, 0x46, 0xdf, 0x46,
+    0x00, 0x45, 0x9e, 0x46, 0xff, 0x46, 0xe1, 0x46, 0x00, 0x45, 0x9c, 0x46, 0xa9, 0x46, 0x00, 0x45,
+    0xd4, 0x46, 0xe4, 0x46, 0x00, 0x45, 0x99, 0x46, 0xbc, 0x46, 0x00, 0x45, 0xc1, 0x46, 0xe8, 0x46,
+    0x00, 0x45, 0x95, 0x46, 0x8d, 0x46, 0x00, 0x45, 0xe3, 0x46, 0x00, 0x45, 0x8b, 0x46, 0xed, 0x46,
+    0x00, 0x45, 0x90, 0x46,
+};
+
+// 9 frames, 40759 bytes (raw: 294912)
+static constexpr Driver::Device::Rle565_t mac_rle[] = {
+    {128, 128, mac_pal_0, mac_row_0, mac_code_0},
+    {128, 128, mac_pal_1, mac_row_1, mac_code_1},
+    {128, 128, mac_pal_2, mac_row_2, mac_code_2},
+    {128, 128, mac_pal_3, mac_row_3, mac_code_3},
+    {128, 128, mac_pal_4, mac_row_4, mac_code_4},
+    {128, 128, mac_pal_5, mac_row_5, mac_code_5},
+    {128, 128, mac_pal_6, mac_row_6, mac_code_6},
+    {128, 128, mac_pal_7, mac_row_7, mac_code_7},
+    {128, 128, mac_pal_8, mac_row_8, mac_code_8},
+};
+
+#endif
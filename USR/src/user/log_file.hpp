@@ -0,0 +1,200 @@
+#ifndef _MOS_USER_LOG_FILE_
+#define _MOS_USER_LOG_FILE_
+
+#include <string.h>
+
+#include "FatFS/ff.h"
+
+namespace MOS::FileSys
+{
+	// Append-only log file, kept open between records
+	//
+	// Records gather in a RAM buffer whose start always sits on a sector
+	// boundary of the file, so f_write only ever gets whole sectors and FatFs
+	// passes them to disk_write() as they are. sync() also writes the partial
+	// last sector, the next flush() writes it again once it is full.
+	// No kernel calls: the owner passes the time (ms) and does the locking.
+	struct LogFile_t
+	{
+		static constexpr uint32_t SECTOR = _MIN_SS;
+
+		struct Cfg_t
+		{
+			const char* path;    // up to 61 chars, rotated copies are path.1 .. path.keep
+			uint32_t max_size;   // rotate before the file grows past this
+			uint8_t keep;        // rotated copies kept (up to 9), 0 drops the old file
+			uint32_t sync_bytes; // f_sync once this much is unsynced
+			uint32_t sync_ms;    // or this long after the first unsynced record
+		};
+
+		const Cfg_t cfg;
+		uint8_t* const buf;
+		const uint32_t cap; // whole sectors, at least 2
+
+		FIL fil;
+		bool opened       = false;
+		uint32_t len      = 0; // bytes in buf
+		uint32_t base     = 0; // file offset of buf[0], sector aligned
+		uint32_t unsynced = 0; // bytes put since the last f_sync
+		uint32_t t_dirty  = 0; // when the first of them came
+
+		struct
+		{
+			uint32_t records, bytes, dropped;
+			uint32_t writes, sectors; // f_write calls, whole sectors written
+			uint32_t syncs, rotations, errors;
+		} stat = {};
+
+		LogFile_t(const Cfg_t& cfg, void* buf, uint32_t size)
+		    : cfg(cfg), buf((uint8_t*) buf), cap(size / SECTOR * SECTOR) {}
+
+		// Opens or creates the file, its partial last sector comes back into buf
+		FRESULT open()
+		{
+			FRESULT res = f_open(&fil, cfg.path, FA_OPEN_ALWAYS | FA_READ | FA_WRITE);
+			if (res != FR_OK) return res;
+
+			opened   = true;
+			base     = f_size(&fil) / SECTOR * SECTOR;
+			len      = f_size(&fil) - base;
+			unsynced = 0;
+
+			UINT n;
+			res = f_lseek(&fil, base);
+			if (res == FR_OK && len) res = f_read(&fil, buf, len, &n);
+			if (res == FR_OK) res = f_lseek(&fil, base);
+			return res;
+		}
+
+		FRESULT close()
+		{
+			if (!opened) return FR_OK;
+			const FRESULT res = sync();
+			f_close(&fil);
+			opened = false;
+			return res;
+		}
+
+		// Copies a record in, with a '\n' if it has none, false if it was dropped.
+		// Only writes when the buffer is full or the file has to rotate
+		bool put(const char* text, uint32_t n, uint32_t now)
+		{
+			const bool nl       = !n || text[n - 1] != '\n';
+			const uint32_t size = n + nl;
+
+			if (!opened || size > cap - SECTOR ||
+			    (base + len + size > cfg.max_size && rotate() != FR_OK) ||
+			    (len + size > cap && flush() != FR_OK)) {
+				stat.dropped++;
+				return false;
+			}
+
+			memcpy(buf + len, text, n);
+			len += n;
+			if (nl) buf[len++] = '\n';
+
+			if (!unsynced) t_dirty = now;
+			unsynced += size;
+			stat.records++;
+			stat.bytes += size;
+			return true;
+		}
+
+		// Sync policy, call after a batch of records and when idle:
+		// whole sectors go out once half the buffer is used
+		FRESULT poll(uint32_t now)
+		{
+			if (!unsynced) return FR_OK;
+			if (unsynced >= cfg.sync_bytes || now - t_dirty >= cfg.sync_ms) return sync();
+			return len >= cap / 2 ? flush() : FR_OK;
+		}
+
+		// Writes the whole sectors of buf, the partial one stays
+		FRESULT flush()
+		{
+			const uint32_t whole = len / SECTOR * SECTOR;
+			if (!whole) return FR_OK;
+
+			UINT n;
+			FRESULT res = f_write(&fil, buf, whole, &n);
+			if (res == FR_OK && n != whole) res = FR_DENIED; // volume full
+			if (res != FR_OK) {
+				stat.errors++;
+				return res;
+			}
+
+			len -= whole;
+			base += whole;
+			memmove(buf, buf + whole, len);
+
+			stat.writes++;
+			stat.sectors += whole / SECTOR;
+			return FR_OK;
+		}
+
+		// Everything put so far reaches the card: whole sectors, the tail, f_sync.
+		// The tail stays in buf and the file position goes back to base
+		FRESULT sync()
+		{
+			if (!opened) return FR_OK;
+
+			UINT n;
+			FRESULT res = flush();
+			if (res == FR_OK && len) {
+				res = f_write(&fil, buf, len, &n);
+				if (res == FR_OK) res = f_lseek(&fil, base);
+			}
+			if (res == FR_OK) res = f_sync(&fil);
+			if (res != FR_OK) {
+				stat.errors++;
+				return res;
+			}
+
+			unsynced = 0;
+			stat.syncs++;
+			return FR_OK;
+		}
+
+		// Reads the file from `ofs`, after a sync() so it has every record
+		FRESULT read(uint32_t ofs, void* dst, UINT n, UINT* br)
+		{
+			FRESULT res = sync();
+			if (res == FR_OK) res = f_lseek(&fil, ofs);
+			if (res == FR_OK) res = f_read(&fil, dst, n, br);
+			const FRESULT back = f_lseek(&fil, base);
+			return res != FR_OK ? res : back;
+		}
+
+		// path -> path.1 -> ... -> path.keep, the oldest goes
+		FRESULT rotate()
+		{
+			char from[64], to[64];
+
+			FRESULT res = close();
+			if (res != FR_OK) return res;
+
+			f_unlink(name(to, cfg.keep));
+			for (uint8_t i = cfg.keep; i; i--) {
+				f_rename(name(from, i - 1), name(to, i));
+			}
+
+			stat.rotations++;
+			return open();
+		}
+
+		// path for 0, path.i otherwise
+		char* name(char* dst, uint8_t i) const
+		{
+			const size_t n = strlen(cfg.path);
+			memcpy(dst, cfg.path, n + 1);
+			if (i) {
+				dst[n]     = '.';
+				dst[n + 1] = '0' + i;
+				dst[n + 2] = '\0';
+			}
+			return dst;
+		}
+	};
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "src/core/kernel/sync.hpp"
 #include "src/core/kernel/ipc.hpp"
 #include "global.hpp"
+#include "img/cat_gif/frames.h"
+#include "img/cat_gif/rle.h"
 
 namespace MOS::User::Test
 {
@@ -74,6 +76,166 @@ namespace MOS::User::Test
 		Task::create(launch, nullptr, Macro::PRI_MAX, "msg_q/test");
 	}
 
+	void SpiDmaTest()
+	{
+		using Global::lcd;
+		using Global::lcd_dma;
+
+		static constexpr auto LEN    = 4096;
+		static constexpr auto ROUNDS = 64;
+
+		static uint8_t buf[LEN];
+
+		// Data is clocked out with CS high, so the panel ignores it
+		static auto bench = [] {
+			auto measure = [](auto&& fn) {
+				const auto t0 = Kernel::Global::os_ticks;
+				for (auto _: Range(0, ROUNDS)) {
+					fn();
+				}
+				const auto dt = Kernel::Global::os_ticks - t0;
+				return dt ? dt : 1;
+			};
+
+			auto kb_s = [](auto ticks) {
+				return (uint32_t) (LEN * ROUNDS / 1024 * Macro::SYSTICK / ticks);
+			};
+
+			for (auto i: Range(0, LEN)) {
+				buf[i] = i;
+			}
+
+			const auto polled = measure([] {
+				for (auto byte: buf) {
+					lcd.spi.write_bus(byte);
+				}
+			});
+			const auto bulk = measure([] { lcd.spi.write(buf, LEN); });
+			const auto dma  = measure([] { lcd.spi.write(lcd_dma, buf, LEN); });
+
+			kprintf(
+			    "SPI1 %d KB -> polled: %d KB/s, bulk: %d KB/s, dma: %d KB/s\n",
+			    LEN * ROUNDS / 1024, kb_s(polled), kb_s(bulk), kb_s(dma)
+			);
+		};
+
+		Task::create(bench, nullptr, Macro::PRI_MAX, "spi/bench");
+	}
+
+	void LcdFpsTest()
+	{
+		using Global::lcd;
+
+		static constexpr auto FRAMES = 60;
+
+		// Run with App::lcd_init disabled, the framebuffer is bypassed to time the bus
+		static auto bench = [] {
+			const auto fb = lcd.fb;
+			lcd.fb        = nullptr;
+
+			auto fps = [](auto&& draw) {
+				const auto t0 = Kernel::Global::os_ticks;
+				for (auto i: Range(0, FRAMES)) {
+					draw(i % 6);
+				}
+				const auto dt = Kernel::Global::os_ticks - t0;
+				return (uint32_t) (FRAMES * Macro::SYSTICK / (dt ? dt : 1));
+			};
+
+			// Raw frames are only referenced here, keep it to one of them
+			const auto per_pixel = fps([](auto) {
+				lcd.address_set(0, 0, 127, 127);
+				for (auto i: Range(0, 128 * 128)) {
+					lcd.write_16bit_data(cat_00[i]);
+				}
+			});
+
+			const auto streamed = fps([](auto) {
+				lcd.draw_img(0, 0, 128, 128, cat_00);
+			});
+
+			const auto serial = fps([](auto i) { // decode, then send, row after row
+				lcd.address_set(0, 0, 127, 127);
+				lcd.stream_begin();
+				for (auto row: Range(0, 128)) {
+					cat_rle[i].decode_row(row, lcd.line_buf);
+					lcd.stream(lcd.line_buf, 128);
+				}
+				lcd.stream_end();
+			});
+
+			const auto pipelined = fps([](auto i) {
+				lcd.draw_rle(0, 0, cat_rle[i]);
+			});
+
+			lcd.fb = fb;
+
+			kprintf(
+			    "LCD 128x128 -> per-pixel: %d fps, streamed: %d fps, "
+			    "rle serial: %d fps, rle pipelined: %d fps\n",
+			    per_pixel, streamed, serial, pipelined
+			);
+		};
+
+		Task::create(bench, nullptr, Macro::PRI_MAX, "lcd/bench");
+	}
+
+	void LcdTextTest()
+	{
+		using Global::lcd;
+		using Color = Driver::Device::ST7735S_t::Color;
+
+		static constexpr auto LOOPS = 20;
+		static constexpr char text[] = "hello, world!";
+		static constexpr auto N      = sizeof(text) - 1;
+
+		// Run with App::lcd_init disabled, the framebuffer is bypassed to time the bus
+		static auto bench = [] {
+			const auto fb = lcd.fb;
+			lcd.fb        = nullptr;
+
+			auto cps = [](auto&& draw) { // chars per second
+				const auto t0 = Kernel::Global::os_ticks;
+				for (auto _: Range(0, LOOPS)) {
+					draw();
+				}
+				const auto dt = Kernel::Global::os_ticks - t0;
+				return (uint32_t) (LOOPS * N * Macro::SYSTICK / (dt ? dt : 1));
+			};
+
+			const auto per_pixel = cps([] { // the old show_char, one CS toggle per pixel
+				for (auto i: Range(0, N)) {
+					const auto glyph = Driver::Device::ascii_1608[text[i] - ' '];
+					lcd.address_set(5 + 8 * i, 132, 5 + 8 * i + 7, 132 + 15);
+					for (auto pos: Range(0, 16)) {
+						for (auto t: Range(0, 8)) {
+							lcd.write_16bit_data((glyph[pos] >> t) & 0x01 ? Color::RED : lcd.bkgd);
+						}
+					}
+				}
+			});
+
+			const auto opaque = cps([] {
+				lcd.show_str(5, 132, text, Color::GREEN);
+			});
+
+			const auto overlay = cps([] {
+				for (auto i: Range(0, N)) {
+					lcd.show_char(5 + 8 * i, 132, text[i], 1, Color::GRAYBLUE);
+				}
+			});
+
+			lcd.fb = fb;
+
+			kprintf(
+			    "LCD text -> per-pixel: %d chars/s, show_str: %d chars/s, overlay: %d chars/s\n",
+			    per_pixel, opaque, overlay
+			);
+		};
+
+		Task::create(bench, nullptr, Macro::PRI_MAX, "lcd/text");
+	}
+
 	void SDCardTest()
 	{
 		using Driver::Device::SD_t;
@@ -97,6 +259,11 @@ namespace MOS::User::Test
 		    multi_tx_buf[MULTI_BUFFER_SIZE],
 		    multi_rx_buf[MULTI_BUFFER_SIZE];
 
+		// Scratch sectors: a contiguous file on the mounted card, so the raw
+		// writes below touch nothing of FatFs, the cache or read-ahead
+		static constexpr auto SCRATCH_BLOCKS = 64;
+		static uint64_t scratch              = 0; // byte address of its first block
+
 		static auto buf_cmp =
 		    [](uint8_t* buf_1, uint8_t* buf_2,
 		       uint32_t length) {
@@ -127,14 +294,14 @@ namespace MOS::User::Test
 			static SD_t::Error err = SD_t::RESPONSE_NO_ERROR;
 
 			if (err == SD_t::RESPONSE_NO_ERROR) {
-				/* Write block of 512 bytes on address 0 */
-				err = sd.write_block(single_tx_buf, 0x00, BLOCK_SIZE);
+				/* Write block of 512 bytes on the scratch address */
+				err = sd.write_block(single_tx_buf, scratch, BLOCK_SIZE);
 				/* Check if the Transfer is finished */
 			}
 
 			if (err == SD_t::RESPONSE_NO_ERROR) {
-				/* Read block of 512 bytes from address 0 */
-				err = sd.read_block(single_rx_buf, 0x00, BLOCK_SIZE);
+				/* Read block of 512 bytes from the scratch address */
+				err = sd.read_block(single_rx_buf, scratch, BLOCK_SIZE);
 			}
 
 			/* Check the correctness of written data */
@@ -156,14 +323,14 @@ namespace MOS::User::Test
 			SD_t::Error err = SD_t::RESPONSE_NO_ERROR;
 
 			if (err == SD_t::RESPONSE_NO_ERROR) {
-				/* Write multiple block of many bytes on address 0 */
-				err = sd.write_multi_block(multi_tx_buf, 0x00, BLOCK_SIZE, NUMBER_OF_BLOCKS);
+				/* Write multiple block of many bytes on the scratch address */
+				err = sd.write_multi_block(multi_tx_buf, scratch, BLOCK_SIZE, NUMBER_OF_BLOCKS);
 				/* Check if the Transfer is finished */
 			}
 
 			if (err == SD_t::RESPONSE_NO_ERROR) {
-				/* Read block of many bytes from address 0 */
-				err = sd.read_multi_block(multi_rx_buf, 0x00, BLOCK_SIZE, NUMBER_OF_BLOCKS);
+				/* Read block of many bytes from the scratch address */
+				err = sd.read_multi_block(multi_rx_buf, scratch, BLOCK_SIZE, NUMBER_OF_BLOCKS);
 				/* Check if the Transfer is finished */
 			}
 
@@ -187,15 +354,97 @@ namespace MOS::User::Test
 
 			kprintf("ManufacturerID: %d\n"
 			        "Capacity: %d MB\n"
-			        "BlockSize: %d B\n",
+			        "BlockSize: %d B\n"
+			        "Clock: %d kHz (card max %d kHz, %d step downs)\n"
+			        "CRC: %s, %d bad blocks, %d retries\n",
 			        sd.info.cid.ManufacturerID,          //制造商ID
 			        (uint32_t) (sd.info.capacity >> 20), //显示容量
-			        sd.info.block_size);                 //显示块大小
+			        sd.info.block_size,                  //显示块大小
+			        sd.clk / 1000, sd.get_max_clk() / 1000, sd.step_cnt,
+			        sd.crc_on ? "on" : "off", sd.crc_errs, sd.retry_cnt);
 		};
 
+		// Sustained block throughput for 1, 8 and 64 sectors per call: polled, DMA, DMA with CRC checks
+		// on the scratch sectors
+		static auto Bench = [] {
+			static constexpr auto TOTAL = 256 * 1024; // bytes per measurement
+			static constexpr uint32_t SIZES[] = {1, 8, 64};
+
+			static uint8_t buf[64 * BLOCK_SIZE];
+
+			static auto measure = [](uint32_t n, auto&& fn) {
+				const auto t0 = Kernel::Global::os_ticks;
+				for (uint32_t i = 0; i < TOTAL / (n * BLOCK_SIZE); i++) {
+					fn(n);
+				}
+				const auto dt = Kernel::Global::os_ticks - t0;
+				return dt ? dt : 1;
+			};
+
+			// In 0.01 MB/s
+			static auto mb_s = [](auto ticks) {
+				return (uint32_t) ((uint64_t) TOTAL * 100 * Macro::SYSTICK / ticks >> 20);
+			};
+
+			static auto run = [](const char* mode) {
+				for (auto n: SIZES) {
+					const auto rd = measure(n, [](auto n) {
+						sd.read_multi_block(buf, scratch, BLOCK_SIZE, n);
+					});
+					const auto wr = measure(n, [](auto n) {
+						sd.write_multi_block(buf, scratch, BLOCK_SIZE, n);
+					});
+					kprintf(
+					    "SD %s x%d -> read: %d.%02d MB/s, write: %d.%02d MB/s\n", mode, n,
+					    mb_s(rd) / 100, mb_s(rd) % 100, mb_s(wr) / 100, mb_s(wr) % 100
+					);
+				}
+			};
+
+			if (sd.read_multi_block(buf, scratch, BLOCK_SIZE, SCRATCH_BLOCKS) != SD_t::RESPONSE_NO_ERROR) {
+				MOS_MSG("SD Bench -> Read failed!");
+				return;
+			}
+
+			const auto dma = sd.dma;
+			const auto crc = sd.crc_on;
+
+			sd.set_crc(false);
+			sd.dma = nullptr;
+			run("polled");
+			sd.dma = dma;
+			if (dma) run("dma");
+			if (sd.set_crc(true) == SD_t::RESPONSE_NO_ERROR) run(dma ? "dma+crc" : "polled+crc");
+			sd.set_crc(crc);
+		};
+
+		// Call from a task once FatFs has mounted the card: the scratch file
+		// comes from it, and the SPI5 lock keeps the 'blk' worker (fills, cache
+		// write backs) and every other SD user off the bus while the driver's
+		// DMA and CRC modes are switched under them
+		static FileSys::RawFile_t raw;
+		FileSys::File_t file {raw};
+
+		auto res = file.open("0:sdtest.bin", FileSys::File_t::OpenMode::Write);
+		if (res == FR_OK) res = file.preallocate(SCRATCH_BLOCKS * BLOCK_SIZE);
+		if (res != FR_OK) {
+			MOS_MSG("SD Test -> No scratch file:(%d)", res);
+			file.close();
+			f_unlink("0:sdtest.bin");
+			return;
+		}
+		scratch = (uint64_t) file.sect0 * BLOCK_SIZE;
+
 		ShowInfo();
+		FileSys::Blk::sd_lock.take();
+		Bench();
 		SingleBlockTest();
 		MultiBlockTest();
+		FileSys::Blk::sd_lock.give();
+
+		// The TRIM of the unlink drops whatever read-ahead or the cache still held for it
+		file.close();
+		f_unlink("0:sdtest.bin");
 	}
 }
 
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Generate per-frame dirty rectangles for the RGB565 GIF frames in img/.
+
+Each frame is compared with the previous one (cyclically, so the last frame
+leads back to the first). Changed pixels of a row are grouped into spans,
+spans closer than GAP pixels are joined, and spans on consecutive rows are
+folded into one rectangle while that is cheaper than opening a new window.
+
+Usage: gif_dirty.py <frames.h | face_0.h face_1.h ...> -n <name> -o <dirty.h>
+"""
+
+import argparse
+import re
+
+W = H = 128
+GAP = 8        # join spans separated by fewer changed-free pixels than this
+WINDOW = 15    # bytes on the bus to open a window (CASET/RASET/RAMWR)
+
+
+def load_frames(paths):
+    text = "".join(open(p).read() for p in paths)
+    arrays = re.findall(r"\w+\[(\d+)\]\s*=\s*\{(.*?)\};", text, re.S)
+    return [[int(v, 16) for v in re.findall(r"0x[0-9a-fA-F]+", body)]
+            for n, body in arrays if int(n) == W * H]
+
+
+def row_spans(prev, cur, y):
+    spans = []
+    x = 0
+    while x < W:
+        if prev[y * W + x] == cur[y * W + x]:
+            x += 1
+            continue
+        end = x
+        while end < W and prev[y * W + end] != cur[y * W + end]:
+            end += 1
+        if spans and x - spans[-1][1] <= GAP:
+            spans[-1][1] = end
+        else:
+            spans.append([x, end])
+        x = end
+    return spans
+
+
+def dirty_rects(prev, cur):
+    done, open_ = [], []  # rect: [x0, y0, x1(excl), y1(incl)]
+    for y in range(H):
+        still = []
+        for x0, x1 in row_spans(prev, cur, y):
+            best = None
+            for r in open_:
+                if r[3] != y - 1 or any(r is t for t in still):
+                    continue
+                ux0, ux1 = min(r[0], x0), max(r[2], x1)
+                h = y - r[1] + 1
+                waste = (ux1 - ux0) * h - ((r[2] - r[0]) * (h - 1) + (x1 - x0))
+                if waste * 2 < WINDOW and (best is None or waste < best[0]):
+                    best = (waste, r, ux0, ux1)
+            if best:
+                _, r, ux0, ux1 = best
+                r[0], r[2], r[3] = ux0, ux1, y
+                still.append(r)
+            else:
+                still.append([x0, y, x1, y])
+        done += [r for r in open_ if not any(r is t for t in still)]
+        open_ = still
+    done += open_
+    return [(x0, y0, x1 - 1, y1) for x0, y0, x1, y1 in done]
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("src", nargs="+")
+    ap.add_argument("-n", "--name", required=True)
+    ap.add_argument("-o", "--out", required=True)
+    args = ap.parse_args()
+
+    frames = load_frames(args.src)
+    name, guard = args.name, f"_{args.name.upper()}_GIF_DIRTY_"
+
+    out = [
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "// Generated by tools/gif_dirty.py, do not edit",
+        "// Dirty rectangles {x0, y0, x1, y1} of each frame against the previous one",
+        "",
+        "#include <stdint.h>",
+        "",
+    ]
+
+    total = 0
+    for i, cur in enumerate(frames):
+        rects = dirty_rects(frames[i - 1], cur)
+        cost = sum((x1 - x0 + 1) * (y1 - y0 + 1) * 2 + WINDOW for x0, y0, x1, y1 in rects)
+        total += cost
+        body = ", ".join(f"{{{x0}, {y0}, {x1}, {y1}}}" for x0, y0, x1, y1 in rects)
+        out.append(f"// {len(rects)} rects, ~{cost} bytes (full frame: {W * H * 2})")
+        out.append(f"static constexpr uint8_t {name}_dirty_{i}[][4] = {{{body}}};")
+
+    n = len(frames)
+    out += [
+        "",
+        f"static constexpr const uint8_t (*{name}_dirty[])[4] = {{"
+        + ", ".join(f"{name}_dirty_{i}" for i in range(n)) + "};",
+        "",
+        f"static constexpr uint16_t {name}_dirty_cnt[] = {{"
+        + ", ".join(f"sizeof({name}_dirty_{i}) / 4" for i in range(n)) + "};",
+        "",
+        "#endif",
+        "",
+    ]
+    open(args.out, "w").write("\n".join(out))
+    print(f"{name}: {n} frames, avg ~{total // n} bytes/frame vs {W * H * 2}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""
+Compress the RGB565 GIF frames in img/ into the Rle565_t format
+(see src/drivers/device/rle565.hpp).
+
+Each frame gets its own palette (GIF frames have at most 256 colors) and is
+coded row by row: runs of 3 or more equal pixels become one run op, the
+rest is packed into literal ops. A row offset table keeps every row
+addressable on its own, so dirty rectangles can be decoded in place.
+
+Usage: gif_rle.py <frames.h | face_0.h face_1.h ...> -n <name> -o <rle.h>
+"""
+
+import argparse
+
+from gif_dirty import W, H, load_frames
+
+MAX_OP = 128   # pixels per literal or run op
+MIN_RUN = 3    # shorter runs are cheaper as literals
+
+
+def encode_row(row, index):
+    out, lit = [], []
+
+    def flush():
+        while lit:
+            chunk = lit[:MAX_OP]
+            del lit[:MAX_OP]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    x = 0
+    while x < len(row):
+        n = 1
+        while x + n < len(row) and row[x + n] == row[x] and n < MAX_OP:
+            n += 1
+        if n >= MIN_RUN:
+            flush()
+            out += [0x7F + n, index[row[x]]]
+        else:
+            lit += [index[px] for px in row[x:x + n]]
+        x += n
+    flush()
+    return out
+
+
+def decode_row(code, pos, palette):
+    row = []
+    while len(row) < W:
+        op = code[pos]
+        if op & 0x80:
+            row += [palette[code[pos + 1]]] * (op - 0x7F)
+            pos += 2
+        else:
+            row += [palette[i] for i in code[pos + 1:pos + op + 2]]
+            pos += op + 2
+    return row
+
+
+def encode_frame(frame):
+    palette = sorted(set(frame))
+    assert len(palette) <= 256, "frame has more than 256 colors"
+    index = {px: i for i, px in enumerate(palette)}
+
+    rows, code = [], []
+    for y in range(H):
+        rows.append(len(code))
+        code += encode_row(frame[y * W:(y + 1) * W], index)
+    assert len(code) < 0x10000, "frame too large for 16-bit row offsets"
+
+    # Round trip, the decoder on target must see the exact same pixels
+    for y in range(H):
+        assert decode_row(code, rows[y], palette) == frame[y * W:(y + 1) * W]
+
+    return palette, rows, code
+
+
+def c_array(type_, name, values, fmt, per_line):
+    lines = [
+        "    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ","
+        for i in range(0, len(values), per_line)
+    ]
+    return [f"static constexpr {type_} {name}[] = {{", *lines, "};"]
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("src", nargs="+")
+    ap.add_argument("-n", "--name", required=True)
+    ap.add_argument("-o", "--out", required=True)
+    args = ap.parse_args()
+
+    frames = load_frames(args.src)
+    name, guard = args.name, f"_{args.name.upper()}_GIF_RLE_"
+
+    out = [
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "// Generated by tools/gif_rle.py, do not edit",
+        "",
+        '#include "../../../drivers/device/rle565.hpp"',
+        "",
+    ]
+
+    total = 0
+    for i, frame in enumerate(frames):
+        palette, rows, code = encode_frame(frame)
+        size = 2 * len(palette) + 2 * len(rows) + len(code)
+        total += size
+        out.append(f"// {len(palette)} colors, {size} bytes (raw: {W * H * 2})")
+        out += c_array("uint16_t", f"{name}_pal_{i}", palette, "0x{:04x}", 12)
+        out += c_array("uint16_t", f"{name}_row_{i}", rows, "{}", 16)
+        out += c_array("uint8_t", f"{name}_code_{i}", code, "0x{:02x}", 16)
+        out.append("")
+
+    n = len(frames)
+    out += [
+        f"// {n} frames, {total} bytes (raw: {n * W * H * 2})",
+        f"static constexpr Driver::Device::Rle565_t {name}_rle[] = {{",
+        *[f"    {{{W}, {H}, {name}_pal_{i}, {name}_row_{i}, {name}_code_{i}}},"
+          for i in range(n)],
+        "};",
+        "",
+        "#endif",
+        "",
+    ]
+    open(args.out, "w").write("\n".join(out))
+    print(f"{name}: {n} frames, {total} bytes vs {n * W * H * 2} raw "
+          f"({n * W * H * 2 / total:.1f}x)")
+
+
+if __name__ == "__main__":
+    main()